@@ -0,0 +1,160 @@
+/** @file
+ * Содержит описание типа ARENA и набор операций над ним.
+ * -----------------------------------------------------------------------------
+ * Арена - линейный распределитель памяти: страницы берутся у EFI_BOOT_SERVICES крупными кусками,
+ * выделение памяти из арены - это просто сдвиг указателя внутри текущего куска.
+ * Освобождается вся память разом, в Arena_Destruct().
+ *
+ * Отдельные выделения не освобождаются, за одним исключением: последнее выделение
+ * можно вернуть арене через Arena_Free() или нарастить на месте через Arena_Reallocate().
+ *
+ * Если арена используется на TPL выше TPL_NOTIFY, где сервисы памяти вызывать нельзя,
+ * владелец выставляет NoGrow: тогда новый кусок берётся только заранее, в Arena_Reserve(),
+ * а Arena_Allocate() лишь переходит на него и возвращает NULL, если запас кончился.
+ *
+ * Данный контейнер не использует средств синхронизации, это возлагается на потребителя.
+ * -----------------------------------------------------------------------------
+ */
+#include <Uefi.h>
+
+#ifndef ARENA_LIB_H_
+#define ARENA_LIB_H_
+
+// -----------------------------------------------------------------------------
+/**
+ * Кусок памяти арены, данные идут сразу за заголовком.
+ */
+typedef struct _ARENA_CHUNK ARENA_CHUNK;
+struct _ARENA_CHUNK
+{
+  ARENA_CHUNK *Next;
+  UINTN       Pages;              // Размер куска вместе с заголовком, в страницах.
+  UINTN       Size;               // Размер области данных в байтах.
+  UINTN       Used;               // Занято байт области данных.
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * Линейный распределитель памяти.
+ */
+typedef struct
+{
+  ARENA_CHUNK *FirstChunk;
+  ARENA_CHUNK *CurrentChunk;      // Из него идут выделения, все предыдущие уже заполнены.
+  UINTN       ChunkPages;         // Размер очередного куска в страницах.
+  VOID        *LastAllocation;    // Последнее выделение в CurrentChunk, NULL если его нельзя вернуть.
+  ARENA_CHUNK *SpareChunk;        // Запасной кусок от Arena_Reserve(), ещё не включённый в цепочку.
+  BOOLEAN     NoGrow;             // TRUE - Arena_Allocate() не берёт память у EFI_BOOT_SERVICES.
+  UINTN       AllocationCount;    // Статистика: количество выделений.
+  UINTN       BytesAllocated;     // Статистика: всего выдано байт, с учётом выравнивания и роста на месте.
+  UINTN       ChunkCount;         // Статистика: сколько раз брали память у EFI_BOOT_SERVICES.
+  UINTN       PagesAllocated;     // Статистика: всего взято страниц у EFI_BOOT_SERVICES.
+} ARENA;
+
+// -----------------------------------------------------------------------------
+/**
+ * Инициализирует структуру ARENA, сразу выделяет первый кусок памяти.
+ * Функция должна быть обязательно однократно вызвана перед использованием объекта.
+ *
+ * @param This                      Указатель на инициализируемую структуру.
+ * @param ChunkPages                Размер куска в страницах, по столько арена и растёт.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно, ареной можно пользоваться.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    This == NULL, либо ChunkPages == 0.
+ */
+EFI_STATUS
+Arena_Construct (
+  IN OUT  ARENA  *This,
+  IN      UINTN  ChunkPages
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает всю память арены, все выданные ей указатели становятся недействительными.
+ * Функция должна быть обязательно однократно вызвана после завершения использования объекта.
+ *
+ * @param This                      Указатель на структуру.
+ */
+VOID
+Arena_Destruct (
+  IN OUT  ARENA  *This
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Выделяет из арены Size байт, выровненных на 8.
+ * Если текущий кусок заполнен, арена переходит на запасной кусок,
+ * а если его нет или он мал - берёт новый у EFI_BOOT_SERVICES (кроме режима NoGrow).
+ *
+ * @param This                      Указатель на структуру.
+ * @param Size                      Требуемый размер в байтах.
+ *
+ * @retval NULL                     Не удалось выделить память, либо This == NULL.
+ * @return Указатель на выделенную память.
+ */
+VOID *
+Arena_Allocate (
+  IN OUT  ARENA  *This,
+  IN      UINTN  Size
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Гарантирует, что следующее выделение до Size байт не обратится к EFI_BOOT_SERVICES:
+ * если в текущем куске меньше Size свободных байт, заранее берёт запасной кусок.
+ * Работает и в режиме NoGrow, вызывать на TPL не выше TPL_NOTIFY.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Size                      Требуемый запас в байтах.
+ *
+ * @retval EFI_SUCCESS              Запас есть.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    This == NULL, либо арена не инициализирована.
+ */
+EFI_STATUS
+Arena_Reserve (
+  IN OUT  ARENA  *This,
+  IN      UINTN  Size
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Меняет размер выделенного из арены блока.
+ * Последнее выделение растёт на месте, если в куске хватает места,
+ * иначе выделяется новый блок, и в него копируется содержимое старого.
+ * Уменьшение блока никогда его не перемещает.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Old                       Ранее выделенный из арены блок, либо NULL.
+ * @param OldSize                   Размер блока Old в байтах.
+ * @param NewSize                   Требуемый размер в байтах.
+ *
+ * @retval NULL                     Не удалось выделить память, блок Old не изменился.
+ * @return Указатель на блок нового размера.
+ */
+VOID *
+Arena_Reallocate (
+  IN OUT  ARENA  *This,
+  IN      VOID   *Old     OPTIONAL,
+  IN      UINTN  OldSize,
+  IN      UINTN  NewSize
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает арене блок, если это последнее выделение. Иначе ничего не делает,
+ * память блока будет освобождена вместе со всей ареной.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Buffer                    Ранее выделенный из арены блок.
+ */
+VOID
+Arena_Free (
+  IN OUT  ARENA  *This,
+  IN      VOID   *Buffer
+  );
+
+// -----------------------------------------------------------------------------
+
+#endif  // ARENA_LIB_H_
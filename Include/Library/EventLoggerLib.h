@@ -5,6 +5,7 @@
 #include <Uefi.h>
 #include <Library/LoadingEventLib.h>
 #include <Library/VectorLib.h>
+#include <Library/ArenaLib.h>
 #include <Library/EventProviderLib.h>
 
 #ifndef LOGGER_LIB_H_
@@ -20,9 +21,11 @@ VOID
 
 // -----------------------------------------------------------------------------
 typedef struct {
-  VECTOR              LogData;                // тип элемента = LOADING_EVENT
+  SEGMENTED_VECTOR    LogData;                // тип элемента = LOADING_EVENT
+  ARENA               Arena;                  // Строки событий, освобождается целиком.
   EVENT_PROVIDER      EventProvider;
   EVENT_INCOMED_FUNC  EventIncomedCallback;
+  EFI_EVENT           EventsIncomedEvent;     // Таймер или сигнал при поступлении события, вызывает EventIncomedCallback.
 } LOGGER;
 
 // -----------------------------------------------------------------------------
@@ -31,9 +34,10 @@ typedef struct {
  * Функция должна быть обязательно однократно вызвана перед использованием объекта.
  *
  * @param This                      Указатель на структуру логгера, для которой выполняется инициализация.
- * @param EventIncomed              Функция. которая будет вызываться сразу после добавления события в контейнер,
- *                                  на время вызова производится блокировка через TPL.
- *                                  NULL, если не нужно.
+ * @param EventIncomed              Функция. которая будет вызываться после добавления событий в контейнер,
+ *                                  на TPL_CALLBACK: по ближайшему тику таймера, если сервис вызван
+ *                                  ниже TPL_CALLBACK, иначе как только TPL вызывающего опустится ниже.
+ *                                  Несколько событий могут прийти за один вызов. NULL, если не нужно.
  *
  * @retval EFI_SUCCESS              Операция завершена успешно.
  * @retval Любое другое значение    Произошла ошибка, объект не инициализирован.
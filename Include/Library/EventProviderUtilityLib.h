@@ -31,7 +31,7 @@ DetectProtocolsInstalledOnStartup (
 // -----------------------------------------------------------------------------
 /**
  * По хэндлу образа находит его имя и имя образа-родителя.
- * Указатели, возвращённые через OUT-параметры впоследствии требуется освободить.
+ * Имена берутся из пула строк событий (LoadingEvent_InternString()), изменять их нельзя.
 */
 VOID
 GetHandleImageNameAndParentImageName (
@@ -52,7 +52,7 @@ IsHandleImage (
 // -----------------------------------------------------------------------------
 /**
  * По хэндлу образа находит его имя.
- * Указатель, возвращённый через OUT-параметр впоследствии требуется освободить.
+ * Имя берётся из пула строк событий (LoadingEvent_InternString()), изменять его нельзя.
 */
 VOID
 GetHandleImageName (
@@ -62,7 +62,7 @@ GetHandleImageName (
 
 // -----------------------------------------------------------------------------
 /**
- * Выделяет память, копирует в неё аргумент, и возвращает указатель на память.
+ * Выделяет память через LoadingEvent_AllocatePool(), копирует в неё аргумент, и возвращает указатель на память.
  * В случае неудачи возвращает NULL.
 */
 CHAR16 *
@@ -72,24 +72,141 @@ StrAllocCopy (
 
 // -----------------------------------------------------------------------------
 /**
- * Добавляет к первой строке вторую, выделяя память под результат и освобождая предыдущую память под StrHead.
- * В случае неудачи оставляет без изменений.
-*/
+ * Строитель строк: буфер с запасом, который растёт вдвое,
+ * так что построение строки из N символов стоит O(N) копирований и O(log N) выделений.
+ * Память выделяется через LoadingEvent_AllocatePool().
+ */
+typedef struct {
+  CHAR16 *Buffer;           // Всегда завершён L'\0'.
+  UINTN  Length;            // Длина строки в символах, без L'\0'.
+  UINTN  Capacity;          // Размер буфера в символах.
+} STR_BUILDER;
+
+// -----------------------------------------------------------------------------
+/**
+ * Инициализирует строитель строк пустой строкой.
+ * Функция должна быть обязательно однократно вызвана перед использованием объекта.
+ *
+ * @param This                      Указатель на инициализируемую структуру.
+ * @param InitialCapacity           Начальная ёмкость в символах, 0 - по умолчанию.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    This == NULL.
+ */
+EFI_STATUS
+StrBuilder_Construct (
+  IN OUT STR_BUILDER *This,
+  IN     UINTN       InitialCapacity
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает память строителя, если результат не был забран через StrBuilder_Finish().
+ */
 VOID
-StrAllocAppend (
-  IN OUT CHAR16 **StrHead,
-  IN     CHAR16 *StrTail
+StrBuilder_Destruct (
+  IN OUT STR_BUILDER *This
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает строку Str в конец.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память, строка осталась прежней.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL, либо строитель уже завершён.
+ */
+EFI_STATUS
+StrBuilder_Append (
+  IN OUT STR_BUILDER  *This,
+  IN     CONST CHAR16 *Str
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в конец строку, отформатированную как в UnicodeSPrint().
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память, строка осталась прежней.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL, либо строитель уже завершён.
+ */
+EFI_STATUS
+EFIAPI
+StrBuilder_AppendFormat (
+  IN OUT STR_BUILDER  *This,
+  IN     CONST CHAR16 *Format,
+  ...
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Забирает результат. Строитель после этого пуст, и его не нужно разрушать.
+ *
+ * @retval NULL                     This == NULL, либо строитель уже завершён.
+ * @return Строка, выделенная через LoadingEvent_AllocatePool().
+ */
+CHAR16 *
+StrBuilder_Finish (
+  IN OUT STR_BUILDER *This
   );
 
 // -----------------------------------------------------------------------------
 /**
  * Возвращает по хэндлу его более информативное описание.
- * Не забыть освободить память из-под возвращаемого значения!
+ * Описание берётся из пула строк событий (LoadingEvent_InternString()), изменять его нельзя.
+ * Повторные вызовы для того же хэндла берут описание из кэша, пока не сменится поколение хэндла.
 */
 CHAR16 *GetHandleName (
   EFI_HANDLE Handle
   );
 
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает имя хэндла по его снимку, сделанному ранее в DescribeHandle().
+ * Сам хэндл к этому моменту может уже не существовать.
+ * Описание берётся из пула строк событий (LoadingEvent_InternString()), изменять его нельзя.
+*/
+CHAR16 *
+GetHandleSnapshotName (
+  IN HANDLE_SNAPSHOT *Snapshot
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Заполняет данные о хэндле для события, возникшего внутри перехваченного сервиса.
+ * Если PcdLazyHandleSymbolization == TRUE, то берёт имя из кэша, а если его там нет, то запоминает
+ * только снимок хэндла (это дёшево), а *HandleDescription = NULL; имя потом получает ResolveEventHandleName().
+ * Иначе сразу получает имя хэндла через GetHandleName(), а снимок не делает: *Snapshot = NULL.
+*/
+VOID
+DescribeHandle (
+  IN  EFI_HANDLE      Handle,
+  OUT CHAR16          **HandleDescription,
+  OUT HANDLE_SNAPSHOT **Snapshot
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Если у события есть снимок хэндла, но ещё нет имени, то получает имя по снимку.
+ * Вызывается на стороне записи лога, а не в перехваченных сервисах.
+*/
+VOID
+ResolveEventHandleName (
+  IN OUT LOADING_EVENT *Event
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Если Protocol определяет имя хэндла (EFI_LOADED_IMAGE_PROTOCOL, EFI_DEVICE_PATH_PROTOCOL),
+ * то сбрасывает закэшированное имя Handle. Вызывается после установки, переустановки или удаления Protocol.
+*/
+VOID
+InvalidateHandleNameOnProtocolChange (
+  IN EFI_HANDLE Handle,
+  IN EFI_GUID   *Protocol
+  );
+
 // -----------------------------------------------------------------------------
 
 #endif // EVENT_PROVIDER_UTILITY_LIB_H_
\ No newline at end of file
@@ -15,6 +15,8 @@ typedef struct
 
 typedef VECTOR TYPE (HANDLE_DATABASE_ENTRY)  HANDLE_DATABASE_DUMP;
 
+DECLARE_TYPED_VECTOR (HANDLE_DATABASE_ENTRY)
+
 
 //------------------------------------------------------------------------------
 /**
@@ -0,0 +1,196 @@
+/** @file
+ * Содержит описание типа HASH_MAP и набор операций над ним.
+ * -----------------------------------------------------------------------------
+ * Хэш-таблица с открытой адресацией и линейным пробированием.
+ * Ключ - либо EFI_GUID, либо значение размером с указатель (EFI_HANDLE, указатель на интерфейс).
+ * Значение - произвольный блок фиксированного размера, при нулевом размере таблица работает как множество.
+ *
+ * Ключи и значения хранятся прямо в таблице, одним блоком памяти.
+ * Память выделяется только при HashMap_Construct(), HashMap_Reserve()
+ * и при росте таблицы в HashMap_Insert(). Если заранее вызвать HashMap_Reserve()
+ * на нужное количество элементов, вставки и удаления память не выделяют и не освобождают,
+ * поэтому их можно выполнять на любом TPL, в т.ч. TPL_HIGH_LEVEL.
+ * Чтобы заполненная таблица не росла внутри HashMap_Insert(), владелец выставляет NoGrow,
+ * тогда вставка в неё возвращает EFI_OUT_OF_RESOURCES, а растёт таблица только в HashMap_Reserve().
+ * HashMap_Find() память не трогает никогда.
+ *
+ * Данный контейнер не использует средств синхронизации, это возлагается на потребителя.
+ * Нельзя долгое время хранить указатель на значение,
+ * т.к. при росте таблицы элементы переезжают на новые адреса, а при удалении - сдвигаются.
+ * -----------------------------------------------------------------------------
+ */
+#include <Uefi.h>
+
+#ifndef HASH_MAP_LIB_H_
+#define HASH_MAP_LIB_H_
+
+// -----------------------------------------------------------------------------
+/**
+ * Тип ключа хэш-таблицы.
+ */
+typedef enum {
+  HashMapKeyGuid,           // EFI_GUID, сравнение по содержимому.
+  HashMapKeyPointer         // Значение размером с указатель, сравнение по значению.
+} HASH_MAP_KEY_TYPE;
+
+// -----------------------------------------------------------------------------
+/**
+ * Хэш-таблица с открытой адресацией.
+ * Для выделения и освобождения памяти испульзует сервисы EFI_BOOT_SERVICES.
+ */
+typedef struct
+{
+  HASH_MAP_KEY_TYPE KeyType;
+  UINTN             KeySize;          // Размер ключа в байтах.
+  UINTN             ValueSize;        // Размер значения в байтах, 0 - множество.
+  UINTN             EntrySize;        // Размер ячейки таблицы: ключ + значение, с выравниванием.
+  UINTN             Capacity;         // Количество ячеек, всегда степень двойки.
+  UINTN             CountUsed;        // Количество занятых ячеек.
+  UINT8             *Used;            // Признаки занятости ячеек, Capacity байт.
+  UINT8             *Entries;         // Ячейки таблицы, Capacity * EntrySize байт.
+  BOOLEAN           NoGrow;           // TRUE - HashMap_Insert() не выделяет память.
+} HASH_MAP;
+
+// -----------------------------------------------------------------------------
+/**
+ * Инициализирует структуру HASH_MAP, выделяет память под InitialCount элементов.
+ * Функция должна быть обязательно однократно вызвана перед использованием объекта.
+ *
+ * @param This                      Указатель на инициализируемую структуру.
+ * @param KeyType                   Тип ключа.
+ * @param ValueSize                 Размер значения в байтах, 0 - множество ключей без значений.
+ * @param InitialCount              Сколько элементов можно вставить без выделения памяти.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно, таблицей можно пользоваться.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    This == NULL, либо неизвестный тип ключа.
+ */
+EFI_STATUS
+HashMap_Construct (
+  IN OUT  HASH_MAP          *This,
+  IN      HASH_MAP_KEY_TYPE KeyType,
+  IN      UINTN             ValueSize,
+  IN      UINTN             InitialCount
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает память из-под таблицы.
+ * Функция должна быть обязательно однократно вызвана после завершения использования объекта.
+ *
+ * @param This                      Указатель на структуру.
+ */
+VOID
+HashMap_Destruct (
+  IN OUT  HASH_MAP  *This
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Гарантирует, что в таблицу можно будет вставить до Count элементов (всего) без выделения памяти.
+ * Выделяет память, только если текущей таблицы недостаточно.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Count                     Требуемое количество элементов.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память, таблица осталась прежней.
+ * @retval EFI_INVALID_PARAMETER    This == NULL.
+ */
+EFI_STATUS
+HashMap_Reserve (
+  IN OUT  HASH_MAP  *This,
+  IN      UINTN     Count
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Вставляет в таблицу ключ Key со значением Value.
+ * Если такой ключ уже есть, его значение не меняется.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Key                       Указатель на ключ: EFI_GUID* либо указатель на переменную-указатель.
+ * @param Value                     Указатель на значение, для множества может быть NULL.
+ *
+ * @retval EFI_SUCCESS              Элемент вставлен.
+ * @retval EFI_ALREADY_STARTED      Такой ключ уже есть в таблице.
+ * @retval EFI_OUT_OF_RESOURCES     Таблица заполнена, а выделить память под новую не удалось
+ *                                  (или нельзя: NoGrow == TRUE).
+ * @retval EFI_INVALID_PARAMETER    This == NULL или Key == NULL, либо Value == NULL при ненулевом размере значения.
+ */
+EFI_STATUS
+HashMap_Insert (
+  IN OUT  HASH_MAP    *This,
+  IN      CONST VOID  *Key,
+  IN      CONST VOID  *Value  OPTIONAL
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет в таблице ключ Key.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Key                       Указатель на ключ.
+ *
+ * @retval NULL                     Ключ не найден.
+ * @return Указатель на значение, для множества - указатель на хранимый ключ.
+ *         Действителен до следующего изменения таблицы.
+ */
+VOID *
+HashMap_Find (
+  IN      HASH_MAP    *This,
+  IN      CONST VOID  *Key
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Удаляет из таблицы ключ Key вместе с его значением. Память не освобождается.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Key                       Указатель на ключ.
+ *
+ * @retval EFI_SUCCESS              Элемент удалён.
+ * @retval EFI_NOT_FOUND            Такого ключа в таблице нет.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL.
+ */
+EFI_STATUS
+HashMap_Remove (
+  IN OUT  HASH_MAP    *This,
+  IN      CONST VOID  *Key
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает количество хранимых элементов.
+ *
+ * @param This                      Указатель на структуру.
+ *
+ * @return Количество хранимых элементов.
+ */
+UINTN
+HashMap_Size (
+  IN      HASH_MAP  *This
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Перебирает элементы таблицы в произвольном порядке.
+ * Во время перебора таблицу менять нельзя.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Position                  Перед первым вызовом - 0, далее передаётся как есть.
+ * @param Key                       Сюда записывается указатель на хранимый ключ.
+ * @param Value                     Сюда записывается указатель на значение, может быть NULL.
+ *
+ * @retval TRUE                     Очередной элемент найден.
+ * @retval FALSE                    Элементы кончились.
+ */
+BOOLEAN
+HashMap_GetNext (
+  IN      HASH_MAP  *This,
+  IN OUT  UINTN     *Position,
+  OUT     VOID      **Key,
+  OUT     VOID      **Value   OPTIONAL
+  );
+
+#endif  // HASH_MAP_LIB_H_
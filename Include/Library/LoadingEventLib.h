@@ -2,6 +2,9 @@
  * Содержит описание типов событий, учёт которых мы ведём.
  */
 #include <Uefi.h>
+#include <Library/ProtocolGuidDatabaseLib.h>
+#include <Library/ArenaLib.h>
+#include <Protocol/DevicePath.h>
 
 #ifndef LOG_EVENT_LIB_H_
 #define LOG_EVENT_LIB_H_
@@ -19,16 +22,46 @@ typedef enum {
 } LOG_ENTRY_TYPE;
 
 // -----------------------------------------------------------------------------
+typedef enum {
+  HANDLE_SNAPSHOT_NONE = 0,           // Снимок не делался.
+  HANDLE_SNAPSHOT_IMAGE,              // Хэндл образа, DevicePath - копия LoadedImage->FilePath.
+  HANDLE_SNAPSHOT_DEVICE,             // Хэндл с EFI_DEVICE_PATH_PROTOCOL, DevicePath - его копия.
+  HANDLE_SNAPSHOT_OTHER               // Ни то, ни другое, известен только сам хэндл.
+} HANDLE_SNAPSHOT_KIND;
+
+// -----------------------------------------------------------------------------
+// Всё, что нужно для получения имени хэндла, даже если к моменту записи лога хэндла уже нет.
+// Снимок нужен не каждому событию, поэтому хранится отдельно, а событие держит лишь указатель на него.
+typedef struct {
+  HANDLE_SNAPSHOT_KIND      Kind;
+  EFI_HANDLE                Handle;
+  EFI_HANDLE                DeviceHandle;   // Для образа: LoadedImage->DeviceHandle.
+  EFI_DEVICE_PATH_PROTOCOL  *DevicePath;    // Копия, выделена через LoadingEvent_AllocatePool().
+  UINTN                     Generation;     // См. LoadingEvent_GetHandleGeneration().
+} HANDLE_SNAPSHOT;
+
+// -----------------------------------------------------------------------------
+// GUID протокола хранится в виде идентификатора, см. InternProtocolGuid().
+// Если HandleDescription == NULL, то имя хэндла получается из HandleSnapshot при записи лога.
+// HandleSnapshot выделен через LoadingEvent_AllocatePool(), NULL - снимок не делался
+// (имя получено сразу, в т.ч. всегда при PcdLazyHandleSymbolization == FALSE).
+// Duration - длительность вызова оригинального сервиса в тиках Timestamp_Read(), 0 - не измерялась.
+// MultipleCall - событие из Install/UninstallMultipleProtocolInterfaces(): длительность всего вызова
+// записана только у первого из его протоколов и к одному протоколу не относится.
 typedef PACKED struct {
-  GUID    Guid;
-  BOOLEAN Successful;
-  CHAR16  *HandleDescription;
+  PROTOCOL_GUID_ID  GuidId;
+  BOOLEAN           Successful;
+  BOOLEAN           MultipleCall;
+  EFI_HANDLE        Handle;
+  CHAR16            *HandleDescription;
+  HANDLE_SNAPSHOT   *HandleSnapshot;
+  UINT64            Duration;
 } LOG_ENTRY_PROTOCOL_INSTALLED, LOG_ENTRY_PROTOCOL_REINSTALLED, LOG_ENTRY_PROTOCOL_REMOVED;
 
 // -----------------------------------------------------------------------------
 typedef PACKED struct {
-  GUID    Guid;
-  CHAR16  *HandleDescription;
+  PROTOCOL_GUID_ID  GuidId;
+  CHAR16            *HandleDescription;
 } LOG_ENTRY_PROTOCOL_EXISTS_ON_STARTUP;
 
 // -----------------------------------------------------------------------------
@@ -56,6 +89,7 @@ typedef PACKED struct {
 // -----------------------------------------------------------------------------
 typedef PACKED struct {
   LOG_ENTRY_TYPE Type;
+  UINT64         Timestamp;       // Когда событие попало в лог, см. Timestamp_Read().
   union {
     LOG_ENTRY_PROTOCOL_INSTALLED          ProtocolInstalled;
     LOG_ENTRY_PROTOCOL_REINSTALLED        ProtocolReinstalled;
@@ -68,15 +102,193 @@ typedef PACKED struct {
   };
 } LOADING_EVENT;
 
+// -----------------------------------------------------------------------------
+/**
+ * Статистика пула интернированных строк.
+ */
+typedef struct {
+  UINTN UniqueCount;          // Различных строк в пуле.
+  UINTN ReferenceCount;       // Всего обращений к LoadingEvent_InternString().
+  UINTN BytesStored;          // Занято строками пула.
+  UINTN BytesSaved;           // Не выделено благодаря повторному использованию строк.
+} LOADING_EVENT_STRING_POOL_STATS;
+
+// -----------------------------------------------------------------------------
+/**
+ * Статистика кэша имён хэндлов.
+ */
+typedef struct {
+  UINTN Hits;                 // Имя найдено в кэше.
+  UINTN Misses;               // Имя пришлось получать заново.
+  UINTN Invalidations;        // Вызовов LoadingEvent_InvalidateHandleName().
+} LOADING_EVENT_HANDLE_NAME_CACHE_STATS;
+
 // -----------------------------------------------------------------------------
 /**
  * Корректно освобождает память из-под всех указателей в Event, не равных NULL.
+ * Если строки событий хранятся в арене, ничего не делает: они освобождаются вместе с ней.
 */
 VOID
 LoadingEvent_Destruct (
   LOADING_EVENT *Event
   );
 
+// -----------------------------------------------------------------------------
+/**
+ * Задаёт арену, из которой выделяется память под строки событий.
+ * Пока арена задана, LoadingEvent_FreePool() память не возвращает (кроме последнего выделения),
+ * вся она освобождается владельцем арены разом.
+ *
+ * @param Arena                     Арена, либо NULL - снова выделять память через EFI_BOOT_SERVICES.
+ */
+VOID
+LoadingEvent_SetArena (
+  IN ARENA *Arena  OPTIONAL
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Пополняет запас, из которого арена и таблицы пула строк и кэша имён хэндлов
+ * обслуживают вызовы на TPL_HIGH_LEVEL: после успешного вызова из арены можно выделить
+ * хотя бы MinSize байт, а в таблицы вставить ещё несколько десятков элементов без выделения памяти.
+ * Вызывается заранее потребителем арены и самими функциями библиотеки, когда запас кончился.
+ * Вызывать на TPL не выше TPL_NOTIFY.
+ *
+ * @param MinSize                   Размер ближайшего выделения из арены, 0 - обычный запас.
+ *
+ * @retval EFI_SUCCESS              Запас пополнен, либо арена не задана.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память под запас арены.
+ */
+EFI_STATUS
+LoadingEvent_ReserveMemory (
+  IN UINTN MinSize
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Выделяет память под данные события: из арены, если она задана, иначе через EFI_BOOT_SERVICES.
+ * Можно вызывать на любом TPL.
+ *
+ * @retval NULL                     Не удалось выделить память.
+ * @return Указатель на выделенную память, освобождать через LoadingEvent_FreePool().
+ */
+VOID *
+LoadingEvent_AllocatePool (
+  IN UINTN Size
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Меняет размер блока, выделенного LoadingEvent_AllocatePool().
+ * Последний выделенный из арены блок растёт на месте.
+ *
+ * @retval NULL                     Не удалось выделить память, блок Old не изменился.
+ * @return Указатель на блок нового размера, Old при этом больше использовать нельзя.
+ */
+VOID *
+LoadingEvent_ReallocatePool (
+  IN VOID  *Old     OPTIONAL,
+  IN UINTN OldSize,
+  IN UINTN NewSize
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает блок, выделенный LoadingEvent_AllocatePool().
+ */
+VOID
+LoadingEvent_FreePool (
+  IN VOID *Buffer  OPTIONAL
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает строку с тем же содержимым, что и Str, хранящуюся в пуле в единственном экземпляре.
+ * Повторные вызовы с одинаковыми строками возвращают один и тот же указатель и память не выделяют.
+ * Строка живёт до LoadingEvent_SetArena (NULL), изменять её нельзя.
+ * Передавать её в LoadingEvent_FreePool() можно, для строки из пула это ничего не делает.
+ * Если арена не задана, пул не ведётся и возвращается обычная копия.
+ * Можно вызывать на любом TPL.
+ *
+ * @retval NULL                     Str == NULL, либо не удалось выделить память.
+ * @return Указатель на строку из пула.
+ */
+CHAR16 *
+LoadingEvent_InternString (
+  IN CONST CHAR16 *Str
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает статистику пула интернированных строк.
+ */
+VOID
+LoadingEvent_GetStringPoolStats (
+  OUT LOADING_EVENT_STRING_POOL_STATS *Stats
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает поколение хэндла: сколько раз на нём менялись протоколы, от которых зависит его имя.
+ * Имя, полученное для хэндла в одном поколении, годится для всего этого поколения.
+ * Можно вызывать на любом TPL.
+ */
+UINTN
+LoadingEvent_GetHandleGeneration (
+  IN EFI_HANDLE Handle
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет в кэше имя хэндла Handle, полученное в поколении Generation.
+ * Кэш ведётся, пока задана арена: имена лежат в пуле строк.
+ * Можно вызывать на любом TPL.
+ *
+ * @retval NULL                     Имени в кэше нет, либо оно устарело.
+ * @return Строка из пула строк событий, изменять её нельзя.
+ */
+CHAR16 *
+LoadingEvent_FindHandleName (
+  IN EFI_HANDLE Handle,
+  IN UINTN      Generation
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Запоминает имя хэндла Handle, полученное в поколении Generation.
+ * Если поколение хэндла с тех пор сменилось, имя не запоминается.
+ * Можно вызывать на любом TPL.
+ *
+ * @param Name                      Строка из пула строк событий (LoadingEvent_InternString()).
+ */
+VOID
+LoadingEvent_CacheHandleName (
+  IN EFI_HANDLE Handle,
+  IN UINTN      Generation,
+  IN CHAR16     *Name
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Начинает новое поколение хэндла, закэшированное имя при этом забывается.
+ * Вызывается, когда на хэндле устанавливается, переустанавливается или удаляется протокол,
+ * от которого зависит имя хэндла.
+ * Можно вызывать на любом TPL.
+ */
+VOID
+LoadingEvent_InvalidateHandleName (
+  IN EFI_HANDLE Handle
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает статистику кэша имён хэндлов.
+ */
+VOID
+LoadingEvent_GetHandleNameCacheStats (
+  OUT LOADING_EVENT_HANDLE_NAME_CACHE_STATS *Stats
+  );
+
 // -----------------------------------------------------------------------------
 
 #endif // LOG_EVENT_LIB_H_
\ No newline at end of file
@@ -3,10 +3,19 @@
  * Сама БД генерится скриптом.
  */
 #include <Uefi.h>
+#include <Protocol/SimpleFileSystem.h>
 
 #ifndef PROTOCOL_GUID_DATABASE_LIB_H_
 #define PROTOCOL_GUID_DATABASE_LIB_H_
 
+// -----------------------------------------------------------------------------
+/**
+ * Компактный идентификатор GUID'а протокола, см. InternProtocolGuid().
+*/
+typedef UINT16 PROTOCOL_GUID_ID;
+
+#define PROTOCOL_GUID_ID_INVALID  ((PROTOCOL_GUID_ID)0xFFFF)
+
 // -----------------------------------------------------------------------------
 /**
  * Возвращает осмысленное имя протокола по его GUID'у.
@@ -14,18 +23,104 @@
  * @param Guid                      Указатель на GUID протокола.
  *
  * @retval NULL                     Протокол не найден в БД.
- * @return Указатель на строку, содержащую имя протокола.
+ * @return Указатель на ASCII-строку, содержащую имя протокола.
  *         Данная строка существует на протяжении всей жизни программы,
- *         перезаписывать её не следует.
+ *         перезаписывать её не следует. Печатать через "%a".
  */
-CHAR16 *
+CONST CHAR8 *
 GetProtocolName (
   IN EFI_GUID *Guid
   );
 
 // -----------------------------------------------------------------------------
 /**
- * Возвращает количество известных GUID.
+ * Готовит таблицы интернированных GUID'ов к тому, чтобы InternProtocolGuid() мог
+ * добавить в них ещё несколько десятков GUID'ов без выделения памяти, т.е. и на TPL_HIGH_LEVEL.
+ * При первом вызове создаёт таблицы.
+ * Вызывается заранее потребителем библиотеки и самим InternProtocolGuid(), когда запас кончился.
+ * Вызывать на TPL не выше TPL_NOTIFY.
+ *
+ * @retval EFI_SUCCESS              Запас есть.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ */
+EFI_STATUS
+ReserveProtocolGuidIds (
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает компактный идентификатор GUID'а протокола.
+ * Одинаковые GUID'ы всегда получают один и тот же идентификатор,
+ * поэтому в событиях достаточно хранить его вместо самого GUID'а.
+ * Можно вызывать на любом TPL. Выше TPL_NOTIFY новые GUID'ы интернируются
+ * только из запаса, см. ReserveProtocolGuidIds().
+ *
+ * @param Guid                      Указатель на GUID протокола.
+ *
+ * @retval PROTOCOL_GUID_ID_INVALID Guid == NULL, либо не хватило памяти или идентификаторов.
+ * @return Идентификатор GUID'а.
+ */
+PROTOCOL_GUID_ID
+InternProtocolGuid (
+  IN CONST EFI_GUID *Guid
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Копирует в Guid GUID протокола с идентификатором Id.
+ *
+ * @param Id                        Идентификатор, полученный от InternProtocolGuid().
+ * @param Guid                      Сюда записывается GUID. Для неизвестного Id - нулевой GUID.
+ *
+ * @retval EFI_SUCCESS              GUID записан.
+ * @retval EFI_NOT_FOUND            Такой Id не выдавался, записан нулевой GUID.
+ */
+EFI_STATUS
+GetInternedProtocolGuid (
+  IN  PROTOCOL_GUID_ID Id,
+  OUT EFI_GUID         *Guid
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает имя протокола с идентификатором Id.
+ * Поиск в БД выполняется только при первом запросе для каждого Id, дальше имя берётся из таблицы.
+ *
+ * @param Id                        Идентификатор, полученный от InternProtocolGuid().
+ *
+ * @retval NULL                     Протокол не найден в БД, либо такой Id не выдавался.
+ * @return Указатель на ASCII-строку, содержащую имя протокола.
+ *         Данная строка существует на протяжении всей жизни программы,
+ *         перезаписывать её не следует. Печатать через "%a".
+ */
+CONST CHAR8 *
+GetInternedProtocolName (
+  IN PROTOCOL_GUID_ID Id
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Загружает дополнительную БД имён протоколов из файла guiddb.bin в корне тома Root.
+ * Файл читается один раз, целиком, в единый буфер, поиск затем идёт прямо по нему.
+ * Загруженная БД имеет приоритет над встроенной в GetProtocolName().
+ * На GetProtocolGuidCount() и GetProtocolGuid() не влияет.
+ *
+ * @param Root                    Корень файловой системы.
+ *
+ * @retval EFI_SUCCESS            БД загружена.
+ * @retval EFI_ALREADY_STARTED    БД уже была загружена ранее, повторно не загружается.
+ * @retval EFI_NOT_FOUND          Файла нет.
+ * @retval EFI_VOLUME_CORRUPTED   Файл повреждён, используется только встроенная БД.
+ * @retval Что-то другое.         Ошибка чтения или выделения памяти.
+ */
+EFI_STATUS
+LoadProtocolGuidDatabaseFromFile (
+  IN EFI_FILE_PROTOCOL *Root
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает количество известных GUID во встроенной БД.
  *
  * @retval Количество известных GUID.
  */
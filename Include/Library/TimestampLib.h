@@ -0,0 +1,106 @@
+/** @file
+ * Содержит функции для получения меток времени высокого разрешения.
+ * -----------------------------------------------------------------------------
+ * Метка времени - значение счётчика тактов процессора (TSC). Чтение метки - одна инструкция,
+ * без вызовов EFI_BOOT_SERVICES, поэтому его можно делать прямо в перехваченных сервисах на любом TPL.
+ *
+ * Частота счётчика измеряется один раз, в Timestamp_Calibrate(), по gBS->Stall().
+ * Предполагается, что TSC инвариантный: его частота не зависит от режима энергосбережения процессора.
+ *
+ * Здесь же ведётся учёт времени, которое драйвер тратит сам на себя, по стадиям (OVERHEAD_STAGE).
+ * Учёт без блокировок: если перехваченный сервис прервал запись лога посреди измерения,
+ * время сервиса попадёт и в стадию записи, а одновременное обновление счётчика может потеряться.
+ * Для оценки порядка величин этого достаточно.
+ * -----------------------------------------------------------------------------
+ */
+#include <Uefi.h>
+
+#ifndef TIMESTAMP_LIB_H_
+#define TIMESTAMP_LIB_H_
+
+// -----------------------------------------------------------------------------
+typedef enum {
+  OVERHEAD_STAGE_CAPTURE,         // Добавление события в лог внутри перехваченного сервиса.
+  OVERHEAD_STAGE_SYMBOLIZE,       // Получение имён хэндлов и образов.
+  OVERHEAD_STAGE_FORMAT,          // Форматирование строк лога.
+  OVERHEAD_STAGE_WRITE,           // EFI_FILE_PROTOCOL.Write().
+  OVERHEAD_STAGE_FLUSH,           // EFI_FILE_PROTOCOL.Flush().
+  OVERHEAD_STAGE_COUNT
+} OVERHEAD_STAGE;
+
+// -----------------------------------------------------------------------------
+typedef struct {
+  UINTN   Calls;
+  UINT64  Ticks;                  // Суммарное время, в тиках Timestamp_Read().
+} OVERHEAD_STAGE_STATS;
+
+// -----------------------------------------------------------------------------
+/**
+ * Измеряет частоту счётчика, занимает около миллисекунды.
+ * Вызывается один раз при старте драйвера, до перевода меток во время.
+ *
+ * @retval EFI_SUCCESS              Частота измерена.
+ * @retval EFI_UNSUPPORTED          Счётчик не идёт, метки во время не переводятся.
+ * @retval Любое другое значение    Ошибка gBS->Stall().
+ */
+EFI_STATUS
+Timestamp_Calibrate (
+  VOID
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает текущую метку времени. Не вызывает EFI_BOOT_SERVICES, можно вызывать на любом TPL.
+ */
+UINT64
+Timestamp_Read (
+  VOID
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает частоту счётчика в тиках в секунду, 0 - если частота не измерена.
+ */
+UINT64
+Timestamp_GetFrequency (
+  VOID
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Переводит разность меток времени в микросекунды.
+ *
+ * @return Количество микросекунд, 0 - если частота не измерена.
+ */
+UINT64
+Timestamp_ToMicroseconds (
+  IN UINT64 Ticks
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Добавляет к стадии Stage время от метки Start до текущего момента.
+ * Не вызывает EFI_BOOT_SERVICES, можно вызывать на любом TPL.
+ *
+ * @param Stage                     Стадия работы драйвера.
+ * @param Start                     Метка начала, полученная от Timestamp_Read().
+ */
+VOID
+Timestamp_AccountOverhead (
+  IN OVERHEAD_STAGE Stage,
+  IN UINT64         Start
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает накопленное время стадии Stage.
+ */
+VOID
+Timestamp_GetOverheadStats (
+  IN  OVERHEAD_STAGE        Stage,
+  OUT OVERHEAD_STAGE_STATS  *Stats
+  );
+
+// -----------------------------------------------------------------------------
+
+#endif  // TIMESTAMP_LIB_H_
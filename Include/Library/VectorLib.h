@@ -5,6 +5,7 @@
  * Нельзя долгое время хранить указатель на элемент контейнера,
  * т.к. вектор при очередном Vector_PushBack() может переместить свои элементы на новые адреса.
  * При необходимости выделить большее количество памяти растёт вдвое.
+ * Если элементы должны оставаться на месте, следует использовать SEGMENTED_VECTOR.
  * -----------------------------------------------------------------------------
  */
 #include <Uefi.h>
@@ -74,6 +75,24 @@ Vector_PushBack (
   IN      VOID            *Object
   );
 
+// -----------------------------------------------------------------------------
+/**
+ * Гарантирует, что вектор вмещает не менее Count элементов без перевыделения памяти.
+ * Если памяти уже достаточно, ничего не делает.
+ *
+ * @param This                      Указатель на структуру вектора.
+ * @param Count                     Требуемая вместимость в элементах.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память, вектор не изменился.
+ * @retval EFI_INVALID_PARAMETER    This == NULL.
+ */
+EFI_STATUS
+Vector_Reserve (
+  IN OUT  VECTOR          *This,
+  IN      UINTN           Count
+  );
+
 // -----------------------------------------------------------------------------
 /**
  * Удаляет объект с конца вектора и возвращает значение удалённого элемента,
@@ -173,6 +192,95 @@ Vector_Clear (
   );
 
 
+// -----------------------------------------------------------------------------
+/**
+ * Функция сравнения элементов для алгоритмов над VECTOR.
+ *
+ * @retval < 0   Left меньше Right.
+ * @retval 0     Left равен Right.
+ * @retval > 0   Left больше Right.
+ */
+typedef
+INTN
+(EFIAPI *VECTOR_COMPARE) (
+  IN CONST VOID *Left,
+  IN CONST VOID *Right
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Сортирует элементы вектора по возрастанию.
+ * Используется пирамидальная сортировка: O(n log n) в худшем случае,
+ * без дополнительной памяти. Сортировка неустойчивая.
+ *
+ * @param This                      Указатель на структуру вектора.
+ * @param Compare                   Функция сравнения элементов.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL.
+ */
+EFI_STATUS
+Vector_Sort (
+  IN OUT  VECTOR          *This,
+  IN      VECTOR_COMPARE  Compare
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет в отсортированном векторе первый элемент, не меньший Key. Двоичный поиск.
+ *
+ * @param This                      Указатель на структуру отсортированного вектора.
+ * @param Key                       Искомое значение.
+ * @param Compare                   Функция сравнения, та же, что и при сортировке.
+ *
+ * @return Индекс найденного элемента, либо Vector_Size(), если все элементы меньше Key.
+ */
+UINTN
+Vector_LowerBound (
+  IN      VECTOR          *This,
+  IN      CONST VOID      *Key,
+  IN      VECTOR_COMPARE  Compare
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Удаляет из отсортированного вектора повторяющиеся элементы, оставляя по одному.
+ * Память не освобождается, меняется только количество элементов.
+ *
+ * @param This                      Указатель на структуру отсортированного вектора.
+ * @param Compare                   Функция сравнения, та же, что и при сортировке.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL.
+ */
+EFI_STATUS
+Vector_Unique (
+  IN OUT  VECTOR          *This,
+  IN      VECTOR_COMPARE  Compare
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в Result элементы отсортированного вектора Left,
+ * отсутствующие в отсортированном векторе Right. Один проход по обоим: O(n + m).
+ *
+ * @param Left                      Отсортированный вектор, из которого берутся элементы.
+ * @param Right                     Отсортированный вектор вычитаемых элементов.
+ * @param Compare                   Функция сравнения, та же, что и при сортировке.
+ * @param Result                    Уже инициализированный вектор того же типа, результат дописывается в конец.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память, в Result могла попасть часть результата.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL, либо размеры элементов не совпадают.
+ */
+EFI_STATUS
+Vector_SetDifference (
+  IN      VECTOR          *Left,
+  IN      VECTOR          *Right,
+  IN      VECTOR_COMPARE  Compare,
+  IN OUT  VECTOR          *Result
+  );
+
 // -----------------------------------------------------------------------------
 /**
  * Пример цикла по всем элементам вектора:
@@ -197,4 +305,278 @@ Vector_Clear (
   ElementType *EndIterator     = Vector_GetEnd(&(VectorName)); \
   for (; IteratorVarName != EndIterator; ++IteratorVarName)
 
+// -----------------------------------------------------------------------------
+/**
+ * Сегментированный массив: цепочка блоков фиксированного размера.
+ * В отличие от VECTOR никогда не перемещает элементы: при заполнении блока
+ * просто выделяется следующий, поэтому добавление всегда O(1) без копирования,
+ * а указатели на элементы остаются действительными до SegmentedVector_Destruct().
+ * Доступ по индексу проходит по цепочке, но последовательное чтение
+ * (индексы по возрастанию) благодаря курсору выполняется за O(1).
+ * Блоки можно подвесить заранее через SegmentedVector_Reserve(); с NoGrow == TRUE
+ * PushBack только переходит на них и не вызывает сервисы памяти.
+ */
+typedef struct _SEGMENTED_VECTOR_BLOCK SEGMENTED_VECTOR_BLOCK;
+
+struct _SEGMENTED_VECTOR_BLOCK {
+  SEGMENTED_VECTOR_BLOCK  *Next;
+  // Далее в той же аллокации лежат CountPerBlock элементов.
+};
+
+typedef struct
+{
+  UINTN                   CountPerBlock;      // Вместимость одного блока в элементах.
+  UINTN                   CountUsed;          // Количество реально хранимых элементов.
+  UINTN                   ObjectSize;         // Размер одного элемента в байтах.
+  SEGMENTED_VECTOR_BLOCK  *FirstBlock;
+  SEGMENTED_VECTOR_BLOCK  *LastBlock;
+  UINTN                   LastBlockUsed;      // Количество занятых элементов в LastBlock.
+  SEGMENTED_VECTOR_BLOCK  *CursorBlock;        // Блок, к которому было последнее обращение.
+  UINTN                   CursorBlockIndex;   // Порядковый номер CursorBlock в цепочке.
+  BOOLEAN                 NoGrow;             // TRUE - PushBack не выделяет новые блоки сам.
+} SEGMENTED_VECTOR;
+
+// -----------------------------------------------------------------------------
+/**
+ * Инициализирует структуру SEGMENTED_VECTOR, выделяет память под первый блок.
+ * Функция должна быть обязательно однократно вызвана перед использованием объекта.
+ *
+ * @param This                      Указатель на инициализируемую структуру.
+ * @param SizeOfElement             Размер одного элемента в байтах.
+ * @param CountPerBlock             Количество элементов в одном блоке.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно, массивом можно пользоваться.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен нулю.
+ */
+EFI_STATUS
+SegmentedVector_Construct (
+  IN OUT  SEGMENTED_VECTOR  *This,
+  IN      UINTN             SizeOfElement,
+  IN      UINTN             CountPerBlock
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает память из-под всех блоков.
+ * Функция должна быть обязательно однократно вызвана после завершения использования объекта.
+ *
+ * @param This                      Указатель на структуру.
+ */
+VOID
+SegmentedVector_Destruct (
+  IN OUT  SEGMENTED_VECTOR  *This
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Добавляет копию объекта в конец массива.
+ * Уже хранимые элементы не перемещаются.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Object                    Указатель на элемент, который требуется добавить.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память под новый блок,
+ *                                  либо NoGrow == TRUE и запасные блоки кончились.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL.
+ */
+EFI_STATUS
+SegmentedVector_PushBack (
+  IN OUT  SEGMENTED_VECTOR  *This,
+  IN      VOID              *Object
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Подвешивает за последним блоком столько запасных, чтобы ещё Count элементов
+ * добавились без выделения памяти. Работает и при NoGrow == TRUE.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Count                     Сколько элементов должно поместиться без роста.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    This == NULL, либо массив не инициализирован.
+ */
+EFI_STATUS
+SegmentedVector_Reserve (
+  IN OUT  SEGMENTED_VECTOR  *This,
+  IN      UINTN             Count
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает указатель на элемент с индексом Index, нумерация с 0.
+ * Указатель остаётся действительным до SegmentedVector_Destruct().
+ *
+ * @param This                      Указатель на структуру.
+ * @param Index                     Индекс элемента.
+ *
+ * @retval NULL                     Выход за границы массива, либо This == NULL.
+ * @return Указатель на элемент с индексом Index.
+ */
+VOID *
+SegmentedVector_Get (
+  IN      SEGMENTED_VECTOR  *This,
+  IN      UINTN             Index
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает количество хранимых элементов.
+ *
+ * @param This                      Указатель на структуру.
+ *
+ * @return Количество хранимых элементов.
+ */
+UINTN
+SegmentedVector_Size (
+  IN      SEGMENTED_VECTOR  *This
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Пример цикла по всем элементам сегментированного массива:
+ *
+ *   FOR_EACH_SEG_VCT(MY_TYPE, PointerToElement, MySegmentedVector) {
+ *     *PointerToElement = ...;
+ *   }
+ */
+#define FOR_EACH_SEG_VCT(ElementType, IteratorVarName, VectorName) \
+  ElementType *IteratorVarName = SegmentedVector_Get(&(VectorName), 0); \
+  for (UINTN IteratorVarName##Index = 0; \
+       IteratorVarName != NULL; \
+       IteratorVarName = SegmentedVector_Get(&(VectorName), ++IteratorVarName##Index))
+
+// -----------------------------------------------------------------------------
+/**
+ * Типизированные обёртки над VECTOR и SEGMENTED_VECTOR.
+ *
+ * Обобщённые функции умножают индекс на ObjectSize, известный только во время
+ * выполнения, и копируют элементы через gBS->CopyMem(), т.е. косвенным вызовом.
+ * DECLARE_TYPED_VECTOR(Type) генерит inline-функции с размером элемента,
+ * известным при компиляции, и копированием обычным присваиванием:
+ *
+ *   Vector_Get_##Type, Vector_GetBegin_##Type, Vector_GetEnd_##Type, Vector_PushBack_##Type
+ *
+ * Обобщённые функции вызываются только на медленном пути (рост вектора).
+ * Type должен быть идентификатором (typedef), а макрос - раскрываться
+ * не более одного раза на единицу трансляции.
+ *
+ *   DECLARE_TYPED_VECTOR (MY_TYPE)
+ *
+ *   VECTOR TYPE (MY_TYPE) MyVector;
+ *   Vector_Construct (&MyVector, sizeof(MY_TYPE), 16);
+ *   Vector_PushBack_MY_TYPE (&MyVector, &Element);
+ *   FOR_EACH_TYPED_VCT (MY_TYPE, PointerToElement, MyVector) {
+ *     ...
+ *   }
+ */
+#define DECLARE_TYPED_VECTOR(Type)                                              \
+  STATIC inline                                                                 \
+  Type *                                                                        \
+  Vector_Get_##Type (                                                           \
+    IN VECTOR *This,                                                            \
+    IN UINTN  Index                                                             \
+    )                                                                           \
+  {                                                                             \
+    if (Index >= This->CountUsed) {                                             \
+      return NULL;                                                              \
+    }                                                                           \
+    return (Type *)This->AllocatedMemory + Index;                               \
+  }                                                                             \
+                                                                                \
+  STATIC inline                                                                 \
+  Type *                                                                        \
+  Vector_GetBegin_##Type (                                                      \
+    IN VECTOR *This                                                             \
+    )                                                                           \
+  {                                                                             \
+    return (Type *)This->AllocatedMemory;                                       \
+  }                                                                             \
+                                                                                \
+  STATIC inline                                                                 \
+  Type *                                                                        \
+  Vector_GetEnd_##Type (                                                        \
+    IN VECTOR *This                                                             \
+    )                                                                           \
+  {                                                                             \
+    return (Type *)This->AllocatedMemory + This->CountUsed;                     \
+  }                                                                             \
+                                                                                \
+  STATIC inline                                                                 \
+  EFI_STATUS                                                                    \
+  Vector_PushBack_##Type (                                                      \
+    IN OUT VECTOR     *This,                                                    \
+    IN     CONST Type *Object                                                   \
+    )                                                                           \
+  {                                                                             \
+    if (This->CountUsed == This->CountAllocated) {                              \
+      EFI_STATUS Status = Vector_Reserve (This, This->CountAllocated * 2);      \
+      if (EFI_ERROR (Status)) {                                                 \
+        return Status;                                                          \
+      }                                                                         \
+    }                                                                           \
+    ((Type *)This->AllocatedMemory)[This->CountUsed++] = *Object;               \
+    return EFI_SUCCESS;                                                         \
+  }
+
+// -----------------------------------------------------------------------------
+/**
+ * Аналог FOR_EACH_VCT для векторов, объявленных через DECLARE_TYPED_VECTOR.
+ */
+#define FOR_EACH_TYPED_VCT(ElementType, IteratorVarName, VectorName) \
+  ElementType *IteratorVarName = Vector_GetBegin_##ElementType(&(VectorName)); \
+  ElementType *IteratorVarName##End = Vector_GetEnd_##ElementType(&(VectorName)); \
+  for (; IteratorVarName != IteratorVarName##End; ++IteratorVarName)
+
+// -----------------------------------------------------------------------------
+/**
+ * Типизированные обёртки над SEGMENTED_VECTOR, аналогично DECLARE_TYPED_VECTOR:
+ *
+ *   SegmentedVector_Get_##Type, SegmentedVector_PushBack_##Type
+ *
+ * Get без вызова функции обслуживает обращения в пределах блока под курсором,
+ * PushBack - добавление в незаполненный последний блок.
+ */
+#define DECLARE_TYPED_SEGMENTED_VECTOR(Type)                                    \
+  STATIC inline                                                                 \
+  Type *                                                                        \
+  SegmentedVector_Get_##Type (                                                  \
+    IN SEGMENTED_VECTOR *This,                                                  \
+    IN UINTN            Index                                                   \
+    )                                                                           \
+  {                                                                             \
+    UINTN CursorFirstIndex = This->CursorBlockIndex * This->CountPerBlock;      \
+    if (Index >= CursorFirstIndex                                               \
+      && Index - CursorFirstIndex < This->CountPerBlock                         \
+      && Index < This->CountUsed) {                                             \
+      return (Type *)(This->CursorBlock + 1) + (Index - CursorFirstIndex);      \
+    }                                                                           \
+    return (Type *)SegmentedVector_Get (This, Index);                           \
+  }                                                                             \
+                                                                                \
+  STATIC inline                                                                 \
+  EFI_STATUS                                                                    \
+  SegmentedVector_PushBack_##Type (                                             \
+    IN OUT SEGMENTED_VECTOR *This,                                              \
+    IN     CONST Type       *Object                                             \
+    )                                                                           \
+  {                                                                             \
+    if (This->LastBlock == NULL || This->LastBlockUsed == This->CountPerBlock) { \
+      return SegmentedVector_PushBack (This, (VOID *)Object);                   \
+    }                                                                           \
+    ((Type *)(This->LastBlock + 1))[This->LastBlockUsed++] = *Object;           \
+    This->CountUsed++;                                                          \
+    return EFI_SUCCESS;                                                         \
+  }
+
+// -----------------------------------------------------------------------------
+/**
+ * Специализации для самых частых типов элементов.
+ */
+DECLARE_TYPED_VECTOR (EFI_GUID)
+DECLARE_TYPED_VECTOR (EFI_HANDLE)
+
 #endif // VECTOR_LIB_H_
\ No newline at end of file
@@ -0,0 +1,298 @@
+#include <Library/ArenaLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+// -----------------------------------------------------------------------------
+#define ARENA_ALIGNMENT           sizeof (UINT64)
+#define CHUNK_HEADER_SIZE         ALIGN_VALUE (sizeof (ARENA_CHUNK), ARENA_ALIGNMENT)
+#define CHUNK_DATA(Chunk)         ((UINT8 *)(Chunk) + CHUNK_HEADER_SIZE)
+
+// -----------------------------------------------------------------------------
+/**
+ * Берёт у EFI_BOOT_SERVICES новый кусок, в котором поместится хотя бы MinSize байт.
+ *
+ * @retval NULL                     Не удалось выделить память.
+ * @return Указатель на кусок.
+ */
+STATIC
+ARENA_CHUNK *
+AllocateChunk (
+  IN OUT  ARENA  *This,
+  IN      UINTN  MinSize
+  )
+{
+  EFI_STATUS           Status;
+  EFI_PHYSICAL_ADDRESS Address;
+
+  if (MinSize > MAX_UINTN - CHUNK_HEADER_SIZE - EFI_PAGE_MASK) {
+    return NULL;
+  }
+
+  // Крупное выделение получает собственный кусок нужного размера.
+  UINTN Pages = MAX (This->ChunkPages, EFI_SIZE_TO_PAGES (CHUNK_HEADER_SIZE + MinSize));
+
+  Status = gBS->AllocatePages (
+                  AllocateAnyPages,
+                  EfiBootServicesData,
+                  Pages,
+                  &Address
+                  );
+  if (EFI_ERROR (Status)) {
+    return NULL;
+  }
+
+  ARENA_CHUNK *Chunk = (ARENA_CHUNK *)(UINTN)Address;
+  Chunk->Next  = NULL;
+  Chunk->Pages = Pages;
+  Chunk->Size  = EFI_PAGES_TO_SIZE (Pages) - CHUNK_HEADER_SIZE;
+  Chunk->Used  = 0;
+
+  This->PagesAllocated += Pages;
+  This->ChunkCount++;
+  return Chunk;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Инициализирует структуру ARENA, сразу выделяет первый кусок памяти.
+ * Функция должна быть обязательно однократно вызвана перед использованием объекта.
+ *
+ * @param This                      Указатель на инициализируемую структуру.
+ * @param ChunkPages                Размер куска в страницах, по столько арена и растёт.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно, ареной можно пользоваться.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    This == NULL, либо ChunkPages == 0.
+ */
+EFI_STATUS
+Arena_Construct (
+  IN OUT  ARENA  *This,
+  IN      UINTN  ChunkPages
+  )
+{
+  if (This == NULL || ChunkPages == 0) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  This->ChunkPages      = ChunkPages;
+  This->LastAllocation  = NULL;
+  This->SpareChunk      = NULL;
+  This->NoGrow          = FALSE;
+  This->AllocationCount = 0;
+  This->BytesAllocated  = 0;
+  This->ChunkCount      = 0;
+  This->PagesAllocated  = 0;
+  This->FirstChunk      = AllocateChunk (This, 0);
+  This->CurrentChunk    = This->FirstChunk;
+
+  if (This->FirstChunk == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает всю память арены, все выданные ей указатели становятся недействительными.
+ * Функция должна быть обязательно однократно вызвана после завершения использования объекта.
+ *
+ * @param This                      Указатель на структуру.
+ */
+VOID
+Arena_Destruct (
+  IN OUT  ARENA  *This
+  )
+{
+  ARENA_CHUNK *Chunk = This->FirstChunk;
+
+  while (Chunk != NULL) {
+    ARENA_CHUNK *Next = Chunk->Next;
+    gBS->FreePages ((EFI_PHYSICAL_ADDRESS)(UINTN)Chunk, Chunk->Pages);
+    Chunk = Next;
+  }
+
+  if (This->SpareChunk != NULL) {
+    gBS->FreePages ((EFI_PHYSICAL_ADDRESS)(UINTN)This->SpareChunk, This->SpareChunk->Pages);
+  }
+
+  This->FirstChunk     = NULL;
+  This->SpareChunk     = NULL;
+  This->CurrentChunk   = NULL;
+  This->LastAllocation = NULL;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Выделяет из арены Size байт, выровненных на 8.
+ * Если текущий кусок заполнен, арена переходит на запасной кусок,
+ * а если его нет или он мал - берёт новый у EFI_BOOT_SERVICES (кроме режима NoGrow).
+ *
+ * @param This                      Указатель на структуру.
+ * @param Size                      Требуемый размер в байтах.
+ *
+ * @retval NULL                     Не удалось выделить память, либо This == NULL.
+ * @return Указатель на выделенную память.
+ */
+VOID *
+Arena_Allocate (
+  IN OUT  ARENA  *This,
+  IN      UINTN  Size
+  )
+{
+  if (This == NULL || This->CurrentChunk == NULL || Size > MAX_UINTN - ARENA_ALIGNMENT) {
+    return NULL;
+  }
+
+  UINTN       AlignedSize = ALIGN_VALUE (Size, ARENA_ALIGNMENT);
+  ARENA_CHUNK *Chunk      = This->CurrentChunk;
+
+  if (Chunk->Size - Chunk->Used < AlignedSize) {
+    // Остаток текущего куска пропадает, к прежним кускам не возвращаемся.
+    ARENA_CHUNK *NewChunk;
+    if (This->SpareChunk != NULL && This->SpareChunk->Size >= AlignedSize) {
+      NewChunk         = This->SpareChunk;
+      This->SpareChunk = NULL;
+    } else if (This->NoGrow) {
+      return NULL;
+    } else {
+      NewChunk = AllocateChunk (This, AlignedSize);
+      if (NewChunk == NULL) {
+        return NULL;
+      }
+    }
+
+    Chunk->Next        = NewChunk;
+    This->CurrentChunk = NewChunk;
+    Chunk              = NewChunk;
+  }
+
+  VOID *Buffer = CHUNK_DATA (Chunk) + Chunk->Used;
+  Chunk->Used += AlignedSize;
+
+  This->LastAllocation = Buffer;
+  This->AllocationCount++;
+  This->BytesAllocated += AlignedSize;
+  return Buffer;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Гарантирует, что следующее выделение до Size байт не обратится к EFI_BOOT_SERVICES:
+ * если в текущем куске меньше Size свободных байт, заранее берёт запасной кусок.
+ * Работает и в режиме NoGrow, вызывать на TPL не выше TPL_NOTIFY.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Size                      Требуемый запас в байтах.
+ *
+ * @retval EFI_SUCCESS              Запас есть.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    This == NULL, либо арена не инициализирована.
+ */
+EFI_STATUS
+Arena_Reserve (
+  IN OUT  ARENA  *This,
+  IN      UINTN  Size
+  )
+{
+  if (This == NULL || This->CurrentChunk == NULL || Size > MAX_UINTN - ARENA_ALIGNMENT) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  UINTN       AlignedSize = ALIGN_VALUE (Size, ARENA_ALIGNMENT);
+  ARENA_CHUNK *Chunk      = This->CurrentChunk;
+
+  if (Chunk->Size - Chunk->Used >= AlignedSize) {
+    return EFI_SUCCESS;
+  }
+
+  if (This->SpareChunk != NULL) {
+    if (This->SpareChunk->Size >= AlignedSize) {
+      return EFI_SUCCESS;
+    }
+    // Запасной кусок мал для такого выделения, меняем его на больший.
+    gBS->FreePages ((EFI_PHYSICAL_ADDRESS)(UINTN)This->SpareChunk, This->SpareChunk->Pages);
+    This->SpareChunk = NULL;
+  }
+
+  This->SpareChunk = AllocateChunk (This, AlignedSize);
+  return (This->SpareChunk != NULL) ? EFI_SUCCESS : EFI_OUT_OF_RESOURCES;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Меняет размер выделенного из арены блока.
+ * Последнее выделение растёт на месте, если в куске хватает места,
+ * иначе выделяется новый блок, и в него копируется содержимое старого.
+ * Уменьшение блока никогда его не перемещает.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Old                       Ранее выделенный из арены блок, либо NULL.
+ * @param OldSize                   Размер блока Old в байтах.
+ * @param NewSize                   Требуемый размер в байтах.
+ *
+ * @retval NULL                     Не удалось выделить память, блок Old не изменился.
+ * @return Указатель на блок нового размера.
+ */
+VOID *
+Arena_Reallocate (
+  IN OUT  ARENA  *This,
+  IN      VOID   *Old     OPTIONAL,
+  IN      UINTN  OldSize,
+  IN      UINTN  NewSize
+  )
+{
+  if (This == NULL || This->CurrentChunk == NULL || NewSize > MAX_UINTN - ARENA_ALIGNMENT) {
+    return NULL;
+  }
+
+  if (Old != NULL && Old == This->LastAllocation) {
+    ARENA_CHUNK *Chunk  = This->CurrentChunk;
+    UINTN       Offset  = (UINT8 *)Old - CHUNK_DATA (Chunk);
+    UINTN       NewUsed = Offset + ALIGN_VALUE (NewSize, ARENA_ALIGNMENT);
+
+    if (NewUsed <= Chunk->Size) {
+      if (NewUsed > Chunk->Used) {
+        This->BytesAllocated += NewUsed - Chunk->Used;
+      }
+      Chunk->Used = NewUsed;
+      return Old;
+    }
+  }
+
+  // Уменьшить блок не в хвосте арены нельзя, но и незачем: он и так вмещает NewSize.
+  if (Old != NULL && NewSize <= OldSize) {
+    return Old;
+  }
+
+  VOID *New = Arena_Allocate (This, NewSize);
+  if (New != NULL && Old != NULL) {
+    gBS->CopyMem (New, Old, MIN (OldSize, NewSize));
+  }
+
+  return New;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает арене блок, если это последнее выделение. Иначе ничего не делает,
+ * память блока будет освобождена вместе со всей ареной.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Buffer                    Ранее выделенный из арены блок.
+ */
+VOID
+Arena_Free (
+  IN OUT  ARENA  *This,
+  IN      VOID   *Buffer
+  )
+{
+  if (This == NULL || Buffer == NULL || Buffer != This->LastAllocation) {
+    return;
+  }
+
+  This->CurrentChunk->Used = (UINT8 *)Buffer - CHUNK_DATA (This->CurrentChunk);
+  This->LastAllocation     = NULL;
+}
+
+// -----------------------------------------------------------------------------
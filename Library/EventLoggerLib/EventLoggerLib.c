@@ -3,12 +3,29 @@
 #include <Library/EventLoggerLib.h>
 #include <Library/EventProviderLib.h>
 #include <Library/ProtocolGuidDatabaseLib.h>
+#include <Library/TimestampLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/PcdLib.h>
 #include <Library/UefiLib.h>
 
 #define DBG_STR_NO_NULL(Pointer) ((Pointer) ? (Pointer) : (L"<NONE>"))
 
+// Количество событий в одном блоке хранилища лога.
+#define LOG_DATA_EVENTS_PER_BLOCK 256
+
+// Сколько событий можно добавить на TPL_HIGH_LEVEL, где нельзя выделять память,
+// до следующего пополнения запаса в ReserveLogMemory().
+#define LOG_DATA_RESERVE_COUNT    LOG_DATA_EVENTS_PER_BLOCK
+
+// Размер куска арены под строки событий в страницах, по столько она и растёт.
+#define LOG_ARENA_CHUNK_PAGES     64
+
+// Через сколько единиц по 100 нс писать лог, если событие пришло ниже TPL_CALLBACK.
+// Не 0: SetTimer() с нулевой задержкой сразу проверяет таймеры и вызвал бы писателя синхронно.
+#define LOG_WRITE_DELAY           1
+
+DECLARE_TYPED_SEGMENTED_VECTOR (LOADING_EVENT)
+
 // -----------------------------------------------------------------------------
 /**
  * Функции обратного вызова, вызов происходит при поступлении события.
@@ -30,6 +47,43 @@ UpdateLog (
   IN OUT VOID  *Logger
   );
 
+// -----------------------------------------------------------------------------
+/**
+ * Функция уведомления EventsIncomedEvent, вызывает EventIncomedCallback на TPL_CALLBACK.
+*/
+STATIC
+VOID
+EFIAPI
+NotifyEventsIncomed (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Пополняет запас памяти, из которого события и их строки добавляются на TPL_HIGH_LEVEL:
+ * запасные блоки хранилища, кусок арены, место в таблицах пула строк и интернированных GUID'ов.
+ * Вызывать на TPL не выше TPL_NOTIFY.
+*/
+STATIC
+VOID
+ReserveLogMemory (
+  IN OUT LOGGER *This
+  )
+{
+  // Все перехваченные сервисы вызываются не выше TPL_NOTIFY, поэтому TPL_NOTIFY
+  // достаточно, чтобы AddEventToLog() не застал хранилище наполовину пополненным.
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  EFI_STATUS Status = SegmentedVector_Reserve (&This->LogData, LOG_DATA_RESERVE_COUNT);
+  gBS->RestoreTPL (OldTpl);
+
+  if (EFI_ERROR (Status)) {
+    DBG_ERROR ("SegmentedVector_Reserve() failed: %r\n", Status);
+  }
+
+  LoadingEvent_ReserveMemory (0);
+  ReserveProtocolGuidIds ();
+}
 
 // -----------------------------------------------------------------------------
 /**
@@ -37,7 +91,9 @@ UpdateLog (
  * Функция должна быть обязательно однократно вызвана перед использованием объекта.
  *
  * @param This                      Указатель на структуру логгера, для которой выполняется инициализация.
- * @param EventIncomed              Функция. которая будет вызываться сразу при поступлении события.
+ * @param EventIncomed              Функция. которая будет вызываться после добавления событий в контейнер,
+ *                                  на TPL_CALLBACK: по ближайшему тику таймера, если сервис вызван
+ *                                  ниже TPL_CALLBACK, иначе как только TPL вызывающего опустится ниже.
  *                                  NULL, если не нужно.
  *
  * @retval EFI_SUCCESS              Операция завершена успешно.
@@ -52,23 +108,68 @@ Logger_Construct (
   DBG_ENTER();
 
   This->EventIncomedCallback = EventIncomed;
+  This->EventsIncomedEvent   = NULL;
 
   EFI_STATUS Status;
 
-  Status = Vector_Construct (
+  // Без частоты счётчика события просто пишутся в лог без времени.
+  Status = Timestamp_Calibrate ();
+  if (EFI_ERROR (Status)) {
+    DBG_ERROR ("Timestamp_Calibrate() failed: %r\n", Status);
+  }
+
+  // Событие добавляется на TPL_HIGH_LEVEL прямо внутри перехваченных вызовов,
+  // поэтому хранилище не должно копировать уже накопленные события при росте.
+  Status = SegmentedVector_Construct (
             &This->LogData,
             sizeof(LOADING_EVENT),
-            1024
+            LOG_DATA_EVENTS_PER_BLOCK
             );
   RETURN_ON_ERR(Status)
 
+  // Строки событий выделяются прямо из перехваченных сервисов,
+  // поэтому память под них берём заранее крупными кусками и не отдаём до Logger_Destruct().
+  Status = Arena_Construct (&This->Arena, LOG_ARENA_CHUNK_PAGES);
+  if (EFI_ERROR (Status)) {
+    SegmentedVector_Destruct (&This->LogData);
+    DBG_EXIT_STATUS (Status);
+    return Status;
+  }
+  LoadingEvent_SetArena (&This->Arena);
+
+  // На TPL_HIGH_LEVEL хранилище только переходит на запасные блоки, пополняет их ReserveLogMemory().
+  This->LogData.NoGrow = TRUE;
+  ReserveLogMemory (This);
+
+  // Пользователь класса обрабатывает события на TPL_CALLBACK, см. AddEventToLog().
+  // Событие ещё и таймерное, чтобы запуск писателя можно было отложить до тика таймера.
+  if (EventIncomed != NULL) {
+    Status = gBS->CreateEvent (EVT_TIMER | EVT_NOTIFY_SIGNAL, TPL_CALLBACK, NotifyEventsIncomed, This, &This->EventsIncomedEvent);
+    if (EFI_ERROR (Status)) {
+      LoadingEvent_SetArena (NULL);
+      Arena_Destruct (&This->Arena);
+      SegmentedVector_Destruct (&This->LogData);
+      DBG_EXIT_STATUS (Status);
+      return Status;
+    }
+  }
+
   Status = EventProvider_Construct (
             &This->EventProvider,
             &AddEventToLog,
             &UpdateLog,
             This
             );
-  RETURN_ON_ERR(Status)
+  if (EFI_ERROR (Status)) {
+    if (This->EventsIncomedEvent != NULL) {
+      gBS->CloseEvent (This->EventsIncomedEvent);
+    }
+    LoadingEvent_SetArena (NULL);
+    Arena_Destruct (&This->Arena);
+    SegmentedVector_Destruct (&This->LogData);
+    DBG_EXIT_STATUS (Status);
+    return Status;
+  }
 
   DBG_EXIT_STATUS (EFI_SUCCESS);
   return EFI_SUCCESS;
@@ -90,13 +191,19 @@ Logger_Destruct (
 
   Logger_Stop(This);
 
-  FOR_EACH_VCT (LOADING_EVENT, Event, This->LogData) {
-    LoadingEvent_Destruct (Event);
+  if (This->EventsIncomedEvent != NULL) {
+    gBS->CloseEvent (This->EventsIncomedEvent);
+    This->EventsIncomedEvent = NULL;
   }
-  Vector_Destruct (&This->LogData);
+
+  SegmentedVector_Destruct (&This->LogData);
 
   EventProvider_Destruct (&This->EventProvider);
 
+  // Все строки событий лежат в арене, поэтому по событиям не проходим.
+  LoadingEvent_SetArena (NULL);
+  Arena_Destruct (&This->Arena);
+
   DBG_EXIT ();
 }
 
@@ -157,22 +264,52 @@ AddEventToLog (
   DBG_ENTER ();
   ASSERT (Event != NULL);
 
-  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  UINT64  CaptureStart = Timestamp_Read ();
+  EFI_TPL OldTpl       = gBS->RaiseTPL (TPL_HIGH_LEVEL);
   LOGGER *This = (LOGGER *)Logger;
 
+  // Метка ставится под той же блокировкой, что и добавление, поэтому в логе время не убывает.
+  Event->Timestamp = Timestamp_Read ();
+
   EFI_STATUS Status;
-  Status = Vector_PushBack (&This->LogData, Event);
-  if (EFI_ERROR (Status)) {
-    DBG_ERROR1 ("Vector_PushBack(Event) failed\n");
+  Status = SegmentedVector_PushBack_LOADING_EVENT (&This->LogData, Event);
+  gBS->RestoreTPL (OldTpl);
 
+  // Запасные блоки кончились раньше, чем писатель успел их пополнить.
+  // Если вызвавший код сам не выше TPL_NOTIFY, пополняем запас здесь и добавляем ещё раз.
+  if (Status == EFI_OUT_OF_RESOURCES && OldTpl <= TPL_NOTIFY) {
+    ReserveLogMemory (This);
+
+    OldTpl           = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+    Event->Timestamp = Timestamp_Read ();
+    Status           = SegmentedVector_PushBack_LOADING_EVENT (&This->LogData, Event);
     gBS->RestoreTPL (OldTpl);
+  }
 
+  // Захват - это только добавление события; уведомление писателя, вывод в консоль
+  // и отладочный дамп в него не входят, у писателя свои стадии.
+  Timestamp_AccountOverhead (OVERHEAD_STAGE_CAPTURE, CaptureStart);
+
+  if (EFI_ERROR (Status)) {
+    DBG_ERROR1 ("SegmentedVector_PushBack(Event) failed\n");
     DBG_EXIT_STATUS (EFI_ABORTED);
     return;
   }
 
-  if (This->EventIncomedCallback != NULL) {
-    This->EventIncomedCallback ();
+  // Сам лог пишется в NotifyEventsIncomed(). Большинство сервисов вызывается из точек входа драйверов
+  // на TPL_APPLICATION, и SignalEvent() вызвал бы писателя синхронно, прямо внутри перехваченного сервиса.
+  // Поэтому ниже TPL_CALLBACK писатель откладывается до ближайшего тика таймера.
+  // На TPL_CALLBACK и выше сигнал и так обработается только после возврата вызывающего кода.
+  if (This->EventsIncomedEvent != NULL) {
+    if (OldTpl < TPL_CALLBACK) {
+      Status = gBS->SetTimer (This->EventsIncomedEvent, TimerRelative, LOG_WRITE_DELAY);
+      if (EFI_ERROR (Status)) {
+        DBG_ERROR ("SetTimer() failed: %r\n", Status);
+        gBS->SignalEvent (This->EventsIncomedEvent);
+      }
+    } else {
+      gBS->SignalEvent (This->EventsIncomedEvent);
+    }
   }
 
   if (FeaturePcdGet (PcdPrintEventNumbersToConsole)) {
@@ -181,24 +318,26 @@ AddEventToLog (
     if (gST->ConOut
       && Event->Type != LOG_ENTRY_TYPE_PROTOCOL_EXISTS_ON_STARTUP
       && Event->Type != LOG_ENTRY_TYPE_IMAGE_EXISTS_ON_STARTUP) {
-        Print(L"---- [event #%u] ----\n", (unsigned) Vector_Size (&This->LogData));
+        Print(L"---- [event #%u] ----\n", (unsigned) SegmentedVector_Size (&This->LogData));
     }
   }
 
   DBG_INFO1 ("---- Event received: --------------------------------------\n");
   DEBUG_CODE_BEGIN ();
 
-  CHAR16 *GuidName = NULL;
+  CONST CHAR8 *GuidName = NULL;
+  EFI_GUID    Guid;
 
   switch (Event->Type)
   {
   case LOG_ENTRY_TYPE_PROTOCOL_INSTALLED:
-    GuidName = GetProtocolName (&Event->ProtocolInstalled.Guid);
+    GuidName = GetInternedProtocolName (Event->ProtocolInstalled.GuidId);
+    GetInternedProtocolGuid (Event->ProtocolInstalled.GuidId, &Guid);
     DBG_INFO1 ("Type:             LOG_ENTRY_TYPE_PROTOCOL_INSTALLED\n");
     if (GuidName == NULL) {
-      DBG_INFO  ("Guid:             %g\n", &Event->ProtocolInstalled.Guid);
+      DBG_INFO  ("Guid:             %g\n", &Guid);
     } else {
-      DBG_INFO  ("Guid:             %s\n", GuidName);
+      DBG_INFO  ("Guid:             %a\n", GuidName);
     }
     DBG_INFO  ("Handle:   %s\n", DBG_STR_NO_NULL (Event->ProtocolInstalled.HandleDescription));
     if (Event->ProtocolInstalled.Successful) {
@@ -209,12 +348,13 @@ AddEventToLog (
     break;
 
   case LOG_ENTRY_TYPE_PROTOCOL_REINSTALLED:
-    GuidName = GetProtocolName (&Event->ProtocolReinstalled.Guid);
+    GuidName = GetInternedProtocolName (Event->ProtocolReinstalled.GuidId);
+    GetInternedProtocolGuid (Event->ProtocolReinstalled.GuidId, &Guid);
     DBG_INFO1 ("Type:             LOG_ENTRY_TYPE_PROTOCOL_REINSTALLED\n");
     if (GuidName == NULL) {
-      DBG_INFO  ("Guid:             %g\n", &Event->ProtocolReinstalled.Guid);
+      DBG_INFO  ("Guid:             %g\n", &Guid);
     } else {
-      DBG_INFO  ("Guid:             %s\n", GuidName);
+      DBG_INFO  ("Guid:             %a\n", GuidName);
     }
     DBG_INFO  ("Handle:   %s\n", DBG_STR_NO_NULL (Event->ProtocolReinstalled.HandleDescription));
     if (Event->ProtocolReinstalled.Successful) {
@@ -225,23 +365,25 @@ AddEventToLog (
     break;
 
   case LOG_ENTRY_TYPE_PROTOCOL_EXISTS_ON_STARTUP:
-    GuidName = GetProtocolName(&Event->ProtocolExistsOnStartup.Guid);
+    GuidName = GetInternedProtocolName (Event->ProtocolExistsOnStartup.GuidId);
+    GetInternedProtocolGuid (Event->ProtocolExistsOnStartup.GuidId, &Guid);
     DBG_INFO1 ("Type:             LOG_ENTRY_TYPE_PROTOCOL_EXISTS_ON_STARTUP\n");
     if (GuidName == NULL) {
-      DBG_INFO  ("Guid:             %g\n", &Event->ProtocolExistsOnStartup.Guid);
+      DBG_INFO  ("Guid:             %g\n", &Guid);
     } else {
-      DBG_INFO  ("Guid:             %s\n", GuidName);
+      DBG_INFO  ("Guid:             %a\n", GuidName);
     }
     DBG_INFO  ("Handles:     %s\n", DBG_STR_NO_NULL (Event->ProtocolExistsOnStartup.HandleDescription));
     break;
 
   case LOG_ENTRY_TYPE_PROTOCOL_REMOVED:
-    GuidName = GetProtocolName(&Event->ProtocolRemoved.Guid);
+    GuidName = GetInternedProtocolName (Event->ProtocolRemoved.GuidId);
+    GetInternedProtocolGuid (Event->ProtocolRemoved.GuidId, &Guid);
     DBG_INFO1 ("Type:             LOG_ENTRY_TYPE_PROTOCOL_REMOVED\n");
     if (GuidName == NULL) {
-      DBG_INFO  ("Guid:             %g\n", &Event->ProtocolRemoved.Guid);
+      DBG_INFO  ("Guid:             %g\n", &Guid);
     } else {
-      DBG_INFO  ("Guid:             %s\n", GuidName);
+      DBG_INFO  ("Guid:             %a\n", GuidName);
     }
     DBG_INFO  ("Handle:   %s\n", DBG_STR_NO_NULL (Event->ProtocolInstalled.HandleDescription));
     if (Event->ProtocolRemoved.Successful) {
@@ -291,7 +433,6 @@ AddEventToLog (
   DEBUG_CODE_END ();
   DBG_INFO1 ("-----------------------------------------------------------\n");
 
-  gBS->RestoreTPL (OldTpl);
   DBG_EXIT ();
 }
 
@@ -305,14 +446,35 @@ UpdateLog (
   )
 {
   DBG_ENTER ();
-  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
   LOGGER *This = (LOGGER *)Logger;
 
-  if (This->EventIncomedCallback != NULL) {
-    This->EventIncomedCallback ();
+  if (This->EventsIncomedEvent != NULL) {
+    gBS->SignalEvent (This->EventsIncomedEvent);
   }
 
-  gBS->RestoreTPL (OldTpl);
+  DBG_EXIT ();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Функция уведомления EventsIncomedEvent, вызывает EventIncomedCallback на TPL_CALLBACK.
+ * Если событий пришло несколько, пока TPL был поднят, вызов будет один на всех.
+*/
+VOID
+EFIAPI
+NotifyEventsIncomed (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  DBG_ENTER ();
+  LOGGER *This = (LOGGER *)Context;
+
+  // Перехваченные вызовы расходуют запас памяти на TPL_HIGH_LEVEL, здесь его можно пополнить.
+  ReserveLogMemory (This);
+
+  This->EventIncomedCallback ();
+
   DBG_EXIT ();
 }
 
@@ -327,7 +489,7 @@ Logger_GetEventCount(
 {
   DBG_ENTER ();
   EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
-  UINTN EventCount = Vector_Size (&This->LogData);
+  UINTN EventCount = SegmentedVector_Size (&This->LogData);
   gBS->RestoreTPL (OldTpl);
 
   DBG_EXIT ();
@@ -357,7 +519,7 @@ Logger_GetEvent(
   EFI_STATUS Status;
   EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
 
-  LOADING_EVENT *Event = Vector_Get(&This->LogData, Index);
+  LOADING_EVENT *Event = SegmentedVector_Get_LOADING_EVENT (&This->LogData, Index);
   if (Event == NULL) {
     Status = EFI_INVALID_PARAMETER;
   } else {
@@ -300,8 +300,12 @@ ProtocolInstalledCallback (
     SHELL_FREE_NON_NULL (Handles);
   }
 
+  // Удаление протоколов отсюда не видно, но установку и переустановку учитываем.
+  InvalidateHandleNameOnProtocolChange (ProtocolHandle, Guid);
+
   LOADING_EVENT Event;
   STATIC CHAR16 *Failed = L"<ERROR: can\'t get protocol handle>";
+  ZeroMem (&Event, sizeof (Event));
 
   if (CompareGuid (Guid, &gEfiLoadedImageProtocolGuid)) {
     Event.Type = LOG_ENTRY_TYPE_IMAGE_LOADED;
@@ -324,13 +328,18 @@ ProtocolInstalledCallback (
     }
   } else {  // <- if (CompareGuid (Guid, &gEfiLoadedImageProtocolGuid)) { ... }
     Event.Type                                      = LOG_ENTRY_TYPE_PROTOCOL_INSTALLED;
-    Event.ProtocolInstalled.Guid                    = *Guid;
+    Event.ProtocolInstalled.GuidId                  = InternProtocolGuid (Guid);
     Event.ProtocolInstalled.Successful              = TRUE; // Если нас вызвали, то протокол успешно установлен.
+    Event.ProtocolInstalled.Handle                  = ProtocolHandle;
 
     if (ProtocolHandle == NULL) {
       Event.ProtocolInstalled.HandleDescription = StrAllocCopy (Failed);
     } else {
-      Event.ProtocolInstalled.HandleDescription = GetHandleName (ProtocolHandle);
+      DescribeHandle (
+        ProtocolHandle,
+        &Event.ProtocolInstalled.HandleDescription,
+        &Event.ProtocolInstalled.HandleSnapshot
+        );
     }
   }
 
@@ -6,6 +6,8 @@
 #include <Library/EventProviderLib.h>
 #include <Library/EventProviderUtilityLib.h>
 #include <Library/CommonMacrosLib.h>
+#include <Library/ProtocolGuidDatabaseLib.h>
+#include <Library/TimestampLib.h>
 #include <Protocol/Bds.h>
 
 // Более 35 интерфейсов за раз будут устанавливать только совсем отбитые разрабы, большее количество не поддерживаем.
@@ -420,14 +422,25 @@ EFIAPI MyInstallProtocolInterface (
     Interface = &gMyBdsArchProtocol;
   }
 
-  EFI_STATUS Status = gOriginalInstallProtocolInterface (Handle, ProtocolGuid, InterfaceType, Interface);
+  // Время вызова включает все уведомления RegisterProtocolNotify(), которые он запустил.
+  UINT64     CallStart = Timestamp_Read ();
+  EFI_STATUS Status    = gOriginalInstallProtocolInterface (Handle, ProtocolGuid, InterfaceType, Interface);
+  UINT64     Duration  = Timestamp_Read () - CallStart;
+  InvalidateHandleNameOnProtocolChange ((Handle != NULL) ? *Handle : NULL, ProtocolGuid);
 
   // Event: PROTOCOL INSTALLED
   LOADING_EVENT Event;
   Event.Type                                = LOG_ENTRY_TYPE_PROTOCOL_INSTALLED;
-  Event.ProtocolInstalled.Guid              = *ProtocolGuid;
+  Event.ProtocolInstalled.GuidId            = InternProtocolGuid (ProtocolGuid);
   Event.ProtocolInstalled.Successful        = !EFI_ERROR (Status);
-  Event.ProtocolInstalled.HandleDescription = GetHandleName (Handle);
+  Event.ProtocolInstalled.Handle            = (Handle != NULL) ? *Handle : NULL;
+  Event.ProtocolInstalled.MultipleCall      = FALSE;
+  Event.ProtocolInstalled.Duration          = Duration;
+  DescribeHandle (
+    (Handle != NULL) ? *Handle : NULL,
+    &Event.ProtocolInstalled.HandleDescription,
+    &Event.ProtocolInstalled.HandleSnapshot
+    );
   AddEventToLog (&Event);
 
   DBG_EXIT_STATUS (Status);
@@ -451,14 +464,25 @@ EFIAPI MyReinstallProtocolInterface (
     NewInterface = &gMyBdsArchProtocol;
   }
 
-  EFI_STATUS Status = gOriginalReinstallProtocolInterface (Handle, ProtocolGuid, OldInterface, NewInterface);
+  // Время вызова включает все уведомления RegisterProtocolNotify(), которые он запустил.
+  UINT64     CallStart = Timestamp_Read ();
+  EFI_STATUS Status    = gOriginalReinstallProtocolInterface (Handle, ProtocolGuid, OldInterface, NewInterface);
+  UINT64     Duration  = Timestamp_Read () - CallStart;
+  InvalidateHandleNameOnProtocolChange (Handle, ProtocolGuid);
 
   // Event: PROTOCOL REINSTALLED
   LOADING_EVENT Event;
   Event.Type                                  = LOG_ENTRY_TYPE_PROTOCOL_REINSTALLED;
-  Event.ProtocolReinstalled.Guid              = *ProtocolGuid;
+  Event.ProtocolReinstalled.GuidId            = InternProtocolGuid (ProtocolGuid);
   Event.ProtocolReinstalled.Successful        = !EFI_ERROR (Status);
-  Event.ProtocolReinstalled.HandleDescription = GetHandleName (Handle);
+  Event.ProtocolReinstalled.Handle            = Handle;
+  Event.ProtocolReinstalled.MultipleCall      = FALSE;
+  Event.ProtocolReinstalled.Duration          = Duration;
+  DescribeHandle (
+    Handle,
+    &Event.ProtocolReinstalled.HandleDescription,
+    &Event.ProtocolReinstalled.HandleSnapshot
+    );
   AddEventToLog (&Event);
 
   DBG_EXIT_STATUS (Status);
@@ -479,14 +503,25 @@ EFIAPI MyUninstallProtocolInterface (
     Interface = &gMyBdsArchProtocol;
   }
 
-  EFI_STATUS Status = gOriginalUninstallProtocolInterface (Handle, ProtocolGuid, Interface);
+  // Время вызова включает все уведомления RegisterProtocolNotify(), которые он запустил.
+  UINT64     CallStart = Timestamp_Read ();
+  EFI_STATUS Status    = gOriginalUninstallProtocolInterface (Handle, ProtocolGuid, Interface);
+  UINT64     Duration  = Timestamp_Read () - CallStart;
+  InvalidateHandleNameOnProtocolChange (Handle, ProtocolGuid);
 
   // Event: PROTOCOL UNINSTALLED
   LOADING_EVENT Event;
   Event.Type                              = LOG_ENTRY_TYPE_PROTOCOL_REMOVED;
-  Event.ProtocolRemoved.Guid              = *ProtocolGuid;
+  Event.ProtocolRemoved.GuidId            = InternProtocolGuid (ProtocolGuid);
   Event.ProtocolRemoved.Successful        = !EFI_ERROR (Status);
-  Event.ProtocolRemoved.HandleDescription = GetHandleName (Handle);
+  Event.ProtocolRemoved.Handle            = Handle;
+  Event.ProtocolRemoved.MultipleCall      = FALSE;
+  Event.ProtocolRemoved.Duration          = Duration;
+  DescribeHandle (
+    Handle,
+    &Event.ProtocolRemoved.HandleDescription,
+    &Event.ProtocolRemoved.HandleSnapshot
+    );
   AddEventToLog (&Event);
 
   DBG_EXIT_STATUS (Status);
@@ -538,19 +573,36 @@ EFIAPI MyInstallMultipleProtocolInterfaces (
   }
   VA_END (VaList);
 
-  EFI_STATUS Status = gOriginalInstallMultipleProtocolInterfaces (
-                        Handle,
-                        ARG_ARRAY_ALL_ELEMENTS(FunctionArgList),
-                        NULL
-                        );
+  // Один вызов на все интерфейсы. Его длительность записывается только в первое событие ниже,
+  // а сами события помечаются MultipleCall: в статистике такие вызовы учитываются отдельно от
+  // вызовов для одного протокола, по первому протоколу в списке.
+  UINT64     CallStart = Timestamp_Read ();
+  EFI_STATUS Status    = gOriginalInstallMultipleProtocolInterfaces (
+                           Handle,
+                           ARG_ARRAY_ALL_ELEMENTS(FunctionArgList),
+                           NULL
+                           );
+  UINT64     Duration  = Timestamp_Read () - CallStart;
+
+  // Сначала сбрасываем имя хэндла, чтобы все события ниже видели его уже после изменения.
+  for (int i = 0; i < ARG_ARRAY_ELEMENT_COUNT && FunctionArgList[i] != NULL; i += 2) {
+    InvalidateHandleNameOnProtocolChange ((Handle != NULL) ? *Handle : NULL, (EFI_GUID *) FunctionArgList[i]);
+  }
 
   for (int i = 0; i < ARG_ARRAY_ELEMENT_COUNT && FunctionArgList[i] != NULL; i += 2) {
     // Event: PROTOCOL INSTALLED
     LOADING_EVENT Event;
     Event.Type                                = LOG_ENTRY_TYPE_PROTOCOL_INSTALLED;
-    Event.ProtocolInstalled.Guid              = *((EFI_GUID *) FunctionArgList[i]);
+    Event.ProtocolInstalled.GuidId            = InternProtocolGuid ((EFI_GUID *) FunctionArgList[i]);
     Event.ProtocolInstalled.Successful        = !EFI_ERROR (Status);
-    Event.ProtocolInstalled.HandleDescription = GetHandleName (Handle);
+    Event.ProtocolInstalled.Handle            = (Handle != NULL) ? *Handle : NULL;
+    Event.ProtocolInstalled.MultipleCall      = TRUE;
+    Event.ProtocolInstalled.Duration          = (i == 0) ? Duration : 0;
+    DescribeHandle (
+      (Handle != NULL) ? *Handle : NULL,
+      &Event.ProtocolInstalled.HandleDescription,
+      &Event.ProtocolInstalled.HandleSnapshot
+      );
     AddEventToLog (&Event);
   }
 
@@ -602,19 +654,36 @@ EFIAPI MyUninstallMultipleProtocolInterfaces (
   }
   VA_END (VaList);
 
-  EFI_STATUS Status = gOriginalUninstallMultipleProtocolInterfaces (
-                        Handle,
-                        ARG_ARRAY_ALL_ELEMENTS(FunctionArgList),
-                        NULL
-                        );
+  // Один вызов на все интерфейсы. Его длительность записывается только в первое событие ниже,
+  // а сами события помечаются MultipleCall: в статистике такие вызовы учитываются отдельно от
+  // вызовов для одного протокола, по первому протоколу в списке.
+  UINT64     CallStart = Timestamp_Read ();
+  EFI_STATUS Status    = gOriginalUninstallMultipleProtocolInterfaces (
+                           Handle,
+                           ARG_ARRAY_ALL_ELEMENTS(FunctionArgList),
+                           NULL
+                           );
+  UINT64     Duration  = Timestamp_Read () - CallStart;
+
+  // Сначала сбрасываем имя хэндла, чтобы все события ниже видели его уже после изменения.
+  for (int i = 0; i < ARG_ARRAY_ELEMENT_COUNT && FunctionArgList[i] != NULL; i += 2) {
+    InvalidateHandleNameOnProtocolChange (Handle, (EFI_GUID *) FunctionArgList[i]);
+  }
 
   for (int i = 0; i < ARG_ARRAY_ELEMENT_COUNT && FunctionArgList[i] != NULL; i += 2) {
     // Event: PROTOCOL UNINSTALLED
     LOADING_EVENT Event;
     Event.Type                              = LOG_ENTRY_TYPE_PROTOCOL_REMOVED;
-    Event.ProtocolRemoved.Guid              = *((EFI_GUID *) FunctionArgList[i]);
+    Event.ProtocolRemoved.GuidId            = InternProtocolGuid ((EFI_GUID *) FunctionArgList[i]);
     Event.ProtocolRemoved.Successful        = !EFI_ERROR (Status);
-    Event.ProtocolRemoved.HandleDescription = GetHandleName (Handle);
+    Event.ProtocolRemoved.Handle            = Handle;
+    Event.ProtocolRemoved.MultipleCall      = TRUE;
+    Event.ProtocolRemoved.Duration          = (i == 0) ? Duration : 0;
+    DescribeHandle (
+      Handle,
+      &Event.ProtocolRemoved.HandleDescription,
+      &Event.ProtocolRemoved.HandleSnapshot
+      );
     AddEventToLog (&Event);
   }
 
@@ -3,6 +3,8 @@
 #include <Library/UefiLib.h>
 #include <Library/PrintLib.h>
 #include <Library/DevicePathLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/PcdLib.h>
 #include <Pi/PiFirmwareFile.h>
 #include <Pi/PiFirmwareVolume.h>
 
@@ -12,10 +14,19 @@
 #include <Library/EventProviderUtilityLib.h>
 #include <Library/CommonMacrosLib.h>
 #include <Library/HandleDatabaseDumpLib.h>
+#include <Library/HashMapLib.h>
+#include <Library/ProtocolGuidDatabaseLib.h>
+#include <Library/TimestampLib.h>
 
 // -----------------------------------------------------------------------------
-#define GET_HANDLE_NAME_BUFFER_SIZE          1024
 #define CHECK_PROTOCOL_EXISTENCE_BUFFER_SIZE 128
+#define STR_BUILDER_MIN_CAPACITY             64
+#define FV_IMAGE_NAMES_INITIAL_COUNT         512
+
+// GUID файла в томе прошивки -> имя из его секции EFI_SECTION_USER_INTERFACE (CHAR16 *, NULL - секции нет).
+// Строки выделены ReadSection() и живут до выгрузки драйвера, как и сама таблица.
+STATIC HASH_MAP gFvImageNames;
+STATIC BOOLEAN  gFvImageNamesConstructed;
 
 
 // -----------------------------------------------------------------------------
@@ -32,18 +43,95 @@ CheckProtocolExistenceOnStartup (
 // -----------------------------------------------------------------------------
 /**
   Взято из ShellPkg, возвращает имя модуля для тех из них что входят в состав образа.
+  Вместо EFI_LOADED_IMAGE_PROTOCOL принимает нужные из него поля, чтобы работать и по снимку хэндла.
+  Секция с именем читается из тома прошивки не более одного раза на GUID файла, дальше имя берётся из gFvImageNames.
 
   Function to find the file name associated with a LoadedImageProtocol.
 
-  @param[in] LoadedImage     An instance of LoadedImageProtocol.
+  @param[in] DeviceHandle    LoadedImage->DeviceHandle.
+  @param[in] FilePath        LoadedImage->FilePath.
 
   @retval                    A string representation of the file name associated
-                             with LoadedImage, or NULL if no name can be found.
+                             with LoadedImage (from the event string pool), or NULL if no name can be found.
 **/
 STATIC
 CHAR16 *
-FindLoadedImageFileName (
-  IN EFI_LOADED_IMAGE_PROTOCOL *LoadedImage
+FindImageFileName (
+  IN EFI_HANDLE               DeviceHandle,
+  IN EFI_DEVICE_PATH_PROTOCOL *FilePath
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет в gFvImageNames имя файла тома прошивки с GUID'ом FileGuid.
+ *
+ * @retval TRUE                     Секцию с именем уже читали, *Name - имя, либо NULL если секции нет.
+ * @retval FALSE                    Секцию ещё не читали.
+*/
+STATIC
+BOOLEAN
+FindCachedFvImageName (
+  IN  CONST EFI_GUID *FileGuid,
+  OUT CHAR16         **Name
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Запоминает в gFvImageNames имя файла тома прошивки с GUID'ом FileGuid.
+ *
+ * @param Name                      Буфер, выделенный ReadSection(), либо NULL если секции с именем нет.
+ *
+ * @retval TRUE                     Таблица забрала Name себе.
+ * @retval FALSE                    Имя не запомнено, Name по-прежнему принадлежит вызывающему.
+*/
+STATIC
+BOOLEAN
+CacheFvImageName (
+  IN CONST EFI_GUID *FileGuid,
+  IN CHAR16         *Name  OPTIONAL
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Один раз проходит по файлам всех томов прошивки и запоминает имена исполняемых модулей,
+ * чтобы потом не читать секции с именами по одной.
+*/
+STATIC
+VOID
+PrefetchFvImageNames (
+  VOID
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает имя образа из пула строк событий: имя модуля из тома прошивки, либо путь к файлу.
+*/
+STATIC
+CHAR16 *
+GetImageName (
+  IN EFI_HANDLE               DeviceHandle,
+  IN EFI_DEVICE_PATH_PROTOCOL *FilePath
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Заполняет снимок хэндла, не копируя путь устройства: Snapshot->DevicePath указывает на данные протокола.
+*/
+STATIC
+VOID
+PeekHandleSnapshot (
+  IN  EFI_HANDLE      Handle,
+  OUT HANDLE_SNAPSHOT *Snapshot
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Получает имя хэндла по снимку, не заглядывая в кэш.
+*/
+STATIC
+CHAR16 *
+FormatHandleSnapshotName (
+  IN HANDLE_SNAPSHOT *Snapshot
   );
 
 
@@ -63,6 +151,10 @@ DetectImagesLoadedOnStartup (
   UINTN       HandleCount;
   EFI_HANDLE  *Handles = NULL;
 
+  if (FeaturePcdGet (PcdPrefetchFvImageNames)) {
+    PrefetchFvImageNames ();
+  }
+
   // Ищем все протоколы gEfiLoadedImageProtocolGuid и логируем их.
   // Мы рассчитываем что в дальнейшем образы не будут выгружаться.
   Status = gBS->LocateHandleBuffer (
@@ -123,7 +215,7 @@ DetectProtocolsInstalledOnStartup (
 
   DBG_INFO ("PROTOCOL count: %u\n", (unsigned)Vector_Size(&Protocols));
 
-  FOR_EACH_VCT (EFI_GUID, ProtocolGuid, Protocols) {
+  FOR_EACH_TYPED_VCT (EFI_GUID, ProtocolGuid, Protocols) {
     CheckProtocolExistenceOnStartup (This, ProtocolGuid);
   }
 
@@ -137,7 +229,7 @@ DetectProtocolsInstalledOnStartup (
 // -----------------------------------------------------------------------------
 /**
  * По хэндлу образа находит его имя и имя образа-родителя.
- * Указатели, возвращённые через OUT-параметры впоследствии требуется освободить.
+ * Имена берутся из пула строк событий (LoadingEvent_InternString()), изменять их нельзя.
 */
 VOID
 GetHandleImageNameAndParentImageName (
@@ -162,7 +254,7 @@ GetHandleImageNameAndParentImageName (
                   EFI_OPEN_PROTOCOL_GET_PROTOCOL
                   );
   if (EFI_ERROR (Status)) {
-    *ParentImageName = StrAllocCopy (L"<ERROR: can\'t open the EFI_LOADED_IMAGE_PROTOCOL for the image>");
+    *ParentImageName = LoadingEvent_InternString (L"<ERROR: can\'t open the EFI_LOADED_IMAGE_PROTOCOL for the image>");
     DBG_EXIT_STATUS (Status);
     return;
   }
@@ -199,7 +291,7 @@ IsHandleImage (
 // -----------------------------------------------------------------------------
 /**
  * По хэндлу образа находит его имя.
- * Указатель, возвращённый через OUT-параметр впоследствии требуется освободить.
+ * Имя берётся из пула строк событий (LoadingEvent_InternString()), изменять его нельзя.
 */
 VOID
 GetHandleImageName (
@@ -210,6 +302,7 @@ GetHandleImageName (
   DBG_ENTER ();
 
   EFI_STATUS Status;
+  UINT64     Start = Timestamp_Read ();
 
   EFI_LOADED_IMAGE_PROTOCOL *LoadedImage;
   Status = gBS->OpenProtocol (
@@ -221,24 +314,51 @@ GetHandleImageName (
                   EFI_OPEN_PROTOCOL_GET_PROTOCOL
                   );
   if (EFI_ERROR (Status)) {
-    *ImageName = StrAllocCopy (L"<ERROR: can\'t open the EFI_LOADED_IMAGE_PROTOCOL for the image>");
+    *ImageName = LoadingEvent_InternString (L"<ERROR: can\'t open the EFI_LOADED_IMAGE_PROTOCOL for the image>");
+    Timestamp_AccountOverhead (OVERHEAD_STAGE_SYMBOLIZE, Start);
     DBG_EXIT_STATUS (Status);
     return;
   }
 
-  *ImageName = FindLoadedImageFileName(LoadedImage);
+  // Имя образа совпадает с тем, что вернёт GetHandleName(), поэтому кэш у них общий.
+  UINTN Generation = LoadingEvent_GetHandleGeneration (Handle);
+  *ImageName = LoadingEvent_FindHandleName (Handle, Generation);
   if (*ImageName == NULL) {
-    *ImageName = ConvertDevicePathToText(LoadedImage->FilePath, TRUE, TRUE);
-  }
-  if (*ImageName == NULL) {
-    *ImageName = StrAllocCopy (L"<ERROR: can\'t find the image name>");
-    DBG_EXIT_STATUS (EFI_UNSUPPORTED);
-    return;
+    *ImageName = GetImageName (LoadedImage->DeviceHandle, LoadedImage->FilePath);
+    LoadingEvent_CacheHandleName (Handle, Generation, *ImageName);
   }
 
+  Timestamp_AccountOverhead (OVERHEAD_STAGE_SYMBOLIZE, Start);
   DBG_EXIT ();
 }
 
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает имя образа из пула строк событий: имя модуля из тома прошивки, либо путь к файлу.
+*/
+CHAR16 *
+GetImageName (
+  IN EFI_HANDLE               DeviceHandle,
+  IN EFI_DEVICE_PATH_PROTOCOL *FilePath
+  )
+{
+  CHAR16 *ImageName = FindImageFileName (DeviceHandle, FilePath);
+
+  // Строка выделена через EFI_BOOT_SERVICES, переносим её в пул строк событий.
+  if (ImageName == NULL && FilePath != NULL) {
+    CHAR16 *PoolName = ConvertDevicePathToText (FilePath, TRUE, TRUE);
+    if (PoolName != NULL) {
+      ImageName = LoadingEvent_InternString (PoolName);
+      gBS->FreePool (PoolName);
+    }
+  }
+  if (ImageName == NULL) {
+    ImageName = LoadingEvent_InternString (L"<ERROR: can\'t find the image name>");
+  }
+
+  return ImageName;
+}
+
 // -----------------------------------------------------------------------------
 /**
  * Выделяет память, копирует в неё аргумент, и возвращает указатель на память.
@@ -255,20 +375,16 @@ StrAllocCopy (
   UINTN BufferLen = Len + 1; // + 1 под L'\0'
   CHAR16 *StrCopy = NULL;
 
-  EFI_STATUS Status;
-  Status = gBS->AllocatePool (
-                  EfiBootServicesData,
-                  BufferLen * sizeof(CHAR16),
-                  (VOID **)&StrCopy
-                  );
-  if (EFI_ERROR (Status)) {
-    DBG_EXIT_STATUS (Status);
+  StrCopy = LoadingEvent_AllocatePool (BufferLen * sizeof(CHAR16));
+  if (StrCopy == NULL) {
+    DBG_EXIT_STATUS (EFI_OUT_OF_RESOURCES);
     return NULL;
   }
 
+  EFI_STATUS Status;
   Status = StrCpyS (StrCopy, BufferLen, Str);
   if (EFI_ERROR (Status)) {
-    SHELL_FREE_NON_NULL (StrCopy)
+    LoadingEvent_FreePool (StrCopy);
     DBG_EXIT_STATUS (Status);
     return NULL;
   }
@@ -279,82 +395,257 @@ StrAllocCopy (
 
 // -----------------------------------------------------------------------------
 /**
- * Добавляет к первой строке вторую, выделяя память под результат и освобождая предыдущую память под StrHead.
- * В случае неудачи оставляет без изменений.
+ * Увеличивает ёмкость строителя так, чтобы в него помещалось ещё хотя бы Extra символов.
+ * Ёмкость растёт минимум вдвое, поэтому дописывание в сумме линейно от длины результата.
 */
-VOID
-StrAllocAppend (
-  IN OUT CHAR16 **StrHead,
-  IN     CHAR16 *StrTail
+STATIC
+EFI_STATUS
+StrBuilder_Grow (
+  IN OUT STR_BUILDER *This,
+  IN     UINTN       Extra
   )
 {
-  DBG_ENTER ();
+  UINTN Required = This->Length + Extra + 1; // +1 под L'\0'
+  if (Required <= This->Capacity) {
+    return EFI_SUCCESS;
+  }
 
-  if (StrHead == NULL || *StrHead == NULL || StrTail == NULL) {
-    DBG_EXIT_STATUS (EFI_INVALID_PARAMETER);
-    return;
+  UINTN NewCapacity = MAX (This->Capacity * 2, STR_BUILDER_MIN_CAPACITY);
+  while (NewCapacity < Required) {
+    NewCapacity *= 2;
+  }
+
+  CHAR16 *NewBuffer = LoadingEvent_ReallocatePool (
+                        This->Buffer,
+                        This->Capacity * sizeof(CHAR16),
+                        NewCapacity * sizeof(CHAR16)
+                        );
+  if (NewBuffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
   }
 
-  UINTN HeadLen   = StrLen (*StrHead);
-  UINTN TailLen   = StrLen (StrTail);
-  UINTN TotalLen  = HeadLen + TailLen;
-  UINTN BufferLen = TotalLen + 1; // +1 под L'\0'
-  CHAR16 *NewStr = NULL;
+  This->Buffer   = NewBuffer;
+  This->Capacity = NewCapacity;
+  return EFI_SUCCESS;
+}
 
-  EFI_STATUS Status;
-  Status = gBS->AllocatePool (
-                  EfiBootServicesData,
-                  BufferLen * sizeof(CHAR16),
-                  (VOID **)&NewStr
-                  );
-  if (EFI_ERROR (Status)) {
-    DBG_EXIT_STATUS (Status);
-    return;
+// -----------------------------------------------------------------------------
+/**
+ * Инициализирует строитель строк пустой строкой.
+ * Функция должна быть обязательно однократно вызвана перед использованием объекта.
+ *
+ * @param This                      Указатель на инициализируемую структуру.
+ * @param InitialCapacity           Начальная ёмкость в символах, 0 - по умолчанию.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    This == NULL.
+ */
+EFI_STATUS
+StrBuilder_Construct (
+  IN OUT STR_BUILDER *This,
+  IN     UINTN       InitialCapacity
+  )
+{
+  if (This == NULL) {
+    return EFI_INVALID_PARAMETER;
   }
 
-  Status = StrCpyS (NewStr, BufferLen, *StrHead);
+  This->Buffer   = NULL;
+  This->Length   = 0;
+  This->Capacity = 0;
+
+  EFI_STATUS Status = StrBuilder_Grow (This, InitialCapacity);
   if (EFI_ERROR (Status)) {
-    SHELL_FREE_NON_NULL (NewStr)
-    DBG_EXIT_STATUS (Status);
-    return;
+    return Status;
   }
 
-  Status = StrCpyS (NewStr + HeadLen, BufferLen - HeadLen, StrTail);
+  This->Buffer[0] = L'\0';
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает память строителя, если результат не был забран через StrBuilder_Finish().
+ *
+ * @param This                      Указатель на структуру.
+ */
+VOID
+StrBuilder_Destruct (
+  IN OUT STR_BUILDER *This
+  )
+{
+  LoadingEvent_FreePool (This->Buffer);
+  This->Buffer   = NULL;
+  This->Length   = 0;
+  This->Capacity = 0;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает строку Str в конец.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память, строка осталась прежней.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL, либо строитель уже завершён.
+ */
+EFI_STATUS
+StrBuilder_Append (
+  IN OUT STR_BUILDER  *This,
+  IN     CONST CHAR16 *Str
+  )
+{
+  if (This == NULL || This->Buffer == NULL || Str == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  UINTN      StrLength = StrLen (Str);
+  EFI_STATUS Status    = StrBuilder_Grow (This, StrLength);
   if (EFI_ERROR (Status)) {
-    SHELL_FREE_NON_NULL (NewStr)
-    DBG_EXIT_STATUS (Status);
-    return;
+    return Status;
   }
 
-  gBS->FreePool (*StrHead);
-  *StrHead = NewStr;
-  DBG_EXIT ();
+  gBS->CopyMem (This->Buffer + This->Length, (VOID *)Str, (StrLength + 1) * sizeof(CHAR16));
+  This->Length += StrLength;
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в конец строку, отформатированную как в UnicodeSPrint().
+ * Форматирование идёт прямо в свободную часть буфера, без промежуточных копий.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память, строка осталась прежней.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL, либо строитель уже завершён.
+ */
+EFI_STATUS
+EFIAPI
+StrBuilder_AppendFormat (
+  IN OUT STR_BUILDER  *This,
+  IN     CONST CHAR16 *Format,
+  ...
+  )
+{
+  if (This == NULL || This->Buffer == NULL || Format == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  for (;;) {
+    UINTN   Spare = This->Capacity - This->Length;
+    VA_LIST Marker;
+
+    VA_START (Marker, Format);
+    UINTN Written = UnicodeVSPrint (This->Buffer + This->Length, Spare * sizeof(CHAR16), Format, Marker);
+    VA_END (Marker);
+
+    // UnicodeVSPrint() молча обрезает результат; если буфер заполнен до конца, считаем что не влезло.
+    if (Written + 1 < Spare) {
+      This->Length += Written;
+      return EFI_SUCCESS;
+    }
+
+    EFI_STATUS Status = StrBuilder_Grow (This, Spare);
+    if (EFI_ERROR (Status)) {
+      This->Buffer[This->Length] = L'\0';
+      return Status;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Забирает результат. Строитель после этого пуст, и его не нужно разрушать.
+ * Неиспользованный хвост буфера возвращается арене, если это возможно.
+ *
+ * @retval NULL                     This == NULL, либо строитель уже завершён.
+ * @return Строка, выделенная через LoadingEvent_AllocatePool().
+ */
+CHAR16 *
+StrBuilder_Finish (
+  IN OUT STR_BUILDER *This
+  )
+{
+  if (This == NULL || This->Buffer == NULL) {
+    return NULL;
+  }
+
+  CHAR16 *Result = LoadingEvent_ReallocatePool (
+                     This->Buffer,
+                     This->Capacity * sizeof(CHAR16),
+                     (This->Length + 1) * sizeof(CHAR16)
+                     );
+  if (Result == NULL) {
+    Result = This->Buffer;
+  }
+
+  This->Buffer   = NULL;
+  This->Length   = 0;
+  This->Capacity = 0;
+  return Result;
 }
 
 // -----------------------------------------------------------------------------
 /**
  * Возвращает по хэндлу его более информативное описание.
- * Не забыть освободить память из-под возвращаемого значения!
+ * Описание берётся из пула строк событий (LoadingEvent_InternString()), изменять его нельзя.
+ * Повторные вызовы для того же хэндла берут описание из кэша, пока не сменится поколение хэндла.
 */
 CHAR16 *GetHandleName (
   EFI_HANDLE Handle
   )
 {
-  STATIC CHAR16 Buffer[GET_HANDLE_NAME_BUFFER_SIZE];
+  UINT64 Start      = Timestamp_Read ();
+  UINTN  Generation = LoadingEvent_GetHandleGeneration (Handle);
+  CHAR16 *Name      = LoadingEvent_FindHandleName (Handle, Generation);
 
-  // Образ?
-  if (IsHandleImage (Handle)) {
-    CHAR16 *Str = NULL;
-    GetHandleImageName (
-      Handle,
-      &Str
-      );
+  if (Name == NULL) {
+    HANDLE_SNAPSHOT Snapshot;
+    PeekHandleSnapshot (Handle, &Snapshot);
 
-    return Str;
+    Name = FormatHandleSnapshotName (&Snapshot);
+    LoadingEvent_CacheHandleName (Handle, Snapshot.Generation, Name);
   }
 
-  // Контроллер физического устройства?
+  Timestamp_AccountOverhead (OVERHEAD_STAGE_SYMBOLIZE, Start);
+  return Name;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Заполняет снимок хэндла, не копируя путь устройства: Snapshot->DevicePath указывает на данные протокола.
+*/
+VOID
+PeekHandleSnapshot (
+  IN  EFI_HANDLE      Handle,
+  OUT HANDLE_SNAPSHOT *Snapshot
+  )
+{
   EFI_STATUS Status;
+
+  Snapshot->Handle       = Handle;
+  Snapshot->DeviceHandle = NULL;
+  Snapshot->DevicePath   = NULL;
+  Snapshot->Generation   = LoadingEvent_GetHandleGeneration (Handle);
+
+  // Образ?
+  EFI_LOADED_IMAGE_PROTOCOL *LoadedImage;
+  Status = gBS->OpenProtocol (
+                  Handle,
+                  &gEfiLoadedImageProtocolGuid,
+                  (VOID **)&LoadedImage,
+                  gImageHandle,
+                  NULL,
+                  EFI_OPEN_PROTOCOL_GET_PROTOCOL
+                  );
+  if (!EFI_ERROR (Status)) {
+    Snapshot->Kind         = HANDLE_SNAPSHOT_IMAGE;
+    Snapshot->DeviceHandle = LoadedImage->DeviceHandle;
+    Snapshot->DevicePath   = LoadedImage->FilePath;
+    return;
+  }
+
+  // Контроллер физического устройства?
   EFI_DEVICE_PATH_PROTOCOL *DevPath;
   Status = gBS->OpenProtocol (
                   Handle,
@@ -364,18 +655,204 @@ CHAR16 *GetHandleName (
                   NULL,
                   EFI_OPEN_PROTOCOL_GET_PROTOCOL
                   );
-  if (!EFI_ERROR (Status)) {
-    CHAR16 *DevPathStr = ConvertDevicePathToText (DevPath, FALSE, FALSE);
-    UnicodeSPrint(Buffer, GET_HANDLE_NAME_BUFFER_SIZE * sizeof(CHAR16), L"[dev: %s]", DevPathStr);
-    gBS->FreePool (DevPathStr);
-    return StrAllocCopy (Buffer);
+  if (!EFI_ERROR (Status) && DevPath != NULL) {
+    Snapshot->Kind       = HANDLE_SNAPSHOT_DEVICE;
+    Snapshot->DevicePath = DevPath;
+    return;
   }
 
   // Сервисный/етц.
-  UnicodeSPrint(Buffer, GET_HANDLE_NAME_BUFFER_SIZE * sizeof(CHAR16), L"[unk: %p]", Handle);
-  return StrAllocCopy (Buffer);
+  Snapshot->Kind = HANDLE_SNAPSHOT_OTHER;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает имя хэндла по его снимку, сделанному ранее в DescribeHandle().
+ * Сам хэндл к этому моменту может уже не существовать.
+ * Описание берётся из пула строк событий (LoadingEvent_InternString()), изменять его нельзя.
+*/
+CHAR16 *
+GetHandleSnapshotName (
+  IN HANDLE_SNAPSHOT *Snapshot
+  )
+{
+  UINT64 Start = Timestamp_Read ();
+  CHAR16 *Name = LoadingEvent_FindHandleName (Snapshot->Handle, Snapshot->Generation);
+  if (Name == NULL) {
+    Name = FormatHandleSnapshotName (Snapshot);
+    LoadingEvent_CacheHandleName (Snapshot->Handle, Snapshot->Generation, Name);
+  }
+
+  Timestamp_AccountOverhead (OVERHEAD_STAGE_SYMBOLIZE, Start);
+  return Name;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Получает имя хэндла по снимку, не заглядывая в кэш.
+ * Вызывается и из писателя лога на TPL_CALLBACK, и из перехваченных сервисов, которые могут его прервать,
+ * поэтому имя строится в собственном буфере каждого вызова; длинные пути устройств не обрезаются.
+*/
+CHAR16 *
+FormatHandleSnapshotName (
+  IN HANDLE_SNAPSHOT *Snapshot
+  )
+{
+  if (Snapshot->Kind == HANDLE_SNAPSHOT_IMAGE) {
+    return GetImageName (Snapshot->DeviceHandle, Snapshot->DevicePath);
+  }
+
+  STR_BUILDER Builder;
+  if (EFI_ERROR (StrBuilder_Construct (&Builder, 0))) {
+    return NULL;
+  }
+
+  switch (Snapshot->Kind) {
+  case HANDLE_SNAPSHOT_DEVICE:
+    {
+      CHAR16 *DevPathStr = ConvertDevicePathToText (Snapshot->DevicePath, FALSE, FALSE);
+      StrBuilder_AppendFormat (&Builder, L"[dev: %s]", DevPathStr);
+      SHELL_FREE_NON_NULL (DevPathStr);
+    }
+    break;
+
+  default:
+    StrBuilder_AppendFormat (&Builder, L"[unk: %p]", Snapshot->Handle);
+    break;
+  }
+
+  CHAR16 *Name = LoadingEvent_InternString (Builder.Buffer);
+  StrBuilder_Destruct (&Builder);
+  return Name;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Заполняет данные о хэндле для события, возникшего внутри перехваченного сервиса.
+ * Если PcdLazyHandleSymbolization == TRUE, то берёт имя из кэша, а если его там нет, то запоминает
+ * только снимок хэндла (это дёшево), а *HandleDescription = NULL; имя потом получает ResolveEventHandleName().
+ * Иначе сразу получает имя хэндла через GetHandleName(), а снимок не делает: *Snapshot = NULL.
+*/
+VOID
+DescribeHandle (
+  IN  EFI_HANDLE      Handle,
+  OUT CHAR16          **HandleDescription,
+  OUT HANDLE_SNAPSHOT **Snapshot
+  )
+{
+  *Snapshot = NULL;
+
+  if (!FeaturePcdGet (PcdLazyHandleSymbolization)) {
+    *HandleDescription = GetHandleName (Handle);
+    return;
+  }
+
+  // Имя уже известно - снимок не нужен.
+  UINT64 Start = Timestamp_Read ();
+  *HandleDescription = LoadingEvent_FindHandleName (Handle, LoadingEvent_GetHandleGeneration (Handle));
+  if (*HandleDescription != NULL) {
+    Timestamp_AccountOverhead (OVERHEAD_STAGE_SYMBOLIZE, Start);
+    return;
+  }
+
+  // Снимок лежит в той же арене, что и строки событий. Если памяти под него нет, имя получаем сразу.
+  HANDLE_SNAPSHOT *NewSnapshot = LoadingEvent_AllocatePool (sizeof (HANDLE_SNAPSHOT));
+  if (NewSnapshot == NULL) {
+    Timestamp_AccountOverhead (OVERHEAD_STAGE_SYMBOLIZE, Start);
+    *HandleDescription = GetHandleName (Handle);
+    return;
+  }
+
+  *Snapshot = NewSnapshot;
+  PeekHandleSnapshot (Handle, NewSnapshot);
+
+  // Путь устройства принадлежит протоколу и может исчезнуть вместе с хэндлом, поэтому копируем.
+  if (NewSnapshot->DevicePath != NULL) {
+    UINTN                    Size = GetDevicePathSize (NewSnapshot->DevicePath);
+    EFI_DEVICE_PATH_PROTOCOL *Copy = LoadingEvent_AllocatePool (Size);
+
+    if (Copy != NULL) {
+      CopyMem (Copy, NewSnapshot->DevicePath, Size);
+    } else if (NewSnapshot->Kind == HANDLE_SNAPSHOT_DEVICE) {
+      NewSnapshot->Kind = HANDLE_SNAPSHOT_OTHER;
+    }
+    NewSnapshot->DevicePath = Copy;
+  }
+
+  Timestamp_AccountOverhead (OVERHEAD_STAGE_SYMBOLIZE, Start);
 }
 
+// -----------------------------------------------------------------------------
+/**
+ * Если у события есть снимок хэндла, но ещё нет имени, то получает имя по снимку.
+ * Вызывается на стороне записи лога, а не в перехваченных сервисах.
+*/
+VOID
+ResolveEventHandleName (
+  IN OUT LOADING_EVENT *Event
+  )
+{
+  LOG_ENTRY_PROTOCOL_INSTALLED *Entry;
+
+  switch (Event->Type) {
+  case LOG_ENTRY_TYPE_PROTOCOL_INSTALLED:
+    Entry = &Event->ProtocolInstalled;
+    break;
+  case LOG_ENTRY_TYPE_PROTOCOL_REINSTALLED:
+    Entry = &Event->ProtocolReinstalled;
+    break;
+  case LOG_ENTRY_TYPE_PROTOCOL_REMOVED:
+    Entry = &Event->ProtocolRemoved;
+    break;
+  default:
+    return;
+  }
+
+  if (Entry->HandleDescription == NULL && Entry->HandleSnapshot != NULL) {
+    Entry->HandleDescription = GetHandleSnapshotName (Entry->HandleSnapshot);
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Если Protocol определяет имя хэндла (EFI_LOADED_IMAGE_PROTOCOL, EFI_DEVICE_PATH_PROTOCOL),
+ * то сбрасывает закэшированное имя Handle. Вызывается после установки, переустановки или удаления Protocol.
+*/
+VOID
+InvalidateHandleNameOnProtocolChange (
+  IN EFI_HANDLE Handle,
+  IN EFI_GUID   *Protocol
+  )
+{
+  if (Handle == NULL || Protocol == NULL) {
+    return;
+  }
+
+  if (CompareGuid (Protocol, &gEfiLoadedImageProtocolGuid) || CompareGuid (Protocol, &gEfiDevicePathProtocolGuid)) {
+    LoadingEvent_InvalidateHandleName (Handle);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в Builder имя хэндла.
+*/
+STATIC
+VOID
+StrBuilder_AppendHandleName (
+  IN OUT STR_BUILDER *Builder,
+  IN     EFI_HANDLE  Handle
+  )
+{
+  CHAR16 *Name = GetHandleName (Handle);
+  if (Name == NULL) {
+    return;
+  }
+
+  StrBuilder_Append (Builder, Name);
+  LoadingEvent_FreePool (Name);   // Для строки из пула ничего не делает.
+}
 
 // -----------------------------------------------------------------------------
 /**
@@ -415,10 +892,15 @@ CheckProtocolExistenceOnStartup (
   if (EFI_ERROR (Status)) {
     HandleDescription = StrAllocCopy (L"<ERROR: can\t get handle buffer for protocol>");
   } else {
-    STATIC CHAR16 Buffer[CHECK_PROTOCOL_EXISTENCE_BUFFER_SIZE];
-    UnicodeSPrint(Buffer, CHECK_PROTOCOL_EXISTENCE_BUFFER_SIZE * sizeof(CHAR16), L"[%3u] { ", (unsigned)HandleCount);
-    HandleDescription = StrAllocCopy (L"");
-    StrAllocAppend(&HandleDescription, Buffer);
+    STR_BUILDER Builder;
+    Status = StrBuilder_Construct (&Builder, CHECK_PROTOCOL_EXISTENCE_BUFFER_SIZE);
+    if (EFI_ERROR (Status)) {
+      SHELL_FREE_NON_NULL (Handles);
+      DBG_EXIT_STATUS (Status);
+      return;
+    }
+
+    StrBuilder_AppendFormat (&Builder, L"[%3u] { ", (unsigned)HandleCount);
 
     BOOLEAN First = TRUE;
 
@@ -430,12 +912,10 @@ CheckProtocolExistenceOnStartup (
         if (First) {
           First = FALSE;
         } else {
-          StrAllocAppend(&HandleDescription, L", ");
+          StrBuilder_Append (&Builder, L", ");
         }
 
-        CHAR16 *CurrentImageName = GetHandleName (Handles[Index]);
-        StrAllocAppend(&HandleDescription, CurrentImageName);
-        SHELL_FREE_NON_NULL (CurrentImageName);
+        StrBuilder_AppendHandleName (&Builder, Handles[Index]);
       } else
       {
          ++NotImageHandleCount;
@@ -446,11 +926,10 @@ CheckProtocolExistenceOnStartup (
     if (NotImageHandleCount > 0) {
       // Если были образы, то после них переводим на новую строку.
       if (!First) {
-          StrAllocAppend(&HandleDescription, L"; ");
+          StrBuilder_Append (&Builder, L"; ");
       }
 
-      UnicodeSPrint(Buffer, CHECK_PROTOCOL_EXISTENCE_BUFFER_SIZE * sizeof(CHAR16), L"not images (%u): ", (unsigned)NotImageHandleCount);
-      StrAllocAppend(&HandleDescription, Buffer);
+      StrBuilder_AppendFormat (&Builder, L"not images (%u): ", (unsigned)NotImageHandleCount);
 
       First = TRUE;
       for (UINTN Index = 0; Index < HandleCount; ++Index) {
@@ -458,23 +937,22 @@ CheckProtocolExistenceOnStartup (
           if (First) {
             First = FALSE;
           } else {
-            StrAllocAppend(&HandleDescription, L", ");
+            StrBuilder_Append (&Builder, L", ");
           }
 
-          CHAR16 *CurrentImageName = GetHandleName (Handles[Index]);
-          StrAllocAppend(&HandleDescription, CurrentImageName);
-          SHELL_FREE_NON_NULL (CurrentImageName);
+          StrBuilder_AppendHandleName (&Builder, Handles[Index]);
         }
       }
     }
 
-    StrAllocAppend(&HandleDescription, L" }");
+    StrBuilder_Append (&Builder, L" }");
+    HandleDescription = StrBuilder_Finish (&Builder);
     SHELL_FREE_NON_NULL (Handles);
   }
 
   LOADING_EVENT  Event;
   Event.Type                               = LOG_ENTRY_TYPE_PROTOCOL_EXISTS_ON_STARTUP;
-  Event.ProtocolExistsOnStartup.Guid       = *Protocol;
+  Event.ProtocolExistsOnStartup.GuidId     = InternProtocolGuid (Protocol);
   Event.ProtocolExistsOnStartup.HandleDescription = HandleDescription;
 
   This->AddEvent (This->ExternalData, &Event);
@@ -485,17 +963,21 @@ CheckProtocolExistenceOnStartup (
 // -----------------------------------------------------------------------------
 /**
   Взято из ShellPkg, возвращает имя модуля для тех из них что входят в состав образа.
+  Вместо EFI_LOADED_IMAGE_PROTOCOL принимает нужные из него поля, чтобы работать и по снимку хэндла.
+  Секция с именем читается из тома прошивки не более одного раза на GUID файла, дальше имя берётся из gFvImageNames.
 
   Function to find the file name associated with a LoadedImageProtocol.
 
-  @param[in] LoadedImage     An instance of LoadedImageProtocol.
+  @param[in] DeviceHandle    LoadedImage->DeviceHandle.
+  @param[in] FilePath        LoadedImage->FilePath.
 
   @retval                    A string representation of the file name associated
-                             with LoadedImage, or NULL if no name can be found.
+                             with LoadedImage (from the event string pool), or NULL if no name can be found.
 **/
 CHAR16 *
-FindLoadedImageFileName (
-  IN EFI_LOADED_IMAGE_PROTOCOL *LoadedImage
+FindImageFileName (
+  IN EFI_HANDLE               DeviceHandle,
+  IN EFI_DEVICE_PATH_PROTOCOL *FilePath
   )
 {
   DBG_ENTER ();
@@ -506,23 +988,29 @@ FindLoadedImageFileName (
   VOID                           *Buffer;
   UINTN                          BufferSize;
   UINT32                         AuthenticationStatus;
+  CHAR16                         *Name;
 
-  if ((LoadedImage == NULL) || (LoadedImage->FilePath == NULL)) {
+  if ((DeviceHandle == NULL) || (FilePath == NULL)) {
     DBG_EXIT_STATUS (EFI_INVALID_PARAMETER);
     return NULL;
   }
 
-  NameGuid = EfiGetNameGuidFromFwVolDevicePathNode((MEDIA_FW_VOL_FILEPATH_DEVICE_PATH *)LoadedImage->FilePath);
+  NameGuid = EfiGetNameGuidFromFwVolDevicePathNode((MEDIA_FW_VOL_FILEPATH_DEVICE_PATH *)FilePath);
 
   if (NameGuid == NULL) {
     DBG_EXIT_STATUS (EFI_VOLUME_CORRUPTED);
     return NULL;
   }
 
+  if (FindCachedFvImageName (NameGuid, &Name)) {
+    DBG_EXIT_STATUS (EFI_SUCCESS);
+    return (Name != NULL) ? LoadingEvent_InternString (Name) : NULL;
+  }
+
   //
   // Get the FirmwareVolume2Protocol of the device handle that this image was loaded from.
   //
-  Status = gBS->HandleProtocol (LoadedImage->DeviceHandle, &gEfiFirmwareVolume2ProtocolGuid, (VOID**) &Fv);
+  Status = gBS->HandleProtocol (DeviceHandle, &gEfiFirmwareVolume2ProtocolGuid, (VOID**) &Fv);
 
   //
   // FirmwareVolume2Protocol is PI, and is not required to be available.
@@ -539,6 +1027,8 @@ FindLoadedImageFileName (
   Status = Fv->ReadSection(Fv, NameGuid, EFI_SECTION_USER_INTERFACE, 0, &Buffer, &BufferSize, &AuthenticationStatus);
 
   if (EFI_ERROR (Status)) {
+    // Секции нет, и в следующий раз не будет: запоминаем и это.
+    CacheFvImageName (NameGuid, NULL);
     DBG_EXIT_STATUS (Status);
     return NULL;
   }
@@ -547,8 +1037,172 @@ FindLoadedImageFileName (
   // ReadSection returns just the section data, without any section header. For
   // a user interface section, the only data is the file name.
   //
+  Name = LoadingEvent_InternString (Buffer);
+  if (!CacheFvImageName (NameGuid, Buffer)) {
+    gBS->FreePool (Buffer);
+  }
+
+  DBG_EXIT_STATUS (EFI_SUCCESS);
+  return Name;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет в gFvImageNames имя файла тома прошивки с GUID'ом FileGuid.
+ *
+ * @retval TRUE                     Секцию с именем уже читали, *Name - имя, либо NULL если секции нет.
+ * @retval FALSE                    Секцию ещё не читали.
+*/
+BOOLEAN
+FindCachedFvImageName (
+  IN  CONST EFI_GUID *FileGuid,
+  OUT CHAR16         **Name
+  )
+{
+  BOOLEAN Found  = FALSE;
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+
+  if (gFvImageNamesConstructed) {
+    CHAR16 **Entry = HashMap_Find (&gFvImageNames, FileGuid);
+    if (Entry != NULL) {
+      *Name = *Entry;
+      Found = TRUE;
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Found;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Запоминает в gFvImageNames имя файла тома прошивки с GUID'ом FileGuid.
+ *
+ * @param Name                      Буфер, выделенный ReadSection(), либо NULL если секции с именем нет.
+ *
+ * @retval TRUE                     Таблица забрала Name себе.
+ * @retval FALSE                    Имя не запомнено, Name по-прежнему принадлежит вызывающему.
+*/
+BOOLEAN
+CacheFvImageName (
+  IN CONST EFI_GUID *FileGuid,
+  IN CHAR16         *Name  OPTIONAL
+  )
+{
+  EFI_STATUS Status = EFI_SUCCESS;
+
+  // Кэш используется только там, где читаются секции томов прошивки, т.е. не выше TPL_NOTIFY.
+  // Поэтому и блокировки на TPL_NOTIFY достаточно, а на нём таблица может выделять память.
+  EFI_TPL    OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+
+  if (!gFvImageNamesConstructed) {
+    Status = HashMap_Construct (&gFvImageNames, HashMapKeyGuid, sizeof (CHAR16 *), FV_IMAGE_NAMES_INITIAL_COUNT);
+    gFvImageNamesConstructed = !EFI_ERROR (Status);
+  }
+
+  // Если то же имя успели прочитать и запомнить параллельно, то HashMap_Insert() вернёт ошибку.
+  if (!EFI_ERROR (Status)) {
+    Status = HashMap_Insert (&gFvImageNames, FileGuid, &Name);
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return !EFI_ERROR (Status);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Один раз проходит по файлам всех томов прошивки и запоминает имена исполняемых модулей,
+ * чтобы потом не читать секции с именами по одной.
+*/
+VOID
+PrefetchFvImageNames (
+  VOID
+  )
+{
+  DBG_ENTER ();
+
+  EFI_STATUS  Status;
+  UINTN       FvCount;
+  EFI_HANDLE  *FvHandles = NULL;
+  UINTN       NameCount  = 0;
+
+  Status = gBS->LocateHandleBuffer (
+                  ByProtocol,
+                  &gEfiFirmwareVolume2ProtocolGuid,
+                  NULL,
+                  &FvCount,
+                  &FvHandles
+                  );
+  if (EFI_ERROR (Status)) {
+    DBG_EXIT_STATUS (Status);
+    return;
+  }
+
+  for (UINTN FvIndex = 0; FvIndex < FvCount; ++FvIndex) {
+    EFI_FIRMWARE_VOLUME2_PROTOCOL *Fv;
+    Status = gBS->HandleProtocol (FvHandles[FvIndex], &gEfiFirmwareVolume2ProtocolGuid, (VOID **)&Fv);
+    if (EFI_ERROR (Status)) {
+      continue;
+    }
+
+    VOID *Key;
+    Status = gBS->AllocatePool (EfiBootServicesData, Fv->KeySize, &Key);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+    ZeroMem (Key, Fv->KeySize);
+
+    while (TRUE) {
+      EFI_FV_FILETYPE        FileType = EFI_FV_FILETYPE_ALL;
+      EFI_GUID               FileGuid;
+      EFI_FV_FILE_ATTRIBUTES Attributes;
+      UINTN                  FileSize;
+
+      Status = Fv->GetNextFile (Fv, Key, &FileType, &FileGuid, &Attributes, &FileSize);
+      if (EFI_ERROR (Status)) {
+        break;
+      }
+
+      // Имена нужны только для того, что может быть загружено как образ на DXE-стадии.
+      switch (FileType) {
+      case EFI_FV_FILETYPE_DXE_CORE:
+      case EFI_FV_FILETYPE_DRIVER:
+      case EFI_FV_FILETYPE_COMBINED_PEIM_DRIVER:
+      case EFI_FV_FILETYPE_APPLICATION:
+      case EFI_FV_FILETYPE_SMM:
+      case EFI_FV_FILETYPE_COMBINED_SMM_DXE:
+        break;
+      default:
+        continue;
+      }
+
+      CHAR16 *Name;
+      if (FindCachedFvImageName (&FileGuid, &Name)) {
+        continue;
+      }
+
+      VOID   *Buffer = NULL;
+      UINTN  BufferSize;
+      UINT32 AuthenticationStatus;
+      Status = Fv->ReadSection (Fv, &FileGuid, EFI_SECTION_USER_INTERFACE, 0, &Buffer, &BufferSize, &AuthenticationStatus);
+      if (EFI_ERROR (Status)) {
+        Buffer = NULL;
+      }
+
+      if (CacheFvImageName (&FileGuid, Buffer)) {
+        ++NameCount;
+      } else if (Buffer != NULL) {
+        gBS->FreePool (Buffer);
+      }
+    }
+
+    gBS->FreePool (Key);
+  }
+
+  gBS->FreePool (FvHandles);
+
+  DBG_INFO ("-- Prefetched %u image names from %u firmware volumes\n", (unsigned)NameCount, (unsigned)FvCount);
   DBG_EXIT_STATUS (EFI_SUCCESS);
-  return Buffer;
 }
 
 // -----------------------------------------------------------------------------
\ No newline at end of file
@@ -5,6 +5,42 @@
 #include <Library/HandleDatabaseDumpLib.h>
 #include <Library/CommonMacrosLib.h>
 
+//------------------------------------------------------------------------------
+/**
+ * Упорядочивает GUID'ы побайтово, для Vector_Sort() и компании.
+*/
+STATIC
+INTN
+EFIAPI
+CompareGuidOrder (
+  IN CONST VOID *Left,
+  IN CONST VOID *Right
+  )
+{
+  return CompareMem (Left, Right, sizeof (EFI_GUID));
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Упорядочивает хэндлы по значению указателя, для Vector_Sort() и компании.
+*/
+STATIC
+INTN
+EFIAPI
+CompareHandleOrder (
+  IN CONST VOID *Left,
+  IN CONST VOID *Right
+  )
+{
+  UINTN LeftValue  = (UINTN)*(CONST EFI_HANDLE *)Left;
+  UINTN RightValue = (UINTN)*(CONST EFI_HANDLE *)Right;
+
+  if (LeftValue < RightValue) {
+    return -1;
+  }
+  return (LeftValue > RightValue) ? 1 : 0;
+}
+
 //------------------------------------------------------------------------------
 /**
  * Генерит HANDLE_DATABASE_DUMP из текущего состояния системы.
@@ -58,11 +94,11 @@ GetHandleDatabaseDump (
     }
 
     HANDLE_DATABASE_ENTRY DbEntry;
-    Status = Vector_PushBack (Dump, &DbEntry);
+    Status = Vector_PushBack_HANDLE_DATABASE_ENTRY (Dump, &DbEntry);
     if (EFI_ERROR (Status)) {
       DBG_ERROR ("Error in Vector_PushBack(): %r", Status);
     }
-    HANDLE_DATABASE_ENTRY *HandleInfo = (HANDLE_DATABASE_ENTRY *)Vector_GetLast (Dump);
+    HANDLE_DATABASE_ENTRY *HandleInfo = Vector_Get_HANDLE_DATABASE_ENTRY (Dump, Vector_Size (Dump) - 1);
 
     HandleInfo->Handle = Handles[Index];
     Status = Vector_Construct (
@@ -79,7 +115,7 @@ GetHandleDatabaseDump (
     for (UINTN ProtocolIndex = 0; ProtocolIndex < ArrayCount; ProtocolIndex++) {
       EFI_GUID *ProtocolGuid = ProtocolGuidArray[ProtocolIndex];
 
-      Status = Vector_PushBack (&HandleInfo->InstalledProtocolGuids, ProtocolGuid);
+      Status = Vector_PushBack_EFI_GUID (&HandleInfo->InstalledProtocolGuids, ProtocolGuid);
       if (EFI_ERROR (Status)) {
         DBG_ERROR ("Error in Vector_PushBack(): %r", Status);
       }
@@ -109,7 +145,7 @@ HandleDatabaseDump_Destruct (
     return;
   }
 
-  FOR_EACH_VCT (HANDLE_DATABASE_ENTRY, DbEntry, *Dump) {
+  FOR_EACH_TYPED_VCT (HANDLE_DATABASE_ENTRY, DbEntry, *Dump) {
     Vector_Destruct (&DbEntry->InstalledProtocolGuids);
   }
 
@@ -121,7 +157,7 @@ HandleDatabaseDump_Destruct (
 //------------------------------------------------------------------------------
 /**
  * Возвращает список всех протоколов из Dump.
- * Каждый протокол встречается в списке ровно один раз.
+ * Каждый протокол встречается в списке ровно один раз, список упорядочен по GUID'ам.
  *
  * @param Dump              Дамп, в котором мы ищем хэндлы.
  * @param Protocols         Вектор с GUID'ами протоколов.
@@ -144,36 +180,31 @@ HandleDatabaseDump_PeekAllProtocols (
     return EFI_INVALID_PARAMETER;
   }
 
+  // Собираем все GUID'ы подряд, затем сортируем и выкидываем повторы: O(n log n)
+  // вместо поиска каждого GUID'а в уже собранном списке.
+  UINTN TotalCount = 0;
+  FOR_EACH_TYPED_VCT (HANDLE_DATABASE_ENTRY, HandleWithProtocols, *Dump) {
+    TotalCount += Vector_Size (&HandleWithProtocols->InstalledProtocolGuids);
+  }
+
   EFI_STATUS Status;
-  Status = Vector_Construct (Protocols, sizeof(EFI_GUID), 64);
+  Status = Vector_Construct (Protocols, sizeof(EFI_GUID), MAX (TotalCount, 1));
   RETURN_ON_ERR (Status);
 
-  FOR_EACH_VCT (HANDLE_DATABASE_ENTRY, HandleWithProtocols, *Dump) {
-    // Для каждого протокола...
-    FOR_EACH_VCT (EFI_GUID, Guid, HandleWithProtocols->InstalledProtocolGuids) {
-      BOOLEAN AlreadyStored = FALSE;
-
-      // Ищем, занесли ли мы его в список ранее...
-      FOR_EACH_VCT (EFI_GUID, StoredGuid, *Protocols) {
-        if (CompareGuid (Guid, StoredGuid)) {
-          AlreadyStored = TRUE;
-          break;
-        }
-      }
-
-      // И если мы его ещё не занесли в Protocols...
-      if (!AlreadyStored) {
-        // То заносим.
-        Status = Vector_PushBack (Protocols, Guid);
-        if (EFI_ERROR (Status)) {
-          Vector_Destruct (Protocols);
-          DBG_EXIT_STATUS (Status);
-          return Status;
-        }
+  FOR_EACH_TYPED_VCT (HANDLE_DATABASE_ENTRY, HandleEntry, *Dump) {
+    FOR_EACH_TYPED_VCT (EFI_GUID, Guid, HandleEntry->InstalledProtocolGuids) {
+      Status = Vector_PushBack_EFI_GUID (Protocols, Guid);
+      if (EFI_ERROR (Status)) {
+        Vector_Destruct (Protocols);
+        DBG_EXIT_STATUS (Status);
+        return Status;
       }
     }
   }
 
+  Vector_Sort   (Protocols, CompareGuidOrder);
+  Vector_Unique (Protocols, CompareGuidOrder);
+
   DBG_EXIT_STATUS (EFI_SUCCESS);
   return EFI_SUCCESS;
 }
@@ -207,10 +238,10 @@ HandleDatabaseDump_PeekHandlesWithProtocol (
   Status = Vector_Construct (Handles, sizeof(EFI_HANDLE), 2);
   RETURN_ON_ERR (Status);
 
-  FOR_EACH_VCT (HANDLE_DATABASE_ENTRY, DbEntry, *Dump) {
-    FOR_EACH_VCT (EFI_GUID, Guid, DbEntry->InstalledProtocolGuids) {
+  FOR_EACH_TYPED_VCT (HANDLE_DATABASE_ENTRY, DbEntry, *Dump) {
+    FOR_EACH_TYPED_VCT (EFI_GUID, Guid, DbEntry->InstalledProtocolGuids) {
       if (CompareGuid (Guid, ProtocolGuid)) {
-        Status = Vector_PushBack (Handles, &DbEntry->Handle);
+        Status = Vector_PushBack_EFI_HANDLE (Handles, &DbEntry->Handle);
         if (EFI_ERROR (Status)) {
           Vector_Destruct (Handles);
           DBG_EXIT_STATUS (Status);
@@ -229,6 +260,8 @@ HandleDatabaseDump_PeekHandlesWithProtocol (
 /**
  * Возвращает те хэндлы из DumpNew, на которые установлен протокол ProtocolGuid
  * и которых при этом не был установлен протокол ProtocolGuid в DumpOld.
+ * Работает за O(n log n): сортируется копия старого набора, и каждый новый хэндл ищется в ней
+ * двоичным поиском. Сами наборы не меняются, хэндлы в HandlesAdded идут в том же порядке, что и в HandlesNew.
  *
  * @param HandlesOld        Старый набор хэндлов.
  * @param HandlesNew        Новый набор хэндлов.
@@ -254,31 +287,39 @@ HandleDatabaseDump_GetAddedHandles (
   }
 
   EFI_STATUS Status;
-  Status = Vector_Construct (HandlesAdded, sizeof(EFI_HANDLE), 2);
+  VECTOR TYPE (EFI_HANDLE) SortedOld;
+
+  Status = Vector_Construct (&SortedOld, sizeof(EFI_HANDLE), MAX (Vector_Size (HandlesOld), 1));
   RETURN_ON_ERR (Status);
 
-  FOR_EACH_VCT (EFI_HANDLE, HandleNew, *HandlesNew) {
-    BOOLEAN Found = FALSE;
+  FOR_EACH_TYPED_VCT (EFI_HANDLE, HandleOld, *HandlesOld) {
+    Vector_PushBack_EFI_HANDLE (&SortedOld, HandleOld);
+  }
+  Vector_Sort (&SortedOld, CompareHandleOrder);
 
-    FOR_EACH_VCT (EFI_HANDLE, HandleOld, *HandlesOld) {
-      if (*HandleNew == *HandleOld) {
-        Found = TRUE;
-        continue;
-      }
+  Status = Vector_Construct (HandlesAdded, sizeof(EFI_HANDLE), 2);
+  if (EFI_ERROR (Status)) {
+    Vector_Destruct (&SortedOld);
+    DBG_EXIT_STATUS (Status);
+    return Status;
+  }
+
+  FOR_EACH_TYPED_VCT (EFI_HANDLE, HandleNew, *HandlesNew) {
+    UINTN Index = Vector_LowerBound (&SortedOld, HandleNew, CompareHandleOrder);
+    if (Index < Vector_Size (&SortedOld) && *Vector_Get_EFI_HANDLE (&SortedOld, Index) == *HandleNew) {
+      continue;
     }
 
-    if (!Found) {
-      Status = Vector_PushBack (HandlesAdded, HandleNew);
-        if (EFI_ERROR (Status)) {
-          Vector_Destruct (HandlesAdded);
-          DBG_EXIT_STATUS (Status);
-          return Status;
-        }
+    Status = Vector_PushBack_EFI_HANDLE (HandlesAdded, HandleNew);
+    if (EFI_ERROR (Status)) {
+      Vector_Destruct (HandlesAdded);
+      break;
     }
   }
 
-  DBG_EXIT_STATUS (EFI_SUCCESS);
-  return EFI_SUCCESS;
+  Vector_Destruct (&SortedOld);
+  DBG_EXIT_STATUS (Status);
+  return Status;
 }
 
-//------------------------------------------------------------------------------
\ No newline at end of file
+//------------------------------------------------------------------------------
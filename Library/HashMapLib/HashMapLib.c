@@ -0,0 +1,465 @@
+#include <Library/HashMapLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+// -----------------------------------------------------------------------------
+// Таблица заполняется не более чем на 3/4, иначе линейное пробирование сильно деградирует.
+#define MIN_CAPACITY                8
+#define MAX_COUNT(Capacity)         ((Capacity) - (Capacity) / 4)
+
+#define ENTRY(This, Index)          ((This)->Entries + (This)->EntrySize * (Index))
+#define ENTRY_VALUE(This, Entry)    ((Entry) + (This)->KeySize)
+
+// Финализатор MurmurHash3.
+#define HASH_FMIX_MUL1              0xFF51AFD7ED558CCDull
+#define HASH_FMIX_MUL2              0xC4CEB9FE1A85EC53ull
+
+// -----------------------------------------------------------------------------
+/**
+ * Перемешивает все биты значения, чтобы младшие биты хэша зависели от всего ключа.
+*/
+STATIC
+UINT64
+Fmix64 (
+  IN UINT64 Value
+  )
+{
+  Value ^= Value >> 33;
+  Value *= HASH_FMIX_MUL1;
+  Value ^= Value >> 33;
+  Value *= HASH_FMIX_MUL2;
+  Value ^= Value >> 33;
+  return Value;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает номер ячейки, с которой начинается поиск ключа.
+*/
+STATIC
+UINTN
+HomeIndex (
+  IN HASH_MAP   *This,
+  IN CONST VOID *Key
+  )
+{
+  UINT64 Hash;
+
+  if (This->KeyType == HashMapKeyGuid) {
+    UINT64 Low  = ReadUnaligned64 ((CONST UINT64 *)Key);
+    UINT64 High = ReadUnaligned64 ((CONST UINT64 *)Key + 1);
+    Hash = Fmix64 (Fmix64 (Low) ^ High);
+  } else {
+    Hash = Fmix64 ((UINT64)*(CONST UINTN *)Key);
+  }
+
+  return (UINTN)Hash & (This->Capacity - 1);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Сравнивает ключи на равенство.
+*/
+STATIC
+BOOLEAN
+KeysEqual (
+  IN HASH_MAP   *This,
+  IN CONST VOID *Left,
+  IN CONST VOID *Right
+  )
+{
+  if (This->KeyType == HashMapKeyGuid) {
+    return CompareGuid ((CONST GUID *)Left, (CONST GUID *)Right);
+  }
+
+  return *(CONST UINTN *)Left == *(CONST UINTN *)Right;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет ячейку с ключом Key.
+ *
+ * @retval TRUE                     Ключ найден, в Index его ячейка.
+ * @retval FALSE                    Ключа нет, в Index первая свободная ячейка, куда его можно вставить.
+*/
+STATIC
+BOOLEAN
+FindSlot (
+  IN  HASH_MAP   *This,
+  IN  CONST VOID *Key,
+  OUT UINTN      *Index
+  )
+{
+  UINTN Mask = This->Capacity - 1;
+  UINTN Slot = HomeIndex (This, Key);
+
+  // Таблица никогда не заполняется целиком, поэтому свободная ячейка всегда найдётся.
+  while (This->Used[Slot]) {
+    if (KeysEqual (This, ENTRY (This, Slot), Key)) {
+      *Index = Slot;
+      return TRUE;
+    }
+    Slot = (Slot + 1) & Mask;
+  }
+
+  *Index = Slot;
+  return FALSE;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Переносит все элементы в новую таблицу на Capacity ячеек.
+ * При ошибке выделения памяти таблица остаётся прежней.
+*/
+STATIC
+EFI_STATUS
+Rehash (
+  IN OUT HASH_MAP *This,
+  IN     UINTN    Capacity
+  )
+{
+  EFI_STATUS Status;
+  UINT8      *Memory = NULL;
+
+  // Признаки занятости и ячейки лежат в одном блоке, ячейки выровнены на 8 байт.
+  UINTN UsedSize = ALIGN_VALUE (Capacity, sizeof (UINT64));
+
+  Status = gBS->AllocatePool (
+                  EfiBootServicesData,
+                  UsedSize + Capacity * This->EntrySize,
+                  (VOID **)&Memory
+                  );
+  if (EFI_ERROR (Status)) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  UINT8 *OldUsed     = This->Used;
+  UINT8 *OldEntries  = This->Entries;
+  UINTN OldCapacity  = This->Capacity;
+
+  This->Used     = Memory;
+  This->Entries  = Memory + UsedSize;
+  This->Capacity = Capacity;
+  gBS->SetMem (This->Used, Capacity, 0);
+
+  for (UINTN Index = 0; Index < OldCapacity; ++Index) {
+    if (OldUsed[Index]) {
+      UINT8 *Entry = OldEntries + This->EntrySize * Index;
+      UINTN NewIndex;
+      FindSlot (This, Entry, &NewIndex);
+      gBS->CopyMem (ENTRY (This, NewIndex), Entry, This->EntrySize);
+      This->Used[NewIndex] = 1;
+    }
+  }
+
+  if (OldUsed != NULL) {
+    gBS->FreePool (OldUsed);
+  }
+
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Инициализирует структуру HASH_MAP, выделяет память под InitialCount элементов.
+ * Функция должна быть обязательно однократно вызвана перед использованием объекта.
+ *
+ * @param This                      Указатель на инициализируемую структуру.
+ * @param KeyType                   Тип ключа.
+ * @param ValueSize                 Размер значения в байтах, 0 - множество ключей без значений.
+ * @param InitialCount              Сколько элементов можно вставить без выделения памяти.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно, таблицей можно пользоваться.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    This == NULL, либо неизвестный тип ключа.
+ */
+EFI_STATUS
+HashMap_Construct (
+  IN OUT  HASH_MAP          *This,
+  IN      HASH_MAP_KEY_TYPE KeyType,
+  IN      UINTN             ValueSize,
+  IN      UINTN             InitialCount
+  )
+{
+  if (This == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  switch (KeyType) {
+  case HashMapKeyGuid:
+    This->KeySize = sizeof (EFI_GUID);
+    break;
+  case HashMapKeyPointer:
+    This->KeySize = sizeof (UINTN);
+    break;
+  default:
+    return EFI_INVALID_PARAMETER;
+  }
+
+  This->KeyType   = KeyType;
+  This->ValueSize = ValueSize;
+  This->EntrySize = ALIGN_VALUE (This->KeySize + ValueSize, sizeof (UINT64));
+  This->Capacity  = 0;
+  This->CountUsed = 0;
+  This->Used      = NULL;
+  This->Entries   = NULL;
+  This->NoGrow    = FALSE;
+
+  return HashMap_Reserve (This, InitialCount);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает память из-под таблицы.
+ * Функция должна быть обязательно однократно вызвана после завершения использования объекта.
+ *
+ * @param This                      Указатель на структуру.
+ */
+VOID
+HashMap_Destruct (
+  IN OUT  HASH_MAP  *This
+  )
+{
+  if (This->Used != NULL) {
+    gBS->FreePool (This->Used);
+  }
+
+  This->Used      = NULL;
+  This->Entries   = NULL;
+  This->Capacity  = 0;
+  This->CountUsed = 0;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Гарантирует, что в таблицу можно будет вставить до Count элементов (всего) без выделения памяти.
+ * Выделяет память, только если текущей таблицы недостаточно.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Count                     Требуемое количество элементов.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память, таблица осталась прежней.
+ * @retval EFI_INVALID_PARAMETER    This == NULL.
+ */
+EFI_STATUS
+HashMap_Reserve (
+  IN OUT  HASH_MAP  *This,
+  IN      UINTN     Count
+  )
+{
+  if (This == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  UINTN Capacity = MAX (This->Capacity, MIN_CAPACITY);
+  while (MAX_COUNT (Capacity) < Count) {
+    if (Capacity > MAX_UINTN / 2) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+    Capacity *= 2;
+  }
+
+  if (Capacity == This->Capacity) {
+    return EFI_SUCCESS;
+  }
+
+  return Rehash (This, Capacity);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Вставляет в таблицу ключ Key со значением Value.
+ * Если такой ключ уже есть, его значение не меняется.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Key                       Указатель на ключ: EFI_GUID* либо указатель на переменную-указатель.
+ * @param Value                     Указатель на значение, для множества может быть NULL.
+ *
+ * @retval EFI_SUCCESS              Элемент вставлен.
+ * @retval EFI_ALREADY_STARTED      Такой ключ уже есть в таблице.
+ * @retval EFI_OUT_OF_RESOURCES     Таблица заполнена, а выделить память под новую не удалось
+ *                                  (или нельзя: NoGrow == TRUE).
+ * @retval EFI_INVALID_PARAMETER    This == NULL или Key == NULL, либо Value == NULL при ненулевом размере значения.
+ */
+EFI_STATUS
+HashMap_Insert (
+  IN OUT  HASH_MAP    *This,
+  IN      CONST VOID  *Key,
+  IN      CONST VOID  *Value  OPTIONAL
+  )
+{
+  EFI_STATUS Status;
+  UINTN      Index;
+
+  if (This == NULL || Key == NULL || (Value == NULL && This->ValueSize != 0) || This->Used == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (FindSlot (This, Key, &Index)) {
+    return EFI_ALREADY_STARTED;
+  }
+
+  if (This->CountUsed + 1 > MAX_COUNT (This->Capacity)) {
+    if (This->NoGrow) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+    Status = HashMap_Reserve (This, This->CountUsed + 1);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    FindSlot (This, Key, &Index);
+  }
+
+  UINT8 *Entry = ENTRY (This, Index);
+  gBS->CopyMem (Entry, (VOID *)Key, This->KeySize);
+  if (This->ValueSize != 0) {
+    gBS->CopyMem (ENTRY_VALUE (This, Entry), (VOID *)Value, This->ValueSize);
+  }
+
+  This->Used[Index] = 1;
+  This->CountUsed++;
+
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет в таблице ключ Key.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Key                       Указатель на ключ.
+ *
+ * @retval NULL                     Ключ не найден.
+ * @return Указатель на значение, для множества - указатель на хранимый ключ.
+ *         Действителен до следующего изменения таблицы.
+ */
+VOID *
+HashMap_Find (
+  IN      HASH_MAP    *This,
+  IN      CONST VOID  *Key
+  )
+{
+  UINTN Index;
+
+  if (This == NULL || Key == NULL || This->Used == NULL) {
+    return NULL;
+  }
+
+  if (!FindSlot (This, Key, &Index)) {
+    return NULL;
+  }
+
+  UINT8 *Entry = ENTRY (This, Index);
+  return (This->ValueSize != 0) ? ENTRY_VALUE (This, Entry) : Entry;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Удаляет из таблицы ключ Key вместе с его значением. Память не освобождается.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Key                       Указатель на ключ.
+ *
+ * @retval EFI_SUCCESS              Элемент удалён.
+ * @retval EFI_NOT_FOUND            Такого ключа в таблице нет.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL.
+ */
+EFI_STATUS
+HashMap_Remove (
+  IN OUT  HASH_MAP    *This,
+  IN      CONST VOID  *Key
+  )
+{
+  UINTN Hole;
+
+  if (This == NULL || Key == NULL || This->Used == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (!FindSlot (This, Key, &Hole)) {
+    return EFI_NOT_FOUND;
+  }
+
+  // Вместо надгробий сдвигаем назад хвост цепочки, чтобы поиск не обрывался на дырке.
+  // Элемент переносится в дырку, если она лежит между его домашней ячейкой и текущей.
+  UINTN Mask = This->Capacity - 1;
+  UINTN Next = (Hole + 1) & Mask;
+
+  while (This->Used[Next]) {
+    UINTN Home = HomeIndex (This, ENTRY (This, Next));
+    if (((Next - Home) & Mask) >= ((Next - Hole) & Mask)) {
+      gBS->CopyMem (ENTRY (This, Hole), ENTRY (This, Next), This->EntrySize);
+      Hole = Next;
+    }
+    Next = (Next + 1) & Mask;
+  }
+
+  This->Used[Hole] = 0;
+  This->CountUsed--;
+
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает количество хранимых элементов.
+ *
+ * @param This                      Указатель на структуру.
+ *
+ * @return Количество хранимых элементов.
+ */
+UINTN
+HashMap_Size (
+  IN      HASH_MAP  *This
+  )
+{
+  if (This == NULL) {
+    return 0;
+  }
+
+  return This->CountUsed;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Перебирает элементы таблицы в произвольном порядке.
+ * Во время перебора таблицу менять нельзя.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Position                  Перед первым вызовом - 0, далее передаётся как есть.
+ * @param Key                       Сюда записывается указатель на хранимый ключ.
+ * @param Value                     Сюда записывается указатель на значение, может быть NULL.
+ *
+ * @retval TRUE                     Очередной элемент найден.
+ * @retval FALSE                    Элементы кончились.
+ */
+BOOLEAN
+HashMap_GetNext (
+  IN      HASH_MAP  *This,
+  IN OUT  UINTN     *Position,
+  OUT     VOID      **Key,
+  OUT     VOID      **Value   OPTIONAL
+  )
+{
+  if (This == NULL || Position == NULL || Key == NULL) {
+    return FALSE;
+  }
+
+  while (*Position < This->Capacity) {
+    UINTN Index = (*Position)++;
+    if (This->Used[Index]) {
+      UINT8 *Entry = ENTRY (This, Index);
+      *Key = Entry;
+      if (Value != NULL) {
+        *Value = (This->ValueSize != 0) ? ENTRY_VALUE (This, Entry) : NULL;
+      }
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+// -----------------------------------------------------------------------------
@@ -1,6 +1,73 @@
 #include <Library/LoadingEventLib.h>
 #include <Library/CommonMacrosLib.h>
 #include <Library/UefiBootServicesTableLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/HashMapLib.h>
+
+// Арена, из которой выделяются строки событий, NULL - выделяем через EFI_BOOT_SERVICES.
+// События приходят и на TPL_HIGH_LEVEL, где сервисы памяти вызывать нельзя, поэтому арена
+// и таблицы ниже сами не растут (NoGrow), а пополняются в LoadingEvent_ReserveMemory().
+STATIC ARENA *gEventArena;
+
+// -----------------------------------------------------------------------------
+/**
+ * Строка пула, лежит в арене. Строки с одинаковым хэшем связаны в цепочку через Next.
+*/
+typedef struct _INTERNED_STRING INTERNED_STRING;
+struct _INTERNED_STRING {
+  INTERNED_STRING *Next;
+  UINTN           Length;           // В символах, без L'\0'.
+  CHAR16          String[1];
+};
+
+// Хэш строки -> первая строка цепочки (INTERNED_STRING *). Ведётся, пока задана арена.
+STATIC HASH_MAP                         gInternedStrings;
+STATIC LOADING_EVENT_STRING_POOL_STATS  gStringPoolStats;
+
+// -----------------------------------------------------------------------------
+/**
+ * Элемент кэша имён хэндлов.
+*/
+typedef struct {
+  UINTN   Generation;
+  CHAR16  *Name;                    // Строка пула, NULL - для текущего поколения имени ещё нет.
+} HANDLE_NAME_CACHE_ENTRY;
+
+// Хэндл -> HANDLE_NAME_CACHE_ENTRY. Ведётся, пока задана арена, элементы не удаляются:
+// иначе пропало бы поколение хэндла, и старые снимки хэндла совпали бы с новыми.
+STATIC HASH_MAP                               gHandleNames;
+STATIC LOADING_EVENT_HANDLE_NAME_CACHE_STATS  gHandleNameCacheStats;
+
+// TRUE - поколение какого-то хэндла не удалось запомнить, кэш больше не ведётся.
+// Таблица при этом не освобождается: это нельзя делать на TPL_HIGH_LEVEL.
+STATIC BOOLEAN                                gHandleNamesDisabled;
+
+// Имена хэндлов и образов повторяются сотнями, поэтому сразу готовимся к такому количеству.
+#define INTERNED_STRINGS_INITIAL_COUNT  512
+#define HANDLE_NAMES_INITIAL_COUNT      1024
+
+// Запас, который LoadingEvent_ReserveMemory() держит для выделений на TPL_HIGH_LEVEL.
+#define EVENT_ARENA_RESERVE_SIZE        SIZE_16KB
+#define INTERNED_STRINGS_RESERVE_COUNT  64
+#define HANDLE_NAMES_RESERVE_COUNT      64
+
+#define HANDLE_NAMES_ENABLED()  (gHandleNames.Used != NULL && !gHandleNamesDisabled)
+
+#define FNV1A_OFFSET_BASIS  0xCBF29CE484222325ull
+#define FNV1A_PRIME         0x00000100000001B3ull
+
+#define EVENT_FREE_NON_NULL(Pointer)  \
+  if ((Pointer) != NULL) {            \
+    LoadingEvent_FreePool (Pointer);  \
+    (Pointer) = NULL;                 \
+  }
+
+#define EVENT_FREE_SNAPSHOT(Snapshot)                 \
+  if ((Snapshot) != NULL) {                           \
+    EVENT_FREE_NON_NULL ((Snapshot)->DevicePath);     \
+    EVENT_FREE_NON_NULL (Snapshot);                   \
+  }
 
 // -----------------------------------------------------------------------------
 /**
@@ -11,36 +78,39 @@ LoadingEvent_Destruct (
   LOADING_EVENT *Event
   )
 {
-  if (Event == NULL) {
+  if (Event == NULL || gEventArena != NULL) {
     return;
   }
 
   switch (Event->Type)
   {
   case LOG_ENTRY_TYPE_PROTOCOL_INSTALLED:
-    SHELL_FREE_NON_NULL (Event->ProtocolInstalled.HandleDescription);
+    EVENT_FREE_NON_NULL (Event->ProtocolInstalled.HandleDescription);
+    EVENT_FREE_SNAPSHOT (Event->ProtocolInstalled.HandleSnapshot);
     break;
 
   case LOG_ENTRY_TYPE_PROTOCOL_REINSTALLED:
-    SHELL_FREE_NON_NULL (Event->ProtocolReinstalled.HandleDescription);
+    EVENT_FREE_NON_NULL (Event->ProtocolReinstalled.HandleDescription);
+    EVENT_FREE_SNAPSHOT (Event->ProtocolReinstalled.HandleSnapshot);
     break;
 
   case LOG_ENTRY_TYPE_PROTOCOL_REMOVED:
-    SHELL_FREE_NON_NULL (Event->ProtocolRemoved.HandleDescription);
+    EVENT_FREE_NON_NULL (Event->ProtocolRemoved.HandleDescription);
+    EVENT_FREE_SNAPSHOT (Event->ProtocolRemoved.HandleSnapshot);
     break;
 
   case LOG_ENTRY_TYPE_PROTOCOL_EXISTS_ON_STARTUP:
-    SHELL_FREE_NON_NULL (Event->ProtocolExistsOnStartup.HandleDescription);
+    EVENT_FREE_NON_NULL (Event->ProtocolExistsOnStartup.HandleDescription);
     break;
 
   case LOG_ENTRY_TYPE_IMAGE_LOADED:
-    SHELL_FREE_NON_NULL (Event->ImageLoaded.ImageName);
-    SHELL_FREE_NON_NULL (Event->ImageLoaded.ParentImageName);
+    EVENT_FREE_NON_NULL (Event->ImageLoaded.ImageName);
+    EVENT_FREE_NON_NULL (Event->ImageLoaded.ParentImageName);
     break;
 
   case LOG_ENTRY_TYPE_IMAGE_EXISTS_ON_STARTUP:
-    SHELL_FREE_NON_NULL (Event->ImageExistsOnStartup.ImageName);
-    SHELL_FREE_NON_NULL (Event->ImageExistsOnStartup.ParentImageName);
+    EVENT_FREE_NON_NULL (Event->ImageExistsOnStartup.ImageName);
+    EVENT_FREE_NON_NULL (Event->ImageExistsOnStartup.ParentImageName);
     break;
 
   case LOG_ENTRY_TYPE_BDS_STAGE_ENTERED:
@@ -48,7 +118,7 @@ LoadingEvent_Destruct (
     break;
 
   case LOG_ENTRY_TYPE_ERROR:
-    SHELL_FREE_NON_NULL (Event->Error.Message);
+    EVENT_FREE_NON_NULL (Event->Error.Message);
     break;
 
   default:
@@ -58,3 +128,512 @@ LoadingEvent_Destruct (
 }
 
 // -----------------------------------------------------------------------------
+/**
+ * Задаёт арену, из которой выделяется память под строки событий.
+ * Пока арена задана, LoadingEvent_FreePool() память не возвращает (кроме последнего выделения),
+ * вся она освобождается владельцем арены разом.
+ *
+ * @param Arena                     Арена, либо NULL - снова выделять память через EFI_BOOT_SERVICES.
+ */
+VOID
+LoadingEvent_SetArena (
+  IN ARENA *Arena  OPTIONAL
+  )
+{
+  HASH_MAP InternedStrings;
+  HASH_MAP HandleNames;
+
+  // Таблицы создаются и освобождаются до и после поднятия TPL: на TPL_HIGH_LEVEL нельзя вызывать сервисы памяти.
+  ZeroMem (&InternedStrings, sizeof (InternedStrings));
+  ZeroMem (&HandleNames, sizeof (HandleNames));
+
+  if (Arena != NULL) {
+    Arena->NoGrow = TRUE;
+
+    if (EFI_ERROR (HashMap_Construct (&InternedStrings, HashMapKeyPointer, sizeof (INTERNED_STRING *), INTERNED_STRINGS_INITIAL_COUNT))) {
+      // Без таблицы пул не ведётся, LoadingEvent_InternString() просто копирует строки.
+      ZeroMem (&InternedStrings, sizeof (InternedStrings));
+    }
+    if (EFI_ERROR (HashMap_Construct (&HandleNames, HashMapKeyPointer, sizeof (HANDLE_NAME_CACHE_ENTRY), HANDLE_NAMES_INITIAL_COUNT))) {
+      // Без таблицы кэш не ведётся, имена хэндлов просто каждый раз получаются заново.
+      ZeroMem (&HandleNames, sizeof (HandleNames));
+    }
+    InternedStrings.NoGrow = TRUE;
+    HandleNames.NoGrow     = TRUE;
+  }
+
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  // Строки пула лежат в арене, поэтому пул живёт ровно столько же, сколько она.
+  // Прежние таблицы меняются местами с новыми и освобождаются ниже.
+  HASH_MAP Swap    = gInternedStrings;
+  gInternedStrings = InternedStrings;
+  InternedStrings  = Swap;
+
+  Swap            = gHandleNames;
+  gHandleNames    = HandleNames;
+  HandleNames     = Swap;
+
+  gHandleNamesDisabled = FALSE;
+  gEventArena          = Arena;
+  ZeroMem (&gStringPoolStats, sizeof (gStringPoolStats));
+  ZeroMem (&gHandleNameCacheStats, sizeof (gHandleNameCacheStats));
+
+  gBS->RestoreTPL (OldTpl);
+
+  HashMap_Destruct (&InternedStrings);
+  HashMap_Destruct (&HandleNames);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Пополняет запас, из которого арена и таблицы пула строк и кэша имён хэндлов
+ * обслуживают вызовы на TPL_HIGH_LEVEL: после успешного вызова из арены можно выделить
+ * хотя бы MinSize байт, а в таблицы вставить ещё несколько десятков элементов без выделения памяти.
+ * Вызывается заранее потребителем арены и самими функциями библиотеки, когда запас кончился.
+ * Вызывать на TPL не выше TPL_NOTIFY.
+ *
+ * @param MinSize                   Размер ближайшего выделения из арены, 0 - обычный запас.
+ *
+ * @retval EFI_SUCCESS              Запас пополнен, либо арена не задана.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память под запас арены.
+ */
+EFI_STATUS
+LoadingEvent_ReserveMemory (
+  IN UINTN MinSize
+  )
+{
+  EFI_STATUS Status = EFI_SUCCESS;
+
+  // Все, кто выделяет из запаса на TPL_HIGH_LEVEL, сами вызываются не выше TPL_NOTIFY,
+  // поэтому TPL_NOTIFY достаточно, чтобы они не застали запас наполовину пополненным.
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+
+  if (gEventArena != NULL) {
+    Status = Arena_Reserve (gEventArena, MAX (MinSize, EVENT_ARENA_RESERVE_SIZE));
+
+    if (gInternedStrings.Used != NULL) {
+      HashMap_Reserve (&gInternedStrings, HashMap_Size (&gInternedStrings) + INTERNED_STRINGS_RESERVE_COUNT);
+    }
+    if (HANDLE_NAMES_ENABLED ()) {
+      HashMap_Reserve (&gHandleNames, HashMap_Size (&gHandleNames) + HANDLE_NAMES_RESERVE_COUNT);
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Status;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Выделяет память под данные события: из арены, если она задана, иначе через EFI_BOOT_SERVICES.
+ * Можно вызывать на любом TPL.
+ *
+ * @retval NULL                     Не удалось выделить память.
+ * @return Указатель на выделенную память, освобождать через LoadingEvent_FreePool().
+ */
+VOID *
+LoadingEvent_AllocatePool (
+  IN UINTN Size
+  )
+{
+  VOID *Buffer = NULL;
+
+  if (gEventArena == NULL) {
+    if (EFI_ERROR (gBS->AllocatePool (EfiBootServicesData, Size, &Buffer))) {
+      return NULL;
+    }
+    return Buffer;
+  }
+
+  // Событие может прийти из перехваченного вызова на любом TPL, арена общая.
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  Buffer = Arena_Allocate (gEventArena, Size);
+  gBS->RestoreTPL (OldTpl);
+
+  // Запас арены кончился: пополняем его, если вызвавший код сам не выше TPL_NOTIFY.
+  if (Buffer == NULL && OldTpl <= TPL_NOTIFY && !EFI_ERROR (LoadingEvent_ReserveMemory (Size))) {
+    OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+    Buffer = Arena_Allocate (gEventArena, Size);
+    gBS->RestoreTPL (OldTpl);
+  }
+
+  return Buffer;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Меняет размер блока, выделенного LoadingEvent_AllocatePool().
+ * Последний выделенный из арены блок растёт на месте.
+ *
+ * @retval NULL                     Не удалось выделить память, блок Old не изменился.
+ * @return Указатель на блок нового размера, Old при этом больше использовать нельзя.
+ */
+VOID *
+LoadingEvent_ReallocatePool (
+  IN VOID  *Old     OPTIONAL,
+  IN UINTN OldSize,
+  IN UINTN NewSize
+  )
+{
+  VOID *New;
+
+  if (gEventArena == NULL) {
+    New = LoadingEvent_AllocatePool (NewSize);
+    if (New != NULL && Old != NULL) {
+      gBS->CopyMem (New, Old, MIN (OldSize, NewSize));
+      gBS->FreePool (Old);
+    }
+    return New;
+  }
+
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  New = Arena_Reallocate (gEventArena, Old, OldSize, NewSize);
+  gBS->RestoreTPL (OldTpl);
+
+  if (New == NULL && OldTpl <= TPL_NOTIFY && !EFI_ERROR (LoadingEvent_ReserveMemory (NewSize))) {
+    OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+    New    = Arena_Reallocate (gEventArena, Old, OldSize, NewSize);
+    gBS->RestoreTPL (OldTpl);
+  }
+
+  return New;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает блок, выделенный LoadingEvent_AllocatePool().
+ */
+VOID
+LoadingEvent_FreePool (
+  IN VOID *Buffer  OPTIONAL
+  )
+{
+  if (Buffer == NULL) {
+    return;
+  }
+
+  if (gEventArena == NULL) {
+    gBS->FreePool (Buffer);
+    return;
+  }
+
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  Arena_Free (gEventArena, Buffer);
+  gBS->RestoreTPL (OldTpl);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Хэш FNV-1a по символам строки.
+*/
+STATIC
+UINTN
+HashString (
+  IN CONST CHAR16 *Str,
+  IN UINTN        Length
+  )
+{
+  UINT64 Hash = FNV1A_OFFSET_BASIS;
+
+  for (UINTN Index = 0; Index < Length; ++Index) {
+    Hash ^= Str[Index];
+    Hash *= FNV1A_PRIME;
+  }
+
+  return (UINTN)Hash;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет строку в пуле и при необходимости добавляет её туда.
+ * Вызывается на TPL_HIGH_LEVEL, память у EFI_BOOT_SERVICES не берёт.
+ *
+ * @retval EFI_SUCCESS              В Result строка из пула, либо строка, не попавшая в пул.
+ * @retval EFI_OUT_OF_RESOURCES     Запас арены кончился, пул не изменился.
+*/
+STATIC
+EFI_STATUS
+InternStringLocked (
+  IN  CONST CHAR16 *Str,
+  IN  UINTN        Length,
+  OUT CHAR16       **Result
+  )
+{
+  UINTN           Size   = (Length + 1) * sizeof (CHAR16);
+  UINTN           Hash   = HashString (Str, Length);
+  INTERNED_STRING **Head = HashMap_Find (&gInternedStrings, &Hash);
+
+  for (INTERNED_STRING *Entry = (Head != NULL) ? *Head : NULL; Entry != NULL; Entry = Entry->Next) {
+    if (Entry->Length == Length && CompareMem (Entry->String, Str, Size) == 0) {
+      gStringPoolStats.ReferenceCount++;
+      gStringPoolStats.BytesSaved += Size;
+      *Result = Entry->String;
+      return EFI_SUCCESS;
+    }
+  }
+
+  // Указатель на строку смещён от начала выделения на заголовок,
+  // поэтому LoadingEvent_FreePool() не сможет вернуть её арене.
+  INTERNED_STRING *NewEntry = Arena_Allocate (gEventArena, OFFSET_OF (INTERNED_STRING, String) + Size);
+  if (NewEntry == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  gStringPoolStats.ReferenceCount++;
+  NewEntry->Length = Length;
+  gBS->CopyMem (NewEntry->String, (VOID *)Str, Size);
+  *Result = NewEntry->String;
+
+  if (Head != NULL) {
+    NewEntry->Next = *Head;
+    *Head          = NewEntry;
+  } else {
+    NewEntry->Next = NULL;
+    if (EFI_ERROR (HashMap_Insert (&gInternedStrings, &Hash, &NewEntry))) {
+      // Строка просто не попадёт в пул, но сама по себе остаётся валидной.
+      return EFI_SUCCESS;
+    }
+  }
+
+  gStringPoolStats.UniqueCount++;
+  gStringPoolStats.BytesStored += Size;
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает строку с тем же содержимым, что и Str, хранящуюся в пуле в единственном экземпляре.
+ * Повторные вызовы с одинаковыми строками возвращают один и тот же указатель и память не выделяют.
+ * Строка живёт до LoadingEvent_SetArena (NULL), изменять её нельзя.
+ * Передавать её в LoadingEvent_FreePool() можно, для строки из пула это ничего не делает.
+ * Если арена не задана, пул не ведётся и возвращается обычная копия.
+ * Можно вызывать на любом TPL.
+ *
+ * @retval NULL                     Str == NULL, либо не удалось выделить память.
+ * @return Указатель на строку из пула.
+ */
+CHAR16 *
+LoadingEvent_InternString (
+  IN CONST CHAR16 *Str
+  )
+{
+  if (Str == NULL) {
+    return NULL;
+  }
+
+  UINTN      Length = StrLen (Str);
+  UINTN      Size   = (Length + 1) * sizeof (CHAR16);
+  CHAR16     *Result;
+  EFI_STATUS Status;
+
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  if (gEventArena == NULL || gInternedStrings.Used == NULL) {
+    gBS->RestoreTPL (OldTpl);
+
+    Result = LoadingEvent_AllocatePool (Size);
+    if (Result != NULL) {
+      gBS->CopyMem (Result, (VOID *)Str, Size);
+    }
+    return Result;
+  }
+
+  Status = InternStringLocked (Str, Length, &Result);
+  gBS->RestoreTPL (OldTpl);
+
+  // Запас арены кончился: пополняем его, если вызвавший код сам не выше TPL_NOTIFY.
+  // Пока TPL был опущен, строку мог добавить кто-то другой, поэтому ищем её заново.
+  if (EFI_ERROR (Status)
+    && OldTpl <= TPL_NOTIFY
+    && !EFI_ERROR (LoadingEvent_ReserveMemory (OFFSET_OF (INTERNED_STRING, String) + Size))) {
+    OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+    Status = InternStringLocked (Str, Length, &Result);
+    gBS->RestoreTPL (OldTpl);
+  }
+
+  return EFI_ERROR (Status) ? NULL : Result;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает статистику пула интернированных строк.
+ */
+VOID
+LoadingEvent_GetStringPoolStats (
+  OUT LOADING_EVENT_STRING_POOL_STATS *Stats
+  )
+{
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  *Stats = gStringPoolStats;
+  gBS->RestoreTPL (OldTpl);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает поколение хэндла: сколько раз на нём менялись протоколы, от которых зависит его имя.
+ * Имя, полученное для хэндла в одном поколении, годится для всего этого поколения.
+ * Можно вызывать на любом TPL.
+ */
+UINTN
+LoadingEvent_GetHandleGeneration (
+  IN EFI_HANDLE Handle
+  )
+{
+  UINTN   Generation = 0;
+  EFI_TPL OldTpl     = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  if (HANDLE_NAMES_ENABLED ()) {
+    HANDLE_NAME_CACHE_ENTRY *Entry = HashMap_Find (&gHandleNames, &Handle);
+    if (Entry != NULL) {
+      Generation = Entry->Generation;
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Generation;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет в кэше имя хэндла Handle, полученное в поколении Generation.
+ * Кэш ведётся, пока задана арена: имена лежат в пуле строк.
+ * Можно вызывать на любом TPL.
+ *
+ * @retval NULL                     Имени в кэше нет, либо оно устарело.
+ * @return Строка из пула строк событий, изменять её нельзя.
+ */
+CHAR16 *
+LoadingEvent_FindHandleName (
+  IN EFI_HANDLE Handle,
+  IN UINTN      Generation
+  )
+{
+  CHAR16  *Name  = NULL;
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  if (HANDLE_NAMES_ENABLED ()) {
+    HANDLE_NAME_CACHE_ENTRY *Entry = HashMap_Find (&gHandleNames, &Handle);
+    if (Entry != NULL && Entry->Generation == Generation) {
+      Name = Entry->Name;
+    }
+
+    if (Name != NULL) {
+      gHandleNameCacheStats.Hits++;
+    } else {
+      gHandleNameCacheStats.Misses++;
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Name;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Запоминает имя хэндла Handle, полученное в поколении Generation.
+ * Если поколение хэндла с тех пор сменилось, имя не запоминается.
+ * Можно вызывать на любом TPL.
+ *
+ * @param Name                      Строка из пула строк событий (LoadingEvent_InternString()).
+ */
+VOID
+LoadingEvent_CacheHandleName (
+  IN EFI_HANDLE Handle,
+  IN UINTN      Generation,
+  IN CHAR16     *Name
+  )
+{
+  if (Name == NULL) {
+    return;
+  }
+
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  if (HANDLE_NAMES_ENABLED ()) {
+    HANDLE_NAME_CACHE_ENTRY *Entry = HashMap_Find (&gHandleNames, &Handle);
+    if (Entry != NULL) {
+      if (Entry->Generation == Generation) {
+        Entry->Name = Name;
+      }
+    } else if (Generation == 0) {
+      HANDLE_NAME_CACHE_ENTRY NewEntry = { 0, Name };
+      HashMap_Insert (&gHandleNames, &Handle, &NewEntry);
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Начинает новое поколение хэндла, закэшированное имя при этом забывается.
+ * Вызывается, когда на хэндле устанавливается, переустанавливается или удаляется протокол,
+ * от которого зависит имя хэндла.
+ * Можно вызывать на любом TPL.
+ */
+VOID
+LoadingEvent_InvalidateHandleName (
+  IN EFI_HANDLE Handle
+  )
+{
+  HANDLE_NAME_CACHE_ENTRY NewEntry = { 1, NULL };
+  EFI_STATUS              Status   = EFI_SUCCESS;
+  EFI_TPL                 OldTpl   = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  if (HANDLE_NAMES_ENABLED ()) {
+    gHandleNameCacheStats.Invalidations++;
+
+    HANDLE_NAME_CACHE_ENTRY *Entry = HashMap_Find (&gHandleNames, &Handle);
+    if (Entry != NULL) {
+      Entry->Generation++;
+      Entry->Name = NULL;
+    } else {
+      // Хэндл ещё не встречался, но снимки в поколении 0 уже могли быть сделаны.
+      Status = HashMap_Insert (&gHandleNames, &Handle, &NewEntry);
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+
+  if (!EFI_ERROR (Status)) {
+    return;
+  }
+
+  // Таблица заполнена: пополняем запас, если вызвавший код сам не выше TPL_NOTIFY,
+  // и вставляем ещё раз. Пока TPL был опущен, хэндл мог вставить кто-то другой.
+  if (OldTpl <= TPL_NOTIFY) {
+    LoadingEvent_ReserveMemory (0);
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  if (HANDLE_NAMES_ENABLED ()) {
+    HANDLE_NAME_CACHE_ENTRY *Entry = HashMap_Find (&gHandleNames, &Handle);
+    if (Entry != NULL) {
+      Entry->Generation++;
+      Entry->Name = NULL;
+    } else if (EFI_ERROR (HashMap_Insert (&gHandleNames, &Handle, &NewEntry))) {
+      // Поколение не удалось запомнить, и отличить старые снимки от новых нельзя: кэш больше не ведём.
+      gHandleNamesDisabled = TRUE;
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает статистику кэша имён хэндлов.
+ */
+VOID
+LoadingEvent_GetHandleNameCacheStats (
+  OUT LOADING_EVENT_HANDLE_NAME_CACHE_STATS *Stats
+  )
+{
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  *Stats = gHandleNameCacheStats;
+  gBS->RestoreTPL (OldTpl);
+}
+
+// -----------------------------------------------------------------------------
\ No newline at end of file
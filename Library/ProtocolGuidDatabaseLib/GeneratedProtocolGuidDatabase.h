@@ -1,11033 +1,4282 @@
+// Vendors: EDK2,AMI,ASROCK,DELL,LENOVO, DXE only: TRUE
 #include <Uefi.h>
 
-static EFI_GUID my_gAppPkgTokenSpaceGuid = {
-  0xe7e1efa6, 0x7607, 0x4a78, { 0xa7, 0xdd, 0x43, 0xe4, 0xbd, 0x72, 0xc0, 0x99 }
-};
-
-static EFI_GUID my_gArmTokenSpaceGuid = {
-  0xbb11ecfe, 0x820f, 0x4968, { 0xbb, 0xa6, 0xf7, 0x6a, 0xfe, 0x30, 0x25, 0x96 }
-};
-
-static EFI_GUID my_gArmMpCoreInfoGuid = {
-  0xa4ee0728, 0xe5d7, 0x4ac5, { 0xb2, 0x1e, 0x65, 0x8e, 0xd8, 0x57, 0xe8, 0x34 }
-};
-
-static EFI_GUID my_gArmMpCoreInfoPpiGuid = {
-  0x6847cc74, 0xe9ec, 0x4f8f, { 0xa2, 0x9d, 0xab, 0x44, 0xe7, 0x54, 0xa8, 0xfc }
-};
-
-static EFI_GUID my_gArmPlatformTokenSpaceGuid = {
-  0x9c0aaed4, 0x74c5, 0x4043, { 0xb4, 0x17, 0xa3, 0x22, 0x38, 0x14, 0xce, 0x76 }
-};
-
-static EFI_GUID my_gVariableRuntimeDxeFileGuid = {
-  0xcbd2e4d5, 0x7068, 0x4ff5, { 0xb4, 0x62, 0x98, 0x22, 0xb4, 0xad, 0x8d, 0x60 }
-};
-
-static EFI_GUID my_gArmVirtTokenSpaceGuid = {
-  0xb6f5ca7, 0x4f53, 0x445a, { 0xb7, 0x6e, 0x2e, 0x36, 0x5b, 0x80, 0x63, 0x66 }
-};
-
-static EFI_GUID my_gEarlyPL011BaseAddressGuid = {
-  0xb199dea9, 0xfd5c, 0x4a84, { 0x80, 0x82, 0x2f, 0x41, 0x70, 0x78, 0x3, 0x5 }
-};
-
-static EFI_GUID my_gArmVirtVariableGuid = {
-  0x50bea1e5, 0xa2c5, 0x46e9, { 0x9b, 0x3a, 0x59, 0x59, 0x65, 0x16, 0xb0, 0xa }
-};
-
-static EFI_GUID my_gFdtClientProtocolGuid = {
-  0xe11faca0, 0x4710, 0x4c8e, { 0xa7, 0xa2, 0x1, 0xba, 0xa2, 0x59, 0x1b, 0x4c }
-};
-
-static EFI_GUID my_gBeagleBoardTokenSpaceGuid = {
-  0x6834fe45, 0x4aee, 0x4fc6, { 0xbc, 0xb5, 0xff, 0x45, 0xb7, 0xa8, 0x71, 0xe2 }
-};
-
-static EFI_GUID my_gUefiCorebootModulePkgTokenSpaceGuid = {
-  0xe6ff49a0, 0x15df, 0x48fd, { 0x9a, 0xcf, 0xd7, 0xdc, 0x27, 0x1b, 0x39, 0xd5 }
-};
-
-static EFI_GUID my_gUefiSystemTableInfoGuid = {
-  0x16c8a6d0, 0xfe8a, 0x4082, { 0xa2, 0x8, 0xcf, 0x89, 0xc4, 0x29, 0x4, 0x33 }
-};
-
-static EFI_GUID my_gUefiFrameBufferInfoGuid = {
-  0xdc2cd8bd, 0x402c, 0x4dc4, { 0x9b, 0xe0, 0xc, 0x43, 0x2b, 0x7, 0xfa, 0x34 }
-};
-
-static EFI_GUID my_gUefiAcpiBoardInfoGuid = {
-  0xad3d31b, 0xb3d8, 0x4506, { 0xae, 0x71, 0x2e, 0xf1, 0x10, 0x6, 0xd9, 0xf }
-};
-
-static EFI_GUID my_gUEfiCorebootPayloadPkgTokenSpaceGuid = {
-  0x1d127ea, 0xf6f1, 0x4ef6, { 0x94, 0x15, 0x8a, 0x0, 0x0, 0x93, 0xf8, 0x9d }
-};
-
-static EFI_GUID my_gBmpImageGuid = {
-  0x878ac2cc, 0x5343, 0x46f2, { 0xb5, 0x63, 0x51, 0xf8, 0x9d, 0xaf, 0x56, 0xba }
-};
-
-static EFI_GUID my_gPlatformGOPPolicyGuid = {
-  0xec2e931b, 0x3281, 0x48a5, { 0x81, 0x7, 0xdf, 0x8a, 0x8b, 0xed, 0x3c, 0x5d }
-};
-
-static EFI_GUID my_gEfiRuntimeCryptProtocolGuid = {
-  0xe1475e0c, 0x1746, 0x4802, { 0x86, 0x2e, 0x1, 0x1c, 0x2c, 0x2d, 0x9d, 0x86 }
-};
-
-static EFI_GUID my_gEfiPciExpressBaseAddressGuid = {
-  0x3677d529, 0x326f, 0x4603, { 0xa9, 0x26, 0xea, 0xac, 0xe0, 0x1d, 0xcb, 0xb0 }
-};
-
-static EFI_GUID my_gEfiAcpiDescriptionGuid = {
-  0x3c699197, 0x93c, 0x4c69, { 0xb0, 0x6b, 0x12, 0x8a, 0xe3, 0x48, 0x1d, 0xc9 }
-};
-
-static EFI_GUID my_gEfiFlashMapHobGuid = {
-  0xb091e7d2, 0x5a0, 0x4198, { 0x94, 0xf0, 0x74, 0xb7, 0xb8, 0xc5, 0x54, 0x59 }
-};
-
-static EFI_GUID my_gEfiPciOptionRomTableGuid = {
-  0x7462660f, 0x1cbd, 0x48da, { 0xad, 0x11, 0x91, 0x71, 0x79, 0x13, 0x83, 0x1c }
-};
-
-static EFI_GUID my_gDuetConsoleOutConfigGuid = {
-  0xed150714, 0xdf30, 0x407d, { 0xb2, 0x4a, 0x4b, 0x74, 0x2f, 0xd5, 0xce, 0xa2 }
-};
-
-static EFI_GUID my_gDxeCoreFileNameGuid = {
-  0xd6a2cb7f, 0x6a18, 0x4e2f, { 0xb4, 0x3b, 0x99, 0x20, 0xa7, 0x33, 0x70, 0xa }
-};
-
-static EFI_GUID my_gLdrMemoryDescriptorGuid = {
-  0x7701d7e5, 0x7d1d, 0x4432, { 0xa4, 0x68, 0x67, 0x3d, 0xab, 0x8a, 0xde, 0x60 }
-};
-
-static EFI_GUID my_gEfiSmmBaseThunkCommunicationGuid = {
-  0x6568a3d6, 0x15f, 0x4b4a, { 0x9c, 0x89, 0x1d, 0x14, 0x63, 0x14, 0x13, 0xa }
-};
-
-static EFI_GUID my_gEfiBootStateGuid = {
-  0x60b5e939, 0xfcf, 0x4227, { 0xba, 0x83, 0x6b, 0xbe, 0xd4, 0x5b, 0xc0, 0xe3 }
-};
-
-static EFI_GUID my_gEfiEdkCompatibilityPkgTokenSpaceGuid = {
-  0x2354d320, 0x3eb3, 0x4c81, { 0x99, 0xf4, 0xcc, 0x4a, 0xe1, 0x43, 0x46, 0x3e }
-};
-
-static EFI_GUID my_gFrameworkBdsFrontPageFormsetGuid = {
-  0x9e0c30bc, 0x3f06, 0x4ba6, { 0x82, 0x88, 0x9, 0x17, 0x9b, 0x85, 0x5d, 0xbe }
-};
-
-static EFI_GUID my_gEcpPeiPciCfgPpiGuid = {
-  0xb0ee53d4, 0xa049, 0x4a79, { 0xb2, 0xff, 0x19, 0xd9, 0xfa, 0xef, 0xaa, 0x94 }
-};
-
-static EFI_GUID my_gEfiPrintProtocolGuid = {
-  0xdf2d868e, 0x32fc, 0x4cf0, { 0x8e, 0x6b, 0xff, 0xd9, 0x5d, 0x13, 0x43, 0xd0 }
-};
-
-static EFI_GUID my_gEfiSmmBaseHelperReadyProtocolGuid = {
-  0x910dca07, 0x1f94, 0x4ee7, { 0xaf, 0x2f, 0xff, 0x72, 0xf3, 0x15, 0x43, 0x53 }
-};
-
-static EFI_GUID my_gEmbeddedTokenSpaceGuid = {
-  0xe0d8ca17, 0x4276, 0x4386, { 0xbb, 0x79, 0x48, 0xcb, 0x81, 0x3d, 0x3c, 0x4f }
-};
-
-static EFI_GUID my_gFdtTableGuid = {
-  0xb1b621d5, 0xf19c, 0x41a5, { 0x83, 0xb, 0xd9, 0x15, 0x2c, 0x69, 0xaa, 0xe0 }
-};
-
-static EFI_GUID my_gFdtHobGuid = {
-  0x16958446, 0x19b7, 0x480b, { 0xb0, 0x47, 0x74, 0x85, 0xad, 0x3f, 0x71, 0x6d }
-};
-
-static EFI_GUID my_gFdtVariableGuid = {
-  0x25a4fd4a, 0x9703, 0x4ba9, { 0xa1, 0x90, 0xb7, 0xc8, 0x4e, 0xfb, 0x3e, 0x57 }
-};
-
-static EFI_GUID my_gEdkiiPlatformHasDeviceTreeGuid = {
-  0x7ebb920d, 0x1aaf, 0x46d9, { 0xb2, 0xaf, 0x54, 0x1e, 0x1d, 0xce, 0x14, 0x8b }
-};
-
-static EFI_GUID my_gDtPlatformFormSetGuid = {
-  0x2b7a240d, 0xd5ad, 0x4fd6, { 0xbe, 0x1c, 0xdf, 0xa4, 0x41, 0x5f, 0x55, 0x26 }
-};
-
-static EFI_GUID my_gDtPlatformDefaultDtbFileGuid = {
-  0x25462cda, 0x221f, 0x47df, { 0xac, 0x1d, 0x25, 0x9c, 0xfa, 0xa4, 0xe3, 0x26 }
-};
-
-static EFI_GUID my_gConsolePrefFormSetGuid = {
-  0x2d2358b4, 0xe96c, 0x484d, { 0xb2, 0xdd, 0x7c, 0x2e, 0xdf, 0xc7, 0xd5, 0x6f }
-};
-
-static EFI_GUID my_gHardwareInterruptProtocolGuid = {
-  0x2890b3ea, 0x53d, 0x1643, { 0xad, 0xc, 0xd6, 0x48, 0x8, 0xda, 0x3f, 0xf1 }
-};
-
-static EFI_GUID my_gHardwareInterrupt2ProtocolGuid = {
-  0x32898322, 0x2da1, 0x474a, { 0xba, 0xaa, 0xf3, 0xf7, 0xcf, 0x56, 0x94, 0x70 }
-};
-
-static EFI_GUID my_gEfiDebugSupportPeriodicCallbackProtocolGuid = {
-  0x9546e07c, 0x2cbb, 0x4c88, { 0x98, 0x6c, 0xcd, 0x34, 0x10, 0x86, 0xf0, 0x44 }
-};
-
-static EFI_GUID my_gEmbeddedDeviceGuid = {
-  0xbf4b9d10, 0x13ec, 0x43dd, { 0x88, 0x80, 0xe9, 0xb, 0x71, 0x8f, 0x27, 0xde }
-};
-
-static EFI_GUID my_gEmbeddedExternalDeviceProtocolGuid = {
-  0x735f8c64, 0xd696, 0x44d0, { 0xbd, 0xf2, 0x44, 0x7f, 0xd0, 0x5a, 0x54, 0x6 }
-};
-
-static EFI_GUID my_gEmbeddedGpioProtocolGuid = {
-  0x17a0a3d7, 0xc0a5, 0x4635, { 0xbb, 0xd5, 0x7, 0x21, 0x87, 0xdf, 0xe2, 0xee }
-};
-
-static EFI_GUID my_gPeCoffLoaderProtocolGuid = {
-  0xb323179b, 0x97fb, 0x477e, { 0xb0, 0xfe, 0xd8, 0x85, 0x91, 0xfa, 0x11, 0xab }
-};
-
-static EFI_GUID my_gEfiMmcHostProtocolGuid = {
-  0x3e591c00, 0x9e4a, 0x11df, { 0x92, 0x44, 0x0, 0x2, 0xa5, 0xd5, 0xc5, 0x1b }
-};
-
-static EFI_GUID my_gAndroidFastbootTransportProtocolGuid = {
-  0x74bd9fe0, 0x8902, 0x11e3, { 0xb9, 0xd3, 0xf7, 0x22, 0x38, 0xfc, 0x9a, 0x31 }
-};
-
-static EFI_GUID my_gAndroidFastbootPlatformProtocolGuid = {
-  0x524685a0, 0x89a0, 0x11e3, { 0x9d, 0x4d, 0xbf, 0xa9, 0xf6, 0xa4, 0x3, 0x8 }
-};
-
-static EFI_GUID my_gUsbDeviceProtocolGuid = {
-  0x21bd2ca, 0x51d2, 0x11e3, { 0x8e, 0x56, 0xb7, 0x54, 0x17, 0xc7, 0xb, 0x44 }
-};
-
-static EFI_GUID my_gPlatformGpioProtocolGuid = {
-  0x52ce9845, 0x5af4, 0x43e2, { 0xba, 0xfd, 0x23, 0x8, 0x12, 0x54, 0x7a, 0xc2 }
-};
-
-static EFI_GUID my_gAndroidBootImgProtocolGuid = {
-  0x9859bb19, 0x407c, 0x4f8b, { 0xbc, 0xe1, 0xf8, 0xda, 0x65, 0x65, 0xf4, 0xa5 }
-};
-
-static EFI_GUID my_gEdkiiEmbeddedGpioPpiGuid = {
-  0x21c3b115, 0x4e0b, 0x470c, { 0x85, 0xc7, 0xe1, 0x5, 0xa5, 0x75, 0xc9, 0x7b }
-};
-
-static EFI_GUID my_gEmuThunkProtocolGuid = {
-  0x5cf32e0b, 0x8edf, 0x2e44, { 0x9c, 0xda, 0x93, 0x20, 0x5e, 0x99, 0xec, 0x1c }
-};
-
-static EFI_GUID my_gEmuIoThunkProtocolGuid = {
-  0x453368f6, 0x7c85, 0x434a, { 0xa9, 0x8a, 0x72, 0xd1, 0xb7, 0xff, 0xa9, 0x26 }
-};
-
-static EFI_GUID my_gEmuGraphicsWindowProtocolGuid = {
-  0x30fd316a, 0x6728, 0x2e41, { 0xa6, 0x90, 0xd, 0x13, 0x33, 0xd8, 0xca, 0xc1 }
-};
-
-static EFI_GUID my_gEmuThreadThunkProtocolGuid = {
-  0x3b1e4b7c, 0x9d8, 0x944f, { 0xa4, 0x8, 0x13, 0x9, 0xeb, 0x8b, 0x44, 0x27 }
-};
-
-static EFI_GUID my_gEmuBlockIoProtocolGuid = {
-  0x6888a4ae, 0xafce, 0xe84b, { 0x91, 0x2, 0xf7, 0xb9, 0xda, 0xe6, 0xa0, 0x30 }
-};
-
-static EFI_GUID my_gEmuSnpProtocolGuid = {
-  0xfd5fbe54, 0x8c35, 0xb345, { 0x8a, 0xf, 0x7a, 0xc8, 0xa5, 0xfd, 0x5, 0x21 }
-};
-
-static EFI_GUID my_gEmuThunkPpiGuid = {
-  0xe113f896, 0x75cf, 0xf640, { 0x81, 0x7f, 0xc8, 0x5a, 0x79, 0xe8, 0xae, 0x67 }
-};
-
-static EFI_GUID my_gEmulatorPkgTokenSpaceGuid = {
-  0x4f792e68, 0xe8c8, 0x794e, { 0xb1, 0xd8, 0x37, 0x3, 0xf3, 0xf2, 0xd5, 0xa5 }
-};
-
-static EFI_GUID my_gEmuSystemConfigGuid = {
-  0xf8626165, 0x6ceb, 0x924a, { 0xba, 0xfc, 0xf1, 0x3a, 0xb9, 0xd6, 0x57, 0x28 }
-};
-
-static EFI_GUID my_gEmuVirtualDisksGuid = {
-  0xf2ba331a, 0x8985, 0x11db, { 0xa4, 0x6, 0x0, 0x40, 0xd0, 0x2b, 0x18, 0x35 }
-};
-
-static EFI_GUID my_gEmuPhysicalDisksGuid = {
-  0xf2bdcc96, 0x8985, 0x11db, { 0x87, 0x19, 0x0, 0x40, 0xd0, 0x2b, 0x18, 0x35 }
-};
-
-static EFI_GUID my_gFmpDevicePkgTokenSpaceGuid = {
-  0x40b2d964, 0xfe11, 0x40dc, { 0x82, 0x83, 0x2e, 0xfb, 0xda, 0x29, 0x53, 0x56 }
-};
-
-static EFI_GUID my_gEfiIntelFrameworkModulePkgTokenSpaceGuid = {
-  0xd3705011, 0xbc19, 0x4af7, { 0xbe, 0x16, 0xf6, 0x80, 0x30, 0x37, 0x8c, 0x15 }
-};
-
-static EFI_GUID my_gEfiDataHubStatusCodeRecordGuid = {
-  0xd083e94c, 0x6560, 0x42e4, { 0xb6, 0xd4, 0x2d, 0xf7, 0x5a, 0xdf, 0x6a, 0x2a }
-};
-
-static EFI_GUID my_gTianoCustomDecompressGuid = {
-  0xa31280ad, 0x481e, 0x41b6, { 0x95, 0xe8, 0x12, 0x7f, 0x4c, 0x98, 0x47, 0x79 }
-};
-
-static EFI_GUID my_gEfiAcpiVariableCompatiblityGuid = {
-  0xc020489e, 0x6db2, 0x4ef2, { 0x9a, 0xa5, 0xca, 0x6, 0xfc, 0x11, 0xd3, 0x6a }
-};
-
-static EFI_GUID my_gEfiLegacyBiosGuid = {
-  0x2e3044ac, 0x879f, 0x490f, { 0x97, 0x60, 0xbb, 0xdf, 0xaf, 0x69, 0x5f, 0x50 }
-};
-
-static EFI_GUID my_gEfiLegacyDevOrderVariableGuid = {
-  0xa56074db, 0x65fe, 0x45f7, { 0xbd, 0x21, 0x2d, 0x2b, 0xdd, 0x8e, 0x96, 0x52 }
-};
-
-static EFI_GUID my_gEfiUpdateDataFileGuid = {
-  0x283fa2ee, 0x532c, 0x484d, { 0x93, 0x83, 0x9f, 0x93, 0xb3, 0x6f, 0xb, 0x7e }
-};
-
-static EFI_GUID my_gBlockIoVendorGuid = {
-  0xcf31fac5, 0xc24e, 0x11d2, { 0x85, 0xf3, 0x0, 0xa0, 0xc9, 0x3e, 0xc9, 0x3b }
-};
-
-static EFI_GUID my_gBootManagerFormSetGuid = {
-  0x847bc3fe, 0xb974, 0x446d, { 0x94, 0x49, 0x5a, 0xd5, 0x41, 0x2e, 0x99, 0x3b }
-};
-
-static EFI_GUID my_gDeviceManagerFormSetGuid = {
-  0x3ebfa8e6, 0x511d, 0x4b5b, { 0xa9, 0x5f, 0xfb, 0x38, 0x26, 0xf, 0x1c, 0x27 }
-};
-
-static EFI_GUID my_gDriverHealthFormSetGuid = {
-  0xf76e0a70, 0xb5ed, 0x4c38, { 0xac, 0x9a, 0xe5, 0xf5, 0x4b, 0xf1, 0x6e, 0x34 }
-};
-
-static EFI_GUID my_gBootMaintFormSetGuid = {
-  0x642237c7, 0x35d4, 0x472d, { 0x83, 0x65, 0x12, 0xe0, 0xcc, 0xf2, 0x7a, 0x22 }
-};
-
-static EFI_GUID my_gFileExploreFormSetGuid = {
-  0x1f2d63e1, 0xfebd, 0x4dc7, { 0x9c, 0xc5, 0xba, 0x2b, 0x1c, 0xef, 0x9c, 0x5b }
-};
-
-static EFI_GUID my_gBdsLibStringPackageGuid = {
-  0x3b4d9b23, 0x95ac, 0x44f6, { 0x9f, 0xcd, 0xe, 0x95, 0x94, 0x58, 0x6c, 0x72 }
-};
-
-static EFI_GUID my_gLastEnumLangGuid = {
-  0xe8c545b, 0xa2ee, 0x470d, { 0x8e, 0x26, 0xbd, 0xa1, 0xa1, 0x3c, 0xa, 0xa3 }
-};
-
-static EFI_GUID my_gHdBootDevicePathVariablGuid = {
-  0xfab7e9e1, 0x39dd, 0x4f2b, { 0x84, 0x8, 0xe2, 0xe, 0x90, 0x6c, 0xb6, 0xde }
-};
-
-static EFI_GUID my_gEfiVgaMiniPortProtocolGuid = {
-  0xc7735a2f, 0x88f5, 0x4882, { 0xae, 0x63, 0xfa, 0xac, 0x8c, 0x8b, 0x86, 0xb3 }
-};
-
-static EFI_GUID my_gEfiIsaIoProtocolGuid = {
-  0x7ee2bd44, 0x3da0, 0x11d4, { 0x9a, 0x38, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiIsaAcpiProtocolGuid = {
-  0x64a892dc, 0x5561, 0x4536, { 0x92, 0xc7, 0x79, 0x9b, 0xfc, 0x18, 0x33, 0x55 }
-};
-
-static EFI_GUID my_gEfiOEMBadgingProtocolGuid = {
-  0x170e13c0, 0xbf1b, 0x4218, { 0x87, 0x1d, 0x2a, 0xbd, 0xc6, 0xf8, 0x87, 0xbc }
-};
-
-static EFI_GUID my_gExitPmAuthProtocolGuid = {
-  0xd088a413, 0xa70, 0x4217, { 0xba, 0x55, 0x9a, 0x3c, 0xb6, 0x5c, 0x41, 0xb3 }
-};
-
-static EFI_GUID my_gEfiCacheSubClassGuid = {
-  0x7f0013a7, 0xdc79, 0x4b22, { 0x80, 0x99, 0x11, 0xf7, 0x5f, 0xdc, 0x82, 0x9d }
-};
-
-static EFI_GUID my_gEfiMemorySubClassGuid = {
-  0x4e8f4ebb, 0x64b9, 0x4e05, { 0x9b, 0x18, 0x4c, 0xfe, 0x49, 0x23, 0x50, 0x97 }
-};
-
-static EFI_GUID my_gEfiMiscSubClassGuid = {
-  0x772484b2, 0x7482, 0x4b91, { 0x9f, 0x9a, 0xad, 0x43, 0xf8, 0x1c, 0x58, 0x81 }
-};
-
-static EFI_GUID my_gEfiProcessorSubClassGuid = {
-  0x26fdeb7e, 0xb8af, 0x4ccf, { 0xaa, 0x97, 0x2, 0x63, 0x3c, 0xe4, 0x8c, 0xa7 }
-};
-
-static EFI_GUID my_gEfiCapsuleGuid = {
-  0x3b6686bd, 0xd76, 0x4030, { 0xb7, 0xe, 0xb5, 0x51, 0x9e, 0x2f, 0xc5, 0xa0 }
-};
-
-static EFI_GUID my_gEfiConfigFileNameGuid = {
-  0x98b8d59b, 0xe8ba, 0x48ee, { 0x98, 0xdd, 0xc2, 0x95, 0x39, 0x2f, 0x1e, 0xdb }
-};
-
-static EFI_GUID my_gEfiSmmPeiSmramMemoryReserveGuid = {
-  0x6dadf1d1, 0xd4cc, 0x4910, { 0xbb, 0x6e, 0x82, 0xb1, 0xfd, 0x80, 0xff, 0x3d }
-};
-
-static EFI_GUID my_gSmmCommunicateHeaderGuid = {
-  0xf328e36c, 0x23b6, 0x4a95, { 0x85, 0x4b, 0x32, 0xe1, 0x95, 0x34, 0xcd, 0x75 }
-};
-
-static EFI_GUID my_gEfiFirmwareFileSystemGuid = {
-  0x7a9354d9, 0x468, 0x444a, { 0x81, 0xce, 0xb, 0xf6, 0x17, 0xd8, 0x90, 0xdf }
-};
-
-static EFI_GUID my_gEfiPeiIdeBlockIoPpiGuid = {
-  0x964e5b22, 0x6459, 0x11d2, { 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiPei144FloppyBlockIoPpiGuid = {
-  0xda6855bd, 0x7b7, 0x4c05, { 0x9e, 0xd8, 0xe2, 0x59, 0xfd, 0x36, 0xe, 0x22 }
-};
-
-static EFI_GUID my_gEfiPeiBootScriptExecuterPpiGuid = {
-  0xabd42895, 0x78cf, 0x4872, { 0x84, 0x44, 0x1b, 0x5c, 0x18, 0xb, 0xfb, 0xff }
-};
-
-static EFI_GUID my_gEfiPeiSecurityPpiGuid = {
-  0x1388066e, 0x3a57, 0x4efa, { 0x98, 0xf3, 0xc1, 0x2f, 0x3a, 0x95, 0x8a, 0x29 }
-};
-
-static EFI_GUID my_gEfiPeiSmbusPpiGuid = {
-  0xabd42895, 0x78cf, 0x4872, { 0x84, 0x44, 0x1b, 0x5c, 0x18, 0xb, 0xfb, 0xda }
-};
-
-static EFI_GUID my_gEfiPciCfgPpiInServiceTableGuid = {
-  0xe1f2eba0, 0xf7b9, 0x4a26, { 0x86, 0x20, 0x13, 0x12, 0x21, 0x64, 0x2a, 0x90 }
-};
-
-static EFI_GUID my_gEfiPeiReadOnlyVariablePpiGuid = {
-  0x3cdc90c6, 0x13fb, 0x4a75, { 0x9e, 0x79, 0x59, 0xe9, 0xdd, 0x78, 0xb9, 0xfa }
-};
-
-static EFI_GUID my_gEfiPeiSectionExtractionPpiGuid = {
-  0x4f89e208, 0xe144, 0x4804, { 0x9e, 0xc8, 0xf, 0x89, 0x4f, 0x7e, 0x36, 0xd7 }
-};
-
-static EFI_GUID my_gEfiPeiFvFileLoaderPpiGuid = {
-  0x7e1f0d85, 0x4ff, 0x4bb2, { 0x86, 0x6a, 0x31, 0xa2, 0x99, 0x6a, 0x48, 0xa8 }
-};
-
-static EFI_GUID my_gEfiFindFvPpiGuid = {
-  0x36164812, 0xa023, 0x44e5, { 0xbd, 0x85, 0x5, 0xbf, 0x3c, 0x77, 0x0, 0xaa }
-};
-
-static EFI_GUID my_gEfiPeiS3ResumePpiGuid = {
-  0x4426ccb2, 0xe684, 0x4a8a, { 0xae, 0x40, 0x20, 0xd4, 0xb0, 0x25, 0xb7, 0x10 }
-};
-
-static EFI_GUID my_gEfiAcpiS3SaveProtocolGuid = {
-  0x125f2de1, 0xfb85, 0x440c, { 0xa5, 0x4c, 0x4d, 0x99, 0x35, 0x8a, 0x8d, 0x38 }
-};
-
-static EFI_GUID my_gEfiAcpiSupportProtocolGuid = {
-  0xdbff9d55, 0x89b7, 0x46da, { 0xbd, 0xdf, 0x67, 0x7d, 0x3d, 0xc0, 0x24, 0x1d }
-};
-
-static EFI_GUID my_gEfiBootScriptSaveProtocolGuid = {
-  0x470e1529, 0xb79e, 0x4e32, { 0xa0, 0xfe, 0x6a, 0x15, 0x6d, 0x29, 0xf9, 0xb2 }
-};
-
-static EFI_GUID my_gEfiLegacyBiosProtocolGuid = {
-  0xdb9a1e3d, 0x45cb, 0x4abb, { 0x85, 0x3b, 0xe5, 0x38, 0x7f, 0xdb, 0x2e, 0x2d }
-};
-
-static EFI_GUID my_gEfiLegacyBiosPlatformProtocolGuid = {
-  0x783658a3, 0x4172, 0x4421, { 0xa2, 0x99, 0xe0, 0x9, 0x7, 0x9c, 0xc, 0xb4 }
-};
-
-static EFI_GUID my_gEfiLegacyInterruptProtocolGuid = {
-  0x31ce593d, 0x108a, 0x485d, { 0xad, 0xb2, 0x78, 0xf2, 0x1f, 0x29, 0x66, 0xbe }
-};
-
-static EFI_GUID my_gEfiLegacyRegionProtocolGuid = {
-  0xfc9013a, 0x568, 0x4ba9, { 0x9b, 0x7e, 0xc9, 0xc3, 0x90, 0xa6, 0x60, 0x9b }
-};
-
-static EFI_GUID my_gEfiLegacy8259ProtocolGuid = {
-  0x38321dba, 0x4fe0, 0x4e17, { 0x8a, 0xec, 0x41, 0x30, 0x55, 0xea, 0xed, 0xc1 }
-};
-
-static EFI_GUID my_gEfiCpuIoProtocolGuid = {
-  0xb0732526, 0x38c8, 0x4b40, { 0x88, 0x77, 0x61, 0xc7, 0xb0, 0x6a, 0xac, 0x45 }
-};
-
-static EFI_GUID my_gEfiDataHubProtocolGuid = {
-  0xae80d021, 0x618e, 0x11d4, { 0xbc, 0xd7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiFirmwareVolumeProtocolGuid = {
-  0x389f751f, 0x1838, 0x4388, { 0x83, 0x90, 0xcd, 0x81, 0x54, 0xbd, 0x27, 0xf8 }
-};
-
-static EFI_GUID my_gEfiSectionExtractionProtocolGuid = {
-  0x448f5da4, 0x6dd7, 0x4fe1, { 0x93, 0x7, 0x69, 0x22, 0x41, 0x92, 0x21, 0x5d }
-};
-
-static EFI_GUID my_gEfiHiiProtocolGuid = {
-  0xd7ad636e, 0xb997, 0x459b, { 0xbf, 0x3f, 0x88, 0x46, 0x89, 0x79, 0x80, 0xe1 }
-};
-
-static EFI_GUID my_gEfiHiiCompatibilityProtocolGuid = {
-  0x5542cce1, 0xdf5c, 0x4d1b, { 0xab, 0xca, 0x36, 0x4f, 0x77, 0xd3, 0x99, 0xfb }
-};
-
-static EFI_GUID my_gFrameworkEfiMpServiceProtocolGuid = {
-  0xf33261e7, 0x23cb, 0x11d5, { 0xbd, 0x5c, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiSmmBaseProtocolGuid = {
-  0x1390954d, 0xda95, 0x4227, { 0x93, 0x28, 0x72, 0x82, 0xc2, 0x17, 0xda, 0xa8 }
-};
-
-static EFI_GUID my_gEfiSmmAccessProtocolGuid = {
-  0x3792095a, 0xe309, 0x4c1e, { 0xaa, 0x1, 0x85, 0xf5, 0x65, 0x5a, 0x17, 0xf1 }
-};
-
-static EFI_GUID my_gEfiSmmControlProtocolGuid = {
-  0x8d12e231, 0xc667, 0x4fd1, { 0x98, 0xf2, 0x24, 0x49, 0xa7, 0xe7, 0xb2, 0xe5 }
-};
-
-static EFI_GUID my_gEfiSmmSwDispatchProtocolGuid = {
-  0xe541b773, 0xdd11, 0x420c, { 0xb0, 0x26, 0xdf, 0x99, 0x36, 0x53, 0xf8, 0xbf }
-};
-
-static EFI_GUID my_gEfiSmmSxDispatchProtocolGuid = {
-  0x14fc52be, 0x1dc, 0x426c, { 0x91, 0xae, 0xa2, 0x3c, 0x3e, 0x22, 0xa, 0xe8 }
-};
-
-static EFI_GUID my_gEfiSmmPeriodicTimerDispatchProtocolGuid = {
-  0x9cca03fc, 0x4c9e, 0x4a19, { 0x9b, 0x6, 0xed, 0x7b, 0x47, 0x9b, 0xde, 0x55 }
-};
-
-static EFI_GUID my_gEfiSmmUsbDispatchProtocolGuid = {
-  0xa05b6ffd, 0x87af, 0x4e42, { 0x95, 0xc9, 0x62, 0x28, 0xb6, 0x3c, 0xf3, 0xf3 }
-};
-
-static EFI_GUID my_gEfiSmmGpiDispatchProtocolGuid = {
-  0xe0744b81, 0x9513, 0x49cd, { 0x8c, 0xea, 0xe9, 0x24, 0x5e, 0x70, 0x39, 0xda }
-};
-
-static EFI_GUID my_gEfiSmmStandbyButtonDispatchProtocolGuid = {
-  0x78965b98, 0xb0bf, 0x449e, { 0x8b, 0x22, 0xd2, 0x91, 0x4e, 0x49, 0x8a, 0x98 }
-};
-
-static EFI_GUID my_gEfiSmmPowerButtonDispatchProtocolGuid = {
-  0xb709efa0, 0x47a6, 0x4b41, { 0xb9, 0x31, 0x12, 0xec, 0xe7, 0xa8, 0xee, 0x56 }
-};
-
-static EFI_GUID my_gEfiSmmIchnDispatchProtocolGuid = {
-  0xc50b323e, 0x9075, 0x4f2a, { 0xac, 0x8e, 0xd2, 0x59, 0x6a, 0x10, 0x85, 0xcc }
-};
-
-static EFI_GUID my_gEfiSmmCpuIoGuid = {
-  0x5f439a0b, 0x45d8, 0x4682, { 0xa4, 0xf4, 0xf0, 0x57, 0x6b, 0x51, 0x34, 0x41 }
-};
-
-static EFI_GUID my_gEfiFormCallbackProtocolGuid = {
-  0xf3e4543d, 0xcf35, 0x6cef, { 0x35, 0xc4, 0x4f, 0xe6, 0x34, 0x4d, 0xfc, 0x54 }
-};
-
-static EFI_GUID my_gEfiFormBrowserProtocolGuid = {
-  0xe5a1333e, 0xe1b4, 0x4d55, { 0xce, 0xeb, 0x35, 0xc3, 0xef, 0x13, 0x34, 0x43 }
-};
-
-static EFI_GUID my_gEfiFormBrowserCompatibilityProtocolGuid = {
-  0xfb7c852, 0xadca, 0x4853, { 0x8d, 0xf, 0xfb, 0xa7, 0x1b, 0x1c, 0xe1, 0x1a }
-};
-
-static EFI_GUID my_gFramerworkEfiFirmwareVolumeBlockProtocolGuid = {
-  0xde28bc59, 0x6228, 0x41bd, { 0xbd, 0xf6, 0xa3, 0xb9, 0xad, 0xb5, 0x8d, 0xa1 }
-};
-
-static EFI_GUID my_gEfiSmmCpuSaveStateProtocolGuid = {
-  0x21f302ad, 0x6e94, 0x471b, { 0x84, 0xbc, 0xb1, 0x48, 0x0, 0x40, 0x3a, 0x1d }
-};
-
-static EFI_GUID my_gIntelFsp2PkgTokenSpaceGuid = {
-  0xed6e0531, 0xf715, 0x4a3d, { 0x9b, 0x12, 0xc1, 0xca, 0x5e, 0xf6, 0x98, 0xa2 }
-};
-
-static EFI_GUID my_gFspHeaderFileGuid = {
-  0x912740be, 0x2284, 0x4734, { 0xb9, 0x71, 0x84, 0xb0, 0x27, 0x35, 0x3f, 0xc }
-};
-
-static EFI_GUID my_gFspReservedMemoryResourceHobGuid = {
-  0x69a79759, 0x1373, 0x4367, { 0xa6, 0xc4, 0xc7, 0xf5, 0x9e, 0xfd, 0x98, 0x6e }
-};
-
-static EFI_GUID my_gFspNonVolatileStorageHobGuid = {
-  0x721acf02, 0x4d77, 0x4c2a, { 0xb3, 0xdc, 0x27, 0xb, 0x7b, 0xa9, 0xe4, 0xb0 }
-};
-
-static EFI_GUID my_gFspBootLoaderTolumHobGuid = {
-  0x73ff4f56, 0xaa8e, 0x4451, { 0xb3, 0x16, 0x36, 0x35, 0x36, 0x67, 0xad, 0x44 }
-};
-
-static EFI_GUID my_gFspPerformanceDataGuid = {
-  0x56ed21b6, 0xba23, 0x429e, { 0x89, 0x32, 0x37, 0x6d, 0x8e, 0x18, 0x2e, 0xe3 }
-};
-
-static EFI_GUID my_gFspEventEndOfFirmwareGuid = {
-  0xbd44f629, 0xeae7, 0x4198, { 0x87, 0xf1, 0x39, 0xfa, 0xb0, 0xfd, 0x71, 0x7e }
-};
-
-static EFI_GUID my_gIntelFsp2WrapperTokenSpaceGuid = {
-  0xa34cf082, 0xf50, 0x4f0d, { 0x89, 0x8a, 0x3d, 0x39, 0x30, 0x2b, 0xc5, 0x1e }
-};
-
-static EFI_GUID my_gFspApiPerformanceGuid = {
-  0xc9122295, 0x56ed, 0x4d4e, { 0x6, 0xa6, 0x50, 0x8d, 0x89, 0x4d, 0x3e, 0x40 }
-};
-
-static EFI_GUID my_gFspHobGuid = {
-  0x6d86fb36, 0xba90, 0x472c, { 0xb5, 0x83, 0x3f, 0xbe, 0xd3, 0xfb, 0x20, 0x9a }
-};
-
-static EFI_GUID my_gFspSiliconInitDonePpiGuid = {
-  0x4eb6e09c, 0xd256, 0x4e1e, { 0xb5, 0xa, 0x87, 0x4b, 0xd2, 0x84, 0xb3, 0xde }
-};
-
-static EFI_GUID my_gTopOfTemporaryRamPpiGuid = {
-  0x2f3962b2, 0x57c5, 0x44ec, { 0x9e, 0xfc, 0xa6, 0x9f, 0xd3, 0x2, 0x3, 0x2b }
-};
-
-static EFI_GUID my_gAddPerfRecordProtocolGuid = {
-  0xc4a58d6d, 0x3677, 0x49cb, { 0xa0, 0xa, 0x94, 0x70, 0x76, 0x5f, 0xb5, 0x5e }
-};
-
-static EFI_GUID my_gIntelFspPkgTokenSpaceGuid = {
-  0x834c0c5f, 0xadb3, 0x4372, { 0xae, 0xeb, 0x3, 0xe4, 0xe9, 0xe6, 0xc5, 0x91 }
-};
-
-static EFI_GUID my_gFspBootLoaderTemporaryMemoryGuid = {
-  0xbbcff46c, 0xc8d3, 0x4113, { 0x89, 0x85, 0xb9, 0xd4, 0xf3, 0xb3, 0xf6, 0x4e }
-};
-
-static EFI_GUID my_gFspReservedMemoryResourceHobTsegGuid = {
-  0xd038747c, 0xd00c, 0x4980, { 0xb3, 0x19, 0x49, 0x1, 0x99, 0xa4, 0x7d, 0x55 }
-};
-
-static EFI_GUID my_gFspReservedMemoryResourceHobGfxGuid = {
-  0x9c7c3aa7, 0x5332, 0x4917, { 0x82, 0xb9, 0x56, 0xa5, 0xf3, 0xe6, 0x2a, 0x7 }
-};
-
-static EFI_GUID my_gFspReservedMemoryResourceHobMiscGuid = {
-  0xd6b14b, 0x7dd0, 0x4062, { 0x88, 0x21, 0xe5, 0xf9, 0x6a, 0x2a, 0x1b, 0x0 }
-};
-
-static EFI_GUID my_gFspWrapperTokenSpaceGuid = {
-  0x2bc1c74a, 0x122f, 0x40b2, { 0xb2, 0x23, 0x8, 0x2b, 0x74, 0x65, 0x22, 0x5d }
-};
-
-static EFI_GUID my_gFspInitDonePpiGuid = {
-  0xf5ef05e4, 0xd538, 0x4774, { 0x8f, 0x1b, 0xe9, 0x77, 0x30, 0x11, 0xe0, 0x38 }
-};
-
-static EFI_GUID my_gIntelSiliconPkgTokenSpaceGuid = {
-  0xa9f8d54e, 0x1107, 0x4f0a, { 0xad, 0xd0, 0x45, 0x87, 0xe7, 0xa4, 0xa7, 0x35 }
-};
-
-static EFI_GUID my_gIntelSmbiosDataHobGuid = {
-  0x798e722e, 0x15b2, 0x4e13, { 0x8a, 0xe9, 0x6b, 0xa3, 0xf, 0xf7, 0xf1, 0x67 }
-};
-
-static EFI_GUID my_gMicrocodeFmpImageTypeIdGuid = {
-  0x96d4fdcd, 0x1502, 0x424d, { 0x9d, 0x4c, 0x9b, 0x12, 0xd2, 0xdc, 0xae, 0x5c }
-};
-
-static EFI_GUID my_gEdkiiVTdInfoPpiGuid = {
-  0x8a59fcb3, 0xf191, 0x400c, { 0x97, 0x67, 0x67, 0xaf, 0x2b, 0x25, 0x68, 0x4a }
-};
-
-static EFI_GUID my_gEdkiiPlatformVTdPolicyProtocolGuid = {
-  0x3d17e448, 0x466, 0x4e20, { 0x99, 0x9f, 0xb2, 0xe1, 0x34, 0x88, 0xee, 0x22 }
-};
-
-static EFI_GUID my_gEfiMdeModulePkgTokenSpaceGuid = {
-  0xa1aff049, 0xfdeb, 0x442a, { 0xb3, 0x20, 0x13, 0xab, 0x4c, 0xb7, 0x2b, 0xbc }
-};
-
-static EFI_GUID my_gPcdDataBaseHobGuid = {
-  0xea296d92, 0xb69, 0x423c, { 0x8c, 0x28, 0x33, 0xb4, 0xe0, 0xa9, 0x12, 0x68 }
-};
-
-static EFI_GUID my_gPcdDataBaseSignatureGuid = {
-  0x3c7d193c, 0x682c, 0x4c14, { 0xa6, 0x8f, 0x55, 0x2d, 0xea, 0x4f, 0x43, 0x7e }
-};
-
-static EFI_GUID my_gEfiIfrTianoGuid = {
-  0xf0b1735, 0x87a0, 0x4193, { 0xb2, 0x66, 0x53, 0x8c, 0x38, 0xaf, 0x48, 0xce }
-};
-
-static EFI_GUID my_gEdkiiIfrBitVarstoreGuid = {
-  0x82ddd68b, 0x9163, 0x4187, { 0x9b, 0x27, 0x20, 0xa8, 0xfd, 0x60, 0xa7, 0x1d }
-};
-
-static EFI_GUID my_gEfiIfrFrameworkGuid = {
-  0x31ca5d1a, 0xd511, 0x4931, { 0xb7, 0x82, 0xae, 0x6b, 0x2b, 0x17, 0x8c, 0xd7 }
-};
-
-static EFI_GUID my_gEfiSystemNvDataFvGuid = {
-  0xfff12b8d, 0x7696, 0x4c8b, { 0xa9, 0x85, 0x27, 0x47, 0x7, 0x5b, 0x4f, 0x50 }
-};
-
-static EFI_GUID my_gEdkiiWorkingBlockSignatureGuid = {
-  0x9e58292b, 0x7c68, 0x497d, { 0xa0, 0xce, 0x65, 0x0, 0xfd, 0x9f, 0x1b, 0x95 }
-};
-
-static EFI_GUID my_gEdkiiFaultTolerantWriteGuid = {
-  0x1d3e9cb8, 0x43af, 0x490b, { 0x83, 0xa, 0x35, 0x16, 0xaa, 0x53, 0x20, 0x47 }
-};
-
-static EFI_GUID my_gEfiConsoleOutDeviceGuid = {
-  0xd3b36f2c, 0xd551, 0x11d4, { 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiConsoleInDeviceGuid = {
-  0xd3b36f2b, 0xd551, 0x11d4, { 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiMemoryTypeInformationGuid = {
-  0x4c19049f, 0x4137, 0x4dd3, { 0x9c, 0x10, 0x8b, 0x97, 0xa8, 0x3f, 0xfd, 0xfa }
-};
-
-static EFI_GUID my_gEfiCapsuleVendorGuid = {
-  0x711c703f, 0xc285, 0x4b10, { 0xa3, 0xb0, 0x36, 0xec, 0xbd, 0x3c, 0x8b, 0xe2 }
-};
-
-static EFI_GUID my_gEfiStandardErrorDeviceGuid = {
-  0xd3b36f2d, 0xd551, 0x11d4, { 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiVariableGuid = {
-  0xddcf3616, 0x3275, 0x4164, { 0x98, 0xb6, 0xfe, 0x85, 0x70, 0x7f, 0xfe, 0x7d }
-};
-
-static EFI_GUID my_gEfiAuthenticatedVariableGuid = {
-  0xaaf32c78, 0x947b, 0x439a, { 0xa1, 0x80, 0x2e, 0x14, 0x4e, 0xc3, 0x77, 0x92 }
-};
-
-static EFI_GUID my_gEfiVariableIndexTableGuid = {
-  0x8cfdb8c8, 0xd6b2, 0x40f3, { 0x8e, 0x97, 0x2, 0x30, 0x7c, 0xc9, 0x8b, 0x7c }
-};
-
-static EFI_GUID my_gSmmVariableWriteGuid = {
-  0x93ba1826, 0xdffb, 0x45dd, { 0x82, 0xa7, 0xe7, 0xdc, 0xaa, 0x3b, 0xbd, 0xf3 }
-};
-
-static EFI_GUID my_gPerformanceProtocolGuid = {
-  0x76b6bdfa, 0x2acd, 0x4462, { 0x9e, 0x3f, 0xcb, 0x58, 0xc9, 0x69, 0xd9, 0x37 }
-};
-
-static EFI_GUID my_gSmmPerformanceProtocolGuid = {
-  0xf866226a, 0xeaa5, 0x4f5a, { 0xa9, 0xa, 0x6c, 0xfb, 0xa5, 0x7c, 0x58, 0x8e }
-};
-
-static EFI_GUID my_gPerformanceExProtocolGuid = {
-  0x1ea81bec, 0xf01a, 0x4d98, { 0xa2, 0x1, 0x4a, 0x61, 0xce, 0x2f, 0xc0, 0x22 }
-};
-
-static EFI_GUID my_gSmmPerformanceExProtocolGuid = {
-  0x931fc048, 0xc71d, 0x4455, { 0x89, 0x30, 0x47, 0x6, 0x30, 0xe3, 0xe, 0xe5 }
-};
-
-static EFI_GUID my_gEfiCrc32GuidedSectionExtractionGuid = {
-  0xfc1bcdb0, 0x7d31, 0x49aa, { 0x93, 0x6a, 0xa4, 0x60, 0xd, 0x9d, 0xd0, 0x83 }
-};
-
-static EFI_GUID my_gStatusCodeCallbackGuid = {
-  0xe701458c, 0x4900, 0x4ca5, { 0xb7, 0x72, 0x3d, 0x37, 0x94, 0x9f, 0x79, 0x27 }
-};
-
-static EFI_GUID my_gMemoryStatusCodeRecordGuid = {
-  0x60cc026, 0x4c0d, 0x4dda, { 0x8f, 0x41, 0x59, 0x5f, 0xef, 0x0, 0xa5, 0x2 }
-};
-
-static EFI_GUID my_gEfiStatusCodeDataTypeDebugGuid = {
-  0x9a4e9246, 0xd553, 0x11d5, { 0x87, 0xe2, 0x0, 0x6, 0x29, 0x45, 0xc3, 0xb9 }
-};
-
-static EFI_GUID my_gLoadFixedAddressConfigurationTableGuid = {
-  0x2ca88b53, 0xd296, 0x4080, { 0xa4, 0xa5, 0xca, 0xd9, 0xba, 0xe2, 0x4b, 0x9 }
-};
-
-static EFI_GUID my_gEfiGenericVariableGuid = {
-  0x59d1c24f, 0x50f1, 0x401a, { 0xb1, 0x1, 0xf3, 0x3e, 0xd, 0xae, 0xd4, 0x43 }
-};
-
-static EFI_GUID my_gIdleLoopEventGuid = {
-  0x3c8d294c, 0x5fc3, 0x4451, { 0xbb, 0x31, 0xc4, 0xc0, 0x32, 0x29, 0x5e, 0x6c }
-};
-
-static EFI_GUID my_gRecoveryOnFatUsbDiskGuid = {
-  0xffbce19, 0x324c, 0x4690, { 0xa0, 0x9, 0x98, 0xc6, 0xae, 0x2e, 0xb1, 0x86 }
-};
-
-static EFI_GUID my_gRecoveryOnFatIdeDiskGuid = {
-  0xb38573b6, 0x6200, 0x4ac5, { 0xb5, 0x1d, 0x82, 0xe6, 0x59, 0x38, 0xd7, 0x83 }
-};
-
-static EFI_GUID my_gRecoveryOnFatFloppyDiskGuid = {
-  0x2e3d2e75, 0x9b2e, 0x412d, { 0xb4, 0xb1, 0x70, 0x41, 0x6b, 0x87, 0x0, 0xff }
-};
-
-static EFI_GUID my_gRecoveryOnDataCdGuid = {
-  0x5cac0099, 0xdc9, 0x48e5, { 0x80, 0x68, 0xbb, 0x95, 0xf5, 0x40, 0xa, 0x9f }
-};
-
-static EFI_GUID my_gEfiSmmLockBoxCommunicationGuid = {
-  0x2a3cfebd, 0x27e8, 0x4d0a, { 0x8b, 0x79, 0xd6, 0x88, 0xc2, 0xa3, 0xe1, 0xc0 }
-};
-
-static EFI_GUID my_gEfiAcpiVariableGuid = {
-  0xaf9ffd67, 0xec10, 0x488a, { 0x9d, 0xfc, 0x6c, 0xbf, 0x5e, 0xe2, 0x2c, 0x2e }
-};
-
-static EFI_GUID my_gEfiAcpiS3ContextGuid = {
-  0xef98d3a, 0x3e33, 0x497a, { 0xa4, 0x1, 0x77, 0xbe, 0x3e, 0xb7, 0x4f, 0x38 }
-};
-
-static EFI_GUID my_gEfiBootScriptExecutorVariableGuid = {
-  0x3079818c, 0x46d4, 0x4a73, { 0xae, 0xf3, 0xe3, 0xe4, 0x6c, 0xf1, 0xee, 0xdb }
-};
-
-static EFI_GUID my_gEfiBootScriptExecutorContextGuid = {
-  0x79cb58c4, 0xac51, 0x442f, { 0xaf, 0xd7, 0x98, 0xe4, 0x7d, 0x2e, 0x99, 0x8 }
-};
-
-static EFI_GUID my_gUsbKeyboardLayoutPackageGuid = {
-  0xc0f3b43, 0x44de, 0x4907, { 0xb4, 0x78, 0x22, 0x5f, 0x6f, 0x62, 0x89, 0xdc }
-};
-
-static EFI_GUID my_gUsbKeyboardLayoutKeyGuid = {
-  0x3a4d7a7c, 0x18a, 0x4b42, { 0x81, 0xb3, 0xdc, 0x10, 0xe3, 0xb5, 0x91, 0xbd }
-};
-
-static EFI_GUID my_gHiiResourceSamleFormSetGuid = {
-  0x4f4ef7f0, 0xaa29, 0x4ce9, { 0xba, 0x41, 0x64, 0x3e, 0x1, 0x23, 0xa9, 0x9f }
-};
-
-static EFI_GUID my_gDriverSampleFormSetGuid = {
-  0xa04a27f4, 0xdf00, 0x4d42, { 0xb5, 0x52, 0x39, 0x51, 0x13, 0x2, 0x11, 0x3d }
-};
-
-static EFI_GUID my_gDriverSampleInventoryGuid = {
-  0xb3f56470, 0x6141, 0x4621, { 0x8f, 0x19, 0x70, 0x4e, 0x57, 0x7a, 0xa9, 0xe8 }
-};
-
-static EFI_GUID my_gEfiIfrRefreshIdOpGuid = {
-  0xf5e655d9, 0x2a6, 0x46f2, { 0x9e, 0x76, 0xb8, 0xbe, 0x8e, 0x60, 0xab, 0x22 }
-};
-
-static EFI_GUID my_gPlatformOverridesManagerGuid = {
-  0x8614567d, 0x35be, 0x4415, { 0x8d, 0x88, 0xbd, 0x7d, 0xc, 0x9c, 0x70, 0xc0 }
-};
-
-static EFI_GUID my_gIp4Config2NvDataGuid = {
-  0x9b942747, 0x154e, 0x4d29, { 0xa4, 0x36, 0xbf, 0x71, 0x0, 0xc8, 0xb5, 0x3b }
-};
-
-static EFI_GUID my_gVlanConfigFormSetGuid = {
-  0xd79df6b0, 0xef44, 0x43bd, { 0x97, 0x97, 0x43, 0xe9, 0x3b, 0xcf, 0x5f, 0xa8 }
-};
-
-static EFI_GUID my_gIp4IScsiConfigGuid = {
-  0x6456ed61, 0x3579, 0x41c9, { 0x8a, 0x26, 0xa, 0xb, 0xd6, 0x2b, 0x78, 0xfc }
-};
-
-static EFI_GUID my_gIScsiCHAPAuthInfoGuid = {
-  0x786ec0ac, 0x65ae, 0x4d1b, { 0xb1, 0x37, 0xd, 0x11, 0xa, 0x48, 0x37, 0x97 }
-};
-
-static EFI_GUID my_gZeroGuid = {
-  0x0, 0x0, 0x0, { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 }
-};
-
-static EFI_GUID my_gMtcVendorGuid = {
-  0xeb704011, 0x1402, 0x11d3, { 0x8e, 0x77, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiFirmwarePerformanceGuid = {
-  0xc095791a, 0x3001, 0x47b2, { 0x80, 0xc9, 0xea, 0xc7, 0x31, 0x9f, 0x2f, 0xa4 }
-};
-
-static EFI_GUID my_gFirmwarePerformanceS3PointerGuid = {
-  0xdc65adc, 0xa973, 0x4130, { 0x8d, 0xf0, 0x2a, 0xdb, 0xeb, 0x9e, 0x4a, 0x31 }
-};
-
-static EFI_GUID my_gEventExitBootServicesFailedGuid = {
-  0x4f6c5507, 0x232f, 0x4787, { 0xb9, 0x5e, 0x72, 0xf8, 0x62, 0x49, 0xc, 0xb1 }
-};
-
-static EFI_GUID my_gConnectConInEventGuid = {
-  0xdb4e8151, 0x57ed, 0x4bed, { 0x88, 0x33, 0x67, 0x51, 0xb5, 0xd1, 0xa8, 0xd7 }
-};
-
-static EFI_GUID my_gEdkiiStatusCodeDataTypeVariableGuid = {
-  0xf6ee6dbb, 0xd67f, 0x4ea0, { 0x8b, 0x96, 0x6a, 0x71, 0xb1, 0x9d, 0x84, 0xad }
-};
-
-static EFI_GUID my_gEdkiiMemoryProfileGuid = {
-  0x821c9a09, 0x541a, 0x40f6, { 0x9f, 0x43, 0xa, 0xd1, 0x93, 0xa1, 0x2c, 0xfe }
-};
-
-static EFI_GUID my_gEdkiiSmmMemoryProfileGuid = {
-  0xe22bbcca, 0x516a, 0x46a8, { 0x80, 0xe2, 0x67, 0x45, 0xe8, 0x36, 0x93, 0xbd }
-};
-
-static EFI_GUID my_gEdkiiVarErrorFlagGuid = {
-  0x4b37fe8, 0xf6ae, 0x480b, { 0xbd, 0xd5, 0x37, 0xd9, 0x8c, 0x5e, 0x89, 0xaa }
-};
-
-static EFI_GUID my_gBrotliCustomDecompressGuid = {
-  0x3d532050, 0x5cda, 0x4fd0, { 0x87, 0x9e, 0xf, 0x7f, 0x63, 0xd, 0x5a, 0xfb }
-};
-
-static EFI_GUID my_gLzmaCustomDecompressGuid = {
-  0xee4e5898, 0x3914, 0x4259, { 0x9d, 0x6e, 0xdc, 0x7b, 0xd7, 0x94, 0x3, 0xcf }
-};
-
-static EFI_GUID my_gLzmaF86CustomDecompressGuid = {
-  0xd42ae6bd, 0x1352, 0x4bfb, { 0x90, 0x9a, 0xca, 0x72, 0xa6, 0xea, 0xe8, 0x89 }
-};
-
-static EFI_GUID my_gEfiTtyTermGuid = {
-  0x7d916d80, 0x5bb1, 0x458c, { 0xa4, 0x8f, 0xe2, 0x5f, 0xdd, 0x51, 0xef, 0x94 }
-};
-
-static EFI_GUID my_gEfiIfrBootMaintenanceGuid = {
-  0xb2dedc91, 0xd59f, 0x48d2, { 0x89, 0x8a, 0x12, 0x49, 0xc, 0x74, 0xa4, 0xe0 }
-};
-
-static EFI_GUID my_gEfiIfrFrontPageGuid = {
-  0xe58809f8, 0xfbc1, 0x48e2, { 0x88, 0x3a, 0xa3, 0xf, 0xdc, 0x4b, 0x44, 0x1e }
-};
-
-static EFI_GUID my_gRamDiskFormSetGuid = {
-  0x2a46715f, 0x3581, 0x4a55, { 0x8e, 0x73, 0x2b, 0x76, 0x9a, 0xaa, 0x30, 0xc5 }
-};
-
-static EFI_GUID my_gEdkiiPiSmmCommunicationRegionTableGuid = {
-  0x4e28ca50, 0xd582, 0x44ac, { 0xa1, 0x1f, 0xe3, 0xd5, 0x65, 0x26, 0xdb, 0x34 }
-};
-
-static EFI_GUID my_gEdkiiPiSmmMemoryAttributesTableGuid = {
-  0x6b9fd3f7, 0x16df, 0x45e8, { 0xbd, 0x39, 0xb9, 0x4a, 0x66, 0x54, 0x1a, 0x5d }
-};
-
-static EFI_GUID my_gSmiHandlerProfileGuid = {
-  0x49174342, 0x7108, 0x409b, { 0x8b, 0xbe, 0x65, 0xfd, 0xa8, 0x53, 0x89, 0xf5 }
-};
-
-static EFI_GUID my_gEdkiiNonDiscoverableAhciDeviceGuid = {
-  0xc7d35798, 0xe4d2, 0x4a93, { 0xb1, 0x45, 0x54, 0x88, 0x9f, 0x2, 0x58, 0x4b }
-};
-
-static EFI_GUID my_gEdkiiNonDiscoverableAmbaDeviceGuid = {
-  0x94440339, 0xcc93, 0x4506, { 0xb4, 0xc6, 0xee, 0x8d, 0xf, 0x4c, 0xa1, 0x91 }
-};
-
-static EFI_GUID my_gEdkiiNonDiscoverableEhciDeviceGuid = {
-  0xeaee5615, 0xcfd, 0x45fc, { 0x87, 0x69, 0xa0, 0xd8, 0x56, 0x95, 0xaf, 0x85 }
-};
-
-static EFI_GUID my_gEdkiiNonDiscoverableNvmeDeviceGuid = {
-  0xc5f25542, 0x2a79, 0x4a26, { 0x81, 0xbb, 0x4e, 0xa6, 0x32, 0x33, 0xb3, 0x9 }
-};
-
-static EFI_GUID my_gEdkiiNonDiscoverableOhciDeviceGuid = {
-  0xb20005b0, 0xbb2d, 0x496f, { 0x86, 0x9c, 0x23, 0xb, 0x44, 0x79, 0xe7, 0xd1 }
-};
-
-static EFI_GUID my_gEdkiiNonDiscoverableSdhciDeviceGuid = {
-  0x1dd1d619, 0xf9b8, 0x463e, { 0x86, 0x81, 0xd1, 0xdc, 0x7c, 0x7, 0xb7, 0x2c }
-};
-
-static EFI_GUID my_gEdkiiNonDiscoverableUfsDeviceGuid = {
-  0x2ea77912, 0x80a8, 0x4947, { 0xbe, 0x69, 0xcd, 0xd0, 0xa, 0xfb, 0xe5, 0x56 }
-};
-
-static EFI_GUID my_gEdkiiNonDiscoverableUhciDeviceGuid = {
-  0xa8cda0a2, 0x4f37, 0x4a1b, { 0x8e, 0x10, 0x8e, 0xf3, 0xcc, 0x3b, 0xf3, 0xa8 }
-};
-
-static EFI_GUID my_gEdkiiNonDiscoverableXhciDeviceGuid = {
-  0xb1be0bc5, 0x6c28, 0x442d, { 0xaa, 0x37, 0x15, 0x1b, 0x42, 0x57, 0xbd, 0x78 }
-};
-
-static EFI_GUID my_gEdkiiPlatformHasAcpiGuid = {
-  0xf0966b41, 0xc23f, 0x41b9, { 0x96, 0x4, 0xf, 0xf7, 0xe1, 0x11, 0x96, 0x5a }
-};
-
-static EFI_GUID my_gEdkiiFpdtExtendedFirmwarePerformanceGuid = {
-  0x3b387bfd, 0x7abc, 0x4cf2, { 0xa0, 0xca, 0xb6, 0xa1, 0x6c, 0x1b, 0x1b, 0x25 }
-};
-
-static EFI_GUID my_gEdkiiEndOfS3ResumeGuid = {
-  0x96f5296d, 0x5f7, 0x4f3c, { 0x84, 0x67, 0xe4, 0x56, 0x89, 0xe, 0xc, 0xb5 }
-};
-
-static EFI_GUID my_gEdkiiS3SmmInitDoneGuid = {
-  0x8f9d4825, 0x797d, 0x48fc, { 0x84, 0x71, 0x84, 0x50, 0x25, 0x79, 0x2e, 0xf6 }
-};
-
-static EFI_GUID my_gPeiAtaControllerPpiGuid = {
-  0xa45e60d1, 0xc719, 0x44aa, { 0xb0, 0x7a, 0xaa, 0x77, 0x7f, 0x85, 0x90, 0x6d }
-};
-
-static EFI_GUID my_gPeiUsbHostControllerPpiGuid = {
-  0x652b38a9, 0x77f4, 0x453f, { 0x89, 0xd5, 0xe7, 0xbd, 0xc3, 0x52, 0xfc, 0x53 }
-};
-
-static EFI_GUID my_gPeiUsb2HostControllerPpiGuid = {
-  0xfedd6305, 0xe2d7, 0x4ed5, { 0x9f, 0xaa, 0xda, 0x8, 0xe, 0x33, 0x6c, 0x22 }
-};
-
-static EFI_GUID my_gPeiUsbControllerPpiGuid = {
-  0x3bc1f6de, 0x693e, 0x4547, { 0xa3, 0x0, 0x21, 0x82, 0x3c, 0xa4, 0x20, 0xb2 }
-};
-
-static EFI_GUID my_gPeiUsbIoPpiGuid = {
-  0x7c29785c, 0x66b9, 0x49fc, { 0xb7, 0x97, 0x1c, 0xa5, 0x55, 0xe, 0xf2, 0x83 }
-};
-
-static EFI_GUID my_gPeiSecPerformancePpiGuid = {
-  0xecc666b, 0x4662, 0x47f9, { 0x9d, 0xd5, 0xd0, 0x96, 0xff, 0x7d, 0xa4, 0x9e }
-};
-
-static EFI_GUID my_gEfiPeiSmmCommunicationPpiGuid = {
-  0xae933e1c, 0xcc47, 0x4e38, { 0x8f, 0xe, 0xe2, 0xf6, 0x1d, 0x26, 0x5, 0xdf }
-};
-
-static EFI_GUID my_gPeiSmmAccessPpiGuid = {
-  0x268f33a9, 0xcccd, 0x48be, { 0x88, 0x17, 0x86, 0x5, 0x3a, 0xc3, 0x2e, 0xd6 }
-};
-
-static EFI_GUID my_gPeiSmmControlPpiGuid = {
-  0x61c68702, 0x4d7e, 0x4f43, { 0x8d, 0xef, 0xa7, 0x43, 0x5, 0xce, 0x74, 0xc5 }
-};
-
-static EFI_GUID my_gPeiPostScriptTablePpiGuid = {
-  0x88c9d306, 0x900, 0x4eb5, { 0x82, 0x60, 0x3e, 0x2d, 0xbe, 0xda, 0x1f, 0x89 }
-};
-
-static EFI_GUID my_gPeiSerialPortPpiGuid = {
-  0x490e9d85, 0x8aef, 0x4193, { 0x8e, 0x56, 0xf7, 0x34, 0xa9, 0xff, 0xac, 0x8b }
-};
-
-static EFI_GUID my_gEdkiiPeiUfsHostControllerPpiGuid = {
-  0xdc54b283, 0x1a77, 0x4cd6, { 0x83, 0xbb, 0xfd, 0xda, 0x46, 0x9a, 0x2e, 0xc6 }
-};
-
-static EFI_GUID my_gPeiIpmiPpiGuid = {
-  0xa9731431, 0xd968, 0x4277, { 0xb7, 0x52, 0xa3, 0xa9, 0xa6, 0xae, 0x18, 0x98 }
-};
-
-static EFI_GUID my_gEdkiiPeiSdMmcHostControllerPpiGuid = {
-  0xb30dfeed, 0x947f, 0x4396, { 0xb1, 0x5a, 0xdf, 0xbd, 0xb9, 0x16, 0xdc, 0x24 }
-};
-
-static EFI_GUID my_gEdkiiIoMmuPpiGuid = {
-  0x70b0af26, 0xf847, 0x4bb6, { 0xaa, 0xb9, 0xcd, 0xe8, 0x4f, 0xc6, 0x14, 0x31 }
-};
-
-static EFI_GUID my_gEdkiiPlatformSpecificResetFilterPpiGuid = {
-  0x8c9f4de3, 0x7b90, 0x47ef, { 0x93, 0x8, 0x28, 0x7c, 0xec, 0xd6, 0x6d, 0xe8 }
-};
-
-static EFI_GUID my_gEdkiiPlatformSpecificResetNotificationPpiGuid = {
-  0xe09f355d, 0xdae8, 0x4910, { 0xb1, 0x4a, 0x92, 0x78, 0xf, 0xdc, 0xf7, 0xcb }
-};
-
-static EFI_GUID my_gEdkiiPlatformSpecificResetHandlerPpiGuid = {
-  0x75cf14ae, 0x3441, 0x49dc, { 0xaa, 0x10, 0xbb, 0x35, 0xa7, 0xba, 0x8b, 0xab }
-};
-
-static EFI_GUID my_gEfiLoadPeImageProtocolGuid = {
-  0x5cb5c776, 0x60d5, 0x45ee, { 0x88, 0x3c, 0x45, 0x27, 0x8, 0xcd, 0x74, 0x3f }
-};
-
-static EFI_GUID my_gEfiPrint2ProtocolGuid = {
-  0xf05976ef, 0x83f1, 0x4f3d, { 0x86, 0x19, 0xf7, 0x59, 0x5d, 0x41, 0xe5, 0x38 }
-};
-
-static EFI_GUID my_gEfiPrint2SProtocolGuid = {
-  0xcc252d2, 0xc106, 0x4661, { 0xb5, 0xbd, 0x31, 0x47, 0xa4, 0xf8, 0x1f, 0x92 }
-};
-
-static EFI_GUID my_gEfiGenericMemTestProtocolGuid = {
-  0x309de7f1, 0x7f5e, 0x4ace, { 0xb4, 0x9c, 0x53, 0x1b, 0xe5, 0xaa, 0x95, 0xef }
-};
-
-static EFI_GUID my_gEfiDebuggerConfigurationProtocolGuid = {
-  0x577d959c, 0xe967, 0x4546, { 0x86, 0x20, 0xc7, 0x78, 0xfa, 0xe5, 0xda, 0x5 }
-};
-
-static EFI_GUID my_gEfiDpcProtocolGuid = {
-  0x480f8ae9, 0xc46, 0x4aa9, { 0xbc, 0x89, 0xdb, 0x9f, 0xba, 0x61, 0x98, 0x6 }
-};
-
-static EFI_GUID my_gEfiFaultTolerantWriteProtocolGuid = {
-  0x3ebd9e82, 0x2c78, 0x4de6, { 0x97, 0x86, 0x8d, 0x4b, 0xfc, 0xb7, 0xc8, 0x81 }
-};
-
-static EFI_GUID my_gEfiSmmFaultTolerantWriteProtocolGuid = {
-  0x3868fc3b, 0x7e45, 0x43a7, { 0x90, 0x6c, 0x4b, 0xa4, 0x7d, 0xe1, 0x75, 0x4d }
-};
-
-static EFI_GUID my_gEfiSwapAddressRangeProtocolGuid = {
-  0x1259f60d, 0xb754, 0x468e, { 0xa7, 0x89, 0x4d, 0xb8, 0x5d, 0x55, 0xe8, 0x7e }
-};
-
-static EFI_GUID my_gEfiSmmSwapAddressRangeProtocolGuid = {
-  0x67c4f112, 0x3385, 0x4e55, { 0x9c, 0x5b, 0xc0, 0x5b, 0x71, 0x7c, 0x42, 0x28 }
-};
-
-static EFI_GUID my_gEfiSmmVariableProtocolGuid = {
-  0xed32d533, 0x99e6, 0x4209, { 0x9c, 0xc0, 0x2d, 0x72, 0xcd, 0xd9, 0x98, 0xa7 }
-};
-
-static EFI_GUID my_gEdkiiVariableLockProtocolGuid = {
-  0xcd3d0a05, 0x9e24, 0x437c, { 0xa8, 0x91, 0x1e, 0xe0, 0x53, 0xdb, 0x76, 0x38 }
-};
-
-static EFI_GUID my_gEdkiiVarCheckProtocolGuid = {
-  0xaf23b340, 0x97b4, 0x4685, { 0x8d, 0x4f, 0xa3, 0xf2, 0x81, 0x69, 0xb2, 0x1d }
-};
-
-static EFI_GUID my_gEdkiiSmmVarCheckProtocolGuid = {
-  0xb0d8f3c1, 0xb7de, 0x4c11, { 0xbc, 0x89, 0x2f, 0xb5, 0x62, 0xc8, 0xc4, 0x11 }
-};
-
-static EFI_GUID my_gEfiSmmFirmwareVolumeBlockProtocolGuid = {
-  0xd326d041, 0xbd31, 0x4c01, { 0xb5, 0xa8, 0x62, 0x8b, 0xe8, 0x7f, 0x6, 0x53 }
-};
-
-static EFI_GUID my_gEfiDebugMaskProtocolGuid = {
-  0x4c8a2451, 0xc207, 0x405b, { 0x96, 0x94, 0x99, 0xea, 0x13, 0x25, 0x13, 0x41 }
-};
-
-static EFI_GUID my_gEfiLockBoxProtocolGuid = {
-  0xbd445d79, 0xb7ad, 0x4f04, { 0x9a, 0xd8, 0x29, 0xbd, 0x20, 0x40, 0xeb, 0x3c }
-};
-
-static EFI_GUID my_gEfiFormBrowserExProtocolGuid = {
-  0x1f73b18d, 0x4630, 0x43c1, { 0xa1, 0xde, 0x6f, 0x80, 0x85, 0x5d, 0x7d, 0xa4 }
-};
-
-static EFI_GUID my_gEfiEbcVmTestProtocolGuid = {
-  0xaaeaccfd, 0xf27b, 0x4c17, { 0xb6, 0x10, 0x75, 0xca, 0x1f, 0x2d, 0xfb, 0x52 }
-};
-
-static EFI_GUID my_gEfiEbcSimpleDebuggerProtocolGuid = {
-  0x2a72d11e, 0x7376, 0x40f6, { 0x9c, 0x68, 0x23, 0xfa, 0x2f, 0xe3, 0x63, 0xf1 }
-};
-
-static EFI_GUID my_gEfiBootLogoProtocolGuid = {
-  0xcdea2bd3, 0xfc25, 0x4c1c, { 0xb9, 0x7c, 0xb3, 0x11, 0x86, 0x6, 0x49, 0x90 }
-};
-
-static EFI_GUID my_gEdkiiBootLogo2ProtocolGuid = {
-  0x4b5dc1df, 0x1eaa, 0x48b2, { 0xa7, 0xe9, 0xea, 0xc4, 0x89, 0xa0, 0xb, 0x5c }
-};
-
-static EFI_GUID my_gEdkiiFormDisplayEngineProtocolGuid = {
-  0x9bbe29e9, 0xfda1, 0x41ec, { 0xad, 0x52, 0x45, 0x22, 0x13, 0x74, 0x2d, 0x2e }
-};
-
-static EFI_GUID my_gEdkiiFormBrowserEx2ProtocolGuid = {
-  0xa770c357, 0xb693, 0x4e6d, { 0xa6, 0xcf, 0xd2, 0x1c, 0x72, 0x8e, 0x55, 0xb }
-};
-
-static EFI_GUID my_gEdkiiUfsHostControllerProtocolGuid = {
-  0xebc01af5, 0x7a9, 0x489e, { 0xb7, 0xce, 0xdc, 0x8, 0x9e, 0x45, 0x9b, 0x2f }
-};
-
-static EFI_GUID my_gEsrtManagementProtocolGuid = {
-  0xa340c064, 0x723c, 0x4a9c, { 0xa4, 0xdd, 0xd5, 0xb4, 0x7a, 0x26, 0xfb, 0xb0 }
-};
-
-static EFI_GUID my_gEdkiiSmmExitBootServicesProtocolGuid = {
-  0x296eb418, 0xc4c8, 0x4e05, { 0xab, 0x59, 0x39, 0xe8, 0xaf, 0x56, 0xf0, 0xa }
-};
-
-static EFI_GUID my_gEdkiiSmmLegacyBootProtocolGuid = {
-  0x85a8ab57, 0x644, 0x4110, { 0x85, 0xf, 0x98, 0x13, 0x22, 0x4, 0x70, 0x70 }
-};
-
-static EFI_GUID my_gEdkiiSmmReadyToBootProtocolGuid = {
-  0x6e057ecf, 0xfa99, 0x4f39, { 0x95, 0xbc, 0x59, 0xf9, 0x92, 0x1d, 0x17, 0xe4 }
-};
-
-static EFI_GUID my_gEdkiiPlatformLogoProtocolGuid = {
-  0x53cd299f, 0x2bc1, 0x40c0, { 0x8c, 0x7, 0x23, 0xf6, 0x4f, 0xdb, 0x30, 0xe0 }
-};
-
-static EFI_GUID my_gEfiFileExplorerProtocolGuid = {
-  0x2c03c536, 0x4594, 0x4515, { 0x9e, 0x7a, 0xd3, 0xd2, 0x4, 0xfe, 0x13, 0x63 }
-};
-
-static EFI_GUID my_gIpmiProtocolGuid = {
-  0xdbc6381f, 0x5554, 0x4d14, { 0x8f, 0xfd, 0x76, 0xd7, 0x87, 0xb8, 0xac, 0xbf }
-};
-
-static EFI_GUID my_gSmmIpmiProtocolGuid = {
-  0x5169af60, 0x8c5a, 0x4243, { 0xb3, 0xe9, 0x56, 0xc5, 0x6d, 0x18, 0xee, 0x26 }
-};
-
-static EFI_GUID my_gEfiPs2PolicyProtocolGuid = {
-  0x4df19259, 0xdc71, 0x4d46, { 0xbe, 0xf1, 0x35, 0x7b, 0xb5, 0x78, 0xc4, 0x18 }
-};
-
-static EFI_GUID my_gEdkiiNonDiscoverableDeviceProtocolGuid = {
-  0xd51905b, 0xb77e, 0x452a, { 0xa2, 0xc0, 0xec, 0xa0, 0xcc, 0x8d, 0x51, 0x4a }
-};
-
-static EFI_GUID my_gEdkiiIoMmuProtocolGuid = {
-  0x4e939de9, 0xd948, 0x4b0f, { 0x88, 0xed, 0xe6, 0xe1, 0xce, 0x51, 0x7c, 0x1e }
-};
-
-static EFI_GUID my_gEdkiiSmmMemoryAttributeProtocolGuid = {
-  0x69b792ea, 0x39ce, 0x402d, { 0xa2, 0xa6, 0xf7, 0x21, 0xde, 0x35, 0x1d, 0xfe }
-};
-
-static EFI_GUID my_gEdkiiPlatformSpecificResetFilterProtocolGuid = {
-  0x695d7835, 0x8d47, 0x4c11, { 0xab, 0x22, 0xfa, 0x8a, 0xcc, 0xe7, 0xae, 0x7a }
-};
-
-static EFI_GUID my_gEdkiiPlatformSpecificResetHandlerProtocolGuid = {
-  0x2df6ba0b, 0x7092, 0x440d, { 0xbd, 0x4, 0xfb, 0x9, 0x1e, 0xc3, 0xf3, 0xc1 }
-};
-
-static EFI_GUID my_gEdkiiFirmwareManagementProgressProtocolGuid = {
-  0x1849bda2, 0x6952, 0x4e86, { 0xa1, 0xdb, 0x55, 0x9a, 0x3c, 0x47, 0x9d, 0xf1 }
-};
-
-static EFI_GUID my_gEfiGlobalVariableGuid = {
-  0x8be4df61, 0x93ca, 0x11d2, { 0xaa, 0xd, 0x0, 0xe0, 0x98, 0x3, 0x2b, 0x8c }
-};
-
-static EFI_GUID my_gEfiVT100PlusGuid = {
-  0x7baec70b, 0x57e0, 0x4c76, { 0x8e, 0x87, 0x2f, 0x9e, 0x28, 0x8, 0x83, 0x43 }
-};
-
-static EFI_GUID my_gEfiVT100Guid = {
-  0xdfa66065, 0xb419, 0x11d3, { 0x9a, 0x2d, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiPcAnsiGuid = {
-  0xe0c14753, 0xf9be, 0x11d2, { 0x9a, 0xc, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiVTUTF8Guid = {
-  0xad15a0d6, 0x8bec, 0x4acf, { 0xa0, 0x73, 0xd0, 0x1d, 0xe7, 0x7e, 0x2d, 0x88 }
-};
-
-static EFI_GUID my_gEfiUartDevicePathGuid = {
-  0x37499a9d, 0x542f, 0x4c89, { 0xa0, 0x26, 0x35, 0xda, 0x14, 0x20, 0x94, 0xe4 }
-};
-
-static EFI_GUID my_gEfiSasDevicePathGuid = {
-  0xd487ddb4, 0x8b, 0x11d9, { 0xaf, 0xdc, 0x0, 0x10, 0x83, 0xff, 0xca, 0x4d }
-};
-
-static EFI_GUID my_gEfiPartTypeLegacyMbrGuid = {
-  0x24dee41, 0x33e7, 0x11d3, { 0x9d, 0x69, 0x0, 0x8, 0xc7, 0x81, 0xf3, 0x9f }
-};
-
-static EFI_GUID my_gEfiPartTypeSystemPartGuid = {
-  0xc12a7328, 0xf81f, 0x11d2, { 0xba, 0x4b, 0x0, 0xa0, 0xc9, 0x3e, 0xc9, 0x3b }
-};
-
-static EFI_GUID my_gEfiDebugImageInfoTableGuid = {
-  0x49152e77, 0x1ada, 0x4764, { 0xb7, 0xa2, 0x7a, 0xfe, 0xfe, 0xd9, 0x5e, 0x8b }
-};
-
-static EFI_GUID my_gEfiAcpiTableGuid = {
-  0x8868e871, 0xe4f1, 0x11d3, { 0xbc, 0x22, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiAcpi10TableGuid = {
-  0xeb9d2d30, 0x2d88, 0x11d3, { 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiSmbiosTableGuid = {
-  0xeb9d2d31, 0x2d88, 0x11d3, { 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiMpsTableGuid = {
-  0xeb9d2d2f, 0x2d88, 0x11d3, { 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiSalSystemTableGuid = {
-  0xeb9d2d32, 0x2d88, 0x11d3, { 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiAuthenticationChapLocalGuid = {
-  0xc280c73e, 0x15ca, 0x11da, { 0xb0, 0xca, 0x0, 0x10, 0x83, 0xff, 0xca, 0x4d }
-};
-
-static EFI_GUID my_gEfiAuthenticationChapRadiusGuid = {
-  0xd6062b50, 0x15ca, 0x11da, { 0x92, 0x19, 0x0, 0x10, 0x83, 0xff, 0xca, 0x4d }
-};
-
-static EFI_GUID my_gEfiFileSystemVolumeLabelInfoIdGuid = {
-  0xdb47d7d3, 0xfe81, 0x11d3, { 0x9a, 0x35, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiFileSystemInfoGuid = {
-  0x9576e93, 0x6d3f, 0x11d2, { 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiFileInfoGuid = {
-  0x9576e92, 0x6d3f, 0x11d2, { 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gBootObjectAuthorizationParmsetGuid = {
-  0xedd35e31, 0x7b9, 0x11d2, { 0x83, 0xa3, 0x0, 0xa0, 0xc9, 0x1f, 0xad, 0xcf }
-};
-
-static EFI_GUID my_gEfiPlatformToDriverConfigurationClpGuid = {
-  0x345ecc0e, 0xcb6, 0x4b75, { 0xbb, 0x57, 0x1b, 0x12, 0x9c, 0x47, 0x33, 0x3e }
-};
-
-static EFI_GUID my_gEfiHiiKeyBoardLayoutGuid = {
-  0x14982a4f, 0xb0ed, 0x45b8, { 0xa8, 0x11, 0x5a, 0x7a, 0x9b, 0xc2, 0x32, 0xdf }
-};
-
-static EFI_GUID my_gEfiHashAlgorithmMD5Guid = {
-  0xaf7c79c, 0x65b5, 0x4319, { 0xb0, 0xae, 0x44, 0xec, 0x48, 0x4e, 0x4a, 0xd7 }
-};
-
-static EFI_GUID my_gEfiHashAlgorithmSha512Guid = {
-  0xcaa4381e, 0x750c, 0x4770, { 0xb8, 0x70, 0x7a, 0x23, 0xb4, 0xe4, 0x21, 0x30 }
-};
-
-static EFI_GUID my_gEfiHashAlgorithmSha384Guid = {
-  0xefa96432, 0xde33, 0x4dd2, { 0xae, 0xe6, 0x32, 0x8c, 0x33, 0xdf, 0x77, 0x7a }
-};
-
-static EFI_GUID my_gEfiHashAlgorithmSha256Guid = {
-  0x51aa59de, 0xfdf2, 0x4ea3, { 0xbc, 0x63, 0x87, 0x5f, 0xb7, 0x84, 0x2e, 0xe9 }
-};
-
-static EFI_GUID my_gEfiHashAlgorithmSha224Guid = {
-  0x8df01a06, 0x9bd5, 0x4bf7, { 0xb0, 0x21, 0xdb, 0x4f, 0xd9, 0xcc, 0xf4, 0x5b }
-};
-
-static EFI_GUID my_gEfiHashAlgorithmSha1Guid = {
-  0x2ae9d80f, 0x3fb2, 0x4095, { 0xb7, 0xb1, 0xe9, 0x31, 0x57, 0xb9, 0x46, 0xb6 }
-};
-
-static EFI_GUID my_gEfiEventReadyToBootGuid = {
-  0x7ce88fb3, 0x4bd7, 0x4679, { 0x87, 0xa8, 0xa8, 0xd8, 0xde, 0xe5, 0xd, 0x2b }
-};
-
-static EFI_GUID my_gEfiEventMemoryMapChangeGuid = {
-  0x78bee926, 0x692f, 0x48fd, { 0x9e, 0xdb, 0x1, 0x42, 0x2e, 0xf0, 0xd7, 0xab }
-};
-
-static EFI_GUID my_gEfiEventVirtualAddressChangeGuid = {
-  0x13fa7698, 0xc831, 0x49c7, { 0x87, 0xea, 0x8f, 0x43, 0xfc, 0xc2, 0x51, 0x96 }
-};
-
-static EFI_GUID my_gEfiEventExitBootServicesGuid = {
-  0x27abf055, 0xb1b8, 0x4c26, { 0x80, 0x48, 0x74, 0x8f, 0x37, 0xba, 0xa2, 0xdf }
-};
-
-static EFI_GUID my_gEfiDebugPortVariableGuid = {
-  0xeba4e8d2, 0x3858, 0x41ec, { 0xa2, 0x81, 0x26, 0x47, 0xba, 0x96, 0x60, 0xd0 }
-};
-
-static EFI_GUID my_gEfiHiiPlatformSetupFormsetGuid = {
-  0x93039971, 0x8545, 0x4b04, { 0xb4, 0x5e, 0x32, 0xeb, 0x83, 0x26, 0x4, 0xe }
-};
-
-static EFI_GUID my_gEfiHiiDriverHealthFormsetGuid = {
-  0xf22fc20c, 0x8cf4, 0x45eb, { 0x8e, 0x6, 0xad, 0x4e, 0x50, 0xb9, 0x5d, 0xd3 }
-};
-
-static EFI_GUID my_gEfiHiiUserCredentialFormsetGuid = {
-  0x337f4407, 0x5aee, 0x4b83, { 0xb2, 0xa7, 0x4e, 0xad, 0xca, 0x30, 0x88, 0xcd }
-};
-
-static EFI_GUID my_gEfiHiiStandardFormGuid = {
-  0x3bd2f4ec, 0xe524, 0x46e4, { 0xa9, 0xd8, 0x51, 0x1, 0x17, 0x42, 0x55, 0x62 }
-};
-
-static EFI_GUID my_gEfiMemoryOverwriteControlDataGuid = {
-  0xe20939be, 0x32d4, 0x41be, { 0xa1, 0x50, 0x89, 0x7f, 0x85, 0xd4, 0x98, 0x29 }
-};
-
-static EFI_GUID my_gEfiMemoryOverwriteRequestControlLockGuid = {
-  0xbb983ccf, 0x151d, 0x40e1, { 0xa0, 0x7b, 0x4a, 0x17, 0xbe, 0x16, 0x82, 0x92 }
-};
-
-static EFI_GUID my_gEfiCertTypeRsa2048Sha256Guid = {
-  0xa7717414, 0xc616, 0x4977, { 0x94, 0x20, 0x84, 0x47, 0x12, 0xa7, 0x35, 0xbf }
-};
-
-static EFI_GUID my_gEfiEventNotificationTypeCmcGuid = {
-  0x2dce8bb1, 0xbdd7, 0x450e, { 0xb9, 0xad, 0x9c, 0xf4, 0xeb, 0xd4, 0xf8, 0x90 }
-};
-
-static EFI_GUID my_gEfiEventNotificationTypeCpeGuid = {
-  0x4e292f96, 0xd843, 0x4a55, { 0xa8, 0xc2, 0xd4, 0x81, 0xf2, 0x7e, 0xbe, 0xee }
-};
-
-static EFI_GUID my_gEfiEventNotificationTypeMceGuid = {
-  0xe8f56ffe, 0x919c, 0x4cc5, { 0xba, 0x88, 0x65, 0xab, 0xe1, 0x49, 0x13, 0xbb }
-};
-
-static EFI_GUID my_gEfiEventNotificationTypePcieGuid = {
-  0xcf93c01f, 0x1a16, 0x4dfc, { 0xb8, 0xbc, 0x9c, 0x4d, 0xaf, 0x67, 0xc1, 0x4 }
-};
-
-static EFI_GUID my_gEfiEventNotificationTypeInitGuid = {
-  0xcc5263e8, 0x9308, 0x454a, { 0x89, 0xd0, 0x34, 0xb, 0xd3, 0x9b, 0xc9, 0x8e }
-};
-
-static EFI_GUID my_gEfiEventNotificationTypeNmiGuid = {
-  0x5bad89ff, 0xb7e6, 0x42c9, { 0x81, 0x4a, 0xcf, 0x24, 0x85, 0xd6, 0xe9, 0x8a }
-};
-
-static EFI_GUID my_gEfiEventNotificationTypeBootGuid = {
-  0x3d61a466, 0xab40, 0x409a, { 0xa6, 0x98, 0xf3, 0x62, 0xd4, 0x64, 0xb3, 0x8f }
-};
-
-static EFI_GUID my_gEfiEventNotificationTypeDmarGuid = {
-  0x667dd791, 0xc6b3, 0x4c27, { 0x8a, 0x6b, 0xf, 0x8e, 0x72, 0x2d, 0xeb, 0x41 }
-};
-
-static EFI_GUID my_gEfiProcessorGenericErrorSectionGuid = {
-  0x9876ccad, 0x47b4, 0x4bdb, { 0xb6, 0x5e, 0x16, 0xf1, 0x93, 0xc4, 0xf3, 0xdb }
-};
-
-static EFI_GUID my_gEfiProcessorSpecificErrorSectionGuid = {
-  0xdc3ea0b0, 0xa144, 0x4797, { 0xb9, 0x5b, 0x53, 0xfa, 0x24, 0x2b, 0x6e, 0x1d }
-};
-
-static EFI_GUID my_gEfiPlatformMemoryErrorSectionGuid = {
-  0xa5bc1114, 0x6f64, 0x4ede, { 0xb8, 0x63, 0x3e, 0x83, 0xed, 0x7c, 0x83, 0xb1 }
-};
-
-static EFI_GUID my_gEfiPcieErrorSectionGuid = {
-  0xd995e954, 0xbbc1, 0x430f, { 0xad, 0x91, 0xb4, 0x4d, 0xcb, 0x3c, 0x6f, 0x35 }
-};
-
-static EFI_GUID my_gEfiFirmwareErrorSectionGuid = {
-  0x81212a96, 0x9ed, 0x4996, { 0x94, 0x71, 0x8d, 0x72, 0x9c, 0x8e, 0x69, 0xed }
-};
-
-static EFI_GUID my_gEfiPciBusErrorSectionGuid = {
-  0xc5753963, 0x3b84, 0x4095, { 0xbf, 0x78, 0xed, 0xda, 0xd3, 0xf9, 0xc9, 0xdd }
-};
-
-static EFI_GUID my_gEfiPciDevErrorSectionGuid = {
-  0xeb5e4685, 0xca66, 0x4769, { 0xb6, 0xa2, 0x26, 0x6, 0x8b, 0x0, 0x13, 0x26 }
-};
-
-static EFI_GUID my_gEfiDMArGenericErrorSectionGuid = {
-  0x5b51fef7, 0xc79d, 0x4434, { 0x8f, 0x1b, 0xaa, 0x62, 0xde, 0x3e, 0x2c, 0x64 }
-};
-
-static EFI_GUID my_gEfiDirectedIoDMArErrorSectionGuid = {
-  0x71761d37, 0x32b2, 0x45cd, { 0xa7, 0xd0, 0xb0, 0xfe, 0xdd, 0x93, 0xe8, 0xcf }
-};
-
-static EFI_GUID my_gEfiIommuDMArErrorSectionGuid = {
-  0x36f84e1, 0x7f37, 0x428c, { 0xa7, 0x9e, 0x57, 0x5f, 0xdf, 0xaa, 0x84, 0xec }
-};
-
-static EFI_GUID my_gEfiEventUserProfileChangedGuid = {
-  0xbaf1e6de, 0x209e, 0x4adb, { 0x8d, 0x96, 0xfd, 0x8b, 0x71, 0xf3, 0xf6, 0x83 }
-};
-
-static EFI_GUID my_gEfiUserCredentialClassUnknownGuid = {
-  0x5cf32e68, 0x7660, 0x449b, { 0x80, 0xe6, 0x7e, 0xa3, 0x6e, 0x3, 0xf6, 0xa8 }
-};
-
-static EFI_GUID my_gEfiUserCredentialClassPasswordGuid = {
-  0xf8e5058c, 0xccb6, 0x4714, { 0xb2, 0x20, 0x3f, 0x7e, 0x3a, 0x64, 0xb, 0xd1 }
-};
-
-static EFI_GUID my_gEfiUserCredentialClassSmartCardGuid = {
-  0x5f03ba33, 0x8c6b, 0x4c24, { 0xaa, 0x2e, 0x14, 0xa2, 0x65, 0x7b, 0xd4, 0x54 }
-};
-
-static EFI_GUID my_gEfiUserCredentialClassFingerprintGuid = {
-  0x32cba21f, 0xf308, 0x4cbc, { 0x9a, 0xb5, 0xf5, 0xa3, 0x69, 0x9f, 0x4, 0x4a }
-};
-
-static EFI_GUID my_gEfiUserCredentialClassHandprintGuid = {
-  0x5917ef16, 0xf723, 0x4bb9, { 0xa6, 0x4b, 0xd8, 0xc5, 0x32, 0xf4, 0xd8, 0xb5 }
-};
-
-static EFI_GUID my_gEfiUserCredentialClassSecureCardGuid = {
-  0x8a6b4a83, 0x42fe, 0x45d2, { 0xa2, 0xef, 0x46, 0xf0, 0x6c, 0x7d, 0x98, 0x52 }
-};
-
-static EFI_GUID my_gEfiUserInfoAccessSetupAdminGuid = {
-  0x85b75607, 0xf7ce, 0x471e, { 0xb7, 0xe4, 0x2a, 0xea, 0x5f, 0x72, 0x32, 0xee }
-};
-
-static EFI_GUID my_gEfiUserInfoAccessSetupNormalGuid = {
-  0x1db29ae0, 0x9dcb, 0x43bc, { 0x8d, 0x87, 0x5d, 0xa1, 0x49, 0x64, 0xdd, 0xe2 }
-};
-
-static EFI_GUID my_gEfiUserInfoAccessSetupRestrictedGuid = {
-  0xbdb38125, 0x4d63, 0x49f4, { 0x82, 0x12, 0x61, 0xcf, 0x5a, 0x19, 0xa, 0xf8 }
-};
-
-static EFI_GUID my_gEfiImageSecurityDatabaseGuid = {
-  0xd719b2cb, 0x3d3a, 0x4596, { 0xa3, 0xbc, 0xda, 0xd0, 0xe, 0x67, 0x65, 0x6f }
-};
-
-static EFI_GUID my_gEfiCertSha256Guid = {
-  0xc1c41626, 0x504c, 0x4092, { 0xac, 0xa9, 0x41, 0xf9, 0x36, 0x93, 0x43, 0x28 }
-};
-
-static EFI_GUID my_gEfiCertRsa2048Guid = {
-  0x3c5766e8, 0x269c, 0x4e34, { 0xaa, 0x14, 0xed, 0x77, 0x6e, 0x85, 0xb3, 0xb6 }
-};
-
-static EFI_GUID my_gEfiCertRsa2048Sha256Guid = {
-  0xe2b36190, 0x879b, 0x4a3d, { 0xad, 0x8d, 0xf2, 0xe7, 0xbb, 0xa3, 0x27, 0x84 }
-};
-
-static EFI_GUID my_gEfiCertSha1Guid = {
-  0x826ca512, 0xcf10, 0x4ac9, { 0xb1, 0x87, 0xbe, 0x1, 0x49, 0x66, 0x31, 0xbd }
-};
-
-static EFI_GUID my_gEfiCertRsa2048Sha1Guid = {
-  0x67f8444f, 0x8743, 0x48f1, { 0xa3, 0x28, 0x1e, 0xaa, 0xb8, 0x73, 0x60, 0x80 }
-};
-
-static EFI_GUID my_gEfiCertX509Guid = {
-  0xa5c059a1, 0x94e4, 0x4aa7, { 0x87, 0xb5, 0xab, 0x15, 0x5c, 0x2b, 0xf0, 0x72 }
-};
-
-static EFI_GUID my_gEfiKmsFormatGeneric128Guid = {
-  0xec8a3d69, 0x6ddf, 0x4108, { 0x94, 0x76, 0x73, 0x37, 0xfc, 0x52, 0x21, 0x36 }
-};
-
-static EFI_GUID my_gEfiKmsFormatGeneric160Guid = {
-  0xa3b3e6f8, 0xefca, 0x4bc1, { 0x88, 0xfb, 0xcb, 0x87, 0x33, 0x9b, 0x25, 0x79 }
-};
-
-static EFI_GUID my_gEfiKmsFormatGeneric256Guid = {
-  0x70f64793, 0xc323, 0x4261, { 0xac, 0x2c, 0xd8, 0x76, 0xf2, 0x7c, 0x53, 0x45 }
-};
-
-static EFI_GUID my_gEfiKmsFormatGeneric512Guid = {
-  0x978fe043, 0xd7af, 0x422e, { 0x8a, 0x92, 0x2b, 0x48, 0xe4, 0x63, 0xbd, 0xe6 }
-};
-
-static EFI_GUID my_gEfiKmsFormatGeneric1024Guid = {
-  0x43be0b44, 0x874b, 0x4ead, { 0xb0, 0x9c, 0x24, 0x1a, 0x4f, 0xbd, 0x7e, 0xb3 }
-};
-
-static EFI_GUID my_gEfiKmsFormatGeneric2048Guid = {
-  0x40093f23, 0x630c, 0x4626, { 0x9c, 0x48, 0x40, 0x37, 0x3b, 0x19, 0xcb, 0xbe }
-};
-
-static EFI_GUID my_gEfiKmsFormatGeneric3072Guid = {
-  0xb9237513, 0x6c44, 0x4411, { 0xa9, 0x90, 0x21, 0xe5, 0x56, 0xe0, 0x5a, 0xde }
-};
-
-static EFI_GUID my_gEfiKmsFormatMd2128Guid = {
-  0x78be11c4, 0xee44, 0x4a22, { 0x9f, 0x5, 0x3, 0x85, 0x2e, 0xc5, 0xc9, 0x78 }
-};
-
-static EFI_GUID my_gEfiKmsFormatMdc2128Guid = {
-  0xf7ad60f8, 0xefa8, 0x44a3, { 0x91, 0x13, 0x23, 0x1f, 0x39, 0x9e, 0xb4, 0xc7 }
-};
-
-static EFI_GUID my_gEfiKmsFormatMd4128Guid = {
-  0xd1c17aa1, 0xcac5, 0x400f, { 0xbe, 0x17, 0xe2, 0xa2, 0xae, 0x6, 0x67, 0x7c }
-};
-
-static EFI_GUID my_gEfiKmsFormatMdc4128Guid = {
-  0x3fa4f847, 0xd8eb, 0x4df4, { 0xbd, 0x49, 0x10, 0x3a, 0xa, 0x84, 0x7b, 0xbc }
-};
-
-static EFI_GUID my_gEfiKmsFormatMd5128Guid = {
-  0xdcbc3662, 0x9cda, 0x4b52, { 0xa0, 0x4c, 0x82, 0xeb, 0x1d, 0x23, 0x48, 0xc7 }
-};
-
-static EFI_GUID my_gEfiKmsFormatMd5sha128Guid = {
-  0x1c178237, 0x6897, 0x459e, { 0x9d, 0x36, 0x67, 0xce, 0x8e, 0xf9, 0x4f, 0x76 }
-};
-
-static EFI_GUID my_gEfiKmsFormatSha1160Guid = {
-  0x453c5e5a, 0x482d, 0x43f0, { 0x87, 0xc9, 0x59, 0x41, 0xf3, 0xa3, 0x8a, 0xc2 }
-};
-
-static EFI_GUID my_gEfiKmsFormatSha256256Guid = {
-  0x6bb4f5cd, 0x8022, 0x448d, { 0xbc, 0x6d, 0x77, 0x1b, 0xae, 0x93, 0x5f, 0xc6 }
-};
-
-static EFI_GUID my_gEfiKmsFormatSha512512Guid = {
-  0x2f240e12, 0xe14d, 0x475c, { 0x83, 0xb0, 0xef, 0xff, 0x22, 0xd7, 0x7b, 0xe7 }
-};
-
-static EFI_GUID my_gEfiKmsFormatAesxts128Guid = {
-  0x4776e33f, 0xdb47, 0x479a, { 0xa2, 0x5f, 0xa1, 0xcd, 0xa, 0xfa, 0xb3, 0x8b }
-};
-
-static EFI_GUID my_gEfiKmsFormatAesxts256Guid = {
-  0xdc7e8613, 0xc4bb, 0x4db0, { 0x84, 0x62, 0x13, 0x51, 0x13, 0x57, 0xab, 0xe2 }
-};
-
-static EFI_GUID my_gEfiKmsFormatAescbc128Guid = {
-  0xa0e8ee6a, 0xe92, 0x44d4, { 0x86, 0x1b, 0xe, 0xaa, 0x4a, 0xca, 0x44, 0xa2 }
-};
-
-static EFI_GUID my_gEfiKmsFormatAescbc256Guid = {
-  0xd7e69789, 0x1f68, 0x45e8, { 0x96, 0xef, 0x3b, 0x64, 0x7, 0xa5, 0xb2, 0xdc }
-};
-
-static EFI_GUID my_gEfiKmsFormatRsasha11024Guid = {
-  0x56417bed, 0x6bbe, 0x4882, { 0x86, 0xa0, 0x3a, 0xe8, 0xbb, 0x17, 0xf8, 0xf9 }
-};
-
-static EFI_GUID my_gEfiKmsFormatRsasha12048Guid = {
-  0xf66447d4, 0x75a6, 0x463e, { 0xa8, 0x19, 0x7, 0x7f, 0x2d, 0xda, 0x5, 0xe9 }
-};
-
-static EFI_GUID my_gEfiKmsFormatRsasha2562048Guid = {
-  0xa477af13, 0x877d, 0x4060, { 0xba, 0xa1, 0x25, 0xd1, 0xbe, 0xa0, 0x8a, 0xd3 }
-};
-
-static EFI_GUID my_gEfiKmsFormatRsasha2563072Guid = {
-  0x4e1356c2, 0xeed, 0x463f, { 0x81, 0x47, 0x99, 0x33, 0xab, 0xdb, 0xc7, 0xd5 }
-};
-
-static EFI_GUID my_gEfiCertSha224Guid = {
-  0xb6e5233, 0xa65c, 0x44c9, { 0x94, 0x7, 0xd9, 0xab, 0x83, 0xbf, 0xc8, 0xbd }
-};
-
-static EFI_GUID my_gEfiCertSha384Guid = {
-  0xff3e5307, 0x9fd0, 0x48c9, { 0x85, 0xf1, 0x8a, 0xd5, 0x6c, 0x70, 0x1e, 0x1 }
-};
-
-static EFI_GUID my_gEfiCertSha512Guid = {
-  0x93e0fae, 0xa6c4, 0x4f50, { 0x9f, 0x1b, 0xd4, 0x1e, 0x2b, 0x89, 0xc1, 0x9a }
-};
-
-static EFI_GUID my_gEfiCertPkcs7Guid = {
-  0x4aafd29d, 0x68df, 0x49ee, { 0x8a, 0xa9, 0x34, 0x7d, 0x37, 0x56, 0x65, 0xa7 }
-};
-
-static EFI_GUID my_gEfiHashAlgorithmSha1NoPadGuid = {
-  0x24c5dc2f, 0x53e2, 0x40ca, { 0x9e, 0xd6, 0xa5, 0xd9, 0xa4, 0x9f, 0x46, 0x3b }
-};
-
-static EFI_GUID my_gEfiHashAlgorithmSha256NoPadGuid = {
-  0x8628752a, 0x6cb7, 0x4814, { 0x96, 0xfc, 0x24, 0xa8, 0x15, 0xac, 0x22, 0x26 }
-};
-
-static EFI_GUID my_gEfiFmpCapsuleGuid = {
-  0x6dcbd5ed, 0xe82d, 0x4c44, { 0xbd, 0xa1, 0x71, 0x94, 0x19, 0x9a, 0xd9, 0x2a }
-};
-
-static EFI_GUID my_gEfiCertX509Sha256Guid = {
-  0x3bd2a492, 0x96c0, 0x4079, { 0xb4, 0x20, 0xfc, 0xf9, 0x8e, 0xf1, 0x3, 0xed }
-};
-
-static EFI_GUID my_gEfiCertX509Sha384Guid = {
-  0x7076876e, 0x80c2, 0x4ee6, { 0xaa, 0xd2, 0x28, 0xb3, 0x49, 0xa6, 0x86, 0x5b }
-};
-
-static EFI_GUID my_gEfiCertX509Sha512Guid = {
-  0x446dbf63, 0x2502, 0x4cda, { 0xbc, 0xfa, 0x24, 0x65, 0xd2, 0xb0, 0xfe, 0x9d }
-};
-
-static EFI_GUID my_gEfiRngAlgorithmSp80090Hash256Guid = {
-  0xa7af67cb, 0x603b, 0x4d42, { 0xba, 0x21, 0x70, 0xbf, 0xb6, 0x29, 0x3f, 0x96 }
-};
-
-static EFI_GUID my_gEfiRngAlgorithmSp80090Hmac256Guid = {
-  0xc5149b43, 0xae85, 0x4f53, { 0x99, 0x82, 0xb9, 0x43, 0x35, 0xd3, 0xa9, 0xe7 }
-};
-
-static EFI_GUID my_gEfiRngAlgorithmSp80090Ctr256Guid = {
-  0x44f0de6e, 0x4d8c, 0x4045, { 0xa8, 0xc7, 0x4d, 0xd1, 0x68, 0x85, 0x6b, 0x9e }
-};
-
-static EFI_GUID my_gEfiRngAlgorithmX9313DesGuid = {
-  0x63c4785a, 0xca34, 0x4012, { 0xa3, 0xc8, 0xb, 0x6a, 0x32, 0x4f, 0x55, 0x46 }
-};
-
-static EFI_GUID my_gEfiRngAlgorithmX931AesGuid = {
-  0xacd03321, 0x777e, 0x4d3d, { 0xb1, 0xc8, 0x20, 0xcf, 0xd8, 0x88, 0x20, 0xc9 }
-};
-
-static EFI_GUID my_gEfiRngAlgorithmRaw = {
-  0xe43176d7, 0xb6e8, 0x4827, { 0xb7, 0x84, 0x7f, 0xfd, 0xc4, 0xb6, 0x85, 0x61 }
-};
-
-static EFI_GUID my_gEfiAdapterInfoMediaStateGuid = {
-  0xd7c74207, 0xa831, 0x4a26, { 0xb1, 0xf5, 0xd1, 0x93, 0x6, 0x5c, 0xe8, 0xb6 }
-};
-
-static EFI_GUID my_gEfiAdapterInfoNetworkBootGuid = {
-  0x1fbd2960, 0x4130, 0x41e5, { 0x94, 0xac, 0xd2, 0xcf, 0x3, 0x7f, 0xb3, 0x7c }
-};
-
-static EFI_GUID my_gEfiAdapterInfoSanMacAddressGuid = {
-  0x114da5ef, 0x2cf1, 0x4e12, { 0x9b, 0xbb, 0xc4, 0x70, 0xb5, 0x52, 0x5, 0xd9 }
-};
-
-static EFI_GUID my_gEfiCapsuleReportGuid = {
-  0x39b68c46, 0xf7fb, 0x441b, { 0xb6, 0xec, 0x16, 0xb0, 0xf6, 0x98, 0x21, 0xf3 }
-};
-
-static EFI_GUID my_gEfiPropertiesTableGuid = {
-  0x880aaca3, 0x4adc, 0x4a04, { 0x90, 0x79, 0xb7, 0x47, 0x34, 0x8, 0x25, 0xe5 }
-};
-
-static EFI_GUID my_gEfiSystemResourceTableGuid = {
-  0xb122a263, 0x3661, 0x4f68, { 0x99, 0x29, 0x78, 0xf8, 0xb0, 0xd6, 0x21, 0x80 }
-};
-
-static EFI_GUID my_gEfiAdapterInfoUndiIpv6SupportGuid = {
-  0x4bd56be3, 0x4975, 0x4d8a, { 0xa0, 0xad, 0xc4, 0x91, 0x20, 0x4b, 0x5d, 0x4d }
-};
-
-static EFI_GUID my_gEfiRegexSyntaxTypePosixExtendedGuid = {
-  0x5f05b20f, 0x4a56, 0xc231, { 0xfa, 0xb, 0xa7, 0xb1, 0xf1, 0x10, 0x4, 0x1d }
-};
-
-static EFI_GUID my_gEfiRegexSyntaxTypeEcma262Guid = {
-  0x9a473a4a, 0x4ceb, 0xb95a, { 0x41, 0x5e, 0x5b, 0xa0, 0xbc, 0x63, 0x9b, 0x2e }
-};
-
-static EFI_GUID my_gEfiRegexSyntaxTypePerlGuid = {
-  0x63e60a51, 0x497d, 0xd427, { 0xc4, 0xa5, 0xb8, 0xab, 0xdc, 0x3a, 0xae, 0xb6 }
-};
-
-static EFI_GUID my_gEfiPlatformMemory2ErrorSectionGuid = {
-  0x61ec04fc, 0x48e6, 0xd813, { 0x25, 0xc9, 0x8d, 0xaa, 0x44, 0x75, 0xb, 0x12 }
-};
-
-static EFI_GUID my_gEfiBlockIoCryptoAlgoAesXtsGuid = {
-  0x2f87ba6a, 0x5c04, 0x4385, { 0xa7, 0x80, 0xf3, 0xbf, 0x78, 0xa9, 0x7b, 0xec }
-};
-
-static EFI_GUID my_gEfiBlockIoCryptoAlgoAesCbcMsBitlockerGuid = {
-  0x689e4c62, 0x70bf, 0x4cf3, { 0x88, 0xbb, 0x33, 0xb3, 0x18, 0x26, 0x86, 0x70 }
-};
-
-static EFI_GUID my_gEfiPaddingRsassaPkcs1V1P5Guid = {
-  0x9317ec24, 0x7cb0, 0x4d0e, { 0x8b, 0x32, 0x2e, 0xd9, 0x20, 0x9c, 0xd8, 0xaf }
-};
-
-static EFI_GUID my_gEfiPaddingRsassaPssGuid = {
-  0x7b2349e0, 0x522d, 0x4f8e, { 0xb9, 0x27, 0x69, 0xd9, 0x7c, 0x9e, 0x79, 0x5f }
-};
-
-static EFI_GUID my_gEfiPaddingNoneGuid = {
-  0x3629ddb1, 0x228c, 0x452e, { 0xb6, 0x16, 0x9, 0xed, 0x31, 0x6a, 0x97, 0x0 }
-};
-
-static EFI_GUID my_gEfiPaddingRsaesPkcs1V1P5Guid = {
-  0xe1c1d0a9, 0x40b1, 0x4632, { 0xbd, 0xcc, 0xd9, 0xd6, 0xe5, 0x29, 0x56, 0x31 }
-};
-
-static EFI_GUID my_gEfiPaddingRsaesOaepGuid = {
-  0xc1e63ac4, 0xd0cf, 0x4ce6, { 0x83, 0x5b, 0xee, 0xd0, 0xe6, 0xa8, 0xa4, 0x5b }
-};
-
-static EFI_GUID my_gEfiSmbios3TableGuid = {
-  0xf2fd1544, 0x9794, 0x4a2c, { 0x99, 0x2e, 0xe5, 0xbb, 0xcf, 0x20, 0xe3, 0x94 }
-};
-
-static EFI_GUID my_gEfiBootManagerPolicyConsoleGuid = {
-  0xcab0e94c, 0xe15f, 0x11e3, { 0x91, 0x8d, 0xb8, 0xe8, 0x56, 0x2c, 0xba, 0xfa }
-};
-
-static EFI_GUID my_gEfiBootManagerPolicyNetworkGuid = {
-  0xd04159dc, 0xe15f, 0x11e3, { 0xb2, 0x61, 0xb8, 0xe8, 0x56, 0x2c, 0xba, 0xfa }
-};
-
-static EFI_GUID my_gEfiBootManagerPolicyConnectAllGuid = {
-  0x113b2126, 0xfc8a, 0x11e3, { 0xbd, 0x6c, 0xb8, 0xe8, 0x56, 0x2c, 0xba, 0xfa }
-};
-
-static EFI_GUID my_gEfiVirtualDiskGuid = {
-  0x77ab535a, 0x45fc, 0x624b, { 0x55, 0x60, 0xf7, 0xb2, 0x81, 0xd1, 0xf9, 0x6e }
-};
-
-static EFI_GUID my_gEfiVirtualCdGuid = {
-  0x3d5abd30, 0x4175, 0x87ce, { 0x6d, 0x64, 0xd2, 0xad, 0xe5, 0x23, 0xc4, 0xbb }
-};
-
-static EFI_GUID my_gEfiPersistentVirtualDiskGuid = {
-  0x5cea02c9, 0x4d07, 0x69d3, { 0x26, 0x9f, 0x44, 0x96, 0xfb, 0xe0, 0x96, 0xf9 }
-};
-
-static EFI_GUID my_gEfiPersistentVirtualCdGuid = {
-  0x8018188, 0x42cd, 0xbb48, { 0x10, 0xf, 0x53, 0x87, 0xd5, 0x3d, 0xed, 0x3d }
-};
-
-static EFI_GUID my_gEfiMemoryAttributesTableGuid = {
-  0xdcfa911d, 0x26eb, 0x469f, { 0xa2, 0x20, 0x38, 0xb7, 0xdc, 0x46, 0x12, 0x20 }
-};
-
-static EFI_GUID my_gEfiArmProcessorErrorSectionGuid = {
-  0xe19e3d16, 0xbc11, 0x11e4, { 0x9c, 0xaa, 0xc2, 0x5, 0x1d, 0x5d, 0x46, 0xb0 }
-};
-
-static EFI_GUID my_gEfiHiiImageDecoderNameJpegGuid = {
-  0xefefd093, 0xd9b, 0x46eb, { 0xa8, 0x56, 0x48, 0x35, 0x7, 0x0, 0xc9, 0x8 }
-};
-
-static EFI_GUID my_gEfiHiiImageDecoderNamePngGuid = {
-  0xaf060190, 0x5e3a, 0x4025, { 0xaf, 0xbd, 0xe1, 0xf9, 0x5, 0xbf, 0xaa, 0x4c }
-};
-
-static EFI_GUID my_gEfiBttAbstractionGuid = {
-  0x18633bfc, 0x1735, 0x4217, { 0x8a, 0xc9, 0x17, 0x23, 0x92, 0x82, 0xd3, 0xf8 }
-};
-
-static EFI_GUID my_gPeiAprioriFileNameGuid = {
-  0x1b45cc0a, 0x156a, 0x428a, { 0xaf, 0x62, 0x49, 0x86, 0x4d, 0xa0, 0xe6, 0xe6 }
-};
-
-static EFI_GUID my_gAprioriGuid = {
-  0xfc510ee7, 0xffdc, 0x11d4, { 0xbd, 0x41, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiFirmwareFileSystem2Guid = {
-  0x8c8ce578, 0x8a3d, 0x4f1c, { 0x99, 0x35, 0x89, 0x61, 0x85, 0xc3, 0x2d, 0xd3 }
-};
-
-static EFI_GUID my_gEfiFirmwareVolumeTopFileGuid = {
-  0x1ba0062e, 0xc779, 0x4582, { 0x85, 0x66, 0x33, 0x6a, 0xe8, 0xf7, 0x8f, 0x9 }
-};
-
-static EFI_GUID my_gEfiHobMemoryAllocModuleGuid = {
-  0xf8e21975, 0x899, 0x4f58, { 0xa4, 0xbe, 0x55, 0x25, 0xa9, 0xc6, 0xd7, 0x7a }
-};
-
-static EFI_GUID my_gEfiHobMemoryAllocStackGuid = {
-  0x4ed4bf27, 0x4092, 0x42e9, { 0x80, 0x7d, 0x52, 0x7b, 0x1d, 0x0, 0xc9, 0xbd }
-};
-
-static EFI_GUID my_gEfiHobMemoryAllocBspStoreGuid = {
-  0x564b33cd, 0xc92a, 0x4593, { 0x90, 0xbf, 0x24, 0x73, 0xe4, 0x3c, 0x63, 0x22 }
-};
-
-static EFI_GUID my_gEfiEventLegacyBootGuid = {
-  0x2a571201, 0x4966, 0x47f6, { 0x8b, 0x86, 0xf3, 0x1e, 0x41, 0xf3, 0x2f, 0x10 }
-};
-
-static EFI_GUID my_gEfiHobListGuid = {
-  0x7739f24c, 0x93d7, 0x11d4, { 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiDxeServicesTableGuid = {
-  0x5ad34ba, 0x6f02, 0x4214, { 0x95, 0x2e, 0x4d, 0xa0, 0x39, 0x8e, 0x2b, 0xb9 }
-};
-
-static EFI_GUID my_gEfiMdePkgTokenSpaceGuid = {
-  0x914aebe7, 0x4635, 0x459b, { 0xaa, 0x1c, 0x11, 0xe2, 0x19, 0xb0, 0x3a, 0x10 }
-};
-
-static EFI_GUID my_gEfiHardwareErrorVariableGuid = {
-  0x414e6bdd, 0xe47b, 0x47cc, { 0xb2, 0x44, 0xbb, 0x61, 0x2, 0xc, 0xf5, 0x16 }
-};
-
-static EFI_GUID my_gEfiEventDxeDispatchGuid = {
-  0x7081e22f, 0xcac6, 0x4053, { 0x94, 0x68, 0x67, 0x57, 0x82, 0xcf, 0x88, 0xe5 }
-};
-
-static EFI_GUID my_gEfiDiskInfoIdeInterfaceGuid = {
-  0x5e948fe3, 0x26d3, 0x42b5, { 0xaf, 0x17, 0x61, 0x2, 0x87, 0x18, 0x8d, 0xec }
-};
-
-static EFI_GUID my_gEfiDiskInfoScsiInterfaceGuid = {
-  0x8f74baa, 0xea36, 0x41d9, { 0x95, 0x21, 0x21, 0xa7, 0xf, 0x87, 0x80, 0xbc }
-};
-
-static EFI_GUID my_gEfiDiskInfoUsbInterfaceGuid = {
-  0xcb871572, 0xc11a, 0x47b5, { 0xb4, 0x92, 0x67, 0x5e, 0xaf, 0xa7, 0x77, 0x27 }
-};
-
-static EFI_GUID my_gEfiDiskInfoAhciInterfaceGuid = {
-  0x9e498932, 0x4abc, 0x45af, { 0xa3, 0x4d, 0x2, 0x47, 0x78, 0x7b, 0xe7, 0xc6 }
-};
-
-static EFI_GUID my_gEfiStatusCodeDataTypeStringGuid = {
-  0x92d11080, 0x496f, 0x4d95, { 0xbe, 0x7e, 0x3, 0x74, 0x88, 0x38, 0x2b, 0xa }
-};
-
-static EFI_GUID my_gEfiStatusCodeSpecificDataGuid = {
-  0x335984bd, 0xe805, 0x409a, { 0xb8, 0xf8, 0xd2, 0x7e, 0xce, 0x5f, 0xf7, 0xa6 }
-};
-
-static EFI_GUID my_gEfiFirmwareFileSystem3Guid = {
-  0x5473c07a, 0x3dcb, 0x4dca, { 0xbd, 0x6f, 0x1e, 0x96, 0x89, 0xe7, 0x34, 0x9a }
-};
-
-static EFI_GUID my_gEfiEndOfDxeEventGroupGuid = {
-  0x2ce967a, 0xdd7e, 0x4ffc, { 0x9e, 0xe7, 0x81, 0xc, 0xf0, 0x47, 0x8, 0x80 }
-};
-
-static EFI_GUID my_gEfiFirmwareContentsSignedGuid = {
-  0xf9d89e8, 0x9259, 0x4f76, { 0xa5, 0xaf, 0xc, 0x89, 0xe3, 0x40, 0x23, 0xdf }
-};
-
-static EFI_GUID my_gEfiVectorHandoffTableGuid = {
-  0x996ec11c, 0x5397, 0x4e73, { 0xb5, 0x8f, 0x82, 0x7e, 0x52, 0x90, 0x6d, 0xef }
-};
-
-static EFI_GUID my_gAdapterInfoPlatformSecurityGuid = {
-  0x6be272c7, 0x1320, 0x4ccd, { 0x90, 0x17, 0xd4, 0x61, 0x2c, 0x1, 0x2b, 0x25 }
-};
-
-static EFI_GUID my_gEfiDiskInfoNvmeInterfaceGuid = {
-  0x3ab14680, 0x5d3f, 0x4a4d, { 0xbc, 0xdc, 0xcc, 0x38, 0x0, 0x18, 0xc7, 0xf7 }
-};
-
-static EFI_GUID my_gEfiGraphicsInfoHobGuid = {
-  0x39f62cce, 0x6825, 0x4669, { 0xbb, 0x56, 0x54, 0x1a, 0xba, 0x75, 0x3a, 0x7 }
-};
-
-static EFI_GUID my_gEfiDiskInfoUfsInterfaceGuid = {
-  0x4b3029cc, 0x6b98, 0x47fb, { 0xbc, 0x96, 0x76, 0xdc, 0xb8, 0x4, 0x41, 0xf0 }
-};
-
-static EFI_GUID my_gEfiGraphicsDeviceInfoHobGuid = {
-  0xe5cb2ac9, 0xd35d, 0x4430, { 0x93, 0x6e, 0x1d, 0xe3, 0x32, 0x47, 0x8d, 0xe7 }
-};
-
-static EFI_GUID my_gEfiDiskInfoSdMmcInterfaceGuid = {
-  0x8deec992, 0xd39c, 0x4a5c, { 0xab, 0x6b, 0x98, 0x6e, 0x14, 0x24, 0x2b, 0x9d }
-};
-
-static EFI_GUID my_gWindowsUxCapsuleGuid = {
-  0x3b8c8162, 0x188c, 0x46a4, { 0xae, 0xc9, 0xbe, 0x43, 0xf1, 0xd6, 0x56, 0x97 }
-};
-
-static EFI_GUID my_gEfiIa32X64ErrorTypeCacheCheckGuid = {
-  0xa55701f5, 0xe3ef, 0x43de, { 0xac, 0x72, 0x24, 0x9b, 0x57, 0x3f, 0xad, 0x2c }
-};
-
-static EFI_GUID my_gEfiIa32X64ErrorTypeTlbCheckGuid = {
-  0xfc06b535, 0x5e1f, 0x4562, { 0x9f, 0x25, 0xa, 0x3b, 0x9a, 0xdb, 0x63, 0xc3 }
-};
-
-static EFI_GUID my_gEfiIa32X64ErrorTypeBusCheckGuid = {
-  0x1cf3f8b3, 0xc5b1, 0x49a2, { 0xaa, 0x59, 0x5e, 0xef, 0x92, 0xff, 0xa6, 0x3c }
-};
-
-static EFI_GUID my_gEfiIa32X64ErrorTypeMsCheckGuid = {
-  0x48ab7f57, 0xdc34, 0x4f6c, { 0xa7, 0xd3, 0xb0, 0xb5, 0xb0, 0xa7, 0x43, 0x14 }
-};
-
-static EFI_GUID my_gEfiPeiMasterBootModePpiGuid = {
-  0x7408d748, 0xfc8c, 0x4ee6, { 0x92, 0x88, 0xc4, 0xbe, 0xc0, 0x92, 0xa4, 0x10 }
-};
-
-static EFI_GUID my_gEfiDxeIplPpiGuid = {
-  0xae8ce5d, 0xe448, 0x4437, { 0xa8, 0xd7, 0xeb, 0xf5, 0xf1, 0x94, 0xf7, 0x31 }
-};
-
-static EFI_GUID my_gEfiPeiMemoryDiscoveredPpiGuid = {
-  0xf894643d, 0xc449, 0x42d1, { 0x8e, 0xa8, 0x85, 0xbd, 0xd8, 0xc6, 0x5b, 0xde }
-};
-
-static EFI_GUID my_gEfiPeiBootInRecoveryModePpiGuid = {
-  0x17ee496a, 0xd8e4, 0x4b9a, { 0x94, 0xd1, 0xce, 0x82, 0x72, 0x30, 0x8, 0x50 }
-};
-
-static EFI_GUID my_gEfiEndOfPeiSignalPpiGuid = {
-  0x605ea650, 0xc65c, 0x42e1, { 0xba, 0x80, 0x91, 0xa5, 0x2a, 0xb6, 0x18, 0xc6 }
-};
-
-static EFI_GUID my_gEfiPeiResetPpiGuid = {
-  0xef398d58, 0x9dfd, 0x4103, { 0xbf, 0x94, 0x78, 0xc6, 0xf4, 0xfe, 0x71, 0x2f }
-};
-
-static EFI_GUID my_gEfiPeiStatusCodePpiGuid = {
-  0x229832d3, 0x7a30, 0x4b36, { 0xb8, 0x27, 0xf4, 0xc, 0xb7, 0xd4, 0x54, 0x36 }
-};
-
-static EFI_GUID my_gEfiPeiSecurity2PpiGuid = {
-  0xdcd0be23, 0x9586, 0x40f4, { 0xb6, 0x43, 0x6, 0x52, 0x2c, 0xed, 0x4e, 0xde }
-};
-
-static EFI_GUID my_gEfiTemporaryRamSupportPpiGuid = {
-  0xdbe23aa9, 0xa345, 0x4b97, { 0x85, 0xb6, 0xb2, 0x26, 0xf1, 0x61, 0x73, 0x89 }
-};
-
-static EFI_GUID my_gEfiPeiCpuIoPpiInstalledGuid = {
-  0xe6af1f7b, 0xfc3f, 0x46da, { 0xa8, 0x28, 0xa3, 0xb4, 0x57, 0xa4, 0x42, 0x82 }
-};
-
-static EFI_GUID my_gEfiPciCfg2PpiGuid = {
-  0x57a449a, 0x1fdc, 0x4c06, { 0xbf, 0xc9, 0xf5, 0x3f, 0x6a, 0x99, 0xbb, 0x92 }
-};
-
-static EFI_GUID my_gEfiPeiStallPpiGuid = {
-  0x1f4c6f90, 0xb06b, 0x48d8, { 0xa2, 0x1, 0xba, 0xe5, 0xf1, 0xcd, 0x7d, 0x56 }
-};
-
-static EFI_GUID my_gEfiPeiReadOnlyVariable2PpiGuid = {
-  0x2ab86ef5, 0xecb5, 0x4134, { 0xb5, 0x56, 0x38, 0x54, 0xca, 0x1f, 0xe1, 0xb4 }
-};
-
-static EFI_GUID my_gEfiSecPlatformInformationPpiGuid = {
-  0x6f8c2b35, 0xfef4, 0x448d, { 0x82, 0x56, 0xe1, 0x1b, 0x19, 0xd6, 0x10, 0x77 }
-};
-
-static EFI_GUID my_gEfiPeiLoadedImagePpiGuid = {
-  0xc1fcd448, 0x6300, 0x4458, { 0xb8, 0x64, 0x28, 0xdf, 0x1, 0x53, 0x64, 0xbc }
-};
-
-static EFI_GUID my_gEfiPeiSmbus2PpiGuid = {
-  0x9ca93627, 0xb65b, 0x4324, { 0xa2, 0x2, 0xc0, 0xb4, 0x61, 0x76, 0x45, 0x43 }
-};
-
-static EFI_GUID my_gEfiPeiFirmwareVolumeInfoPpiGuid = {
-  0x49edb1c1, 0xbf21, 0x4761, { 0xbb, 0x12, 0xeb, 0x0, 0x31, 0xaa, 0xbb, 0x39 }
-};
-
-static EFI_GUID my_gEfiPeiLoadFilePpiGuid = {
-  0xb9e0abfe, 0x5979, 0x4914, { 0x97, 0x7f, 0x6d, 0xee, 0x78, 0xc2, 0x78, 0xa6 }
-};
-
-static EFI_GUID my_gEfiPeiDecompressPpiGuid = {
-  0x1a36e4e7, 0xfab6, 0x476a, { 0x8e, 0x75, 0x69, 0x5a, 0x5, 0x76, 0xfd, 0xd7 }
-};
-
-static EFI_GUID my_gPcdPpiGuid = {
-  0x6e81c58, 0x4ad7, 0x44bc, { 0x83, 0x90, 0xf1, 0x2, 0x65, 0xf7, 0x24, 0x80 }
-};
-
-static EFI_GUID my_gGetPcdInfoPpiGuid = {
-  0x4d8b155b, 0xc059, 0x4c8f, { 0x89, 0x26, 0x6, 0xfd, 0x43, 0x31, 0xdb, 0x8a }
-};
-
-static EFI_GUID my_gEfiPeiRecoveryModulePpiGuid = {
-  0xfb6d9542, 0x612d, 0x4f45, { 0x87, 0x2f, 0x5c, 0xff, 0x52, 0xe9, 0x3d, 0xcf }
-};
-
-static EFI_GUID my_gEfiPeiDeviceRecoveryModulePpiGuid = {
-  0xde2ce25, 0x446a, 0x45a7, { 0xbf, 0xc9, 0x37, 0xda, 0x26, 0x34, 0x4b, 0x37 }
-};
-
-static EFI_GUID my_gEfiPeiVirtualBlockIoPpiGuid = {
-  0x695d8aa1, 0x42ee, 0x4c46, { 0x80, 0x5c, 0x6e, 0xa6, 0xbc, 0xe7, 0x99, 0xe3 }
-};
-
-static EFI_GUID my_gEfiPeiS3Resume2PpiGuid = {
-  0x6d582dbc, 0xdb85, 0x4514, { 0x8f, 0xcc, 0x5a, 0xdf, 0x62, 0x27, 0xb1, 0x47 }
-};
-
-static EFI_GUID my_gEfiPeiRscHandlerPpiGuid = {
-  0x65d394, 0x9951, 0x4144, { 0x82, 0xa3, 0xa, 0xfc, 0x85, 0x79, 0xc2, 0x51 }
-};
-
-static EFI_GUID my_gEfiPeiPcdPpiGuid = {
-  0x1f34d25, 0x4de2, 0x23ad, { 0x3f, 0xf3, 0x36, 0x35, 0x3f, 0xf3, 0x23, 0xf1 }
-};
-
-static EFI_GUID my_gEfiGetPcdInfoPpiGuid = {
-  0xa60c6b59, 0xe459, 0x425d, { 0x9c, 0x69, 0xb, 0xcc, 0x9c, 0xb2, 0x7d, 0x81 }
-};
-
-static EFI_GUID my_gEfiTemporaryRamDonePpiGuid = {
-  0xceab683c, 0xec56, 0x4a2d, { 0xa9, 0x6, 0x40, 0x53, 0xfa, 0x4e, 0x9c, 0x16 }
-};
-
-static EFI_GUID my_gEfiVectorHandoffInfoPpiGuid = {
-  0x3cd652b4, 0x6d33, 0x4dce, { 0x89, 0xdb, 0x83, 0xdf, 0x97, 0x66, 0xfc, 0xca }
-};
-
-static EFI_GUID my_gEfiIsaHcPpiGuid = {
-  0x8d48bd70, 0xc8a3, 0x4c06, { 0x90, 0x1b, 0x74, 0x79, 0x46, 0xaa, 0xc3, 0x58 }
-};
-
-static EFI_GUID my_gEfiSioPpiGuid = {
-  0x23a464ad, 0xcb83, 0x48b8, { 0x94, 0xab, 0x1a, 0x6f, 0xef, 0xcf, 0xe5, 0x22 }
-};
-
-static EFI_GUID my_gEfiPeiI2cMasterPpiGuid = {
-  0xb3bfab9b, 0x9f9c, 0x4e8b, { 0xad, 0x37, 0x7f, 0x8c, 0x51, 0xfc, 0x62, 0x80 }
-};
-
-static EFI_GUID my_gEfiPeiFirmwareVolumeInfo2PpiGuid = {
-  0xea7ca24b, 0xded5, 0x4dad, { 0xa3, 0x89, 0xbf, 0x82, 0x7e, 0x8f, 0x9b, 0x38 }
-};
-
-static EFI_GUID my_gEfiPeiGraphicsPpiGuid = {
-  0x6ecd1463, 0x4a4a, 0x461b, { 0xaf, 0x5f, 0x5a, 0x33, 0xe3, 0xb2, 0x16, 0x2b }
-};
-
-static EFI_GUID my_gEfiPeiMpServicesPpiGuid = {
-  0xee16160a, 0xe8be, 0x47a6, { 0x82, 0xa, 0xc6, 0x90, 0xd, 0xb0, 0x25, 0xa }
-};
-
-static EFI_GUID my_gEfiPeiCapsulePpiGuid = {
-  0x3acf33ee, 0xd892, 0x40f4, { 0xa2, 0xfc, 0x38, 0x54, 0xd2, 0xe1, 0x32, 0x3d }
-};
-
-static EFI_GUID my_gEfiPeiReset2PpiGuid = {
-  0x6cc45765, 0xcce4, 0x42fd, { 0xbc, 0x56, 0x1, 0x1a, 0xaa, 0xc6, 0xc9, 0xa8 }
-};
-
-static EFI_GUID my_gEfiPeiVirtualBlockIo2PpiGuid = {
-  0x26cc0fad, 0xbeb3, 0x478a, { 0x91, 0xb2, 0xc, 0x18, 0x8f, 0x72, 0x61, 0x98 }
-};
-
-static EFI_GUID my_gEfiSecPlatformInformation2PpiGuid = {
-  0x9e9f374b, 0x8f16, 0x4230, { 0x98, 0x24, 0x58, 0x46, 0xee, 0x76, 0x6a, 0x97 }
-};
-
-static EFI_GUID my_gEfiSecHobDataPpiGuid = {
-  0x3ebdaf20, 0x6667, 0x40d8, { 0xb4, 0xee, 0xf5, 0x99, 0x9a, 0xc1, 0xb7, 0x1f }
-};
-
-static EFI_GUID my_gPcdProtocolGuid = {
-  0x11b34006, 0xd85b, 0x4d0a, { 0xa2, 0x90, 0xd5, 0xa5, 0x71, 0x31, 0xe, 0xf7 }
-};
-
-static EFI_GUID my_gGetPcdInfoProtocolGuid = {
-  0x5be40f57, 0xfa68, 0x4610, { 0xbb, 0xbf, 0xe9, 0xc5, 0xfc, 0xda, 0xd3, 0x65 }
-};
-
-static EFI_GUID my_gEfiBdsArchProtocolGuid = {
-  0x665e3ff6, 0x46cc, 0x11d4, { 0x9a, 0x38, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiCpuArchProtocolGuid = {
-  0x26baccb1, 0x6f42, 0x11d4, { 0xbc, 0xe7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiMetronomeArchProtocolGuid = {
-  0x26baccb2, 0x6f42, 0x11d4, { 0xbc, 0xe7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiMonotonicCounterArchProtocolGuid = {
-  0x1da97072, 0xbddc, 0x4b30, { 0x99, 0xf1, 0x72, 0xa0, 0xb5, 0x6f, 0xff, 0x2a }
-};
-
-static EFI_GUID my_gEfiRealTimeClockArchProtocolGuid = {
-  0x27cfac87, 0x46cc, 0x11d4, { 0x9a, 0x38, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiResetArchProtocolGuid = {
-  0x27cfac88, 0x46cc, 0x11d4, { 0x9a, 0x38, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiRuntimeArchProtocolGuid = {
-  0xb7dfb4e1, 0x52f, 0x449f, { 0x87, 0xbe, 0x98, 0x18, 0xfc, 0x91, 0xb7, 0x33 }
-};
-
-static EFI_GUID my_gEfiSecurityArchProtocolGuid = {
-  0xa46423e3, 0x4617, 0x49f1, { 0xb9, 0xff, 0xd1, 0xbf, 0xa9, 0x11, 0x58, 0x39 }
-};
-
-static EFI_GUID my_gEfiSecurityPolicyProtocolGuid = {
-  0x78e4d245, 0xcd4d, 0x4a05, { 0xa2, 0xba, 0x47, 0x43, 0xe8, 0x6c, 0xfc, 0xab }
-};
-
-static EFI_GUID my_gEfiTimerArchProtocolGuid = {
-  0x26baccb3, 0x6f42, 0x11d4, { 0xbc, 0xe7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiVariableWriteArchProtocolGuid = {
-  0x6441f818, 0x6362, 0x4e44, { 0xb5, 0x70, 0x7d, 0xba, 0x31, 0xdd, 0x24, 0x53 }
-};
-
-static EFI_GUID my_gEfiVariableArchProtocolGuid = {
-  0x1e5668e2, 0x8481, 0x11d4, { 0xbc, 0xf1, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiWatchdogTimerArchProtocolGuid = {
-  0x665e3ff5, 0x46cc, 0x11d4, { 0x9a, 0x38, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiStatusCodeRuntimeProtocolGuid = {
-  0xd2b2b828, 0x826, 0x48a7, { 0xb3, 0xdf, 0x98, 0x3c, 0x0, 0x60, 0x24, 0xf0 }
-};
-
-static EFI_GUID my_gEfiSmbusHcProtocolGuid = {
-  0xe49d33ed, 0x513d, 0x4634, { 0xb6, 0x98, 0x6f, 0x55, 0xaa, 0x75, 0x1c, 0x1b }
-};
-
-static EFI_GUID my_gEfiFirmwareVolume2ProtocolGuid = {
-  0x220e73b6, 0x6bdb, 0x4413, { 0x84, 0x5, 0xb9, 0x74, 0xb1, 0x8, 0x61, 0x9a }
-};
-
-static EFI_GUID my_gEfiFirmwareVolumeBlockProtocolGuid = {
-  0x8f644fa9, 0xe850, 0x4db1, { 0x9c, 0xe2, 0xb, 0x44, 0x69, 0x8e, 0x8d, 0xa4 }
-};
-
-static EFI_GUID my_gEfiCapsuleArchProtocolGuid = {
-  0x5053697e, 0x2cbc, 0x4819, { 0x90, 0xd9, 0x5, 0x80, 0xde, 0xee, 0x57, 0x54 }
-};
-
-static EFI_GUID my_gEfiMpServiceProtocolGuid = {
-  0x3fdda605, 0xa76e, 0x4f46, { 0xad, 0x29, 0x12, 0xf4, 0x53, 0x1b, 0x3d, 0x8 }
-};
-
-static EFI_GUID my_gEfiPciHostBridgeResourceAllocationProtocolGuid = {
-  0xcf8034be, 0x6768, 0x4d8b, { 0xb7, 0x39, 0x7c, 0xce, 0x68, 0x3a, 0x9f, 0xbe }
-};
-
-static EFI_GUID my_gEfiPciPlatformProtocolGuid = {
-  0x7d75280, 0x27d4, 0x4d69, { 0x90, 0xd0, 0x56, 0x43, 0xe2, 0x38, 0xb3, 0x41 }
-};
-
-static EFI_GUID my_gEfiPciOverrideProtocolGuid = {
-  0xb5b35764, 0x460c, 0x4a06, { 0x99, 0xfc, 0x77, 0xa1, 0x7c, 0x1b, 0x5c, 0xeb }
-};
-
-static EFI_GUID my_gEfiPciEnumerationCompleteProtocolGuid = {
-  0x30cfe3e7, 0x3de1, 0x4586, { 0xbe, 0x20, 0xde, 0xab, 0xa1, 0xb3, 0xb7, 0x93 }
-};
-
-static EFI_GUID my_gEfiIncompatiblePciDeviceSupportProtocolGuid = {
-  0xeb23f55a, 0x7863, 0x4ac2, { 0x8d, 0x3d, 0x95, 0x65, 0x35, 0xde, 0x3, 0x75 }
-};
-
-static EFI_GUID my_gEfiPciHotPlugInitProtocolGuid = {
-  0xaa0e8bc1, 0xdabc, 0x46b0, { 0xa8, 0x44, 0x37, 0xb8, 0x16, 0x9b, 0x2b, 0xea }
-};
-
-static EFI_GUID my_gEfiPciHotPlugRequestProtocolGuid = {
-  0x19cb87ab, 0x2cb9, 0x4665, { 0x83, 0x60, 0xdd, 0xcf, 0x60, 0x54, 0xf7, 0x9d }
-};
-
-static EFI_GUID my_gEfiIdeControllerInitProtocolGuid = {
-  0xa1e37052, 0x80d9, 0x4e65, { 0xa3, 0x17, 0x3e, 0x9a, 0x55, 0xc4, 0x3e, 0xc9 }
-};
-
-static EFI_GUID my_gEfiDiskInfoProtocolGuid = {
-  0xd432a67f, 0x14dc, 0x484b, { 0xb3, 0xbb, 0x3f, 0x2, 0x91, 0x84, 0x93, 0x27 }
-};
-
-static EFI_GUID my_gEfiSmbiosProtocolGuid = {
-  0x3583ff6, 0xcb36, 0x4940, { 0x94, 0x7e, 0xb9, 0xb3, 0x9f, 0x4a, 0xfa, 0xf7 }
-};
-
-static EFI_GUID my_gEfiS3SaveStateProtocolGuid = {
-  0xe857caf6, 0xc046, 0x45dc, { 0xbe, 0x3f, 0xee, 0x7, 0x65, 0xfb, 0xa8, 0x87 }
-};
-
-static EFI_GUID my_gEfiS3SmmSaveStateProtocolGuid = {
-  0x320afe62, 0xe593, 0x49cb, { 0xa9, 0xf1, 0xd4, 0xc2, 0xf4, 0xaf, 0x1, 0x4c }
-};
-
-static EFI_GUID my_gEfiRscHandlerProtocolGuid = {
-  0x86212936, 0xe76, 0x41c8, { 0xa0, 0x3a, 0x2a, 0xf2, 0xfc, 0x1c, 0x39, 0xe2 }
-};
-
-static EFI_GUID my_gEfiSmmRscHandlerProtocolGuid = {
-  0x2ff29fa7, 0x5e80, 0x4ed9, { 0xb3, 0x80, 0x1, 0x7d, 0x3c, 0x55, 0x4f, 0xf4 }
-};
-
-static EFI_GUID my_gEfiAcpiSdtProtocolGuid = {
-  0xeb97088e, 0xcfdf, 0x49c6, { 0xbe, 0x4b, 0xd9, 0x6, 0xa5, 0xb2, 0xe, 0x86 }
-};
-
-static EFI_GUID my_gEfiSioProtocolGuid = {
-  0x215fdd18, 0xbd50, 0x4feb, { 0x89, 0xb, 0x58, 0xca, 0xb, 0x47, 0x39, 0xe9 }
-};
-
-static EFI_GUID my_gEfiSmmCpuIo2ProtocolGuid = {
-  0x3242a9d8, 0xce70, 0x4aa0, { 0x95, 0x5d, 0x5e, 0x7b, 0x14, 0xd, 0xe4, 0xd2 }
-};
-
-static EFI_GUID my_gEfiSmmBase2ProtocolGuid = {
-  0xf4ccbfb7, 0xf6e0, 0x47fd, { 0x9d, 0xd4, 0x10, 0xa8, 0xf1, 0x50, 0xc1, 0x91 }
-};
-
-static EFI_GUID my_gEfiSmmAccess2ProtocolGuid = {
-  0xc2702b74, 0x800c, 0x4131, { 0x87, 0x46, 0x8f, 0xb5, 0xb8, 0x9c, 0xe4, 0xac }
-};
-
-static EFI_GUID my_gEfiSmmControl2ProtocolGuid = {
-  0x843dc720, 0xab1e, 0x42cb, { 0x93, 0x57, 0x8a, 0x0, 0x78, 0xf3, 0x56, 0x1b }
-};
-
-static EFI_GUID my_gEfiSmmConfigurationProtocolGuid = {
-  0x26eeb3de, 0xb689, 0x492e, { 0x80, 0xf0, 0xbe, 0x8b, 0xd7, 0xda, 0x4b, 0xa7 }
-};
-
-static EFI_GUID my_gEfiSmmReadyToLockProtocolGuid = {
-  0x47b7fa8c, 0xf4bd, 0x4af6, { 0x82, 0x0, 0x33, 0x30, 0x86, 0xf0, 0xd2, 0xc8 }
-};
-
-static EFI_GUID my_gEfiDxeSmmReadyToLockProtocolGuid = {
-  0x60ff8964, 0xe906, 0x41d0, { 0xaf, 0xed, 0xf2, 0x41, 0xe9, 0x74, 0xe0, 0x8e }
-};
-
-static EFI_GUID my_gEfiSmmCommunicationProtocolGuid = {
-  0xc68ed8e2, 0x9dc6, 0x4cbd, { 0x9d, 0x94, 0xdb, 0x65, 0xac, 0xc5, 0xc3, 0x32 }
-};
-
-static EFI_GUID my_gEfiSmmStatusCodeProtocolGuid = {
-  0x6afd2b77, 0x98c1, 0x4acd, { 0xa6, 0xf9, 0x8a, 0x94, 0x39, 0xde, 0xf, 0xb1 }
-};
-
-static EFI_GUID my_gEfiSmmCpuProtocolGuid = {
-  0xeb346b97, 0x975f, 0x4a9f, { 0x8b, 0x22, 0xf8, 0xe9, 0x2b, 0xb3, 0xd5, 0x69 }
-};
-
-static EFI_GUID my_gEfiSmmPciRootBridgeIoProtocolGuid = {
-  0x8bc1714d, 0xffcb, 0x41c3, { 0x89, 0xdc, 0x6c, 0x74, 0xd0, 0x6d, 0x98, 0xea }
-};
-
-static EFI_GUID my_gEfiSmmSwDispatch2ProtocolGuid = {
-  0x18a3c6dc, 0x5eea, 0x48c8, { 0xa1, 0xc1, 0xb5, 0x33, 0x89, 0xf9, 0x89, 0x99 }
-};
-
-static EFI_GUID my_gEfiSmmSxDispatch2ProtocolGuid = {
-  0x456d2859, 0xa84b, 0x4e47, { 0xa2, 0xee, 0x32, 0x76, 0xd8, 0x86, 0x99, 0x7d }
-};
-
-static EFI_GUID my_gEfiSmmPeriodicTimerDispatch2ProtocolGuid = {
-  0x4cec368e, 0x8e8e, 0x4d71, { 0x8b, 0xe1, 0x95, 0x8c, 0x45, 0xfc, 0x8a, 0x53 }
-};
-
-static EFI_GUID my_gEfiSmmUsbDispatch2ProtocolGuid = {
-  0xee9b8d90, 0xc5a6, 0x40a2, { 0xbd, 0xe2, 0x52, 0x55, 0x8d, 0x33, 0xcc, 0xa1 }
-};
-
-static EFI_GUID my_gEfiSmmGpiDispatch2ProtocolGuid = {
-  0x25566b03, 0xb577, 0x4cbf, { 0x95, 0x8c, 0xed, 0x66, 0x3e, 0xa2, 0x43, 0x80 }
-};
-
-static EFI_GUID my_gEfiSmmStandbyButtonDispatch2ProtocolGuid = {
-  0x7300c4a1, 0x43f2, 0x4017, { 0xa5, 0x1b, 0xc8, 0x1a, 0x7f, 0x40, 0x58, 0x5b }
-};
-
-static EFI_GUID my_gEfiSmmPowerButtonDispatch2ProtocolGuid = {
-  0x1b1183fa, 0x1823, 0x46a7, { 0x88, 0x72, 0x9c, 0x57, 0x87, 0x55, 0x40, 0x9d }
-};
-
-static EFI_GUID my_gEfiSmmIoTrapDispatch2ProtocolGuid = {
-  0x58dc368d, 0x7bfa, 0x4e77, { 0xab, 0xbc, 0xe, 0x29, 0x41, 0x8d, 0xf9, 0x30 }
-};
-
-static EFI_GUID my_gEfiPcdProtocolGuid = {
-  0x13a3f0f6, 0x264a, 0x3ef0, { 0xf2, 0xe0, 0xde, 0xc5, 0x12, 0x34, 0x2f, 0x34 }
-};
-
-static EFI_GUID my_gEfiCpuIo2ProtocolGuid = {
-  0xad61f191, 0xae5f, 0x4c0e, { 0xb9, 0xfa, 0xe8, 0x69, 0xd2, 0x88, 0xc6, 0x4f }
-};
-
-static EFI_GUID my_gEfiLegacyRegion2ProtocolGuid = {
-  0x70101eaf, 0x85, 0x440c, { 0xb3, 0x56, 0x8e, 0xe3, 0x6f, 0xef, 0x24, 0xf0 }
-};
-
-static EFI_GUID my_gEfiSalMcaInitPmiProtocolGuid = {
-  0xb60dc6e8, 0x3b6f, 0x11d5, { 0xaf, 0x9, 0x0, 0xa0, 0xc9, 0x44, 0xa0, 0x5b }
-};
-
-static EFI_GUID my_gEfiExtendedSalBootServiceProtocolGuid = {
-  0xde0ee9a4, 0x3c7a, 0x44f2, { 0xb7, 0x8b, 0xe3, 0xcc, 0xd6, 0x9c, 0x3a, 0xf7 }
-};
-
-static EFI_GUID my_gEfiExtendedSalBaseIoServicesProtocolGuid = {
-  0x5aea42b5, 0x31e1, 0x4515, { 0xbc, 0x31, 0xb8, 0xd5, 0x25, 0x75, 0x65, 0xa6 }
-};
-
-static EFI_GUID my_gEfiExtendedSalStallServicesProtocolGuid = {
-  0x53a58d06, 0xac27, 0x4d8c, { 0xb5, 0xe9, 0xf0, 0x8a, 0x80, 0x65, 0x41, 0x70 }
-};
-
-static EFI_GUID my_gEfiExtendedSalRtcServicesProtocolGuid = {
-  0x7e97a470, 0xefdb, 0x4d02, { 0x8f, 0xce, 0x61, 0x90, 0xd2, 0x7b, 0xa2, 0x96 }
-};
-
-static EFI_GUID my_gEfiExtendedSalVariableServicesProtocolGuid = {
-  0x4ecb6c53, 0xc641, 0x4370, { 0x8c, 0xb2, 0x3b, 0xe, 0x49, 0x6e, 0x83, 0x78 }
-};
-
-static EFI_GUID my_gEfiExtendedSalMtcServicesProtocolGuid = {
-  0x899afd18, 0x75e8, 0x408b, { 0xa4, 0x1a, 0x6e, 0x2e, 0x7e, 0xcd, 0xf4, 0x54 }
-};
-
-static EFI_GUID my_gEfiExtendedSalResetServicesProtocolGuid = {
-  0x7d019990, 0x8ce1, 0x46f5, { 0xa7, 0x76, 0x3c, 0x51, 0x98, 0x67, 0x6a, 0xa0 }
-};
-
-static EFI_GUID my_gEfiExtendedSalStatusCodeServicesProtocolGuid = {
-  0xdbd91d, 0x55e9, 0x420f, { 0x96, 0x39, 0x5e, 0x9f, 0x84, 0x37, 0xb4, 0x4f }
-};
-
-static EFI_GUID my_gEfiExtendedSalFvBlockServicesProtocolGuid = {
-  0xa2271df1, 0xbcbb, 0x4f1d, { 0x98, 0xa9, 0x6, 0xbc, 0x17, 0x2f, 0x7, 0x1a }
-};
-
-static EFI_GUID my_gEfiExtendedSalMpServicesProtocolGuid = {
-  0x697d81a2, 0xcf18, 0x4dc0, { 0x9e, 0xd, 0x6, 0x11, 0x3b, 0x61, 0x8a, 0x3f }
-};
-
-static EFI_GUID my_gEfiExtendedSalPalServicesProtocolGuid = {
-  0xe1cd9d21, 0xfc2, 0x438d, { 0x97, 0x3, 0x4, 0xe6, 0x6d, 0x96, 0x1e, 0x57 }
-};
-
-static EFI_GUID my_gEfiExtendedSalBaseServicesProtocolGuid = {
-  0xd9e9fa06, 0xfe0, 0x41c3, { 0x96, 0xfb, 0x83, 0x42, 0x5a, 0x33, 0x94, 0xf8 }
-};
-
-static EFI_GUID my_gEfiExtendedSalMcaServicesProtocolGuid = {
-  0x2a591128, 0x6cc7, 0x42b1, { 0x8a, 0xf0, 0x58, 0x93, 0x3b, 0x68, 0x2d, 0xbb }
-};
-
-static EFI_GUID my_gEfiExtendedSalPciServicesProtocolGuid = {
-  0xa46b1a31, 0xad66, 0x4905, { 0x92, 0xf6, 0x2b, 0x46, 0x59, 0xdc, 0x30, 0x63 }
-};
-
-static EFI_GUID my_gEfiExtendedSalCacheServicesProtocolGuid = {
-  0xedc9494, 0x2743, 0x4ba5, { 0x88, 0x18, 0xa, 0xef, 0x52, 0x13, 0xf1, 0x88 }
-};
-
-static EFI_GUID my_gEfiExtendedSalMcaLogServicesProtocolGuid = {
-  0xcb3fd86e, 0x38a3, 0x4c03, { 0x9a, 0x5c, 0x90, 0xcf, 0xa3, 0xa2, 0xab, 0x7a }
-};
-
-static EFI_GUID my_gEfiSecurity2ArchProtocolGuid = {
-  0x94ab2f58, 0x1438, 0x4ef1, { 0x91, 0x52, 0x18, 0x94, 0x1a, 0x3a, 0xe, 0x68 }
-};
-
-static EFI_GUID my_gEfiSmmEndOfDxeProtocolGuid = {
-  0x24e70042, 0xd5c5, 0x4260, { 0x8c, 0x39, 0xa, 0xd3, 0xaa, 0x32, 0xe9, 0x3d }
-};
-
-static EFI_GUID my_gEfiIsaHcProtocolGuid = {
-  0xbcdaf080, 0x1bde, 0x4e22, { 0xae, 0x6a, 0x43, 0x54, 0x1e, 0x12, 0x8e, 0xc4 }
-};
-
-static EFI_GUID my_gEfiIsaHcServiceBindingProtocolGuid = {
-  0xfad7933a, 0x6c21, 0x4234, { 0xa4, 0x34, 0xa, 0x8a, 0xd, 0x2b, 0x7, 0x81 }
-};
-
-static EFI_GUID my_gEfiSioControlProtocolGuid = {
-  0xb91978df, 0x9fc1, 0x427d, { 0xbb, 0x5, 0x4c, 0x82, 0x84, 0x55, 0xca, 0x27 }
-};
-
-static EFI_GUID my_gEfiGetPcdInfoProtocolGuid = {
-  0xfd0f4478, 0xefd, 0x461d, { 0xba, 0x2d, 0xe5, 0x8c, 0x45, 0xfd, 0x5f, 0x5e }
-};
-
-static EFI_GUID my_gEfiI2cMasterProtocolGuid = {
-  0x578c315a, 0x68cf, 0x4e81, { 0xb5, 0xc6, 0x22, 0xdb, 0x40, 0xd0, 0x10, 0xbc }
-};
-
-static EFI_GUID my_gEfiI2cIoProtocolGuid = {
-  0xb60a3e6b, 0x18c4, 0x46e5, { 0xa2, 0x9a, 0xc9, 0xa1, 0x6, 0x65, 0xa2, 0x8e }
-};
-
-static EFI_GUID my_gEfiI2cEnumerateProtocolGuid = {
-  0xda8cd7c4, 0x1c00, 0x49e2, { 0x80, 0x3e, 0x52, 0x14, 0xe7, 0x1, 0x89, 0x4c }
-};
-
-static EFI_GUID my_gEfiI2cHostProtocolGuid = {
-  0x70b221af, 0xfdff, 0x4fde, { 0x99, 0x68, 0x1a, 0xf6, 0x23, 0xa9, 0x56, 0xd9 }
-};
-
-static EFI_GUID my_gEfiI2cBusConfigurationManagementProtocolGuid = {
-  0x75032015, 0xd156, 0x423e, { 0xbf, 0xa3, 0x7a, 0x65, 0xab, 0xa4, 0x71, 0x5 }
-};
-
-static EFI_GUID my_gEfiLegacySpiControllerProtocolGuid = {
-  0x39136fc7, 0x1a11, 0x49de, { 0xbf, 0x35, 0xe, 0x78, 0xdd, 0xb5, 0x24, 0xfc }
-};
-
-static EFI_GUID my_gEfiLegacySpiFlashProtocolGuid = {
-  0xf01bed57, 0x4bc, 0x4f3f, { 0x96, 0x60, 0xd6, 0xf2, 0xea, 0x22, 0x82, 0x59 }
-};
-
-static EFI_GUID my_gEfiLegacySpiSmmControllerProtocolGuid = {
-  0x62331b78, 0xd8d0, 0x4c8c, { 0x8c, 0xcb, 0xd2, 0x7d, 0xfe, 0x32, 0xdb, 0x9b }
-};
-
-static EFI_GUID my_gEfiLegacySpiSmmFlashProtocolGuid = {
-  0x5e3848d4, 0xdb5, 0x4fc0, { 0x97, 0x29, 0x3f, 0x35, 0x3d, 0x4f, 0x87, 0x9f }
-};
-
-static EFI_GUID my_gEfiSpiConfigurationProtocolGuid = {
-  0x85a6d3e6, 0xb65b, 0x4afc, { 0xb3, 0x8f, 0xc6, 0xd5, 0x4a, 0xf6, 0xdd, 0xc8 }
-};
-
-static EFI_GUID my_gEfiSpiHcProtocolGuid = {
-  0xc74e5db2, 0xfa96, 0x4ae2, { 0xb3, 0x99, 0x15, 0x97, 0x7f, 0xe3, 0x0, 0x2d }
-};
-
-static EFI_GUID my_gEfiSpiNorFlashProtocolGuid = {
-  0xb57ec3fe, 0xf833, 0x4ba6, { 0x85, 0x78, 0x2a, 0x7d, 0x6a, 0x87, 0x44, 0x4b }
-};
-
-static EFI_GUID my_gEfiSpiSmmConfigurationProtocolGuid = {
-  0x995c6eca, 0x171b, 0x45fd, { 0xa3, 0xaa, 0xfd, 0x4c, 0x9c, 0x9d, 0xef, 0x59 }
-};
-
-static EFI_GUID my_gEfiSpiSmmHcProtocolGuid = {
-  0xe9f02217, 0x2093, 0x4470, { 0x8a, 0x54, 0x5c, 0x2c, 0xff, 0xe7, 0x3e, 0xcb }
-};
-
-static EFI_GUID my_gEfiSpiSmmNorFlashProtocolGuid = {
-  0xaab18f19, 0xfe14, 0x4666, { 0x86, 0x4, 0x87, 0xff, 0x6d, 0x66, 0x2c, 0x9a }
-};
-
-static EFI_GUID my_gEfiDebugSupportProtocolGuid = {
-  0x2755590c, 0x6f3c, 0x42fa, { 0x9e, 0xa4, 0xa3, 0xba, 0x54, 0x3c, 0xda, 0x25 }
-};
-
-static EFI_GUID my_gEfiDecompressProtocolGuid = {
-  0xd8117cfe, 0x94a6, 0x11d4, { 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiDeviceIoProtocolGuid = {
-  0xaf6ac311, 0x84c3, 0x11d2, { 0x8e, 0x3c, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiDevicePathProtocolGuid = {
-  0x9576e91, 0x6d3f, 0x11d2, { 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiDevicePathFromTextProtocolGuid = {
-  0x5c99a21, 0xc70f, 0x4ad2, { 0x8a, 0x5f, 0x35, 0xdf, 0x33, 0x43, 0xf5, 0x1e }
-};
-
-static EFI_GUID my_gEfiDevicePathToTextProtocolGuid = {
-  0x8b843e20, 0x8132, 0x4852, { 0x90, 0xcc, 0x55, 0x1a, 0x4e, 0x4a, 0x7f, 0x1c }
-};
-
-static EFI_GUID my_gEfiDevicePathUtilitiesProtocolGuid = {
-  0x379be4e, 0xd706, 0x437d, { 0xb0, 0x37, 0xed, 0xb8, 0x2f, 0xb7, 0x72, 0xa4 }
-};
-
-static EFI_GUID my_gEfiDriverBindingProtocolGuid = {
-  0x18a031ab, 0xb443, 0x4d1a, { 0xa5, 0xc0, 0xc, 0x9, 0x26, 0x1e, 0x9f, 0x71 }
-};
-
-static EFI_GUID my_gEfiPlatformDriverOverrideProtocolGuid = {
-  0x6b30c738, 0xa391, 0x11d4, { 0x9a, 0x3b, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiDriverFamilyOverrideProtocolGuid = {
-  0xb1ee129e, 0xda36, 0x4181, { 0x91, 0xf8, 0x4, 0xa4, 0x92, 0x37, 0x66, 0xa7 }
-};
-
-static EFI_GUID my_gEfiBusSpecificDriverOverrideProtocolGuid = {
-  0x3bc1b285, 0x8a15, 0x4a82, { 0xaa, 0xbf, 0x4d, 0x7d, 0x13, 0xfb, 0x32, 0x65 }
-};
-
-static EFI_GUID my_gEfiDriverDiagnostics2ProtocolGuid = {
-  0x4d330321, 0x25f, 0x4aac, { 0x90, 0xd8, 0x5e, 0xd9, 0x0, 0x17, 0x3b, 0x63 }
-};
-
-static EFI_GUID my_gEfiDriverDiagnosticsProtocolGuid = {
-  0x784924f, 0xe296, 0x11d4, { 0x9a, 0x49, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiComponentName2ProtocolGuid = {
-  0x6a7a5cff, 0xe8d9, 0x4f70, { 0xba, 0xda, 0x75, 0xab, 0x30, 0x25, 0xce, 0x14 }
-};
-
-static EFI_GUID my_gEfiComponentNameProtocolGuid = {
-  0x107a772c, 0xd5e1, 0x11d4, { 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiDriverConfiguration2ProtocolGuid = {
-  0xbfd7dc1d, 0x24f1, 0x40d9, { 0x82, 0xe7, 0x2e, 0x9, 0xbb, 0x6b, 0x4e, 0xbe }
-};
-
-static EFI_GUID my_gEfiDriverConfigurationProtocolGuid = {
-  0x107a772b, 0xd5e1, 0x11d4, { 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiPlatformToDriverConfigurationProtocolGuid = {
-  0x642cd590, 0x8059, 0x4c0a, { 0xa9, 0x58, 0xc5, 0xec, 0x7, 0xd2, 0x3c, 0x4b }
-};
-
-static EFI_GUID my_gEfiDriverSupportedEfiVersionProtocolGuid = {
-  0x5c198761, 0x16a8, 0x4e69, { 0x97, 0x2c, 0x89, 0xd6, 0x79, 0x54, 0xf8, 0x1d }
-};
-
-static EFI_GUID my_gEfiSimpleTextInProtocolGuid = {
-  0x387477c1, 0x69c7, 0x11d2, { 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiSimpleTextInputExProtocolGuid = {
-  0xdd9e7534, 0x7762, 0x4698, { 0x8c, 0x14, 0xf5, 0x85, 0x17, 0xa6, 0x25, 0xaa }
-};
-
-static EFI_GUID my_gEfiSimpleTextOutProtocolGuid = {
-  0x387477c2, 0x69c7, 0x11d2, { 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiSimplePointerProtocolGuid = {
-  0x31878c87, 0xb75, 0x11d5, { 0x9a, 0x4f, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiAbsolutePointerProtocolGuid = {
-  0x8d59d32b, 0xc655, 0x4ae9, { 0x9b, 0x15, 0xf2, 0x59, 0x4, 0x99, 0x2a, 0x43 }
-};
-
-static EFI_GUID my_gEfiSerialIoProtocolGuid = {
-  0xbb25cf6f, 0xf1d4, 0x11d2, { 0x9a, 0xc, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0xfd }
-};
-
-static EFI_GUID my_gEfiGraphicsOutputProtocolGuid = {
-  0x9042a9de, 0x23dc, 0x4a38, { 0x96, 0xfb, 0x7a, 0xde, 0xd0, 0x80, 0x51, 0x6a }
-};
-
-static EFI_GUID my_gEfiEdidDiscoveredProtocolGuid = {
-  0x1c0c34f6, 0xd380, 0x41fa, { 0xa0, 0x49, 0x8a, 0xd0, 0x6c, 0x1a, 0x66, 0xaa }
-};
-
-static EFI_GUID my_gEfiEdidActiveProtocolGuid = {
-  0xbd8c1056, 0x9f36, 0x44ec, { 0x92, 0xa8, 0xa6, 0x33, 0x7f, 0x81, 0x79, 0x86 }
-};
-
-static EFI_GUID my_gEfiEdidOverrideProtocolGuid = {
-  0x48ecb431, 0xfb72, 0x45c0, { 0xa9, 0x22, 0xf4, 0x58, 0xfe, 0x4, 0xb, 0xd5 }
-};
-
-static EFI_GUID my_gEfiUgaIoProtocolGuid = {
-  0x61a4d49e, 0x6f68, 0x4f1b, { 0xb9, 0x22, 0xa8, 0x6e, 0xed, 0xb, 0x7, 0xa2 }
-};
-
-static EFI_GUID my_gEfiUgaDrawProtocolGuid = {
-  0x982c298b, 0xf4fa, 0x41cb, { 0xb8, 0x38, 0x77, 0xaa, 0x68, 0x8f, 0xb8, 0x39 }
-};
-
-static EFI_GUID my_gEfiLoadedImageProtocolGuid = {
-  0x5b1b31a1, 0x9562, 0x11d2, { 0x8e, 0x3f, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiLoadedImageDevicePathProtocolGuid = {
-  0xbc62157e, 0x3e33, 0x4fec, { 0x99, 0x20, 0x2d, 0x3b, 0x36, 0xd7, 0x50, 0xdf }
-};
-
-static EFI_GUID my_gEfiLoadFileProtocolGuid = {
-  0x56ec3091, 0x954c, 0x11d2, { 0x8e, 0x3f, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiLoadFile2ProtocolGuid = {
-  0x4006c0c1, 0xfcb3, 0x403e, { 0x99, 0x6d, 0x4a, 0x6c, 0x87, 0x24, 0xe0, 0x6d }
-};
-
-static EFI_GUID my_gEfiTapeIoProtocolGuid = {
-  0x1e93e633, 0xd65a, 0x459e, { 0xab, 0x84, 0x93, 0xd9, 0xec, 0x26, 0x6d, 0x18 }
-};
-
-static EFI_GUID my_gEfiDiskIoProtocolGuid = {
-  0xce345171, 0xba0b, 0x11d2, { 0x8e, 0x4f, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiBlockIoProtocolGuid = {
-  0x964e5b21, 0x6459, 0x11d2, { 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiUnicodeCollationProtocolGuid = {
-  0x1d85cd7f, 0xf43d, 0x11d2, { 0x9a, 0xc, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiUnicodeCollation2ProtocolGuid = {
-  0xa4c751fc, 0x23ae, 0x4c3e, { 0x92, 0xe9, 0x49, 0x64, 0xcf, 0x63, 0xf3, 0x49 }
-};
-
-static EFI_GUID my_gEfiPciRootBridgeIoProtocolGuid = {
-  0x2f707ebb, 0x4a1a, 0x11d4, { 0x9a, 0x38, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiPciIoProtocolGuid = {
-  0x4cf5b200, 0x68b8, 0x4ca5, { 0x9e, 0xec, 0xb2, 0x3e, 0x3f, 0x50, 0x2, 0x9a }
-};
-
-static EFI_GUID my_gEfiScsiIoProtocolGuid = {
-  0x932f47e6, 0x2362, 0x4002, { 0x80, 0x3e, 0x3c, 0xd5, 0x4b, 0x13, 0x8f, 0x85 }
-};
-
-static EFI_GUID my_gEfiExtScsiPassThruProtocolGuid = {
-  0x143b7632, 0xb81b, 0x4cb7, { 0xab, 0xd3, 0xb6, 0x25, 0xa5, 0xb9, 0xbf, 0xfe }
-};
-
-static EFI_GUID my_gEfiScsiPassThruProtocolGuid = {
-  0xa59e8fcf, 0xbda0, 0x43bb, { 0x90, 0xb1, 0xd3, 0x73, 0x2e, 0xca, 0xa8, 0x77 }
-};
-
-static EFI_GUID my_gEfiIScsiInitiatorNameProtocolGuid = {
-  0x59324945, 0xec44, 0x4c0d, { 0xb1, 0xcd, 0x9d, 0xb1, 0x39, 0xdf, 0x7, 0xc }
-};
-
-static EFI_GUID my_gEfiUsb2HcProtocolGuid = {
-  0x3e745226, 0x9818, 0x45b6, { 0xa2, 0xac, 0xd7, 0xcd, 0xe, 0x8b, 0xa2, 0xbc }
-};
-
-static EFI_GUID my_gEfiUsbHcProtocolGuid = {
-  0xf5089266, 0x1aa0, 0x4953, { 0x97, 0xd8, 0x56, 0x2f, 0x8a, 0x73, 0xb5, 0x19 }
-};
-
-static EFI_GUID my_gEfiUsbIoProtocolGuid = {
-  0x2b2f68d6, 0xcd2, 0x44cf, { 0x8e, 0x8b, 0xbb, 0xa2, 0xb, 0x1b, 0x5b, 0x75 }
-};
-
-static EFI_GUID my_gEfiAcpiTableProtocolGuid = {
-  0xffe06bdd, 0x6107, 0x46a6, { 0x7b, 0xb2, 0x5a, 0x9c, 0x7e, 0xc5, 0x27, 0x5c }
-};
-
-static EFI_GUID my_gEfiEbcProtocolGuid = {
-  0x13ac6dd1, 0x73d0, 0x11d4, { 0xb0, 0x6b, 0x0, 0xaa, 0x0, 0xbd, 0x6d, 0xe7 }
-};
-
-static EFI_GUID my_gEfiSimpleNetworkProtocolGuid = {
-  0xa19832b9, 0xac25, 0x11d3, { 0x9a, 0x2d, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiNetworkInterfaceIdentifierProtocolGuid31 = {
-  0x1aced566, 0x76ed, 0x4218, { 0xbc, 0x81, 0x76, 0x7f, 0x1f, 0x97, 0x7a, 0x89 }
-};
-
-static EFI_GUID my_gEfiNetworkInterfaceIdentifierProtocolGuid = {
-  0xe18541cd, 0xf755, 0x4f73, { 0x92, 0x8d, 0x64, 0x3c, 0x8a, 0x79, 0xb2, 0x29 }
-};
-
-static EFI_GUID my_gEfiPxeBaseCodeCallbackProtocolGuid = {
-  0x245dca21, 0xfb7b, 0x11d3, { 0x8f, 0x1, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiPxeBaseCodeProtocolGuid = {
-  0x3c4e603, 0xac28, 0x11d3, { 0x9a, 0x2d, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiBisProtocolGuid = {
-  0xb64aab0, 0x5429, 0x11d4, { 0x98, 0x16, 0x0, 0xa0, 0xc9, 0x1f, 0xad, 0xcf }
-};
-
-static EFI_GUID my_gEfiManagedNetworkServiceBindingProtocolGuid = {
-  0xf36ff770, 0xa7e1, 0x42cf, { 0x9e, 0xd2, 0x56, 0xf0, 0xf2, 0x71, 0xf4, 0x4c }
-};
-
-static EFI_GUID my_gEfiManagedNetworkProtocolGuid = {
-  0x7ab33a91, 0xace5, 0x4326, { 0xb5, 0x72, 0xe7, 0xee, 0x33, 0xd3, 0x9f, 0x16 }
-};
-
-static EFI_GUID my_gEfiArpServiceBindingProtocolGuid = {
-  0xf44c00ee, 0x1f2c, 0x4a00, { 0xaa, 0x9, 0x1c, 0x9f, 0x3e, 0x8, 0x0, 0xa3 }
-};
-
-static EFI_GUID my_gEfiArpProtocolGuid = {
-  0xf4b427bb, 0xba21, 0x4f16, { 0xbc, 0x4e, 0x43, 0xe4, 0x16, 0xab, 0x61, 0x9c }
-};
-
-static EFI_GUID my_gEfiDhcp4ServiceBindingProtocolGuid = {
-  0x9d9a39d8, 0xbd42, 0x4a73, { 0xa4, 0xd5, 0x8e, 0xe9, 0x4b, 0xe1, 0x13, 0x80 }
-};
-
-static EFI_GUID my_gEfiDhcp4ProtocolGuid = {
-  0x8a219718, 0x4ef5, 0x4761, { 0x91, 0xc8, 0xc0, 0xf0, 0x4b, 0xda, 0x9e, 0x56 }
-};
-
-static EFI_GUID my_gEfiTcp4ServiceBindingProtocolGuid = {
-  0x720665, 0x67eb, 0x4a99, { 0xba, 0xf7, 0xd3, 0xc3, 0x3a, 0x1c, 0x7c, 0xc9 }
-};
-
-static EFI_GUID my_gEfiTcp4ProtocolGuid = {
-  0x65530bc7, 0xa359, 0x410f, { 0xb0, 0x10, 0x5a, 0xad, 0xc7, 0xec, 0x2b, 0x62 }
-};
-
-static EFI_GUID my_gEfiIp4ServiceBindingProtocolGuid = {
-  0xc51711e7, 0xb4bf, 0x404a, { 0xbf, 0xb8, 0xa, 0x4, 0x8e, 0xf1, 0xff, 0xe4 }
-};
-
-static EFI_GUID my_gEfiIp4ProtocolGuid = {
-  0x41d94cd2, 0x35b6, 0x455a, { 0x82, 0x58, 0xd4, 0xe5, 0x13, 0x34, 0xaa, 0xdd }
-};
-
-static EFI_GUID my_gEfiIp4ConfigProtocolGuid = {
-  0x3b95aa31, 0x3793, 0x434b, { 0x86, 0x67, 0xc8, 0x7, 0x8, 0x92, 0xe0, 0x5e }
-};
-
-static EFI_GUID my_gEfiUdp4ServiceBindingProtocolGuid = {
-  0x83f01464, 0x99bd, 0x45e5, { 0xb3, 0x83, 0xaf, 0x63, 0x5, 0xd8, 0xe9, 0xe6 }
-};
-
-static EFI_GUID my_gEfiUdp4ProtocolGuid = {
-  0x3ad9df29, 0x4501, 0x478d, { 0xb1, 0xf8, 0x7f, 0x7f, 0xe7, 0xe, 0x50, 0xf3 }
-};
-
-static EFI_GUID my_gEfiMtftp4ServiceBindingProtocolGuid = {
-  0x2fe800be, 0x8f01, 0x4aa6, { 0x94, 0x6b, 0xd7, 0x13, 0x88, 0xe1, 0x83, 0x3f }
-};
-
-static EFI_GUID my_gEfiMtftp4ProtocolGuid = {
-  0x78247c57, 0x63db, 0x4708, { 0x99, 0xc2, 0xa8, 0xb4, 0xa9, 0xa6, 0x1f, 0x6b }
-};
-
-static EFI_GUID my_gEfiAuthenticationInfoProtocolGuid = {
-  0x7671d9d0, 0x53db, 0x4173, { 0xaa, 0x69, 0x23, 0x27, 0xf2, 0x1f, 0xb, 0xc7 }
-};
-
-static EFI_GUID my_gEfiHashServiceBindingProtocolGuid = {
-  0x42881c98, 0xa4f3, 0x44b0, { 0xa3, 0x9d, 0xdf, 0xa1, 0x86, 0x67, 0xd8, 0xcd }
-};
-
-static EFI_GUID my_gEfiHashProtocolGuid = {
-  0xc5184932, 0xdba5, 0x46db, { 0xa5, 0xba, 0xcc, 0xb, 0xda, 0x9c, 0x14, 0x35 }
-};
-
-static EFI_GUID my_gEfiTcgProtocolGuid = {
-  0xf541796d, 0xa62e, 0x4954, { 0xa7, 0x75, 0x95, 0x84, 0xf6, 0x1b, 0x9c, 0xdd }
-};
-
-static EFI_GUID my_gEfiTrEEProtocolGuid = {
-  0x607f766c, 0x7455, 0x42be, { 0x93, 0xb, 0xe4, 0xd7, 0x6d, 0xb2, 0x72, 0xf }
-};
-
-static EFI_GUID my_gEfiTcg2FinalEventsTableGuid = {
-  0x1e2ed096, 0x30e2, 0x4254, { 0xbd, 0x89, 0x86, 0x3b, 0xbe, 0xf8, 0x23, 0x25 }
-};
-
-static EFI_GUID my_gEfiFormBrowser2ProtocolGuid = {
-  0xb9d4c360, 0xbcfb, 0x4f9b, { 0x92, 0x98, 0x53, 0xc1, 0x36, 0x98, 0x22, 0x58 }
-};
-
-static EFI_GUID my_gEfiHiiStringProtocolGuid = {
-  0xfd96974, 0x23aa, 0x4cdc, { 0xb9, 0xcb, 0x98, 0xd1, 0x77, 0x50, 0x32, 0x2a }
-};
-
-static EFI_GUID my_gEfiHiiImageProtocolGuid = {
-  0x31a6406a, 0x6bdf, 0x4e46, { 0xb2, 0xa2, 0xeb, 0xaa, 0x89, 0xc4, 0x9, 0x20 }
-};
-
-static EFI_GUID my_gEfiHiiConfigRoutingProtocolGuid = {
-  0x587e72d7, 0xcc50, 0x4f79, { 0x82, 0x9, 0xca, 0x29, 0x1f, 0xc1, 0xa1, 0xf }
-};
-
-static EFI_GUID my_gEfiHiiDatabaseProtocolGuid = {
-  0xef9fc172, 0xa1b2, 0x4693, { 0xb3, 0x27, 0x6d, 0x32, 0xfc, 0x41, 0x60, 0x42 }
-};
-
-static EFI_GUID my_gEfiHiiFontProtocolGuid = {
-  0xe9ca4775, 0x8657, 0x47fc, { 0x97, 0xe7, 0x7e, 0xd6, 0x5a, 0x8, 0x43, 0x24 }
-};
-
-static EFI_GUID my_gEfiHiiConfigAccessProtocolGuid = {
-  0x330d4706, 0xf2a0, 0x4e4f, { 0xa3, 0x69, 0xb6, 0x6f, 0xa8, 0xd5, 0x43, 0x85 }
-};
-
-static EFI_GUID my_gEfiHiiPackageListProtocolGuid = {
-  0x6a1ee763, 0xd47a, 0x43b4, { 0xaa, 0xbe, 0xef, 0x1d, 0xe2, 0xab, 0x56, 0xfc }
-};
-
-static EFI_GUID my_gEfiIp6ServiceBindingProtocolGuid = {
-  0xec835dd3, 0xfe0f, 0x617b, { 0xa6, 0x21, 0xb3, 0x50, 0xc3, 0xe1, 0x33, 0x88 }
-};
-
-static EFI_GUID my_gEfiIp6ProtocolGuid = {
-  0x2c8759d5, 0x5c2d, 0x66ef, { 0x92, 0x5f, 0xb6, 0x6c, 0x10, 0x19, 0x57, 0xe2 }
-};
-
-static EFI_GUID my_gEfiIp6ConfigProtocolGuid = {
-  0x937fe521, 0x95ae, 0x4d1a, { 0x89, 0x29, 0x48, 0xbc, 0xd9, 0xa, 0xd3, 0x1a }
-};
-
-static EFI_GUID my_gEfiMtftp6ServiceBindingProtocolGuid = {
-  0xd9760ff3, 0x3cca, 0x4267, { 0x80, 0xf9, 0x75, 0x27, 0xfa, 0xfa, 0x42, 0x23 }
-};
-
-static EFI_GUID my_gEfiMtftp6ProtocolGuid = {
-  0xbf0a78ba, 0xec29, 0x49cf, { 0xa1, 0xc9, 0x7a, 0xe5, 0x4e, 0xab, 0x6a, 0x51 }
-};
-
-static EFI_GUID my_gEfiDhcp6ServiceBindingProtocolGuid = {
-  0x9fb9a8a1, 0x2f4a, 0x43a6, { 0x88, 0x9c, 0xd0, 0xf7, 0xb6, 0xc4, 0x7a, 0xd5 }
-};
-
-static EFI_GUID my_gEfiDhcp6ProtocolGuid = {
-  0x87c8bad7, 0x595, 0x4053, { 0x82, 0x97, 0xde, 0xde, 0x39, 0x5f, 0x5d, 0x5b }
-};
-
-static EFI_GUID my_gEfiUdp6ServiceBindingProtocolGuid = {
-  0x66ed4721, 0x3c98, 0x4d3e, { 0x81, 0xe3, 0xd0, 0x3d, 0xd3, 0x9a, 0x72, 0x54 }
-};
-
-static EFI_GUID my_gEfiUdp6ProtocolGuid = {
-  0x4f948815, 0xb4b9, 0x43cb, { 0x8a, 0x33, 0x90, 0xe0, 0x60, 0xb3, 0x49, 0x55 }
-};
-
-static EFI_GUID my_gEfiTcp6ServiceBindingProtocolGuid = {
-  0xec20eb79, 0x6c1a, 0x4664, { 0x9a, 0xd, 0xd2, 0xe4, 0xcc, 0x16, 0xd6, 0x64 }
-};
-
-static EFI_GUID my_gEfiTcp6ProtocolGuid = {
-  0x46e44855, 0xbd60, 0x4ab7, { 0xab, 0xd, 0xa6, 0x79, 0xb9, 0x44, 0x7d, 0x77 }
-};
-
-static EFI_GUID my_gEfiVlanConfigProtocolGuid = {
-  0x9e23d768, 0xd2f3, 0x4366, { 0x9f, 0xc3, 0x3a, 0x7a, 0xba, 0x86, 0x43, 0x74 }
-};
-
-static EFI_GUID my_gEfiEapProtocolGuid = {
-  0x5d9f96db, 0xe731, 0x4caa, { 0xa0, 0xd, 0x72, 0xe1, 0x87, 0xcd, 0x77, 0x62 }
-};
-
-static EFI_GUID my_gEfiEapManagementProtocolGuid = {
-  0xbb62e663, 0x625d, 0x40b2, { 0xa0, 0x88, 0xbb, 0xe8, 0x36, 0x23, 0xa2, 0x45 }
-};
-
-static EFI_GUID my_gEfiFtp4ServiceBindingProtocolGuid = {
-  0xfaaecb1, 0x226e, 0x4782, { 0xaa, 0xce, 0x7d, 0xb9, 0xbc, 0xbf, 0x4d, 0xaf }
-};
-
-static EFI_GUID my_gEfiFtp4ProtocolGuid = {
-  0xeb338826, 0x681b, 0x4295, { 0xb3, 0x56, 0x2b, 0x36, 0x4c, 0x75, 0x7b, 0x9 }
-};
-
-static EFI_GUID my_gEfiIpSecConfigProtocolGuid = {
-  0xce5e5929, 0xc7a3, 0x4602, { 0xad, 0x9e, 0xc9, 0xda, 0xf9, 0x4e, 0xbf, 0xcf }
-};
-
-static EFI_GUID my_gEfiDriverHealthProtocolGuid = {
-  0x2a534210, 0x9280, 0x41d8, { 0xae, 0x79, 0xca, 0xda, 0x1, 0xa2, 0xb1, 0x27 }
-};
-
-static EFI_GUID my_gEfiDeferredImageLoadProtocolGuid = {
-  0x15853d7c, 0x3ddf, 0x43e0, { 0xa1, 0xcb, 0xeb, 0xf8, 0x5b, 0x8f, 0x87, 0x2c }
-};
-
-static EFI_GUID my_gEfiUserCredentialProtocolGuid = {
-  0x71ee5e94, 0x65b9, 0x45d5, { 0x82, 0x1a, 0x3a, 0x4d, 0x86, 0xcf, 0xe6, 0xbe }
-};
-
-static EFI_GUID my_gEfiUserManagerProtocolGuid = {
-  0x6fd5b00c, 0xd426, 0x4283, { 0x98, 0x87, 0x6c, 0xf5, 0xcf, 0x1c, 0xb1, 0xfe }
-};
-
-static EFI_GUID my_gEfiAtaPassThruProtocolGuid = {
-  0x1d3de7f0, 0x807, 0x424f, { 0xaa, 0x69, 0x11, 0xa5, 0x4e, 0x19, 0xa4, 0x6f }
-};
-
-static EFI_GUID my_gEfiFirmwareManagementProtocolGuid = {
-  0x86c77a67, 0xb97, 0x4633, { 0xa1, 0x87, 0x49, 0x10, 0x4d, 0x6, 0x85, 0xc7 }
-};
-
-static EFI_GUID my_gEfiIpSecProtocolGuid = {
-  0xdfb386f7, 0xe100, 0x43ad, { 0x9c, 0x9a, 0xed, 0x90, 0xd0, 0x8a, 0x5e, 0x12 }
-};
-
-static EFI_GUID my_gEfiIpSec2ProtocolGuid = {
-  0xa3979e64, 0xace8, 0x4ddc, { 0xbc, 0x7, 0x4d, 0x66, 0xb8, 0xfd, 0x9, 0x77 }
-};
-
-static EFI_GUID my_gEfiKmsProtocolGuid = {
-  0xec3a978d, 0x7c4e, 0x48fa, { 0x9a, 0xbe, 0x6a, 0xd9, 0x1c, 0xc8, 0xf8, 0x11 }
-};
-
-static EFI_GUID my_gEfiBlockIo2ProtocolGuid = {
-  0xa77b2472, 0xe282, 0x4e9f, { 0xa2, 0x45, 0xc2, 0xc0, 0xe2, 0x7b, 0xbc, 0xc1 }
-};
-
-static EFI_GUID my_gEfiStorageSecurityCommandProtocolGuid = {
-  0xc88b0b6d, 0xdfc, 0x49a7, { 0x9c, 0xb4, 0x49, 0x7, 0x4b, 0x4c, 0x3a, 0x78 }
-};
-
-static EFI_GUID my_gEfiUserCredential2ProtocolGuid = {
-  0xe98adb03, 0xb8b9, 0x4af8, { 0xba, 0x20, 0x26, 0xe9, 0x11, 0x4c, 0xbc, 0xe5 }
-};
-
-static EFI_GUID my_gEfiDiskIo2ProtocolGuid = {
-  0x151c8eae, 0x7f2c, 0x472c, { 0x9e, 0x54, 0x98, 0x28, 0x19, 0x4f, 0x6a, 0x88 }
-};
-
-static EFI_GUID my_gEfiTimestampProtocolGuid = {
-  0xafbfde41, 0x2e6e, 0x4262, { 0xba, 0x65, 0x62, 0xb9, 0x23, 0x6e, 0x54, 0x95 }
-};
-
-static EFI_GUID my_gEfiRngProtocolGuid = {
-  0x3152bca5, 0xeade, 0x433d, { 0x86, 0x2e, 0xc0, 0x1c, 0xdc, 0x29, 0x1f, 0x44 }
-};
-
-static EFI_GUID my_gEfiAdapterInformationProtocolGuid = {
-  0xe5dd1403, 0xd622, 0xc24e, { 0x84, 0x88, 0xc7, 0x1b, 0x17, 0xf5, 0xe8, 0x2 }
-};
-
-static EFI_GUID my_gEfiNvmExpressPassThruProtocolGuid = {
-  0x52c78312, 0x8edc, 0x4233, { 0x98, 0xf2, 0x1a, 0x1a, 0xa5, 0xe3, 0x88, 0xa5 }
-};
-
-static EFI_GUID my_gEfiHash2ServiceBindingProtocolGuid = {
-  0xda836f8d, 0x217f, 0x4ca0, { 0x99, 0xc2, 0x1c, 0xa4, 0xe1, 0x60, 0x77, 0xea }
-};
-
-static EFI_GUID my_gEfiHash2ProtocolGuid = {
-  0x55b1d734, 0xc5e1, 0x49db, { 0x96, 0x47, 0xb1, 0x6a, 0xfb, 0xe, 0x30, 0x5b }
-};
-
-static EFI_GUID my_gEfiBlockIoCryptoProtocolGuid = {
-  0xa00490ba, 0x3f1a, 0x4b4c, { 0xab, 0x90, 0x4f, 0xa9, 0x97, 0x26, 0xa1, 0xe8 }
-};
-
-static EFI_GUID my_gEfiSmartCardReaderProtocolGuid = {
-  0x2a4d1adf, 0x21dc, 0x4b81, { 0xa4, 0x2f, 0x8b, 0x8e, 0xe2, 0x38, 0x0, 0x60 }
-};
-
-static EFI_GUID my_gEfiSmartCardEdgeProtocolGuid = {
-  0xd317f29b, 0xa325, 0x4712, { 0x9b, 0xf1, 0xc6, 0x19, 0x54, 0xdc, 0x19, 0x8c }
-};
-
-static EFI_GUID my_gEfiUsbFunctionIoProtocolGuid = {
-  0x32d2963a, 0xfe5d, 0x4f30, { 0xb6, 0x33, 0x6e, 0x5d, 0xc5, 0x58, 0x3, 0xcc }
-};
-
-static EFI_GUID my_gEfiBluetoothHcProtocolGuid = {
-  0xb3930571, 0xbeba, 0x4fc5, { 0x92, 0x3, 0x94, 0x27, 0x24, 0x2e, 0x6a, 0x43 }
-};
-
-static EFI_GUID my_gEfiBluetoothIoServiceBindingProtocolGuid = {
-  0x388278d3, 0x7b85, 0x42f0, { 0xab, 0xa9, 0xfb, 0x4b, 0xfd, 0x69, 0xf5, 0xab }
-};
-
-static EFI_GUID my_gEfiBluetoothIoProtocolGuid = {
-  0x467313de, 0x4e30, 0x43f1, { 0x94, 0x3e, 0x32, 0x3f, 0x89, 0x84, 0x5d, 0xb5 }
-};
-
-static EFI_GUID my_gEfiBluetoothConfigProtocolGuid = {
-  0x62960cf3, 0x40ff, 0x4263, { 0xa7, 0x7c, 0xdf, 0xde, 0xbd, 0x19, 0x1b, 0x4b }
-};
-
-static EFI_GUID my_gEfiRegularExpressionProtocolGuid = {
-  0xb3f79d9a, 0x436c, 0xdc11, { 0xb0, 0x52, 0xcd, 0x85, 0xdf, 0x52, 0x4c, 0xe6 }
-};
-
-static EFI_GUID my_gEfiBootManagerPolicyProtocolGuid = {
-  0xfedf8e0c, 0xe147, 0x11e3, { 0x99, 0x3, 0xb8, 0xe8, 0x56, 0x2c, 0xba, 0xfa }
-};
-
-static EFI_GUID my_gEfiConfigKeywordHandlerProtocolGuid = {
-  0xa8badd5, 0x3b8, 0x4d19, { 0xb1, 0x28, 0x7b, 0x8f, 0xe, 0xda, 0xa5, 0x96 }
-};
-
-static EFI_GUID my_gEfiWiFiProtocolGuid = {
-  0xda55bc9, 0x45f8, 0x4bb4, { 0x87, 0x19, 0x52, 0x24, 0xf1, 0x8a, 0x4d, 0x45 }
-};
-
-static EFI_GUID my_gEfiEapManagement2ProtocolGuid = {
-  0x5e93c847, 0x456d, 0x40b3, { 0xa6, 0xb4, 0x78, 0xb0, 0xc9, 0xcf, 0x7f, 0x20 }
-};
-
-static EFI_GUID my_gEfiEapConfigurationProtocolGuid = {
-  0xe5b58dbb, 0x7688, 0x44b4, { 0x97, 0xbf, 0x5f, 0x1d, 0x4b, 0x7c, 0xc8, 0xdb }
-};
-
-static EFI_GUID my_gEfiPkcs7VerifyProtocolGuid = {
-  0x47889fb2, 0xd671, 0x4fab, { 0xa0, 0xca, 0xdf, 0xe, 0x44, 0xdf, 0x70, 0xd6 }
-};
-
-static EFI_GUID my_gEfiIp4Config2ProtocolGuid = {
-  0x5b446ed1, 0xe30b, 0x4faa, { 0x87, 0x1a, 0x36, 0x54, 0xec, 0xa3, 0x60, 0x80 }
-};
-
-static EFI_GUID my_gEfiDns4ServiceBindingProtocolGuid = {
-  0xb625b186, 0xe063, 0x44f7, { 0x89, 0x5, 0x6a, 0x74, 0xdc, 0x6f, 0x52, 0xb4 }
-};
-
-static EFI_GUID my_gEfiDns4ProtocolGuid = {
-  0xae3d28cc, 0xe05b, 0x4fa1, { 0xa0, 0x11, 0x7e, 0xb5, 0x5a, 0x3f, 0x14, 0x1 }
-};
-
-static EFI_GUID my_gEfiDns6ServiceBindingProtocolGuid = {
-  0x7f1647c8, 0xb76e, 0x44b2, { 0xa5, 0x65, 0xf7, 0xf, 0xf1, 0x9c, 0xd1, 0x9e }
-};
-
-static EFI_GUID my_gEfiDns6ProtocolGuid = {
-  0xca37bc1f, 0xa327, 0x4ae9, { 0x82, 0x8a, 0x8c, 0x40, 0xd8, 0x50, 0x6a, 0x17 }
-};
-
-static EFI_GUID my_gEfiHttpServiceBindingProtocolGuid = {
-  0xbdc8e6af, 0xd9bc, 0x4379, { 0xa7, 0x2a, 0xe0, 0xc4, 0xe7, 0x5d, 0xae, 0x1c }
-};
-
-static EFI_GUID my_gEfiHttpProtocolGuid = {
-  0x7a59b29b, 0x910b, 0x4171, { 0x82, 0x42, 0xa8, 0x5a, 0xd, 0xf2, 0x5b, 0x5b }
-};
-
-static EFI_GUID my_gEfiHttpUtilitiesProtocolGuid = {
-  0x3e35c163, 0x4074, 0x45dd, { 0x43, 0x1e, 0x23, 0x98, 0x9d, 0xd8, 0x6b, 0x32 }
-};
-
-static EFI_GUID my_gEfiTlsServiceBindingProtocolGuid = {
-  0x952cb795, 0xff36, 0x48cf, { 0xa2, 0x49, 0x4d, 0xf4, 0x86, 0xd6, 0xab, 0x8d }
-};
-
-static EFI_GUID my_gEfiTlsProtocolGuid = {
-  0xca959f, 0x6cfa, 0x4db1, { 0x95, 0xbc, 0xe4, 0x6c, 0x47, 0x51, 0x43, 0x90 }
-};
-
-static EFI_GUID my_gEfiTlsConfigurationProtocolGuid = {
-  0x1682fe44, 0xbd7a, 0x4407, { 0xb7, 0xc7, 0xdc, 0xa3, 0x7c, 0xa3, 0x92, 0x2d }
-};
-
-static EFI_GUID my_gEfiRestProtocolGuid = {
-  0xdb48a36, 0x4e54, 0xea9c, { 0x9b, 0x9, 0x1e, 0xa5, 0xbe, 0x3a, 0x66, 0xb }
-};
-
-static EFI_GUID my_gEfiSupplicantServiceBindingProtocolGuid = {
-  0x45bcd98e, 0x59ad, 0x4174, { 0x95, 0x46, 0x34, 0x4a, 0x7, 0x48, 0x58, 0x98 }
-};
-
-static EFI_GUID my_gEfiSupplicantProtocolGuid = {
-  0x54fcc43e, 0xaa89, 0x4333, { 0x9a, 0x85, 0xcd, 0xea, 0x24, 0x5, 0x1e, 0x9e }
-};
-
-static EFI_GUID my_gEfiWiFi2ProtocolGuid = {
-  0x1b0fb9bf, 0x699d, 0x4fdd, { 0xa7, 0xc3, 0x25, 0x46, 0x68, 0x1b, 0xf6, 0x3b }
-};
-
-static EFI_GUID my_gEfiRamDiskProtocolGuid = {
-  0xab38a0df, 0x6873, 0x44a9, { 0x87, 0xe6, 0xd4, 0xeb, 0x56, 0x14, 0x84, 0x49 }
-};
-
-static EFI_GUID my_gEfiHiiImageDecoderProtocolGuid = {
-  0x9e66f251, 0x727c, 0x418c, { 0xbf, 0xd6, 0xc2, 0xb4, 0x25, 0x28, 0x18, 0xea }
-};
-
-static EFI_GUID my_gEfiHiiImageExProtocolGuid = {
-  0x1a1241e6, 0x8f19, 0x41a9, { 0xbc, 0xe, 0xe8, 0xef, 0x39, 0xe0, 0x65, 0x46 }
-};
-
-static EFI_GUID my_gEfiSdMmcPassThruProtocolGuid = {
-  0x716ef0d9, 0xff83, 0x4f69, { 0x81, 0xe9, 0x51, 0x8b, 0xd3, 0x9a, 0x8e, 0x70 }
-};
-
-static EFI_GUID my_gEfiEraseBlockProtocolGuid = {
-  0x95a9a93e, 0xa86e, 0x4926, { 0xaa, 0xef, 0x99, 0x18, 0xe7, 0x72, 0xd9, 0x87 }
-};
-
-static EFI_GUID my_gEfiBluetoothAttributeProtocolGuid = {
-  0x898890e9, 0x84b2, 0x4f3a, { 0x8c, 0x58, 0xd8, 0x57, 0x78, 0x13, 0xe0, 0xac }
-};
-
-static EFI_GUID my_gEfiBluetoothAttributeServiceBindingProtocolGuid = {
-  0x5639867a, 0x8c8e, 0x408d, { 0xac, 0x2f, 0x4b, 0x61, 0xbd, 0xc0, 0xbb, 0xbb }
-};
-
-static EFI_GUID my_gEfiBluetoothLeConfigProtocolGuid = {
-  0x8f76da58, 0x1f99, 0x4275, { 0xa4, 0xec, 0x47, 0x56, 0x51, 0x5b, 0x1c, 0xe8 }
-};
-
-static EFI_GUID my_gEfiUfsDeviceConfigProtocolGuid = {
-  0xb81bfab0, 0xeb3, 0x4cf9, { 0x84, 0x65, 0x7f, 0xa9, 0x86, 0x36, 0x16, 0x64 }
-};
-
-static EFI_GUID my_gEfiHttpBootCallbackProtocolGuid = {
-  0xba23b311, 0x343d, 0x11e6, { 0x91, 0x85, 0x58, 0x20, 0xb1, 0xd6, 0x52, 0x99 }
-};
-
-static EFI_GUID my_gEfiResetNotificationProtocolGuid = {
-  0x9da34ae0, 0xeaf9, 0x4bbf, { 0x8e, 0xc3, 0xfd, 0x60, 0x22, 0x6c, 0x44, 0xbe }
-};
-
-static EFI_GUID my_gEfiPartitionInfoProtocolGuid = {
-  0x8cf2f62c, 0xbc9b, 0x4821, { 0x80, 0x8d, 0xec, 0x9e, 0xc4, 0x21, 0xa1, 0xa0 }
-};
-
-static EFI_GUID my_gEfiHiiPopupProtocolGuid = {
-  0x4311edc0, 0x6054, 0x46d4, { 0x9e, 0x40, 0x89, 0x3e, 0xa9, 0x52, 0xfc, 0xcc }
-};
-
-static EFI_GUID my_gEfiNvdimmLabelProtocolGuid = {
-  0xd40b6b80, 0x97d5, 0x4282, { 0xbb, 0x1d, 0x22, 0x3a, 0x16, 0x91, 0x80, 0x58 }
-};
-
-static EFI_GUID my_gEfiShellProtocolGuid = {
-  0x6302d008, 0x7f9b, 0x4f30, { 0x87, 0xac, 0x60, 0xc9, 0xfe, 0xf5, 0xda, 0x4e }
-};
-
-static EFI_GUID my_gEfiShellParametersProtocolGuid = {
-  0x752f3136, 0x4e16, 0x4fdc, { 0xa2, 0x2a, 0xe5, 0xf4, 0x68, 0x12, 0xf4, 0xca }
-};
-
-static EFI_GUID my_gEfiShellDynamicCommandProtocolGuid = {
-  0x3c7200e9, 0x5f, 0x4ea4, { 0x87, 0xde, 0xa3, 0xdf, 0xac, 0x8a, 0x27, 0xc3 }
-};
-
-static EFI_GUID my_gEfiNetworkPkgTokenSpaceGuid = {
-  0x40e064b2, 0xae0, 0x48b1, { 0xa0, 0x7d, 0xf8, 0xcf, 0x1e, 0x1a, 0x23, 0x10 }
-};
-
-static EFI_GUID my_gIp6ConfigNvDataGuid = {
-  0x2eea107, 0x98db, 0x400e, { 0x98, 0x30, 0x46, 0xa, 0x15, 0x42, 0xd7, 0x99 }
-};
-
-static EFI_GUID my_gIScsiConfigGuid = {
-  0x4b47d616, 0xa8d6, 0x4552, { 0x9d, 0x44, 0xcc, 0xad, 0x2e, 0xf, 0x4c, 0xf9 }
-};
-
-static EFI_GUID my_gHttpBootConfigGuid = {
-  0x4d20583a, 0x7765, 0x4e7a, { 0x8a, 0x67, 0xdc, 0xde, 0x74, 0xee, 0x3e, 0xc5 }
-};
-
-static EFI_GUID my_gTlsAuthConfigGuid = {
-  0xb0eae4f8, 0x9a04, 0x4c6d, { 0xa7, 0x48, 0x79, 0x3d, 0xaa, 0xf, 0x65, 0xdf }
-};
-
-static EFI_GUID my_gEfiTlsCaCertificateGuid = {
-  0xfd2340d0, 0x3dab, 0x4349, { 0xa6, 0xc7, 0x3b, 0x4f, 0x12, 0xb4, 0x8e, 0xae }
-};
-
-static EFI_GUID my_gEfiWinNtPassThroughGuid = {
-  0xcc664eb8, 0x3c24, 0x4086, { 0xb6, 0xf6, 0x34, 0xe8, 0x56, 0xbc, 0xe3, 0x6e }
-};
-
-static EFI_GUID my_gEfiWinNtConsoleGuid = {
-  0xba73672c, 0xa5d3, 0x11d4, { 0xbd, 0x0, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiWinNtUgaGuid = {
-  0xab248e99, 0xabe1, 0x11d4, { 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiWinNtGopGuid = {
-  0x4e11e955, 0xccca, 0x11d4, { 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiWinNtSerialPortGuid = {
-  0xc95a93d, 0xa006, 0x11d4, { 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiWinNtFileSystemGuid = {
-  0xc95a935, 0xa006, 0x11d4, { 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiWinNtPhysicalDisksGuid = {
-  0xc95a92f, 0xa006, 0x11d4, { 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiWinNtVirtualDisksGuid = {
-  0xc95a928, 0xa006, 0x11d4, { 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiNt32PkgTokenSpaceGuid = {
-  0xd79a645, 0x1d91, 0x40a6, { 0xa8, 0x1f, 0x61, 0xe6, 0x98, 0x2b, 0x32, 0xb4 }
-};
-
-static EFI_GUID my_gEfiWinNtSystemConfigGuid = {
-  0xb347f047, 0xaf8c, 0x490e, { 0xac, 0x7, 0xa, 0xa9, 0xb7, 0xe5, 0x38, 0x58 }
-};
-
-static EFI_GUID my_gPeiNtThunkPpiGuid = {
-  0x98c281e5, 0xf906, 0x43dd, { 0xa9, 0x2b, 0xb0, 0x3, 0xbf, 0x27, 0x65, 0xda }
-};
-
-static EFI_GUID my_gPeiNtAutoScanPpiGuid = {
-  0xdce384d, 0x7c, 0x4ba5, { 0x94, 0xbd, 0xf, 0x6e, 0xb6, 0x4d, 0x2a, 0xa9 }
-};
-
-static EFI_GUID my_gNtPeiLoadFilePpiGuid = {
-  0xfd0c65eb, 0x405, 0x4cd2, { 0x8a, 0xee, 0xf4, 0x0, 0xef, 0x13, 0xba, 0xc2 }
-};
-
-static EFI_GUID my_gNtFwhPpiGuid = {
-  0x4e76928f, 0x50ad, 0x4334, { 0xb0, 0x6b, 0xa8, 0x42, 0x13, 0x10, 0x8a, 0x57 }
-};
-
-static EFI_GUID my_gWinNtBusDriverGuid = {
-  0x419f582, 0x625, 0x4531, { 0x8a, 0x33, 0x85, 0xa9, 0x96, 0x5c, 0x95, 0xbc }
-};
-
-static EFI_GUID my_gEfiWinNtThunkProtocolGuid = {
-  0x58c518b1, 0x76f3, 0x11d4, { 0xbc, 0xea, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiWinNtIoProtocolGuid = {
-  0x96eb4ad6, 0xa32a, 0x11d4, { 0xbc, 0xfd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gOmap35xxTokenSpaceGuid = {
-  0x24b09abe, 0x4e47, 0x481c, { 0xa9, 0xad, 0xce, 0xf1, 0x2c, 0x39, 0x23, 0x27 }
-};
-
-static EFI_GUID my_gOptionRomPkgTokenSpaceGuid = {
-  0x1e43298f, 0x3478, 0x41a7, { 0xb5, 0x77, 0x86, 0x6, 0x46, 0x35, 0xc7, 0x28 }
-};
-
-static EFI_GUID my_gUefiOvmfPkgTokenSpaceGuid = {
-  0x93bb96af, 0xb9f2, 0x4eb8, { 0x94, 0x62, 0xe0, 0xba, 0x74, 0x56, 0x42, 0x36 }
-};
-
-static EFI_GUID my_gEfiXenInfoGuid = {
-  0xd3b46f3b, 0xd441, 0x1244, { 0x9a, 0x12, 0x0, 0x12, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gOvmfPlatformConfigGuid = {
-  0x7235c51c, 0xc80, 0x4cab, { 0x87, 0xac, 0x3b, 0x8, 0x4a, 0x63, 0x4, 0xb1 }
-};
-
-static EFI_GUID my_gVirtioMmioTransportGuid = {
-  0x837dca9e, 0xe874, 0x4d82, { 0xb2, 0x9a, 0x23, 0xfe, 0xe, 0x23, 0xd1, 0xe2 }
-};
-
-static EFI_GUID my_gXenBusRootDeviceGuid = {
-  0xa732241f, 0x383d, 0x4d9c, { 0x8a, 0xe1, 0x8e, 0x9, 0x83, 0x75, 0x89, 0xd7 }
-};
-
-static EFI_GUID my_gRootBridgesConnectedEventGroupGuid = {
-  0x24a2d66f, 0xeedd, 0x4086, { 0x90, 0x42, 0xf2, 0x6e, 0x47, 0x97, 0xee, 0x69 }
-};
-
-static EFI_GUID my_gVirtioDeviceProtocolGuid = {
-  0xfa920010, 0x6785, 0x4941, { 0xb6, 0xec, 0x49, 0x8c, 0x57, 0x9f, 0x16, 0xa }
-};
-
-static EFI_GUID my_gBlockMmioProtocolGuid = {
-  0x6b558ce3, 0x69e5, 0x4c67, { 0xa6, 0x34, 0xf7, 0xfe, 0x72, 0xad, 0xbe, 0x84 }
-};
-
-static EFI_GUID my_gXenBusProtocolGuid = {
-  0x3d3ca290, 0xb9a5, 0x11e3, { 0xb7, 0x5d, 0xb8, 0xac, 0x6f, 0x7d, 0x65, 0xe6 }
-};
-
-static EFI_GUID my_gXenIoProtocolGuid = {
-  0x6efac84f, 0xab0, 0x4747, { 0x81, 0xbe, 0x85, 0x55, 0x62, 0x59, 0x4, 0x49 }
-};
-
-static EFI_GUID my_gIoMmuAbsentProtocolGuid = {
-  0xf8775d50, 0x8abd, 0x4adf, { 0x92, 0xac, 0x85, 0x3e, 0x51, 0xf6, 0xc8, 0xdc }
-};
-
-static EFI_GUID my_gPcAtChipsetPkgTokenSpaceGuid = {
-  0x326ae723, 0xae32, 0x4589, { 0x98, 0xb8, 0xca, 0xc2, 0x3c, 0xdc, 0xc1, 0xb1 }
-};
-
-static EFI_GUID my_gQuarkPlatformTokenSpaceGuid = {
-  0x199c1ef0, 0x6400, 0x41c5, { 0xb0, 0xa4, 0xff, 0xbf, 0x21, 0x9d, 0xcb, 0xae }
-};
-
-static EFI_GUID my_gEfiMemoryConfigDataGuid = {
-  0x80dbd530, 0xb74c, 0x4f11, { 0x8c, 0x3, 0x41, 0x86, 0x65, 0x53, 0x28, 0x31 }
-};
-
-static EFI_GUID my_gPowerManagementAcpiTableStorageGuid = {
-  0x161be597, 0xe9c5, 0x49db, { 0xae, 0x50, 0xc4, 0x62, 0xab, 0x54, 0xee, 0xda }
-};
-
-static EFI_GUID my_gEfiQuarkCapsuleGuid = {
-  0xd400d1e4, 0xa314, 0x442b, { 0x89, 0xed, 0xa9, 0x2e, 0x4c, 0x81, 0x97, 0xcb }
-};
-
-static EFI_GUID my_gQuarkVariableLockGuid = {
-  0xeef749c2, 0xc047, 0x4d6e, { 0xb1, 0xbc, 0xd3, 0x6e, 0xb3, 0xa5, 0x55, 0x9c }
-};
-
-static EFI_GUID my_gEfiGlobalNvsAreaProtocolGuid = {
-  0x74e1e48, 0x8132, 0x47a1, { 0x8c, 0x2c, 0x3f, 0x14, 0xad, 0x9a, 0x66, 0xdc }
-};
-
-static EFI_GUID my_gEfiSmmSpiReadyProtocolGuid = {
-  0x7a5dbc75, 0x5b2b, 0x4e67, { 0xbd, 0xe1, 0xd4, 0x8e, 0xee, 0x76, 0x15, 0x62 }
-};
-
-static EFI_GUID my_gEfiIioUdsProtocolGuid = {
-  0xa7ced760, 0xc71c, 0x4e1a, { 0xac, 0xb1, 0x89, 0x60, 0x4d, 0x52, 0x16, 0xcb }
-};
-
-static EFI_GUID my_gEfiQuarkNcSocIdTokenSpaceGuid = {
-  0xca452c6a, 0xdf0c, 0x4dc9, { 0x82, 0xfb, 0xea, 0xe2, 0xab, 0x31, 0x29, 0x46 }
-};
-
-static EFI_GUID my_gQncS3CodeInLockBoxGuid = {
-  0x1f18c5b3, 0x29ed, 0x4d9e, { 0xa5, 0x4, 0x6d, 0x97, 0x8e, 0x7e, 0xd5, 0x69 }
-};
-
-static EFI_GUID my_gQncS3ContextInLockBoxGuid = {
-  0xe5769ea9, 0xe706, 0x454b, { 0x95, 0x7f, 0xaf, 0xc6, 0xdb, 0x4b, 0x8a, 0xd }
-};
-
-static EFI_GUID my_gEfiQuarkSCSocIdTokenSpaceGuid = {
-  0xef251b71, 0xceed, 0x484e, { 0x82, 0xe3, 0x3a, 0x1f, 0x34, 0xf5, 0x12, 0xe2 }
-};
-
-static EFI_GUID my_gQNCMemoryInitPpiGuid = {
-  0x21ff1fee, 0xd33a, 0x4fce, { 0xa6, 0x5e, 0x95, 0x5e, 0xa3, 0xc4, 0x1f, 0x40 }
-};
-
-static EFI_GUID my_gEfiPlatformPolicyProtocolGuid = {
-  0x2977064f, 0xab96, 0x4fa9, { 0x85, 0x45, 0xf9, 0xc4, 0x2, 0x51, 0xe0, 0x7f }
-};
-
-static EFI_GUID my_gEfiSmmIchnDispatch2ProtocolGuid = {
-  0xadf3a128, 0x416d, 0x4060, { 0x8d, 0xdf, 0x30, 0xa1, 0xd7, 0xaa, 0xb6, 0x99 }
-};
-
-static EFI_GUID my_gEfiSpiProtocolGuid = {
-  0x1156efc6, 0xea32, 0x4396, { 0xb5, 0xd5, 0x26, 0x93, 0x2e, 0x83, 0xc3, 0x13 }
-};
-
-static EFI_GUID my_gEfiSmmSpiProtocolGuid = {
-  0xd9072c35, 0xeb8f, 0x43ad, { 0xa2, 0x20, 0x34, 0xd4, 0xe, 0x2a, 0x82, 0x85 }
-};
-
-static EFI_GUID my_gEfiQncS3SupportProtocolGuid = {
-  0xe287d20b, 0xd897, 0x4e1e, { 0xa5, 0xd9, 0x97, 0x77, 0x63, 0x93, 0x6a, 0x4 }
-};
-
-static EFI_GUID my_gEfiSDHostIoProtocolGuid = {
-  0xb63f8ec7, 0xa9c9, 0x4472, { 0xa4, 0xc0, 0x4d, 0x8b, 0xf3, 0x65, 0xcc, 0x51 }
-};
-
-static EFI_GUID my_gEfiSecurityPkgTokenSpaceGuid = {
-  0xd3fb176, 0x9569, 0x4d51, { 0xa3, 0xef, 0x7d, 0x61, 0xc6, 0x4f, 0xea, 0xba }
-};
-
-static EFI_GUID my_gEfiSecureBootEnableDisableGuid = {
-  0xf0a30bc7, 0xaf08, 0x4556, { 0x99, 0xc4, 0x0, 0x10, 0x9, 0xc9, 0x3a, 0x44 }
-};
-
-static EFI_GUID my_gEfiCustomModeEnableGuid = {
-  0xc076ec0c, 0x7028, 0x4399, { 0xa0, 0x72, 0x71, 0xee, 0x5c, 0x44, 0x8b, 0x9f }
-};
-
-static EFI_GUID my_gEfiVendorKeysNvGuid = {
-  0x9073e4e0, 0x60ec, 0x4b6e, { 0x99, 0x3, 0x4c, 0x22, 0x3c, 0x26, 0xf, 0x3c }
-};
-
-static EFI_GUID my_gEfiCertDbGuid = {
-  0xd9bee56e, 0x75dc, 0x49d9, { 0xb4, 0xd7, 0xb5, 0x34, 0x21, 0xf, 0x63, 0x7a }
-};
-
-static EFI_GUID my_gTcgEventEntryHobGuid = {
-  0x2b9ffb52, 0x1b13, 0x416f, { 0xa8, 0x7b, 0xbc, 0x93, 0xd, 0xef, 0x92, 0xa8 }
-};
-
-static EFI_GUID my_gTcgEvent2EntryHobGuid = {
-  0xd26c221e, 0x2430, 0x4c8a, { 0x91, 0x70, 0x3f, 0xcb, 0x45, 0x0, 0x41, 0x3f }
-};
-
-static EFI_GUID my_gTpmErrorHobGuid = {
-  0xef598499, 0xb25e, 0x473a, { 0xbf, 0xaf, 0xe7, 0xe5, 0x7d, 0xce, 0x82, 0xc4 }
-};
-
-static EFI_GUID my_gTpm2StartupLocalityHobGuid = {
-  0x397b0c9, 0x22e8, 0x459e, { 0xa4, 0xff, 0x99, 0xbc, 0x65, 0x27, 0x9, 0x29 }
-};
-
-static EFI_GUID my_gMeasuredFvHobGuid = {
-  0xb2360b42, 0x7173, 0x420a, { 0x86, 0x96, 0x46, 0xca, 0x6b, 0xab, 0x10, 0x60 }
-};
-
-static EFI_GUID my_gEfiPhysicalPresenceGuid = {
-  0xf6499b1, 0xe9ad, 0x493d, { 0xb9, 0xc2, 0x2f, 0x90, 0x81, 0x5c, 0x6c, 0xbc }
-};
-
-static EFI_GUID my_gEfiTcg2PhysicalPresenceGuid = {
-  0xaeb9c5c1, 0x94f1, 0x4d02, { 0xbf, 0xd9, 0x46, 0x2, 0xdb, 0x2d, 0x3c, 0x54 }
-};
-
-static EFI_GUID my_gPwdCredentialProviderGuid = {
-  0x78b9ec8b, 0xc000, 0x46c5, { 0xac, 0x93, 0x24, 0xa0, 0xc1, 0xbb, 0x0, 0xce }
-};
-
-static EFI_GUID my_gUsbCredentialProviderGuid = {
-  0xd0849ed1, 0xa88c, 0x4ba6, { 0xb1, 0xd6, 0xab, 0x50, 0xe2, 0x80, 0xb7, 0xa9 }
-};
-
-static EFI_GUID my_gUserIdentifyManagerGuid = {
-  0x3ccd3dd8, 0x8d45, 0x4fed, { 0x96, 0x2d, 0x2b, 0x38, 0xcd, 0x82, 0xb3, 0xc4 }
-};
-
-static EFI_GUID my_gUserProfileManagerGuid = {
-  0xc35f272c, 0x97c2, 0x465a, { 0xa2, 0x16, 0x69, 0x6b, 0x66, 0x8a, 0x8c, 0xfe }
-};
-
-static EFI_GUID my_gTcgConfigFormSetGuid = {
-  0xb0f901e4, 0xc424, 0x45de, { 0x90, 0x81, 0x95, 0xe2, 0xb, 0xde, 0x6f, 0xb5 }
-};
-
-static EFI_GUID my_gTcg2ConfigFormSetGuid = {
-  0x6339d487, 0x26ba, 0x424b, { 0x9a, 0x5d, 0x68, 0x7e, 0x25, 0xd7, 0x40, 0xbc }
-};
-
-static EFI_GUID my_gSecureBootConfigFormSetGuid = {
-  0x5daf50a5, 0xea81, 0x4de2, { 0x8f, 0x9b, 0xca, 0xbd, 0xa9, 0xcf, 0x5c, 0x14 }
-};
-
-static EFI_GUID my_gEfiTpmDeviceInstanceTpm12Guid = {
-  0x8b01e5b6, 0x4f19, 0x46e8, { 0xab, 0x93, 0x1c, 0x53, 0x67, 0x1b, 0x90, 0xcc }
-};
-
-static EFI_GUID my_gEfiTpmDeviceInstanceTpm20DtpmGuid = {
-  0x286bf25a, 0xc2c3, 0x408c, { 0xb3, 0xb4, 0x25, 0xe6, 0x75, 0x8b, 0x73, 0x17 }
-};
-
-static EFI_GUID my_gEfiTpmDeviceSelectedGuid = {
-  0x7f4158d3, 0x74d, 0x456d, { 0x8c, 0xb2, 0x1, 0xf9, 0xc8, 0xf7, 0x9d, 0xaa }
-};
-
-static EFI_GUID my_gOpalExtraInfoVariableGuid = {
-  0x44a2ad5d, 0x612c, 0x47b3, { 0xb0, 0x6e, 0xc8, 0xf5, 0xb, 0xfb, 0xf0, 0x7d }
-};
-
-static EFI_GUID my_gPeiLockPhysicalPresencePpiGuid = {
-  0xef9aefe5, 0x2bd3, 0x4031, { 0xaf, 0x7d, 0x5e, 0xfe, 0x5a, 0xbb, 0x9a, 0xd }
-};
-
-static EFI_GUID my_gPeiTpmInitializedPpiGuid = {
-  0xe9db0d58, 0xd48d, 0x47f6, { 0x9c, 0x6e, 0x6f, 0x40, 0xe8, 0x6c, 0x7b, 0x41 }
-};
-
-static EFI_GUID my_gPeiTpmInitializationDonePpiGuid = {
-  0xa030d115, 0x54dd, 0x447b, { 0x90, 0x64, 0xf2, 0x6, 0x88, 0x3d, 0x7c, 0xcc }
-};
-
-static EFI_GUID my_gEfiPeiFirmwareVolumeInfoMeasurementExcludedPpiGuid = {
-  0x6e056ff9, 0xc695, 0x4364, { 0x9e, 0x2c, 0x61, 0x26, 0xf5, 0xce, 0xea, 0xae }
-};
-
-static EFI_GUID my_gEdkiiPeiFirmwareVolumeInfoPrehashedFvPpiGuid = {
-  0x3ce1e631, 0x7008, 0x477c, { 0xad, 0xa7, 0x5d, 0xcf, 0xc7, 0xc1, 0x49, 0x4b }
-};
-
-static EFI_GUID my_gEfiShellEnvironment2ExtGuid = {
-  0xd2c18636, 0x40e5, 0x4eb5, { 0xa3, 0x1b, 0x36, 0x69, 0x5f, 0xd4, 0x2c, 0x87 }
-};
-
-static EFI_GUID my_gEfiShellPkgTokenSpaceGuid = {
-  0x171e9188, 0x31d3, 0x40f5, { 0xb1, 0xc, 0x53, 0x9b, 0x2d, 0xb9, 0x40, 0xcd }
-};
-
-static EFI_GUID my_gShellVariableGuid = {
-  0x158def5a, 0xf656, 0x419c, { 0xb0, 0x27, 0x7a, 0x31, 0x92, 0xc0, 0x79, 0xd2 }
-};
-
-static EFI_GUID my_gShellMapGuid = {
-  0x51271e13, 0x7de3, 0x43af, { 0x8b, 0xc2, 0x71, 0xad, 0x3b, 0x82, 0x43, 0x25 }
-};
-
-static EFI_GUID my_gShellAliasGuid = {
-  0x53d9d6, 0x2659, 0x4599, { 0xa2, 0x6b, 0xef, 0x45, 0x36, 0xe6, 0x31, 0xa9 }
-};
-
-static EFI_GUID my_gHandleParsingHiiGuid = {
-  0xb8969637, 0x81de, 0x43af, { 0xbc, 0x9a, 0x24, 0xd9, 0x89, 0x13, 0xf2, 0xf6 }
-};
-
-static EFI_GUID my_gShellDebug1HiiGuid = {
-  0x25f200aa, 0xd3cb, 0x470a, { 0xbf, 0x51, 0xe7, 0xd1, 0x62, 0xd2, 0x2e, 0x6f }
-};
-
-static EFI_GUID my_gShellDriver1HiiGuid = {
-  0xaf0b742, 0x63ec, 0x45bd, { 0x8d, 0xb6, 0x71, 0xad, 0x7f, 0x2f, 0xe8, 0xe8 }
-};
-
-static EFI_GUID my_gShellInstall1HiiGuid = {
-  0x7d574d54, 0xd364, 0x4d4a, { 0x95, 0xe3, 0x49, 0x45, 0xdb, 0x7a, 0xd3, 0xee }
-};
-
-static EFI_GUID my_gShellLevel1HiiGuid = {
-  0xdec5daa4, 0x6781, 0x4820, { 0x9c, 0x63, 0xa7, 0xb0, 0xe4, 0xf1, 0xdb, 0x31 }
-};
-
-static EFI_GUID my_gShellLevel2HiiGuid = {
-  0xf95a7ccc, 0x4c55, 0x4426, { 0xa7, 0xb4, 0xdc, 0x89, 0x61, 0x95, 0xb, 0xae }
-};
-
-static EFI_GUID my_gShellLevel3HiiGuid = {
-  0x4344558d, 0x4ef9, 0x4725, { 0xb1, 0xe4, 0x33, 0x76, 0xe8, 0xd6, 0x97, 0x4f }
-};
-
-static EFI_GUID my_gShellNetwork1HiiGuid = {
-  0xf3d301bb, 0xf4a5, 0x45a8, { 0xb0, 0xb7, 0xfa, 0x99, 0x9c, 0x62, 0x37, 0xae }
-};
-
-static EFI_GUID my_gShellNetwork2HiiGuid = {
-  0x174b2b5, 0xf505, 0x4b12, { 0xaa, 0x60, 0x59, 0xdf, 0xf8, 0xd6, 0xea, 0x37 }
-};
-
-static EFI_GUID my_gShellTftpHiiGuid = {
-  0x738a9314, 0x82c1, 0x4592, { 0x8f, 0xf7, 0xc1, 0xbd, 0xf1, 0xb2, 0xe, 0xd4 }
-};
-
-static EFI_GUID my_gShellBcfgHiiGuid = {
-  0x5f5f605d, 0x1583, 0x4a2d, { 0xa6, 0xb2, 0xeb, 0x12, 0xda, 0xb4, 0xa2, 0xb6 }
-};
-
-static EFI_GUID my_gUefiShellFileGuid = {
-  0x7c04a583, 0x9e3e, 0x4f1c, { 0xad, 0x65, 0xe0, 0x52, 0x68, 0xd0, 0xb4, 0xd1 }
-};
-
-static EFI_GUID my_gEfiShellEnvironment2Guid = {
-  0x47c7b221, 0xc42a, 0x11d2, { 0x8e, 0x57, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiShellInterfaceGuid = {
-  0x47c7b223, 0xc42a, 0x11d2, { 0x8e, 0x57, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiSignedCapsulePkgTokenSpaceGuid = {
-  0xe1eb612f, 0x1c6c, 0x485d, { 0x9d, 0x6, 0x65, 0x8, 0x44, 0x88, 0x15, 0x69 }
-};
-
-static EFI_GUID my_gEdkiiSystemFirmwareImageDescriptorFileGuid = {
-  0x90b2b846, 0xca6d, 0x4d6e, { 0xa8, 0xd3, 0xc1, 0x40, 0xa8, 0xe1, 0x10, 0xac }
-};
-
-static EFI_GUID my_gEdkiiSystemFmpCapsuleConfigFileGuid = {
-  0x812136d3, 0x4d3a, 0x433a, { 0x94, 0x18, 0x29, 0xbb, 0x9b, 0xf7, 0x8f, 0x6e }
-};
-
-static EFI_GUID my_gEdkiiSystemFmpCapsuleDriverFvFileGuid = {
-  0xce57b167, 0xb0e4, 0x41e8, { 0xa8, 0x97, 0x5f, 0x4f, 0xeb, 0x78, 0x1d, 0x40 }
-};
-
-static EFI_GUID my_gEfiDebugAgentGuid = {
-  0x865a5a9b, 0xb85d, 0x474c, { 0x84, 0x55, 0x65, 0xd1, 0xbe, 0x84, 0x4b, 0xe2 }
-};
-
-static EFI_GUID my_gEfiSourceLevelDebugPkgTokenSpaceGuid = {
-  0x865a5aab, 0xb85d, 0x474c, { 0x84, 0x55, 0x65, 0xd1, 0xbe, 0x84, 0x4b, 0xe2 }
-};
-
-static EFI_GUID my_gStdLibTokenSpaceGuid = {
-  0x447559f0, 0xd02e, 0x4cf1, { 0x99, 0xbc, 0xca, 0x11, 0x65, 0x40, 0x54, 0xc2 }
-};
-
-static EFI_GUID my_gEfiSocketProtocolGuid = {
-  0x58e6ed63, 0x1694, 0x440b, { 0x93, 0x88, 0xe9, 0x8f, 0xed, 0x6b, 0x65, 0xaf }
-};
-
-static EFI_GUID my_gEfiSocketServiceBindingProtocolGuid = {
-  0x8aaedb2a, 0xa6bb, 0x47c6, { 0x94, 0xce, 0x1b, 0x80, 0x96, 0x42, 0x3f, 0x2a }
-};
-
-static EFI_GUID my_gUefiCpuPkgTokenSpaceGuid = {
-  0xac05bf33, 0x995a, 0x4ed4, { 0xaa, 0xb8, 0xef, 0x7a, 0xe8, 0xf, 0x5c, 0xb0 }
-};
-
-static EFI_GUID my_gMsegSmramGuid = {
-  0x5802bce4, 0xeeee, 0x4e33, { 0xa1, 0x30, 0xeb, 0xad, 0x27, 0xf0, 0xe4, 0x39 }
-};
-
-static EFI_GUID my_gEdkiiCpuFeaturesSetDoneGuid = {
-  0xa82485ce, 0xad6b, 0x4101, { 0x99, 0xd3, 0xe1, 0x35, 0x8c, 0x9e, 0x7e, 0x37 }
-};
-
-static EFI_GUID my_gEdkiiCpuFeaturesInitDoneGuid = {
-  0xc77c3a41, 0x61ab, 0x4143, { 0x98, 0x3e, 0x33, 0x39, 0x28, 0x6, 0x28, 0xe5 }
-};
-
-static EFI_GUID my_gEfiSmmCpuServiceProtocolGuid = {
-  0x1d202cab, 0xc8ab, 0x4d5c, { 0x94, 0xf7, 0x3c, 0xfc, 0xc0, 0xd3, 0xd3, 0x35 }
-};
-
-static EFI_GUID my_gEfiSmMonitorInitProtocolGuid = {
-  0x228f344d, 0xb3de, 0x43bb, { 0xa4, 0xd7, 0xea, 0x20, 0xb, 0x1b, 0x14, 0x82 }
-};
-
-static EFI_GUID my_gVlvPolicyPpiGuid = {
-  0x7d84b2c2, 0x22a1, 0x4372, { 0xb1, 0x2c, 0xeb, 0xb2, 0x32, 0xd3, 0xa6, 0xa3 }
-};
-
-static EFI_GUID my_gVlvMmioPolicyPpiGuid = {
-  0xe767bf7f, 0x4db6, 0x5b34, { 0x10, 0x11, 0x4f, 0xbe, 0x4c, 0xa7, 0xaf, 0xd2 }
-};
-
-static EFI_GUID my_gPeiSmbusPolicyPpiGuid = {
-  0x63b6e435, 0x32bc, 0x49c6, { 0x81, 0xbd, 0xb7, 0xa1, 0xa0, 0xfe, 0x1a, 0x6c }
-};
-
-static EFI_GUID my_gSeCfTPMPpiGuid = {
-  0x10e26df1, 0x8775, 0x4ee1, { 0xb5, 0xa, 0x3a, 0xe8, 0x28, 0x93, 0x70, 0x3a }
-};
-
-static EFI_GUID my_gPchUsbPolicyPpiGuid = {
-  0xc02b0573, 0x2b4e, 0x4a31, { 0xa3, 0x1a, 0x94, 0x56, 0x7b, 0x50, 0x44, 0x2c }
-};
-
-static EFI_GUID my_gPchInitPpiGuid = {
-  0x9ea894a, 0xbe0d, 0x4230, { 0xa0, 0x3, 0xed, 0xc6, 0x93, 0xb4, 0x8e, 0x95 }
-};
-
-static EFI_GUID my_gPchPlatformPolicyPpiGuid = {
-  0x15344673, 0xd365, 0x4be2, { 0x85, 0x13, 0x14, 0x97, 0xcc, 0x7, 0x61, 0x1d }
-};
-
-static EFI_GUID my_gPeiSpiPpiGuid = {
-  0xa38c6898, 0x2b5c, 0x4ff6, { 0x93, 0x26, 0x2e, 0x63, 0x21, 0x2e, 0x56, 0xc2 }
-};
-
-static EFI_GUID my_gVlvPeiInitPpiGuid = {
-  0x9ea8911, 0xbe0d, 0x4230, { 0xa0, 0x3, 0xed, 0xc6, 0x93, 0xb4, 0x8e, 0x11 }
-};
-
-static EFI_GUID my_gSeCUmaPpiGuid = {
-  0xcbd86677, 0x362f, 0x4c04, { 0x94, 0x59, 0xa7, 0x41, 0x32, 0x6e, 0x5, 0xcf }
-};
-
-static EFI_GUID my_gPeiSeCPlatformPolicyPpiGuid = {
-  0x7ae3ceb7, 0x2ee2, 0x48fa, { 0xaa, 0x49, 0x35, 0x10, 0xbc, 0x83, 0xca, 0xbf }
-};
-
-static EFI_GUID my_gPeiHeciPpiGuid = {
-  0xee0ea811, 0xfbd9, 0x4777, { 0xb9, 0x5a, 0xba, 0x4f, 0x71, 0x10, 0x1f, 0x74 }
-};
-
-static EFI_GUID my_gPeiSdhcPpiGuid = {
-  0xf4ef9d7a, 0x98c5, 0x4c1a, { 0xb4, 0xd9, 0xd8, 0xd8, 0x72, 0x65, 0xbe, 0xc }
-};
-
-static EFI_GUID my_gPeiBlockIoPpiGuid = {
-  0xbc5fa650, 0xedbb, 0x4d0d, { 0xb3, 0xa3, 0xd9, 0x89, 0x7, 0xf8, 0x47, 0xdf }
-};
-
-static EFI_GUID my_gSeCfTPMPolicyPpiGuid = {
-  0x4fd1ba49, 0x8f90, 0x471a, { 0xa2, 0xc9, 0x17, 0x3c, 0x7a, 0x73, 0x2f, 0xd0 }
-};
-
-static EFI_GUID my_gPchPeiInitPpiGuid = {
-  0xacb93b08, 0x5cdc, 0x4a8f, { 0x93, 0xd4, 0x6, 0xe3, 0x42, 0xdf, 0x18, 0x2e }
-};
-
-static EFI_GUID my_gPttPassThruPpiGuid = {
-  0xc5068bac, 0xa7dc, 0x42f1, { 0xae, 0x80, 0xca, 0xa2, 0x4b, 0xb4, 0x90, 0x4b }
-};
-
-static EFI_GUID my_gPpmPlatformPolicyProtocolGuid = {
-  0xddabfeac, 0xef63, 0x452c, { 0x8f, 0x39, 0xed, 0x7f, 0xae, 0xd8, 0x26, 0x5e }
-};
-
-static EFI_GUID my_gMemInfoProtocolGuid = {
-  0x6f20f7c8, 0xe5ef, 0x4f21, { 0x8d, 0x19, 0xed, 0xc5, 0xf0, 0xc4, 0x96, 0xae }
-};
-
-static EFI_GUID my_gEfiSmmIchnDispatchExProtocolGuid = {
-  0x3920405b, 0xc897, 0x44da, { 0x88, 0xf3, 0x4c, 0x49, 0x8a, 0x6f, 0xf7, 0x36 }
-};
-
-static EFI_GUID my_gPchResetProtocolGuid = {
-  0xdb63592c, 0xb8cc, 0x44c8, { 0x91, 0x8c, 0x51, 0xf5, 0x34, 0x59, 0x8a, 0x5a }
-};
-
-static EFI_GUID my_gPchResetCallbackProtocolGuid = {
-  0x3a3300ab, 0xc929, 0x487d, { 0xab, 0x34, 0x15, 0x9b, 0xc1, 0x35, 0x62, 0xc0 }
-};
-
-static EFI_GUID my_gDxePchPlatformPolicyProtocolGuid = {
-  0x4b0165a9, 0x61d6, 0x4e23, { 0xa0, 0xb5, 0x3e, 0xc7, 0x9c, 0x2e, 0x30, 0xd5 }
-};
-
-static EFI_GUID my_gEfiPchInfoProtocolGuid = {
-  0xd31f0400, 0x7d16, 0x4316, { 0xbf, 0x88, 0x60, 0x65, 0x88, 0x3b, 0x40, 0x2b }
-};
-
-static EFI_GUID my_gEfiPchExtendedResetProtocolGuid = {
-  0xf0bbfca0, 0x684e, 0x48b3, { 0xba, 0xe2, 0x6c, 0x84, 0xb8, 0x9e, 0x53, 0x39 }
-};
-
-static EFI_GUID my_gEfiActiveBiosProtocolGuid = {
-  0xebbe2d1b, 0x1647, 0x4bda, { 0xab, 0x9a, 0x78, 0x63, 0xe3, 0x96, 0xd4, 0x1a }
-};
-
-static EFI_GUID my_gDxeIchPlatformPolicyProtocolGuid = {
-  0xf617b358, 0x12cf, 0x414a, { 0xa0, 0x69, 0x60, 0x67, 0x7b, 0xda, 0x13, 0xb3 }
-};
-
-static EFI_GUID my_gEfiSmmSmbusProtocolGuid = {
-  0x72e40094, 0x2ee1, 0x497a, { 0x8f, 0x33, 0x4c, 0x93, 0x4a, 0x9e, 0x9c, 0xc }
-};
-
-static EFI_GUID my_gDxeVlvPlatformPolicyGuid = {
-  0x5bab88ba, 0xe0e2, 0x4674, { 0xb6, 0xad, 0xb8, 0x12, 0xf6, 0x88, 0x1c, 0xd6 }
-};
-
-static EFI_GUID my_gIgdOpRegionProtocolGuid = {
-  0xcdc5dddf, 0xe79d, 0x41ec, { 0xa9, 0xb0, 0x65, 0x65, 0x49, 0xd, 0xb9, 0xd3 }
-};
-
-static EFI_GUID my_gEfiHeciProtocolGuid = {
-  0xcfb33810, 0x6e87, 0x4284, { 0xb2, 0x3, 0xa6, 0x6a, 0xbe, 0x7, 0xf6, 0xe8 }
-};
-
-static EFI_GUID my_gPlatformSeCHookProtocolGuid = {
-  0xbc52476e, 0xf67e, 0x4301, { 0xb2, 0x62, 0x36, 0x9c, 0x48, 0x78, 0xaa, 0xc2 }
-};
-
-static EFI_GUID my_gEfiSeCRcInfoProtocolGuid = {
-  0x11fbfdfb, 0x10d2, 0x43e6, { 0xb5, 0xb1, 0xb4, 0x38, 0x6e, 0xdc, 0xcb, 0x9a }
-};
-
-static EFI_GUID my_gEfiTdtProtocolGuid = {
-  0xbf70067, 0xd53b, 0x42df, { 0xb7, 0x70, 0xe9, 0x2c, 0x91, 0xc6, 0x14, 0x11 }
-};
-
-static EFI_GUID my_gDxePlatformSeCPolicyGuid = {
-  0xf8bff014, 0x18fb, 0x4ef9, { 0xb1, 0xc, 0xae, 0x22, 0x73, 0x8d, 0xbe, 0xed }
-};
-
-static EFI_GUID my_gLpssDummyProtocolGuid = {
-  0xaf4cc162, 0xd41c, 0x455a, { 0xab, 0x45, 0x6d, 0xbc, 0xc1, 0xcd, 0x32, 0xf3 }
-};
-
-static EFI_GUID my_gEfiEmmcCardInfoProtocolGuid = {
-  0x1ebe5ab9, 0x2129, 0x49e7, { 0x84, 0xd7, 0xee, 0xb9, 0xfc, 0xe5, 0xde, 0xdd }
-};
-
-static EFI_GUID my_gEfiTdtOperationProtocolGuid = {
-  0xfd301ba4, 0x5e62, 0x4679, { 0xa0, 0x6f, 0xe0, 0x9a, 0xab, 0xdd, 0x2a, 0x91 }
-};
-
-static EFI_GUID my_gEfiDFUResultGuid = {
-  0x14a7c46f, 0xbc02, 0x4047, { 0x9f, 0x18, 0xa5, 0xd7, 0x25, 0xd8, 0xbd, 0x19 }
-};
-
-static EFI_GUID my_gPttPassThruProtocolGuid = {
-  0x73e2576, 0xf6c1, 0x4b91, { 0x92, 0xa9, 0xd4, 0x67, 0x5d, 0xda, 0x34, 0xb1 }
-};
-
-static EFI_GUID my_gEfiCPTokenSpaceGuid = {
-  0x918211ce, 0xa1d2, 0x43a0, { 0xa0, 0x4e, 0x75, 0xb5, 0xbf, 0x44, 0x50, 0xe }
-};
-
-static EFI_GUID my_gEfiSmbusArpMapGuid = {
-  0x707be83e, 0xbf6, 0x40a5, { 0xbe, 0x64, 0x34, 0xc0, 0x3a, 0xa0, 0xb8, 0xe2 }
-};
-
-static EFI_GUID my_gEfiVLVTokenSpaceGuid = {
-  0xca452c68, 0xdf0c, 0x45c9, { 0x82, 0xfb, 0xea, 0xe4, 0x2b, 0x31, 0x29, 0x46 }
-};
-
-static EFI_GUID my_gSataControllerDriverGuid = {
-  0xbb929da9, 0x68f7, 0x4035, { 0xb2, 0x2c, 0xa3, 0xbb, 0x3f, 0x23, 0xda, 0x55 }
-};
-
-static EFI_GUID my_gDxePchPolicyUpdateProtocolGuid = {
-  0x1a819e49, 0xd8ee, 0x48cb, { 0x9a, 0x9c, 0xa, 0xa0, 0xd2, 0x81, 0xa, 0x38 }
-};
-
-static EFI_GUID my_gEfiSetupVariableGuid = {
-  0xec87d643, 0xeba4, 0x4bb5, { 0xa1, 0xe5, 0x3f, 0x3e, 0x36, 0xb2, 0xd, 0xa9 }
-};
-
-static EFI_GUID my_gPchInitVariableGuid = {
-  0xe6c2f70a, 0xb604, 0x4877, { 0x85, 0xba, 0xde, 0xec, 0x89, 0xe1, 0x17, 0xeb }
-};
-
-static EFI_GUID my_gVlvRefCodePkgTokenSpaceGuid = {
-  0x85768e4a, 0x6cdc, 0x444e, { 0x93, 0xdf, 0x93, 0x66, 0x85, 0xb5, 0xdf, 0xcc }
-};
-
-static EFI_GUID my_gSeCPlatformReadyToBootGuid = {
-  0x3fdf171, 0x1d67, 0x4ace, { 0xa9, 0x4, 0x3e, 0x36, 0xd3, 0x38, 0xfa, 0x74 }
-};
-
-static EFI_GUID my_gAmtReadyToBootGuid = {
-  0x40b09b5a, 0xf0ef, 0x4627, { 0x93, 0xd5, 0x27, 0xf0, 0x4b, 0x75, 0x4d, 0x5 }
-};
-
-static EFI_GUID my_gEfiVlv2VariableGuid = {
-  0x10ba6bbe, 0xa97e, 0x41c3, { 0x9a, 0x7, 0x60, 0x7a, 0xd9, 0xbd, 0x60, 0xe5 }
-};
-
-static EFI_GUID my_gPeiSpeakerInterfacePpiGuid = {
-  0x30ac275e, 0xbb30, 0x4b84, { 0xa1, 0xcd, 0xa, 0xf1, 0x32, 0x2c, 0x89, 0xc0 }
-};
-
-static EFI_GUID my_gPeiMfgMemoryTestPpiGuid = {
-  0xab294a92, 0xeaf5, 0x4cf3, { 0xab, 0x2b, 0x2d, 0x4b, 0xed, 0x4d, 0xb6, 0x3d }
-};
-
-static EFI_GUID my_gPeiSha256HashPpiGuid = {
-  0x950e191b, 0x8524, 0x4f51, { 0x80, 0xa1, 0x5c, 0x4f, 0x1b, 0x3, 0xf3, 0x5c }
-};
-
-static EFI_GUID my_gEfiPlatformBootModeGuid = {
-  0xce845704, 0x1683, 0x4d38, { 0xa4, 0xf9, 0x7d, 0xb, 0x50, 0x77, 0x57, 0x93 }
-};
-
-static EFI_GUID my_gEfiPlatformInfoGuid = {
-  0x1e2acc41, 0xe26a, 0x483d, { 0xaf, 0xc7, 0xa0, 0x56, 0xc3, 0x4e, 0x8, 0x7b }
-};
-
-static EFI_GUID my_gPlatformModuleTokenSpaceGuid = {
-  0x69d13bf0, 0xaf91, 0x4d96, { 0xaa, 0x9f, 0x21, 0x84, 0xc5, 0xce, 0x3b, 0xc0 }
-};
-
-static EFI_GUID my_gEfiSerialPortTokenSpaceGuid = {
-  0x5fad2389, 0x2bc7, 0x4bd2, { 0x83, 0xd3, 0x42, 0x9f, 0xb6, 0xae, 0xa3, 0x3f }
-};
-
-static EFI_GUID my_gEfiIchTokenSpaceGuid = {
-  0xe38c11e3, 0x968f, 0x47b8, { 0xac, 0xef, 0xac, 0xc0, 0x69, 0x3d, 0xb9, 0xff }
-};
-
-static EFI_GUID my_gEfiPchTokenSpaceGuid = {
-  0x89a1b278, 0xa1a1, 0x4df7, { 0xb1, 0x37, 0xde, 0x5a, 0xd7, 0xc4, 0x79, 0x13 }
-};
-
-static EFI_GUID my_gEfiSioVariableGuid = {
-  0x560bf58a, 0x1e0d, 0x4d7e, { 0x95, 0x3f, 0x29, 0x80, 0xa2, 0x61, 0xe0, 0x31 }
-};
-
-static EFI_GUID my_gProcessorProducerGuid = {
-  0x1bf06aea, 0x5bec, 0x4a8d, { 0x95, 0x76, 0x74, 0x9b, 0x9, 0x56, 0x2d, 0x30 }
-};
-
-static EFI_GUID my_gEfiPowerOnHobGuid = {
-  0x468a601, 0xc535, 0x46fd, { 0xa9, 0x5d, 0xbb, 0xab, 0x99, 0x1b, 0x17, 0x8c }
-};
-
-static EFI_GUID my_gEfiPlatformCpuInfoGuid = {
-  0xbb9c7ab7, 0xb8d9, 0x4bf3, { 0x9c, 0x29, 0x9b, 0xf3, 0x41, 0xe2, 0x17, 0xbc }
-};
-
-static EFI_GUID my_gEfiBiosIdGuid = {
-  0xc3e36d09, 0x8294, 0x4b97, { 0xa8, 0x57, 0xd5, 0x28, 0x8f, 0xe3, 0x3e, 0x28 }
-};
-
-static EFI_GUID my_gEfiBoardFeaturesGuid = {
-  0x94b9e8ae, 0x8877, 0x479a, { 0x98, 0x42, 0xf5, 0x97, 0x4b, 0x82, 0xce, 0xd3 }
-};
-
-static EFI_GUID my_gItkDataVarGuid = {
-  0x3812723d, 0x7e48, 0x4e29, { 0xbc, 0x27, 0xf5, 0xa3, 0x9a, 0xc9, 0x4e, 0xf1 }
-};
-
-static EFI_GUID my_gDmiDataGuid = {
-  0x70e56c5e, 0x280c, 0x44b0, { 0xa4, 0x97, 0x9, 0x68, 0x1a, 0xbc, 0x37, 0x5e }
-};
-
-static EFI_GUID my_gIdccDataHubGuid = {
-  0x788e1d9f, 0x1eab, 0x47d2, { 0xa2, 0xf3, 0x78, 0xca, 0xe8, 0x7d, 0x60, 0x12 }
-};
-
-static EFI_GUID my_gMfgModeVariableGuid = {
-  0xef14fd78, 0x793, 0x4e2b, { 0xac, 0x6d, 0x6, 0x28, 0x47, 0xe0, 0x17, 0x91 }
-};
-
-static EFI_GUID my_gEfiAcpiTableStorageGuid = {
-  0x7e374e25, 0x8e01, 0x4fee, { 0x87, 0xf2, 0x39, 0xc, 0x23, 0xc6, 0x6, 0xcd }
-};
-
-static EFI_GUID my_gACPIOSFRMfgStringVariableGuid = {
-  0x72234213, 0xfd7, 0x48a1, { 0xa5, 0x9f, 0xb4, 0x1b, 0xc1, 0x7, 0xfb, 0xcd }
-};
-
-static EFI_GUID my_gACPIOSFRModelStringVariableGuid = {
-  0xca1bcad9, 0xe021, 0x4547, { 0xa1, 0xb0, 0x5b, 0x22, 0xc7, 0xf6, 0x87, 0xf4 }
-};
-
-static EFI_GUID my_gEfiPciLanInfoGuid = {
-  0xd9a1427, 0xe02a, 0x437d, { 0x92, 0x6b, 0xaa, 0x52, 0x1f, 0xd7, 0x22, 0xba }
-};
-
-static EFI_GUID my_gFirmwareIdGuid = {
-  0x5e559c23, 0x1faa, 0x4ae1, { 0x8d, 0x4a, 0xc6, 0xcf, 0x2, 0x6c, 0x76, 0x6f }
-};
-
-static EFI_GUID my_gOsSelectionVariableGuid = {
-  0x86843f56, 0x675d, 0x40a5, { 0x95, 0x30, 0xbc, 0x85, 0x83, 0x72, 0xf1, 0x3 }
-};
-
-static EFI_GUID my_gEfiPlatformCpuProtocolGuid = {
-  0xbd26cdc9, 0xa092, 0x462a, { 0x87, 0x7a, 0x5a, 0xb6, 0xad, 0xce, 0x48, 0x12 }
-};
-
-static EFI_GUID my_gEfiTpmMpDriverProtocolGuid = {
-  0xde161cfe, 0x1e60, 0x42a1, { 0x8c, 0xc3, 0xee, 0x7e, 0xf0, 0x73, 0x52, 0x12 }
-};
-
-static EFI_GUID my_gEfiLpcWpce791PolicyProtocolGuid = {
-  0xab2bee2f, 0xc1a6, 0x4399, { 0x85, 0x3d, 0xc0, 0x7c, 0x77, 0x4f, 0xfd, 0xd }
-};
-
-static EFI_GUID my_gUsbPolicyGuid = {
-  0xf617b358, 0x12cf, 0x414a, { 0xa0, 0x69, 0x60, 0x67, 0x7b, 0xda, 0x13, 0xb4 }
-};
-
-static EFI_GUID my_gEfiSpeakerInterfaceProtocolGuid = {
-  0x400b4476, 0x3081, 0x11d6, { 0x87, 0xed, 0x0, 0x6, 0x29, 0x45, 0xc3, 0xb9 }
-};
-
-static EFI_GUID my_gEfiSmbiosSlotPopulationGuid = {
-  0xef7bf7d6, 0xf8ff, 0x4a76, { 0x82, 0x47, 0xc0, 0xd0, 0xd1, 0xcc, 0x49, 0xc0 }
-};
-
-static EFI_GUID my_gObservableProtocolGuid = {
-  0xe227c522, 0xd5fe, 0x4a53, { 0x87, 0xb1, 0xf, 0xbe, 0x57, 0xf, 0x98, 0xe9 }
-};
-
-static EFI_GUID my_gEfiCk505ClockPlatformInfoGuid = {
-  0x3c485ea4, 0x449a, 0x46ce, { 0xbb, 0x8, 0x2a, 0x33, 0x6e, 0xa9, 0x6b, 0x4e }
-};
-
-static EFI_GUID my_gEfiLpcWpc83627PolicyProtocolGuid = {
-  0xd3ecc567, 0x9fd5, 0x44c1, { 0x86, 0xcf, 0x5d, 0xa7, 0xa2, 0x4f, 0x4b, 0x5d }
-};
-
-static EFI_GUID my_gEfiTcoResetProtocolGuid = {
-  0xa6a79162, 0xe325, 0x4c30, { 0xbc, 0xc3, 0x59, 0x37, 0x30, 0x64, 0xef, 0xb3 }
-};
-
-static EFI_GUID my_gEfiWatchdogTimerDriverProtocolGuid = {
-  0xd5b06d16, 0x2ea1, 0x4def, { 0x98, 0xd0, 0xa0, 0x5d, 0x40, 0x72, 0x84, 0x17 }
-};
-
-static EFI_GUID my_gEfiPlatformIdeInitProtocolGuid = {
-  0x377c66a3, 0x8fe7, 0x4ee8, { 0x85, 0xb8, 0xf1, 0xa2, 0x82, 0x56, 0x9e, 0x3b }
-};
-
-static EFI_GUID my_gEnhancedSpeedstepProtocolGuid = {
-  0x91a1ddcf, 0x5374, 0x4939, { 0x89, 0x51, 0xd7, 0x29, 0x3f, 0x1a, 0x78, 0x6f }
-};
-
-static EFI_GUID my_gEfiGopDisplayBrightnessProtocolGuid = {
-  0x6ff23f1d, 0x877c, 0x4b1b, { 0x93, 0xfc, 0xf1, 0x42, 0xb2, 0xee, 0xa6, 0xa7 }
-};
-
-static EFI_GUID my_gEfiUsbKeyboardConnectGuid = {
-  0xad9c4381, 0x1ede, 0x430c, { 0x8d, 0x42, 0x23, 0x76, 0x7c, 0x46, 0x5d, 0x52 }
-};
-
-static EFI_GUID my_gEfiMmioDeviceProtocolGuid = {
-  0x24486226, 0xf8c2, 0x41f5, { 0xb9, 0xdd, 0x78, 0x3e, 0x9e, 0x56, 0xde, 0xa0 }
-};
-
-static EFI_GUID my_gEfiI2cAcpiProtocolGuid = {
-  0xf30c2915, 0x5782, 0x4e6a, { 0xa8, 0x46, 0x5, 0xba, 0xbc, 0xe7, 0xb6, 0xa0 }
-};
-
-static EFI_GUID my_gEfiI2cBusProtocolGuid = {
-  0x9fa1b225, 0x3346, 0x461b, { 0xa0, 0x69, 0xed, 0x1, 0xb6, 0x73, 0xd2, 0x40 }
-};
-
-static EFI_GUID my_gEfiI2cSlaveProtocolGuid = {
-  0xf2c1910e, 0xf5c9, 0x4b72, { 0xb2, 0x43, 0x6d, 0x59, 0x9, 0x6a, 0x79, 0xf0 }
-};
-
-static EFI_GUID my_gEfiSpiAcpiProtocolGuid = {
-  0x9f49a879, 0x3d71, 0x42b3, { 0xa0, 0xad, 0xdd, 0xb1, 0xf3, 0x30, 0x10, 0xa3 }
-};
-
-static EFI_GUID my_gEfiSpiHostProtocolGuid = {
-  0x951b65e5, 0x8872, 0x41ed, { 0xad, 0x1d, 0xd5, 0x68, 0x1f, 0x4a, 0xf0, 0x33 }
-};
-
-static EFI_GUID my_gEfiSpiBusProtocolGuid = {
-  0x137b3044, 0xf6d7, 0x473e, { 0xa6, 0x25, 0x9f, 0xb9, 0x25, 0x5, 0xc1, 0x80 }
-};
-
-static EFI_GUID my_gEfiGpioOperationProtocolGuid = {
-  0x38ddfe8f, 0x8991, 0x44aa, { 0x98, 0x89, 0x83, 0xf4, 0x91, 0x84, 0x65, 0xb0 }
-};
-
-static EFI_GUID my_gEfiEsrtOperationProtocolGuid = {
-  0x4549ab47, 0x6e60, 0x4293, { 0xb9, 0x1d, 0x31, 0xb6, 0x10, 0xad, 0x80, 0x56 }
-};
-
-static EFI_GUID my_gEfiFirmwareClassGuid = {
-  0xb122a262, 0x3551, 0x4f48, { 0x88, 0x92, 0x55, 0xf6, 0xc0, 0x61, 0x42, 0x90 }
-};
-
-static EFI_GUID my_gEfiDFUVerGuid = {
-  0xdc73aed, 0xcbf6, 0x4a25, { 0xa6, 0x8d, 0x59, 0xc8, 0xf, 0x44, 0xc7, 0xc3 }
-};
-
-static EFI_GUID my_gEfiCapsuleCrashLogVarGuid = {
-  0xf3ff1468, 0x4ba, 0x4966, { 0x9f, 0xb2, 0xe4, 0xa7, 0x90, 0x5, 0x46, 0x50 }
-};
-
-static EFI_GUID my_gEfiCapsuleCrashGuid = {
-  0xe1d2972, 0x65af, 0x4ac1, { 0xbf, 0xa3, 0xce, 0xf4, 0xab, 0xc, 0x38, 0xfe }
-};
-
-static EFI_GUID my_gAcousticSetupProtocolGuid = {
-  0xc1d7859d, 0x5719, 0x46c3, { 0xa2, 0x98, 0xd0, 0x71, 0xe3, 0x2, 0x64, 0xd1 }
-};
-
-static EFI_GUID my_gAddBootOptionGuid = {
-  0x19d96d3f, 0x6a6a, 0x47d2, { 0xb1, 0x95, 0x7b, 0x24, 0x32, 0xda, 0x3b, 0xe2 }
-};
-
-static EFI_GUID my_gAdvancedFormSetGuid = {
-  0xe14f04fa, 0x8706, 0x4353, { 0x92, 0xf2, 0x9c, 0x24, 0x24, 0x74, 0x6f, 0x9f }
-};
-
-static EFI_GUID my_gAhciBusInitProtocolGuid = {
-  0xb2fa4764, 0x3b6e, 0x43d3, { 0x91, 0xdf, 0x87, 0xd1, 0x5a, 0x3e, 0x56, 0x68 }
-};
-
-static EFI_GUID my_gAhciSmmProtocolGuid = {
-  0xb2fa5764, 0x3b6e, 0x43d3, { 0x91, 0xdf, 0x87, 0xd1, 0x5a, 0x3e, 0x56, 0x68 }
-};
-
-static EFI_GUID my_gAmicsmPcibusnumXlatProtocolGuid = {
-  0xcb5c54c0, 0x230d, 0x43db, { 0x92, 0x2c, 0x24, 0xd3, 0x4f, 0x8c, 0x91, 0x5c }
-};
-
-static EFI_GUID my_gAmitsesetupGuid = {
-  0xc811fa38, 0x42c8, 0x4579, { 0xa9, 0xbb, 0x60, 0xe9, 0x4e, 0xdd, 0xfb, 0x34 }
-};
-
-static EFI_GUID my_gAmitseAdminPasswordValidGuid = {
-  0x541d5a75, 0x95ee, 0x43c7, { 0x9e, 0x5d, 0x23, 0x94, 0xdc, 0x48, 0x62, 0x49 }
-};
-
-static EFI_GUID my_gAmitseAfterFirstBootOptionGuid = {
-  0xc48d651c, 0x9d0e, 0x4ce7, { 0xad, 0x39, 0xed, 0xd1, 0xab, 0x83, 0x6b, 0x30 }
-};
-
-static EFI_GUID my_gAmitseBootOrderChangeGuid = {
-  0x1b6bc809, 0xc986, 0x4937, { 0x93, 0x4f, 0x1e, 0xa5, 0x86, 0x22, 0xfe, 0x50 }
-};
-
-static EFI_GUID my_gAmitseDriverHealthCtrlGuid = {
-  0x58279c2d, 0xfb19, 0x466e, { 0xb4, 0x2e, 0xcd, 0x43, 0x70, 0x16, 0xdc, 0x25 }
-};
-
-static EFI_GUID my_gAmitseDriverHealthEnbGuid = {
-  0x885f288, 0x418c, 0x4be1, { 0xa6, 0xaf, 0x8b, 0xad, 0x61, 0xda, 0x8, 0xfe }
-};
-
-static EFI_GUID my_gAmitseDriverHealthGuid = {
-  0x7459a7d4, 0x6533, 0x4480, { 0xbb, 0xa7, 0x79, 0xe2, 0x5a, 0x44, 0x43, 0xc9 }
-};
-
-static EFI_GUID my_gAmitseEventBeforeBootGuid = {
-  0x3677770f, 0xefb2, 0x43b2, { 0xb8, 0xae, 0xb3, 0x2, 0xe9, 0x60, 0x48, 0x82 }
-};
-
-static EFI_GUID my_gAmitseInvalidPasswordGuid = {
-  0xd69240c0, 0xdd40, 0x4f2d, { 0x98, 0x63, 0x48, 0x48, 0xda, 0x6e, 0x61, 0x5f }
-};
-
-static EFI_GUID my_gAmitseNvramUpdateGuid = {
-  0xd84beff0, 0x159a, 0x4b60, { 0x9a, 0xb9, 0xac, 0x5c, 0x47, 0x4b, 0xd3, 0xb1 }
-};
-
-static EFI_GUID my_gAmitsePasswordPromptEnterGuid = {
-  0x73e7e01, 0x2611, 0x4e85, { 0xb8, 0x96, 0xa3, 0xb6, 0x76, 0x7c, 0xba, 0x0 }
-};
-
-static EFI_GUID my_gAmitsePasswordPromptExitGuid = {
-  0xb9b038b0, 0xe2b6, 0x4aab, { 0x94, 0x35, 0x41, 0x65, 0xec, 0xfe, 0xd0, 0x32 }
-};
-
-static EFI_GUID my_gAmitseSetupEnterGuid = {
-  0x71202eee, 0x5f53, 0x40d9, { 0xab, 0x3d, 0x9e, 0xc, 0x26, 0xd9, 0x66, 0x57 }
-};
-
-static EFI_GUID my_gAmitseUserPasswordValidGuid = {
-  0xab1404ca, 0x4801, 0x4208, { 0x98, 0xbf, 0x30, 0xd5, 0x21, 0xda, 0xd4, 0xd3 }
-};
-
-static EFI_GUID my_gAmiAptioSigOwnerGuid = {
-  0x26dc4851, 0x195f, 0x4ae1, { 0x9a, 0x19, 0xfb, 0xf8, 0x83, 0xbb, 0xb3, 0x5e }
-};
-
-static EFI_GUID my_gAmiBbsDevicePathGuid = {
-  0x1db184ae, 0x81f5, 0x4e72, { 0x85, 0x44, 0x2b, 0xab, 0xc, 0x2c, 0xac, 0x5c }
-};
-
-static EFI_GUID my_gAmiBeforeCpuRcProtocolGuid = {
-  0x1d26adc3, 0xb011, 0xee2c, { 0x21, 0x77, 0x89, 0xbb, 0xaa, 0xcc, 0x33, 0x92 }
-};
-
-static EFI_GUID my_gAmiBiosppiFlagsManagementGuid = {
-  0xe9008d70, 0x2a4e, 0x47ea, { 0x8e, 0xc4, 0x72, 0xe2, 0x57, 0x67, 0xe5, 0xef }
-};
-
-static EFI_GUID my_gAmiBoardInfoProtocolGuid = {
-  0x273146c, 0x96c4, 0x45a1, { 0xa7, 0xaf, 0x78, 0xe0, 0x52, 0x4a, 0xa, 0xe2 }
-};
-
-static EFI_GUID my_gAmiBoardInfoSectionGuid = {
-  0xe6f4f8f7, 0x4992, 0x47b2, { 0x83, 0x2, 0x85, 0x8, 0x74, 0x5e, 0x4a, 0x23 }
-};
-
-static EFI_GUID my_gAmiCallbackGuid = {
-  0x9cf0f18e, 0x7c7d, 0x49de, { 0xb5, 0xaa, 0xbb, 0xba, 0xd6, 0xb2, 0x10, 0x7 }
-};
-
-static EFI_GUID my_gAmiCapsuleHobGuid = {
-  0xbf66fdf7, 0xf64c, 0x4b11, { 0x8a, 0xb7, 0xf8, 0x43, 0xaa, 0x2a, 0x8b, 0xea }
-};
-
-static EFI_GUID my_gAmiCcidIoProtocolGuid = {
-  0xb167c2f5, 0xe26a, 0x4dff, { 0x8e, 0x1c, 0x8, 0x7, 0xc7, 0xf0, 0x2a, 0x88 }
-};
-
-static EFI_GUID my_gAmiCcidPresenceGuid = {
-  0x5fdee00d, 0xda40, 0x405a, { 0xb9, 0x2e, 0xcf, 0x4a, 0x80, 0xea, 0x8f, 0x76 }
-};
-
-static EFI_GUID my_gAmiCmosBadFlagHobGuid = {
-  0xb098f766, 0xb17a, 0x4005, { 0x83, 0x9, 0xeb, 0x23, 0xf1, 0x44, 0x8c, 0x15 }
-};
-
-static EFI_GUID my_gAmiCpuidCksumHobGuid = {
-  0xd4ca32b1, 0xb1f2, 0x4ff3, { 0xb4, 0x75, 0x66, 0xe7, 0xb8, 0x19, 0x2a, 0x3b }
-};
-
-static EFI_GUID my_gAmiCpuInfo2ProtocolGuid = {
-  0xac9cf0a8, 0xe551, 0x4be2, { 0xad, 0xa, 0xe1, 0xb5, 0x64, 0xee, 0xa2, 0x73 }
-};
-
-static EFI_GUID my_gAmiCsmDriverStartedGuid = {
-  0x3ea824d1, 0x81e3, 0x4ff5, { 0xbd, 0x43, 0xbb, 0x9c, 0x65, 0xdf, 0x7c, 0x46 }
-};
-
-static EFI_GUID my_gAmiCsmThunkProtocolGuid = {
-  0x2362ea9c, 0x84e5, 0x4dff, { 0x83, 0xbc, 0xb5, 0xac, 0xec, 0xb5, 0x7c, 0xbb }
-};
-
-static EFI_GUID my_gAmiDddtPresentFlagHobGuid = {
-  0x4e7af417, 0xc200, 0x400a, { 0x9d, 0x18, 0x86, 0x5a, 0xda, 0xd3, 0x8, 0x96 }
-};
-
-static EFI_GUID my_gAmiDebuggerCpuProtocolGuid = {
-  0xab21acc3, 0xba33, 0xee2c, { 0x66, 0xbc, 0x12, 0x56, 0x77, 0x11, 0x1a, 0xb2 }
-};
-
-static EFI_GUID my_gAmiDebugportHobGuid = {
-  0xe894b313, 0x54ca, 0x4bb2, { 0x8c, 0xdd, 0x85, 0x1e, 0x8a, 0xc9, 0x2, 0x7c }
-};
-
-static EFI_GUID my_gAmiDeviceNameDevicePathGuid = {
-  0x2d6447ef, 0x3bc9, 0x41a0, { 0xac, 0x19, 0x4d, 0x51, 0xd0, 0x1b, 0x4c, 0xe6 }
-};
-
-static EFI_GUID my_gAmiDigitalSignatureProtocolGuid = {
-  0x5f87ba17, 0x957d, 0x433d, { 0x9e, 0x15, 0xc0, 0xe7, 0xc8, 0x79, 0x88, 0x99 }
-};
-
-static EFI_GUID my_gAmiDimmSpdDataHobGuid = {
-  0xd4ca32b3, 0xb1fe, 0x4ff7, { 0xb0, 0x73, 0x60, 0xed, 0xbb, 0x16, 0x22, 0x33 }
-};
-
-static EFI_GUID my_gAmiEarlyBistPpiGuid = {
-  0xa7e2ce72, 0xdc32, 0x4bc0, { 0x9e, 0x35, 0xfe, 0xb3, 0xa, 0xe5, 0xcc, 0x47 }
-};
-
-static EFI_GUID my_gAmiEfikeycodeProtocolGuid = {
-  0xadfb62d, 0xff74, 0x484c, { 0x89, 0x44, 0xf8, 0x5c, 0x4b, 0xea, 0x87, 0xa8 }
-};
-
-static EFI_GUID my_gAmiFastBootProtocolGuid = {
-  0x3496a19a, 0x2e99, 0x41ba, { 0x83, 0x3e, 0xf, 0xde, 0x2e, 0xbf, 0x2a, 0x55 }
-};
-
-static EFI_GUID my_gAmiFwRecoveryCapsuleGuid = {
-  0x5e794317, 0xa07e, 0x45df, { 0x94, 0xbb, 0x1c, 0x99, 0x7d, 0x62, 0x32, 0xca }
-};
-
-static EFI_GUID my_gAmiHeciSmmGuid = {
-  0xfc9a50c1, 0x8b3d, 0x40d0, { 0x99, 0x12, 0x6e, 0x26, 0xd7, 0x89, 0x6c, 0xba }
-};
-
-static EFI_GUID my_gAmiInternalFactoryTdcTdpHobGuid = {
-  0x982d8c6f, 0xf6f6, 0x4135, { 0xa3, 0x9, 0xa4, 0x59, 0x3e, 0xa5, 0x64, 0x17 }
-};
-
-static EFI_GUID my_gAmiInternalUcodeHobGuid = {
-  0x94567c6f, 0xf7a9, 0x4229, { 0x13, 0x30, 0xfe, 0x11, 0xcc, 0xab, 0x3a, 0x11 }
-};
-
-static EFI_GUID my_gAmiIntSmmCommProtocolGuid = {
-  0xb27dab38, 0x9814, 0x4e06, { 0xa5, 0xa2, 0x65, 0xae, 0x9a, 0x14, 0x25, 0x8f }
-};
-
-static EFI_GUID my_gAmiIrqDmaMaskVariableGuid = {
-  0xfc8be767, 0x89f1, 0x4d6e, { 0x80, 0x99, 0x6f, 0x2, 0x1e, 0xbc, 0x87, 0xcc }
-};
-
-static EFI_GUID my_gAmiIso9660MediaGuid = {
-  0xba7c46d1, 0x9c5e, 0x4fc8, { 0x94, 0x3d, 0x1a, 0x49, 0x1f, 0x23, 0xfe, 0x1 }
-};
-
-static EFI_GUID my_gAmiLoadCsmGuid = {
-  0x16287ba4, 0x5b9d, 0x4d98, { 0x91, 0x9f, 0x7b, 0x7b, 0x78, 0xcb, 0x2b, 0xe0 }
-};
-
-static EFI_GUID my_gAmiMaskedDevicePathGuid = {
-  0x99e275e7, 0x75a0, 0x4b37, { 0xa2, 0xe6, 0xc5, 0x38, 0x5e, 0x6c, 0x0, 0xcb }
-};
-
-static EFI_GUID my_gAmiMeasurePciopromGuid = {
-  0xb3dae700, 0x2a77, 0x4ea4, { 0xaf, 0x79, 0x32, 0x97, 0xb4, 0x84, 0xbe, 0x61 }
-};
-
-static EFI_GUID my_gAmiMediaDevicePathGuid = {
-  0x5023b95c, 0xdb26, 0x429b, { 0xa6, 0x48, 0xbd, 0x47, 0x66, 0x4c, 0x80, 0x12 }
-};
-
-static EFI_GUID my_gAmiMemoryErrorReportPpiGuid = {
-  0x85226559, 0xdef, 0x48d8, { 0xa8, 0xc9, 0xb7, 0x46, 0xd6, 0xa4, 0xdf, 0x1 }
-};
-
-static EFI_GUID my_gAmiMrcInfoHobGuid = {
-  0xa6351a87, 0x2965, 0x4718, { 0x88, 0xc7, 0xb, 0x5b, 0x5a, 0xc0, 0xb5, 0xe4 }
-};
-
-static EFI_GUID my_gAmiNbMrcInfoGuid = {
-  0x6737934b, 0xa27e, 0x4c05, { 0xad, 0x5b, 0x6a, 0xb8, 0x62, 0x73, 0x68, 0xb }
-};
-
-static EFI_GUID my_gAmiNvramSpdMapGuid = {
-  0x717fc150, 0xabd9, 0x4614, { 0x80, 0x15, 0xb, 0x33, 0x23, 0xea, 0xb9, 0x5c }
-};
-
-static EFI_GUID my_gAmiOpromPolicyProtocolGuid = {
-  0x542d6248, 0x4198, 0x4960, { 0x9f, 0x59, 0x23, 0x84, 0x64, 0x6d, 0x63, 0xb4 }
-};
-
-static EFI_GUID my_gAmiOsPpiConfirmationOverrideGuid = {
-  0x5f171f5f, 0x8385, 0x4086, { 0xa6, 0x9b, 0x1f, 0xcf, 0x6, 0xae, 0x4a, 0x3d }
-};
-
-static EFI_GUID my_gAmiPbKeyRsa2048Guid = {
-  0x4627b9b, 0x385e, 0x4744, { 0x90, 0x21, 0xe6, 0x63, 0x19, 0xf2, 0x3, 0x94 }
-};
-
-static EFI_GUID my_gAmiPciBusExtProtocolGuid = {
-  0xf42a009d, 0x977f, 0x4f08, { 0x94, 0x40, 0xbc, 0xa5, 0xa3, 0xbe, 0xd9, 0xaf }
-};
-
-static EFI_GUID my_gAmiPeimHobGuid = {
-  0xf4491ba4, 0x7672, 0x486f, { 0xb4, 0xd7, 0x99, 0x89, 0x9d, 0x22, 0xda, 0x57 }
-};
-
-static EFI_GUID my_gAmiPeimLoadHobGuid = {
-  0xec9c36fd, 0x1642, 0x4b84, { 0x91, 0xfa, 0x91, 0x9c, 0x2d, 0x6, 0x6f, 0xb4 }
-};
-
-static EFI_GUID my_gAmiPeiAfterMrcGuid = {
-  0x64c96700, 0x6b4c, 0x480c, { 0xa3, 0xe1, 0xb8, 0xbd, 0xe8, 0xf6, 0x2, 0xb2 }
-};
-
-static EFI_GUID my_gAmiPeiCpuinitPolicyPpiGuid = {
-  0xf824ccbb, 0xd8e0, 0x4522, { 0x8a, 0xa8, 0x65, 0xf0, 0x4b, 0x46, 0x3d, 0xb5 }
-};
-
-static EFI_GUID my_gAmiPeiEndMemoryDetectGuid = {
-  0x9f58e424, 0xb96b, 0x45a5, { 0xad, 0xdc, 0xd2, 0xfe, 0x39, 0x4a, 0x99, 0xd9 }
-};
-
-static EFI_GUID my_gAmiPeiEndOfMrcGuid = {
-  0x633194be, 0x1697, 0x11e1, { 0xb5, 0xf0, 0x2c, 0xb2, 0x48, 0x24, 0x1, 0x9b }
-};
-
-static EFI_GUID my_gAmiPeiMrcDefaultGuid = {
-  0xe813e116, 0xc099, 0x4d21, { 0x9c, 0x34, 0xa5, 0x52, 0xd5, 0xe9, 0xa5, 0xd0 }
-};
-
-static EFI_GUID my_gAmiPeiNbinitPolicyPpiGuid = {
-  0x9ce4d938, 0x9c87, 0x41d0, { 0x9e, 0x55, 0x34, 0x92, 0x3f, 0xaf, 0x8b, 0x4f }
-};
-
-static EFI_GUID my_gAmiPeiNbCpuOnlyResetPpiGuid = {
-  0x1f0f049e, 0x3a68, 0x4c97, { 0x86, 0x5a, 0xbc, 0x5e, 0xed, 0x79, 0x20, 0xe7 }
-};
-
-static EFI_GUID my_gAmiPeiNbCustomPpiGuid = {
-  0x584cc99f, 0x4be8, 0x43d1, { 0xa4, 0x5a, 0x93, 0x3d, 0xc3, 0x94, 0x79, 0xfc }
-};
-
-static EFI_GUID my_gAmiPeiPciTableInitPpiGuid = {
-  0x97f91e78, 0xea12, 0x4ea6, { 0xb7, 0xb3, 0x7b, 0x6, 0x78, 0xc2, 0x86, 0x73 }
-};
-
-static EFI_GUID my_gAmiPeiSbinitPolicyPpiGuid = {
-  0x95e8152b, 0x1b98, 0x4f11, { 0x8a, 0x77, 0xdb, 0x26, 0x58, 0x3e, 0xbc, 0x42 }
-};
-
-static EFI_GUID my_gAmiPeiSbCustomPpiGuid = {
-  0x38965bb5, 0x8097, 0x40f5, { 0xb7, 0x42, 0x8c, 0xc1, 0x4a, 0x64, 0x9b, 0x64 }
-};
-
-static EFI_GUID my_gAmiPeiSbOemPlatformPolicyOverridePpiGuid = {
-  0x61187967, 0x9a77, 0x419d, { 0xaa, 0xea, 0x64, 0xdd, 0x56, 0x19, 0x8, 0x15 }
-};
-
-static EFI_GUID my_gAmiPerfTuneDataHobGuid = {
-  0x4d6c0496, 0x8de4, 0x4af2, { 0x9a, 0x2e, 0x9b, 0xe5, 0xb9, 0x15, 0x6a, 0xc5 }
-};
-
-static EFI_GUID my_gAmiPllOverVotageFlagHobGuid = {
-  0x181e874d, 0xc089, 0x4c99, { 0x8e, 0xc2, 0x6d, 0x67, 0x61, 0x34, 0x82, 0x20 }
-};
-
-static EFI_GUID my_gAmiPostManagerProtocolGuid = {
-  0x8a91b1e1, 0x56c7, 0x4adc, { 0xab, 0xeb, 0x1c, 0x2c, 0xa1, 0x72, 0x9e, 0xff }
-};
-
-static EFI_GUID my_gAmiRecoveryImageHobGuid = {
-  0xdac3cb98, 0x2295, 0x412e, { 0x82, 0x6d, 0xfd, 0xee, 0xa3, 0x20, 0xcf, 0x31 }
-};
-
-static EFI_GUID my_gAmiResetTypeHobGuid = {
-  0x39e8cda1, 0x6a35, 0x4cdd, { 0xa9, 0x2, 0xd1, 0xa7, 0x95, 0xf7, 0x3, 0x80 }
-};
-
-static EFI_GUID my_gAmiResetTypeVariableGuid = {
-  0x308dd02c, 0x92b, 0x4123, { 0xa2, 0xaf, 0x3e, 0xf4, 0x44, 0xa, 0x6b, 0x4a }
-};
-
-static EFI_GUID my_gAmiRomLayoutHobGuid = {
-  0xd7642443, 0x87b7, 0x4832, { 0x96, 0x7, 0xe, 0x1e, 0xa8, 0x1c, 0x1d, 0x86 }
-};
-
-static EFI_GUID my_gAmiSbSmiProtocolGuid = {
-  0x589bc616, 0xbb4f, 0x47ed, { 0x92, 0xf7, 0x93, 0x39, 0x3c, 0x69, 0x7e, 0x25 }
-};
-
-static EFI_GUID my_gAmiSmbiosCpuInfoProtocolGuid = {
-  0x3d6cdb0a, 0x5b1f, 0x43a3, { 0xa4, 0x3b, 0x44, 0x12, 0x67, 0xf9, 0xda, 0xb5 }
-};
-
-static EFI_GUID my_gAmiSmbiosMemoryInfoHobGuid = {
-  0x7d6b8734, 0xb754, 0x443f, { 0xb5, 0x88, 0x77, 0x43, 0x84, 0x3a, 0xd3, 0xf1 }
-};
-
-static EFI_GUID my_gAmiSmbusHobGuid = {
-  0x17cb4b7, 0xb80c, 0x4040, { 0xb6, 0xc8, 0xea, 0x98, 0x2b, 0xbb, 0x25, 0xb7 }
-};
-
-static EFI_GUID my_gAmiSmmDigitalSignatureProtocolGuid = {
-  0x91abc830, 0x16fc, 0x4d9e, { 0xa1, 0x89, 0x5f, 0xc8, 0xbb, 0x41, 0x14, 0x2 }
-};
-
-static EFI_GUID my_gAmiSmmInfoProtocolGuid = {
-  0xeb5198eb, 0xe7f5, 0x45a1, { 0x9c, 0xcb, 0xe5, 0x33, 0x64, 0xbb, 0x49, 0x92 }
-};
-
-static EFI_GUID my_gAmiStandardDefaultsVariableGuid = {
-  0x4599d26f, 0x1a11, 0x49b8, { 0xb9, 0x1f, 0x85, 0x87, 0x45, 0xcf, 0xf8, 0x24 }
-};
-
-static EFI_GUID my_gAmiStatusCodeCpuBistDataGuid = {
-  0xcd541d77, 0x6699, 0x4b36, { 0xa3, 0x1e, 0x1a, 0xa4, 0xc5, 0xd5, 0xb9, 0x46 }
-};
-
-static EFI_GUID my_gAmiTcgConfirmationFlagsGuid = {
-  0x7d3dceee, 0xcbce, 0x4ea7, { 0x87, 0x9, 0x6e, 0x55, 0x2f, 0x1e, 0xdb, 0xde }
-};
-
-static EFI_GUID my_gAmiTcgEfiOsVariableGuid = {
-  0xa8a2093b, 0xfefa, 0x43c1, { 0x8e, 0x62, 0xce, 0x52, 0x68, 0x47, 0x26, 0x5e }
-};
-
-static EFI_GUID my_gAmiTcgPermFlagsGuid = {
-  0x2325f2fc, 0x5683, 0x4648, { 0x97, 0xc4, 0x9a, 0x52, 0xd, 0xfb, 0xe3, 0x25 }
-};
-
-static EFI_GUID my_gAmiTcgPlatformPpiAfterMemGuid = {
-  0x890c2cef, 0x43c8, 0x4209, { 0xa7, 0x8d, 0xae, 0x14, 0xaa, 0x17, 0x98, 0xb4 }
-};
-
-static EFI_GUID my_gAmiTcgPlatformPpiBeforeMemGuid = {
-  0xc1e6791d, 0xf35b, 0x43ef, { 0x92, 0xa, 0xbe, 0x6, 0xba, 0x7f, 0x86, 0xa1 }
-};
-
-static EFI_GUID my_gAmiTcgPlatformPpiGuid = {
-  0x5687f4a, 0x3ca7, 0x4d19, { 0x9b, 0xc5, 0xe1, 0x80, 0xce, 0xa3, 0x56, 0x9f }
-};
-
-static EFI_GUID my_gAmiTcgPlatformProtocolGuid = {
-  0x320bdc39, 0x3fa0, 0x4ba9, { 0xbf, 0x2d, 0xb3, 0x3f, 0x72, 0xba, 0x9c, 0xa1 }
-};
-
-static EFI_GUID my_gAmiUsbSmmProtocolGuid = {
-  0x3ef7500e, 0xcf55, 0x474f, { 0x8e, 0x7e, 0x0, 0x9e, 0xe, 0xac, 0xec, 0xd2 }
-};
-
-static EFI_GUID my_gAmtForcePushPetHobGuid = {
-  0x4efa0db6, 0x26dc, 0x4bb1, { 0xa7, 0x6f, 0x14, 0xbc, 0x63, 0xc, 0x7b, 0x3c }
-};
-
-static EFI_GUID my_gAmtForcePushPetPolicyGuid = {
-  0xacc8e1e4, 0x9f9f, 0x4e40, { 0xa5, 0x7e, 0xf9, 0x9e, 0x52, 0xf3, 0x4c, 0xa5 }
-};
-
-static EFI_GUID my_gAmtForcePushPetVariableGuid = {
-  0xd7ac94af, 0xa498, 0x45ec, { 0xbf, 0xa2, 0xa5, 0x6e, 0x95, 0x34, 0x61, 0x8b }
-};
-
-static EFI_GUID my_gAmtInt16CsmGuid = {
-  0x6046e678, 0x24ef, 0x4005, { 0xba, 0x39, 0xbd, 0xa1, 0x1f, 0x6d, 0x55, 0x5d }
-};
-
-static EFI_GUID my_gAoacEcWakeupCustomPpiGuid = {
-  0x82627acf, 0xd92d, 0x416d, { 0x8a, 0x6f, 0x78, 0x3c, 0xac, 0xd9, 0x12, 0x23 }
-};
-
-static EFI_GUID my_gAoacFfsTableStorageGuid = {
-  0xfb045db2, 0x598e, 0x485a, { 0xba, 0x30, 0x5d, 0x7b, 0x1b, 0x1b, 0xd5, 0x4d }
-};
-
-static EFI_GUID my_gAptioFwCapsuleGuid = {
-  0x4a3ca68b, 0x7723, 0x48fb, { 0x80, 0x3d, 0x57, 0x8c, 0xc1, 0xfe, 0xc4, 0x4d }
-};
-
-static EFI_GUID my_gAptioHiiProtocolGuid = {
-  0xea816d2c, 0xcee5, 0x4f02, { 0x99, 0xb5, 0xd3, 0x90, 0x5c, 0xbb, 0xd0, 0x77 }
-};
-
-static EFI_GUID my_gAuthvarMailboxVariableGuid = {
-  0x532b6532, 0x6499, 0x428d, { 0xac, 0xb1, 0xf6, 0xf7, 0x79, 0xc9, 0x4d, 0xf9 }
-};
-
-static EFI_GUID my_gBdsAllDriversConnectedProtocolGuid = {
-  0xdbc9fd21, 0xfad8, 0x45b0, { 0x9e, 0x78, 0x27, 0x15, 0x88, 0x67, 0xcc, 0x93 }
-};
-
-static EFI_GUID my_gBdsConnectDriversProtocolGuid = {
-  0x3aa83745, 0x9454, 0x4f7a, { 0xa7, 0xc0, 0x90, 0xdb, 0xd0, 0x2f, 0xab, 0x8e }
-};
-
-static EFI_GUID my_gBlockDeviceRecoveryCapsuleGuid = {
-  0xba8263c, 0xa8bd, 0x4aad, { 0xb4, 0x2, 0x6a, 0x6a, 0xf2, 0xf7, 0xe7, 0x7d }
-};
-
-static EFI_GUID my_gBootFlowVariableGuid = {
-  0xef152fb4, 0x7b2f, 0x427d, { 0xbd, 0xb4, 0x7e, 0xa, 0x5, 0x82, 0x6e, 0x64 }
-};
-
-static EFI_GUID my_gBootFormSetGuid = {
-  0x8b33ffe0, 0xd71c, 0x4f82, { 0x9c, 0xeb, 0xc9, 0x70, 0x58, 0xc1, 0x3f, 0x8e }
-};
-
-static EFI_GUID my_gBootManagerGuid = {
-  0xb4909cf3, 0x7b93, 0x4751, { 0x9b, 0xd8, 0x5b, 0xa8, 0x22, 0xb, 0x9b, 0xb2 }
-};
-
-static EFI_GUID my_gBootNowCountGuid = {
-  0x52e6eb0, 0xf240, 0x42c5, { 0x83, 0x9, 0x45, 0x87, 0x45, 0x45, 0xc6, 0xb4 }
-};
-
-static EFI_GUID my_gChipsetFormSetGuid = {
-  0xadfe34c8, 0x9ae1, 0x4f8f, { 0xbe, 0x13, 0xcf, 0x96, 0xa2, 0xcb, 0x2c, 0x5b }
-};
-
-static EFI_GUID my_gCmosManagerHobGuid = {
-  0xd5367802, 0xb873, 0x4c0f, { 0xb5, 0x44, 0x31, 0xb7, 0xcc, 0xf5, 0xc5, 0x55 }
-};
-
-static EFI_GUID my_gConsoleInDevicesStartedProtocolGuid = {
-  0x2df1e051, 0x906d, 0x4eff, { 0x86, 0x9d, 0x24, 0xe6, 0x53, 0x78, 0xfb, 0x9e }
-};
-
-static EFI_GUID my_gConsoleOutDevicesStartedProtocolGuid = {
-  0xef9a3971, 0xc1a0, 0x4a93, { 0xbd, 0x40, 0x5a, 0xa1, 0x65, 0xf2, 0xdc, 0x3a }
-};
-
-static EFI_GUID my_gCpuMicrocodeFileGuid = {
-  0x17088572, 0x377f, 0x44ef, { 0x8f, 0x4e, 0xb0, 0x9f, 0xff, 0x46, 0xa0, 0x70 }
-};
-
-static EFI_GUID my_gCpuWakeUpBufferVariableGuid = {
-  0xdf665292, 0x79d7, 0x40e2, { 0xba, 0x51, 0xf7, 0xd4, 0x94, 0x62, 0x81, 0x85 }
-};
-
-static EFI_GUID my_gCsmVideoPolicyProtocolGuid = {
-  0x3a4e4376, 0x4871, 0x4b0e, { 0xa0, 0x2f, 0xed, 0x36, 0xf2, 0xae, 0xcd, 0x0 }
-};
-
-static EFI_GUID my_gDcaHobGuid = {
-  0x6865c455, 0x8626, 0x40d8, { 0x90, 0xf4, 0xa6, 0x94, 0x60, 0xa4, 0xab, 0x5a }
-};
-
-static EFI_GUID my_gDebuggerTerminalVarGuid = {
-  0x97ca1a5b, 0xb760, 0x4d1f, { 0xa5, 0x4b, 0xd1, 0x90, 0x92, 0x3, 0x2c, 0x90 }
-};
-
-static EFI_GUID my_gDefineGuidCrbdxebinGuid = {
-  0x16271fca, 0x55d9, 0x4a33, { 0x93, 0xfc, 0x5a, 0x3e, 0xb1, 0x28, 0xde, 0xb6 }
-};
-
-static EFI_GUID my_gDefineGuidCrbsmibinGuid = {
-  0x221f1d4f, 0x34c, 0x4bea, { 0xb2, 0xbb, 0xb7, 0xa9, 0x67, 0x2b, 0x6, 0xd7 }
-};
-
-static EFI_GUID my_gDefineGuidAcpiplatformpeibinGuid = {
-  0x333bb2a3, 0x4f20, 0x4c8b, { 0xac, 0x38, 0x6, 0x72, 0xd7, 0x43, 0x15, 0xf8 }
-};
-
-static EFI_GUID my_gDefineGuidOempeibinGuid = {
-  0x6e59df06, 0x62d3, 0x40b0, { 0x82, 0xb5, 0x17, 0x5c, 0xf8, 0x4a, 0x94, 0xe4 }
-};
-
-static EFI_GUID my_gDefineGuidSbdxebinGuid = {
-  0xb7d19491, 0xe55a, 0x470d, { 0x85, 0x8, 0x85, 0xa5, 0xdf, 0xa4, 0x19, 0x74 }
-};
-
-static EFI_GUID my_gDefineGuidOemdxebinGuid = {
-  0xbfe205c9, 0x5b17, 0x4f8f, { 0x93, 0x75, 0x89, 0x61, 0x4a, 0xf8, 0xe1, 0x99 }
-};
-
-static EFI_GUID my_gDefineGuidSbpeibinGuid = {
-  0xc1fbd624, 0x27ea, 0x40d1, { 0xaa, 0x48, 0x94, 0xc3, 0xdc, 0x5c, 0x7e, 0xd }
-};
-
-static EFI_GUID my_gDefineGuidCrbpeibinGuid = {
-  0xd1ed2f7, 0xe92b, 0x4562, { 0x92, 0xdd, 0x5c, 0x82, 0xec, 0x91, 0x7e, 0xae }
-};
-
-static EFI_GUID my_gDefineGuidAcpiplatformsmibinGuid = {
-  0xdfd8d5cc, 0x5aed, 0x4820, { 0xa2, 0xb6, 0x5c, 0x55, 0xe4, 0xe6, 0x40, 0xef }
-};
-
-static EFI_GUID my_gDefineGuidNbpeibinGuid = {
-  0x79aa6086, 0x35a, 0x4ad9, { 0xa8, 0x9a, 0xa6, 0xd5, 0xaa, 0x27, 0xf0, 0xe2 }
-};
-
-static EFI_GUID my_gDefineGuidNbdxebinGuid = {
-  0xe4ecd0b2, 0xe277, 0x4f2b, { 0xbe, 0xcb, 0xe4, 0xd7, 0x5c, 0x9a, 0x81, 0x2e }
-};
-
-static EFI_GUID my_gDefineGuidSbrunbinGuid = {
-  0xe23f86e1, 0x56e, 0x4888, { 0xb6, 0x85, 0xcf, 0xcd, 0x67, 0xc1, 0x79, 0xd4 }
-};
-
-static EFI_GUID my_gDelBootOptionGuid = {
-  0xf6c73719, 0xf34c, 0x479c, { 0xb3, 0x2f, 0x27, 0x7f, 0xcb, 0xbc, 0xfe, 0x4f }
-};
-
-static EFI_GUID my_gDimmTsInfoGuid = {
-  0xce673a28, 0x800d, 0x4b4a, { 0x83, 0x16, 0x26, 0x61, 0xf9, 0xb3, 0xd9, 0xc6 }
-};
-
-static EFI_GUID my_gDxeCpuCacheProtocolGuid = {
-  0x5c6fa2c9, 0x9768, 0x45f6, { 0x8e, 0x64, 0x5a, 0xec, 0xca, 0xda, 0xb4, 0x81 }
-};
-
-static EFI_GUID my_gDxeCpuInfoProtocolGuid = {
-  0xe223cf65, 0xf6ce, 0x4122, { 0xb3, 0xaf, 0x4b, 0xd1, 0x8a, 0xff, 0x40, 0xa1 }
-};
-
-static EFI_GUID my_gDxeEnhancedSpeedstepProtocolGuid = {
-  0xe98021, 0xf4fe, 0x46cc, { 0xab, 0x2d, 0x89, 0x4c, 0x37, 0x3a, 0xfa, 0x1 }
-};
-
-static EFI_GUID my_gDxePlatformAmtPolicyGuid = {
-  0xb2ab115e, 0xc8b6, 0x4036, { 0xbf, 0x31, 0xe7, 0x4b, 0xd8, 0x92, 0x6c, 0xce }
-};
-
-static EFI_GUID my_gDxePlatformSaPolicyGuid = {
-  0xcd2333d7, 0x6a0a, 0x4c76, { 0x83, 0x50, 0x24, 0xa, 0xda, 0x36, 0xa2, 0xc7 }
-};
-
-static EFI_GUID my_gDxePlatformSgPolicyGuid = {
-  0x6199dc36, 0xe114, 0x4e0d, { 0x80, 0x99, 0x99, 0xa0, 0xbd, 0x80, 0xa9, 0x71 }
-};
-
-static EFI_GUID my_gDxePlatformTdtPolicyGuid = {
-  0x20daf0fc, 0x5548, 0x44dc, { 0xa4, 0x2a, 0x60, 0xea, 0xf0, 0xa2, 0x2e, 0x47 }
-};
-
-static EFI_GUID my_gDxeTxtPolicyProtocolGuid = {
-  0x43f66ffd, 0xb288, 0x4139, { 0xba, 0xd5, 0xb8, 0x98, 0x3, 0xe7, 0x30, 0xa2 }
-};
-
-static EFI_GUID my_gDynamicPageCountGuid = {
-  0xb63bf800, 0xf267, 0x4f55, { 0x92, 0x17, 0xe9, 0x7f, 0xb3, 0xb6, 0x98, 0x46 }
-};
-
-static EFI_GUID my_gEfiActiveManagementProtocolGuid = {
-  0x8555fd40, 0x140b, 0x4f3c, { 0x90, 0x5e, 0x3b, 0xf3, 0x78, 0xa0, 0x99, 0xfa }
-};
-
-static EFI_GUID my_gEfiAhciInt13InitProtocolGuid = {
-  0x67820532, 0x7613, 0x4dd3, { 0x9e, 0xd7, 0x3d, 0x9b, 0xe3, 0xa7, 0xda, 0x63 }
-};
-
-static EFI_GUID my_gEfiAlertStandardFormatProtocolGuid = {
-  0xcc93a70b, 0xec27, 0x49c5, { 0x8b, 0x34, 0x13, 0x93, 0x1e, 0xfe, 0xd6, 0xe2 }
-};
-
-static EFI_GUID my_gEfiAlternateFvBlockGuid = {
-  0xf496922d, 0x172f, 0x4bbc, { 0xa1, 0xeb, 0xe, 0xeb, 0x94, 0x9c, 0x34, 0x86 }
-};
-
-static EFI_GUID my_gEfiAmiLegacybootProtocolGuid = {
-  0x120d28aa, 0x6630, 0x46f0, { 0x81, 0x57, 0xc0, 0xad, 0xc2, 0x38, 0x3b, 0xf5 }
-};
-
-static EFI_GUID my_gEfiAuthorizationProtocolGuid = {
-  0x995188b1, 0x9f96, 0x11d4, { 0x87, 0xae, 0x0, 0x6, 0x29, 0x2e, 0x8a, 0x3b }
-};
-
-static EFI_GUID my_gEfiBdatAccessGuid = {
-  0xb979746a, 0x8c1f, 0x4a2b, { 0x97, 0xe4, 0x78, 0xe9, 0x3a, 0x71, 0xa7, 0xa }
-};
-
-static EFI_GUID my_gEfiCacheInstallPpiGuid = {
-  0xbb628ae0, 0xcd4f, 0x49fe, { 0x8d, 0x60, 0x63, 0x18, 0x6f, 0xd1, 0xe0, 0x5b }
-};
-
-static EFI_GUID my_gEfiCapsuleAmiGuid = {
-  0xfac2efad, 0x8511, 0x4e34, { 0x9c, 0xae, 0x16, 0xa2, 0x57, 0xba, 0x94, 0x88 }
-};
-
-static EFI_GUID my_gEfiCapsuleInfoGuid = {
-  0x8b34eac7, 0x2690, 0x460b, { 0x8b, 0xa5, 0xd5, 0xcf, 0x32, 0x83, 0x17, 0x35 }
-};
-
-static EFI_GUID my_gEfiClpProtocolGuid = {
-  0xcbbee336, 0x2682, 0x4cd6, { 0x81, 0x8b, 0xa, 0xd, 0x96, 0x7e, 0x5a, 0x67 }
-};
-
-static EFI_GUID my_gEfiCmosDataHobInstalledGuid = {
-  0x5a6a93f4, 0x2907, 0x4a34, { 0xbd, 0x11, 0x6c, 0xa8, 0xa0, 0x95, 0x9e, 0x9 }
-};
-
-static EFI_GUID my_gEfiCompatibleMemoryTestedProtocolGuid = {
-  0x64c475ef, 0x344b, 0x492c, { 0x93, 0xad, 0xab, 0x9e, 0xb4, 0x39, 0x50, 0x4 }
-};
-
-static EFI_GUID my_gEfiConsoleLockGuid = {
-  0x368cda0d, 0xcf31, 0x4b9b, { 0x8c, 0xf6, 0xe7, 0xd1, 0xbf, 0xff, 0x15, 0x7e }
-};
-
-static EFI_GUID my_gEfiCpuTypeFruGuid = {
-  0xf064c91f, 0x188c, 0x4f56, { 0xb7, 0xfd, 0x30, 0xa9, 0xb8, 0x6a, 0x29, 0xf3 }
-};
-
-static EFI_GUID my_gEfiCustomizedDecompressProtocolGuid = {
-  0x9a44198e, 0xa4a2, 0x44e6, { 0x8a, 0x1f, 0x39, 0xbe, 0xfd, 0xac, 0x89, 0x6f }
-};
-
-static EFI_GUID my_gEfiDebugAssertProtocolGuid = {
-  0xbe499c92, 0x7d4b, 0x11d4, { 0xbc, 0xee, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gEfiDebugMaskPpiGuid = {
-  0x3bd930fd, 0xf823, 0x4948, { 0x86, 0x91, 0x98, 0xe6, 0xfe, 0x36, 0xac, 0xe2 }
-};
-
-static EFI_GUID my_gEfiDmiFormatFruGuid = {
-  0x67ef7a73, 0x2594, 0x4a5e, { 0x93, 0xa, 0xe1, 0x66, 0xfa, 0xbc, 0xd2, 0xc8 }
-};
-
-static EFI_GUID my_gEfiDxeCmosAccessGuid = {
-  0x9851740c, 0x22e0, 0x440d, { 0x90, 0x90, 0xef, 0x2d, 0x71, 0xc2, 0x51, 0xc9 }
-};
-
-static EFI_GUID my_gEfiEmul6064kbdinputProtocolGuid = {
-  0x62ceef5a, 0x1d7c, 0x4943, { 0x9b, 0x3a, 0x95, 0xe2, 0x49, 0x4c, 0x89, 0x90 }
-};
-
-static EFI_GUID my_gEfiEmul6064msinputProtocolGuid = {
-  0x7578b307, 0xb25b, 0x44f9, { 0x89, 0x2e, 0x20, 0x9b, 0xe, 0x39, 0x93, 0xc6 }
-};
-
-static EFI_GUID my_gEfiEmul6064trapProtocolGuid = {
-  0x6ea0f71c, 0x614a, 0x437e, { 0x8f, 0x49, 0x24, 0x3a, 0xd4, 0xe8, 0x32, 0x68 }
-};
-
-static EFI_GUID my_gEfiExtendedSalElogServicesProtocolGuid = {
-  0xd5e4ee5f, 0x3e0a, 0x453c, { 0xa7, 0x25, 0xb6, 0x92, 0xbb, 0x6, 0x36, 0x5a }
-};
-
-static EFI_GUID my_gEfiExtendedSalLockServicesProtocolGuid = {
-  0x76b75c23, 0xfe4f, 0x4e17, { 0xa2, 0xad, 0x1a, 0x65, 0x3d, 0xbb, 0x49, 0x4a }
-};
-
-static EFI_GUID my_gEfiExtendedSalSensorServicesProtocolGuid = {
-  0x4a153b6e, 0x85a1, 0x4982, { 0x98, 0xf4, 0x6a, 0x8c, 0xfc, 0xa4, 0xab, 0xa1 }
-};
-
-static EFI_GUID my_gEfiExtendedSalSmComLayerServicesProtocolGuid = {
-  0x4356799, 0x81b7, 0x4e08, { 0xa3, 0x8d, 0xd9, 0x78, 0xfa, 0x47, 0xba, 0x42 }
-};
-
-static EFI_GUID my_gEfiExtendedSalSstGuid = {
-  0x38802700, 0x868a, 0x4b4e, { 0x81, 0xd4, 0x4f, 0x1b, 0xdc, 0xcf, 0xb4, 0x6f }
-};
-
-static EFI_GUID my_gEfiExtendedSalVirtualServicesProtocolGuid = {
-  0xc1a74056, 0x260e, 0x4871, { 0xa0, 0x31, 0xe6, 0x45, 0xa6, 0x5b, 0x6e, 0x11 }
-};
-
-static EFI_GUID my_gEfiFirmwareVolumeDispatchProtocolGuid = {
-  0x7aa35a69, 0x506c, 0x444f, { 0xa7, 0xaf, 0x69, 0x4b, 0xf5, 0x6f, 0x71, 0xc8 }
-};
-
-static EFI_GUID my_gEfiFrameworkDevicePathGuid = {
-  0xb7084e63, 0x46b7, 0x4d1a, { 0x86, 0x77, 0xe3, 0xb, 0x53, 0xdb, 0xf0, 0x50 }
-};
-
-static EFI_GUID my_gEfiFtwLiteProtocolGuid = {
-  0x3f557189, 0x8dae, 0x45ae, { 0xa0, 0xb3, 0x2b, 0x99, 0xca, 0x7a, 0xa7, 0xa0 }
-};
-
-static EFI_GUID my_gEfiFvbExtensionProtocolGuid = {
-  0x53a4c71b, 0xb581, 0x4170, { 0x91, 0xb3, 0x8d, 0xb8, 0x7a, 0x4b, 0x5c, 0x46 }
-};
-
-static EFI_GUID my_gEfiGpioProtocolGuid = {
-  0xb5d09084, 0x80ad, 0x4759, { 0xb5, 0x1c, 0x27, 0x54, 0x8a, 0xfb, 0x8b, 0x8d }
-};
-
-static EFI_GUID my_gEfiGuid = {
-  0xfd44820b, 0xf1ab, 0x41c0, { 0xae, 0x4e, 0xc, 0x55, 0x55, 0x6e, 0xb9, 0xbd }
-};
-
-static EFI_GUID my_gEfiHiiExtProtocolGuid = {
-  0x2a57ae75, 0x8b7a, 0x4c64, { 0x86, 0x56, 0xdb, 0x51, 0xdd, 0xc3, 0x6f, 0x7b }
-};
-
-static EFI_GUID my_gEfiHiiFrontPageClassGuid = {
-  0x94d411b7, 0x7669, 0x45c3, { 0xba, 0x3b, 0xf3, 0xa5, 0x8a, 0x71, 0x56, 0x81 }
-};
-
-static EFI_GUID my_gEfiHiiOldProtocolGuid = {
-  0xcd361957, 0xafbe, 0x425e, { 0xa3, 0x58, 0x5f, 0x58, 0x89, 0xcf, 0xfe, 0x7b }
-};
-
-static EFI_GUID my_gEfiHotKeysProtocolGuid = {
-  0xf1e48287, 0x3fe1, 0x4535, { 0x89, 0xab, 0x48, 0xd6, 0xc3, 0xda, 0x27, 0x59 }
-};
-
-static EFI_GUID my_gEfiHtBistHobGuid = {
-  0xbe644001, 0xe7d4, 0x48b1, { 0xb0, 0x96, 0x8b, 0xa0, 0x47, 0xbc, 0x7a, 0xe7 }
-};
-
-static EFI_GUID my_gEfiIderControllerDriverProtocolGuid = {
-  0x956a2ed0, 0xa6cf, 0x409a, { 0xb8, 0xf5, 0x35, 0xf1, 0x4c, 0x3e, 0x3c, 0x2 }
-};
-
-static EFI_GUID my_gEfiIntelMfgFormatFruGuid = {
-  0x79e8c9c7, 0x1152, 0x4f00, { 0xb8, 0x31, 0x14, 0xf1, 0xc4, 0x4, 0x1a, 0xe0 }
-};
-
-static EFI_GUID my_gEfiIobaseHobGuid = {
-  0xd4a28a3e, 0xdcf2, 0x43cf, { 0xa2, 0xb7, 0xf3, 0x57, 0x2a, 0x7c, 0xab, 0x9 }
-};
-
-static EFI_GUID my_gEfiIpProtocolGuid = {
-  0x89deef37, 0x31d8, 0x469c, { 0x95, 0xb6, 0x1, 0x69, 0xbc, 0x86, 0x6c, 0xfb }
-};
-
-static EFI_GUID my_gEfiLegacyBiosExtProtocolGuid = {
-  0x8e008510, 0x9bb1, 0x457d, { 0x9f, 0x70, 0x89, 0x7a, 0xba, 0x86, 0x5d, 0xb9 }
-};
-
-static EFI_GUID my_gEfiLegacyBiosThunkProtocolGuid = {
-  0x4c51a7ba, 0x7195, 0x442d, { 0x87, 0x92, 0xbe, 0xea, 0x6e, 0x2f, 0xf6, 0xec }
-};
-
-static EFI_GUID my_gEfiLegacySredirProtocolGuid = {
-  0xa062cf1f, 0x8473, 0x4aa3, { 0x87, 0x93, 0x60, 0xb, 0xc4, 0xff, 0xa9, 0xa9 }
-};
-
-static EFI_GUID my_gEfiLightIsaIoProtocolGuid = {
-  0x7cc7ed80, 0x9a68, 0x4781, { 0x80, 0xe4, 0xda, 0x16, 0x99, 0x10, 0x5a, 0xfe }
-};
-
-static EFI_GUID my_gEfiMemoryProducerGuid = {
-  0x1d7add6e, 0xb2da, 0x4b0b, { 0xb2, 0x9f, 0x49, 0xcb, 0x42, 0xf4, 0x63, 0x56 }
-};
-
-static EFI_GUID my_gEfiMemorySubclassDriverGuid = {
-  0x1767ceed, 0xdb82, 0x47cd, { 0xbf, 0x2b, 0x68, 0x45, 0x8a, 0x8c, 0xcf, 0xff }
-};
-
-static EFI_GUID my_gEfiMemoryTypeFruGuid = {
-  0xd50234f4, 0x6f4b, 0x43e8, { 0xa0, 0x13, 0x3c, 0x1e, 0x33, 0xd9, 0xb9, 0xb1 }
-};
-
-static EFI_GUID my_gEfiMeBiosExtensionSetupGuid = {
-  0x1bad711c, 0xd451, 0x4241, { 0xb1, 0xf3, 0x85, 0x37, 0x81, 0x2e, 0xc, 0x70 }
-};
-
-static EFI_GUID my_gEfiMeFwSkuVariableGuid = {
-  0xe1a21d94, 0x4a20, 0x4e0e, { 0xae, 0x9, 0xa9, 0xa2, 0x1f, 0x24, 0xbb, 0x9e }
-};
-
-static EFI_GUID my_gEfiMiniShellFileGuid = {
-  0x86ad232b, 0xd33a, 0x465c, { 0xbf, 0x5f, 0x41, 0x37, 0xb, 0xa9, 0x2f, 0xe2 }
-};
-
-static EFI_GUID my_gEfiMiscProducerGuid = {
-  0x62512c92, 0x63c4, 0x4d80, { 0x82, 0xb1, 0xc1, 0xa4, 0xdc, 0x44, 0x80, 0xe5 }
-};
-
-static EFI_GUID my_gEfiMiscSubclassDriverGuid = {
-  0xf50e702c, 0x8653, 0x4cde, { 0xbb, 0xce, 0x43, 0xb4, 0xd5, 0x5b, 0x34, 0xb8 }
-};
-
-static EFI_GUID my_gEfiNbErrorLogDispatchProtocolGuid = {
-  0xff2d54d4, 0x5c55, 0x4c06, { 0x85, 0x49, 0xc3, 0x62, 0x7c, 0xb8, 0xb9, 0x95 }
-};
-
-static EFI_GUID my_gEfiNbMrcInfoGuid = {
-  0xd7bd52b0, 0xb2dc, 0x4f08, { 0xb4, 0x67, 0xde, 0x50, 0xd7, 0x28, 0xf6, 0xbd }
-};
-
-static EFI_GUID my_gEfiNicIp4ConfigProtocolGuid = {
-  0xdca3d4d, 0x12da, 0x4728, { 0xbf, 0x7e, 0x86, 0xce, 0xb9, 0x28, 0xd0, 0x67 }
-};
-
-static EFI_GUID my_gEfiNicIp4ConfigVariableGuid = {
-  0xd8944553, 0xc4dd, 0x41f4, { 0x9b, 0x30, 0xe1, 0x39, 0x7c, 0xfb, 0x26, 0x7b }
-};
-
-static EFI_GUID my_gEfiNonsmmemul6064trapProtocolGuid = {
-  0x68b81e51, 0x2583, 0x4582, { 0x95, 0xdb, 0xc5, 0x72, 0x32, 0x36, 0xc4, 0xf1 }
-};
-
-static EFI_GUID my_gEfiPathFileNameGuid = {
-  0x7644c181, 0xfa6e, 0x46da, { 0x80, 0xcb, 0x4, 0xb9, 0x90, 0x40, 0x62, 0xe8 }
-};
-
-static EFI_GUID my_gEfiPccardCsProtocolGuid = {
-  0xca54f443, 0x1ef2, 0x4dab, { 0x9e, 0x7e, 0x6d, 0xb7, 0xb7, 0x20, 0xb5, 0x87 }
-};
-
-static EFI_GUID my_gEfiPccardSsProtocolGuid = {
-  0xc38e6d34, 0x5a7f, 0x4bf9, { 0xbe, 0x57, 0x94, 0xdd, 0x30, 0x38, 0x2, 0x76 }
-};
-
-static EFI_GUID my_gEfiPchS3ImageGuid = {
-  0x271dd6f2, 0x54cb, 0x45e6, { 0x85, 0x85, 0x8c, 0x92, 0x3c, 0x1a, 0xc7, 0x6 }
-};
-
-static EFI_GUID my_gEfiPciHotplugDeviceGuid = {
-  0xb280816, 0x52e7, 0x4e51, { 0xaa, 0x57, 0x11, 0xbd, 0x41, 0xcb, 0xef, 0xc3 }
-};
-
-static EFI_GUID my_gEfiPcmciaRequestProtocolGuid = {
-  0xf238f47c, 0x1de9, 0x4e8b, { 0x81, 0xb9, 0xcc, 0x92, 0x4e, 0x6b, 0x5b, 0xe5 }
-};
-
-static EFI_GUID my_gEfiPeiAmiKeycodePpiGuid = {
-  0x20b0f1c2, 0xb0d8, 0x4c5d, { 0xaa, 0xd9, 0xf4, 0x45, 0x80, 0xdf, 0xdf, 0x8b }
-};
-
-static EFI_GUID my_gEfiPeiCmosAccessGuid = {
-  0xccbf2786, 0xcd6c, 0x4308, { 0xbd, 0xfa, 0x62, 0x58, 0x70, 0xce, 0xbf, 0x81 }
-};
-
-static EFI_GUID my_gEfiPeiConsplitAmiKeycodePpiGuid = {
-  0x73ddb5e1, 0x5fb4, 0x4751, { 0xaf, 0x1e, 0x83, 0xcf, 0x75, 0xbe, 0xcb, 0xb6 }
-};
-
-static EFI_GUID my_gEfiPeiCorePrivateGuid = {
-  0xd641a0f5, 0xcb7c, 0x4846, { 0xa3, 0x80, 0x1d, 0x1, 0xb4, 0xd9, 0xe3, 0xb9 }
-};
-
-static EFI_GUID my_gEfiPeiFlushInstructionCacheGuid = {
-  0xd8117cfc, 0x94a6, 0x11d4, { 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiPeiPerformanceHobGuid = {
-  0x10f432de, 0xdeec, 0x4631, { 0x80, 0xcd, 0x47, 0xf6, 0x5d, 0x8f, 0x80, 0xbb }
-};
-
-static EFI_GUID my_gEfiPeiPeCoffLoaderGuid = {
-  0xd8117cff, 0x94a6, 0x11d4, { 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiPeiPlatformpeiExecutedPpiGuid = {
-  0x8c72c36e, 0xdacc, 0x4e81, { 0x8d, 0x60, 0xff, 0xa6, 0x1d, 0x88, 0xff, 0x54 }
-};
-
-static EFI_GUID my_gEfiPeiTransferControlGuid = {
-  0xd8117d02, 0x94a6, 0x11d4, { 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiPerformanceProtocolGuid = {
-  0xffecffff, 0x923c, 0x14d2, { 0x9e, 0x3f, 0x22, 0xa0, 0xc9, 0x69, 0x56, 0x3b }
-};
-
-static EFI_GUID my_gEfiPlatformInfoProtocolGuid = {
-  0xd9035175, 0x8ce2, 0x47de, { 0xa8, 0xb8, 0xcc, 0x98, 0xe5, 0xe2, 0xa8, 0x85 }
-};
-
-static EFI_GUID my_gEfiPlatformMemtestProtocolGuid = {
-  0x859ba18, 0x7dd7, 0x4ed7, { 0xa8, 0x8e, 0x10, 0x9c, 0x63, 0x91, 0x7b, 0xdd }
-};
-
-static EFI_GUID my_gEfiPpmGlobalNvsAreaProtocolGuid = {
-  0x6c50cdcb, 0x7f46, 0x4dcc, { 0x8d, 0xdd, 0xd9, 0xf0, 0xa3, 0xc6, 0x11, 0x28 }
-};
-
-static EFI_GUID my_gEfiPpmInfoProtocolGuid = {
-  0xd71db106, 0xe32d, 0x4225, { 0xbf, 0xf4, 0xde, 0x6d, 0x77, 0x87, 0x17, 0x61 }
-};
-
-static EFI_GUID my_gEfiPrimaryConsoleInDeviceGuid = {
-  0xe451dcbe, 0x96a1, 0x4729, { 0xa5, 0xcf, 0x6b, 0x9c, 0x2c, 0xff, 0x47, 0xfd }
-};
-
-static EFI_GUID my_gEfiPrimaryConsoleOutDeviceGuid = {
-  0x62bdf38a, 0xe3d5, 0x492c, { 0x95, 0xc, 0x23, 0xa7, 0xf6, 0x6e, 0x67, 0x2e }
-};
-
-static EFI_GUID my_gEfiPrimaryStandardErrorDeviceGuid = {
-  0x5a68191b, 0x9b97, 0x4752, { 0x99, 0x46, 0xe3, 0x6a, 0x5d, 0xa9, 0x42, 0xb1 }
-};
-
-static EFI_GUID my_gEfiPxeDhcp4CallbackProtocolGuid = {
-  0xc1544c01, 0x92a4, 0x4198, { 0x8a, 0x84, 0x77, 0x85, 0x83, 0xc2, 0x36, 0x21 }
-};
-
-static EFI_GUID my_gEfiPxeDhcp4ProtocolGuid = {
-  0x3c4e624, 0xac28, 0x11d3, { 0x9a, 0x2d, 0x0, 0x90, 0x29, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiSaInfoProtocolGuid = {
-  0x493b5bac, 0xbb9e, 0x4bf5, { 0x83, 0x79, 0x20, 0xe2, 0xac, 0xa9, 0x85, 0x41 }
-};
-
-static EFI_GUID my_gEfiSbPcieErrorLogDispatchProtocolGuid = {
-  0xf281fc6e, 0xf4c4, 0x431c, { 0x96, 0x2b, 0x2f, 0x13, 0xae, 0x79, 0x84, 0xec }
-};
-
-static EFI_GUID my_gEfiSecSmiFlashGuid = {
-  0x3bf4af16, 0xab7c, 0x4b43, { 0x89, 0x8d, 0xab, 0x26, 0xac, 0x5d, 0xdc, 0x6c }
-};
-
-static EFI_GUID my_gEfiSerialGpioProtocolGuid = {
-  0xf52c3858, 0x5ef8, 0x4d41, { 0x83, 0x4e, 0xc3, 0x9e, 0xef, 0x8a, 0x45, 0xa3 }
-};
-
-static EFI_GUID my_gEfiShellFileGuid = {
-  0xc57ad6b7, 0x515, 0x40a8, { 0x9d, 0x21, 0x55, 0x16, 0x52, 0x85, 0x4e, 0x37 }
-};
-
-static EFI_GUID my_gEfiSimpleAudioOutProtocolGuid = {
-  0xc723f288, 0x52f9, 0x4d80, { 0xb6, 0x33, 0xe1, 0x52, 0xf9, 0x30, 0xa0, 0xdc }
-};
-
-static EFI_GUID my_gEfiSmbiosBoardProtocolGuid = {
-  0x903dd14, 0x2ca0, 0x458a, { 0xb5, 0xeb, 0xc, 0xc, 0xa3, 0xd, 0x78, 0x5c }
-};
-
-static EFI_GUID my_gEfiSmbiosDynamicDataGuid = {
-  0xe380280c, 0x4c35, 0x4aa3, { 0xb9, 0x61, 0x7a, 0xe4, 0x89, 0xa2, 0xb9, 0x26 }
-};
-
-static EFI_GUID my_gEfiSmbiosNvramDataGuid = {
-  0x4b3082a3, 0x80c6, 0x4d7e, { 0x9c, 0xd0, 0x58, 0x39, 0x17, 0x26, 0x5d, 0xf1 }
-};
-
-static EFI_GUID my_gEfiSmbiosStaticDataGuid = {
-  0xdaf4bf89, 0xce71, 0x4917, { 0xb5, 0x22, 0xc8, 0x9d, 0x32, 0xfb, 0xc5, 0x9f }
-};
-
-static EFI_GUID my_gEfiSmmBiosWriteDispatchProtocolGuid = {
-  0xe512dfe4, 0xbf44, 0x480d, { 0x9b, 0x7a, 0x77, 0x7b, 0xb, 0xe3, 0x27, 0x75 }
-};
-
-static EFI_GUID my_gEfiSmmCmosAccessGuid = {
-  0xe5d3026a, 0x1ca5, 0x40f0, { 0x8f, 0xb6, 0x4b, 0x1a, 0xfa, 0x3c, 0x6e, 0xaa }
-};
-
-static EFI_GUID my_gEfiSmmIoTrapDispatchProtocolGuid = {
-  0xdb7f536b, 0xede4, 0x4714, { 0xa5, 0xc8, 0xe3, 0x46, 0xeb, 0xaa, 0x20, 0x1d }
-};
-
-static EFI_GUID my_gEfiSmmRcToAptioBridgeGuid = {
-  0xfcdf7788, 0x7878, 0x11ff, { 0xcc, 0x77, 0x88, 0xcc, 0xcc, 0x77, 0x88, 0xcc }
-};
-
-static EFI_GUID my_gEfiSmmRuntimeProtocolGuid = {
-  0xa56897a1, 0xa77f, 0x4600, { 0x84, 0xdb, 0x22, 0xb0, 0xa8, 0x1, 0xfa, 0x9a }
-};
-
-static EFI_GUID my_gEfiSmmRuntimeServicesTableGuid = {
-  0x395c33fe, 0x287f, 0x413e, { 0xa0, 0x55, 0x80, 0x88, 0xc0, 0xe1, 0xd4, 0x3e }
-};
-
-static EFI_GUID my_gEfiSmmTcoDispatchProtocolGuid = {
-  0xe2d6bb1, 0xc624, 0x446d, { 0x99, 0x82, 0x69, 0x3c, 0xd1, 0x81, 0xa6, 0x7 }
-};
-
-static EFI_GUID my_gEfiSmmThunkProtocolGuid = {
-  0x2a82fce6, 0x8bb6, 0x413e, { 0xb9, 0xeb, 0x45, 0xdf, 0xc0, 0x52, 0x2d, 0xf3 }
-};
-
-static EFI_GUID my_gEfiSmramNvsHeaderGuid = {
-  0xec7f4fa1, 0xb217, 0x42fc, { 0xa7, 0xf7, 0x2, 0xc, 0x43, 0x5, 0xd5, 0xba }
-};
-
-static EFI_GUID my_gEfiSmtpProtocolGuid = {
-  0x5f67d40c, 0x1d06, 0x4e3e, { 0x8b, 0x4a, 0xd2, 0x71, 0x3f, 0x46, 0xe1, 0xdc }
-};
-
-static EFI_GUID my_gEfiStandardCallerIdGuid = {
-  0xc9dcf469, 0xa7c4, 0x11d5, { 0x87, 0xda, 0x0, 0x6, 0x29, 0x45, 0xc3, 0xb9 }
-};
-
-static EFI_GUID my_gEfiStatusCodeArchProtocolGuid = {
-  0xd98e3ea3, 0x6f39, 0x4be4, { 0x82, 0xce, 0x5a, 0x89, 0xc, 0xcb, 0x2c, 0x95 }
-};
-
-static EFI_GUID my_gEfiStatusCodeDataTypeAssertGuid = {
-  0xda571595, 0x4d99, 0x487c, { 0x82, 0x7c, 0x26, 0x22, 0x67, 0x7d, 0x33, 0x7 }
-};
-
-static EFI_GUID my_gEfiStatusCodeDataTypeErrorGuid = {
-  0xab359ce3, 0x99b3, 0xae18, { 0xc8, 0x9d, 0x95, 0xd3, 0xb0, 0x72, 0xe1, 0x9b }
-};
-
-static EFI_GUID my_gEfiStatusCodeDataTypeExceptionHandlerGuid = {
-  0x3bc2bd12, 0xad2e, 0x11d5, { 0x87, 0xdd, 0x0, 0x6, 0x29, 0x45, 0xc3, 0xb9 }
-};
-
-static EFI_GUID my_gEfiStatusCodeDataTypeProgressCodeGuid = {
-  0xa356ab39, 0x35c4, 0x35da, { 0xb3, 0x7a, 0xf8, 0xea, 0x9e, 0x8b, 0x36, 0xa3 }
-};
-
-static EFI_GUID my_gEfiSystemNvDataHobGuid = {
-  0xd6e5092d, 0xc7b2, 0x4872, { 0xaf, 0x66, 0xfd, 0xc0, 0xe6, 0xf9, 0x5e, 0x78 }
-};
-
-static EFI_GUID my_gEfiSystemTypeFruGuid = {
-  0xaab16018, 0x679d, 0x4461, { 0xba, 0x20, 0xe7, 0xc, 0xf7, 0x86, 0x6a, 0x9b }
-};
-
-static EFI_GUID my_gEfiTcgLogHobGuid = {
-  0x5f7d4e0e, 0x3d6d, 0x42bc, { 0xa9, 0x42, 0xe, 0x91, 0xe8, 0x3e, 0x3c, 0x31 }
-};
-
-static EFI_GUID my_gEfiTcgPlatformProtocolGuid = {
-  0x8c4c9a41, 0xbf56, 0x4627, { 0x9e, 0xa, 0xc8, 0x38, 0x6d, 0x66, 0x11, 0x5c }
-};
-
-static EFI_GUID my_gEfiTcgWakeEventDataHobGuid = {
-  0xbbb810bb, 0x5ef0, 0x4e8f, { 0xb2, 0x98, 0xad, 0x74, 0xaa, 0x50, 0xef, 0xa }
-};
-
-static EFI_GUID my_gEfiTcpProtocolGuid = {
-  0x2b3d5f2, 0xac28, 0x11d3, { 0x9a, 0x2d, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gEfiTcpSockProtocolGuid = {
-  0x5187359b, 0x790d, 0x425b, { 0xa5, 0x93, 0xca, 0x1c, 0xdb, 0x3c, 0xeb, 0xad }
-};
-
-static EFI_GUID my_gEfiTelnetServerProtocolGuid = {
-  0x6d3569d4, 0x85e5, 0x4943, { 0xae, 0x46, 0xee, 0x67, 0xa6, 0xe1, 0xab, 0x5a }
-};
-
-static EFI_GUID my_gEfiTianoDecompressProtocolGuid = {
-  0xe84cf29c, 0x191f, 0x4eae, { 0x96, 0xe1, 0xf4, 0x6a, 0xec, 0xea, 0xea, 0xb }
-};
-
-static EFI_GUID my_gEfiTimeVariableGuid = {
-  0x9d0da369, 0x540b, 0x46f8, { 0x85, 0xa0, 0x2b, 0x5f, 0x2c, 0x30, 0x1e, 0x15 }
-};
-
-static EFI_GUID my_gEfiTpmStateInitHubGuid = {
-  0xa0c6d918, 0x8dee, 0x41bb, { 0x9d, 0x92, 0x67, 0x53, 0xa5, 0x72, 0xb6, 0x52 }
-};
-
-static EFI_GUID my_gEfiTxtInfoProtocolGuid = {
-  0x601211dc, 0xb12, 0x4c09, { 0xae, 0x27, 0xab, 0xe, 0xc9, 0x69, 0x24, 0x68 }
-};
-
-static EFI_GUID my_gEfiUdpProtocolGuid = {
-  0xc56fb1b2, 0x17b, 0x4984, { 0xa3, 0xf6, 0x3f, 0x73, 0x4f, 0xfa, 0x9e, 0x33 }
-};
-
-static EFI_GUID my_gEfiUgaSplashProtocolGuid = {
-  0xa45b3a0d, 0x2e55, 0x4c03, { 0xad, 0x9c, 0x27, 0xd4, 0x82, 0xb, 0x50, 0x7e }
-};
-
-static EFI_GUID my_gEfiUsbAtapiProtocolGuid = {
-  0x2b2f68da, 0xcd2, 0x44cf, { 0x8e, 0x8b, 0xbb, 0xa2, 0xb, 0x1b, 0x5b, 0x75 }
-};
-
-static EFI_GUID my_gEfiUsbPolicyProtocolGuid = {
-  0x5859cb76, 0x6bef, 0x468a, { 0xbe, 0x2d, 0xb3, 0xdd, 0x1a, 0x27, 0xf0, 0x12 }
-};
-
-static EFI_GUID my_gEfiUsbProtocolGuid = {
-  0x2ad8e2d2, 0x2e91, 0x4cd1, { 0x95, 0xf5, 0xe7, 0x8f, 0xe5, 0xeb, 0xe3, 0x16 }
-};
-
-static EFI_GUID my_gEfiVariableStoreProtocolGuid = {
-  0xf088cd91, 0xa046, 0x11d2, { 0x8e, 0x42, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gEfiVirtualMemoryAccessProtocolGuid = {
-  0x745d377a, 0xb988, 0x47b2, { 0xb1, 0x8f, 0xbb, 0xc8, 0xd, 0xc5, 0x66, 0x98 }
-};
-
-static EFI_GUID my_gErrorManagerGuid = {
-  0xaddebf82, 0xa560, 0x46b9, { 0xa2, 0x80, 0x78, 0xc6, 0xab, 0x61, 0xae, 0xda }
-};
-
-static EFI_GUID my_gExitFormSetGuid = {
-  0xa43b03dc, 0xc18a, 0x41b1, { 0x91, 0xc8, 0x3f, 0xf9, 0xaa, 0xa2, 0x57, 0x13 }
-};
-
-static EFI_GUID my_gFastBootTseProtocolGuid = {
-  0xfba43b8, 0xacdb, 0x4ee2, { 0xab, 0x31, 0xf, 0xa4, 0xd5, 0xb6, 0xc3, 0xc5 }
-};
-
-static EFI_GUID my_gFastBootVariableGuid = {
-  0xb540a530, 0x6978, 0x4da7, { 0x91, 0xcb, 0x72, 0x7, 0xd7, 0x64, 0xd2, 0x62 }
-};
-
-static EFI_GUID my_gFidFfsSectionGuid = {
-  0x2ebe0275, 0x6458, 0x4af9, { 0x91, 0xed, 0xd3, 0xf4, 0xed, 0xb1, 0x0, 0xaa }
-};
-
-static EFI_GUID my_gFidTableGuid = {
-  0x3fd1d3a2, 0x99f7, 0x420b, { 0xbc, 0x69, 0x8b, 0xb1, 0xd4, 0x92, 0xa3, 0x32 }
-};
-
-static EFI_GUID my_gFirmwarePerformanceProtocolGuid = {
-  0xbc412d75, 0x2729, 0x4c3a, { 0xb1, 0x93, 0x5b, 0x9a, 0x58, 0x8f, 0xf6, 0x6f }
-};
-
-static EFI_GUID my_gFlashProtocolGuid = {
-  0x755b6596, 0x6896, 0x4ba3, { 0xb3, 0xdd, 0x1c, 0x62, 0x9f, 0xd1, 0xea, 0x88 }
-};
-
-static EFI_GUID my_gFlashSmmProtocolGuid = {
-  0xecb867ab, 0x8df4, 0x492d, { 0x81, 0x50, 0xa7, 0xfd, 0x1b, 0x9b, 0x5a, 0x75 }
-};
-
-static EFI_GUID my_gFlashUpdateGuid = {
-  0x974231d5, 0xed4b, 0x44d1, { 0x88, 0x70, 0xce, 0x51, 0x5c, 0xc1, 0x4d, 0x68 }
-};
-
-static EFI_GUID my_gFontFfsFileGuid = {
-  0xdac2b117, 0xb5fb, 0x4964, { 0xa3, 0x12, 0xd, 0xcc, 0x77, 0x6, 0x1b, 0x9b }
-};
-
-static EFI_GUID my_gFpdtPerformanceProtocolGuid = {
-  0x444c3203, 0xf8b1, 0x42a7, { 0xab, 0xe9, 0x2e, 0x58, 0x2, 0x5b, 0xe1, 0x2a }
-};
-
-static EFI_GUID my_gFwVersionGuid = {
-  0xb5c59087, 0xfeac, 0x4b41, { 0x9d, 0x80, 0x79, 0xb, 0xa5, 0xaa, 0x7, 0xf }
-};
-
-static EFI_GUID my_gHddSecurityEndProtocolGuid = {
-  0xad77ae29, 0x4c20, 0x4fdd, { 0x85, 0x4, 0x81, 0x76, 0x61, 0x9b, 0x67, 0x6a }
-};
-
-static EFI_GUID my_gHddSecurityInitProtocolGuid = {
-  0xce6f86bb, 0xb800, 0x4c71, { 0xb2, 0xd1, 0x38, 0x97, 0xa3, 0xbc, 0x1d, 0xae }
-};
-
-static EFI_GUID my_gHddSmartInitProtocolGuid = {
-  0x9401bd4f, 0x1a00, 0x4990, { 0xab, 0x56, 0xda, 0xf0, 0xe4, 0xe3, 0x48, 0xde }
-};
-
-static EFI_GUID my_gHddUnlockedGuid = {
-  0x1fd29be6, 0x70d0, 0x42a4, { 0xa6, 0xe7, 0xe5, 0xd1, 0xe, 0x6a, 0xc3, 0x76 }
-};
-
-static EFI_GUID my_gHiiResourcesFfsSectionGuid = {
-  0x97e409e6, 0x4cc1, 0x11d9, { 0x81, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 }
-};
-
-static EFI_GUID my_gHotPlugDeviceGuid = {
-  0x220ac432, 0x1d43, 0x49e5, { 0xa7, 0x4f, 0x4c, 0x9d, 0xa6, 0x7a, 0xd2, 0x3b }
-};
-
-static EFI_GUID my_gIccOverclockingProtocolGuid = {
-  0x8e8cbc58, 0x834c, 0x41e3, { 0xb8, 0xca, 0xf0, 0xc, 0xcf, 0x5a, 0x71, 0x7c }
-};
-
-static EFI_GUID my_gIccPersistentDataGuid = {
-  0x64192dca, 0xd034, 0x49d2, { 0xa6, 0xde, 0x65, 0xa8, 0x29, 0xeb, 0x4c, 0x74 }
-};
-
-static EFI_GUID my_gIccVolatileSetupDataGuid = {
-  0x7b77fb8b, 0x1e0d, 0x4d7e, { 0x95, 0x3f, 0x39, 0x80, 0xa2, 0x61, 0xe0, 0x77 }
-};
-
-static EFI_GUID my_gIdeBusDriverBindingProtocolGuid = {
-  0x8aa67071, 0x8bec, 0x47ab, { 0x83, 0xc8, 0xcd, 0xe, 0xb7, 0x23, 0xd0, 0x72 }
-};
-
-static EFI_GUID my_gIdeBusInitProtocolGuid = {
-  0xe159a956, 0x3299, 0x4ee9, { 0x91, 0x76, 0x65, 0x18, 0x1a, 0x4e, 0x5e, 0x9f }
-};
-
-static EFI_GUID my_gIdeControllerProtocolGuid = {
-  0x20e28787, 0xdf32, 0x4bda, { 0xb7, 0xe7, 0xcb, 0xbd, 0xa3, 0x37, 0x1e, 0xf8 }
-};
-
-static EFI_GUID my_gIdeHpaInterfaceGuid = {
-  0x51aa65fc, 0x82b6, 0x49e6, { 0x95, 0xe2, 0xe6, 0x82, 0x7a, 0x8d, 0x7d, 0xb4 }
-};
-
-static EFI_GUID my_gIdePowerMgmtInterfaceGuid = {
-  0x67bc3883, 0x7e79, 0x4bc1, { 0xa3, 0x3e, 0x3a, 0xf7, 0xd1, 0x75, 0x89, 0xba }
-};
-
-static EFI_GUID my_gIdeSecurityInterfaceGuid = {
-  0xf4f63529, 0x281e, 0x4040, { 0xa3, 0x13, 0xc1, 0xd6, 0x76, 0x63, 0x84, 0xbe }
-};
-
-static EFI_GUID my_gIdeSecurityPwnvGuid = {
-  0x69967a8c, 0x1159, 0x4522, { 0xaa, 0x89, 0x74, 0xcd, 0xc6, 0xe5, 0x99, 0xa0 }
-};
-
-static EFI_GUID my_gIdeSetupProtocolGuid = {
-  0x5578ae16, 0xf1c9, 0x4e8f, { 0xb1, 0x29, 0xba, 0x7, 0xf8, 0xfc, 0xf8, 0x4a }
-};
-
-static EFI_GUID my_gIdeSmartInterfaceGuid = {
-  0xffbd9ad2, 0xf1db, 0x4f92, { 0xa6, 0x49, 0xeb, 0x9e, 0xed, 0xea, 0x86, 0xb5 }
-};
-
-static EFI_GUID my_gIffsAcpiTableStorageGuid = {
-  0x60ac3a8f, 0x4d66, 0x4cd4, { 0x89, 0x5a, 0xc3, 0xf0, 0x6e, 0x66, 0x65, 0xee }
-};
-
-static EFI_GUID my_gIffsGlobalNvsAreaProtocolGuid = {
-  0xa5559f06, 0x6415, 0x4759, { 0x88, 0x69, 0xde, 0x15, 0xf9, 0xcd, 0x9c, 0x9b }
-};
-
-static EFI_GUID my_gIffsGptGuid = {
-  0xd3bfe2de, 0x3daf, 0x11df, { 0xba, 0x40, 0xe3, 0xa5, 0x56, 0xd8, 0x95, 0x93 }
-};
-
-static EFI_GUID my_gIffsInfoProtocolGuid = {
-  0xd231db5b, 0x4a9c, 0x4092, { 0xa8, 0xc5, 0x9c, 0xa0, 0xbc, 0x7d, 0x6a, 0xa6 }
-};
-
-static EFI_GUID my_gIffsPartitionStatusProtocolGuid = {
-  0x65639144, 0xd492, 0x4328, { 0xa4, 0x98, 0xf4, 0xb5, 0x54, 0x5e, 0x4a, 0x30 }
-};
-
-static EFI_GUID my_gIffsPersistentDataGuid = {
-  0xf9f0b131, 0xf346, 0x4f16, { 0x80, 0xdd, 0xf9, 0x41, 0x7, 0x2b, 0x3a, 0x7d }
-};
-
-static EFI_GUID my_gIffsPlatformPolicyProtocolGuid = {
-  0x42bbaca3, 0x7161, 0x4891, { 0xac, 0x10, 0xc7, 0x5e, 0x2e, 0x4d, 0xf6, 0x14 }
-};
-
-static EFI_GUID my_gIffsPpiGuid = {
-  0x3d0e663a, 0xdc72, 0x4489, { 0x87, 0xc5, 0xe4, 0x9e, 0xe7, 0x73, 0xa4, 0x52 }
-};
-
-static EFI_GUID my_gIntelMebxProtocolGuid = {
-  0x1ab1829, 0xcecd, 0x4cfa, { 0xa1, 0x8c, 0xea, 0x75, 0xd6, 0x6f, 0x3e, 0x74 }
-};
-
-static EFI_GUID my_gMainFormSetGuid = {
-  0x985eee91, 0xbcac, 0x4238, { 0x87, 0x78, 0x57, 0xef, 0xdc, 0x93, 0xf2, 0x4e }
-};
-
-static EFI_GUID my_gMdesStatusCodeProtocolGuid = {
-  0xe5d0875a, 0xf647, 0x4e16, { 0xbe, 0x4d, 0x95, 0x2, 0x40, 0x29, 0xcc, 0x44 }
-};
-
-static EFI_GUID my_gMebxFileGuid = {
-  0x7c81c66a, 0x4f11, 0x47ab, { 0x82, 0xd3, 0x67, 0xc4, 0xd6, 0x35, 0xae, 0xd1 }
-};
-
-static EFI_GUID my_gMeudErrorGuid = {
-  0x732bd39, 0xd6b0, 0x4039, { 0xb6, 0xc2, 0x96, 0x54, 0x46, 0x6d, 0xe5, 0x25 }
-};
-
-static EFI_GUID my_gMeudFileGuid = {
-  0xfeaaa7a6, 0xcb95, 0x4670, { 0xb4, 0x99, 0x87, 0x7f, 0xa6, 0xca, 0x6b, 0xae }
-};
-
-static EFI_GUID my_gMeAlertAtHandlerGuid = {
-  0xb441df87, 0x8d94, 0x4811, { 0x85, 0xf7, 0xf, 0x9a, 0x7b, 0xf8, 0x9d, 0x2a }
-};
-
-static EFI_GUID my_gMeBiosPayloadDataProtocolGuid = {
-  0x71a19494, 0x2ab6, 0x4e96, { 0x85, 0x81, 0xcf, 0x34, 0x25, 0x42, 0x73, 0xfe }
-};
-
-static EFI_GUID my_gMeInfoSetupGuid = {
-  0x78259433, 0x7b6d, 0x4db3, { 0x9a, 0xe8, 0x36, 0xc4, 0xc2, 0xc3, 0xa1, 0x7d }
-};
-
-static EFI_GUID my_gMePlatformGetResetTypeGuid = {
-  0xb8cdced7, 0xbdc4, 0x4464, { 0x9a, 0x1a, 0xff, 0x3f, 0xbd, 0xf7, 0x48, 0x69 }
-};
-
-static EFI_GUID my_gMicrocodeLoaderPpiGuid = {
-  0x9b6eecf6, 0xfbdc, 0x4db6, { 0x95, 0x62, 0xd2, 0x5f, 0x40, 0xd5, 0x76, 0x61 }
-};
-
-static EFI_GUID my_gMxm30PeiGuid = {
-  0x2ef1ba1a, 0xc836, 0x4a50, { 0xbf, 0x89, 0x52, 0x5f, 0xf2, 0x9f, 0xf7, 0x87 }
-};
-
-static EFI_GUID my_gMxm3EfiGuid = {
-  0x4ea9d4fe, 0xe6f6, 0x410b, { 0x90, 0x37, 0xf, 0x98, 0xb5, 0x96, 0x8b, 0x65 }
-};
-
-static EFI_GUID my_gMxmoem1Guid = {
-  0x6707536e, 0x46af, 0x42d3, { 0x8f, 0x6c, 0x15, 0xf2, 0xf2, 0x2, 0xc2, 0x34 }
-};
-
-static EFI_GUID my_gNbciEfiGuid = {
-  0x4ea9d4fe, 0xe6f6, 0x410b, { 0x80, 0x37, 0xf, 0x98, 0xb5, 0x96, 0x8b, 0x65 }
-};
-
-static EFI_GUID my_gNetworkStackGuid = {
-  0xd1405d16, 0x7afc, 0x4695, { 0xbb, 0x12, 0x41, 0x45, 0x9d, 0x36, 0x95, 0xa2 }
-};
-
-static EFI_GUID my_gNvramHobGuid = {
-  0xc0ec00fd, 0xc2f8, 0x4e47, { 0x90, 0xef, 0x9c, 0x81, 0x55, 0x28, 0x5b, 0xec }
-};
-
-static EFI_GUID my_gNvramMailboxAddressVariableGuid = {
-  0x54913a6d, 0xf4ee, 0x4cdb, { 0x84, 0x75, 0x74, 0x6, 0x2b, 0xfc, 0xec, 0xf5 }
-};
-
-static EFI_GUID my_gOemRecoveryCapsuleGuid = {
-  0x595a6edc, 0x6d2c, 0x474a, { 0x90, 0x82, 0x3b, 0x99, 0x28, 0x51, 0xdf, 0xfe }
-};
-
-static EFI_GUID my_gOemRomHole0Guid = {
-  0x5ca01fc, 0xfc1, 0x11dc, { 0x90, 0x11, 0x0, 0x17, 0x31, 0x53, 0xeb, 0xa8 }
-};
-
-static EFI_GUID my_gOemRomHole1Guid = {
-  0x5ca01fd, 0xfc1, 0x11dc, { 0x90, 0x11, 0x0, 0x17, 0x31, 0x53, 0xeb, 0xa8 }
-};
-
-static EFI_GUID my_gOemTseVarGuid = {
-  0xf4b2c007, 0x94a1, 0x4cd5, { 0xa7, 0x10, 0xf4, 0x14, 0x1f, 0xce, 0xbc, 0xa0 }
-};
-
-static EFI_GUID my_gOnboardRaidGuid = {
-  0x5d206dd3, 0x516a, 0x47dc, { 0xa1, 0xbc, 0x6d, 0xa2, 0x4, 0xaa, 0xbe, 0x8 }
-};
-
-static EFI_GUID my_gOpalSecInitProtocolGuid = {
-  0x59af16b0, 0x661d, 0x4865, { 0xa3, 0x81, 0x38, 0xde, 0x68, 0x38, 0x5d, 0x8d }
-};
-
-static EFI_GUID my_gOpromStartEndProtocolGuid = {
-  0xf2a128ff, 0x257b, 0x456e, { 0x9d, 0xe8, 0x63, 0xe7, 0xc7, 0xdc, 0xdf, 0xac }
-};
-
-static EFI_GUID my_gPartitionVariableGuid = {
-  0x8db699cc, 0xbc81, 0x41e2, { 0xaa, 0xc6, 0xd8, 0x1d, 0x53, 0x0, 0xd7, 0x59 }
-};
-
-static EFI_GUID my_gPasswordHobGuid = {
-  0x79ce097a, 0x91aa, 0x41ff, { 0xb3, 0xa8, 0x53, 0x45, 0x59, 0xb3, 0xd, 0xb1 }
-};
-
-static EFI_GUID my_gPchDmiTcVcPpiGuid = {
-  0xed097352, 0x9041, 0x445a, { 0x80, 0xb6, 0xb2, 0x9d, 0x50, 0x9e, 0x88, 0x45 }
-};
-
-static EFI_GUID my_gPchEfiRaidDriverExecutionGuid = {
-  0x99d5757c, 0xd906, 0x11e0, { 0x8d, 0x78, 0x8d, 0xe4, 0x48, 0x24, 0x1, 0x9b }
-};
-
-static EFI_GUID my_gPchMeUmaPpiGuid = {
-  0x8c376010, 0x2400, 0x4d7d, { 0xb4, 0x7b, 0x9d, 0x85, 0x1d, 0xf3, 0xc9, 0xd1 }
-};
-
-static EFI_GUID my_gPeiAmtPlatformPolicyPpiGuid = {
-  0xb4a1208e, 0x4d9a, 0x4ea2, { 0x9d, 0x6b, 0xe4, 0x1a, 0x61, 0xe6, 0xc5, 0xac }
-};
-
-static EFI_GUID my_gPeiAmtStatusCodePpiGuid = {
-  0x881807d2, 0x98d1, 0x4ec9, { 0xaf, 0xa0, 0x77, 0x46, 0xc4, 0x2f, 0x24, 0x49 }
-};
-
-static EFI_GUID my_gPeiApStartupFileGuid = {
-  0xd1e59f50, 0xe8c3, 0x4545, { 0xbf, 0x61, 0x11, 0xf0, 0x2, 0x23, 0x3c, 0x97 }
-};
-
-static EFI_GUID my_gPeiAtaPolicyPpiGuid = {
-  0x1b8ddea4, 0xdeb2, 0x4152, { 0x91, 0xc2, 0xb7, 0x3c, 0xb1, 0x6c, 0xe4, 0x64 }
-};
-
-static EFI_GUID my_gPeiBaseMemoryTestGuid = {
-  0xb6ec423c, 0x21d2, 0x490d, { 0x85, 0xc6, 0xdd, 0x58, 0x64, 0xea, 0xa6, 0x74 }
-};
-
-static EFI_GUID my_gPeiBiosAcmFileGuid = {
-  0x2d27c618, 0x7dcd, 0x41f5, { 0xbb, 0x10, 0x21, 0x16, 0x6b, 0xe7, 0xe1, 0x43 }
-};
-
-static EFI_GUID my_gPeiBootScriptDonePpiGuid = {
-  0xfd7c4665, 0x34be, 0x426b, { 0xb1, 0xf8, 0x3a, 0xb7, 0x53, 0xce, 0x44, 0xb0 }
-};
-
-static EFI_GUID my_gPeiCachePpiGuid = {
-  0xc153205a, 0xe898, 0x4c24, { 0x86, 0x89, 0xa4, 0xb4, 0xbc, 0xc5, 0xc8, 0xa2 }
-};
-
-static EFI_GUID my_gPeiCpuPlatformPolicyPpiGuid = {
-  0x7b8ee7a1, 0x4e35, 0x4556, { 0xbb, 0x56, 0x67, 0x97, 0xe2, 0x44, 0x45, 0xc2 }
-};
-
-static EFI_GUID my_gPeiFlashMapPpiGuid = {
-  0xf34c2fa0, 0xde88, 0x4270, { 0x84, 0x14, 0x96, 0x12, 0x22, 0xf4, 0x52, 0x1c }
-};
-
-static EFI_GUID my_gPeiIdeRecoveryNativeModePpiGuid = {
-  0x7e13637a, 0xc3f8, 0x43d1, { 0xb0, 0x51, 0xed, 0x19, 0xd7, 0x8, 0xec, 0x7a }
-};
-
-static EFI_GUID my_gPeiIffsTransitionStartPpiGuid = {
-  0xde8f2878, 0x36d5, 0x498e, { 0xba, 0x59, 0x16, 0x8c, 0x26, 0x47, 0xb3, 0x35 }
-};
-
-static EFI_GUID my_gPeiInMemoryGuid = {
-  0x643b8786, 0xb417, 0x48d2, { 0x8f, 0x5e, 0x78, 0x19, 0x93, 0x1c, 0xae, 0xd8 }
-};
-
-static EFI_GUID my_gPeiPlatformMemoryRangePpiGuid = {
-  0x30eb2979, 0xb0f7, 0x4d60, { 0xb2, 0xdc, 0x1a, 0x2c, 0x96, 0xce, 0xb1, 0xf4 }
-};
-
-static EFI_GUID my_gPeiPlatformMemorySizePpiGuid = {
-  0x9a7ef41e, 0xc140, 0x4bd1, { 0xb8, 0x84, 0x1e, 0x11, 0x24, 0xb, 0x4c, 0xe6 }
-};
-
-static EFI_GUID my_gPeiStatusCodeMemoryPpiGuid = {
-  0x26f8ab01, 0xd3cd, 0x489c, { 0x98, 0x4f, 0xdf, 0xde, 0xf7, 0x68, 0x39, 0x5b }
-};
-
-static EFI_GUID my_gPeiTcgInternalFlagsGuid = {
-  0x70fff0ff, 0xa543, 0x45b9, { 0x8b, 0xe3, 0x1b, 0xdb, 0x90, 0x41, 0x20, 0x80 }
-};
-
-static EFI_GUID my_gPeiTcgPpiGuid = {
-  0x177d39d2, 0x43b8, 0x40c8, { 0x9a, 0xe1, 0x3c, 0x51, 0x98, 0xd6, 0x94, 0x1e }
-};
-
-static EFI_GUID my_gPeiTpmPpi2Guid = {
-  0xca4853f4, 0xe94b, 0x42b4, { 0x86, 0x42, 0xcd, 0xe2, 0x8a, 0x7f, 0xac, 0x2d }
-};
-
-static EFI_GUID my_gPeiTxtMemoryUnlockedPpiGuid = {
-  0x38cdd10b, 0x767d, 0x4f6e, { 0xa7, 0x44, 0x67, 0xee, 0x1d, 0xfe, 0x2f, 0xa5 }
-};
-
-static EFI_GUID my_gPerfTunePpiGuid = {
-  0xc49189f3, 0x1d4c, 0x4ad7, { 0xa4, 0x39, 0xd0, 0x13, 0xab, 0x72, 0x9, 0x31 }
-};
-
-static EFI_GUID my_gPerfTuneProtocolGuid = {
-  0xdd6c613a, 0x5a77, 0x4b4f, { 0xa6, 0x1e, 0x3b, 0xdd, 0x2a, 0xe2, 0x1d, 0x81 }
-};
-
-static EFI_GUID my_gPerfTuneWdtPpiGuid = {
-  0xa7c88fae, 0xebec, 0x45ed, { 0xa7, 0xc5, 0x5f, 0xa7, 0x55, 0x17, 0x73, 0x6 }
-};
-
-static EFI_GUID my_gPerfTuneWdtProtocolGuid = {
-  0xc0557eed, 0x9a89, 0x4770, { 0x96, 0x26, 0xfc, 0xa0, 0x51, 0xf2, 0xba, 0x9 }
-};
-
-static EFI_GUID my_gPkpubKeyGuid = {
-  0xa6c0e11e, 0x929e, 0x42b3, { 0x90, 0xcc, 0x4f, 0x77, 0x8e, 0x3, 0xff, 0x57 }
-};
-
-static EFI_GUID my_gPkPubFfsFileEfiAuthVarGuid = {
-  0x9e625a27, 0x4840, 0x47cc, { 0xa6, 0xb5, 0x1e, 0x93, 0x11, 0xcf, 0xc6, 0xe }
-};
-
-static EFI_GUID my_gPlatformIdeProtocolGuid = {
-  0x6737f69b, 0xb8cc, 0x45bc, { 0x93, 0x27, 0xcc, 0xf5, 0xee, 0xf7, 0xc, 0xde }
-};
-
-static EFI_GUID my_gPlatformMeHookPpiGuid = {
-  0xe806424f, 0xd425, 0x4b1a, { 0xbc, 0x26, 0x5f, 0x69, 0x3, 0x89, 0xa1, 0x5a }
-};
-
-static EFI_GUID my_gPpmProcessorSupportProtocol3Guid = {
-  0xa60c7dcd, 0x512f, 0x4f02, { 0xb1, 0x80, 0x52, 0x2e, 0x1, 0x5e, 0x6, 0xb7 }
-};
-
-static EFI_GUID my_gPrKeyFfsFileRawGuid = {
-  0x3feec852, 0xf14c, 0x4e7f, { 0x97, 0xfd, 0x4c, 0x3a, 0x8c, 0x5b, 0xbe, 0xcc }
-};
-
-static EFI_GUID my_gPrKeyGuid = {
-  0x4e0f9bd4, 0xe338, 0x4b26, { 0x84, 0x3e, 0xbd, 0x3a, 0xd9, 0xb2, 0x83, 0x7b }
-};
-
-static EFI_GUID my_gPtidFfsTableStorageGuid = {
-  0x95dfcae5, 0xbb28, 0x4d6b, { 0xb1, 0xe2, 0x3a, 0xf3, 0xa6, 0xbf, 0x43, 0x4f }
-};
-
-static EFI_GUID my_gRecoveryFormSetGuid = {
-  0x80e1202e, 0x2697, 0x4264, { 0x9c, 0xc9, 0x80, 0x76, 0x2c, 0x3e, 0x58, 0x63 }
-};
-
-static EFI_GUID my_gRomCacheEnablePpiGuid = {
-  0x36e835bb, 0x661d, 0x4d37, { 0x8d, 0xe5, 0x88, 0x53, 0x25, 0xda, 0xe9, 0x10 }
-};
-
-static EFI_GUID my_gRomImageAddressGuid = {
-  0xdde1bc72, 0xd45e, 0x4209, { 0xab, 0x85, 0x14, 0x46, 0x2d, 0x2f, 0x50, 0x74 }
-};
-
-static EFI_GUID my_gRomImageMemoryHobGuid = {
-  0xee2f45d2, 0x5ba4, 0x441e, { 0x8a, 0x1d, 0xaa, 0x22, 0xdf, 0xa3, 0xb6, 0xc5 }
-};
-
-static EFI_GUID my_gRomLayoutFfsGuid = {
-  0xdca793a, 0xea96, 0x42d8, { 0xbd, 0x7b, 0xdc, 0x7f, 0x68, 0x4e, 0x38, 0xc1 }
-};
-
-static EFI_GUID my_gRomLayoutSectionGuid = {
-  0x88a15a4f, 0x977d, 0x4682, { 0xb1, 0x7c, 0xda, 0x1f, 0x31, 0x6c, 0x1f, 0x32 }
-};
-
-static EFI_GUID my_gRsdpPlusProtocolGuid = {
-  0xa33319b5, 0x8ee1, 0x45e0, { 0x8c, 0x9f, 0x80, 0x9f, 0x5b, 0x9, 0x2, 0xcc }
-};
-
-static EFI_GUID my_gSataControllerProtocolGuid = {
-  0x2acb6627, 0xdf02, 0x4e23, { 0xb4, 0xf9, 0x6a, 0x93, 0xfa, 0x6e, 0x9d, 0xa6 }
-};
-
-static EFI_GUID my_gSaPegDataHobGuid = {
-  0x5f5d3502, 0x8a4b, 0x40ca, { 0x88, 0xa2, 0x23, 0x5, 0x42, 0x7a, 0x13, 0x1a }
-};
-
-static EFI_GUID my_gSaPegDataVariableGuid = {
-  0xc4975200, 0x64f1, 0x4fb6, { 0x97, 0x73, 0xf6, 0xa9, 0xf8, 0x9d, 0x98, 0x5e }
-};
-
-static EFI_GUID my_gSaPlatformPolicyPpiGuid = {
-  0x150ce416, 0xee63, 0x46b6, { 0x8b, 0xa3, 0x73, 0x22, 0xbb, 0xe0, 0x46, 0x37 }
-};
-
-static EFI_GUID my_gSecurityFormSetGuid = {
-  0x981ceaee, 0x931c, 0x4a17, { 0xb9, 0xc8, 0x66, 0xc7, 0xbc, 0xfd, 0x77, 0xe1 }
-};
-
-static EFI_GUID my_gSerialRecoveryCapsuleGuid = {
-  0x699add70, 0x8554, 0x4993, { 0x83, 0xf6, 0xd2, 0xcd, 0xc0, 0x81, 0xdd, 0x85 }
-};
-
-static EFI_GUID my_gSetupDefaultsFfsGuid = {
-  0x9221315b, 0x30bb, 0x46b5, { 0x81, 0x3e, 0x1b, 0x1b, 0xf4, 0x71, 0x2b, 0xd3 }
-};
-
-static EFI_GUID my_gSgoemAcpiSsdtGuid = {
-  0x5b232086, 0x350a, 0x42c7, { 0xa7, 0xe, 0x34, 0x97, 0xb5, 0x76, 0x5d, 0x85 }
-};
-
-static EFI_GUID my_gSgtpvAcpiSsdtGuid = {
-  0x6a061113, 0xfe54, 0x4a07, { 0xa2, 0x8e, 0xa, 0x69, 0x35, 0x9e, 0xb0, 0x69 }
-};
-
-static EFI_GUID my_gSgAcpiTableStorageGuid = {
-  0xcacb3817, 0x81e6, 0x497e, { 0x87, 0xff, 0xc8, 0xfa, 0x8f, 0x24, 0xec, 0x28 }
-};
-
-static EFI_GUID my_gSgInfoHobGuid = {
-  0x648ce07b, 0xae5d, 0x4973, { 0xbd, 0x3c, 0x8c, 0x91, 0x53, 0xc0, 0x5d, 0xc5 }
-};
-
-static EFI_GUID my_gSgPeiInitPpiGuid = {
-  0xaa40d00e, 0x5b9b, 0x4dad, { 0xa4, 0x87, 0xfc, 0x1b, 0xcb, 0xef, 0x81, 0x70 }
-};
-
-static EFI_GUID my_gSgPlatformPolicyPpiGuid = {
-  0xa391e822, 0x7044, 0x4cf4, { 0xbe, 0x5b, 0x34, 0x5e, 0x44, 0xb8, 0x62, 0x7c }
-};
-
-static EFI_GUID my_gSioDevStatusVarGuid = {
-  0x5820de98, 0xfc8e, 0x4b0b, { 0xa4, 0xb9, 0xa, 0x94, 0xd, 0x16, 0x2a, 0x7e }
-};
-
-static EFI_GUID my_gSioIoProtocolGuid = {
-  0x964e5b21, 0x6000, 0x23d2, { 0x9e, 0x39, 0x1, 0xa0, 0xc9, 0x69, 0x72, 0x3b }
-};
-
-static EFI_GUID my_gSmmChildDispatcher2Guid = {
-  0x950c3a26, 0xe0c2, 0x491c, { 0xb6, 0xb2, 0x3, 0x74, 0xf5, 0xc7, 0x3b, 0x96 }
-};
-
-static EFI_GUID my_gSmramCpuDataHeaderGuid = {
-  0x5848fd2d, 0xd6af, 0x474b, { 0x82, 0x75, 0x95, 0xdd, 0xe7, 0xa, 0xe8, 0x23 }
-};
-
-static EFI_GUID my_gSmramCpuDataVariableGuid = {
-  0x429501d9, 0xe447, 0x40f4, { 0x86, 0x7b, 0x75, 0xc9, 0x3a, 0x1d, 0xb5, 0x4e }
-};
-
-static EFI_GUID my_gSmBusControllerIdentifierGuid = {
-  0x882f2546, 0xef1f, 0x4090, { 0x9f, 0x9c, 0x93, 0x84, 0x5a, 0xd7, 0x84, 0x1c }
-};
-
-static EFI_GUID my_gSystemAccessGuid = {
-  0xe770bb69, 0xbcb4, 0x4d04, { 0x9e, 0x97, 0x23, 0xff, 0x94, 0x56, 0xfe, 0xac }
-};
-
-static EFI_GUID my_gTcgLockDownVarGuid = {
-  0x6e605536, 0xa30a, 0x4d56, { 0x93, 0x9e, 0x1c, 0x37, 0x3f, 0x79, 0x8d, 0x7b }
-};
-
-static EFI_GUID my_gTcgPlatformSetupPeiPolicyGuid = {
-  0xa76b4e22, 0xb50a, 0x401d, { 0x8b, 0x35, 0x51, 0x24, 0xb0, 0xba, 0x41, 0x4 }
-};
-
-static EFI_GUID my_gTcgPlatformSetupPolicyGuid = {
-  0xbb6cbeff, 0xe072, 0x40d2, { 0xa6, 0xeb, 0xba, 0xb7, 0x5b, 0xde, 0x87, 0xe7 }
-};
-
-static EFI_GUID my_gTcgPpiSyncFlagGuid = {
-  0xf3ed95df, 0x828e, 0x41c7, { 0xbc, 0xa0, 0x16, 0xc4, 0x19, 0x65, 0xa6, 0x34 }
-};
-
-static EFI_GUID my_gTdthiProtocolFixedGuid = {
-  0xfa8f55e8, 0xab22, 0x42dd, { 0xb9, 0x16, 0x7d, 0xce, 0x39, 0x0, 0x25, 0x74 }
-};
-
-static EFI_GUID my_gTdthiProtocolGuid = {
-  0x3c4852d6, 0xd47b, 0x4f46, { 0xb0, 0x5e, 0xb5, 0xed, 0xc1, 0xaa, 0x43, 0xa }
-};
-
-static EFI_GUID my_gTdtVolatileSetupDataGuid = {
-  0x7b77fb8b, 0x1e0d, 0x4d7e, { 0x95, 0x3f, 0x39, 0x80, 0xa2, 0x61, 0xe0, 0x76 }
-};
-
-static EFI_GUID my_gTpmBootFlowVariableGuid = {
-  0xb6460a49, 0xac1, 0x484f, { 0xae, 0x58, 0xf1, 0x6e, 0xb2, 0x39, 0xdb, 0x3d }
-};
-
-static EFI_GUID my_gTxtInfoHobGuid = {
-  0x2986883f, 0x88e0, 0x48d0, { 0x4b, 0x82, 0x20, 0xc2, 0x69, 0x48, 0xdd, 0xac }
-};
-
-static EFI_GUID my_gTxtOneTouchGuid = {
-  0x3d989471, 0xcfac, 0x46b7, { 0x9b, 0x1c, 0x8, 0x43, 0x1, 0x9, 0x40, 0x2d }
-};
-
-static EFI_GUID my_gTxtOneTouchOpProtocolGuid = {
-  0xfa2338ad, 0x80df, 0x49d0, { 0x93, 0x96, 0xcf, 0x71, 0x45, 0xd0, 0x3a, 0x76 }
-};
-
-static EFI_GUID my_gUsbTimingPolicyProtocolGuid = {
-  0x89e3c1dc, 0xb5e3, 0x4d34, { 0xae, 0xad, 0xdd, 0x7e, 0xb2, 0x82, 0x8c, 0x18 }
-};
-
-static EFI_GUID my_gUserDefaultsGuid = {
-  0xc4cc0de8, 0x687, 0x4422, { 0x99, 0xc1, 0x65, 0x35, 0x1a, 0x5d, 0x5f, 0x95 }
-};
-
-static EFI_GUID my_gWdtAppProtocolGuid = {
-  0x92c7d0bb, 0x679e, 0x479d, { 0x87, 0x8d, 0xd4, 0xb8, 0x29, 0x68, 0x57, 0x8b }
-};
-
-static EFI_GUID my_gWdtHobGuid = {
-  0x65675786, 0xacca, 0x4b11, { 0x8a, 0xb7, 0xf8, 0x43, 0xaa, 0x2a, 0x8b, 0xea }
-};
-
-static EFI_GUID my_gWdtPersistentDataGuid = {
-  0x78ce2354, 0xcfbc, 0x4643, { 0xae, 0xba, 0x7, 0xa2, 0x7f, 0xa8, 0x92, 0xbf }
-};
-
-static EFI_GUID my_gWdtPpiGuid = {
-  0xf38d1338, 0xaf7a, 0x4fb6, { 0x91, 0xdb, 0x1a, 0x9c, 0x21, 0x83, 0x57, 0xd }
-};
-
-static EFI_GUID my_gWdtProtocolGuid = {
-  0xb42b8d12, 0x2acb, 0x499a, { 0xa9, 0x20, 0xdd, 0x5b, 0xe6, 0xcf, 0x9, 0xb1 }
-};
-
-static EFI_GUID my_gAsrockAcpis4DxeGuid = {
-  0x41fd986, 0xb016, 0x47ce, { 0xaf, 0xc5, 0x22, 0x69, 0xed, 0xd4, 0xad, 0x64 }
-};
-
-static EFI_GUID my_gAsrockUsbrtGuid = {
-  0x4eaaaa1, 0x29a1, 0x11d7, { 0x88, 0x38, 0x0, 0x50, 0x4, 0x73, 0xd4, 0xeb }
-};
-
-static EFI_GUID my_gAsrockRaidSetupGuid = {
-  0x916e322, 0x3740, 0x31ce, { 0xad, 0x62, 0xbd, 0x17, 0x2c, 0xec, 0xca, 0x36 }
-};
-
-static EFI_GUID my_gAsrockRaidLoaderGuid = {
-  0x9ce2c2d, 0x4d83, 0x44b8, { 0x97, 0xd0, 0x10, 0x85, 0xeb, 0x54, 0x90, 0xb8 }
-};
-
-static EFI_GUID my_gAsrockSioslpsmiGuid = {
-  0xc3798aa, 0xd22e, 0x4dd6, { 0x8c, 0xb4, 0x3c, 0x9c, 0xfb, 0x1d, 0x86, 0xd3 }
-};
-
-static EFI_GUID my_gAsrockPleddxeGuid = {
-  0xf886e75, 0x3029, 0x4ecf, { 0xb6, 0x94, 0x22, 0x89, 0x4d, 0x3f, 0x21, 0x43 }
-};
-
-static EFI_GUID my_gAsrockADefaultDxeGuid = {
-  0x1216bd2a, 0xc05e, 0x4c6d, { 0x91, 0xe7, 0xeb, 0x8e, 0x37, 0xad, 0x3b, 0x7a }
-};
-
-static EFI_GUID my_gAsrockUserDefSetupDxeGuid = {
-  0x132ec73b, 0xbd26, 0x4fbf, { 0xb1, 0x93, 0x8a, 0xcb, 0x50, 0xef, 0xbd, 0x89 }
-};
-
-static EFI_GUID my_gAsrockWakeupCtrlSmmGuid = {
-  0x1b6e9d50, 0x12e4, 0x4b55, { 0x81, 0xd9, 0x1a, 0xbf, 0xec, 0x59, 0xd4, 0xfc }
-};
-
-static EFI_GUID my_gAsrockAmiAgesaDxeGuid = {
-  0x1dfb7bfa, 0xbf8e, 0x4d11, { 0x97, 0x66, 0x2f, 0xb0, 0xd0, 0x44, 0x23, 0x10 }
-};
-
-static EFI_GUID my_gAsrockHddReadySmiGuid = {
-  0x2167f964, 0x7298, 0x4a8f, { 0x9a, 0x2a, 0xbf, 0xe4, 0x98, 0xd6, 0x0, 0xa8 }
-};
-
-static EFI_GUID my_gAsrockMouseDriverGuid = {
-  0x2adb8f5b, 0xc7d4, 0x4e7e, { 0xbe, 0x2a, 0x23, 0x63, 0x4d, 0xf6, 0x68, 0xa1 }
-};
-
-static EFI_GUID my_gAsrockIdesmmGuid = {
-  0x316b1230, 0x500, 0x4592, { 0x8c, 0x9, 0xea, 0xba, 0xf, 0xb6, 0xb0, 0x7f }
-};
-
-static EFI_GUID my_gAsrockBfgsmiGuid = {
-  0x3a53114d, 0x5673, 0x4dd9, { 0xb5, 0xb3, 0xcb, 0x72, 0xc3, 0x47, 0x66, 0x9b }
-};
-
-static EFI_GUID my_gAsrockAsrlogodxeGuid = {
-  0x3d9fc54d, 0x19e5, 0x4ad0, { 0xb9, 0x86, 0x2, 0xd6, 0x87, 0xd7, 0x60, 0xe5 }
-};
-
-static EFI_GUID my_gAsrockAsm104XDxeGuid = {
-  0x405f8fe6, 0x5213, 0x4b85, { 0xb8, 0x21, 0x97, 0xb7, 0x7a, 0xff, 0x79, 0x5b }
-};
-
-static EFI_GUID my_gAsrockHdaudioSmiGuid = {
-  0x4ac94f68, 0xe651, 0x4b38, { 0xa1, 0xd8, 0x2d, 0x5d, 0xef, 0xfa, 0xf, 0x60 }
-};
-
-static EFI_GUID my_gAsrockSmBusDxeGuid = {
-  0x4b680e2d, 0xd63, 0x4f62, { 0xb9, 0x30, 0x7a, 0xe9, 0x95, 0xb9, 0xb3, 0xa3 }
-};
-
-static EFI_GUID my_gAsrockUsbint13Guid = {
-  0x4c006cd9, 0x19ba, 0x4617, { 0x84, 0x83, 0x60, 0x91, 0x94, 0xa1, 0xac, 0xfc }
-};
-
-static EFI_GUID my_gAsrockSlpSupportGuid = {
-  0x4c494e55, 0x5849, 0x5342, { 0x45, 0x54, 0x54, 0x45, 0x52, 0x21, 0x21, 0x21 }
-};
-
-static EFI_GUID my_gAsrockPataControllerGuid = {
-  0x4f9147cb, 0x972e, 0x4f5c, { 0xb8, 0x69, 0xa0, 0x21, 0x82, 0xc9, 0xd9, 0x3c }
-};
-
-static EFI_GUID my_gAsrockSataControllerGuid = {
-  0x510df6a1, 0xb6c1, 0x4948, { 0xae, 0xe7, 0x59, 0xf2, 0x20, 0xf8, 0x98, 0xbd }
-};
-
-static EFI_GUID my_gAsrockAcpis4SmmGuid = {
-  0x5199296f, 0x2808, 0x4afa, { 0x94, 0xc4, 0x99, 0xf6, 0xb0, 0x6c, 0x87, 0x1e }
-};
-
-static EFI_GUID my_gAsrockPostReportGuid = {
-  0x5446c293, 0x339b, 0x47cd, { 0xb7, 0x19, 0x58, 0x5d, 0xe3, 0x94, 0x8, 0xcc }
-};
-
-static EFI_GUID my_gAsrockClockGenDxeGuid = {
-  0x5640497f, 0x645e, 0x4611, { 0xb9, 0x15, 0xe6, 0x82, 0xc8, 0xbd, 0x47, 0x83 }
-};
-
-static EFI_GUID my_gAsrockUhcdGuid = {
-  0x580dd900, 0x385d, 0x11d7, { 0x88, 0x3a, 0x0, 0x50, 0x4, 0x73, 0xd4, 0xeb }
-};
-
-static EFI_GUID my_gAsrockLegacyRegionGuid = {
-  0x59242dd8, 0xe7cf, 0x4979, { 0xb6, 0xe, 0xa6, 0x6, 0x7e, 0x2a, 0x18, 0x5f }
-};
-
-static EFI_GUID my_gAsrockSleepSmiGuid = {
-  0x6298fe18, 0xd5ef, 0x42b7, { 0xbb, 0xc, 0x29, 0x53, 0x28, 0x3f, 0x57, 0x4 }
-};
-
-static EFI_GUID my_gAsrockCmosManagerSmmGuid = {
-  0x6869c5b3, 0xac8d, 0x4973, { 0x8b, 0x37, 0xe3, 0x54, 0xdb, 0xf3, 0x4a, 0xdd }
-};
-
-static EFI_GUID my_gAsrockAmdAgesaDxeDriverGuid = {
-  0x6950afff, 0x6ee3, 0x11dd, { 0xad, 0x8b, 0x8, 0x0, 0x20, 0xc, 0x9a, 0x66 }
-};
-
-static EFI_GUID my_gAsrockReFlashGuid = {
-  0x70e1a818, 0xbe1, 0x4449, { 0xbf, 0xd4, 0x9e, 0xf6, 0x8c, 0x7f, 0x2, 0xa8 }
-};
-
-static EFI_GUID my_gAsrockLegacyInterruptGuid = {
-  0x71ed12d1, 0x250b, 0x42fb, { 0x8c, 0x17, 0x10, 0xdc, 0xfa, 0x77, 0x17, 0x1 }
-};
-
-static EFI_GUID my_gAsrockSmmChildDispatcherGuid = {
-  0x753630c9, 0xfae5, 0x47a9, { 0xbb, 0xbf, 0x88, 0xd6, 0x21, 0xcd, 0x72, 0x82 }
-};
-
-static EFI_GUID my_gAsrockBfgdxeGuid = {
-  0x7687a497, 0xff4e, 0x48ff, { 0xbc, 0xaa, 0x67, 0xdb, 0xf6, 0x5c, 0x42, 0xd1 }
-};
-
-static EFI_GUID my_gAsrockIflashsetupGuid = {
-  0x77e5b618, 0x2612, 0x4c28, { 0xbc, 0xdf, 0xa2, 0xb1, 0x4d, 0x8a, 0x3e, 0xfe }
-};
-
-static EFI_GUID my_gAsrockS4SleepdelayGuid = {
-  0x7bbc4123, 0x5d5e, 0x4c1c, { 0x95, 0xd1, 0x30, 0xeb, 0xa4, 0x87, 0x1, 0xca }
-};
-
-static EFI_GUID my_gAsrockHddReadyDxeGuid = {
-  0x81e4b34a, 0x268c, 0x4fcc, { 0x8e, 0x39, 0x1c, 0x1d, 0x3e, 0x6f, 0x6e, 0x69 }
-};
-
-static EFI_GUID my_gAsrockRtlandxeGuid = {
-  0x8b0e1353, 0x358c, 0x4e2f, { 0x93, 0x45, 0xee, 0xbf, 0x1d, 0xab, 0x98, 0x9b }
-};
-
-static EFI_GUID my_gAsrockAmdSb900DxeGuid = {
-  0x8b12f29f, 0x7135, 0x4eab, { 0xaf, 0xda, 0x5, 0x12, 0xf7, 0x4b, 0x65, 0xea }
-};
-
-static EFI_GUID my_gAsrockSb900SmbusLightGuid = {
-  0x981ad9cd, 0x8685, 0x4aab, { 0xaf, 0xda, 0x5, 0x12, 0xf7, 0x4b, 0x65, 0xea }
-};
-
-static EFI_GUID my_gAsrockAaftblSmiGuid = {
-  0x9ef8c276, 0xb3e6, 0x4ad9, { 0x8f, 0xe7, 0xc7, 0x4f, 0x71, 0xc4, 0x72, 0x48 }
-};
-
-static EFI_GUID my_gAsrockNvramidGuid = {
-  0xa16ba302, 0x6514, 0x4287, { 0xbe, 0xe3, 0x62, 0x23, 0xb7, 0xde, 0x2c, 0x21 }
-};
-
-static EFI_GUID my_gAsrockIdeSecurityGuid = {
-  0xa9b700cf, 0x19e, 0x4d8b, { 0xa3, 0xa7, 0x88, 0xe1, 0xea, 0x1, 0x69, 0x9e }
-};
-
-static EFI_GUID my_gAsrockAsm1061DxeGuid = {
-  0xa9ce66d5, 0x6d37, 0x451e, { 0xa9, 0xbf, 0xf5, 0x8f, 0x7a, 0xb, 0x3c, 0xc2 }
-};
-
-static EFI_GUID my_gAsrockAsm104XSmiGuid = {
-  0xad1f487a, 0xba56, 0x48dc, { 0x8e, 0xaa, 0xe8, 0xfb, 0xea, 0x74, 0xb8, 0xf2 }
-};
-
-static EFI_GUID my_gAsrockRtlansmiGuid = {
-  0xb324f29b, 0x5e97, 0x4bf9, { 0xb4, 0xe0, 0x51, 0x25, 0xc1, 0xf6, 0x5, 0xd5 }
-};
-
-static EFI_GUID my_gAsrockGecUpdateSmiGuid = {
-  0xb859281c, 0x16fa, 0x45a8, { 0x92, 0x1, 0x1c, 0x38, 0x30, 0xa9, 0x73, 0xbd }
-};
-
-static EFI_GUID my_gAsrockApmoffGuid = {
-  0xbb9175e1, 0x3e95, 0x4b7e, { 0x87, 0x50, 0x9d, 0x6a, 0xa3, 0x4e, 0xb7, 0xf6 }
-};
-
-static EFI_GUID my_gAsrockSmiflashGuid = {
-  0xbc327dbd, 0xb982, 0x4f55, { 0x9f, 0x79, 0x5, 0x6a, 0xd7, 0xe9, 0x87, 0xc5 }
-};
-
-static EFI_GUID my_gAsrockRaidX64Guid = {
-  0xc468b382, 0x4550, 0x4909, { 0xad, 0x57, 0x24, 0x96, 0x14, 0x1b, 0x3f, 0x4a }
-};
-
-static EFI_GUID my_gAsrockAmdSb900SmmGuid = {
-  0xc7c89169, 0x1a42, 0x4e5e, { 0xb3, 0x4b, 0xe6, 0x83, 0x6, 0x71, 0xc9, 0xa6 }
-};
-
-static EFI_GUID my_gAsrockFirewireGuid = {
-  0xc8b64e46, 0x9819, 0x45ab, { 0x87, 0x5d, 0x9, 0xdf, 0xda, 0x6d, 0x8b, 0x1b }
-};
-
-static EFI_GUID my_gAsrockIdeSmartGuid = {
-  0xd57c852e, 0x809f, 0x45cf, { 0xa3, 0x77, 0xd7, 0x7b, 0xc0, 0xcb, 0x78, 0xee }
-};
-
-static EFI_GUID my_gAsrockSbInterfaceDxeGuid = {
-  0xd7e6abc1, 0x971b, 0x461b, { 0xb5, 0xe4, 0x3c, 0x37, 0x66, 0x26, 0x7a, 0xd9 }
-};
-
-static EFI_GUID my_gAsrockAmdSb900SmmDispatcherGuid = {
-  0xdf73abda, 0x7a42, 0x4e5e, { 0xb3, 0x4b, 0xe6, 0x83, 0x6, 0x71, 0xc9, 0xa6 }
-};
-
-static EFI_GUID my_gAsrockAmdcpuDxeGuid = {
-  0xe1b26d32, 0x414f, 0x46db, { 0x9a, 0xee, 0x42, 0x0, 0x77, 0xf3, 0x5d, 0xbe }
-};
-
-static EFI_GUID my_gAsrockSmbiosDmieditGuid = {
-  0xe2a74738, 0x8934, 0x48f5, { 0x84, 0x12, 0x99, 0xe9, 0x48, 0xc8, 0xdc, 0x1b }
-};
-
-static EFI_GUID my_gAsrockSecuritySelectDxeGuid = {
-  0xe469aa26, 0x9268, 0x4eb0, { 0xa0, 0x87, 0xdd, 0x4c, 0xee, 0x37, 0x40, 0x4b }
-};
-
-static EFI_GUID my_gAsrockFileExplorerLiteGuid = {
-  0xe706cb54, 0x84b8, 0x40bd, { 0x83, 0x2f, 0x7f, 0xb2, 0xd5, 0xcb, 0x87, 0xb3 }
-};
-
-static EFI_GUID my_gAsrockPledsmmGuid = {
-  0xe92bae14, 0x3dfd, 0x4c70, { 0x9f, 0xe6, 0x38, 0x99, 0xf3, 0x6c, 0x78, 0x46 }
-};
-
-static EFI_GUID my_gAsrockCpuSmbiosDriverGuid = {
-  0xea4daee8, 0xa851, 0x4a9f, { 0xab, 0xf4, 0xb7, 0x9f, 0xa2, 0x52, 0x82, 0x91 }
-};
-
-static EFI_GUID my_gAsrockAaftblDxeGuid = {
-  0xff11e702, 0x8923, 0x47cc, { 0xad, 0x30, 0xd9, 0xe0, 0xe2, 0x40, 0xdd, 0x10 }
-};
-
-static EFI_GUID my_gDellComputraceBinaryGuid = {
-  0x25247a74, 0x9440, 0x47d5, { 0xbf, 0xa, 0xed, 0x92, 0xa4, 0xd6, 0xeb, 0xa4 }
-};
-
-static EFI_GUID my_gDellMebxSetupBinaryGuid = {
-  0x17772369, 0xd262, 0x4b90, { 0x9f, 0x31, 0xbd, 0xc4, 0x1f, 0x26, 0x63, 0xa5 }
-};
-
-static EFI_GUID my_gDellErrorLogConfigGuid = {
-  0x38ce287, 0xb806, 0x45b6, { 0xa8, 0x19, 0x51, 0x4d, 0xaf, 0x4b, 0x91, 0xb9 }
-};
-
-static EFI_GUID my_gDellFpThunkGuid = {
-  0x41ce993, 0x6677, 0x4720, { 0xa6, 0x65, 0x37, 0x5b, 0x80, 0xff, 0xe0, 0x12 }
-};
-
-static EFI_GUID my_gDellIntelLomSmmGuid = {
-  0x8abe065, 0xc359, 0x4b95, { 0x8d, 0x59, 0xc1, 0xb5, 0x8e, 0xb6, 0x57, 0xb5 }
-};
-
-static EFI_GUID my_gDellLegacyVideoRomGuid = {
-  0x8e56a30, 0x62ed, 0x41c6, { 0x92, 0x40, 0xb7, 0x45, 0x5e, 0xe6, 0x53, 0xd7 }
-};
-
-static EFI_GUID my_gDellPchS3SupportGuid = {
-  0x8f2c63b, 0x8de, 0x4ccd, { 0x86, 0x70, 0xac, 0xfe, 0x64, 0x4a, 0x1c, 0x48 }
-};
-
-static EFI_GUID my_gDellSpiPartMicronGuid = {
-  0x914de08, 0x434d, 0x4f9f, { 0x93, 0xb3, 0x6f, 0xa4, 0x8a, 0xea, 0xf7, 0xe0 }
-};
-
-static EFI_GUID my_gDellDcpRegisterGuid = {
-  0x99fd87f, 0x4b39, 0x43f6, { 0xab, 0x47, 0xf8, 0x1, 0xf9, 0x92, 0x9, 0xf7 }
-};
-
-static EFI_GUID my_gDellAhciDxeGuid = {
-  0x9b98059, 0x2d74, 0x43c5, { 0x97, 0x9, 0xad, 0xa, 0x0, 0x51, 0x86, 0x7d }
-};
-
-static EFI_GUID my_gDellSimpleBootFlagSrcGuid = {
-  0xa7521e1, 0x9f1, 0x44ae, { 0x9b, 0x5f, 0x27, 0x81, 0xb7, 0x89, 0x71, 0xd6 }
-};
-
-static EFI_GUID my_gDellEdiagsDxeGuid = {
-  0xb234df1, 0x80, 0x412b, { 0x87, 0x16, 0x8a, 0x81, 0xa3, 0xa1, 0x1f, 0xaa }
-};
-
-static EFI_GUID my_gDellAcpiOemConfigGuid = {
-  0xb2e406a, 0xed5b, 0x4668, { 0xbc, 0xd1, 0x2b, 0x1d, 0xb0, 0x18, 0x41, 0xfc }
-};
-
-static EFI_GUID my_gDellSpiPartMxicGuid = {
-  0xb7bf76c, 0x721a, 0x44fb, { 0xa7, 0x58, 0x52, 0xe1, 0x3c, 0xa4, 0x57, 0xf1 }
-};
-
-static EFI_GUID my_gDellDtwlanSmmGuid = {
-  0xba38e92, 0x154a, 0x4be2, { 0xa5, 0xe0, 0xbe, 0x80, 0x57, 0x1c, 0xdb, 0x71 }
-};
-
-static EFI_GUID my_gDellLegacy16RomGuid = {
-  0xbb12cac, 0xcfa9, 0x4839, { 0xa4, 0xc2, 0x17, 0x97, 0x24, 0x81, 0x9, 0xd0 }
-};
-
-static EFI_GUID my_gDellDeviceNameConfigGuid = {
-  0xbc22608, 0xecc5, 0x47b9, { 0xa0, 0x38, 0x4f, 0xa, 0x68, 0x37, 0x2e, 0x44 }
-};
-
-static EFI_GUID my_gDellAi13RomGuid = {
-  0xcd3d2fa, 0xb21d, 0x47b5, { 0xba, 0x95, 0xd8, 0xc0, 0xb, 0x38, 0xf3, 0x24 }
-};
-
-static EFI_GUID my_gDellJpegDecoderGuid = {
-  0xd24a235, 0x9c12, 0x446c, { 0x8e, 0xcb, 0xef, 0xc1, 0xf5, 0x28, 0x2, 0x9 }
-};
-
-static EFI_GUID my_gDellDaHddProtectionGuid = {
-  0xd28c529, 0x87d4, 0x4298, { 0x8a, 0x54, 0x40, 0xf2, 0x2a, 0x9f, 0xe2, 0x4a }
-};
-
-static EFI_GUID my_gDellDccsSmmDriverGuid = {
-  0xd81fdc5, 0xcb98, 0x4b9f, { 0xb9, 0x3b, 0x70, 0xa9, 0xc0, 0x66, 0x3a, 0xbe }
-};
-
-static EFI_GUID my_gDellIntrusionDetectSmmGuid = {
-  0xdde9636, 0x8321, 0x4edf, { 0x9f, 0x14, 0xb, 0xfc, 0xa3, 0xb4, 0x73, 0xf5 }
-};
-
-static EFI_GUID my_gDellVirtRtcSmmGuid = {
-  0xe7383b1, 0x83ee, 0x41a4, { 0x93, 0x9e, 0x24, 0xc8, 0x86, 0xf0, 0x3a, 0xd6 }
-};
-
-static EFI_GUID my_gDellSmmHwmDriverGuid = {
-  0xea3d651, 0x49b4, 0x47d9, { 0xbd, 0xc3, 0xe4, 0xa3, 0x79, 0xf3, 0xde, 0x76 }
-};
-
-static EFI_GUID my_gDellSmBiosStrucDbGuid = {
-  0xeb4fac0, 0xa3ec, 0x4fed, { 0x97, 0x83, 0xa8, 0xd0, 0xff, 0xd1, 0xae, 0x33 }
-};
-
-static EFI_GUID my_gDellCenturyRolloverSmmGuid = {
-  0x1181e16d, 0xaf11, 0x4c52, { 0x84, 0x7e, 0x51, 0x6d, 0xd0, 0x9b, 0xd3, 0x76 }
-};
-
-static EFI_GUID my_gDellSmmSecurityVaultGuid = {
-  0x119f3764, 0xa7c2, 0x4329, { 0xb2, 0x5c, 0xe6, 0x30, 0x5e, 0x74, 0x30, 0x49 }
-};
-
-static EFI_GUID my_gDellDxeSwSmiGuid = {
-  0x11dd0f6c, 0x209b, 0x47ce, { 0x8a, 0x98, 0x41, 0x8c, 0x9b, 0x7c, 0xc7, 0x56 }
-};
-
-static EFI_GUID my_gDellSmmSbAcpiGuid = {
-  0x12963e55, 0x5826, 0x469e, { 0xa9, 0x34, 0xa3, 0xcb, 0xb3, 0x7, 0x6e, 0xc5 }
-};
-
-static EFI_GUID my_gDellSmmAccessGuid = {
-  0x1323c7f8, 0xdad5, 0x4126, { 0xa5, 0x4b, 0x7a, 0x5, 0xfb, 0xf4, 0x15, 0x15 }
-};
-
-static EFI_GUID my_gDellMfgModeSmmDriverGuid = {
-  0x1478454a, 0x4584, 0x4cca, { 0xb0, 0xd2, 0x12, 0xa, 0xce, 0x12, 0x9d, 0xbb }
-};
-
-static EFI_GUID my_gDellSpiPartAtmelGuid = {
-  0x14e7d9be, 0x7834, 0x477e, { 0xa9, 0x42, 0xff, 0x5f, 0x82, 0x3e, 0xe2, 0x49 }
-};
-
-static EFI_GUID my_gDellEdiagsConfigGuid = {
-  0x150ec16f, 0xbb6, 0x42a8, { 0xb6, 0x5, 0x79, 0x79, 0x4b, 0x89, 0xd1, 0x5b }
-};
-
-static EFI_GUID my_gDellVariableSmmGuid = {
-  0x166fd043, 0xea13, 0x4848, { 0xbb, 0x3c, 0x6f, 0xa2, 0x95, 0xb9, 0x46, 0x27 }
-};
-
-static EFI_GUID my_gDellSmmGpioPolicyGuid = {
-  0x16c368fe, 0xf174, 0x4881, { 0x92, 0xce, 0x38, 0x86, 0x99, 0xd3, 0x4d, 0x95 }
-};
-
-static EFI_GUID my_gDellAcpiGuid = {
-  0x16d0a23e, 0xc09c, 0x407d, { 0xa1, 0x4a, 0xad, 0x5, 0x8f, 0xdd, 0xc, 0xa1 }
-};
-
-static EFI_GUID my_gDellRuntimeAcpiDxeGuid = {
-  0x17390333, 0x4ce6, 0x48a8, { 0xaf, 0xb9, 0xe, 0xf5, 0x5b, 0x66, 0x6b, 0x74 }
-};
-
-static EFI_GUID my_gDellServiceMenuGuid = {
-  0x1916f73e, 0xc824, 0x4f91, { 0xac, 0x9c, 0xbf, 0x1f, 0xd2, 0x8e, 0x44, 0x31 }
-};
-
-static EFI_GUID my_gDellMonotonicCounterGuid = {
-  0x194ee52b, 0x2fe, 0x418d, { 0xaa, 0x10, 0x2e, 0x61, 0xe5, 0x1c, 0xb8, 0x94 }
-};
-
-static EFI_GUID my_gDellCsmOemRomGuid = {
-  0x1a1d1204, 0xe385, 0x4943, { 0xa8, 0x92, 0x53, 0x34, 0xce, 0x38, 0x9, 0xac }
-};
-
-static EFI_GUID my_gDellDiagsSbControlSmmGuid = {
-  0x1afe6bd0, 0xc9c5, 0x44d4, { 0xb7, 0xbd, 0x8f, 0x5e, 0x7d, 0xf, 0x25, 0x60 }
-};
-
-static EFI_GUID my_gDellAmtPlatformPolicyGuid = {
-  0x1be65202, 0x9318, 0x492d, { 0xa5, 0x51, 0x8, 0xdf, 0x2b, 0xd6, 0xa, 0xee }
-};
-
-static EFI_GUID my_gDellMfgAuthenticationGuid = {
-  0x1c33c958, 0xfea4, 0x435f, { 0x93, 0xef, 0xa, 0x9c, 0x14, 0xae, 0x87, 0xe4 }
-};
-
-static EFI_GUID my_gDellSmBiosStrucDaGuid = {
-  0x1c733cb5, 0x4c8f, 0x44d9, { 0xbb, 0xf0, 0x95, 0x47, 0x70, 0x89, 0xeb, 0x8 }
-};
-
-static EFI_GUID my_gDellDxeComputraceGuid = {
-  0x1ce692f0, 0x3317, 0x4574, { 0x8b, 0x57, 0x48, 0x0, 0xed, 0x9, 0x1f, 0x40 }
-};
-
-static EFI_GUID my_gDellSmmStatusCodeGuid = {
-  0x1d82219f, 0x386f, 0x4f26, { 0xaf, 0xac, 0x61, 0x3f, 0x24, 0x2c, 0x7, 0x60 }
-};
-
-static EFI_GUID my_gDellPowerButtonConfigGuid = {
-  0x1ef02cf1, 0xbf69, 0x49c3, { 0x8f, 0xdc, 0x5b, 0xb5, 0x5d, 0x22, 0x4c, 0xfa }
-};
-
-static EFI_GUID my_gDellRebootDxeGuid = {
-  0x2000a832, 0xc674, 0x486a, { 0x81, 0xbe, 0xcb, 0x46, 0x70, 0xa4, 0xf7, 0xfd }
-};
-
-static EFI_GUID my_gDellFlashIoDxeGuid = {
-  0x216a681c, 0x9e51, 0x415f, { 0x9a, 0xda, 0xcb, 0x9f, 0xbc, 0xd0, 0x5f, 0x5d }
-};
-
-static EFI_GUID my_gDellSmBiosStrucB1Guid = {
-  0x231d3a65, 0x9442, 0x4507, { 0xa4, 0xe4, 0xe9, 0xd2, 0x17, 0x65, 0x78, 0xf1 }
-};
-
-static EFI_GUID my_gDellIoTrapGuid = {
-  0x2374eddf, 0xf203, 0x4fc0, { 0xa2, 0xe, 0x61, 0xba, 0xd7, 0x30, 0x89, 0xd6 }
-};
-
-static EFI_GUID my_gDellSmBiosDxeDriverGuid = {
-  0x2386e231, 0xa9cf, 0x4f52, { 0x94, 0x6a, 0x6f, 0x6b, 0x6c, 0x13, 0x3b, 0x46 }
-};
-
-static EFI_GUID my_gDellUpdateMemoryRecordGuid = {
-  0x24ccd374, 0x3df6, 0x4181, { 0x86, 0xf6, 0xe3, 0xc6, 0x69, 0x20, 0xa1, 0x45 }
-};
-
-static EFI_GUID my_gDellBiosBlkIoSrcGuid = {
-  0x25acf158, 0xdd61, 0x4e64, { 0x9a, 0x49, 0x55, 0x85, 0x1e, 0x9a, 0x26, 0xc7 }
-};
-
-static EFI_GUID my_gDellAcpis3SaveGuid = {
-  0x26a2481e, 0x4424, 0x46a2, { 0x99, 0x43, 0xcc, 0x40, 0x39, 0xea, 0xd8, 0xf8 }
-};
-
-static EFI_GUID my_gDellSbServicesSmmGuid = {
-  0x26c04cf3, 0xf5fb, 0x4968, { 0x8d, 0x57, 0xc7, 0xfa, 0xa, 0x93, 0x27, 0x83 }
-};
-
-static EFI_GUID my_gDellSystemIdConfigDxeGuid = {
-  0x27287751, 0x867a, 0x46cd, { 0x91, 0xaf, 0x41, 0x6f, 0xf6, 0xae, 0x3d, 0xfe }
-};
-
-static EFI_GUID my_gDellOromKbAccessGuid = {
-  0x27587b71, 0x37f9, 0x4a48, { 0xb5, 0x70, 0x58, 0xb6, 0xd1, 0x4f, 0x6d, 0xec }
-};
-
-static EFI_GUID my_gDellSmsc5544DxeGuid = {
-  0x27f3838f, 0xba27, 0x4ffa, { 0xb3, 0x74, 0x35, 0xbe, 0xa2, 0x8a, 0x43, 0x1b }
-};
-
-static EFI_GUID my_gDellAmtPetAlertGuid = {
-  0x290ea249, 0x6e88, 0x423c, { 0xb0, 0xda, 0x75, 0xcd, 0xde, 0x79, 0x20, 0xcc }
-};
-
-static EFI_GUID my_gDellCsmVideoGuid = {
-  0x29cf55f8, 0xb675, 0x4f5d, { 0x8f, 0x2f, 0xb8, 0x7a, 0x3e, 0xcf, 0xd0, 0x63 }
-};
-
-static EFI_GUID my_gDellBindingsSmmGuid = {
-  0x2aeda0eb, 0x1392, 0x4232, { 0xa4, 0xf9, 0xc5, 0x7a, 0x3c, 0x2f, 0xa2, 0xd9 }
-};
-
-static EFI_GUID my_gDellEdiagsSmmGuid = {
-  0x2d6dcb78, 0xcae2, 0x4459, { 0x92, 0x7c, 0x64, 0xa6, 0xb7, 0xe6, 0x4a, 0x75 }
-};
-
-static EFI_GUID my_gDellPbaUpekDpbaGuid = {
-  0x2d7522fa, 0x67f0, 0x4768, { 0xb6, 0xe0, 0xfd, 0x76, 0xf1, 0x7f, 0x4b, 0x4 }
-};
-
-static EFI_GUID my_gDellPpmPolicyInitDxeGuid = {
-  0x2df10014, 0xcf21, 0x4280, { 0x8c, 0x3f, 0xe5, 0x39, 0xb8, 0xee, 0x51, 0x50 }
-};
-
-static EFI_GUID my_gDellGenericSioDxeGuid = {
-  0x2df61403, 0xc180, 0x45a5, { 0xa2, 0x2b, 0x1a, 0x3d, 0xb8, 0x8f, 0xe9, 0xba }
-};
-
-static EFI_GUID my_gDellSmBiosSmmDaCiGuid = {
-  0x2e3f2275, 0x89cd, 0x4de4, { 0xbd, 0x84, 0xbe, 0xbf, 0xd9, 0x4b, 0xcd, 0xcc }
-};
-
-static EFI_GUID my_gDellUsbMouseGuid = {
-  0x2eff67e3, 0x5987, 0x46e8, { 0x81, 0x11, 0x80, 0xff, 0xa6, 0x7a, 0xeb, 0x93 }
-};
-
-static EFI_GUID my_gDellDxeGpioPolicyGuid = {
-  0x2fb216ed, 0x4a67, 0x4833, { 0x9f, 0x5c, 0x24, 0x81, 0x24, 0xcd, 0x9a, 0xac }
-};
-
-static EFI_GUID my_gDellGsetGuid = {
-  0x2fb92efa, 0x2ee0, 0x4bae, { 0x9e, 0xb6, 0x74, 0x44, 0x12, 0x5e, 0x1e, 0xf7 }
-};
-
-static EFI_GUID my_gDellUhciGuid = {
-  0x2fb92efa, 0x2ee0, 0x4bae, { 0x9e, 0xb6, 0x74, 0x64, 0x12, 0x5e, 0x1e, 0xf7 }
-};
-
-static EFI_GUID my_gDellSpiPartPromJetGuid = {
-  0x2ffdaf4a, 0xa9b5, 0x4ef6, { 0xaa, 0x3b, 0xa8, 0x96, 0x11, 0xaa, 0xb2, 0x84 }
-};
-
-static EFI_GUID my_gDellPciHotPlugGuid = {
-  0x3022e512, 0xb94a, 0x4f12, { 0x80, 0x6d, 0x7e, 0xf1, 0x17, 0x78, 0x99, 0xd8 }
-};
-
-static EFI_GUID my_gDellSmbProtocolAccessGuid = {
-  0x329f126f, 0x299e, 0x4bc5, { 0x83, 0x10, 0x17, 0x9f, 0x10, 0xeb, 0x46, 0xc9 }
-};
-
-static EFI_GUID my_gDellAlertStandardFormatDxeGuid = {
-  0x33c6406d, 0x2f6b, 0x41b5, { 0x87, 0x5, 0x52, 0xba, 0xfb, 0x63, 0x3c, 0x9 }
-};
-
-static EFI_GUID my_gDellLegUsbMemSmmGuid = {
-  0x36aebb56, 0x1f8b, 0x4bc1, { 0x8e, 0xfe, 0x40, 0x85, 0xa5, 0xd4, 0xc4, 0xa }
-};
-
-static EFI_GUID my_gDellErrorHandlerSmmGuid = {
-  0x37287c8b, 0xdc93, 0x45d5, { 0x9a, 0xaf, 0x3c, 0xd2, 0xe9, 0x6, 0xb1, 0x2b }
-};
-
-static EFI_GUID my_gDellDefaultBootListSmmGuid = {
-  0x37287c8b, 0xdc93, 0x45d5, { 0x9a, 0xaf, 0x3c, 0xd2, 0xe9, 0x6, 0xff, 0xff }
-};
-
-static EFI_GUID my_gDellTpmdxeGuid = {
-  0x386eb7ba, 0x6344, 0x44e8, { 0x98, 0x5c, 0x39, 0x78, 0xfd, 0x47, 0x91, 0x6b }
-};
-
-static EFI_GUID my_gDellOemSxSmmGuid = {
-  0x38871bf0, 0xc64a, 0x4896, { 0xb8, 0xe4, 0x62, 0xd4, 0x85, 0xc, 0x7e, 0x68 }
-};
-
-static EFI_GUID my_gDellAcLossSmmGuid = {
-  0x38871bf0, 0xc64a, 0x4896, { 0xb8, 0xe4, 0x62, 0xd7, 0x75, 0xc, 0x7d, 0x68 }
-};
-
-static EFI_GUID my_gDellDiagsSbControlDxeGuid = {
-  0x38ef2b8b, 0xcf3d, 0x47e2, { 0x97, 0xe3, 0x55, 0x71, 0x15, 0xe4, 0x39, 0x85 }
-};
-
-static EFI_GUID my_gDellSmmLegacyRegionGuid = {
-  0x3962deb5, 0xfdf6, 0x4829, { 0x88, 0x9c, 0xd5, 0x44, 0x91, 0x8e, 0x84, 0xd9 }
-};
-
-static EFI_GUID my_gDellPs2EmulGuid = {
-  0x39a7fadc, 0x9a24, 0x4553, { 0x8c, 0xbd, 0x9b, 0x72, 0xb2, 0x4c, 0x22, 0xfd }
-};
-
-static EFI_GUID my_gDellMemoryS4Guid = {
-  0x3a29dd19, 0x2c84, 0x4a70, { 0x9a, 0x1, 0xfb, 0xdd, 0xaf, 0xfb, 0x64, 0x61 }
-};
-
-static EFI_GUID my_gDellSbServicesDxeGuid = {
-  0x3a4044d2, 0xf614, 0x4124, { 0xa7, 0x72, 0x20, 0x7b, 0xcd, 0xbe, 0x3d, 0xb0 }
-};
-
-static EFI_GUID my_gDellStopShipConfigGuid = {
-  0x3b37b724, 0x4af7, 0x4a35, { 0x97, 0xb3, 0xd2, 0xfb, 0x8f, 0x4f, 0x56, 0x3c }
-};
-
-static EFI_GUID my_gDellBlockIoGuid = {
-  0x3bc1c867, 0x2274, 0x43f8, { 0xa4, 0xba, 0x93, 0x9a, 0x5b, 0xd6, 0xd4, 0x73 }
-};
-
-static EFI_GUID my_gDellPciBusGuid = {
-  0x3c1de39f, 0xd207, 0x408a, { 0xaa, 0xcc, 0x73, 0x1c, 0xfb, 0x7f, 0x1d, 0xd7 }
-};
-
-static EFI_GUID my_gDellTxTdxeGuid = {
-  0x3d5674d0, 0xae75, 0x4723, { 0x91, 0x59, 0x1d, 0x65, 0x3b, 0x40, 0x40, 0x2f }
-};
-
-static EFI_GUID my_gDellSmBiosStrucD3Guid = {
-  0x3dde54e9, 0x8d18, 0x4ea8, { 0x94, 0x23, 0xc2, 0xe8, 0x46, 0xe1, 0x8e, 0x23 }
-};
-
-static EFI_GUID my_gDellSmbBootPriorityGuid = {
-  0x41846a2e, 0x7aaa, 0x4498, { 0xbc, 0x26, 0xb5, 0xac, 0xd4, 0x9f, 0x92, 0xe1 }
-};
-
-static EFI_GUID my_gDellSpiControllerSmmGuid = {
-  0x418faf6c, 0x2bcf, 0x4141, { 0x89, 0x83, 0x9d, 0x33, 0xe1, 0xb6, 0x7b, 0x4c }
-};
-
-static EFI_GUID my_gDellMePciPlatformConfigDxeGuid = {
-  0x41f46692, 0x9513, 0x4d1c, { 0x8b, 0xb3, 0xb6, 0xa1, 0x68, 0x18, 0x2d, 0xe4 }
-};
-
-static EFI_GUID my_gDellPbaUpekDxeGuid = {
-  0x42c32dcf, 0xf25a, 0x47f3, { 0x8f, 0x4c, 0xab, 0xd4, 0x78, 0xd7, 0x7f, 0x50 }
-};
-
-static EFI_GUID my_gDellGpeConfigGuid = {
-  0x45fdb42b, 0x1f95, 0x4a53, { 0x9b, 0xa4, 0x1c, 0x8b, 0xfb, 0x8b, 0xcb, 0x1 }
-};
-
-static EFI_GUID my_gDellPowerOffSmmGuid = {
-  0x46fcd5d8, 0xa9b3, 0x42e3, { 0x90, 0x4a, 0x1, 0x2f, 0x7, 0xbc, 0x5f, 0x5c }
-};
-
-static EFI_GUID my_gDellGpeGuid = {
-  0x4772c6da, 0x506d, 0x4c95, { 0xac, 0x17, 0xae, 0x66, 0x88, 0x5f, 0x6d, 0x53 }
-};
-
-static EFI_GUID my_gDellPasswordMgrSmmGuid = {
-  0x47b2138f, 0x5a6b, 0x4c65, { 0x91, 0x67, 0x87, 0x40, 0x59, 0x5d, 0x16, 0xad }
-};
-
-static EFI_GUID my_gDellSmmSbGpioControlGuid = {
-  0x47e83d0c, 0x2af4, 0x468d, { 0x91, 0x91, 0x9c, 0xe4, 0x68, 0xc1, 0x8e, 0x9e }
-};
-
-static EFI_GUID my_gDellRaidRomGuid = {
-  0x492261e4, 0x659, 0x424c, { 0x82, 0xb6, 0x73, 0x27, 0x43, 0x89, 0xe7, 0xa7 }
-};
-
-static EFI_GUID my_gDellSmmDispatcherGuid = {
-  0x4a37320b, 0x3fb3, 0x4365, { 0x97, 0x30, 0x9e, 0x89, 0xc6, 0x0, 0x39, 0x5d }
-};
-
-static EFI_GUID my_gDellDxeSioGpioControlGuid = {
-  0x4a64f200, 0xf99c, 0x42f3, { 0x80, 0xc7, 0xd, 0x91, 0xe2, 0xd3, 0xeb, 0x5d }
-};
-
-static EFI_GUID my_gDellVariableDxeGuid = {
-  0x4b87c89b, 0x39a9, 0x478f, { 0xa4, 0xb6, 0x81, 0x6a, 0x9e, 0xdc, 0x50, 0x87 }
-};
-
-static EFI_GUID my_gDellCpuSmmGuid = {
-  0x4e98a9fe, 0xdf5a, 0x4136, { 0xb9, 0x22, 0x4f, 0xb9, 0x70, 0xcb, 0xd7, 0x33 }
-};
-
-static EFI_GUID my_gDellChassisConfigSmmGuid = {
-  0x51d687c8, 0x196e, 0x4cfe, { 0x8a, 0xc, 0x83, 0x68, 0x98, 0xe, 0xa8, 0xb6 }
-};
-
-static EFI_GUID my_gDellSmmDelayGuid = {
-  0x52312cdf, 0xd4a9, 0x453e, { 0xa9, 0xdf, 0x9f, 0xda, 0xf5, 0x1c, 0xd6, 0x22 }
-};
-
-static EFI_GUID my_gDellSpiPartEonGuid = {
-  0x52a88b2a, 0x65fd, 0x4951, { 0x8b, 0x25, 0x6, 0xfb, 0x65, 0x98, 0x12, 0x8b }
-};
-
-static EFI_GUID my_gDellChassisConfigDxeGuid = {
-  0x54bd6a5d, 0x38f2, 0x44bd, { 0x84, 0xab, 0x10, 0x8b, 0xe4, 0xf4, 0x59, 0x14 }
-};
-
-static EFI_GUID my_gDellHiiparserDxeDriverGuid = {
-  0x55a267fc, 0x6607, 0x4023, { 0x88, 0x4e, 0x48, 0xe5, 0xd3, 0xd3, 0xf4, 0xe2 }
-};
-
-static EFI_GUID my_gDellBindingsDxeGuid = {
-  0x55bb5a4b, 0x3b3f, 0x442c, { 0xbf, 0x9, 0xf, 0x87, 0xa6, 0x7e, 0x8e, 0xe7 }
-};
-
-static EFI_GUID my_gDellHeciDxeGuid = {
-  0x55e76644, 0x78a5, 0x4a82, { 0xa9, 0x0, 0x71, 0x26, 0xa5, 0x79, 0x88, 0x92 }
-};
-
-static EFI_GUID my_gDellSmmBbsmanagerLegacyGuid = {
-  0x55f6a413, 0x280f, 0x41e3, { 0x93, 0x94, 0x65, 0x80, 0xf2, 0x9d, 0xd7, 0xd0 }
-};
-
-static EFI_GUID my_gDellGrasslakeConfigGuid = {
-  0x56eee346, 0x500c, 0x4936, { 0x95, 0x1a, 0x2d, 0xa5, 0xf0, 0xff, 0x39, 0xbb }
-};
-
-static EFI_GUID my_gDellIdeSmmGuid = {
-  0x571d1ed1, 0xc2d9, 0x418e, { 0x95, 0x3a, 0x24, 0x8e, 0xbc, 0x68, 0x70, 0x48 }
-};
-
-static EFI_GUID my_gDellPasswordMgrDxeGuid = {
-  0x57f435a8, 0x1c37, 0x4834, { 0xad, 0x61, 0xb0, 0x3d, 0x94, 0xdd, 0xce, 0xf3 }
-};
-
-static EFI_GUID my_gDellMeFwDowngradeGuid = {
-  0x5820eeb4, 0xc135, 0x4854, { 0x9d, 0x2a, 0xaa, 0x9e, 0xfc, 0x44, 0x75, 0xe9 }
-};
-
-static EFI_GUID my_gDellCsmConfigGuid = {
-  0x587e8797, 0xc2fb, 0x41b7, { 0xae, 0x9b, 0xf5, 0x3a, 0x6c, 0x56, 0x2d, 0xf5 }
-};
-
-static EFI_GUID my_gDellGpeOromGuid = {
-  0x58cdc779, 0xdc8c, 0x491b, { 0xba, 0xc3, 0xf8, 0x6e, 0x6, 0xd1, 0x86, 0x5f }
-};
-
-static EFI_GUID my_gDellSmBiosSmmDriverGuid = {
-  0x590915cc, 0x8622, 0x4d61, { 0xbe, 0x64, 0xc3, 0x3e, 0xe7, 0x60, 0x14, 0x1f }
-};
-
-static EFI_GUID my_gDellPchSmbusSmmGuid = {
-  0x59287178, 0x59b2, 0x49ca, { 0xbc, 0x63, 0x53, 0x2b, 0x12, 0xea, 0x2c, 0x53 }
-};
-
-static EFI_GUID my_gDellDashBiosManagerGuid = {
-  0x59378206, 0x861b, 0x4380, { 0xa3, 0x49, 0x2f, 0x2f, 0x4f, 0x3, 0xc, 0x4b }
-};
-
-static EFI_GUID my_gDellWdtDxeGuid = {
-  0x5aab83e5, 0xf027, 0x4ca7, { 0xbf, 0xd0, 0x16, 0x35, 0x8c, 0xc9, 0xe4, 0x53 }
-};
-
-static EFI_GUID my_gDellCoreDxeGuid = {
-  0x5ae3f37e, 0x4eae, 0x41ae, { 0x82, 0x40, 0x35, 0x46, 0x5b, 0x5e, 0x81, 0xeb }
-};
-
-static EFI_GUID my_gDellPasswordUiGuid = {
-  0x5d44be77, 0x5669, 0x41d0, { 0xb6, 0x85, 0x1b, 0xf3, 0xf8, 0x3e, 0xfb, 0x98 }
-};
-
-static EFI_GUID my_gDellHotSosSmmDriverGuid = {
-  0x5da9e544, 0xdc2d, 0x4670, { 0xa3, 0xd5, 0x98, 0x52, 0x36, 0xd5, 0xde, 0x45 }
-};
-
-static EFI_GUID my_gDellSioConfigDxeGuid = {
-  0x5db37e5c, 0x2eeb, 0x43f8, { 0xad, 0xa0, 0x24, 0x37, 0x2, 0xd3, 0x94, 0x5d }
-};
-
-static EFI_GUID my_gDellTcgDxeGuid = {
-  0x5e9caba3, 0xf2b1, 0x497a, { 0xad, 0xac, 0x24, 0xf5, 0x75, 0xe9, 0xcd, 0xe9 }
-};
-
-static EFI_GUID my_gDellAcpiConfigGuid = {
-  0x5eda3123, 0x840, 0x45f7, { 0xad, 0xab, 0x13, 0xa6, 0x55, 0xef, 0x3b, 0xb7 }
-};
-
-static EFI_GUID my_gDellFlashScreenDxeGuid = {
-  0x60ebdaa4, 0x1565, 0x4d9a, { 0x99, 0xc8, 0x88, 0xdf, 0xa6, 0x55, 0x49, 0xa5 }
-};
-
-static EFI_GUID my_gDellTxtDxeGuid = {
-  0x612e0d09, 0x5d11, 0x4516, { 0x82, 0xee, 0x6d, 0xd6, 0x5, 0xfe, 0x26, 0x5f }
-};
-
-static EFI_GUID my_gDellDiagsDxeDriverGuid = {
-  0x631b4df7, 0xbaea, 0x4c1f, { 0xa0, 0x61, 0x5b, 0x64, 0x62, 0x65, 0x28, 0x22 }
-};
-
-static EFI_GUID my_gDellFlashUpdateDxeGuid = {
-  0x6426c814, 0x601a, 0x4116, { 0x9e, 0x9f, 0xbf, 0x9d, 0x6f, 0x8f, 0x25, 0x4f }
-};
-
-static EFI_GUID my_gDellSmmGpeGuid = {
-  0x65e9eb9d, 0x812d, 0x4161, { 0x99, 0xc5, 0x5, 0xac, 0x4b, 0xcc, 0xa4, 0x94 }
-};
-
-static EFI_GUID my_gDellRtcAutoOnSmmGuid = {
-  0x67499f84, 0xf2e5, 0x4dd2, { 0x9e, 0x56, 0xc6, 0xe3, 0x89, 0xdd, 0x61, 0x73 }
-};
-
-static EFI_GUID my_gDellSmmFlashWriteProtectGuid = {
-  0x69ef78bc, 0x3b71, 0x4ecc, { 0x83, 0x4f, 0x3b, 0x74, 0xf9, 0x14, 0x84, 0x30 }
-};
-
-static EFI_GUID my_gDellDiagsConfigGuid = {
-  0x69f97a4e, 0x1395, 0x434a, { 0xa5, 0xd3, 0xff, 0x9c, 0xea, 0x28, 0x48, 0x85 }
-};
-
-static EFI_GUID my_gDellAudioConfigDxeGuid = {
-  0x6aa1a3cc, 0x52c4, 0x4b03, { 0x99, 0xf7, 0x28, 0x8f, 0x34, 0x5c, 0x1d, 0xb3 }
-};
-
-static EFI_GUID my_gDellSpecialBootStubGuid = {
-  0x6b287864, 0x759c, 0x42c4, { 0xb4, 0x35, 0xa7, 0x4a, 0xb6, 0x94, 0xcd, 0x3b }
-};
-
-static EFI_GUID my_gDellDaServiceTagGuid = {
-  0x6e8cd2b7, 0xb636, 0x4859, { 0x85, 0xed, 0xc6, 0x37, 0xbd, 0xca, 0x59, 0x19 }
-};
-
-static EFI_GUID my_gDellDxeSbAcpiGuid = {
-  0x6e97d4f4, 0x1898, 0x4408, { 0xa6, 0x2d, 0x99, 0xca, 0xde, 0xd3, 0x2f, 0xd8 }
-};
-
-static EFI_GUID my_gDellMonotonicCounterSmmGuid = {
-  0x7122810d, 0xccd3, 0x4b09, { 0xa0, 0xab, 0x8d, 0x10, 0x76, 0x45, 0xc9, 0x78 }
-};
-
-static EFI_GUID my_gDellSmmSbGenericGuid = {
-  0x71287108, 0xbf58, 0x41ea, { 0xb7, 0x1c, 0xb3, 0x62, 0x2d, 0xeb, 0xca, 0x9d }
-};
-
-static EFI_GUID my_gDellAcpiModeEnableGuid = {
-  0x750890a6, 0x7acf, 0x4f4f, { 0x81, 0xbd, 0xb4, 0x0, 0xc2, 0xbe, 0xa9, 0x5a }
-};
-
-static EFI_GUID my_gDellSmmSioEmiGuid = {
-  0x758880ab, 0x4ca2, 0x4daa, { 0xa8, 0x3e, 0xd1, 0xf9, 0xad, 0xf2, 0xc2, 0xf1 }
-};
-
-static EFI_GUID my_gDellPstateControlGuid = {
-  0x75be667c, 0x48e1, 0x452d, { 0xb0, 0xfc, 0x36, 0x31, 0x38, 0xed, 0x87, 0xff }
-};
-
-static EFI_GUID my_gDellDaEppidGuid = {
-  0x76a1df7d, 0x754c, 0x40e1, { 0xbc, 0x72, 0x3f, 0xca, 0xd8, 0x42, 0xde, 0xf6 }
-};
-
-static EFI_GUID my_gDellProgressBarGuid = {
-  0x76be1abf, 0x1e1e, 0x321d, { 0xb7, 0xf0, 0x9e, 0x9, 0x84, 0xfd, 0xda, 0xbc }
-};
-
-static EFI_GUID my_gDellPbaMgrSmmGuid = {
-  0x76e1e9ee, 0x5fc7, 0x4613, { 0xb9, 0x6f, 0xfa, 0x79, 0x77, 0x96, 0x57, 0x3a }
-};
-
-static EFI_GUID my_gDellAmtSetupGuid = {
-  0x773cb08b, 0x511a, 0x4bd5, { 0x85, 0xad, 0x41, 0xd4, 0xf4, 0xb6, 0x4a, 0x52 }
-};
-
-static EFI_GUID my_gDellStorageAgentsDxeGuid = {
-  0x7808f5c2, 0x9cb0, 0x4609, { 0x90, 0x7f, 0xb1, 0x84, 0x53, 0xc3, 0x63, 0xb4 }
-};
-
-static EFI_GUID my_gDellVariableRuntimeDxeGuid = {
-  0x787d4843, 0x68ac, 0x4c28, { 0xbe, 0x53, 0xba, 0xc2, 0x72, 0xba, 0xec, 0xf9 }
-};
-
-static EFI_GUID my_gDellPbaScardDxeGuid = {
-  0x79e39a83, 0xd013, 0x4b2e, { 0x83, 0x6a, 0xa9, 0x9a, 0x71, 0x47, 0x35, 0x1c }
-};
-
-static EFI_GUID my_gDellSolPostMessageGuid = {
-  0x7a08cb98, 0xe9bc, 0x41c3, { 0xbe, 0x19, 0xb3, 0x2, 0xf3, 0xf1, 0xf5, 0x23 }
-};
-
-static EFI_GUID my_gDellTerminalGuid = {
-  0x7a08cb98, 0xe9bc, 0x41c3, { 0xbe, 0x19, 0xb3, 0x2, 0xf3, 0xf1, 0xf5, 0x95 }
-};
-
-static EFI_GUID my_gDellSmBiosStrucD0Guid = {
-  0x7bbb9525, 0x97ba, 0x4516, { 0xb6, 0x60, 0x1b, 0xe, 0xb7, 0x87, 0x44, 0xa5 }
-};
-
-static EFI_GUID my_gDellSmmRuntimeGuid = {
-  0x7c79ac8c, 0x5e6c, 0x4e3d, { 0xba, 0x6f, 0xc2, 0x60, 0xee, 0x7c, 0x17, 0x2e }
-};
-
-static EFI_GUID my_gDellFlashIoSmmGuid = {
-  0x7cb919c8, 0xd499, 0x4629, { 0xac, 0xb3, 0x22, 0x76, 0x9e, 0x34, 0x3d, 0xdb }
-};
-
-static EFI_GUID my_gDellSystemPwSmmGuid = {
-  0x80aadd0d, 0x8053, 0x4ba7, { 0x94, 0x1b, 0x36, 0xf4, 0x8b, 0xb2, 0x30, 0x1 }
-};
-
-static EFI_GUID my_gDellPciRootBridgeGuid = {
-  0x80e66e0a, 0xccd1, 0x43fa, { 0xa7, 0xb1, 0x2d, 0x5e, 0xe0, 0xf1, 0x39, 0x10 }
-};
-
-static EFI_GUID my_gDellPowerOffConfigGuid = {
-  0x80f03c1f, 0x89bd, 0x4240, { 0x93, 0xa8, 0xac, 0x99, 0xe9, 0xa9, 0x29, 0xfc }
-};
-
-static EFI_GUID my_gDellDxeHwmDriverGuid = {
-  0x82833414, 0xc8f4, 0x4b62, { 0xab, 0x6a, 0xe4, 0xd5, 0xda, 0xab, 0x13, 0xf }
-};
-
-static EFI_GUID my_gDellPxeUndiRomGuid = {
-  0x82fbe26b, 0x53d4, 0x448f, { 0x92, 0x4c, 0x7b, 0xe0, 0x12, 0x6e, 0xca, 0x4f }
-};
-
-static EFI_GUID my_gDellPwByPassSmmGuid = {
-  0x83b698b9, 0x208, 0x4ecf, { 0xbb, 0x83, 0xce, 0x42, 0xd0, 0xbe, 0xfc, 0x4a }
-};
-
-static EFI_GUID my_gDellHotKeyHandlerSmmGuid = {
-  0x8467c103, 0x6ff6, 0x4d66, { 0x86, 0xf6, 0xe1, 0x12, 0x4c, 0x11, 0x1e, 0x94 }
-};
-
-static EFI_GUID my_gDellPowerManagementDxeGuid = {
-  0x84991287, 0x3ff0, 0x4fcc, { 0x9c, 0x11, 0xc7, 0xe0, 0x41, 0x86, 0x2c, 0x76 }
-};
-
-static EFI_GUID my_gDellAcRecoverySmmGuid = {
-  0x858189ac, 0xeca, 0x4666, { 0xba, 0xb8, 0x99, 0x72, 0x40, 0x99, 0x53, 0xc8 }
-};
-
-static EFI_GUID my_gDellSmmSioDashGuid = {
-  0x87c73c1c, 0x1529, 0x4ef5, { 0xa3, 0xfa, 0x8, 0xd7, 0x3e, 0xf8, 0xc8, 0x27 }
-};
-
-static EFI_GUID my_gDellSmmEventDxeGuid = {
-  0x88d01bb9, 0x247a, 0x46f6, { 0xbb, 0x6e, 0xbb, 0xa4, 0x9f, 0x11, 0x24, 0xf8 }
-};
-
-static EFI_GUID my_gDellSetupPrepGuid = {
-  0x899407d7, 0x99fe, 0x43d8, { 0x9a, 0x21, 0x79, 0xec, 0x32, 0x8c, 0xac, 0x21 }
-};
-
-static EFI_GUID my_gDellDxePrereqGuid = {
-  0x89bf244f, 0xe569, 0x416f, { 0xb1, 0x10, 0x8a, 0xe5, 0xef, 0xd5, 0x17, 0x1c }
-};
-
-static EFI_GUID my_gDellSpiPartStMicroGuid = {
-  0x8a9f7cfc, 0x5bfc, 0x458f, { 0x98, 0x6f, 0xbc, 0x3d, 0x1b, 0xa7, 0xac, 0x89 }
-};
-
-static EFI_GUID my_gDellDiagsLegacyGuid = {
-  0x8b529353, 0x1fcc, 0x4ac0, { 0xa1, 0x21, 0x90, 0xbe, 0x9f, 0x9c, 0xbf, 0x7a }
-};
-
-static EFI_GUID my_gDellAcpiPlatformGuid = {
-  0x8b5fbabd, 0xf51f, 0x4942, { 0xbf, 0x16, 0x16, 0xaa, 0xa3, 0x8a, 0xe5, 0x2b }
-};
-
-static EFI_GUID my_gDellPowerManagementGuid = {
-  0x8c783970, 0xf02a, 0x4a4d, { 0xaf, 0x9, 0x87, 0x97, 0xa5, 0x1e, 0xec, 0x8d }
-};
-
-static EFI_GUID my_gDellAhciSmmGuid = {
-  0xbc3245bd, 0xb982, 0x4f55, { 0x9f, 0x79, 0x5, 0x6a, 0xd7, 0xe9, 0x87, 0xc5 }
-};
-
-static EFI_GUID my_gDellMePlatformConfigDxeGuid = {
-  0x8d32716a, 0x60df, 0x4bde, { 0x86, 0x47, 0x3d, 0x17, 0x8c, 0xc8, 0x2b, 0x6c }
-};
-
-static EFI_GUID my_gDellPciHostBridgeGuid = {
-  0x8d6756b9, 0xe55e, 0x4d6a, { 0xa3, 0xa5, 0x5e, 0x4d, 0x72, 0xdd, 0xf7, 0x72 }
-};
-
-static EFI_GUID my_gDellSmmServicesGuid = {
-  0x8dce1957, 0xd774, 0x4fda, { 0xb9, 0xf, 0xb, 0x23, 0x1c, 0xb2, 0xe0, 0xcc }
-};
-
-static EFI_GUID my_gDellModBayConfigGuid = {
-  0x8e201427, 0x463a, 0x4d24, { 0xa0, 0xf4, 0x25, 0xa8, 0x75, 0xf6, 0x1b, 0xaa }
-};
-
-static EFI_GUID my_gDellServiceResetSmmGuid = {
-  0x8ec38829, 0xa59f, 0x40e3, { 0xba, 0xd0, 0x85, 0xf8, 0x15, 0xa1, 0x57, 0xd1 }
-};
-
-static EFI_GUID my_gDellEcConfigDxeGuid = {
-  0x8ec40fb3, 0x4205, 0x4d57, { 0x90, 0x39, 0xa1, 0x92, 0x83, 0x2c, 0x7c, 0xed }
-};
-
-static EFI_GUID my_gDellErrorHandlerDxeGuid = {
-  0x8f439d8b, 0x7b2, 0x4121, { 0xaa, 0x95, 0x8a, 0xc9, 0x15, 0x71, 0xaa, 0x75 }
-};
-
-static EFI_GUID my_gDellDefaultBootListDxeGuid = {
-  0x8f439d8b, 0x7b2, 0x4121, { 0xaa, 0x95, 0x8a, 0xc9, 0x15, 0x71, 0xff, 0xff }
-};
-
-static EFI_GUID my_gDellAhcisrcGuid = {
-  0x8f5a2e02, 0x538c, 0x4d59, { 0xb9, 0x20, 0xc4, 0x78, 0x6a, 0xcb, 0xc5, 0x52 }
-};
-
-static EFI_GUID my_gDellSbAccessSmmGuid = {
-  0x8fb82da4, 0xc3be, 0x42a6, { 0x8a, 0x70, 0x7b, 0x94, 0xd6, 0x9, 0x72, 0xa6 }
-};
-
-static EFI_GUID my_gDellImgSrvBaseRomGuid = {
-  0x903718f3, 0x575d, 0x4d9c, { 0xbc, 0x78, 0x65, 0xa1, 0x13, 0x81, 0xa0, 0x26 }
-};
-
-static EFI_GUID my_gDellSmartTimerGuid = {
-  0x90cb75db, 0x71fc, 0x489d, { 0xaa, 0xcf, 0x94, 0x34, 0x77, 0xec, 0x72, 0x12 }
-};
-
-static EFI_GUID my_gDellPbaFpDxeGuid = {
-  0x91ba201e, 0x1621, 0x46fc, { 0x82, 0x5a, 0xb0, 0x36, 0x3e, 0xca, 0xd4, 0xbc }
-};
-
-static EFI_GUID my_gDellHeciSmmGuid = {
-  0x921cd783, 0x3e22, 0x4579, { 0xa7, 0x1f, 0x0, 0xd7, 0x41, 0x97, 0xfc, 0xc8 }
-};
-
-static EFI_GUID my_gDellSmmComputraceGuid = {
-  0x92c78e4e, 0xc994, 0x4f9e, { 0x82, 0xab, 0xaf, 0x1d, 0xba, 0x68, 0x58, 0xc9 }
-};
-
-static EFI_GUID my_gDellFileSystemGuid = {
-  0x93022f8c, 0x1f09, 0x47ef, { 0xbb, 0xb2, 0x58, 0x14, 0xff, 0x60, 0x9d, 0xf5 }
-};
-
-static EFI_GUID my_gDellDirtyShutdownDxeGuid = {
-  0x937710d0, 0xef10, 0x42be, { 0x92, 0xe1, 0x84, 0x94, 0x72, 0x2b, 0x17, 0xb5 }
-};
-
-static EFI_GUID my_gDellSbAcpiConfigGuid = {
-  0x94925fb1, 0xeef4, 0x41ed, { 0xbd, 0x7a, 0xcd, 0xb0, 0x4a, 0xaa, 0x81, 0xc7 }
-};
-
-static EFI_GUID my_gDellTcgSetupGuid = {
-  0x94edd12a, 0x419b, 0x447f, { 0x94, 0x34, 0x9b, 0x3b, 0x70, 0x78, 0x39, 0x3 }
-};
-
-static EFI_GUID my_gDellServiceResetDxeGuid = {
-  0x973be267, 0x960, 0x40c7, { 0x98, 0x56, 0xfa, 0x73, 0xc9, 0x2a, 0x46, 0xba }
-};
-
-static EFI_GUID my_gDellBiosExtensionLoaderGuid = {
-  0x97cc7188, 0x79c9, 0x449f, { 0xb9, 0x69, 0x6, 0x5b, 0x64, 0xbf, 0x9c, 0x69 }
-};
-
-static EFI_GUID my_gDellHotSosDxeDriverGuid = {
-  0x98d8a754, 0x8482, 0x46e2, { 0x82, 0x8c, 0xbb, 0x63, 0x2f, 0x34, 0xd9, 0xf7 }
-};
-
-static EFI_GUID my_gDellSmBiosStrucDeGuid = {
-  0x995d96c1, 0x6651, 0x46b0, { 0xbf, 0x3e, 0x83, 0xc0, 0x17, 0xb4, 0x3b, 0x1d }
-};
-
-static EFI_GUID my_gDellSbSmmHooksGuid = {
-  0x99a1e3f5, 0x887, 0x43c7, { 0xb0, 0xa, 0xf1, 0x4a, 0x64, 0x6b, 0xc1, 0x42 }
-};
-
-static EFI_GUID my_gDellBbsmanagerDxeGuid = {
-  0x9ab332ef, 0x81d9, 0x43d1, { 0x86, 0x7a, 0x3, 0xdd, 0x57, 0x4e, 0x85, 0x66 }
-};
-
-static EFI_GUID my_gDellGsetConfigGuid = {
-  0x9af1da25, 0xf06c, 0x43bb, { 0xbe, 0x88, 0x83, 0x45, 0x50, 0xbf, 0x76, 0x5b }
-};
-
-static EFI_GUID my_gDellMultiDisplayDxeGuid = {
-  0x9bff300d, 0xd647, 0x480e, { 0x9f, 0xf3, 0x20, 0x6, 0xd3, 0xd7, 0xcc, 0xc6 }
-};
-
-static EFI_GUID my_gDellAmiBoardInfoGuid = {
-  0x9f3a0016, 0xae55, 0x4288, { 0x82, 0x9d, 0xd2, 0x2f, 0xd3, 0x44, 0xc3, 0x47 }
-};
-
-static EFI_GUID my_gDellDaNonVolitileStorageGuid = {
-  0x9fb63bf9, 0xb522, 0x4203, { 0x9a, 0x53, 0x20, 0xec, 0x85, 0x4a, 0x31, 0x2a }
-};
-
-static EFI_GUID my_gDellDxeMainGuid = {
-  0x9fcfd3ee, 0x38c3, 0x4aaf, { 0x95, 0x12, 0xec, 0x41, 0x63, 0x71, 0xf6, 0x4a }
-};
-
-static EFI_GUID my_gDellSioPolicyConfigDxeGuid = {
-  0xa041b8d6, 0x3f17, 0x4582, { 0xaa, 0xc7, 0x5a, 0x61, 0x56, 0x72, 0xe2, 0x95 }
-};
-
-static EFI_GUID my_gDellCsmcoreGuid = {
-  0xa062cf1f, 0x8473, 0x4aa3, { 0x87, 0x93, 0x60, 0xb, 0xc4, 0xff, 0xe9, 0xa8 }
-};
-
-static EFI_GUID my_gDellHddPwSmmGuid = {
-  0xa0b87e92, 0x6392, 0x47fe, { 0x9a, 0xa0, 0x90, 0x20, 0x31, 0x47, 0xec, 0x4 }
-};
-
-static EFI_GUID my_gDellSmmControlGuid = {
-  0xa0bad9f7, 0xab78, 0x491b, { 0xb5, 0x83, 0xc5, 0x2b, 0x7f, 0x84, 0xb9, 0xe0 }
-};
-
-static EFI_GUID my_gDellPciExpressDxeGuid = {
-  0xa19fb0ee, 0x5f4, 0x4cd6, { 0x8f, 0x28, 0x59, 0xb7, 0x82, 0xff, 0x95, 0xc6 }
-};
-
-static EFI_GUID my_gDellSpiPartSstGuid = {
-  0xa287558b, 0xd9dd, 0x461b, { 0xa9, 0x29, 0xec, 0x2a, 0xd2, 0xfe, 0xf5, 0x91 }
-};
-
-static EFI_GUID my_gDellSpiControllerDxeGuid = {
-  0xa37a9e43, 0x9077, 0x4539, { 0x9b, 0x90, 0xbd, 0x71, 0x9b, 0x3, 0x2b, 0x23 }
-};
-
-static EFI_GUID my_gDellSmbFactDefaultGuid = {
-  0xa3d93a29, 0x501b, 0x4f6e, { 0x86, 0x9a, 0x6f, 0xd4, 0xbc, 0xef, 0x90, 0xa7 }
-};
-
-static EFI_GUID my_gDellSmmSioGpioControlGuid = {
-  0xa74b3aef, 0x2502, 0x40c5, { 0x83, 0xa9, 0x35, 0x24, 0x77, 0x62, 0x73, 0xea }
-};
-
-static EFI_GUID my_gDellImageServerSmmGuid = {
-  0xa79dc347, 0xdeb4, 0x4a4e, { 0x84, 0x97, 0xca, 0x5f, 0x8e, 0x7f, 0x6, 0x1 }
-};
-
-static EFI_GUID my_gDellPbaMgrDxeGuid = {
-  0xa7b36dcf, 0xc75a, 0x4be8, { 0xbe, 0x2f, 0xe4, 0x84, 0xc, 0xbe, 0x16, 0x3b }
-};
-
-static EFI_GUID my_gDellImageServerDxeGuid = {
-  0xa833441a, 0xca0, 0x4032, { 0x85, 0x9a, 0x3c, 0xff, 0x7b, 0x66, 0x46, 0xa7 }
-};
-
-static EFI_GUID my_gDellLomConfigGuid = {
-  0xa8752510, 0xd83e, 0x400a, { 0x85, 0xde, 0xfd, 0x15, 0x87, 0x88, 0x2a, 0xfe }
-};
-
-static EFI_GUID my_gDellLegacyUsbSmmGuid = {
-  0xa8a2f6e1, 0x6f62, 0x4cfb, { 0x9e, 0x47, 0x93, 0xcf, 0xd6, 0xd6, 0xe4, 0x76 }
-};
-
-static EFI_GUID my_gDellAmtSmbiosGuid = {
-  0xa8c67255, 0xe029, 0x4b1a, { 0x96, 0x8e, 0xec, 0xa6, 0xe9, 0xc1, 0x1c, 0x73 }
-};
-
-static EFI_GUID my_gDellTcgMorGuid = {
-  0xad416ce3, 0xa483, 0x45b1, { 0x94, 0xc2, 0x4b, 0x4e, 0x4d, 0x57, 0x55, 0x62 }
-};
-
-static EFI_GUID my_gDellDoSiodiagLedDxeGuid = {
-  0xad4a0d05, 0x806d, 0x4fe4, { 0x96, 0xad, 0x3b, 0xd6, 0x2d, 0x8c, 0x4c, 0xe0 }
-};
-
-static EFI_GUID my_gDellAudioDxeGuid = {
-  0xae24851d, 0xe414, 0x4062, { 0x95, 0x9d, 0x5f, 0x43, 0xea, 0x99, 0x36, 0x3c }
-};
-
-static EFI_GUID my_gDellFvMainnestedGuid = {
-  0xae717c2f, 0x1a42, 0x4f2b, { 0x88, 0x61, 0x78, 0xb7, 0x9c, 0xa0, 0x7e, 0x7 }
-};
-
-static EFI_GUID my_gDellSmmCryptoAlgorithmGuid = {
-  0xafe751c5, 0x5d4, 0x4898, { 0xbf, 0x94, 0x1a, 0x4b, 0x50, 0xf3, 0x5f, 0xd4 }
-};
-
-static EFI_GUID my_gDellPchSmiDispatcherGuid = {
-  0xb0d6ed53, 0xb844, 0x43f5, { 0xbd, 0x2f, 0x61, 0x9, 0x52, 0x64, 0xe7, 0x7e }
-};
-
-static EFI_GUID my_gDellSmbios64Guid = {
-  0xb13edd38, 0x684c, 0x41ed, { 0xa3, 0x5, 0xd7, 0xb7, 0xe3, 0x24, 0x97, 0xdf }
-};
-
-static EFI_GUID my_gDellAmitseGuid = {
-  0xb1da0adf, 0x4f77, 0x4070, { 0xa8, 0x8e, 0xbf, 0xfe, 0x1c, 0x60, 0x52, 0x9a }
-};
-
-static EFI_GUID my_gDellDxeDelayGuid = {
-  0xb4186561, 0x8967, 0x4113, { 0xbc, 0x5f, 0x28, 0x4b, 0x76, 0x70, 0xc4, 0xa0 }
-};
-
-static EFI_GUID my_gDellLegUsbMemInfoDxeGuid = {
-  0xb45b5fc4, 0xd6a6, 0x4523, { 0xa2, 0x29, 0xe7, 0x77, 0x20, 0x97, 0xef, 0x14 }
-};
-
-static EFI_GUID my_gDellSecurityConfigGuid = {
-  0xb71ecd12, 0xe01e, 0x440b, { 0xaa, 0x52, 0x4d, 0x6e, 0x59, 0xd4, 0x5b, 0x3c }
-};
-
-static EFI_GUID my_gDellSmbVersionManifestGuid = {
-  0xb941cf11, 0xe648, 0x401c, { 0x92, 0xa1, 0x34, 0x2a, 0x70, 0xc6, 0xb7, 0x42 }
-};
-
-static EFI_GUID my_gDellSmbiosupdateDataGuid = {
-  0xb98999a4, 0xe96f, 0x475a, { 0x99, 0xfc, 0x76, 0x21, 0x26, 0xf5, 0xf, 0x5a }
-};
-
-static EFI_GUID my_gDellPchResetGuid = {
-  0xbb1fbd4f, 0x2e30, 0x4793, { 0x9b, 0xed, 0x74, 0xf6, 0x72, 0xbc, 0x8f, 0xfe }
-};
-
-static EFI_GUID my_gDellSataControllerGuid = {
-  0xbb65942b, 0x521f, 0x4ec3, { 0xba, 0xf9, 0xa9, 0x25, 0x40, 0xcf, 0x60, 0xd2 }
-};
-
-static EFI_GUID my_gDellAlertStandardFormatSmmGuid = {
-  0xbb87b31d, 0xf366, 0x47e9, { 0x88, 0x5e, 0xe8, 0x16, 0xb0, 0x9b, 0x97, 0xb6 }
-};
-
-static EFI_GUID my_gDellDaTaaMacGuid = {
-  0xbcabb6dd, 0x3e9f, 0x47e2, { 0xb8, 0xfb, 0x10, 0xb3, 0x9a, 0xf6, 0x34, 0x2c }
-};
-
-static EFI_GUID my_gDellHotKeyHandlerDxeGuid = {
-  0xbcbb3912, 0x29fa, 0x4b25, { 0xb6, 0x19, 0x3c, 0xd, 0x73, 0x9f, 0xef, 0x51 }
-};
-
-static EFI_GUID my_gDellCmosManagerDxeSrcGuid = {
-  0xbd45a258, 0xc7bd, 0x4bf0, { 0xb2, 0x54, 0xd0, 0xd4, 0x5e, 0x2, 0xf8, 0x77 }
-};
-
-static EFI_GUID my_gDellDxeGpioControlGuid = {
-  0xbdcbb03c, 0x545e, 0x43c1, { 0x8a, 0xa8, 0xf0, 0x58, 0xc4, 0xfa, 0x81, 0xa8 }
-};
-
-static EFI_GUID my_gDellDtLegUsbPolicyGuid = {
-  0xbde92229, 0xf9a5, 0x4897, { 0x81, 0xe4, 0x8b, 0xab, 0x67, 0x92, 0xa3, 0x95 }
-};
-
-static EFI_GUID my_gDellPxeBaseRomGuid = {
-  0xbdfaad26, 0x4d7f, 0x44a6, { 0x87, 0x19, 0x37, 0x5e, 0xcb, 0x4a, 0xa4, 0x7 }
-};
-
-static EFI_GUID my_gDellSmiVariableGuid = {
-  0xbe216ba8, 0x38c4, 0x4535, { 0xa6, 0xca, 0x5d, 0xca, 0x5b, 0x43, 0xad, 0xdf }
-};
-
-static EFI_GUID my_gDellPowerButtonDxeGuid = {
-  0xbf27a268, 0xf369, 0x43a2, { 0xb2, 0x95, 0x24, 0x2d, 0xee, 0x7f, 0x3c, 0x29 }
-};
-
-static EFI_GUID my_gDellActiveBiosGuid = {
-  0xbfd59d42, 0xfe0f, 0x4251, { 0xb7, 0x72, 0x4b, 0x9, 0x8a, 0x1a, 0xec, 0x85 }
-};
-
-static EFI_GUID my_gDellD010AlegacyVideoRomGuid = {
-  0xc0b9206e, 0xb6ab, 0x4df0, { 0xb3, 0xd6, 0x28, 0x6a, 0xc7, 0x66, 0x98, 0xbd }
-};
-
-static EFI_GUID my_gDellSmmDiagLedsGuid = {
-  0xc10a9e4d, 0xbdb4, 0x4b1a, { 0x82, 0xcc, 0xd9, 0x1, 0xf8, 0x6f, 0x57, 0x39 }
-};
-
-static EFI_GUID my_gDellFlashWriteProtectGuid = {
-  0xc1443436, 0xb954, 0x43ba, { 0x82, 0x78, 0xc1, 0xe4, 0x42, 0xc2, 0x15, 0x39 }
-};
-
-static EFI_GUID my_gDellLegacyInterruptGuid = {
-  0xc1c418f9, 0x591d, 0x461c, { 0x82, 0xa2, 0xb9, 0xcd, 0x96, 0xdf, 0xea, 0x86 }
-};
-
-static EFI_GUID my_gDellSaveMemoryConfigDxeGuid = {
-  0xc41459c2, 0xa281, 0x40d3, { 0xb3, 0xa, 0x2b, 0x9d, 0xff, 0x3f, 0x3d, 0xa0 }
-};
-
-static EFI_GUID my_gDellSpiPartWinbondGuid = {
-  0xc4331752, 0x8bac, 0x4f2a, { 0xa9, 0xc3, 0x41, 0x8a, 0xdf, 0xb0, 0x33, 0xc4 }
-};
-
-static EFI_GUID my_gDellDaAssetTagGuid = {
-  0xc4c7a1a9, 0xd639, 0x442d, { 0xb3, 0x58, 0x9, 0xd0, 0x6a, 0xe1, 0x8b, 0xfc }
-};
-
-static EFI_GUID my_gDellIdeRcontrollerGuid = {
-  0xc4f2d007, 0x37fd, 0x422d, { 0xb6, 0x3d, 0x7e, 0xd7, 0x38, 0x86, 0xe6, 0xca }
-};
-
-static EFI_GUID my_gDellPbaUshGuid = {
-  0xc65af0e1, 0x82b3, 0x416a, { 0x8f, 0xa, 0xdd, 0xd0, 0xd3, 0x9, 0x8c, 0x58 }
-};
-
-static EFI_GUID my_gDellLegacyTcgSupportGuid = {
-  0xc67cba49, 0xb3c6, 0x4cba, { 0x96, 0x71, 0xbf, 0x27, 0x88, 0x71, 0x21, 0x28 }
-};
-
-static EFI_GUID my_gDellSmbStrucB2ConfigGuid = {
-  0xc7b11f3c, 0x89e9, 0x445f, { 0xa9, 0x72, 0x67, 0x1b, 0x8b, 0x17, 0x58, 0xd }
-};
-
-static EFI_GUID my_gDellTdtAmGuid = {
-  0xc810485e, 0xd0ec, 0x4e98, { 0xaa, 0xb5, 0x12, 0xc, 0x7e, 0x55, 0x44, 0x28 }
-};
-
-static EFI_GUID my_gDellHotKeysConfigGuid = {
-  0xc86181cd, 0xb38c, 0x49dd, { 0xa1, 0x76, 0x7d, 0xc3, 0x59, 0x18, 0x16, 0xa9 }
-};
-
-static EFI_GUID my_gDellSmmEventSmmGuid = {
-  0xc87dbb18, 0x9add, 0x41d5, { 0x80, 0xd7, 0x4c, 0x8d, 0x79, 0x5a, 0xd9, 0x42 }
-};
-
-static EFI_GUID my_gDellDashConfigGuid = {
-  0xc89cec07, 0xc4ee, 0x440c, { 0xbf, 0xc5, 0xa2, 0x2f, 0x43, 0x37, 0x2f, 0x22 }
-};
-
-static EFI_GUID my_gDellSmmMultiPlatformGuid = {
-  0xc9d9ce44, 0x708d, 0x4e27, { 0xb9, 0x89, 0xe3, 0x5a, 0x33, 0x99, 0x9c, 0x28 }
-};
-
-static EFI_GUID my_gDellRuntimeGuid = {
-  0xcbc59c4a, 0x383a, 0x41eb, { 0xa8, 0xee, 0x44, 0x98, 0xae, 0xa5, 0x67, 0xe4 }
-};
-
-static EFI_GUID my_gDellSmBiosStrucD2Guid = {
-  0xcccc8702, 0xbd68, 0x45b1, { 0x82, 0x37, 0xc7, 0xdd, 0x0, 0x4c, 0xdb, 0x37 }
-};
-
-static EFI_GUID my_gDellCspLibDxeGuid = {
-  0xcd84562c, 0x6864, 0x40a3, { 0xa0, 0x81, 0xc8, 0xd3, 0x5e, 0x82, 0xb9, 0x20 }
-};
-
-static EFI_GUID my_gDellTcgSmmGuid = {
-  0xcdc11ae9, 0x1e7, 0x42cb, { 0x88, 0xeb, 0xfd, 0xff, 0xd8, 0x81, 0x98, 0x93 }
-};
-
-static EFI_GUID my_gDellSmbiosBoardGuid = {
-  0xcef68c66, 0x6ab, 0x4fb3, { 0xa3, 0xed, 0x5f, 0xfa, 0x88, 0x5b, 0x57, 0x25 }
-};
-
-static EFI_GUID my_gDellSmmBaseGuid = {
-  0xd0632c90, 0xafd7, 0x4492, { 0xb1, 0x86, 0x25, 0x7c, 0x63, 0x14, 0x3c, 0x61 }
-};
-
-static EFI_GUID my_gDellSlpMarkerCtrlGuid = {
-  0xd15170be, 0xd512, 0x4894, { 0xb8, 0x63, 0x9d, 0xe, 0x6f, 0xf5, 0xc5, 0x61 }
-};
-
-static EFI_GUID my_gDellThrottlingDriverGuid = {
-  0xd472ab34, 0x8e21, 0x4343, { 0x8b, 0xff, 0x1, 0xec, 0xde, 0x29, 0x23, 0x75 }
-};
-
-static EFI_GUID my_gDellTerminalPlatformPolicyGuid = {
-  0xd4a79a0d, 0xb67d, 0x4e83, { 0x8e, 0xfb, 0x45, 0x59, 0x24, 0x37, 0x29, 0x34 }
-};
-
-static EFI_GUID my_gDellDiagsSmmGuid = {
-  0xd4b61940, 0x73ab, 0x48a5, { 0x9e, 0x26, 0x53, 0xa4, 0xca, 0x4a, 0x2c, 0x37 }
-};
-
-static EFI_GUID my_gDellHddSmartSmmGuid = {
-  0xd61b6c7a, 0x653a, 0x45a9, { 0x8a, 0xf3, 0x63, 0xa8, 0xa5, 0x7, 0x66, 0x39 }
-};
-
-static EFI_GUID my_gDellPchPolicyInitDxeGuid = {
-  0xd6ac4ac2, 0x8bc2, 0x4cdd, { 0x87, 0x76, 0x28, 0xe, 0x14, 0x69, 0xde, 0x2 }
-};
-
-static EFI_GUID my_gDellNbConfigDxeGuid = {
-  0xd700e3bc, 0x4291, 0x4749, { 0x87, 0xaf, 0x43, 0x2a, 0x2, 0x3d, 0xe6, 0x58 }
-};
-
-static EFI_GUID my_gDellIAmtdxeGuid = {
-  0xd739f969, 0xfb2d, 0x4bc2, { 0xaf, 0xe7, 0x8, 0x13, 0x27, 0xd3, 0xfe, 0xde }
-};
-
-static EFI_GUID my_gDellAmtWrapperDxeGuid = {
-  0xd77c900d, 0xa1c7, 0x41c5, { 0xb9, 0x89, 0xc, 0x3d, 0x37, 0xfc, 0xa4, 0x32 }
-};
-
-static EFI_GUID my_gDellPhysicalPresenceGuid = {
-  0xd85a4a0c, 0x2e73, 0x4491, { 0x92, 0xe1, 0xdc, 0xef, 0xc3, 0x88, 0x2a, 0x68 }
-};
-
-static EFI_GUID my_gDellSmmGpioControlGuid = {
-  0xd9389efa, 0x2c9a, 0x4696, { 0x8b, 0xb6, 0xfc, 0x5f, 0x39, 0x8d, 0x8d, 0xf3 }
-};
-
-static EFI_GUID my_gDellSmBiosStrucD9Guid = {
-  0xd9cd0aa0, 0xc20f, 0x4810, { 0x99, 0x9e, 0xd9, 0x91, 0xfd, 0x4, 0x84, 0xd9 }
-};
-
-static EFI_GUID my_gDellStorageAgentsSmmGuid = {
-  0xda451af6, 0x88d1, 0x4fd7, { 0xb8, 0x6e, 0x44, 0xbc, 0x47, 0xee, 0x1f, 0x7e }
-};
-
-static EFI_GUID my_gDellSmbBbsInfoGuid = {
-  0xdc7063fc, 0xe01d, 0x476f, { 0x9b, 0xf3, 0xde, 0x1, 0x8, 0x84, 0xbc, 0x53 }
-};
-
-static EFI_GUID my_gDellSmBiosStrucB2Guid = {
-  0xdc9cace8, 0x8c2e, 0x4fe7, { 0x9e, 0x41, 0xe1, 0x8c, 0x75, 0xfe, 0x9b, 0x66 }
-};
-
-static EFI_GUID my_gDellTdtDxeGuid = {
-  0xdcaa4b60, 0x408f, 0x4bad, { 0x99, 0xb9, 0xb8, 0x80, 0xd4, 0xef, 0x9, 0x50 }
-};
-
-static EFI_GUID my_gDellSaInitDxeGuid = {
-  0xde23acee, 0xcf55, 0x4fb6, { 0xaa, 0x77, 0x98, 0x4a, 0xb5, 0x3d, 0xe8, 0x11 }
-};
-
-static EFI_GUID my_gDellPchInitDxeGuid = {
-  0xde23acee, 0xcf55, 0x4fb6, { 0xaa, 0x77, 0x98, 0x4a, 0xb5, 0x3d, 0xe8, 0x23 }
-};
-
-static EFI_GUID my_gDellSmbiosGetFlashData64Guid = {
-  0xded7956d, 0x7e20, 0x4f20, { 0x91, 0xa1, 0x19, 0x4, 0x39, 0xb0, 0x4d, 0x5b }
-};
-
-static EFI_GUID my_gDellIdeDxeGuid = {
-  0xdefbfc7a, 0xcc02, 0x4225, { 0x88, 0xad, 0x3c, 0x41, 0xe6, 0x21, 0x78, 0x5b }
-};
-
-static EFI_GUID my_gDellMfgModeDxeDriverGuid = {
-  0xdfe7ee64, 0xd4fd, 0x4424, { 0xbf, 0x1f, 0x85, 0xda, 0x52, 0x42, 0x36, 0xfb }
-};
-
-static EFI_GUID my_gDellDaOwnerTagGuid = {
-  0xdff4e6c8, 0x234c, 0x453e, { 0xa9, 0x2d, 0xfa, 0x50, 0x5e, 0x90, 0xd5, 0x39 }
-};
-
-static EFI_GUID my_gDellDaBfaGuid = {
-  0xe0364fee, 0x1440, 0x4a41, { 0xad, 0x3e, 0x50, 0xe0, 0xb1, 0x6, 0xa8, 0x3d }
-};
-
-static EFI_GUID my_gDellCpuDxeGuid = {
-  0xe03abadf, 0xe536, 0x4e88, { 0xb3, 0xa0, 0xb7, 0x7f, 0x78, 0xeb, 0x34, 0xfe }
-};
-
-static EFI_GUID my_gDellPchSmbusDxeGuid = {
-  0xe052d8a6, 0x224a, 0x4c32, { 0x8d, 0x37, 0x2e, 0xa, 0xe1, 0x62, 0x36, 0x4d }
-};
-
-static EFI_GUID my_gDellDaPasswordsGuid = {
-  0xe10539b8, 0x1c35, 0x4b84, { 0x85, 0x93, 0x81, 0x55, 0x5d, 0x6, 0x5d, 0xd5 }
-};
-
-static EFI_GUID my_gDellSlpConfigGuid = {
-  0xe2cfb356, 0x39a9, 0x497b, { 0xb6, 0xb1, 0x95, 0xb9, 0xd2, 0xeb, 0x28, 0x17 }
-};
-
-static EFI_GUID my_gDellDxeSbGpioControlGuid = {
-  0xe305e101, 0x913a, 0x4a51, { 0x8e, 0xe, 0xb4, 0x61, 0x8c, 0x5d, 0xb3, 0x26 }
-};
-
-static EFI_GUID my_gDellSmbDaTokensConfigGuid = {
-  0xe374574a, 0x2adf, 0x43db, { 0xa7, 0x78, 0x88, 0xa7, 0x5f, 0xc0, 0x80, 0x26 }
-};
-
-static EFI_GUID my_gDellOemBadgingSupportGuid = {
-  0xe3932a34, 0x5729, 0x4f24, { 0x9f, 0xb1, 0xd7, 0x40, 0x9b, 0x45, 0x6a, 0x15 }
-};
-
-static EFI_GUID my_gDellSmmCircBuffGuid = {
-  0xe3ed7c21, 0x9db8, 0x47c7, { 0x8e, 0x7d, 0x7d, 0xb9, 0x7f, 0xe2, 0x6, 0x3e }
-};
-
-static EFI_GUID my_gDellPowerButtonGuid = {
-  0xe566b097, 0x4378, 0x485f, { 0x91, 0xd0, 0x1c, 0x9, 0x7c, 0x19, 0xc, 0xe2 }
-};
-
-static EFI_GUID my_gDellAsfTableGuid = {
-  0xe72527cf, 0x505b, 0x4b50, { 0x99, 0xcd, 0xa3, 0x24, 0x67, 0xfa, 0x4a, 0xa4 }
-};
-
-static EFI_GUID my_gDellRuntimeAcpiSmmGuid = {
-  0xe77e53a5, 0xa5b8, 0x45dc, { 0xba, 0xeb, 0x66, 0xc8, 0x6f, 0x1a, 0xc8, 0x11 }
-};
-
-static EFI_GUID my_gDellTagsConfigGuid = {
-  0xe807983e, 0xd366, 0x40c9, { 0x84, 0x6a, 0xe, 0xd7, 0xe6, 0x2, 0x2c, 0x96 }
-};
-
-static EFI_GUID my_gDellSmBiosStrucFanGuid = {
-  0xe975314a, 0x1464, 0x411f, { 0x85, 0xe4, 0x4, 0x1d, 0x90, 0x3c, 0xb6, 0xc4 }
-};
-
-static EFI_GUID my_gDellSmmAsfInitGuid = {
-  0xeb78ce7e, 0x4107, 0x4ef5, { 0x86, 0xcb, 0x22, 0xe8, 0xd8, 0xac, 0x49, 0x50 }
-};
-
-static EFI_GUID my_gDellSmBiosStrucD8Guid = {
-  0xecd81473, 0x533, 0x4844, { 0xbc, 0x77, 0x48, 0xf0, 0xde, 0x27, 0x51, 0x9b }
-};
-
-static EFI_GUID my_gDellSmBiosMemoryGuid = {
-  0xeda39402, 0xf375, 0x4496, { 0x92, 0xd3, 0x83, 0xb4, 0x3c, 0xb8, 0xa7, 0x6a }
-};
-
-static EFI_GUID my_gDellS3ResumeGuid = {
-  0xefd652cc, 0xe99, 0x40f0, { 0x96, 0xc0, 0xe0, 0x8c, 0x8, 0x90, 0x70, 0xfc }
-};
-
-static EFI_GUID my_gDellDxeDiagLedsGuid = {
-  0xf0d8deaa, 0xc495, 0x4139, { 0xb1, 0xfc, 0x78, 0xb7, 0x1, 0x68, 0x26, 0xa }
-};
-
-static EFI_GUID my_gDellWarmBootSmmGuid = {
-  0xf0fff864, 0x8454, 0x46e5, { 0x9f, 0x2b, 0xcf, 0x14, 0xf0, 0xa4, 0x1a, 0x48 }
-};
-
-static EFI_GUID my_gDellBootScriptSmiHandlerGuid = {
-  0xf1a18726, 0xfd79, 0x4df5, { 0xa3, 0x26, 0xe2, 0xb, 0x8c, 0xc4, 0x6b, 0x6 }
-};
-
-static EFI_GUID my_gDellTpmSmmGuid = {
-  0xf317b29b, 0x7dc9, 0x4114, { 0x90, 0x86, 0xd7, 0x13, 0x7e, 0xf4, 0xf1, 0x18 }
-};
-
-static EFI_GUID my_gDellDxeSioEmiGuid = {
-  0xf31c76b9, 0xb55, 0x4456, { 0x99, 0xfe, 0x50, 0xa9, 0xc5, 0xec, 0x11, 0x6c }
-};
-
-static EFI_GUID my_gDellGt2LegacyVideoRomGuid = {
-  0xf64efaba, 0xd0a9, 0x42c3, { 0xb5, 0xe8, 0x39, 0x1b, 0x48, 0x64, 0x7b, 0xf1 }
-};
-
-static EFI_GUID my_gDellSmBiosStrucThermGuid = {
-  0xf6cdaae0, 0xb301, 0x4202, { 0x89, 0xf6, 0x86, 0x23, 0xe6, 0xae, 0xd2, 0x6e }
-};
-
-static EFI_GUID my_gDellVideoConfigDxeGuid = {
-  0xf7d7f748, 0xccde, 0x481f, { 0x9b, 0x86, 0x2e, 0xf5, 0xed, 0xac, 0xc2, 0x1d }
-};
-
-static EFI_GUID my_gDellSmbRunRomGuid = {
-  0xf8bb41a2, 0x485e, 0x4b9d, { 0x88, 0xcf, 0x15, 0x1e, 0x62, 0xf8, 0x4d, 0xde }
-};
-
-static EFI_GUID my_gDellBbsmanagerSmmGuid = {
-  0xf9109394, 0xe5a3, 0x4e61, { 0xb1, 0x68, 0xdc, 0x34, 0xd5, 0x34, 0x45, 0x1e }
-};
-
-static EFI_GUID my_gDellPhysicalPresenceSmmGuid = {
-  0xf935ff1b, 0xaff0, 0x40f3, { 0xb7, 0x7a, 0xb7, 0x95, 0xa7, 0xa7, 0xd7, 0x14 }
-};
-
-static EFI_GUID my_gDellMeLocalFwUpdateDxeGuid = {
-  0xf94ab34a, 0x8069, 0x4a9f, { 0xad, 0x8, 0x95, 0x34, 0xef, 0x37, 0xd9, 0xbe }
-};
-
-static EFI_GUID my_gDellPciSerialGuid = {
-  0xfb142b99, 0xdf57, 0x46cb, { 0xbc, 0x69, 0xb, 0xf8, 0x58, 0xa7, 0x34, 0xf9 }
-};
-
-static EFI_GUID my_gDellPchSerialGpioGuid = {
-  0xfc1b7640, 0x3466, 0x4c06, { 0xb1, 0xcc, 0x1c, 0x93, 0x53, 0x94, 0xb5, 0xc2 }
-};
-
-static EFI_GUID my_gDellSmiCpuDecodeGuid = {
-  0xfc87501f, 0xf707, 0x49a2, { 0xb6, 0x76, 0x77, 0x71, 0x7d, 0xd9, 0x4, 0xdc }
-};
-
-static EFI_GUID my_gDellSmmS3Guid = {
-  0x997e770, 0x756e, 0x4139, { 0xbf, 0x3f, 0x7f, 0xc2, 0xa3, 0x8, 0x17, 0x7e }
-};
-
-static EFI_GUID my_gDellCpuPeiBeforeMemGuid = {
-  0x1555acf3, 0xbd07, 0x4685, { 0xb6, 0x68, 0xa8, 0x69, 0x45, 0xa4, 0x12, 0x4d }
-};
-
-static EFI_GUID my_gDellWdtPeiGuid = {
-  0x1d88c542, 0x9df7, 0x424a, { 0xaa, 0x90, 0x2, 0xb6, 0x1f, 0x28, 0x69, 0x38 }
-};
-
-static EFI_GUID my_gDellPeiHwmInitGuid = {
-  0x221d6760, 0x4ac0, 0x4c12, { 0xba, 0x96, 0x9c, 0x63, 0xe4, 0xd9, 0xc1, 0xc8 }
-};
-
-static EFI_GUID my_gDellCpuPeiGuid = {
-  0x2bb5afa9, 0xff33, 0x417b, { 0x84, 0x97, 0xcb, 0x77, 0x3c, 0x2b, 0x93, 0xbf }
-};
-
-static EFI_GUID my_gDellAudioConfigPeiGuid = {
-  0x336cddea, 0xab28, 0x4c4c, { 0x9f, 0x64, 0x5f, 0xe0, 0x39, 0x1f, 0xeb, 0xb8 }
-};
-
-static EFI_GUID my_gDellTcgPeiGuid = {
-  0x34989d8e, 0x930a, 0x4a95, { 0xab, 0x4, 0x2e, 0x6c, 0xfd, 0xff, 0x66, 0x31 }
-};
-
-static EFI_GUID my_gDellMemoryInitGuid = {
-  0x3b42ef57, 0x16d3, 0x44cb, { 0x86, 0x32, 0x9f, 0xdb, 0x6, 0xb4, 0x14, 0x51 }
-};
-
-static EFI_GUID my_gDellAlertStandardFormatPeiGuid = {
-  0x3e4817fd, 0x2742, 0x4351, { 0xb5, 0x9f, 0x91, 0x49, 0x32, 0x80, 0x32, 0x9c }
-};
-
-static EFI_GUID my_gDellAmtConfigPeiGuid = {
-  0x49eab1a6, 0xaf2f, 0x4064, { 0x9b, 0x29, 0xd9, 0x65, 0x5b, 0x3b, 0x8d, 0xed }
-};
-
-static EFI_GUID my_gDellOpPresenceGuid = {
-  0x4fe772e8, 0xfe3e, 0x4086, { 0xb6, 0x38, 0x8c, 0x49, 0x3c, 0x49, 0x4, 0x88 }
-};
-
-static EFI_GUID my_gDellStartWatchDogGuid = {
-  0x5479e09c, 0x2e74, 0x481b, { 0x89, 0xf8, 0xb0, 0x17, 0x2e, 0x38, 0x8d, 0x1f }
-};
-
-static EFI_GUID my_gDellErrorHandlerPeiGuid = {
-  0x5924be03, 0x9dd8, 0x4bab, { 0x80, 0x8f, 0xc2, 0x1c, 0xab, 0xfe, 0xb, 0x4b }
-};
-
-static EFI_GUID my_gDellPchSmbusArpDisabledGuid = {
-  0x643df777, 0xf312, 0x42ed, { 0x81, 0xcc, 0x1b, 0x1f, 0x57, 0xe1, 0x8a, 0xd6 }
-};
-
-static EFI_GUID my_gDellPchUsbGuid = {
-  0x6b4fdbd2, 0x47e1, 0x4a09, { 0xba, 0x8e, 0x8e, 0x4, 0x1f, 0x20, 0x8b, 0x95 }
-};
-
-static EFI_GUID my_gDellTcgPei2Guid = {
-  0x70e65212, 0xf3ad, 0x495f, { 0xb3, 0xa1, 0x7a, 0x63, 0x54, 0x2e, 0xd7, 0xd5 }
-};
-
-static EFI_GUID my_gDellSbPowerOffPeiGuid = {
-  0x795477d9, 0x1786, 0x4d8a, { 0x8b, 0x89, 0x3f, 0xa7, 0x62, 0x3f, 0x7e, 0xf8 }
-};
-
-static EFI_GUID my_gDellCmosManagerPeiSrcGuid = {
-  0x7d7789cd, 0xfd20, 0x4c05, { 0xa5, 0x79, 0x91, 0x25, 0x3d, 0x5e, 0x3d, 0x9e }
-};
-
-static EFI_GUID my_gDellMfgModePeiDriverGuid = {
-  0x81f0bcf2, 0xf1ad, 0x4dde, { 0x9e, 0x5b, 0x75, 0xeb, 0x34, 0x27, 0xab, 0xc4 }
-};
-
-static EFI_GUID my_gDellCorePeiGuid = {
-  0x92685943, 0xd810, 0x47ff, { 0xa1, 0x12, 0xcc, 0x84, 0x90, 0x77, 0x6a, 0x1f }
-};
-
-static EFI_GUID my_gDellHeciPeiGuid = {
-  0x9cf30325, 0xdc5c, 0x4556, { 0xa8, 0xb0, 0x74, 0x21, 0x5c, 0x5f, 0x7f, 0xc4 }
-};
-
-static EFI_GUID my_gDellAudioPeiGuid = {
-  0xa0d7e505, 0x5dd4, 0x4459, { 0xa4, 0xd3, 0x36, 0x11, 0x95, 0x63, 0xc4, 0xf9 }
-};
-
-static EFI_GUID my_gDellFlashUpdatePeiGuid = {
-  0xa27e7c62, 0x249f, 0x4b7b, { 0xbd, 0x5c, 0x80, 0x72, 0x2, 0x3, 0x5d, 0xec }
-};
-
-static EFI_GUID my_gDellWarmBootPeiGuid = {
-  0xb178e5aa, 0x876, 0x420a, { 0xb4, 0xf, 0xe3, 0x9b, 0x4e, 0x6e, 0xe0, 0x5b }
-};
-
-static EFI_GUID my_gDellPeiMainGuid = {
-  0xb1aee818, 0xb959, 0x487b, { 0xa7, 0x95, 0x16, 0xc2, 0xa5, 0x4c, 0xb3, 0x6e }
-};
-
-static EFI_GUID my_gDellDoSiodiagLedPeiGuid = {
-  0xb68efdca, 0xbee2, 0x4bf6, { 0xb8, 0x6e, 0x45, 0xdc, 0x3c, 0xcb, 0xfe, 0x3c }
-};
-
-static EFI_GUID my_gDellPchMeUmaGuid = {
-  0xb6a2aff3, 0x767c, 0x5658, { 0xc3, 0x7a, 0xd1, 0xc8, 0x2e, 0xf7, 0x65, 0x43 }
-};
-
-static EFI_GUID my_gDellPeiDiagLedsGuid = {
-  0xc7fccf43, 0x5859, 0x4abe, { 0xbc, 0xb5, 0x4c, 0x16, 0x26, 0xed, 0x8b, 0x3 }
-};
-
-static EFI_GUID my_gDellTxtPeiGuid = {
-  0xca9d8617, 0xd652, 0x403b, { 0xb6, 0xc5, 0xba, 0x47, 0x57, 0x1, 0x16, 0xad }
-};
-
-static EFI_GUID my_gDellTxtConfigPeiGuid = {
-  0xcdb65801, 0x494d, 0x472e, { 0xa6, 0xa8, 0xaf, 0xf5, 0xb7, 0x6e, 0x8d, 0x1f }
-};
-
-static EFI_GUID my_gDellPeiSioEmiGuid = {
-  0xd041cfc0, 0x7670, 0x435a, { 0xa5, 0x12, 0xf4, 0x5c, 0x92, 0x3b, 0x28, 0x5d }
-};
-
-static EFI_GUID my_gDellSystemIdConfigPeiGuid = {
-  0xde8a5a2c, 0xd788, 0x47fb, { 0xa0, 0xb5, 0x20, 0xca, 0x8e, 0x58, 0xdf, 0xec }
-};
-
-static EFI_GUID my_gDellNbConfigPeiGuid = {
-  0xe5205b53, 0x9758, 0x44ab, { 0xa4, 0x4d, 0xdb, 0x3b, 0xe4, 0x1d, 0x67, 0x42 }
-};
-
-static EFI_GUID my_gDellDirtyShutdownPeiGuid = {
-  0xe5652f81, 0xec09, 0x479c, { 0xba, 0xff, 0xe7, 0x56, 0xf1, 0x82, 0x90, 0x16 }
-};
-
-static EFI_GUID my_gDellSioPolicyConfigPeiGuid = {
-  0xe747d8ff, 0x1794, 0x48c6, { 0x96, 0xd7, 0xa4, 0x19, 0xd9, 0xc6, 0xf, 0x11 }
-};
-
-static EFI_GUID my_gDellAclossPeiGuid = {
-  0xe9a60f94, 0x7a8b, 0x45ba, { 0x9c, 0x32, 0x34, 0x85, 0x52, 0x6b, 0x57, 0x16 }
-};
-
-static EFI_GUID my_gDellSbConfigPeiGuid = {
-  0xe9b60f94, 0x7a0b, 0x48cd, { 0x9c, 0x88, 0x84, 0x84, 0x52, 0x6c, 0x57, 0x19 }
-};
-
-static EFI_GUID my_gDellVideoConfigPeiGuid = {
-  0xf665c81d, 0xefde, 0x4b5f, { 0x88, 0xe8, 0x21, 0x60, 0xb7, 0x48, 0xd2, 0xb4 }
-};
-
-static EFI_GUID my_gDellEcConfigPeiGuid = {
-  0xfb8415b7, 0xea7e, 0x4e6d, { 0x93, 0x81, 0x0, 0x5c, 0x3b, 0xd1, 0xda, 0xd7 }
-};
-
-static EFI_GUID my_gDellSaInitPeimGuid = {
-  0xfd236ae7, 0x791, 0x48c4, { 0xb2, 0x9e, 0x29, 0xbd, 0xee, 0xe1, 0xa8, 0x11 }
-};
-
-static EFI_GUID my_gDellPchInitPeimGuid = {
-  0xfd236ae7, 0x791, 0x48c4, { 0xb2, 0x9e, 0x29, 0xbd, 0xee, 0xe1, 0xa8, 0x38 }
-};
-
-static EFI_GUID my_gLenovoSystemUsbSwitchDxeGuid = {
-  0x13be6b, 0x2198, 0x43f1, { 0x93, 0xba, 0x2a, 0x7e, 0xd7, 0xb1, 0xe1, 0xcc }
-};
-
-static EFI_GUID my_gLenovoSystemScsiBusDxeGuid = {
-  0x167ccc4, 0xd0f7, 0x4f21, { 0xa3, 0xef, 0x9e, 0x64, 0xb7, 0xcd, 0xce, 0x8b }
-};
-
-static EFI_GUID my_gLenovoSystemAhciBusDxeGuid = {
-  0x167ccc4, 0xd0f7, 0x4f21, { 0xa3, 0xef, 0x9e, 0x64, 0xb7, 0xcd, 0xce, 0x8c }
-};
-
-static EFI_GUID my_gLenovoMnpDxeBinGuid = {
-  0x25bbfc7, 0xe6a9, 0x4b8b, { 0x82, 0xad, 0x68, 0x15, 0xa1, 0xae, 0xaf, 0x4a }
-};
-
-static EFI_GUID my_gLenovoIsscSmmGuid = {
-  0x3bf5679, 0x5749, 0x4bc5, { 0xa5, 0x3f, 0x47, 0x47, 0x1d, 0xa7, 0x67, 0xc8 }
-};
-
-static EFI_GUID my_gLenovoEcIoSmmGuid = {
-  0x3ebdb4b, 0x96ba, 0x4f40, { 0x83, 0x29, 0x7f, 0x3a, 0xa8, 0x86, 0x57, 0x7 }
-};
-
-static EFI_GUID my_gLenovoEn25Qh32FlashPartDxeGuid = {
-  0x51a0b77, 0xc066, 0x4610, { 0x99, 0x4, 0xbf, 0x25, 0xc2, 0x96, 0xd6, 0xe6 }
-};
-
-static EFI_GUID my_gLenovoMtmFormatSmmGuid = {
-  0x6384570, 0x1680, 0x4620, { 0x9d, 0x0, 0x6a, 0xd9, 0xe3, 0xcc, 0xb1, 0x9f }
-};
-
-static EFI_GUID my_gLenovoDxeRicohInitGuid = {
-  0x6968b6e, 0xf620, 0x4e8d, { 0xa6, 0xa6, 0x52, 0x55, 0x23, 0x54, 0xdd, 0x75 }
-};
-
-static EFI_GUID my_gLenovoSecurityVariableDxeGuid = {
-  0x6de824a, 0xa4e2, 0x4295, { 0xa3, 0xf6, 0x3, 0xb3, 0xfe, 0xf5, 0xb1, 0x9 }
-};
-
-static EFI_GUID my_gLenovoIbexPeakFlashControllerDxeGuid = {
-  0x723f88b, 0x810f, 0x4e44, { 0x92, 0xa0, 0xa5, 0xc8, 0x3b, 0x43, 0x36, 0x98 }
-};
-
-static EFI_GUID my_gLenovoBoardInfoSmmGuid = {
-  0x770e7a0, 0x9c3a, 0x499c, { 0xa3, 0x11, 0x2f, 0x83, 0x85, 0x8, 0x5, 0x56 }
-};
-
-static EFI_GUID my_gLenovoSystemMetronomeDxeGuid = {
-  0x7a9330a, 0xf347, 0x11d4, { 0x9a, 0x49, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gLenovoSlp2DxeGuid = {
-  0x87e9760, 0x1fb5, 0x49f7, { 0x87, 0x9a, 0x85, 0x3d, 0x2b, 0x21, 0x4c, 0xc7 }
-};
-
-static EFI_GUID my_gLenovoCryptServiceSmmGuid = {
-  0x8fbd32f, 0x867f, 0x452b, { 0xb1, 0x34, 0x70, 0x51, 0x61, 0xf7, 0x33, 0x33 }
-};
-
-static EFI_GUID my_gLenovoSystemScsiDiskDxeGuid = {
-  0xa66e322, 0x3740, 0x4cce, { 0xad, 0x62, 0xbd, 0x17, 0x2c, 0xec, 0xca, 0x35 }
-};
-
-static EFI_GUID my_gLenovoSystemUsbSwitchSmmGuid = {
-  0xb6a8de0, 0x6281, 0x40a2, { 0x8e, 0x9a, 0x9, 0xf1, 0xa1, 0x8a, 0x6d, 0x40 }
-};
-
-static EFI_GUID my_gLenovoEcFwUpdateDxeGuid = {
-  0xc396fca, 0x6bda, 0x4a15, { 0xb6, 0xa3, 0xa6, 0xfa, 0x45, 0x44, 0xbd, 0xb7 }
-};
-
-static EFI_GUID my_gLenovoSetupUnderOsDxeGuid = {
-  0xd648466, 0x36bd, 0x42c6, { 0xb2, 0x87, 0x7c, 0x3b, 0xaa, 0x25, 0x75, 0xc0 }
-};
-
-static EFI_GUID my_gLenovoBdsCtrlGuid = {
-  0xfe159b5, 0x76f, 0x4c36, { 0xbf, 0x26, 0xd7, 0x24, 0xf2, 0x83, 0x12, 0x52 }
-};
-
-static EFI_GUID my_gLenovoSystemFirmwareDeviceDxeGuid = {
-  0x10149626, 0x5583, 0x4364, { 0x82, 0x2f, 0xa4, 0x59, 0xb8, 0x12, 0x13, 0x2 }
-};
-
-static EFI_GUID my_gLenovoEcIoDxeGuid = {
-  0x114ca60c, 0xd965, 0x4c13, { 0xbe, 0xf7, 0xc4, 0x6, 0x22, 0x48, 0xe1, 0xfa }
-};
-
-static EFI_GUID my_gLenovoSystemSmmAhciAspiLegacyRtGuid = {
-  0x124a2e7a, 0x1949, 0x483e, { 0x89, 0x9f, 0x60, 0x32, 0x90, 0x4c, 0xa0, 0xa7 }
-};
-
-static EFI_GUID my_gLenovoBootMenuDxeGuid = {
-  0x126a762d, 0x5758, 0x4fca, { 0x85, 0x31, 0x20, 0x1a, 0x7f, 0x57, 0xf8, 0x50 }
-};
-
-static EFI_GUID my_gLenovoFpPbaGuid = {
-  0x12e7691f, 0x1eee, 0x4ed4, { 0x87, 0x93, 0x69, 0xe2, 0x80, 0x1d, 0x60, 0x2a }
-};
-
-static EFI_GUID my_gLenovoSystemEbcDxeGuid = {
-  0x13ac6dd0, 0x73d0, 0x11d4, { 0xb0, 0x6b, 0x0, 0xaa, 0x0, 0xbd, 0x6d, 0xe7 }
-};
-
-static EFI_GUID my_gLenovoSystemSmmServicesSmmGuid = {
-  0x1504ba7b, 0x58f8, 0x4d12, { 0x96, 0x38, 0xb4, 0x94, 0xa7, 0x4, 0x43, 0x76 }
-};
-
-static EFI_GUID my_gLenovoEcServiceGuid = {
-  0x15c80344, 0xf980, 0x4bf5, { 0xaa, 0xa0, 0xbf, 0xbe, 0x2, 0x7a, 0xef, 0x16 }
-};
-
-static EFI_GUID my_gLenovoSecureFlashVerifySmmGuid = {
-  0x15dd5676, 0x2679, 0x4e24, { 0x9c, 0xaa, 0x85, 0xb2, 0x2d, 0xd8, 0x93, 0xeb }
-};
-
-static EFI_GUID my_gLenovoEn25Qh128FlashPartSmmGuid = {
-  0x170d9568, 0xc969, 0x4fa1, { 0xa5, 0x33, 0xdb, 0x67, 0x79, 0xbf, 0xbe, 0x62 }
-};
-
-static EFI_GUID my_gLenovoComputraceSmiServicesGuid = {
-  0x18578e75, 0xd073, 0x4203, { 0x90, 0xd2, 0x87, 0x88, 0xa8, 0x71, 0xe4, 0x4d }
-};
-
-static EFI_GUID my_gLenovoSmmVideoInt10Guid = {
-  0x19b6f165, 0x7855, 0x42e8, { 0xaa, 0x6f, 0x23, 0x61, 0xca, 0x87, 0xe0, 0x24 }
-};
-
-static EFI_GUID my_gLenovoTcpDxeBinGuid = {
-  0x1a7e4468, 0x2f55, 0x4a56, { 0x90, 0x3c, 0x1, 0x26, 0x5e, 0xb7, 0x62, 0x2b }
-};
-
-static EFI_GUID my_gLenovoSystemBootScriptSaveDxeGuid = {
-  0x1c6b2faf, 0xd8bd, 0x44d1, { 0xa9, 0x1e, 0x73, 0x21, 0xb4, 0xc2, 0xf3, 0xd1 }
-};
-
-static EFI_GUID my_gLenovoEaiaDxeGuid = {
-  0x1d201235, 0x2f40, 0x4fbc, { 0x86, 0x50, 0x85, 0x2, 0x9, 0x2d, 0x62, 0xab }
-};
-
-static EFI_GUID my_gLenovoSystemPs2MouseDxeGuid = {
-  0x202a2b0e, 0x9a31, 0x4812, { 0xb2, 0x91, 0x87, 0x47, 0xdf, 0x15, 0x24, 0x39 }
-};
-
-static EFI_GUID my_gLenovoSmartCardDetectDxeGuid = {
-  0x22bf0b85, 0x4eb3, 0x479b, { 0xa9, 0xe9, 0xa5, 0xf7, 0xcf, 0xcc, 0xa7, 0x87 }
-};
-
-static EFI_GUID my_gLenovoPlatformFlashDxeGuid = {
-  0x2338337a, 0x47b0, 0x4c41, { 0x9c, 0xa7, 0x1, 0x60, 0xfb, 0x94, 0xdf, 0xf4 }
-};
-
-static EFI_GUID my_gLenovoMx25L3206EflashPartSmmGuid = {
-  0x238d654d, 0xa6ad, 0x41c8, { 0xa3, 0x1b, 0x67, 0xa3, 0x20, 0x86, 0x25, 0xc3 }
-};
-
-static EFI_GUID my_gLenovoTpmEnablerDxeGuid = {
-  0x23d93eaa, 0x723, 0x4559, { 0xb7, 0x68, 0x5e, 0x22, 0xdf, 0x76, 0x2d, 0xe4 }
-};
-
-static EFI_GUID my_gLenovoSystemUsbSupportPolicySmmGuid = {
-  0x240612b7, 0xa063, 0x11d4, { 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4c }
-};
-
-static EFI_GUID my_gLenovoSystemUsbBusDxeGuid = {
-  0x240612b7, 0xa063, 0x11d4, { 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gLenovoSystemUsbSupportPolicyDxeGuid = {
-  0x240612b7, 0xa063, 0x11d4, { 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4e }
-};
-
-static EFI_GUID my_gLenovoSmmOemint15Guid = {
-  0x243c8c8a, 0xbbd0, 0x4aa9, { 0xbe, 0x17, 0xcf, 0x9b, 0x58, 0x31, 0x30, 0xec }
-};
-
-static EFI_GUID my_gLenovoSystemStatusCodeGenericRtGuid = {
-  0x246f9f0a, 0x11e3, 0x459a, { 0xae, 0x6, 0x37, 0x2b, 0xdc, 0x4d, 0xe8, 0x6 }
-};
-
-static EFI_GUID my_gLenovoCryptServiceGuid = {
-  0x2554ef5e, 0xc9ca, 0x4a48, { 0x9d, 0x94, 0x24, 0x9e, 0xb1, 0xe8, 0x7c, 0x2d }
-};
-
-static EFI_GUID my_gLenovoTcgServicesDxeGuid = {
-  0x25f49067, 0xa65b, 0x48f5, { 0xbb, 0xbe, 0x35, 0x41, 0x8c, 0x48, 0x88, 0x36 }
-};
-
-static EFI_GUID my_gLenovoFdiskOemGuid = {
-  0x26ddba9f, 0x5b0d, 0x4e80, { 0x86, 0xb2, 0x80, 0xda, 0xe4, 0xd0, 0x1b, 0xe }
-};
-
-static EFI_GUID my_gLenovoPchSpiSmmGuid = {
-  0x27f4917b, 0xa707, 0x4aad, { 0x96, 0x76, 0x26, 0xdf, 0x16, 0x8c, 0xbf, 0xd }
-};
-
-static EFI_GUID my_gLenovoIvbGopDriverGuid = {
-  0x28b5a45c, 0xcc5d, 0x4221, { 0x9d, 0xff, 0x86, 0xb0, 0xf4, 0x2d, 0xdc, 0x1 }
-};
-
-static EFI_GUID my_gLenovoSystemStatusCodePort80RtGuid = {
-  0x29a1a717, 0x36e9, 0x49e0, { 0xb3, 0x81, 0xea, 0x3b, 0x5f, 0xf7, 0x9, 0x42 }
-};
-
-static EFI_GUID my_gLenovoW25Q64FlashPartDxeGuid = {
-  0x2a4224a1, 0x2609, 0x40a7, { 0x88, 0xe2, 0xa6, 0x8d, 0xc0, 0xf1, 0xd1, 0x80 }
-};
-
-static EFI_GUID my_gLenovoSystemUsbMemoryManagerSmmGuid = {
-  0x2acb1e45, 0xdfa4, 0x4ff3, { 0x8f, 0x81, 0x91, 0xf7, 0xd7, 0x87, 0xd2, 0x2d }
-};
-
-static EFI_GUID my_gLenovoSystemAcpiS3SaveDxeGuid = {
-  0x2bded685, 0xf733, 0x455f, { 0xa8, 0x40, 0x43, 0xa2, 0x2b, 0x79, 0x1f, 0xb3 }
-};
-
-static EFI_GUID my_gLenovoSaLateInitSmmGuid = {
-  0x2d1e361c, 0x7b3f, 0x4d15, { 0x8b, 0x1f, 0x66, 0xe5, 0x51, 0xfa, 0xbd, 0xc7 }
-};
-
-static EFI_GUID my_gLenovoSystemUsbMouseDxeGuid = {
-  0x2d2e62aa, 0x9ecf, 0x43b7, { 0x82, 0x19, 0x94, 0xe7, 0xfc, 0x71, 0x3d, 0xfe }
-};
-
-static EFI_GUID my_gLenovoSystemUsbKbDxeGuid = {
-  0x2d2e62cf, 0x9ecf, 0x43b7, { 0x82, 0x19, 0x94, 0xe7, 0xfc, 0x71, 0x3d, 0xfe }
-};
-
-static EFI_GUID my_gLenovoPlatformDxeGuid = {
-  0x2d6f37bf, 0x9afc, 0x4aa5, { 0xa0, 0x26, 0x32, 0xb2, 0xfc, 0xf3, 0xf, 0xb9 }
-};
-
-static EFI_GUID my_gLenovoPchBiosWriteProtectGuid = {
-  0x2ee81acb, 0x64b2, 0x41ae, { 0x86, 0x35, 0x70, 0x30, 0xd1, 0x6c, 0x4a, 0xa8 }
-};
-
-static EFI_GUID my_gLenovoTpAcpiNvsInitDxeGuid = {
-  0x301a0bc3, 0xba16, 0x49f9, { 0x85, 0x8b, 0xde, 0xe0, 0x5f, 0x91, 0xe7, 0xb8 }
-};
-
-static EFI_GUID my_gLenovoSnbGopDriverGuid = {
-  0x311032c4, 0x98a6, 0x4e06, { 0x8c, 0x3, 0xd8, 0x15, 0xfd, 0x1f, 0xe7, 0x9 }
-};
-
-static EFI_GUID my_gLenovoSystemUsbDatabaseSmmGuid = {
-  0x316190d1, 0x5e48, 0x4c15, { 0xac, 0x72, 0x37, 0x53, 0x2f, 0x3a, 0x1e, 0xc1 }
-};
-
-static EFI_GUID my_gLenovoSystemFormBrowserCoreDxeGuid = {
-  0x32442d09, 0x1d11, 0x4e27, { 0x8a, 0xab, 0x90, 0xfe, 0x6a, 0xcb, 0x4, 0x89 }
-};
-
-static EFI_GUID my_gLenovoBiosExtensionLoaderGuid = {
-  0x32c1c9f8, 0xd53f, 0x41c8, { 0x94, 0xd0, 0xf6, 0x73, 0x9f, 0x23, 0x10, 0x11 }
-};
-
-static EFI_GUID my_gLenovoSystemHiiDatabaseDxeGuid = {
-  0x348c4d62, 0xbfbd, 0x4882, { 0x9e, 0xce, 0xc8, 0xb, 0xb1, 0xc4, 0x78, 0x3b }
-};
-
-static EFI_GUID my_gLenovoAtpDxeGuid = {
-  0x34d51eb9, 0x76db, 0x4caf, { 0x94, 0xae, 0x93, 0x48, 0x56, 0xe8, 0x95, 0xf6 }
-};
-
-static EFI_GUID my_gLenovoDxeMainGuid = {
-  0x35b898ca, 0xb6a9, 0x49ce, { 0x8c, 0x72, 0x90, 0x47, 0x35, 0xcc, 0x49, 0xb7 }
-};
-
-static EFI_GUID my_gLenovoSystemSplashDxeGuid = {
-  0x37087b94, 0xef41, 0x4977, { 0x93, 0xe2, 0x3f, 0x6a, 0xdf, 0xdd, 0x6, 0xe1 }
-};
-
-static EFI_GUID my_gLenovoSystemImageDisplayDxeGuid = {
-  0x371fa4b8, 0x8042, 0x4ed6, { 0xad, 0xa7, 0xa9, 0x87, 0xbd, 0x2c, 0xdf, 0xa }
-};
-
-static EFI_GUID my_gLenovoSystemRtcRtGuid = {
-  0x378d7b65, 0x8da9, 0x4773, { 0xb6, 0xe4, 0xa4, 0x78, 0x26, 0xa8, 0x33, 0xe1 }
-};
-
-static EFI_GUID my_gLenovoSystemIdeAtaAtapiPassThruDxeGuid = {
-  0x37a0d020, 0xccd1, 0x11dd, { 0xad, 0x8b, 0x8, 0x0, 0x20, 0xc, 0x9a, 0x66 }
-};
-
-static EFI_GUID my_gLenovoSetupMainDxeGuid = {
-  0x37afcf55, 0x2e8c, 0x4722, { 0xb9, 0x50, 0xb4, 0x8b, 0x91, 0x65, 0xc5, 0x6b }
-};
-
-static EFI_GUID my_gLenovoMePciUpdateGuid = {
-  0x37ddc7e9, 0x7c1d, 0x4e1b, { 0xb2, 0xcb, 0x4e, 0xd5, 0xd1, 0x25, 0x27, 0xb3 }
-};
-
-static EFI_GUID my_gLenovoPhxGopDxeGuid = {
-  0x37ecdf24, 0x8453, 0x476a, { 0xab, 0x58, 0xf4, 0xcf, 0x8b, 0xfe, 0x67, 0x42 }
-};
-
-static EFI_GUID my_gLenovoMx25L64XflashPartDxeGuid = {
-  0x389244db, 0x3d6e, 0x4e50, { 0x83, 0x5d, 0x5a, 0x77, 0x5a, 0x32, 0x5d, 0x89 }
-};
-
-static EFI_GUID my_gLenovoAoacSmmGuid = {
-  0x3a2aec67, 0x77b8, 0x40ae, { 0x92, 0x81, 0x3, 0x51, 0x9c, 0x9e, 0x7f, 0x8 }
-};
-
-static EFI_GUID my_gLenovoSystemHiiImageDisplayDxeGuid = {
-  0x3c14c099, 0x3143, 0x46ef, { 0xaf, 0x18, 0xde, 0x4a, 0xd2, 0xc3, 0xa7, 0x99 }
-};
-
-static EFI_GUID my_gLenovoSystemPs2KeyboardDxeGuid = {
-  0x3dc82376, 0x637b, 0x40a6, { 0xa8, 0xfc, 0xa5, 0x65, 0x41, 0x7f, 0x2c, 0x38 }
-};
-
-static EFI_GUID my_gLenovoRebootCpGuid = {
-  0x3dfc255f, 0x9c86, 0x48bc, { 0x97, 0x2d, 0xe5, 0x22, 0x53, 0x37, 0x68, 0xdb }
-};
-
-static EFI_GUID my_gLenovoSystemCryptSvcRtGuid = {
-  0x3e44ad09, 0xd88b, 0x4c52, { 0xb4, 0x1b, 0xb8, 0xc0, 0x5, 0x36, 0x47, 0x4a }
-};
-
-static EFI_GUID my_gLenovoPlatformPciDxeGuid = {
-  0x3f7753ef, 0xd36f, 0x45cc, { 0x8a, 0x1a, 0x2e, 0xaa, 0xff, 0x10, 0x38, 0xb6 }
-};
-
-static EFI_GUID my_gLenovoFitDiagnosticsLoaderGuid = {
-  0x3f7e615b, 0xd45, 0x4f80, { 0x88, 0xdc, 0x26, 0xb2, 0x34, 0x95, 0x85, 0x60 }
-};
-
-static EFI_GUID my_gLenovoIbexPeakGlobalSmiControlGuid = {
-  0x3fb856a5, 0xc8b0, 0x4760, { 0xb4, 0x9a, 0x2e, 0xdd, 0x4f, 0xa3, 0x5b, 0xfa }
-};
-
-static EFI_GUID my_gLenovoVproIderAsfBootGuid = {
-  0x401471e4, 0x9e79, 0x4664, { 0xbf, 0xb0, 0x17, 0x95, 0x24, 0x23, 0x5, 0x67 }
-};
-
-static EFI_GUID my_gLenovoSystemConSplitterDxeGuid = {
-  0x408edcec, 0xcf6d, 0x477c, { 0xa5, 0xa8, 0xb4, 0x84, 0x4e, 0x3d, 0xe2, 0x81 }
-};
-
-static EFI_GUID my_gLenovoIFfsSmmGuid = {
-  0x43172851, 0xcf7e, 0x4345, { 0x9f, 0xe0, 0xd7, 0x1, 0x2b, 0xb1, 0x7b, 0x88 }
-};
-
-static EFI_GUID my_gLenovoSystemPartitionDxeGuid = {
-  0x43b93232, 0xafbe, 0x11d4, { 0xbd, 0xf, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 }
-};
-
-static EFI_GUID my_gLenovoMailBoxDxeGuid = {
-  0x43bb9eab, 0x7d57, 0x4def, { 0xb0, 0xa2, 0xa3, 0xa9, 0xf9, 0xc6, 0xea, 0xe3 }
-};
-
-static EFI_GUID my_gLenovoVariableInitSmmGuid = {
-  0x44cf7d20, 0xdff6, 0x4209, { 0x9a, 0x1f, 0xf6, 0xcd, 0x5f, 0x5c, 0xe8, 0x8b }
-};
-
-static EFI_GUID my_gLenovoSystemAhciAtaAtapiPassThruDxeGuid = {
-  0x44f23590, 0xdc88, 0x11dd, { 0xad, 0x8b, 0x8, 0x0, 0x20, 0xc, 0x9a, 0x66 }
-};
-
-static EFI_GUID my_gLenovoComputraceLoaderDxeGuid = {
-  0x4589cbf3, 0x3f9, 0x4998, { 0x9d, 0x6f, 0x26, 0x34, 0x3c, 0x69, 0x56, 0x2a }
-};
-
-static EFI_GUID my_gLenovoSystemCmosSmmGuid = {
-  0x46d8acdd, 0x29c3, 0x4013, { 0x81, 0xe8, 0x37, 0xa4, 0x25, 0xab, 0x4f, 0x99 }
-};
-
-static EFI_GUID my_gLenovoMiscGaIoDxeGuid = {
-  0x4a5227d3, 0xbef, 0x4caa, { 0xac, 0xbd, 0xec, 0x84, 0x44, 0x6c, 0x5c, 0x6c }
-};
-
-static EFI_GUID my_gLenovoAt24Rf08EepromSmmGuid = {
-  0x4b6b21a1, 0xf26b, 0x404f, { 0x86, 0x94, 0xdb, 0x1c, 0x63, 0xa1, 0xd9, 0x2a }
-};
-
-static EFI_GUID my_gLenovoSecuritySmiDispatchGuid = {
-  0x4c7d1568, 0xcf73, 0x4676, { 0xa0, 0x79, 0x16, 0xf7, 0xf9, 0x60, 0xc, 0xcc }
-};
-
-static EFI_GUID my_gLenovoSystemPpisNeededByDxeCoreGuid = {
-  0x4d37da42, 0x3a0c, 0x4eda, { 0xb9, 0xeb, 0xbc, 0xe, 0x1d, 0xb4, 0x71, 0x3b }
-};
-
-static EFI_GUID my_gLenovoSystemErrorLogSmmGuid = {
-  0x4d62b5e9, 0x71c8, 0x412a, { 0x86, 0x4, 0x87, 0x8c, 0x92, 0x1d, 0x9a, 0xd1 }
-};
-
-static EFI_GUID my_gLenovoVproHiiDxeGuid = {
-  0x4ecec19c, 0x6e5f, 0x4815, { 0x83, 0x42, 0xb5, 0x5f, 0x2c, 0xc5, 0xdf, 0xc1 }
-};
-
-static EFI_GUID my_gLenovoComputraceEnablerDxeGuid = {
-  0x4efc51da, 0x23a6, 0x4790, { 0xa2, 0x92, 0x49, 0x85, 0xc7, 0xf5, 0xcd, 0xef }
-};
-
-static EFI_GUID my_gLenovoEn25Qh64FlashPartSmmGuid = {
-  0x501bd93a, 0xf1a9, 0x4f4c, { 0xa9, 0x46, 0x78, 0x67, 0xdf, 0x97, 0x55, 0x37 }
-};
-
-static EFI_GUID my_gLenovoPchEmulateKbcGuid = {
-  0x510550e0, 0xbbce, 0x4ebf, { 0xbb, 0xa0, 0x94, 0x6e, 0x3d, 0x18, 0xe7, 0x5 }
-};
-
-static EFI_GUID my_gLenovoSystemSmbiosEventLogDxeGuid = {
-  0x5112a2aa, 0xe175, 0x477e, { 0xa4, 0xe4, 0xd0, 0xb7, 0xe6, 0x89, 0xba, 0x9f }
-};
-
-static EFI_GUID my_gLenovoHpmSmmGuid = {
-  0x515b224b, 0xb059, 0x460b, { 0x85, 0xc7, 0xc2, 0x86, 0x58, 0xf4, 0xb8, 0x98 }
-};
-
-static EFI_GUID my_gLenovoSystemCrc32SectionExtractDxeGuid = {
-  0x51c9f40c, 0x5243, 0x4473, { 0xb2, 0x65, 0xb3, 0xc8, 0xff, 0xaf, 0xf9, 0xfa }
-};
-
-static EFI_GUID my_gLenovoSystemConPlatformDxeGuid = {
-  0x51ccf399, 0x4fdf, 0x4e55, { 0xa4, 0x5b, 0xe1, 0x23, 0xf8, 0x4d, 0x45, 0x6a }
-};
-
-static EFI_GUID my_gLenovoPlatformS3SaveDxeGuid = {
-  0x51d4bacc, 0xe70a, 0x4136, { 0x94, 0x26, 0x54, 0x69, 0x73, 0xed, 0x93, 0x8c }
-};
-
-static EFI_GUID my_gLenovoTdtAmGuid = {
-  0x520f9c58, 0x9f9d, 0x48c6, { 0xa0, 0xa0, 0xd9, 0xfe, 0x6d, 0x8f, 0xde, 0x77 }
-};
-
-static EFI_GUID my_gLenovoArpDxeBinGuid = {
-  0x529d3f93, 0xe8e9, 0x4e73, { 0xb1, 0xe1, 0xbd, 0xf6, 0xa9, 0xd5, 0x1, 0x13 }
-};
-
-static EFI_GUID my_gLenovoHpmDxeGuid = {
-  0x539d8aad, 0xc6ac, 0x426c, { 0xb6, 0x1f, 0x22, 0x8e, 0x6d, 0x15, 0x1, 0xb6 }
-};
-
-static EFI_GUID my_gLenovoSystemDataHubDxeGuid = {
-  0x53bcc14f, 0xc24f, 0x434c, { 0xb2, 0x94, 0x8e, 0xd2, 0xd4, 0xcc, 0x18, 0x60 }
-};
-
-static EFI_GUID my_gLenovoSystemFlashCommunicationDxeGuid = {
-  0x546ad295, 0xc64, 0x4ce6, { 0xa0, 0x6f, 0xfb, 0x9c, 0xd0, 0x4b, 0x41, 0xcd }
-};
-
-static EFI_GUID my_gLenovoSystemFirmwareDeviceSmmGuid = {
-  0x54c32cbf, 0xa3b9, 0x4cce, { 0x9c, 0x43, 0xe0, 0x59, 0xe3, 0x22, 0x55, 0xdf }
-};
-
-static EFI_GUID my_gLenovoDriveEraseDxeGuid = {
-  0x550303d2, 0xf033, 0x4468, { 0x85, 0x7a, 0x44, 0x2c, 0x10, 0xe1, 0x99, 0xe9 }
-};
-
-static EFI_GUID my_gLenovoSmmBaseRuntimeGuid = {
-  0x5552575a, 0x7e00, 0x4d61, { 0xa3, 0xa4, 0xf7, 0x54, 0x73, 0x51, 0xb4, 0x9e }
-};
-
-static EFI_GUID my_gLenovoDriveEraseSmmGuid = {
-  0x55f9900a, 0xbfb0, 0x4b30, { 0x83, 0xee, 0x7f, 0x43, 0x7f, 0xaf, 0xae, 0x33 }
-};
-
-static EFI_GUID my_gLenovoPriorBootGuid = {
-  0x57f48613, 0x300a, 0x4101, { 0xa7, 0x6d, 0x4f, 0x73, 0xc5, 0x33, 0xb5, 0xb8 }
-};
-
-static EFI_GUID my_gLenovoDiskControllerSmbiosGuid = {
-  0x5a3f3bd1, 0xb7a6, 0x404b, { 0xa0, 0xf7, 0x28, 0x5e, 0x1b, 0x89, 0x8b, 0x0 }
-};
-
-static EFI_GUID my_gLenovoDxeRealtekCrcInitGuid = {
-  0x5b74c741, 0x4a5f, 0x4a8e, { 0xb6, 0x89, 0xd8, 0x4, 0xab, 0x43, 0x68, 0xfd }
-};
-
-static EFI_GUID my_gLenovoPlatformCsmDxeGuid = {
-  0x5bdde605, 0xb107, 0x419e, { 0x95, 0x10, 0xaa, 0x3c, 0x43, 0x4e, 0xbb, 0xe4 }
-};
-
-static EFI_GUID my_gLenovoSecureErrorManagerDxeGuid = {
-  0x5bdee236, 0xcb5, 0x4d86, { 0xa6, 0x8, 0xee, 0x7b, 0xc, 0x5f, 0x29, 0x56 }
-};
-
-static EFI_GUID my_gLenovoIp6DxeBinGuid = {
-  0x5bedb5cc, 0xd830, 0x4eb2, { 0x87, 0x42, 0x2d, 0x4c, 0xc9, 0xb5, 0x4f, 0x2c }
-};
-
-static EFI_GUID my_gLenovoSetupRestartDxeGuid = {
-  0x5d758bfb, 0xb323, 0x4f6c, { 0x90, 0x17, 0xa3, 0x23, 0x8c, 0xe6, 0x51, 0x63 }
-};
-
-static EFI_GUID my_gLenovoSystemImageDecoderDxeGuid = {
-  0x5f65d21a, 0x8867, 0x45d3, { 0xa4, 0x1a, 0x52, 0x6f, 0x9f, 0xe2, 0xc5, 0x98 }
-};
-
-static EFI_GUID my_gLenovoSetupConfigDxeGuid = {
-  0x5fc8eee0, 0x9bf2, 0x498f, { 0xb4, 0xd3, 0xc5, 0x1e, 0xd4, 0xc8, 0x7b, 0xb4 }
-};
-
-static EFI_GUID my_gLenovoSmbiosCompatiInfoGuid = {
-  0x605e41b8, 0xe923, 0x47cc, { 0x87, 0xb1, 0xa6, 0xe3, 0x85, 0x26, 0xe7, 0x8d }
-};
-
-static EFI_GUID my_gLenovoSystemKbcInitDxeGuid = {
-  0x61141ca0, 0x1444, 0x4c4e, { 0xa1, 0x6d, 0xb6, 0x1, 0xe0, 0xa0, 0x94, 0x66 }
-};
-
-static EFI_GUID my_gLenovoRemoteConfigUpdateDxeGuid = {
-  0x621de6c6, 0xf5e, 0x4ee3, { 0xa1, 0x2, 0xb, 0xde, 0x76, 0x9a, 0xa, 0xd4 }
-};
-
-static EFI_GUID my_gLenovoCpuInitDxeGuid = {
-  0x62d171cb, 0x78cd, 0x4480, { 0x86, 0x78, 0xc6, 0xa2, 0xa7, 0x97, 0xa8, 0xde }
-};
-
-static EFI_GUID my_gLenovoCpuInitPhnxDxeGuid = {
-  0x63438c6e, 0x971c, 0x4e40, { 0x8f, 0xb, 0x11, 0x9, 0x45, 0x7b, 0xe3, 0x33 }
-};
-
-static EFI_GUID my_gLenovoSystemVariableSmmGuid = {
-  0x65246a3b, 0x33ef, 0x4f7e, { 0xb6, 0x57, 0xa4, 0xa6, 0x33, 0xf1, 0x30, 0xb0 }
-};
-
-static EFI_GUID my_gLenovoSetupUnderOsSmmGuid = {
-  0x65a72030, 0xb02e, 0x4bf3, { 0x84, 0x24, 0xba, 0x5f, 0x2f, 0xc5, 0x6d, 0xe7 }
-};
-
-static EFI_GUID my_gLenovoRnRconfigGuid = {
-  0x665d3f60, 0xad3e, 0x4cad, { 0x8e, 0x26, 0xdb, 0x46, 0xee, 0xe9, 0xf1, 0xb5 }
-};
-
-static EFI_GUID my_gLenovoVariableDxeGuid = {
-  0x66eecf40, 0x6312, 0x4a1a, { 0xa8, 0x3a, 0xb3, 0xb2, 0xf8, 0xd8, 0xa7, 0x1a }
-};
-
-static EFI_GUID my_gLenovoMiscGaIoSmmGuid = {
-  0x67afde5f, 0xef16, 0x47b8, { 0xba, 0x19, 0xc2, 0x1b, 0x39, 0x7, 0xdb, 0xf1 }
-};
-
-static EFI_GUID my_gLenovoW25Q32FlashPartDxeGuid = {
-  0x68bc3095, 0x8839, 0x4a97, { 0x8f, 0xea, 0xbe, 0xe0, 0x6e, 0xca, 0x7b, 0xbb }
-};
-
-static EFI_GUID my_gLenovoSystemIdeBusDxeGuid = {
-  0x69fd8e47, 0xa161, 0x4550, { 0xb0, 0x1a, 0x55, 0x94, 0xce, 0xb2, 0xb2, 0xb2 }
-};
-
-static EFI_GUID my_gLenovoOemMilestoneGuid = {
-  0x6a628efe, 0x3682, 0x4fdc, { 0xa3, 0x1e, 0xc6, 0x35, 0xbd, 0xf1, 0x8c, 0xc8 }
-};
-
-static EFI_GUID my_gLenovoSetupSecurityDxeGuid = {
-  0x6a7b1c86, 0x590e, 0x47a7, { 0x97, 0x1a, 0xc4, 0x9b, 0x40, 0x8d, 0x5e, 0xd7 }
-};
-
-static EFI_GUID my_gLenovoSecureKeyDxeGuid = {
-  0x6a8a395f, 0x4c07, 0x49d1, { 0xb9, 0x4c, 0x22, 0xed, 0x50, 0xd4, 0x25, 0xf8 }
-};
-
-static EFI_GUID my_gLenovoUdp4DxeBinGuid = {
-  0x6d6963ab, 0x906d, 0x4a65, { 0xa7, 0xca, 0xbd, 0x40, 0xe5, 0xd6, 0xaf, 0x2b }
-};
-
-static EFI_GUID my_gLenovoN25Q064FlashPartSmmGuid = {
-  0x6e32eaf6, 0x32d1, 0x43e0, { 0xb6, 0xe1, 0xdc, 0xf6, 0xda, 0x81, 0xdf, 0x76 }
-};
-
-static EFI_GUID my_gLenovoSmbiosVproGuid = {
-  0x6e5228f3, 0x933e, 0x4961, { 0x95, 0x73, 0xf, 0x1e, 0x61, 0xb5, 0x22, 0xac }
-};
-
-static EFI_GUID my_gLenovoW25Q64FlashPartSmmGuid = {
-  0x6e6e4a75, 0xef14, 0x47fb, { 0xb4, 0x3a, 0x67, 0xec, 0x43, 0xb8, 0x7d, 0x22 }
-};
-
-static EFI_GUID my_gLenovoSystemIsaKbcDxeGuid = {
-  0x6e6f05ac, 0x234b, 0x465b, { 0x94, 0x50, 0xc3, 0x6e, 0x6d, 0x75, 0x66, 0xc5 }
-};
-
-static EFI_GUID my_gLenovoPlatformFlashSmmGuid = {
-  0x706c1e0c, 0x44fc, 0x4012, { 0x9b, 0x71, 0x3d, 0xbf, 0xec, 0x76, 0x2f, 0x35 }
-};
-
-static EFI_GUID my_gLenovoPiSaveStateAccessGuid = {
-  0x707b3c6e, 0x99a6, 0x4e17, { 0x84, 0xa0, 0x40, 0x28, 0x4c, 0x1b, 0x3f, 0x38 }
-};
-
-static EFI_GUID my_gLenovoSystemAcpiSupportDxeGuid = {
-  0x717a0eaa, 0x9b18, 0x461a, { 0xb6, 0xec, 0xac, 0x9, 0x79, 0x4c, 0xa6, 0x31 }
-};
-
-static EFI_GUID my_gLenovoSystemSetup2DxeGuid = {
-  0x721c8b66, 0x426c, 0x4e86, { 0x8e, 0x99, 0x34, 0x57, 0xc4, 0x6a, 0xb0, 0xb9 }
-};
-
-static EFI_GUID my_gLenovoSystemIdeAtaAtapiPassThruSmmGuid = {
-  0x7391a960, 0xccd1, 0x11dd, { 0xad, 0x8b, 0x8, 0x0, 0x20, 0xc, 0x9a, 0x66 }
-};
-
-static EFI_GUID my_gLenovoSystemBootManagerDxeGuid = {
-  0x73dab30f, 0x3f9c, 0x4160, { 0xb0, 0x64, 0x43, 0x9c, 0xe1, 0x6c, 0x3e, 0xde }
-};
-
-static EFI_GUID my_gLenovoBlockPowerButtonDxeGuid = {
-  0x74a016d4, 0x4e4b, 0x45b5, { 0xae, 0x97, 0x4e, 0x6e, 0x33, 0xd6, 0x51, 0x25 }
-};
-
-static EFI_GUID my_gLenovoSystemAcpiNumaDxeGuid = {
-  0x758af8a7, 0x2a04, 0x4937, { 0x99, 0xe0, 0x83, 0x7d, 0x1f, 0x97, 0xc7, 0x6f }
-};
-
-static EFI_GUID my_gLenovoSystemAcpiTableLoaderDxeGuid = {
-  0x77617ecb, 0xe229, 0x4e20, { 0xb8, 0xf9, 0xdf, 0x82, 0x45, 0x62, 0x4d, 0x7a }
-};
-
-static EFI_GUID my_gLenovoDigitalThermalSensorSmmGuid = {
-  0x77a6009e, 0x116e, 0x464d, { 0x8e, 0xf8, 0xb3, 0x52, 0x1, 0xa0, 0x22, 0xdd }
-};
-
-static EFI_GUID my_gLenovoSystemFixedBusNumbersDxeGuid = {
-  0x78ffca55, 0x4869, 0x4393, { 0xbe, 0xe9, 0x72, 0xe5, 0x8b, 0xd3, 0xbe, 0x38 }
-};
-
-static EFI_GUID my_gLenovoSystemVariableDxeGuid = {
-  0x793cbea0, 0xda56, 0x47f2, { 0x82, 0x64, 0x24, 0x31, 0xc, 0xb7, 0x51, 0x96 }
-};
-
-static EFI_GUID my_gLenovoSystemSwSmiAllocatorRtGuid = {
-  0x794610da, 0xd0ee, 0x466b, { 0x81, 0xb3, 0x81, 0x97, 0x21, 0x3a, 0x69, 0x78 }
-};
-
-static EFI_GUID my_gLenovoSystem8259InterruptControllerDxeGuid = {
-  0x79ca4208, 0xbba1, 0x4a9a, { 0x84, 0x56, 0xe1, 0xe6, 0x6a, 0x81, 0x48, 0x4e }
-};
-
-static EFI_GUID my_gLenovoWmaPolicyDxeGuid = {
-  0x79e0edd7, 0x9d1d, 0x4f41, { 0xae, 0x1a, 0xf8, 0x96, 0x16, 0x9e, 0x52, 0x16 }
-};
-
-static EFI_GUID my_gLenovoLanUefiGuid = {
-  0x79f90154, 0x83f4, 0x478c, { 0x80, 0xbf, 0x87, 0x8a, 0xc3, 0x2e, 0xa, 0x2c }
-};
-
-static EFI_GUID my_gLenovoPopManagerDxeGuid = {
-  0x7b6f1da6, 0xea4f, 0x4938, { 0xa7, 0x9f, 0xc, 0x58, 0xe1, 0x44, 0x2a, 0xa1 }
-};
-
-static EFI_GUID my_gLenovoSystemUsbMemoryManagerDxeGuid = {
-  0x7be725b2, 0xf56c, 0x41c7, { 0x9f, 0x3, 0x1e, 0x7b, 0x56, 0xb6, 0x59, 0x71 }
-};
-
-static EFI_GUID my_gLenovoAtpSmiServicesGuid = {
-  0x7cab2e8a, 0xb799, 0x4540, { 0x85, 0x17, 0x58, 0x64, 0x4d, 0x3, 0xcc, 0x9f }
-};
-
-static EFI_GUID my_gLenovoModulesSmmThunkSmmGuid = {
-  0x7e715650, 0x10e6, 0x4b7b, { 0x89, 0x6a, 0x4d, 0xc5, 0xfc, 0x74, 0x2b, 0xc5 }
-};
-
-static EFI_GUID my_gLenovoVproPetAlertGuid = {
-  0x7ea76d38, 0xc57a, 0x412d, { 0xaf, 0x1d, 0xd5, 0x8b, 0xee, 0x2b, 0x85, 0xb1 }
-};
-
-static EFI_GUID my_gLenovoSmmRelocDxeGuid = {
-  0x7fed72ee, 0x170, 0x4814, { 0x98, 0x78, 0xa8, 0xfb, 0x18, 0x64, 0xdf, 0xaf }
-};
-
-static EFI_GUID my_gLenovoIgdCustomizeGuid = {
-  0x81334616, 0x86ce, 0x49c2, { 0xb6, 0xf9, 0x18, 0x4, 0xe6, 0x1c, 0x73, 0xf6 }
-};
-
-static EFI_GUID my_gLenovoSetupDateTimeDxeGuid = {
-  0x8218965d, 0x20c0, 0x4dd6, { 0x81, 0xa0, 0x84, 0x5c, 0x52, 0x27, 0x7, 0x43 }
-};
-
-static EFI_GUID my_gLenovoTranslateServiceGuid = {
-  0x826bcf56, 0xbac4, 0x43f4, { 0x8e, 0xa1, 0x8c, 0xdf, 0xa, 0x12, 0x1a, 0xbd }
-};
-
-static EFI_GUID my_gLenovoMeConfigGuid = {
-  0x82988420, 0x7467, 0x4490, { 0x90, 0x59, 0xfe, 0xb4, 0x48, 0xdd, 0x19, 0x63 }
-};
-
-static EFI_GUID my_gLenovoSystemOemActivationDxeGuid = {
-  0x851a6355, 0xce10, 0x4f67, { 0x9d, 0x13, 0x91, 0xb3, 0x28, 0x1a, 0x95, 0xd3 }
-};
-
-static EFI_GUID my_gLenovoSystemPciIsaBusDxeGuid = {
-  0x864b10fe, 0x3d5e, 0x4908, { 0x88, 0xcc, 0xf0, 0x8d, 0x4e, 0xdc, 0x0, 0x50 }
-};
-
-static EFI_GUID my_gLenovoLegacyBiosMiscSmmGuid = {
-  0x86e82ac3, 0xd6af, 0x47a4, { 0x8c, 0x93, 0xc, 0x76, 0xc7, 0xb3, 0xcc, 0xd3 }
-};
-
-static EFI_GUID my_gLenovoInitMePolicyGuid = {
-  0x87e328f9, 0x93a5, 0x4375, { 0xba, 0x69, 0x93, 0xa7, 0xa7, 0x7a, 0x5d, 0x9b }
-};
-
-static EFI_GUID my_gLenovoSetupAutomationSmmGuid = {
-  0x880d81bf, 0xda88, 0x49e1, { 0x95, 0x43, 0xa5, 0x82, 0x47, 0xfe, 0xad, 0x1a }
-};
-
-static EFI_GUID my_gLenovoN25Q064FlashPartDxeGuid = {
-  0x886acb20, 0x78c0, 0x4f88, { 0x9d, 0x3c, 0xba, 0xdc, 0xe3, 0x7e, 0xda, 0x47 }
-};
-
-static EFI_GUID my_gLenovoHdpManagerSmmGuid = {
-  0x89173692, 0x9ac2, 0x4c86, { 0x9e, 0xcc, 0xf3, 0x77, 0x82, 0xdd, 0xeb, 0xaa }
-};
-
-static EFI_GUID my_gLenovoSystemXhciResetSystemGuid = {
-  0x8e5c4bea, 0x34ff, 0x4e32, { 0x83, 0x58, 0x33, 0x63, 0xda, 0x1, 0xe6, 0x28 }
-};
-
-static EFI_GUID my_gLenovoNationalLpcPc87393Guid = {
-  0x8e973f83, 0xabca, 0x49e4, { 0xa9, 0x40, 0x4e, 0xad, 0x5a, 0x6d, 0x8a, 0x1e }
-};
-
-static EFI_GUID my_gLenovoSystemEnglishDxeGuid = {
-  0x8f26ef0a, 0x4f7f, 0x4e4b, { 0x98, 0x2, 0x8c, 0x22, 0xb7, 0x0, 0xff, 0xac }
-};
-
-static EFI_GUID my_gLenovoAbsoluteComputraceInstallerWin8Guid = {
-  0x8feeecf1, 0xbcfd, 0x4a78, { 0x92, 0x31, 0x48, 0x1, 0x56, 0x6b, 0x35, 0x67 }
-};
-
-static EFI_GUID my_gLenovoWmaPciDxeGuid = {
-  0x90e01103, 0xf784, 0x4020, { 0x91, 0xac, 0xc5, 0x1e, 0x8b, 0xf5, 0x53, 0xb2 }
-};
-
-static EFI_GUID my_gLenovoDptfGuid = {
-  0x918aba30, 0x3d8d, 0x4bb5, { 0xb8, 0x49, 0x45, 0xcc, 0x4f, 0xc7, 0xde, 0x7c }
-};
-
-static EFI_GUID my_gLenovoSystemIsaSerialDxeGuid = {
-  0x93b80003, 0x9fb3, 0x11d4, { 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gLenovoSystemPciBusDxeGuid = {
-  0x93b80004, 0x9fb3, 0x11d4, { 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gLenovoDhcp4DxeBinGuid = {
-  0x94734718, 0xbbc, 0x47fb, { 0x96, 0xa5, 0xee, 0x7a, 0x5a, 0xe6, 0xa2, 0xad }
-};
-
-static EFI_GUID my_gLenovoSystemXhciDxeGuid = {
-  0x949822bc, 0x26d3, 0x4bc6, { 0x95, 0x4b, 0xf2, 0xc5, 0x81, 0x34, 0x2d, 0xe1 }
-};
-
-static EFI_GUID my_gLenovoDxeCmosInitGuid = {
-  0x95bf86ad, 0xa1e0, 0x4143, { 0xb4, 0x87, 0x0, 0x4b, 0x1c, 0x2e, 0x5, 0xfa }
-};
-
-static EFI_GUID my_gLenovoTcgServicesSmmGuid = {
-  0x95c051c5, 0xf123, 0x432e, { 0x93, 0x83, 0xb9, 0xcf, 0x11, 0x3f, 0x8, 0x2e }
-};
-
-static EFI_GUID my_gLenovoDhcp6DxeBinGuid = {
-  0x95e3669d, 0x34be, 0x4775, { 0xa6, 0x51, 0x7e, 0xa4, 0x1b, 0x69, 0xd8, 0x9e }
-};
-
-static EFI_GUID my_gLenovoSystemEnhancedFatDxeGuid = {
-  0x961578fe, 0xb6b7, 0x44c3, { 0xaf, 0x35, 0x6b, 0xc7, 0x5, 0xcd, 0x2b, 0x1f }
-};
-
-static EFI_GUID my_gLenovoSystemNullMemoryTestDxeGuid = {
-  0x96b5c032, 0xdf4c, 0x4b6e, { 0x82, 0x32, 0x43, 0x8d, 0xcf, 0x44, 0x8d, 0xe }
-};
-
-static EFI_GUID my_gLenovoSmmCf9TrapGuid = {
-  0x970f9bda, 0x88fc, 0x494c, { 0x9e, 0xa1, 0x26, 0x41, 0x96, 0x63, 0xce, 0x11 }
-};
-
-static EFI_GUID my_gLenovoMtftp6DxeBinGuid = {
-  0x99f03b99, 0x98d8, 0x49dd, { 0xa8, 0xd3, 0x32, 0x19, 0xd0, 0xff, 0xe4, 0x1e }
-};
-
-static EFI_GUID my_gLenovoPlatformResetRuntimeDxeGuid = {
-  0x9a9a912b, 0x5f53, 0x4586, { 0x88, 0x20, 0x70, 0x44, 0x85, 0xa2, 0x9d, 0x21 }
-};
-
-static EFI_GUID my_gLenovoSystemDevicePathDxeGuid = {
-  0x9b680fce, 0xad6b, 0x4f3a, { 0xb6, 0xb, 0xf5, 0x98, 0x99, 0x0, 0x34, 0x43 }
-};
-
-static EFI_GUID my_gLenovoSmmCoreDispatcherGuid = {
-  0x9cc55d7d, 0xfbff, 0x431c, { 0xbc, 0x14, 0x33, 0x4e, 0xae, 0xa6, 0x5, 0x2b }
-};
-
-static EFI_GUID my_gLenovoMebxGuid = {
-  0x9cfd802c, 0x9a1, 0x43d6, { 0x82, 0x17, 0xaa, 0x49, 0xc1, 0xf9, 0xd, 0x2c }
-};
-
-static EFI_GUID my_gLenovoEn25Qh128FlashPartDxeGuid = {
-  0x9d58058e, 0xc8dd, 0x4a9f, { 0xb1, 0x76, 0xdf, 0xcb, 0x92, 0x35, 0x48, 0x15 }
-};
-
-static EFI_GUID my_gLenovoIsscDxeGuid = {
-  0x9d5eb938, 0x9a44, 0x4568, { 0x81, 0x92, 0xc1, 0x56, 0x3b, 0xeb, 0xaa, 0x1 }
-};
-
-static EFI_GUID my_gLenovoSystemTerminalDxeGuid = {
-  0x9e863906, 0xa40f, 0x4875, { 0x97, 0x7f, 0x5b, 0x93, 0xff, 0x23, 0x7f, 0xc6 }
-};
-
-static EFI_GUID my_gLenovoSystemCapsuleRtGuid = {
-  0x9ea5df0f, 0xa35c, 0x48c1, { 0xba, 0xc9, 0xf6, 0x34, 0x52, 0xb4, 0x7c, 0x3e }
-};
-
-static EFI_GUID my_gLenovoPchConfigGuid = {
-  0x9fa2f805, 0x3d86, 0x42bc, { 0xa9, 0xc3, 0x2b, 0x26, 0xa5, 0xdf, 0x9, 0xf9 }
-};
-
-static EFI_GUID my_gLenovoIp4DxeBinGuid = {
-  0x9fb1a1f3, 0x3b71, 0x4324, { 0xb3, 0x9a, 0x74, 0x5c, 0xbb, 0x1, 0x5f, 0xff }
-};
-
-static EFI_GUID my_gLenovoSystemUsbMassStorageDxeGuid = {
-  0x9fb4b4a7, 0x42c0, 0x4bcd, { 0x85, 0x40, 0x9b, 0xcc, 0x67, 0x11, 0xf8, 0x3e }
-};
-
-static EFI_GUID my_gLenovoSystemErrorLogDxeGuid = {
-  0xa196ba47, 0x8ed3, 0x4188, { 0xa7, 0x65, 0xfa, 0x96, 0x4d, 0xd7, 0xed, 0x7a }
-};
-
-static EFI_GUID my_gLenovoDpcDxeBinGuid = {
-  0xa210f973, 0x229d, 0x4f4d, { 0xaa, 0x37, 0x98, 0x95, 0xe6, 0xc9, 0xea, 0xba }
-};
-
-static EFI_GUID my_gLenovoSnpDxeBinGuid = {
-  0xa2f436ea, 0xa127, 0x4ef8, { 0x95, 0x7c, 0x80, 0x48, 0x60, 0x6f, 0xf6, 0x70 }
-};
-
-static EFI_GUID my_gLenovoSecureUpdateDxeGuid = {
-  0xa4928c81, 0x703, 0x4ad7, { 0xa3, 0x2b, 0x75, 0x25, 0xbc, 0x3f, 0xe1, 0xf5 }
-};
-
-static EFI_GUID my_gLenovoOemHookSmmGuid = {
-  0xa4b9a806, 0xb574, 0x4354, { 0xbf, 0xc7, 0x5, 0x21, 0x7d, 0xc0, 0xfa, 0xf4 }
-};
-
-static EFI_GUID my_gLenovoPlatformSetupDxeGuid = {
-  0xa4f2909c, 0x5e2a, 0x438a, { 0x91, 0xba, 0x27, 0x2b, 0x9, 0x23, 0x4, 0x9a }
-};
-
-static EFI_GUID my_gLenovoMx25L3206EflashPartDxeGuid = {
-  0xa4fd00d3, 0x821a, 0x4519, { 0x85, 0xbb, 0x2e, 0x19, 0x87, 0xa6, 0xf4, 0xe1 }
-};
-
-static EFI_GUID my_gLenovoSystemAcpiTablesDxeGuid = {
-  0xa6688890, 0xbff0, 0x4f03, { 0x9b, 0x1e, 0x76, 0xae, 0x86, 0xee, 0xc5, 0xab }
-};
-
-static EFI_GUID my_gLenovoSmBiosHoleGuid = {
-  0xa6a1c030, 0xf956, 0x4a9e, { 0x95, 0x40, 0xd0, 0xe8, 0x1d, 0x2e, 0x33, 0xf2 }
-};
-
-static EFI_GUID my_gLenovoSystemDiagnosticSplashScreenAppGuid = {
-  0xa7d8d9a6, 0x6ab0, 0x4aeb, { 0xad, 0x9d, 0x16, 0x3e, 0x59, 0xa7, 0xa3, 0x80 }
-};
-
-static EFI_GUID my_gLenovoPciExpressGuid = {
-  0xa89ec8e0, 0xba1, 0x40aa, { 0xa0, 0x3e, 0xab, 0xdd, 0xa5, 0x29, 0x5c, 0xde }
-};
-
-static EFI_GUID my_gLenovoSystemSecureBootDxeGuid = {
-  0xa94a6aef, 0xd69b, 0x4010, { 0xba, 0x24, 0xf9, 0x1e, 0x1f, 0xe6, 0x2a, 0xda }
-};
-
-static EFI_GUID my_gLenovoPromptServiceGuid = {
-  0xaa382865, 0x12b0, 0x44e5, { 0xa7, 0x31, 0x6d, 0xef, 0x4d, 0xf3, 0x4c, 0xe7 }
-};
-
-static EFI_GUID my_gLenovoSystemFormBrowserSimpleTextViewLayoutDxeGuid = {
-  0xaadfa1ac, 0xe923, 0x4673, { 0xb1, 0xb8, 0x71, 0x4a, 0xd8, 0x49, 0xf7, 0x90 }
-};
-
-static EFI_GUID my_gLenovoSmmRelocPeimGuid = {
-  0xabb74f50, 0xfd2d, 0x4072, { 0xa3, 0x21, 0xca, 0xfc, 0x72, 0x97, 0x7e, 0xfa }
-};
-
-static EFI_GUID my_gLenovoSystemFrameworkHiiDatabaseDxeGuid = {
-  0xac3435bb, 0xb1d3, 0x4ef8, { 0x95, 0x7c, 0x80, 0x48, 0x60, 0x6f, 0xf6, 0x71 }
-};
-
-static EFI_GUID my_gLenovoInitVproPolicyGuid = {
-  0xac5919d9, 0xf137, 0x4f87, { 0x86, 0x9f, 0xd8, 0x63, 0xed, 0xa8, 0x8e, 0xd2 }
-};
-
-static EFI_GUID my_gLenovoVariableInitDxeGuid = {
-  0xac60ed9f, 0x523e, 0x4f5b, { 0x94, 0xca, 0x39, 0x61, 0x34, 0x6a, 0x0, 0xba }
-};
-
-static EFI_GUID my_gLenovoVproMebxHotkeyGuid = {
-  0xac6fd56a, 0x3d41, 0x4efd, { 0xa1, 0xb9, 0x87, 0x2, 0x93, 0x81, 0x1a, 0x28 }
-};
-
-static EFI_GUID my_gLenovoEn25Qh64FlashPartDxeGuid = {
-  0xaca0f10c, 0x4c9, 0x4c4e, { 0x9d, 0x7b, 0xb7, 0xa0, 0x97, 0xf5, 0xe1, 0xec }
-};
-
-static EFI_GUID my_gLenovoPchPcieSmmGuid = {
-  0xacaeaa7a, 0xc039, 0x4424, { 0x88, 0xda, 0xf4, 0x22, 0x12, 0xea, 0xe, 0x55 }
-};
-
-static EFI_GUID my_gLenovoSystemMonotonicCounterRtGuid = {
-  0xad608272, 0xd07f, 0x4964, { 0x80, 0x1e, 0x7b, 0xd3, 0xb7, 0x88, 0x86, 0x52 }
-};
-
-static EFI_GUID my_gLenovoIncompatiblePciDeviceGuid = {
-  0xad70855e, 0xcc5, 0x4abf, { 0x89, 0x79, 0xbe, 0x76, 0x2a, 0x94, 0x9e, 0xa3 }
-};
-
-static EFI_GUID my_gLenovoPchResetGuid = {
-  0xaf59f2f5, 0x5e28, 0x4e03, { 0x80, 0xe2, 0x47, 0x27, 0x54, 0x5a, 0xf8, 0x11 }
-};
-
-static EFI_GUID my_gLenovoAoacDxeGuid = {
-  0xb2a23305, 0x9455, 0x489c, { 0xaa, 0x81, 0x21, 0xdb, 0x48, 0xc4, 0x1e, 0xab }
-};
-
-static EFI_GUID my_gLenovoSystemAhciBusSmmGuid = {
-  0xb31ff060, 0x8363, 0x11df, { 0x83, 0x95, 0x8, 0x0, 0x20, 0xc, 0x9a, 0x66 }
-};
-
-static EFI_GUID my_gLenovoSystemRuntimeDxeGuid = {
-  0xb601f8c4, 0x43b7, 0x4784, { 0x95, 0xb1, 0xf4, 0x22, 0x6c, 0xb4, 0xc, 0xee }
-};
-
-static EFI_GUID my_gLenovoMebxSetupBrowserGuid = {
-  0xb62efbbb, 0x3923, 0x4cb9, { 0xa6, 0xe8, 0xdb, 0x81, 0x8e, 0x82, 0x8a, 0x80 }
-};
-
-static EFI_GUID my_gLenovoOsOptDefaultDxeGuid = {
-  0xb63ebf4e, 0xd196, 0x40ba, { 0xab, 0x63, 0x1f, 0xa9, 0xa6, 0x6, 0x8e, 0x84 }
-};
-
-static EFI_GUID my_gLenovoSoundServiceGuid = {
-  0xb65971be, 0xbabf, 0x49ed, { 0x9d, 0xd2, 0x48, 0xec, 0x8d, 0xb4, 0xab, 0xd3 }
-};
-
-static EFI_GUID my_gLenovoIFfsDxeGuid = {
-  0xb6b9295f, 0xcabf, 0x4cec, { 0xbb, 0x14, 0xfe, 0x42, 0x46, 0xf2, 0x17, 0x3a }
-};
-
-static EFI_GUID my_gLenovoSystemSmmCommunicationSmmGuid = {
-  0xb74bb37a, 0xeca2, 0x4f79, { 0xa5, 0x44, 0x90, 0x56, 0x9a, 0xbe, 0x6b, 0x99 }
-};
-
-static EFI_GUID my_gLenovoUserManagerDxeGuid = {
-  0xb8a6e7c5, 0xb8fd, 0x425c, { 0xa6, 0x7e, 0x10, 0x9, 0xdf, 0x1f, 0x10, 0xb5 }
-};
-
-static EFI_GUID my_gLenovoUefiPxeBcDxeBinGuid = {
-  0xb95e9fda, 0x26de, 0x48d2, { 0x88, 0x7, 0x1f, 0x91, 0x7, 0xac, 0x5e, 0x3a }
-};
-
-static EFI_GUID my_gLenovoBoardInfoDxeGuid = {
-  0xb9a3f174, 0x1b36, 0x4aec, { 0x99, 0xe2, 0xf2, 0x85, 0x5e, 0xb4, 0xc3, 0xde }
-};
-
-static EFI_GUID my_gLenovoSystemFlashCommunicationSmmGuid = {
-  0xb9caba9b, 0xe5c5, 0x41dc, { 0x86, 0xe2, 0xe7, 0xce, 0xf8, 0x7b, 0x81, 0xcb }
-};
-
-static EFI_GUID my_gLenovoSmbiosTcgDxeGuid = {
-  0xb9f93638, 0x35f5, 0x447d, { 0xb9, 0x8, 0xa2, 0xb8, 0x52, 0xaa, 0xb, 0x89 }
-};
-
-static EFI_GUID my_gLenovoCpuIoGuid = {
-  0xbae7599f, 0x3c6b, 0x43b7, { 0xbd, 0xf0, 0x9c, 0xe0, 0x7a, 0xa9, 0x1a, 0xa6 }
-};
-
-static EFI_GUID my_gLenovoOsOptDefaultSmmGuid = {
-  0xbaf029a0, 0xb2f3, 0x45ee, { 0x8b, 0x52, 0xd4, 0x2, 0x17, 0x7b, 0xe6, 0xb8 }
-};
-
-static EFI_GUID my_gLenovoSystemAhciAtaAtapiPassThruSmmGuid = {
-  0xbcb59c90, 0xdc86, 0x11dd, { 0xad, 0x8b, 0x8, 0x0, 0x20, 0xc, 0x9a, 0x66 }
-};
-
-static EFI_GUID my_gLenovoSystemErrorMenuDxeGuid = {
-  0xbd6736ac, 0xb126, 0x4fea, { 0x9d, 0x1d, 0x17, 0x4d, 0x4a, 0x89, 0x9f, 0x22 }
-};
-
-static EFI_GUID my_gLenovoSystemEhciDxeGuid = {
-  0xbdfe430e, 0x8f2a, 0x4db0, { 0x99, 0x91, 0x6f, 0x85, 0x65, 0x94, 0x77, 0x7e }
-};
-
-static EFI_GUID my_gLenovoStatusCodeMeDebugDxeGuid = {
-  0xbf73d2bf, 0xac8c, 0x4d83, { 0xa3, 0xb9, 0x4a, 0xf, 0x42, 0x0, 0x74, 0xb3 }
-};
-
-static EFI_GUID my_gLenovoSystemTextConsoleVgaDxeGuid = {
-  0xbf89f10d, 0xb205, 0x474f, { 0x96, 0xe3, 0x7a, 0x7b, 0xb1, 0xb4, 0xa4, 0x7 }
-};
-
-static EFI_GUID my_gLenovoMailBoxSmmGuid = {
-  0xbfee74c2, 0x60bd, 0x467b, { 0x92, 0x61, 0xb7, 0x2a, 0x88, 0x1e, 0x49, 0xee }
-};
-
-static EFI_GUID my_gLenovoSmmFdiskOemGuid = {
-  0xc07cccfc, 0xb4bf, 0x4a30, { 0xa2, 0x5f, 0x1f, 0x57, 0xc0, 0x52, 0x26, 0x29 }
-};
-
-static EFI_GUID my_gLenovoSystemStatusCodePort80SmmGuid = {
-  0xc0cfeb8b, 0x6ee1, 0x443b, { 0xbc, 0xc9, 0x85, 0x4e, 0x7c, 0x9b, 0x41, 0x6d }
-};
-
-static EFI_GUID my_gLenovoPchSpiRuntimeGuid = {
-  0xc194c6ea, 0xb68c, 0x4981, { 0xb6, 0x4b, 0x9b, 0xd2, 0x71, 0x47, 0x4b, 0x20 }
-};
-
-static EFI_GUID my_gLenovoSmmAslSmiGuid = {
-  0xc3ee3ef0, 0x63e6, 0x4f59, { 0xa4, 0x37, 0xaf, 0xa6, 0x3c, 0x46, 0xc8, 0x35 }
-};
-
-static EFI_GUID my_gLenovoVariableDefaultGuid = {
-  0xc69bf28b, 0x16c3, 0x434f, { 0xa4, 0xa4, 0x29, 0x2b, 0xdb, 0xf, 0x4d, 0x12 }
-};
-
-static EFI_GUID my_gLenovoPchS3SupportGuid = {
-  0xc7ea9787, 0xca0a, 0x43b4, { 0xb1, 0xe5, 0x25, 0xef, 0x87, 0x39, 0x1f, 0x8d }
-};
-
-static EFI_GUID my_gLenovoSvpManagerDxeGuid = {
-  0xc80ea8f3, 0xa3c9, 0x4225, { 0xaa, 0x60, 0x76, 0x9d, 0xd4, 0xc7, 0x4e, 0x43 }
-};
-
-static EFI_GUID my_gLenovoSystemDiagnosticSummaryScreenDxeGuid = {
-  0xc82919d6, 0x33fd, 0x43ed, { 0x80, 0xc, 0x63, 0x5a, 0x33, 0x69, 0xd0, 0xf3 }
-};
-
-static EFI_GUID my_gLenovoSystemAcceleratorKeyDxeGuid = {
-  0xc89851dd, 0x5ea0, 0x42ce, { 0x89, 0x34, 0xeb, 0x8e, 0xa6, 0x8, 0xfb, 0xa9 }
-};
-
-static EFI_GUID my_gLenovoSystemFlashUpdateDriverDxeGuid = {
-  0xc8ab0f4e, 0x26fe, 0x40f1, { 0x95, 0x79, 0xea, 0x8d, 0x30, 0xd5, 0x3, 0xa4 }
-};
-
-static EFI_GUID my_gLenovoSmapiSmmGuid = {
-  0xc97809c0, 0x5f90, 0x4466, { 0x8b, 0x38, 0x34, 0x1d, 0x7a, 0x67, 0xcf, 0x54 }
-};
-
-static EFI_GUID my_gLenovoSystemDiskIoDxeGuid = {
-  0xca261a26, 0x7718, 0x4b9b, { 0x8a, 0x7, 0x51, 0x78, 0xb1, 0xae, 0x3a, 0x2 }
-};
-
-static EFI_GUID my_gLenovoSystemDataHubStdErrDxeGuid = {
-  0xca515306, 0xce, 0x4032, { 0x87, 0x4e, 0x11, 0xb7, 0x55, 0xff, 0x68, 0x66 }
-};
-
-static EFI_GUID my_gLenovoSystemKeyDescDxeGuid = {
-  0xca7acef3, 0x1181, 0x4ae0, { 0x95, 0xa7, 0xf, 0x1f, 0xd8, 0xaf, 0xd2, 0xed }
-};
-
-static EFI_GUID my_gLenovoHdpManagerDxeGuid = {
-  0xca9725c0, 0x12e5, 0x4fac, { 0xad, 0x58, 0xd9, 0xaa, 0xb0, 0x3b, 0x8f, 0x11 }
-};
-
-static EFI_GUID my_gLenovoPlatformSmmGuid = {
-  0xcb73c3d9, 0x2f01, 0x4342, { 0xae, 0x67, 0x4, 0xdd, 0xe5, 0x26, 0x40, 0x92 }
-};
-
-static EFI_GUID my_gLenovoEn25Qh32FlashPartSmmGuid = {
-  0xcbca3d88, 0xcb1e, 0x49c3, { 0xb4, 0x48, 0x5f, 0xf2, 0x87, 0xc5, 0x8d, 0x40 }
-};
-
-static EFI_GUID my_gLenovoVideoInitDxeGuid = {
-  0xcc71b046, 0xcf07, 0x4dae, { 0xae, 0xad, 0x70, 0x46, 0x84, 0x5b, 0xcd, 0x8a }
-};
-
-static EFI_GUID my_gLenovoSystemFontDxeGuid = {
-  0xcc84d725, 0xda1e, 0x46a7, { 0x9e, 0x75, 0x4b, 0xac, 0xf1, 0xfd, 0x39, 0x2 }
-};
-
-static EFI_GUID my_gLenovoSystemSetupAdvancedDxeGuid = {
-  0xccabd229, 0x51c4, 0x4de7, { 0xae, 0x2f, 0x3a, 0xaf, 0x71, 0xf9, 0xec, 0xe5 }
-};
-
-static EFI_GUID my_gLenovoSystemGraphicsConsoleDxeGuid = {
-  0xcccb0c28, 0x4b24, 0x11d5, { 0x9a, 0x5a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d }
-};
-
-static EFI_GUID my_gLenovoSystemSmBiosSmmGuid = {
-  0xcd92b9b9, 0x2d4c, 0x466b, { 0x84, 0x58, 0x95, 0x44, 0x7d, 0x8e, 0x4a, 0xfe }
-};
-
-static EFI_GUID my_gLenovoSystemBusIsaRtcSmmGuid = {
-  0xcdc0191e, 0x1891, 0x4119, { 0x81, 0x7e, 0xb, 0x6a, 0x36, 0x85, 0xa5, 0x11 }
-};
-
-static EFI_GUID my_gLenovoSystemAcpiSmiServicesDxe2Guid = {
-  0xcf9668f7, 0xb0f0, 0x4d7f, { 0xb4, 0x1e, 0xae, 0xc7, 0x94, 0xee, 0xc7, 0xfc }
-};
-
-static EFI_GUID my_gLenovoPlatformHiiAdvancedDxeGuid = {
-  0xcfef94c4, 0x4167, 0x466a, { 0x88, 0x93, 0x87, 0x79, 0x45, 0x9d, 0xfa, 0x86 }
-};
-
-static EFI_GUID my_gLenovoVariableSmmGuid = {
-  0xd5196882, 0xa970, 0x4510, { 0x8f, 0xb9, 0xd7, 0x58, 0x3b, 0x69, 0x6, 0xe7 }
-};
-
-static EFI_GUID my_gLenovoSystemFormBrowserSimpleTextViewDxeGuid = {
-  0xd687e479, 0xdb37, 0x4bce, { 0x86, 0x4a, 0x2, 0xee, 0xf6, 0x81, 0x9d, 0xf1 }
-};
-
-static EFI_GUID my_gLenovoN25Q032FlashPartSmmGuid = {
-  0xd689f8c7, 0xc354, 0x4215, { 0xaa, 0x48, 0xb6, 0xad, 0x66, 0xc7, 0x7e, 0xaf }
-};
-
-static EFI_GUID my_gLenovoMfgBenchEventDxeGuid = {
-  0xd83977df, 0x34c3, 0x4a21, { 0xa1, 0x4, 0x36, 0x9b, 0x8d, 0x4f, 0xa7, 0xb7 }
-};
-
-static EFI_GUID my_gLenovoUdp6DxeBinGuid = {
-  0xd912c7bc, 0xf098, 0x4367, { 0x92, 0xba, 0xe9, 0x11, 0x8, 0x3c, 0x7b, 0xe }
-};
-
-static EFI_GUID my_gLenovoSystemStatusCodeGenericSmmGuid = {
-  0xda5d9983, 0x33c, 0x4823, { 0x93, 0x49, 0x8b, 0x1b, 0x6a, 0x79, 0x80, 0x30 }
-};
-
-static EFI_GUID my_gLenovoMx25L64XflashPartSmmGuid = {
-  0xdb4db11a, 0xe5c, 0x40b5, { 0x8e, 0x46, 0x17, 0xd0, 0x44, 0x86, 0xa2, 0x1b }
-};
-
-static EFI_GUID my_gLenovoMtftp4DxeBinGuid = {
-  0xdc3641b8, 0x2fa8, 0x4ed3, { 0xbc, 0x1f, 0xf9, 0x96, 0x2a, 0x3, 0x45, 0x4b }
-};
-
-static EFI_GUID my_gLenovoIFfsDxePolicyInitGuid = {
-  0xddb412a6, 0xe3f3, 0x4e9e, { 0x90, 0xa3, 0x2a, 0x99, 0x12, 0x70, 0x21, 0x9c }
-};
-
-static EFI_GUID my_gLenovoWmaUsbDxeGuid = {
-  0xe0adb57e, 0xe1b6, 0x44ec, { 0xbf, 0x2e, 0x84, 0x28, 0x74, 0xa2, 0x6c, 0x83 }
-};
-
-static EFI_GUID my_gLenovoSystemScsiOpromPassThruDxeGuid = {
-  0xe1ad4352, 0x2610, 0x4dd6, { 0xbb, 0x8f, 0x8b, 0xb2, 0xb0, 0x33, 0x83, 0xa3 }
-};
-
-static EFI_GUID my_gLenovoPasswordCpGuid = {
-  0xe4f272da, 0x237f, 0x454c, { 0x88, 0x68, 0xfc, 0xf0, 0x96, 0xcf, 0x1c, 0x6c }
-};
-
-static EFI_GUID my_gLenovoSystemDiagnosticSplashScreenDxeGuid = {
-  0xe5d0bbdc, 0x1bbc, 0x49b7, { 0xa8, 0xb6, 0x67, 0xaa, 0xf0, 0xa1, 0xcd, 0x9e }
-};
-
-static EFI_GUID my_gLenovoIbexPeakFlashControllerSmmGuid = {
-  0xe84aef95, 0x7ca6, 0x4b2f, { 0xa3, 0x98, 0xb1, 0x4d, 0x1c, 0x67, 0xa0, 0xb1 }
-};
-
-static EFI_GUID my_gLenovoSmmSleepEventGuid = {
-  0xe8dc00ba, 0x411f, 0x4d52, { 0xb9, 0x25, 0x50, 0x78, 0x54, 0x36, 0xac, 0x81 }
-};
-
-static EFI_GUID my_gLenovoAt24Rf08EepromDxeGuid = {
-  0xe94db579, 0x61b, 0x437b, { 0x83, 0xc2, 0x65, 0xc0, 0xae, 0x7c, 0x14, 0xe2 }
-};
-
-static EFI_GUID my_gLenovoKbdConfigGuid = {
-  0xe9b4b126, 0x4e13, 0x41f5, { 0x9e, 0x4c, 0x9b, 0xf8, 0x8b, 0x3c, 0x1b, 0xc }
-};
-
-static EFI_GUID my_gLenovoSystemLegacyBiosDxeGuid = {
-  0xea2ec402, 0x2fd5, 0x475f, { 0x92, 0x2c, 0x98, 0xea, 0xe0, 0x37, 0x63, 0x12 }
-};
-
-static EFI_GUID my_gLenovoVproCiraHotKeyGuid = {
-  0xea9e92e1, 0x22ef, 0x4b5f, { 0xa5, 0xee, 0x13, 0x17, 0xb1, 0xe7, 0x7b, 0x10 }
-};
-
-static EFI_GUID my_gLenovoOemHookGuid = {
-  0xeaaf7109, 0xec2d, 0x4a30, { 0xbf, 0x4f, 0x62, 0x14, 0x8, 0x63, 0xe, 0x4c }
-};
-
-static EFI_GUID my_gLenovoSystemSmbiosDxeGuid = {
-  0xeaf59c0e, 0xbd46, 0x413a, { 0x9a, 0xe9, 0xdd, 0x9f, 0x6d, 0x1a, 0x92, 0x7d }
-};
-
-static EFI_GUID my_gLenovoSecureKeySmmGuid = {
-  0xeb6eebf4, 0x1ec3, 0x4d69, { 0x9d, 0x82, 0x65, 0xbf, 0x6c, 0x57, 0x9b, 0x34 }
-};
-
-static EFI_GUID my_gLenovoMeConOutReadyGuid = {
-  0xec5a555b, 0x6384, 0x4c00, { 0x86, 0x25, 0x2c, 0x17, 0x68, 0xb9, 0x5b, 0x38 }
-};
-
-static EFI_GUID my_gLenovoFingerprintCpGuid = {
-  0xee30fd26, 0x1524, 0x4ca2, { 0xb5, 0x6d, 0x34, 0x58, 0x30, 0xdc, 0x9c, 0xdb }
-};
-
-static EFI_GUID my_gLenovoSystemSmmUsbLegacySmmGuid = {
-  0xef33c296, 0xf64c, 0x4146, { 0xad, 0x4, 0x34, 0x78, 0x99, 0x70, 0x2c, 0x84 }
-};
-
-static EFI_GUID my_gLenovoSystemWatchdogTimerDxeGuid = {
-  0xf099d67f, 0x71ae, 0x4c36, { 0xb2, 0xa3, 0xdc, 0xeb, 0xe, 0xb2, 0xb7, 0xd8 }
-};
-
-static EFI_GUID my_gLenovoN25Q032FlashPartDxeGuid = {
-  0xf1bdcec7, 0x31d1, 0x4f0f, { 0xaf, 0x62, 0xd0, 0x2a, 0x44, 0x7, 0x60, 0x26 }
-};
-
-static EFI_GUID my_gLenovoSystemSecurityStubDxeGuid = {
-  0xf1efb523, 0x3d59, 0x4888, { 0xbb, 0x71, 0xea, 0xa5, 0xa9, 0x66, 0x28, 0xfa }
-};
-
-static EFI_GUID my_gLenovoSvpManagerSmmGuid = {
-  0xf46d8ea6, 0x4a67, 0x4872, { 0xb0, 0xd1, 0xd4, 0xfd, 0xea, 0xb, 0x69, 0x2f }
-};
-
-static EFI_GUID my_gLenovoStartupMenuDxeGuid = {
-  0xf46ee6f4, 0x4785, 0x43a3, { 0x92, 0x3d, 0x7f, 0x78, 0x6c, 0x3c, 0x84, 0x79 }
-};
-
-static EFI_GUID my_gLenovoPlatformS3SaveSmmGuid = {
-  0xf5ac7057, 0x5650, 0x466e, { 0xb6, 0x92, 0x76, 0xa4, 0x72, 0x23, 0xef, 0xb0 }
-};
-
-static EFI_GUID my_gLenovoSystemCmosDxeGuid = {
-  0xf642a9d7, 0x26b7, 0x47cb, { 0xac, 0xc8, 0x13, 0x59, 0x51, 0xac, 0x93, 0xf8 }
-};
-
-static EFI_GUID my_gLenovoFingerprintSmmGuid = {
-  0xf746d37f, 0xf6c6, 0x43c0, { 0x94, 0xdb, 0x46, 0x6f, 0x5f, 0x10, 0xe0, 0x30 }
-};
-
-static EFI_GUID my_gLenovoPowerManagement2Guid = {
-  0xf7731b4c, 0x58a2, 0x4df4, { 0x89, 0x80, 0x56, 0x45, 0xd3, 0x9e, 0xce, 0x58 }
-};
-
-static EFI_GUID my_gLenovoW25Q32FlashPartSmmGuid = {
-  0xf8ca70b4, 0x6a85, 0x4616, { 0x8b, 0xde, 0x3e, 0xc5, 0x69, 0x64, 0x4a, 0xc3 }
-};
-
-static EFI_GUID my_gLenovoSystemUsbDatabaseDxeGuid = {
-  0xf94700a3, 0xf49f, 0x4cd2, { 0xbf, 0x25, 0x19, 0xe2, 0x80, 0xb7, 0x2e, 0x3b }
-};
-
-static EFI_GUID my_gLenovoTcgSmmGuid = {
-  0xf94a048b, 0x7fc4, 0x4abc, { 0x85, 0xa6, 0x86, 0x16, 0xa6, 0xd3, 0xcd, 0xce }
-};
-
-static EFI_GUID my_gLenovoSlp2SmmGuid = {
-  0xfa4f6740, 0xb95a, 0x43f9, { 0x90, 0xb5, 0x78, 0xd8, 0x14, 0x7c, 0x2, 0x19 }
-};
-
-static EFI_GUID my_gLenovoFitDiagnosticsGuid = {
-  0xfbb3f083, 0x5787, 0x45af, { 0xba, 0xdc, 0x66, 0x48, 0x54, 0x10, 0xf, 0x20 }
-};
-
-static EFI_GUID my_gLenovoSystemSecureFlashSleepTrapSmmGuid = {
-  0xfce47c4e, 0x5ecc, 0x4a41, { 0xb9, 0xe, 0xb, 0xab, 0x9, 0x96, 0x8d, 0x2 }
-};
-
-static EFI_GUID my_gLenovoTxtDxeGuid = {
-  0xff917e22, 0xa228, 0x448d, { 0xbd, 0xaa, 0x68, 0xef, 0xcc, 0xdd, 0xa5, 0xd3 }
-};
-
-static EFI_GUID my_gLenovoEaiaPeiGuid = {
-  0x1e8dcce9, 0x341c, 0x4219, { 0xa7, 0x90, 0xf1, 0x4c, 0x28, 0xb5, 0x1c, 0xee }
-};
-
-static EFI_GUID my_gLenovoPlatformStage2PeiGuid = {
-  0x233df097, 0x3218, 0x47b2, { 0x9e, 0x9, 0xfe, 0x58, 0xc2, 0xb2, 0xd, 0x22 }
-};
-
-static EFI_GUID my_gLenovoMiscGaIoPeimGuid = {
-  0x367712fd, 0x6c5a, 0x4600, { 0xbe, 0xa2, 0x9a, 0x1f, 0x81, 0xaa, 0xcc, 0x8 }
-};
-
-static EFI_GUID my_gLenovoPeiMainGuid = {
-  0x52c05b14, 0xb98, 0x496c, { 0xbc, 0x3b, 0x4, 0xb5, 0x2, 0x11, 0xd6, 0x80 }
-};
-
-static EFI_GUID my_gLenovoPlatformStage1PeiGuid = {
-  0x53984c6a, 0x1b4a, 0x4174, { 0x95, 0x12, 0xa6, 0x5e, 0x5b, 0xc8, 0xb2, 0x78 }
-};
-
-static EFI_GUID my_gLenovoFlashProtectPeiGuid = {
-  0x53ac1948, 0xed0, 0x428a, { 0xb4, 0xdd, 0xd2, 0xff, 0xf2, 0xf5, 0x77, 0x6f }
-};
-
-static EFI_GUID my_gLenovoSystemAcpiTablesPeiGuid = {
-  0x55a2532e, 0x297a, 0x4afd, { 0x90, 0xbf, 0x13, 0x9b, 0xff, 0x5b, 0xb4, 0xd7 }
-};
-
-static EFI_GUID my_gLenovoOemSecPeiGuid = {
-  0x5920f406, 0x5868, 0x44f5, { 0xa9, 0xb9, 0x6d, 0x40, 0x31, 0x48, 0x1c, 0xc9 }
-};
-
-static EFI_GUID my_gLenovoSystemUsbBotPeiGuid = {
-  0x8401a046, 0x6f70, 0x4505, { 0x84, 0x71, 0x70, 0x15, 0xb4, 0x3, 0x55, 0xe3 }
-};
-
-static EFI_GUID my_gLenovoSystemBootModePeiGuid = {
-  0x863095d8, 0x3bf4, 0x447c, { 0xae, 0x10, 0x15, 0xb3, 0xae, 0x99, 0x36, 0xfd }
-};
-
-static EFI_GUID my_gLenovoPeiCpuIoGuid = {
-  0x8a78b107, 0xfdd, 0x4cc8, { 0xb7, 0xba, 0xdc, 0x3e, 0x13, 0xcb, 0x85, 0x24 }
-};
-
-static EFI_GUID my_gLenovoSystemS3ResumePeiGuid = {
-  0x8bceddd7, 0xe285, 0x4168, { 0x9b, 0x3f, 0x9, 0xaf, 0x66, 0xc9, 0x3f, 0xfe }
-};
-
-static EFI_GUID my_gLenovoVideoInitPeimGuid = {
-  0x9ccfe1ac, 0x784c, 0x463d, { 0xb1, 0x45, 0x39, 0x6d, 0x70, 0x14, 0xd5, 0x59 }
-};
-
-static EFI_GUID my_gLenovoAt24Rf08EepromPeiGuid = {
-  0x9dd92425, 0x6737, 0x45cd, { 0x82, 0x9c, 0x1a, 0xc2, 0xcd, 0x20, 0xc8, 0x73 }
-};
-
-static EFI_GUID my_gLenovoPostValidatorPeiGuid = {
-  0xb9c37931, 0xf069, 0x418c, { 0x9e, 0x19, 0x31, 0xb0, 0xbc, 0x3, 0x18, 0x87 }
-};
-
-static EFI_GUID my_gLenovoSystemFvFileLoaderGuid = {
-  0xc2223a0b, 0x80d3, 0x4c35, { 0x89, 0x1f, 0xbd, 0xc, 0xc4, 0xe9, 0x90, 0xf0 }
-};
-
-static EFI_GUID my_gLenovoMailBoxPeiGuid = {
-  0xc311c600, 0x84e9, 0x4f1e, { 0xbf, 0x44, 0xbf, 0x36, 0xe3, 0x41, 0x51, 0x58 }
-};
-
-static EFI_GUID my_gLenovoEcIoPeimGuid = {
-  0xc37297cc, 0x3fd9, 0x4026, { 0x98, 0x90, 0x7a, 0x16, 0x28, 0x18, 0x46, 0x20 }
-};
-
-static EFI_GUID my_gLenovoModuleS3ResumePeimGuid = {
-  0xc7ad44b9, 0xa775, 0x4801, { 0xb7, 0x72, 0xa9, 0x64, 0x26, 0x2b, 0xb9, 0x2e }
-};
-
-static EFI_GUID my_gLenovoCpuS3PeimGuid = {
-  0xc866bd71, 0x7c79, 0x4bf1, { 0xa9, 0x3b, 0x6, 0x6b, 0x83, 0xd, 0x8f, 0x9a }
-};
-
-static EFI_GUID my_gLenovoUserManagerPeiGuid = {
-  0xe010bcca, 0x3a3b, 0x4b03, { 0xbc, 0xf4, 0xae, 0x1f, 0x64, 0xa8, 0x5c, 0x89 }
-};
-
-static EFI_GUID my_gLenovoProtectPbpeiGuid = {
-  0xea42b5e6, 0x5e01, 0x4c6e, { 0x81, 0x89, 0xc1, 0xef, 0xa6, 0xac, 0xfd, 0x1 }
-};
-
-static EFI_GUID my_gLenovoIsscPeiGuid = {
-  0xeccbf582, 0xeee1, 0x45b8, { 0x89, 0x26, 0x6, 0x7f, 0x40, 0xb3, 0xe5, 0x5e }
-};
-
-static EFI_GUID my_gLenovoPlatformStage0PeiGuid = {
-  0xed52984e, 0x6ed7, 0x4445, { 0x9d, 0x5d, 0x20, 0xc, 0x32, 0x1, 0xf5, 0x1e }
-};
-
-#define GUID_DB \
-  { &my_gAppPkgTokenSpaceGuid, L"APP_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gArmTokenSpaceGuid, L"ARM_TOKEN_SPACE_GUID" }, \
-  { &my_gArmMpCoreInfoGuid, L"ARM_MP_CORE_INFO_GUID" }, \
-  { &my_gArmMpCoreInfoPpiGuid, L"ARM_MP_CORE_INFO_PPI_GUID" }, \
-  { &my_gArmPlatformTokenSpaceGuid, L"ARM_PLATFORM_TOKEN_SPACE_GUID" }, \
-  { &my_gVariableRuntimeDxeFileGuid, L"VARIABLE_RUNTIME_DXE_FILE_GUID" }, \
-  { &my_gArmVirtTokenSpaceGuid, L"ARM_VIRT_TOKEN_SPACE_GUID" }, \
-  { &my_gEarlyPL011BaseAddressGuid, L"EARLY_P_L011_BASE_ADDRESS_GUID" }, \
-  { &my_gArmVirtVariableGuid, L"ARM_VIRT_VARIABLE_GUID" }, \
-  { &my_gFdtClientProtocolGuid, L"FDT_CLIENT_PROTOCOL_GUID" }, \
-  { &my_gBeagleBoardTokenSpaceGuid, L"BEAGLE_BOARD_TOKEN_SPACE_GUID" }, \
-  { &my_gUefiCorebootModulePkgTokenSpaceGuid, L"UEFI_COREBOOT_MODULE_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gUefiSystemTableInfoGuid, L"UEFI_SYSTEM_TABLE_INFO_GUID" }, \
-  { &my_gUefiFrameBufferInfoGuid, L"UEFI_FRAME_BUFFER_INFO_GUID" }, \
-  { &my_gUefiAcpiBoardInfoGuid, L"UEFI_ACPI_BOARD_INFO_GUID" }, \
-  { &my_gUEfiCorebootPayloadPkgTokenSpaceGuid, L"U_EFI_COREBOOT_PAYLOAD_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gBmpImageGuid, L"BMP_IMAGE_GUID" }, \
-  { &my_gPlatformGOPPolicyGuid, L"PLATFORM_G_O_P_POLICY_GUID" }, \
-  { &my_gEfiRuntimeCryptProtocolGuid, L"EFI_RUNTIME_CRYPT_PROTOCOL_GUID" }, \
-  { &my_gEfiPciExpressBaseAddressGuid, L"EFI_PCI_EXPRESS_BASE_ADDRESS_GUID" }, \
-  { &my_gEfiAcpiDescriptionGuid, L"EFI_ACPI_DESCRIPTION_GUID" }, \
-  { &my_gEfiFlashMapHobGuid, L"EFI_FLASH_MAP_HOB_GUID" }, \
-  { &my_gEfiPciOptionRomTableGuid, L"EFI_PCI_OPTION_ROM_TABLE_GUID" }, \
-  { &my_gDuetConsoleOutConfigGuid, L"DUET_CONSOLE_OUT_CONFIG_GUID" }, \
-  { &my_gDxeCoreFileNameGuid, L"DXE_CORE_FILE_NAME_GUID" }, \
-  { &my_gLdrMemoryDescriptorGuid, L"LDR_MEMORY_DESCRIPTOR_GUID" }, \
-  { &my_gEfiSmmBaseThunkCommunicationGuid, L"EFI_SMM_BASE_THUNK_COMMUNICATION_GUID" }, \
-  { &my_gEfiBootStateGuid, L"EFI_BOOT_STATE_GUID" }, \
-  { &my_gEfiEdkCompatibilityPkgTokenSpaceGuid, L"EFI_EDK_COMPATIBILITY_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gFrameworkBdsFrontPageFormsetGuid, L"FRAMEWORK_BDS_FRONT_PAGE_FORMSET_GUID" }, \
-  { &my_gEcpPeiPciCfgPpiGuid, L"ECP_PEI_PCI_CFG_PPI_GUID" }, \
-  { &my_gEfiPrintProtocolGuid, L"EFI_PRINT_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmBaseHelperReadyProtocolGuid, L"EFI_SMM_BASE_HELPER_READY_PROTOCOL_GUID" }, \
-  { &my_gEmbeddedTokenSpaceGuid, L"EMBEDDED_TOKEN_SPACE_GUID" }, \
-  { &my_gFdtTableGuid, L"FDT_TABLE_GUID" }, \
-  { &my_gFdtHobGuid, L"FDT_HOB_GUID" }, \
-  { &my_gFdtVariableGuid, L"FDT_VARIABLE_GUID" }, \
-  { &my_gEdkiiPlatformHasDeviceTreeGuid, L"EDKII_PLATFORM_HAS_DEVICE_TREE_GUID" }, \
-  { &my_gDtPlatformFormSetGuid, L"DT_PLATFORM_FORM_SET_GUID" }, \
-  { &my_gDtPlatformDefaultDtbFileGuid, L"DT_PLATFORM_DEFAULT_DTB_FILE_GUID" }, \
-  { &my_gConsolePrefFormSetGuid, L"CONSOLE_PREF_FORM_SET_GUID" }, \
-  { &my_gHardwareInterruptProtocolGuid, L"HARDWARE_INTERRUPT_PROTOCOL_GUID" }, \
-  { &my_gHardwareInterrupt2ProtocolGuid, L"HARDWARE_INTERRUPT2_PROTOCOL_GUID" }, \
-  { &my_gEfiDebugSupportPeriodicCallbackProtocolGuid, L"EFI_DEBUG_SUPPORT_PERIODIC_CALLBACK_PROTOCOL_GUID" }, \
-  { &my_gEmbeddedDeviceGuid, L"EMBEDDED_DEVICE_GUID" }, \
-  { &my_gEmbeddedExternalDeviceProtocolGuid, L"EMBEDDED_EXTERNAL_DEVICE_PROTOCOL_GUID" }, \
-  { &my_gEmbeddedGpioProtocolGuid, L"EMBEDDED_GPIO_PROTOCOL_GUID" }, \
-  { &my_gPeCoffLoaderProtocolGuid, L"PE_COFF_LOADER_PROTOCOL_GUID" }, \
-  { &my_gEfiMmcHostProtocolGuid, L"EFI_MMC_HOST_PROTOCOL_GUID" }, \
-  { &my_gAndroidFastbootTransportProtocolGuid, L"ANDROID_FASTBOOT_TRANSPORT_PROTOCOL_GUID" }, \
-  { &my_gAndroidFastbootPlatformProtocolGuid, L"ANDROID_FASTBOOT_PLATFORM_PROTOCOL_GUID" }, \
-  { &my_gUsbDeviceProtocolGuid, L"USB_DEVICE_PROTOCOL_GUID" }, \
-  { &my_gPlatformGpioProtocolGuid, L"PLATFORM_GPIO_PROTOCOL_GUID" }, \
-  { &my_gAndroidBootImgProtocolGuid, L"ANDROID_BOOT_IMG_PROTOCOL_GUID" }, \
-  { &my_gEdkiiEmbeddedGpioPpiGuid, L"EDKII_EMBEDDED_GPIO_PPI_GUID" }, \
-  { &my_gEmuThunkProtocolGuid, L"EMU_THUNK_PROTOCOL_GUID" }, \
-  { &my_gEmuIoThunkProtocolGuid, L"EMU_IO_THUNK_PROTOCOL_GUID" }, \
-  { &my_gEmuGraphicsWindowProtocolGuid, L"EMU_GRAPHICS_WINDOW_PROTOCOL_GUID" }, \
-  { &my_gEmuThreadThunkProtocolGuid, L"EMU_THREAD_THUNK_PROTOCOL_GUID" }, \
-  { &my_gEmuBlockIoProtocolGuid, L"EMU_BLOCK_IO_PROTOCOL_GUID" }, \
-  { &my_gEmuSnpProtocolGuid, L"EMU_SNP_PROTOCOL_GUID" }, \
-  { &my_gEmuThunkPpiGuid, L"EMU_THUNK_PPI_GUID" }, \
-  { &my_gEmulatorPkgTokenSpaceGuid, L"EMULATOR_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gEmuSystemConfigGuid, L"EMU_SYSTEM_CONFIG_GUID" }, \
-  { &my_gEmuVirtualDisksGuid, L"EMU_VIRTUAL_DISKS_GUID" }, \
-  { &my_gEmuPhysicalDisksGuid, L"EMU_PHYSICAL_DISKS_GUID" }, \
-  { &my_gFmpDevicePkgTokenSpaceGuid, L"FMP_DEVICE_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiIntelFrameworkModulePkgTokenSpaceGuid, L"EFI_INTEL_FRAMEWORK_MODULE_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiDataHubStatusCodeRecordGuid, L"EFI_DATA_HUB_STATUS_CODE_RECORD_GUID" }, \
-  { &my_gTianoCustomDecompressGuid, L"TIANO_CUSTOM_DECOMPRESS_GUID" }, \
-  { &my_gEfiAcpiVariableCompatiblityGuid, L"EFI_ACPI_VARIABLE_COMPATIBLITY_GUID" }, \
-  { &my_gEfiLegacyBiosGuid, L"EFI_LEGACY_BIOS_GUID" }, \
-  { &my_gEfiLegacyDevOrderVariableGuid, L"EFI_LEGACY_DEV_ORDER_VARIABLE_GUID" }, \
-  { &my_gEfiUpdateDataFileGuid, L"EFI_UPDATE_DATA_FILE_GUID" }, \
-  { &my_gBlockIoVendorGuid, L"BLOCK_IO_VENDOR_GUID" }, \
-  { &my_gBootManagerFormSetGuid, L"BOOT_MANAGER_FORM_SET_GUID" }, \
-  { &my_gDeviceManagerFormSetGuid, L"DEVICE_MANAGER_FORM_SET_GUID" }, \
-  { &my_gDriverHealthFormSetGuid, L"DRIVER_HEALTH_FORM_SET_GUID" }, \
-  { &my_gBootMaintFormSetGuid, L"BOOT_MAINT_FORM_SET_GUID" }, \
-  { &my_gFileExploreFormSetGuid, L"FILE_EXPLORE_FORM_SET_GUID" }, \
-  { &my_gBdsLibStringPackageGuid, L"BDS_LIB_STRING_PACKAGE_GUID" }, \
-  { &my_gLastEnumLangGuid, L"LAST_ENUM_LANG_GUID" }, \
-  { &my_gHdBootDevicePathVariablGuid, L"HD_BOOT_DEVICE_PATH_VARIABL_GUID" }, \
-  { &my_gEfiVgaMiniPortProtocolGuid, L"EFI_VGA_MINI_PORT_PROTOCOL_GUID" }, \
-  { &my_gEfiIsaIoProtocolGuid, L"EFI_ISA_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiIsaAcpiProtocolGuid, L"EFI_ISA_ACPI_PROTOCOL_GUID" }, \
-  { &my_gEfiOEMBadgingProtocolGuid, L"EFI_O_E_M_BADGING_PROTOCOL_GUID" }, \
-  { &my_gExitPmAuthProtocolGuid, L"EXIT_PM_AUTH_PROTOCOL_GUID" }, \
-  { &my_gEfiCacheSubClassGuid, L"EFI_CACHE_SUB_CLASS_GUID" }, \
-  { &my_gEfiMemorySubClassGuid, L"EFI_MEMORY_SUB_CLASS_GUID" }, \
-  { &my_gEfiMiscSubClassGuid, L"EFI_MISC_SUB_CLASS_GUID" }, \
-  { &my_gEfiProcessorSubClassGuid, L"EFI_PROCESSOR_SUB_CLASS_GUID" }, \
-  { &my_gEfiCapsuleGuid, L"EFI_CAPSULE_GUID" }, \
-  { &my_gEfiConfigFileNameGuid, L"EFI_CONFIG_FILE_NAME_GUID" }, \
-  { &my_gEfiSmmPeiSmramMemoryReserveGuid, L"EFI_SMM_PEI_SMRAM_MEMORY_RESERVE_GUID" }, \
-  { &my_gSmmCommunicateHeaderGuid, L"SMM_COMMUNICATE_HEADER_GUID" }, \
-  { &my_gEfiFirmwareFileSystemGuid, L"EFI_FIRMWARE_FILE_SYSTEM_GUID" }, \
-  { &my_gEfiPeiIdeBlockIoPpiGuid, L"EFI_PEI_IDE_BLOCK_IO_PPI_GUID" }, \
-  { &my_gEfiPei144FloppyBlockIoPpiGuid, L"EFI_PEI144_FLOPPY_BLOCK_IO_PPI_GUID" }, \
-  { &my_gEfiPeiBootScriptExecuterPpiGuid, L"EFI_PEI_BOOT_SCRIPT_EXECUTER_PPI_GUID" }, \
-  { &my_gEfiPeiSecurityPpiGuid, L"EFI_PEI_SECURITY_PPI_GUID" }, \
-  { &my_gEfiPeiSmbusPpiGuid, L"EFI_PEI_SMBUS_PPI_GUID" }, \
-  { &my_gEfiPciCfgPpiInServiceTableGuid, L"EFI_PCI_CFG_PPI_IN_SERVICE_TABLE_GUID" }, \
-  { &my_gEfiPeiReadOnlyVariablePpiGuid, L"EFI_PEI_READ_ONLY_VARIABLE_PPI_GUID" }, \
-  { &my_gEfiPeiSectionExtractionPpiGuid, L"EFI_PEI_SECTION_EXTRACTION_PPI_GUID" }, \
-  { &my_gEfiPeiFvFileLoaderPpiGuid, L"EFI_PEI_FV_FILE_LOADER_PPI_GUID" }, \
-  { &my_gEfiFindFvPpiGuid, L"EFI_FIND_FV_PPI_GUID" }, \
-  { &my_gEfiPeiS3ResumePpiGuid, L"EFI_PEI_S3_RESUME_PPI_GUID" }, \
-  { &my_gEfiAcpiS3SaveProtocolGuid, L"EFI_ACPI_S3_SAVE_PROTOCOL_GUID" }, \
-  { &my_gEfiAcpiSupportProtocolGuid, L"EFI_ACPI_SUPPORT_PROTOCOL_GUID" }, \
-  { &my_gEfiBootScriptSaveProtocolGuid, L"EFI_BOOT_SCRIPT_SAVE_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacyBiosProtocolGuid, L"EFI_LEGACY_BIOS_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacyBiosPlatformProtocolGuid, L"EFI_LEGACY_BIOS_PLATFORM_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacyInterruptProtocolGuid, L"EFI_LEGACY_INTERRUPT_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacyRegionProtocolGuid, L"EFI_LEGACY_REGION_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacy8259ProtocolGuid, L"EFI_LEGACY8259_PROTOCOL_GUID" }, \
-  { &my_gEfiCpuIoProtocolGuid, L"EFI_CPU_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiDataHubProtocolGuid, L"EFI_DATA_HUB_PROTOCOL_GUID" }, \
-  { &my_gEfiFirmwareVolumeProtocolGuid, L"EFI_FIRMWARE_VOLUME_PROTOCOL_GUID" }, \
-  { &my_gEfiSectionExtractionProtocolGuid, L"EFI_SECTION_EXTRACTION_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiProtocolGuid, L"EFI_HII_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiCompatibilityProtocolGuid, L"EFI_HII_COMPATIBILITY_PROTOCOL_GUID" }, \
-  { &my_gFrameworkEfiMpServiceProtocolGuid, L"FRAMEWORK_EFI_MP_SERVICE_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmBaseProtocolGuid, L"EFI_SMM_BASE_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmAccessProtocolGuid, L"EFI_SMM_ACCESS_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmControlProtocolGuid, L"EFI_SMM_CONTROL_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmSwDispatchProtocolGuid, L"EFI_SMM_SW_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmSxDispatchProtocolGuid, L"EFI_SMM_SX_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmPeriodicTimerDispatchProtocolGuid, L"EFI_SMM_PERIODIC_TIMER_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmUsbDispatchProtocolGuid, L"EFI_SMM_USB_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmGpiDispatchProtocolGuid, L"EFI_SMM_GPI_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmStandbyButtonDispatchProtocolGuid, L"EFI_SMM_STANDBY_BUTTON_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmPowerButtonDispatchProtocolGuid, L"EFI_SMM_POWER_BUTTON_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmIchnDispatchProtocolGuid, L"EFI_SMM_ICHN_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmCpuIoGuid, L"EFI_SMM_CPU_IO_GUID" }, \
-  { &my_gEfiFormCallbackProtocolGuid, L"EFI_FORM_CALLBACK_PROTOCOL_GUID" }, \
-  { &my_gEfiFormBrowserProtocolGuid, L"EFI_FORM_BROWSER_PROTOCOL_GUID" }, \
-  { &my_gEfiFormBrowserCompatibilityProtocolGuid, L"EFI_FORM_BROWSER_COMPATIBILITY_PROTOCOL_GUID" }, \
-  { &my_gFramerworkEfiFirmwareVolumeBlockProtocolGuid, L"FRAMERWORK_EFI_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmCpuSaveStateProtocolGuid, L"EFI_SMM_CPU_SAVE_STATE_PROTOCOL_GUID" }, \
-  { &my_gIntelFsp2PkgTokenSpaceGuid, L"INTEL_FSP2_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gFspHeaderFileGuid, L"FSP_HEADER_FILE_GUID" }, \
-  { &my_gFspReservedMemoryResourceHobGuid, L"FSP_RESERVED_MEMORY_RESOURCE_HOB_GUID" }, \
-  { &my_gFspNonVolatileStorageHobGuid, L"FSP_NON_VOLATILE_STORAGE_HOB_GUID" }, \
-  { &my_gFspBootLoaderTolumHobGuid, L"FSP_BOOT_LOADER_TOLUM_HOB_GUID" }, \
-  { &my_gFspPerformanceDataGuid, L"FSP_PERFORMANCE_DATA_GUID" }, \
-  { &my_gFspEventEndOfFirmwareGuid, L"FSP_EVENT_END_OF_FIRMWARE_GUID" }, \
-  { &my_gIntelFsp2WrapperTokenSpaceGuid, L"INTEL_FSP2_WRAPPER_TOKEN_SPACE_GUID" }, \
-  { &my_gFspApiPerformanceGuid, L"FSP_API_PERFORMANCE_GUID" }, \
-  { &my_gFspHobGuid, L"FSP_HOB_GUID" }, \
-  { &my_gFspSiliconInitDonePpiGuid, L"FSP_SILICON_INIT_DONE_PPI_GUID" }, \
-  { &my_gTopOfTemporaryRamPpiGuid, L"TOP_OF_TEMPORARY_RAM_PPI_GUID" }, \
-  { &my_gAddPerfRecordProtocolGuid, L"ADD_PERF_RECORD_PROTOCOL_GUID" }, \
-  { &my_gIntelFspPkgTokenSpaceGuid, L"INTEL_FSP_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gFspBootLoaderTemporaryMemoryGuid, L"FSP_BOOT_LOADER_TEMPORARY_MEMORY_GUID" }, \
-  { &my_gFspReservedMemoryResourceHobTsegGuid, L"FSP_RESERVED_MEMORY_RESOURCE_HOB_TSEG_GUID" }, \
-  { &my_gFspReservedMemoryResourceHobGfxGuid, L"FSP_RESERVED_MEMORY_RESOURCE_HOB_GFX_GUID" }, \
-  { &my_gFspReservedMemoryResourceHobMiscGuid, L"FSP_RESERVED_MEMORY_RESOURCE_HOB_MISC_GUID" }, \
-  { &my_gFspWrapperTokenSpaceGuid, L"FSP_WRAPPER_TOKEN_SPACE_GUID" }, \
-  { &my_gFspInitDonePpiGuid, L"FSP_INIT_DONE_PPI_GUID" }, \
-  { &my_gIntelSiliconPkgTokenSpaceGuid, L"INTEL_SILICON_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gIntelSmbiosDataHobGuid, L"INTEL_SMBIOS_DATA_HOB_GUID" }, \
-  { &my_gMicrocodeFmpImageTypeIdGuid, L"MICROCODE_FMP_IMAGE_TYPE_ID_GUID" }, \
-  { &my_gEdkiiVTdInfoPpiGuid, L"EDKII_V_TD_INFO_PPI_GUID" }, \
-  { &my_gEdkiiPlatformVTdPolicyProtocolGuid, L"EDKII_PLATFORM_V_TD_POLICY_PROTOCOL_GUID" }, \
-  { &my_gEfiMdeModulePkgTokenSpaceGuid, L"EFI_MDE_MODULE_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gPcdDataBaseHobGuid, L"PCD_DATA_BASE_HOB_GUID" }, \
-  { &my_gPcdDataBaseSignatureGuid, L"PCD_DATA_BASE_SIGNATURE_GUID" }, \
-  { &my_gEfiIfrTianoGuid, L"EFI_IFR_TIANO_GUID" }, \
-  { &my_gEdkiiIfrBitVarstoreGuid, L"EDKII_IFR_BIT_VARSTORE_GUID" }, \
-  { &my_gEfiIfrFrameworkGuid, L"EFI_IFR_FRAMEWORK_GUID" }, \
-  { &my_gEfiSystemNvDataFvGuid, L"EFI_SYSTEM_NV_DATA_FV_GUID" }, \
-  { &my_gEdkiiWorkingBlockSignatureGuid, L"EDKII_WORKING_BLOCK_SIGNATURE_GUID" }, \
-  { &my_gEdkiiFaultTolerantWriteGuid, L"EDKII_FAULT_TOLERANT_WRITE_GUID" }, \
-  { &my_gEfiConsoleOutDeviceGuid, L"EFI_CONSOLE_OUT_DEVICE_GUID" }, \
-  { &my_gEfiConsoleInDeviceGuid, L"EFI_CONSOLE_IN_DEVICE_GUID" }, \
-  { &my_gEfiMemoryTypeInformationGuid, L"EFI_MEMORY_TYPE_INFORMATION_GUID" }, \
-  { &my_gEfiCapsuleVendorGuid, L"EFI_CAPSULE_VENDOR_GUID" }, \
-  { &my_gEfiStandardErrorDeviceGuid, L"EFI_STANDARD_ERROR_DEVICE_GUID" }, \
-  { &my_gEfiVariableGuid, L"EFI_VARIABLE_GUID" }, \
-  { &my_gEfiAuthenticatedVariableGuid, L"EFI_AUTHENTICATED_VARIABLE_GUID" }, \
-  { &my_gEfiVariableIndexTableGuid, L"EFI_VARIABLE_INDEX_TABLE_GUID" }, \
-  { &my_gSmmVariableWriteGuid, L"SMM_VARIABLE_WRITE_GUID" }, \
-  { &my_gPerformanceProtocolGuid, L"PERFORMANCE_PROTOCOL_GUID" }, \
-  { &my_gSmmPerformanceProtocolGuid, L"SMM_PERFORMANCE_PROTOCOL_GUID" }, \
-  { &my_gPerformanceExProtocolGuid, L"PERFORMANCE_EX_PROTOCOL_GUID" }, \
-  { &my_gSmmPerformanceExProtocolGuid, L"SMM_PERFORMANCE_EX_PROTOCOL_GUID" }, \
-  { &my_gEfiCrc32GuidedSectionExtractionGuid, L"EFI_CRC32_GUIDED_SECTION_EXTRACTION_GUID" }, \
-  { &my_gStatusCodeCallbackGuid, L"STATUS_CODE_CALLBACK_GUID" }, \
-  { &my_gMemoryStatusCodeRecordGuid, L"MEMORY_STATUS_CODE_RECORD_GUID" }, \
-  { &my_gEfiStatusCodeDataTypeDebugGuid, L"EFI_STATUS_CODE_DATA_TYPE_DEBUG_GUID" }, \
-  { &my_gLoadFixedAddressConfigurationTableGuid, L"LOAD_FIXED_ADDRESS_CONFIGURATION_TABLE_GUID" }, \
-  { &my_gEfiGenericVariableGuid, L"EFI_GENERIC_VARIABLE_GUID" }, \
-  { &my_gIdleLoopEventGuid, L"IDLE_LOOP_EVENT_GUID" }, \
-  { &my_gRecoveryOnFatUsbDiskGuid, L"RECOVERY_ON_FAT_USB_DISK_GUID" }, \
-  { &my_gRecoveryOnFatIdeDiskGuid, L"RECOVERY_ON_FAT_IDE_DISK_GUID" }, \
-  { &my_gRecoveryOnFatFloppyDiskGuid, L"RECOVERY_ON_FAT_FLOPPY_DISK_GUID" }, \
-  { &my_gRecoveryOnDataCdGuid, L"RECOVERY_ON_DATA_CD_GUID" }, \
-  { &my_gEfiSmmLockBoxCommunicationGuid, L"EFI_SMM_LOCK_BOX_COMMUNICATION_GUID" }, \
-  { &my_gEfiAcpiVariableGuid, L"EFI_ACPI_VARIABLE_GUID" }, \
-  { &my_gEfiAcpiS3ContextGuid, L"EFI_ACPI_S3_CONTEXT_GUID" }, \
-  { &my_gEfiBootScriptExecutorVariableGuid, L"EFI_BOOT_SCRIPT_EXECUTOR_VARIABLE_GUID" }, \
-  { &my_gEfiBootScriptExecutorContextGuid, L"EFI_BOOT_SCRIPT_EXECUTOR_CONTEXT_GUID" }, \
-  { &my_gUsbKeyboardLayoutPackageGuid, L"USB_KEYBOARD_LAYOUT_PACKAGE_GUID" }, \
-  { &my_gUsbKeyboardLayoutKeyGuid, L"USB_KEYBOARD_LAYOUT_KEY_GUID" }, \
-  { &my_gHiiResourceSamleFormSetGuid, L"HII_RESOURCE_SAMLE_FORM_SET_GUID" }, \
-  { &my_gDriverSampleFormSetGuid, L"DRIVER_SAMPLE_FORM_SET_GUID" }, \
-  { &my_gDriverSampleInventoryGuid, L"DRIVER_SAMPLE_INVENTORY_GUID" }, \
-  { &my_gEfiIfrRefreshIdOpGuid, L"EFI_IFR_REFRESH_ID_OP_GUID" }, \
-  { &my_gPlatformOverridesManagerGuid, L"PLATFORM_OVERRIDES_MANAGER_GUID" }, \
-  { &my_gIp4Config2NvDataGuid, L"IP4_CONFIG2_NV_DATA_GUID" }, \
-  { &my_gVlanConfigFormSetGuid, L"VLAN_CONFIG_FORM_SET_GUID" }, \
-  { &my_gIp4IScsiConfigGuid, L"IP4_I_SCSI_CONFIG_GUID" }, \
-  { &my_gIScsiCHAPAuthInfoGuid, L"I_SCSI_C_H_A_P_AUTH_INFO_GUID" }, \
-  { &my_gZeroGuid, L"ZERO_GUID" }, \
-  { &my_gMtcVendorGuid, L"MTC_VENDOR_GUID" }, \
-  { &my_gEfiFirmwarePerformanceGuid, L"EFI_FIRMWARE_PERFORMANCE_GUID" }, \
-  { &my_gFirmwarePerformanceS3PointerGuid, L"FIRMWARE_PERFORMANCE_S3_POINTER_GUID" }, \
-  { &my_gEventExitBootServicesFailedGuid, L"EVENT_EXIT_BOOT_SERVICES_FAILED_GUID" }, \
-  { &my_gConnectConInEventGuid, L"CONNECT_CON_IN_EVENT_GUID" }, \
-  { &my_gEdkiiStatusCodeDataTypeVariableGuid, L"EDKII_STATUS_CODE_DATA_TYPE_VARIABLE_GUID" }, \
-  { &my_gEdkiiMemoryProfileGuid, L"EDKII_MEMORY_PROFILE_GUID" }, \
-  { &my_gEdkiiSmmMemoryProfileGuid, L"EDKII_SMM_MEMORY_PROFILE_GUID" }, \
-  { &my_gEdkiiVarErrorFlagGuid, L"EDKII_VAR_ERROR_FLAG_GUID" }, \
-  { &my_gBrotliCustomDecompressGuid, L"BROTLI_CUSTOM_DECOMPRESS_GUID" }, \
-  { &my_gLzmaCustomDecompressGuid, L"LZMA_CUSTOM_DECOMPRESS_GUID" }, \
-  { &my_gLzmaF86CustomDecompressGuid, L"LZMA_F86_CUSTOM_DECOMPRESS_GUID" }, \
-  { &my_gEfiTtyTermGuid, L"EFI_TTY_TERM_GUID" }, \
-  { &my_gEfiIfrBootMaintenanceGuid, L"EFI_IFR_BOOT_MAINTENANCE_GUID" }, \
-  { &my_gEfiIfrFrontPageGuid, L"EFI_IFR_FRONT_PAGE_GUID" }, \
-  { &my_gRamDiskFormSetGuid, L"RAM_DISK_FORM_SET_GUID" }, \
-  { &my_gEdkiiPiSmmCommunicationRegionTableGuid, L"EDKII_PI_SMM_COMMUNICATION_REGION_TABLE_GUID" }, \
-  { &my_gEdkiiPiSmmMemoryAttributesTableGuid, L"EDKII_PI_SMM_MEMORY_ATTRIBUTES_TABLE_GUID" }, \
-  { &my_gSmiHandlerProfileGuid, L"SMI_HANDLER_PROFILE_GUID" }, \
-  { &my_gEdkiiNonDiscoverableAhciDeviceGuid, L"EDKII_NON_DISCOVERABLE_AHCI_DEVICE_GUID" }, \
-  { &my_gEdkiiNonDiscoverableAmbaDeviceGuid, L"EDKII_NON_DISCOVERABLE_AMBA_DEVICE_GUID" }, \
-  { &my_gEdkiiNonDiscoverableEhciDeviceGuid, L"EDKII_NON_DISCOVERABLE_EHCI_DEVICE_GUID" }, \
-  { &my_gEdkiiNonDiscoverableNvmeDeviceGuid, L"EDKII_NON_DISCOVERABLE_NVME_DEVICE_GUID" }, \
-  { &my_gEdkiiNonDiscoverableOhciDeviceGuid, L"EDKII_NON_DISCOVERABLE_OHCI_DEVICE_GUID" }, \
-  { &my_gEdkiiNonDiscoverableSdhciDeviceGuid, L"EDKII_NON_DISCOVERABLE_SDHCI_DEVICE_GUID" }, \
-  { &my_gEdkiiNonDiscoverableUfsDeviceGuid, L"EDKII_NON_DISCOVERABLE_UFS_DEVICE_GUID" }, \
-  { &my_gEdkiiNonDiscoverableUhciDeviceGuid, L"EDKII_NON_DISCOVERABLE_UHCI_DEVICE_GUID" }, \
-  { &my_gEdkiiNonDiscoverableXhciDeviceGuid, L"EDKII_NON_DISCOVERABLE_XHCI_DEVICE_GUID" }, \
-  { &my_gEdkiiPlatformHasAcpiGuid, L"EDKII_PLATFORM_HAS_ACPI_GUID" }, \
-  { &my_gEdkiiFpdtExtendedFirmwarePerformanceGuid, L"EDKII_FPDT_EXTENDED_FIRMWARE_PERFORMANCE_GUID" }, \
-  { &my_gEdkiiEndOfS3ResumeGuid, L"EDKII_END_OF_S3_RESUME_GUID" }, \
-  { &my_gEdkiiS3SmmInitDoneGuid, L"EDKII_S3_SMM_INIT_DONE_GUID" }, \
-  { &my_gPeiAtaControllerPpiGuid, L"PEI_ATA_CONTROLLER_PPI_GUID" }, \
-  { &my_gPeiUsbHostControllerPpiGuid, L"PEI_USB_HOST_CONTROLLER_PPI_GUID" }, \
-  { &my_gPeiUsb2HostControllerPpiGuid, L"PEI_USB2_HOST_CONTROLLER_PPI_GUID" }, \
-  { &my_gPeiUsbControllerPpiGuid, L"PEI_USB_CONTROLLER_PPI_GUID" }, \
-  { &my_gPeiUsbIoPpiGuid, L"PEI_USB_IO_PPI_GUID" }, \
-  { &my_gPeiSecPerformancePpiGuid, L"PEI_SEC_PERFORMANCE_PPI_GUID" }, \
-  { &my_gEfiPeiSmmCommunicationPpiGuid, L"EFI_PEI_SMM_COMMUNICATION_PPI_GUID" }, \
-  { &my_gPeiSmmAccessPpiGuid, L"PEI_SMM_ACCESS_PPI_GUID" }, \
-  { &my_gPeiSmmControlPpiGuid, L"PEI_SMM_CONTROL_PPI_GUID" }, \
-  { &my_gPeiPostScriptTablePpiGuid, L"PEI_POST_SCRIPT_TABLE_PPI_GUID" }, \
-  { &my_gPeiSerialPortPpiGuid, L"PEI_SERIAL_PORT_PPI_GUID" }, \
-  { &my_gEdkiiPeiUfsHostControllerPpiGuid, L"EDKII_PEI_UFS_HOST_CONTROLLER_PPI_GUID" }, \
-  { &my_gPeiIpmiPpiGuid, L"PEI_IPMI_PPI_GUID" }, \
-  { &my_gEdkiiPeiSdMmcHostControllerPpiGuid, L"EDKII_PEI_SD_MMC_HOST_CONTROLLER_PPI_GUID" }, \
-  { &my_gEdkiiIoMmuPpiGuid, L"EDKII_IO_MMU_PPI_GUID" }, \
-  { &my_gEdkiiPlatformSpecificResetFilterPpiGuid, L"EDKII_PLATFORM_SPECIFIC_RESET_FILTER_PPI_GUID" }, \
-  { &my_gEdkiiPlatformSpecificResetNotificationPpiGuid, L"EDKII_PLATFORM_SPECIFIC_RESET_NOTIFICATION_PPI_GUID" }, \
-  { &my_gEdkiiPlatformSpecificResetHandlerPpiGuid, L"EDKII_PLATFORM_SPECIFIC_RESET_HANDLER_PPI_GUID" }, \
-  { &my_gEfiLoadPeImageProtocolGuid, L"EFI_LOAD_PE_IMAGE_PROTOCOL_GUID" }, \
-  { &my_gEfiPrint2ProtocolGuid, L"EFI_PRINT2_PROTOCOL_GUID" }, \
-  { &my_gEfiPrint2SProtocolGuid, L"EFI_PRINT2_S_PROTOCOL_GUID" }, \
-  { &my_gEfiGenericMemTestProtocolGuid, L"EFI_GENERIC_MEM_TEST_PROTOCOL_GUID" }, \
-  { &my_gEfiDebuggerConfigurationProtocolGuid, L"EFI_DEBUGGER_CONFIGURATION_PROTOCOL_GUID" }, \
-  { &my_gEfiDpcProtocolGuid, L"EFI_DPC_PROTOCOL_GUID" }, \
-  { &my_gEfiFaultTolerantWriteProtocolGuid, L"EFI_FAULT_TOLERANT_WRITE_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmFaultTolerantWriteProtocolGuid, L"EFI_SMM_FAULT_TOLERANT_WRITE_PROTOCOL_GUID" }, \
-  { &my_gEfiSwapAddressRangeProtocolGuid, L"EFI_SWAP_ADDRESS_RANGE_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmSwapAddressRangeProtocolGuid, L"EFI_SMM_SWAP_ADDRESS_RANGE_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmVariableProtocolGuid, L"EFI_SMM_VARIABLE_PROTOCOL_GUID" }, \
-  { &my_gEdkiiVariableLockProtocolGuid, L"EDKII_VARIABLE_LOCK_PROTOCOL_GUID" }, \
-  { &my_gEdkiiVarCheckProtocolGuid, L"EDKII_VAR_CHECK_PROTOCOL_GUID" }, \
-  { &my_gEdkiiSmmVarCheckProtocolGuid, L"EDKII_SMM_VAR_CHECK_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmFirmwareVolumeBlockProtocolGuid, L"EFI_SMM_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID" }, \
-  { &my_gEfiDebugMaskProtocolGuid, L"EFI_DEBUG_MASK_PROTOCOL_GUID" }, \
-  { &my_gEfiLockBoxProtocolGuid, L"EFI_LOCK_BOX_PROTOCOL_GUID" }, \
-  { &my_gEfiFormBrowserExProtocolGuid, L"EFI_FORM_BROWSER_EX_PROTOCOL_GUID" }, \
-  { &my_gEfiEbcVmTestProtocolGuid, L"EFI_EBC_VM_TEST_PROTOCOL_GUID" }, \
-  { &my_gEfiEbcSimpleDebuggerProtocolGuid, L"EFI_EBC_SIMPLE_DEBUGGER_PROTOCOL_GUID" }, \
-  { &my_gEfiBootLogoProtocolGuid, L"EFI_BOOT_LOGO_PROTOCOL_GUID" }, \
-  { &my_gEdkiiBootLogo2ProtocolGuid, L"EDKII_BOOT_LOGO2_PROTOCOL_GUID" }, \
-  { &my_gEdkiiFormDisplayEngineProtocolGuid, L"EDKII_FORM_DISPLAY_ENGINE_PROTOCOL_GUID" }, \
-  { &my_gEdkiiFormBrowserEx2ProtocolGuid, L"EDKII_FORM_BROWSER_EX2_PROTOCOL_GUID" }, \
-  { &my_gEdkiiUfsHostControllerProtocolGuid, L"EDKII_UFS_HOST_CONTROLLER_PROTOCOL_GUID" }, \
-  { &my_gEsrtManagementProtocolGuid, L"ESRT_MANAGEMENT_PROTOCOL_GUID" }, \
-  { &my_gEdkiiSmmExitBootServicesProtocolGuid, L"EDKII_SMM_EXIT_BOOT_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEdkiiSmmLegacyBootProtocolGuid, L"EDKII_SMM_LEGACY_BOOT_PROTOCOL_GUID" }, \
-  { &my_gEdkiiSmmReadyToBootProtocolGuid, L"EDKII_SMM_READY_TO_BOOT_PROTOCOL_GUID" }, \
-  { &my_gEdkiiPlatformLogoProtocolGuid, L"EDKII_PLATFORM_LOGO_PROTOCOL_GUID" }, \
-  { &my_gEfiFileExplorerProtocolGuid, L"EFI_FILE_EXPLORER_PROTOCOL_GUID" }, \
-  { &my_gIpmiProtocolGuid, L"IPMI_PROTOCOL_GUID" }, \
-  { &my_gSmmIpmiProtocolGuid, L"SMM_IPMI_PROTOCOL_GUID" }, \
-  { &my_gEfiPs2PolicyProtocolGuid, L"EFI_PS2_POLICY_PROTOCOL_GUID" }, \
-  { &my_gEdkiiNonDiscoverableDeviceProtocolGuid, L"EDKII_NON_DISCOVERABLE_DEVICE_PROTOCOL_GUID" }, \
-  { &my_gEdkiiIoMmuProtocolGuid, L"EDKII_IO_MMU_PROTOCOL_GUID" }, \
-  { &my_gEdkiiSmmMemoryAttributeProtocolGuid, L"EDKII_SMM_MEMORY_ATTRIBUTE_PROTOCOL_GUID" }, \
-  { &my_gEdkiiPlatformSpecificResetFilterProtocolGuid, L"EDKII_PLATFORM_SPECIFIC_RESET_FILTER_PROTOCOL_GUID" }, \
-  { &my_gEdkiiPlatformSpecificResetHandlerProtocolGuid, L"EDKII_PLATFORM_SPECIFIC_RESET_HANDLER_PROTOCOL_GUID" }, \
-  { &my_gEdkiiFirmwareManagementProgressProtocolGuid, L"EDKII_FIRMWARE_MANAGEMENT_PROGRESS_PROTOCOL_GUID" }, \
-  { &my_gEfiGlobalVariableGuid, L"EFI_GLOBAL_VARIABLE_GUID" }, \
-  { &my_gEfiVT100PlusGuid, L"EFI_V_T100_PLUS_GUID" }, \
-  { &my_gEfiVT100Guid, L"EFI_V_T100_GUID" }, \
-  { &my_gEfiPcAnsiGuid, L"EFI_PC_ANSI_GUID" }, \
-  { &my_gEfiVTUTF8Guid, L"EFI_V_T_U_T_F8_GUID" }, \
-  { &my_gEfiUartDevicePathGuid, L"EFI_UART_DEVICE_PATH_GUID" }, \
-  { &my_gEfiSasDevicePathGuid, L"EFI_SAS_DEVICE_PATH_GUID" }, \
-  { &my_gEfiPartTypeLegacyMbrGuid, L"EFI_PART_TYPE_LEGACY_MBR_GUID" }, \
-  { &my_gEfiPartTypeSystemPartGuid, L"EFI_PART_TYPE_SYSTEM_PART_GUID" }, \
-  { &my_gEfiDebugImageInfoTableGuid, L"EFI_DEBUG_IMAGE_INFO_TABLE_GUID" }, \
-  { &my_gEfiAcpiTableGuid, L"EFI_ACPI_TABLE_GUID" }, \
-  { &my_gEfiAcpi10TableGuid, L"EFI_ACPI10_TABLE_GUID" }, \
-  { &my_gEfiSmbiosTableGuid, L"EFI_SMBIOS_TABLE_GUID" }, \
-  { &my_gEfiMpsTableGuid, L"EFI_MPS_TABLE_GUID" }, \
-  { &my_gEfiSalSystemTableGuid, L"EFI_SAL_SYSTEM_TABLE_GUID" }, \
-  { &my_gEfiAuthenticationChapLocalGuid, L"EFI_AUTHENTICATION_CHAP_LOCAL_GUID" }, \
-  { &my_gEfiAuthenticationChapRadiusGuid, L"EFI_AUTHENTICATION_CHAP_RADIUS_GUID" }, \
-  { &my_gEfiFileSystemVolumeLabelInfoIdGuid, L"EFI_FILE_SYSTEM_VOLUME_LABEL_INFO_ID_GUID" }, \
-  { &my_gEfiFileSystemInfoGuid, L"EFI_FILE_SYSTEM_INFO_GUID" }, \
-  { &my_gEfiFileInfoGuid, L"EFI_FILE_INFO_GUID" }, \
-  { &my_gBootObjectAuthorizationParmsetGuid, L"BOOT_OBJECT_AUTHORIZATION_PARMSET_GUID" }, \
-  { &my_gEfiPlatformToDriverConfigurationClpGuid, L"EFI_PLATFORM_TO_DRIVER_CONFIGURATION_CLP_GUID" }, \
-  { &my_gEfiHiiKeyBoardLayoutGuid, L"EFI_HII_KEY_BOARD_LAYOUT_GUID" }, \
-  { &my_gEfiHashAlgorithmMD5Guid, L"EFI_HASH_ALGORITHM_M_D5_GUID" }, \
-  { &my_gEfiHashAlgorithmSha512Guid, L"EFI_HASH_ALGORITHM_SHA512_GUID" }, \
-  { &my_gEfiHashAlgorithmSha384Guid, L"EFI_HASH_ALGORITHM_SHA384_GUID" }, \
-  { &my_gEfiHashAlgorithmSha256Guid, L"EFI_HASH_ALGORITHM_SHA256_GUID" }, \
-  { &my_gEfiHashAlgorithmSha224Guid, L"EFI_HASH_ALGORITHM_SHA224_GUID" }, \
-  { &my_gEfiHashAlgorithmSha1Guid, L"EFI_HASH_ALGORITHM_SHA1_GUID" }, \
-  { &my_gEfiEventReadyToBootGuid, L"EFI_EVENT_READY_TO_BOOT_GUID" }, \
-  { &my_gEfiEventMemoryMapChangeGuid, L"EFI_EVENT_MEMORY_MAP_CHANGE_GUID" }, \
-  { &my_gEfiEventVirtualAddressChangeGuid, L"EFI_EVENT_VIRTUAL_ADDRESS_CHANGE_GUID" }, \
-  { &my_gEfiEventExitBootServicesGuid, L"EFI_EVENT_EXIT_BOOT_SERVICES_GUID" }, \
-  { &my_gEfiDebugPortVariableGuid, L"EFI_DEBUG_PORT_VARIABLE_GUID" }, \
-  { &my_gEfiHiiPlatformSetupFormsetGuid, L"EFI_HII_PLATFORM_SETUP_FORMSET_GUID" }, \
-  { &my_gEfiHiiDriverHealthFormsetGuid, L"EFI_HII_DRIVER_HEALTH_FORMSET_GUID" }, \
-  { &my_gEfiHiiUserCredentialFormsetGuid, L"EFI_HII_USER_CREDENTIAL_FORMSET_GUID" }, \
-  { &my_gEfiHiiStandardFormGuid, L"EFI_HII_STANDARD_FORM_GUID" }, \
-  { &my_gEfiMemoryOverwriteControlDataGuid, L"EFI_MEMORY_OVERWRITE_CONTROL_DATA_GUID" }, \
-  { &my_gEfiMemoryOverwriteRequestControlLockGuid, L"EFI_MEMORY_OVERWRITE_REQUEST_CONTROL_LOCK_GUID" }, \
-  { &my_gEfiCertTypeRsa2048Sha256Guid, L"EFI_CERT_TYPE_RSA2048_SHA256_GUID" }, \
-  { &my_gEfiEventNotificationTypeCmcGuid, L"EFI_EVENT_NOTIFICATION_TYPE_CMC_GUID" }, \
-  { &my_gEfiEventNotificationTypeCpeGuid, L"EFI_EVENT_NOTIFICATION_TYPE_CPE_GUID" }, \
-  { &my_gEfiEventNotificationTypeMceGuid, L"EFI_EVENT_NOTIFICATION_TYPE_MCE_GUID" }, \
-  { &my_gEfiEventNotificationTypePcieGuid, L"EFI_EVENT_NOTIFICATION_TYPE_PCIE_GUID" }, \
-  { &my_gEfiEventNotificationTypeInitGuid, L"EFI_EVENT_NOTIFICATION_TYPE_INIT_GUID" }, \
-  { &my_gEfiEventNotificationTypeNmiGuid, L"EFI_EVENT_NOTIFICATION_TYPE_NMI_GUID" }, \
-  { &my_gEfiEventNotificationTypeBootGuid, L"EFI_EVENT_NOTIFICATION_TYPE_BOOT_GUID" }, \
-  { &my_gEfiEventNotificationTypeDmarGuid, L"EFI_EVENT_NOTIFICATION_TYPE_DMAR_GUID" }, \
-  { &my_gEfiProcessorGenericErrorSectionGuid, L"EFI_PROCESSOR_GENERIC_ERROR_SECTION_GUID" }, \
-  { &my_gEfiProcessorSpecificErrorSectionGuid, L"EFI_PROCESSOR_SPECIFIC_ERROR_SECTION_GUID" }, \
-  { &my_gEfiPlatformMemoryErrorSectionGuid, L"EFI_PLATFORM_MEMORY_ERROR_SECTION_GUID" }, \
-  { &my_gEfiPcieErrorSectionGuid, L"EFI_PCIE_ERROR_SECTION_GUID" }, \
-  { &my_gEfiFirmwareErrorSectionGuid, L"EFI_FIRMWARE_ERROR_SECTION_GUID" }, \
-  { &my_gEfiPciBusErrorSectionGuid, L"EFI_PCI_BUS_ERROR_SECTION_GUID" }, \
-  { &my_gEfiPciDevErrorSectionGuid, L"EFI_PCI_DEV_ERROR_SECTION_GUID" }, \
-  { &my_gEfiDMArGenericErrorSectionGuid, L"EFI_D_M_AR_GENERIC_ERROR_SECTION_GUID" }, \
-  { &my_gEfiDirectedIoDMArErrorSectionGuid, L"EFI_DIRECTED_IO_D_M_AR_ERROR_SECTION_GUID" }, \
-  { &my_gEfiIommuDMArErrorSectionGuid, L"EFI_IOMMU_D_M_AR_ERROR_SECTION_GUID" }, \
-  { &my_gEfiEventUserProfileChangedGuid, L"EFI_EVENT_USER_PROFILE_CHANGED_GUID" }, \
-  { &my_gEfiUserCredentialClassUnknownGuid, L"EFI_USER_CREDENTIAL_CLASS_UNKNOWN_GUID" }, \
-  { &my_gEfiUserCredentialClassPasswordGuid, L"EFI_USER_CREDENTIAL_CLASS_PASSWORD_GUID" }, \
-  { &my_gEfiUserCredentialClassSmartCardGuid, L"EFI_USER_CREDENTIAL_CLASS_SMART_CARD_GUID" }, \
-  { &my_gEfiUserCredentialClassFingerprintGuid, L"EFI_USER_CREDENTIAL_CLASS_FINGERPRINT_GUID" }, \
-  { &my_gEfiUserCredentialClassHandprintGuid, L"EFI_USER_CREDENTIAL_CLASS_HANDPRINT_GUID" }, \
-  { &my_gEfiUserCredentialClassSecureCardGuid, L"EFI_USER_CREDENTIAL_CLASS_SECURE_CARD_GUID" }, \
-  { &my_gEfiUserInfoAccessSetupAdminGuid, L"EFI_USER_INFO_ACCESS_SETUP_ADMIN_GUID" }, \
-  { &my_gEfiUserInfoAccessSetupNormalGuid, L"EFI_USER_INFO_ACCESS_SETUP_NORMAL_GUID" }, \
-  { &my_gEfiUserInfoAccessSetupRestrictedGuid, L"EFI_USER_INFO_ACCESS_SETUP_RESTRICTED_GUID" }, \
-  { &my_gEfiImageSecurityDatabaseGuid, L"EFI_IMAGE_SECURITY_DATABASE_GUID" }, \
-  { &my_gEfiCertSha256Guid, L"EFI_CERT_SHA256_GUID" }, \
-  { &my_gEfiCertRsa2048Guid, L"EFI_CERT_RSA2048_GUID" }, \
-  { &my_gEfiCertRsa2048Sha256Guid, L"EFI_CERT_RSA2048_SHA256_GUID" }, \
-  { &my_gEfiCertSha1Guid, L"EFI_CERT_SHA1_GUID" }, \
-  { &my_gEfiCertRsa2048Sha1Guid, L"EFI_CERT_RSA2048_SHA1_GUID" }, \
-  { &my_gEfiCertX509Guid, L"EFI_CERT_X509_GUID" }, \
-  { &my_gEfiKmsFormatGeneric128Guid, L"EFI_KMS_FORMAT_GENERIC128_GUID" }, \
-  { &my_gEfiKmsFormatGeneric160Guid, L"EFI_KMS_FORMAT_GENERIC160_GUID" }, \
-  { &my_gEfiKmsFormatGeneric256Guid, L"EFI_KMS_FORMAT_GENERIC256_GUID" }, \
-  { &my_gEfiKmsFormatGeneric512Guid, L"EFI_KMS_FORMAT_GENERIC512_GUID" }, \
-  { &my_gEfiKmsFormatGeneric1024Guid, L"EFI_KMS_FORMAT_GENERIC1024_GUID" }, \
-  { &my_gEfiKmsFormatGeneric2048Guid, L"EFI_KMS_FORMAT_GENERIC2048_GUID" }, \
-  { &my_gEfiKmsFormatGeneric3072Guid, L"EFI_KMS_FORMAT_GENERIC3072_GUID" }, \
-  { &my_gEfiKmsFormatMd2128Guid, L"EFI_KMS_FORMAT_MD2128_GUID" }, \
-  { &my_gEfiKmsFormatMdc2128Guid, L"EFI_KMS_FORMAT_MDC2128_GUID" }, \
-  { &my_gEfiKmsFormatMd4128Guid, L"EFI_KMS_FORMAT_MD4128_GUID" }, \
-  { &my_gEfiKmsFormatMdc4128Guid, L"EFI_KMS_FORMAT_MDC4128_GUID" }, \
-  { &my_gEfiKmsFormatMd5128Guid, L"EFI_KMS_FORMAT_MD5128_GUID" }, \
-  { &my_gEfiKmsFormatMd5sha128Guid, L"EFI_KMS_FORMAT_MD5SHA128_GUID" }, \
-  { &my_gEfiKmsFormatSha1160Guid, L"EFI_KMS_FORMAT_SHA1160_GUID" }, \
-  { &my_gEfiKmsFormatSha256256Guid, L"EFI_KMS_FORMAT_SHA256256_GUID" }, \
-  { &my_gEfiKmsFormatSha512512Guid, L"EFI_KMS_FORMAT_SHA512512_GUID" }, \
-  { &my_gEfiKmsFormatAesxts128Guid, L"EFI_KMS_FORMAT_AESXTS128_GUID" }, \
-  { &my_gEfiKmsFormatAesxts256Guid, L"EFI_KMS_FORMAT_AESXTS256_GUID" }, \
-  { &my_gEfiKmsFormatAescbc128Guid, L"EFI_KMS_FORMAT_AESCBC128_GUID" }, \
-  { &my_gEfiKmsFormatAescbc256Guid, L"EFI_KMS_FORMAT_AESCBC256_GUID" }, \
-  { &my_gEfiKmsFormatRsasha11024Guid, L"EFI_KMS_FORMAT_RSASHA11024_GUID" }, \
-  { &my_gEfiKmsFormatRsasha12048Guid, L"EFI_KMS_FORMAT_RSASHA12048_GUID" }, \
-  { &my_gEfiKmsFormatRsasha2562048Guid, L"EFI_KMS_FORMAT_RSASHA2562048_GUID" }, \
-  { &my_gEfiKmsFormatRsasha2563072Guid, L"EFI_KMS_FORMAT_RSASHA2563072_GUID" }, \
-  { &my_gEfiCertSha224Guid, L"EFI_CERT_SHA224_GUID" }, \
-  { &my_gEfiCertSha384Guid, L"EFI_CERT_SHA384_GUID" }, \
-  { &my_gEfiCertSha512Guid, L"EFI_CERT_SHA512_GUID" }, \
-  { &my_gEfiCertPkcs7Guid, L"EFI_CERT_PKCS7_GUID" }, \
-  { &my_gEfiHashAlgorithmSha1NoPadGuid, L"EFI_HASH_ALGORITHM_SHA1_NO_PAD_GUID" }, \
-  { &my_gEfiHashAlgorithmSha256NoPadGuid, L"EFI_HASH_ALGORITHM_SHA256_NO_PAD_GUID" }, \
-  { &my_gEfiFmpCapsuleGuid, L"EFI_FMP_CAPSULE_GUID" }, \
-  { &my_gEfiCertX509Sha256Guid, L"EFI_CERT_X509_SHA256_GUID" }, \
-  { &my_gEfiCertX509Sha384Guid, L"EFI_CERT_X509_SHA384_GUID" }, \
-  { &my_gEfiCertX509Sha512Guid, L"EFI_CERT_X509_SHA512_GUID" }, \
-  { &my_gEfiRngAlgorithmSp80090Hash256Guid, L"EFI_RNG_ALGORITHM_SP80090_HASH256_GUID" }, \
-  { &my_gEfiRngAlgorithmSp80090Hmac256Guid, L"EFI_RNG_ALGORITHM_SP80090_HMAC256_GUID" }, \
-  { &my_gEfiRngAlgorithmSp80090Ctr256Guid, L"EFI_RNG_ALGORITHM_SP80090_CTR256_GUID" }, \
-  { &my_gEfiRngAlgorithmX9313DesGuid, L"EFI_RNG_ALGORITHM_X9313_DES_GUID" }, \
-  { &my_gEfiRngAlgorithmX931AesGuid, L"EFI_RNG_ALGORITHM_X931_AES_GUID" }, \
-  { &my_gEfiRngAlgorithmRaw, L"EFI_RNG_ALGORITHM_RAW" }, \
-  { &my_gEfiAdapterInfoMediaStateGuid, L"EFI_ADAPTER_INFO_MEDIA_STATE_GUID" }, \
-  { &my_gEfiAdapterInfoNetworkBootGuid, L"EFI_ADAPTER_INFO_NETWORK_BOOT_GUID" }, \
-  { &my_gEfiAdapterInfoSanMacAddressGuid, L"EFI_ADAPTER_INFO_SAN_MAC_ADDRESS_GUID" }, \
-  { &my_gEfiCapsuleReportGuid, L"EFI_CAPSULE_REPORT_GUID" }, \
-  { &my_gEfiPropertiesTableGuid, L"EFI_PROPERTIES_TABLE_GUID" }, \
-  { &my_gEfiSystemResourceTableGuid, L"EFI_SYSTEM_RESOURCE_TABLE_GUID" }, \
-  { &my_gEfiAdapterInfoUndiIpv6SupportGuid, L"EFI_ADAPTER_INFO_UNDI_IPV6_SUPPORT_GUID" }, \
-  { &my_gEfiRegexSyntaxTypePosixExtendedGuid, L"EFI_REGEX_SYNTAX_TYPE_POSIX_EXTENDED_GUID" }, \
-  { &my_gEfiRegexSyntaxTypeEcma262Guid, L"EFI_REGEX_SYNTAX_TYPE_ECMA262_GUID" }, \
-  { &my_gEfiRegexSyntaxTypePerlGuid, L"EFI_REGEX_SYNTAX_TYPE_PERL_GUID" }, \
-  { &my_gEfiPlatformMemory2ErrorSectionGuid, L"EFI_PLATFORM_MEMORY2_ERROR_SECTION_GUID" }, \
-  { &my_gEfiBlockIoCryptoAlgoAesXtsGuid, L"EFI_BLOCK_IO_CRYPTO_ALGO_AES_XTS_GUID" }, \
-  { &my_gEfiBlockIoCryptoAlgoAesCbcMsBitlockerGuid, L"EFI_BLOCK_IO_CRYPTO_ALGO_AES_CBC_MS_BITLOCKER_GUID" }, \
-  { &my_gEfiPaddingRsassaPkcs1V1P5Guid, L"EFI_PADDING_RSASSA_PKCS1_V1_P5_GUID" }, \
-  { &my_gEfiPaddingRsassaPssGuid, L"EFI_PADDING_RSASSA_PSS_GUID" }, \
-  { &my_gEfiPaddingNoneGuid, L"EFI_PADDING_NONE_GUID" }, \
-  { &my_gEfiPaddingRsaesPkcs1V1P5Guid, L"EFI_PADDING_RSAES_PKCS1_V1_P5_GUID" }, \
-  { &my_gEfiPaddingRsaesOaepGuid, L"EFI_PADDING_RSAES_OAEP_GUID" }, \
-  { &my_gEfiSmbios3TableGuid, L"EFI_SMBIOS3_TABLE_GUID" }, \
-  { &my_gEfiBootManagerPolicyConsoleGuid, L"EFI_BOOT_MANAGER_POLICY_CONSOLE_GUID" }, \
-  { &my_gEfiBootManagerPolicyNetworkGuid, L"EFI_BOOT_MANAGER_POLICY_NETWORK_GUID" }, \
-  { &my_gEfiBootManagerPolicyConnectAllGuid, L"EFI_BOOT_MANAGER_POLICY_CONNECT_ALL_GUID" }, \
-  { &my_gEfiVirtualDiskGuid, L"EFI_VIRTUAL_DISK_GUID" }, \
-  { &my_gEfiVirtualCdGuid, L"EFI_VIRTUAL_CD_GUID" }, \
-  { &my_gEfiPersistentVirtualDiskGuid, L"EFI_PERSISTENT_VIRTUAL_DISK_GUID" }, \
-  { &my_gEfiPersistentVirtualCdGuid, L"EFI_PERSISTENT_VIRTUAL_CD_GUID" }, \
-  { &my_gEfiMemoryAttributesTableGuid, L"EFI_MEMORY_ATTRIBUTES_TABLE_GUID" }, \
-  { &my_gEfiArmProcessorErrorSectionGuid, L"EFI_ARM_PROCESSOR_ERROR_SECTION_GUID" }, \
-  { &my_gEfiHiiImageDecoderNameJpegGuid, L"EFI_HII_IMAGE_DECODER_NAME_JPEG_GUID" }, \
-  { &my_gEfiHiiImageDecoderNamePngGuid, L"EFI_HII_IMAGE_DECODER_NAME_PNG_GUID" }, \
-  { &my_gEfiBttAbstractionGuid, L"EFI_BTT_ABSTRACTION_GUID" }, \
-  { &my_gPeiAprioriFileNameGuid, L"PEI_APRIORI_FILE_NAME_GUID" }, \
-  { &my_gAprioriGuid, L"APRIORI_GUID" }, \
-  { &my_gEfiFirmwareFileSystem2Guid, L"EFI_FIRMWARE_FILE_SYSTEM2_GUID" }, \
-  { &my_gEfiFirmwareVolumeTopFileGuid, L"EFI_FIRMWARE_VOLUME_TOP_FILE_GUID" }, \
-  { &my_gEfiHobMemoryAllocModuleGuid, L"EFI_HOB_MEMORY_ALLOC_MODULE_GUID" }, \
-  { &my_gEfiHobMemoryAllocStackGuid, L"EFI_HOB_MEMORY_ALLOC_STACK_GUID" }, \
-  { &my_gEfiHobMemoryAllocBspStoreGuid, L"EFI_HOB_MEMORY_ALLOC_BSP_STORE_GUID" }, \
-  { &my_gEfiEventLegacyBootGuid, L"EFI_EVENT_LEGACY_BOOT_GUID" }, \
-  { &my_gEfiHobListGuid, L"EFI_HOB_LIST_GUID" }, \
-  { &my_gEfiDxeServicesTableGuid, L"EFI_DXE_SERVICES_TABLE_GUID" }, \
-  { &my_gEfiMdePkgTokenSpaceGuid, L"EFI_MDE_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiHardwareErrorVariableGuid, L"EFI_HARDWARE_ERROR_VARIABLE_GUID" }, \
-  { &my_gEfiEventDxeDispatchGuid, L"EFI_EVENT_DXE_DISPATCH_GUID" }, \
-  { &my_gEfiDiskInfoIdeInterfaceGuid, L"EFI_DISK_INFO_IDE_INTERFACE_GUID" }, \
-  { &my_gEfiDiskInfoScsiInterfaceGuid, L"EFI_DISK_INFO_SCSI_INTERFACE_GUID" }, \
-  { &my_gEfiDiskInfoUsbInterfaceGuid, L"EFI_DISK_INFO_USB_INTERFACE_GUID" }, \
-  { &my_gEfiDiskInfoAhciInterfaceGuid, L"EFI_DISK_INFO_AHCI_INTERFACE_GUID" }, \
-  { &my_gEfiStatusCodeDataTypeStringGuid, L"EFI_STATUS_CODE_DATA_TYPE_STRING_GUID" }, \
-  { &my_gEfiStatusCodeSpecificDataGuid, L"EFI_STATUS_CODE_SPECIFIC_DATA_GUID" }, \
-  { &my_gEfiFirmwareFileSystem3Guid, L"EFI_FIRMWARE_FILE_SYSTEM3_GUID" }, \
-  { &my_gEfiEndOfDxeEventGroupGuid, L"EFI_END_OF_DXE_EVENT_GROUP_GUID" }, \
-  { &my_gEfiFirmwareContentsSignedGuid, L"EFI_FIRMWARE_CONTENTS_SIGNED_GUID" }, \
-  { &my_gEfiVectorHandoffTableGuid, L"EFI_VECTOR_HANDOFF_TABLE_GUID" }, \
-  { &my_gAdapterInfoPlatformSecurityGuid, L"ADAPTER_INFO_PLATFORM_SECURITY_GUID" }, \
-  { &my_gEfiDiskInfoNvmeInterfaceGuid, L"EFI_DISK_INFO_NVME_INTERFACE_GUID" }, \
-  { &my_gEfiGraphicsInfoHobGuid, L"EFI_GRAPHICS_INFO_HOB_GUID" }, \
-  { &my_gEfiDiskInfoUfsInterfaceGuid, L"EFI_DISK_INFO_UFS_INTERFACE_GUID" }, \
-  { &my_gEfiGraphicsDeviceInfoHobGuid, L"EFI_GRAPHICS_DEVICE_INFO_HOB_GUID" }, \
-  { &my_gEfiDiskInfoSdMmcInterfaceGuid, L"EFI_DISK_INFO_SD_MMC_INTERFACE_GUID" }, \
-  { &my_gWindowsUxCapsuleGuid, L"WINDOWS_UX_CAPSULE_GUID" }, \
-  { &my_gEfiIa32X64ErrorTypeCacheCheckGuid, L"EFI_IA32_X64_ERROR_TYPE_CACHE_CHECK_GUID" }, \
-  { &my_gEfiIa32X64ErrorTypeTlbCheckGuid, L"EFI_IA32_X64_ERROR_TYPE_TLB_CHECK_GUID" }, \
-  { &my_gEfiIa32X64ErrorTypeBusCheckGuid, L"EFI_IA32_X64_ERROR_TYPE_BUS_CHECK_GUID" }, \
-  { &my_gEfiIa32X64ErrorTypeMsCheckGuid, L"EFI_IA32_X64_ERROR_TYPE_MS_CHECK_GUID" }, \
-  { &my_gEfiPeiMasterBootModePpiGuid, L"EFI_PEI_MASTER_BOOT_MODE_PPI_GUID" }, \
-  { &my_gEfiDxeIplPpiGuid, L"EFI_DXE_IPL_PPI_GUID" }, \
-  { &my_gEfiPeiMemoryDiscoveredPpiGuid, L"EFI_PEI_MEMORY_DISCOVERED_PPI_GUID" }, \
-  { &my_gEfiPeiBootInRecoveryModePpiGuid, L"EFI_PEI_BOOT_IN_RECOVERY_MODE_PPI_GUID" }, \
-  { &my_gEfiEndOfPeiSignalPpiGuid, L"EFI_END_OF_PEI_SIGNAL_PPI_GUID" }, \
-  { &my_gEfiPeiResetPpiGuid, L"EFI_PEI_RESET_PPI_GUID" }, \
-  { &my_gEfiPeiStatusCodePpiGuid, L"EFI_PEI_STATUS_CODE_PPI_GUID" }, \
-  { &my_gEfiPeiSecurity2PpiGuid, L"EFI_PEI_SECURITY2_PPI_GUID" }, \
-  { &my_gEfiTemporaryRamSupportPpiGuid, L"EFI_TEMPORARY_RAM_SUPPORT_PPI_GUID" }, \
-  { &my_gEfiPeiCpuIoPpiInstalledGuid, L"EFI_PEI_CPU_IO_PPI_INSTALLED_GUID" }, \
-  { &my_gEfiPciCfg2PpiGuid, L"EFI_PCI_CFG2_PPI_GUID" }, \
-  { &my_gEfiPeiStallPpiGuid, L"EFI_PEI_STALL_PPI_GUID" }, \
-  { &my_gEfiPeiReadOnlyVariable2PpiGuid, L"EFI_PEI_READ_ONLY_VARIABLE2_PPI_GUID" }, \
-  { &my_gEfiSecPlatformInformationPpiGuid, L"EFI_SEC_PLATFORM_INFORMATION_PPI_GUID" }, \
-  { &my_gEfiPeiLoadedImagePpiGuid, L"EFI_PEI_LOADED_IMAGE_PPI_GUID" }, \
-  { &my_gEfiPeiSmbus2PpiGuid, L"EFI_PEI_SMBUS2_PPI_GUID" }, \
-  { &my_gEfiPeiFirmwareVolumeInfoPpiGuid, L"EFI_PEI_FIRMWARE_VOLUME_INFO_PPI_GUID" }, \
-  { &my_gEfiPeiLoadFilePpiGuid, L"EFI_PEI_LOAD_FILE_PPI_GUID" }, \
-  { &my_gEfiPeiDecompressPpiGuid, L"EFI_PEI_DECOMPRESS_PPI_GUID" }, \
-  { &my_gPcdPpiGuid, L"PCD_PPI_GUID" }, \
-  { &my_gGetPcdInfoPpiGuid, L"GET_PCD_INFO_PPI_GUID" }, \
-  { &my_gEfiPeiRecoveryModulePpiGuid, L"EFI_PEI_RECOVERY_MODULE_PPI_GUID" }, \
-  { &my_gEfiPeiDeviceRecoveryModulePpiGuid, L"EFI_PEI_DEVICE_RECOVERY_MODULE_PPI_GUID" }, \
-  { &my_gEfiPeiVirtualBlockIoPpiGuid, L"EFI_PEI_VIRTUAL_BLOCK_IO_PPI_GUID" }, \
-  { &my_gEfiPeiS3Resume2PpiGuid, L"EFI_PEI_S3_RESUME2_PPI_GUID" }, \
-  { &my_gEfiPeiRscHandlerPpiGuid, L"EFI_PEI_RSC_HANDLER_PPI_GUID" }, \
-  { &my_gEfiPeiPcdPpiGuid, L"EFI_PEI_PCD_PPI_GUID" }, \
-  { &my_gEfiGetPcdInfoPpiGuid, L"EFI_GET_PCD_INFO_PPI_GUID" }, \
-  { &my_gEfiTemporaryRamDonePpiGuid, L"EFI_TEMPORARY_RAM_DONE_PPI_GUID" }, \
-  { &my_gEfiVectorHandoffInfoPpiGuid, L"EFI_VECTOR_HANDOFF_INFO_PPI_GUID" }, \
-  { &my_gEfiIsaHcPpiGuid, L"EFI_ISA_HC_PPI_GUID" }, \
-  { &my_gEfiSioPpiGuid, L"EFI_SIO_PPI_GUID" }, \
-  { &my_gEfiPeiI2cMasterPpiGuid, L"EFI_PEI_I2C_MASTER_PPI_GUID" }, \
-  { &my_gEfiPeiFirmwareVolumeInfo2PpiGuid, L"EFI_PEI_FIRMWARE_VOLUME_INFO2_PPI_GUID" }, \
-  { &my_gEfiPeiGraphicsPpiGuid, L"EFI_PEI_GRAPHICS_PPI_GUID" }, \
-  { &my_gEfiPeiMpServicesPpiGuid, L"EFI_PEI_MP_SERVICES_PPI_GUID" }, \
-  { &my_gEfiPeiCapsulePpiGuid, L"EFI_PEI_CAPSULE_PPI_GUID" }, \
-  { &my_gEfiPeiReset2PpiGuid, L"EFI_PEI_RESET2_PPI_GUID" }, \
-  { &my_gEfiPeiVirtualBlockIo2PpiGuid, L"EFI_PEI_VIRTUAL_BLOCK_IO2_PPI_GUID" }, \
-  { &my_gEfiSecPlatformInformation2PpiGuid, L"EFI_SEC_PLATFORM_INFORMATION2_PPI_GUID" }, \
-  { &my_gEfiSecHobDataPpiGuid, L"EFI_SEC_HOB_DATA_PPI_GUID" }, \
-  { &my_gPcdProtocolGuid, L"PCD_PROTOCOL_GUID" }, \
-  { &my_gGetPcdInfoProtocolGuid, L"GET_PCD_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiBdsArchProtocolGuid, L"EFI_BDS_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiCpuArchProtocolGuid, L"EFI_CPU_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiMetronomeArchProtocolGuid, L"EFI_METRONOME_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiMonotonicCounterArchProtocolGuid, L"EFI_MONOTONIC_COUNTER_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiRealTimeClockArchProtocolGuid, L"EFI_REAL_TIME_CLOCK_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiResetArchProtocolGuid, L"EFI_RESET_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiRuntimeArchProtocolGuid, L"EFI_RUNTIME_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSecurityArchProtocolGuid, L"EFI_SECURITY_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSecurityPolicyProtocolGuid, L"EFI_SECURITY_POLICY_PROTOCOL_GUID" }, \
-  { &my_gEfiTimerArchProtocolGuid, L"EFI_TIMER_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiVariableWriteArchProtocolGuid, L"EFI_VARIABLE_WRITE_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiVariableArchProtocolGuid, L"EFI_VARIABLE_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiWatchdogTimerArchProtocolGuid, L"EFI_WATCHDOG_TIMER_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiStatusCodeRuntimeProtocolGuid, L"EFI_STATUS_CODE_RUNTIME_PROTOCOL_GUID" }, \
-  { &my_gEfiSmbusHcProtocolGuid, L"EFI_SMBUS_HC_PROTOCOL_GUID" }, \
-  { &my_gEfiFirmwareVolume2ProtocolGuid, L"EFI_FIRMWARE_VOLUME2_PROTOCOL_GUID" }, \
-  { &my_gEfiFirmwareVolumeBlockProtocolGuid, L"EFI_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID" }, \
-  { &my_gEfiCapsuleArchProtocolGuid, L"EFI_CAPSULE_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiMpServiceProtocolGuid, L"EFI_MP_SERVICE_PROTOCOL_GUID" }, \
-  { &my_gEfiPciHostBridgeResourceAllocationProtocolGuid, L"EFI_PCI_HOST_BRIDGE_RESOURCE_ALLOCATION_PROTOCOL_GUID" }, \
-  { &my_gEfiPciPlatformProtocolGuid, L"EFI_PCI_PLATFORM_PROTOCOL_GUID" }, \
-  { &my_gEfiPciOverrideProtocolGuid, L"EFI_PCI_OVERRIDE_PROTOCOL_GUID" }, \
-  { &my_gEfiPciEnumerationCompleteProtocolGuid, L"EFI_PCI_ENUMERATION_COMPLETE_PROTOCOL_GUID" }, \
-  { &my_gEfiIncompatiblePciDeviceSupportProtocolGuid, L"EFI_INCOMPATIBLE_PCI_DEVICE_SUPPORT_PROTOCOL_GUID" }, \
-  { &my_gEfiPciHotPlugInitProtocolGuid, L"EFI_PCI_HOT_PLUG_INIT_PROTOCOL_GUID" }, \
-  { &my_gEfiPciHotPlugRequestProtocolGuid, L"EFI_PCI_HOT_PLUG_REQUEST_PROTOCOL_GUID" }, \
-  { &my_gEfiIdeControllerInitProtocolGuid, L"EFI_IDE_CONTROLLER_INIT_PROTOCOL_GUID" }, \
-  { &my_gEfiDiskInfoProtocolGuid, L"EFI_DISK_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiSmbiosProtocolGuid, L"EFI_SMBIOS_PROTOCOL_GUID" }, \
-  { &my_gEfiS3SaveStateProtocolGuid, L"EFI_S3_SAVE_STATE_PROTOCOL_GUID" }, \
-  { &my_gEfiS3SmmSaveStateProtocolGuid, L"EFI_S3_SMM_SAVE_STATE_PROTOCOL_GUID" }, \
-  { &my_gEfiRscHandlerProtocolGuid, L"EFI_RSC_HANDLER_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmRscHandlerProtocolGuid, L"EFI_SMM_RSC_HANDLER_PROTOCOL_GUID" }, \
-  { &my_gEfiAcpiSdtProtocolGuid, L"EFI_ACPI_SDT_PROTOCOL_GUID" }, \
-  { &my_gEfiSioProtocolGuid, L"EFI_SIO_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmCpuIo2ProtocolGuid, L"EFI_SMM_CPU_IO2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmBase2ProtocolGuid, L"EFI_SMM_BASE2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmAccess2ProtocolGuid, L"EFI_SMM_ACCESS2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmControl2ProtocolGuid, L"EFI_SMM_CONTROL2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmConfigurationProtocolGuid, L"EFI_SMM_CONFIGURATION_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmReadyToLockProtocolGuid, L"EFI_SMM_READY_TO_LOCK_PROTOCOL_GUID" }, \
-  { &my_gEfiDxeSmmReadyToLockProtocolGuid, L"EFI_DXE_SMM_READY_TO_LOCK_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmCommunicationProtocolGuid, L"EFI_SMM_COMMUNICATION_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmStatusCodeProtocolGuid, L"EFI_SMM_STATUS_CODE_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmCpuProtocolGuid, L"EFI_SMM_CPU_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmPciRootBridgeIoProtocolGuid, L"EFI_SMM_PCI_ROOT_BRIDGE_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmSwDispatch2ProtocolGuid, L"EFI_SMM_SW_DISPATCH2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmSxDispatch2ProtocolGuid, L"EFI_SMM_SX_DISPATCH2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmPeriodicTimerDispatch2ProtocolGuid, L"EFI_SMM_PERIODIC_TIMER_DISPATCH2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmUsbDispatch2ProtocolGuid, L"EFI_SMM_USB_DISPATCH2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmGpiDispatch2ProtocolGuid, L"EFI_SMM_GPI_DISPATCH2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmStandbyButtonDispatch2ProtocolGuid, L"EFI_SMM_STANDBY_BUTTON_DISPATCH2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmPowerButtonDispatch2ProtocolGuid, L"EFI_SMM_POWER_BUTTON_DISPATCH2_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmIoTrapDispatch2ProtocolGuid, L"EFI_SMM_IO_TRAP_DISPATCH2_PROTOCOL_GUID" }, \
-  { &my_gEfiPcdProtocolGuid, L"EFI_PCD_PROTOCOL_GUID" }, \
-  { &my_gEfiCpuIo2ProtocolGuid, L"EFI_CPU_IO2_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacyRegion2ProtocolGuid, L"EFI_LEGACY_REGION2_PROTOCOL_GUID" }, \
-  { &my_gEfiSalMcaInitPmiProtocolGuid, L"EFI_SAL_MCA_INIT_PMI_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalBootServiceProtocolGuid, L"EFI_EXTENDED_SAL_BOOT_SERVICE_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalBaseIoServicesProtocolGuid, L"EFI_EXTENDED_SAL_BASE_IO_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalStallServicesProtocolGuid, L"EFI_EXTENDED_SAL_STALL_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalRtcServicesProtocolGuid, L"EFI_EXTENDED_SAL_RTC_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalVariableServicesProtocolGuid, L"EFI_EXTENDED_SAL_VARIABLE_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalMtcServicesProtocolGuid, L"EFI_EXTENDED_SAL_MTC_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalResetServicesProtocolGuid, L"EFI_EXTENDED_SAL_RESET_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalStatusCodeServicesProtocolGuid, L"EFI_EXTENDED_SAL_STATUS_CODE_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalFvBlockServicesProtocolGuid, L"EFI_EXTENDED_SAL_FV_BLOCK_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalMpServicesProtocolGuid, L"EFI_EXTENDED_SAL_MP_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalPalServicesProtocolGuid, L"EFI_EXTENDED_SAL_PAL_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalBaseServicesProtocolGuid, L"EFI_EXTENDED_SAL_BASE_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalMcaServicesProtocolGuid, L"EFI_EXTENDED_SAL_MCA_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalPciServicesProtocolGuid, L"EFI_EXTENDED_SAL_PCI_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalCacheServicesProtocolGuid, L"EFI_EXTENDED_SAL_CACHE_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalMcaLogServicesProtocolGuid, L"EFI_EXTENDED_SAL_MCA_LOG_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiSecurity2ArchProtocolGuid, L"EFI_SECURITY2_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmEndOfDxeProtocolGuid, L"EFI_SMM_END_OF_DXE_PROTOCOL_GUID" }, \
-  { &my_gEfiIsaHcProtocolGuid, L"EFI_ISA_HC_PROTOCOL_GUID" }, \
-  { &my_gEfiIsaHcServiceBindingProtocolGuid, L"EFI_ISA_HC_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiSioControlProtocolGuid, L"EFI_SIO_CONTROL_PROTOCOL_GUID" }, \
-  { &my_gEfiGetPcdInfoProtocolGuid, L"EFI_GET_PCD_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiI2cMasterProtocolGuid, L"EFI_I2C_MASTER_PROTOCOL_GUID" }, \
-  { &my_gEfiI2cIoProtocolGuid, L"EFI_I2C_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiI2cEnumerateProtocolGuid, L"EFI_I2C_ENUMERATE_PROTOCOL_GUID" }, \
-  { &my_gEfiI2cHostProtocolGuid, L"EFI_I2C_HOST_PROTOCOL_GUID" }, \
-  { &my_gEfiI2cBusConfigurationManagementProtocolGuid, L"EFI_I2C_BUS_CONFIGURATION_MANAGEMENT_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacySpiControllerProtocolGuid, L"EFI_LEGACY_SPI_CONTROLLER_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacySpiFlashProtocolGuid, L"EFI_LEGACY_SPI_FLASH_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacySpiSmmControllerProtocolGuid, L"EFI_LEGACY_SPI_SMM_CONTROLLER_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacySpiSmmFlashProtocolGuid, L"EFI_LEGACY_SPI_SMM_FLASH_PROTOCOL_GUID" }, \
-  { &my_gEfiSpiConfigurationProtocolGuid, L"EFI_SPI_CONFIGURATION_PROTOCOL_GUID" }, \
-  { &my_gEfiSpiHcProtocolGuid, L"EFI_SPI_HC_PROTOCOL_GUID" }, \
-  { &my_gEfiSpiNorFlashProtocolGuid, L"EFI_SPI_NOR_FLASH_PROTOCOL_GUID" }, \
-  { &my_gEfiSpiSmmConfigurationProtocolGuid, L"EFI_SPI_SMM_CONFIGURATION_PROTOCOL_GUID" }, \
-  { &my_gEfiSpiSmmHcProtocolGuid, L"EFI_SPI_SMM_HC_PROTOCOL_GUID" }, \
-  { &my_gEfiSpiSmmNorFlashProtocolGuid, L"EFI_SPI_SMM_NOR_FLASH_PROTOCOL_GUID" }, \
-  { &my_gEfiDebugSupportProtocolGuid, L"EFI_DEBUG_SUPPORT_PROTOCOL_GUID" }, \
-  { &my_gEfiDecompressProtocolGuid, L"EFI_DECOMPRESS_PROTOCOL_GUID" }, \
-  { &my_gEfiDeviceIoProtocolGuid, L"EFI_DEVICE_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiDevicePathProtocolGuid, L"EFI_DEVICE_PATH_PROTOCOL_GUID" }, \
-  { &my_gEfiDevicePathFromTextProtocolGuid, L"EFI_DEVICE_PATH_FROM_TEXT_PROTOCOL_GUID" }, \
-  { &my_gEfiDevicePathToTextProtocolGuid, L"EFI_DEVICE_PATH_TO_TEXT_PROTOCOL_GUID" }, \
-  { &my_gEfiDevicePathUtilitiesProtocolGuid, L"EFI_DEVICE_PATH_UTILITIES_PROTOCOL_GUID" }, \
-  { &my_gEfiDriverBindingProtocolGuid, L"EFI_DRIVER_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiPlatformDriverOverrideProtocolGuid, L"EFI_PLATFORM_DRIVER_OVERRIDE_PROTOCOL_GUID" }, \
-  { &my_gEfiDriverFamilyOverrideProtocolGuid, L"EFI_DRIVER_FAMILY_OVERRIDE_PROTOCOL_GUID" }, \
-  { &my_gEfiBusSpecificDriverOverrideProtocolGuid, L"EFI_BUS_SPECIFIC_DRIVER_OVERRIDE_PROTOCOL_GUID" }, \
-  { &my_gEfiDriverDiagnostics2ProtocolGuid, L"EFI_DRIVER_DIAGNOSTICS2_PROTOCOL_GUID" }, \
-  { &my_gEfiDriverDiagnosticsProtocolGuid, L"EFI_DRIVER_DIAGNOSTICS_PROTOCOL_GUID" }, \
-  { &my_gEfiComponentName2ProtocolGuid, L"EFI_COMPONENT_NAME2_PROTOCOL_GUID" }, \
-  { &my_gEfiComponentNameProtocolGuid, L"EFI_COMPONENT_NAME_PROTOCOL_GUID" }, \
-  { &my_gEfiDriverConfiguration2ProtocolGuid, L"EFI_DRIVER_CONFIGURATION2_PROTOCOL_GUID" }, \
-  { &my_gEfiDriverConfigurationProtocolGuid, L"EFI_DRIVER_CONFIGURATION_PROTOCOL_GUID" }, \
-  { &my_gEfiPlatformToDriverConfigurationProtocolGuid, L"EFI_PLATFORM_TO_DRIVER_CONFIGURATION_PROTOCOL_GUID" }, \
-  { &my_gEfiDriverSupportedEfiVersionProtocolGuid, L"EFI_DRIVER_SUPPORTED_EFI_VERSION_PROTOCOL_GUID" }, \
-  { &my_gEfiSimpleTextInProtocolGuid, L"EFI_SIMPLE_TEXT_IN_PROTOCOL_GUID" }, \
-  { &my_gEfiSimpleTextInputExProtocolGuid, L"EFI_SIMPLE_TEXT_INPUT_EX_PROTOCOL_GUID" }, \
-  { &my_gEfiSimpleTextOutProtocolGuid, L"EFI_SIMPLE_TEXT_OUT_PROTOCOL_GUID" }, \
-  { &my_gEfiSimplePointerProtocolGuid, L"EFI_SIMPLE_POINTER_PROTOCOL_GUID" }, \
-  { &my_gEfiAbsolutePointerProtocolGuid, L"EFI_ABSOLUTE_POINTER_PROTOCOL_GUID" }, \
-  { &my_gEfiSerialIoProtocolGuid, L"EFI_SERIAL_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiGraphicsOutputProtocolGuid, L"EFI_GRAPHICS_OUTPUT_PROTOCOL_GUID" }, \
-  { &my_gEfiEdidDiscoveredProtocolGuid, L"EFI_EDID_DISCOVERED_PROTOCOL_GUID" }, \
-  { &my_gEfiEdidActiveProtocolGuid, L"EFI_EDID_ACTIVE_PROTOCOL_GUID" }, \
-  { &my_gEfiEdidOverrideProtocolGuid, L"EFI_EDID_OVERRIDE_PROTOCOL_GUID" }, \
-  { &my_gEfiUgaIoProtocolGuid, L"EFI_UGA_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiUgaDrawProtocolGuid, L"EFI_UGA_DRAW_PROTOCOL_GUID" }, \
-  { &my_gEfiLoadedImageProtocolGuid, L"EFI_LOADED_IMAGE_PROTOCOL_GUID" }, \
-  { &my_gEfiLoadedImageDevicePathProtocolGuid, L"EFI_LOADED_IMAGE_DEVICE_PATH_PROTOCOL_GUID" }, \
-  { &my_gEfiLoadFileProtocolGuid, L"EFI_LOAD_FILE_PROTOCOL_GUID" }, \
-  { &my_gEfiLoadFile2ProtocolGuid, L"EFI_LOAD_FILE2_PROTOCOL_GUID" }, \
-  { &my_gEfiTapeIoProtocolGuid, L"EFI_TAPE_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiDiskIoProtocolGuid, L"EFI_DISK_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiBlockIoProtocolGuid, L"EFI_BLOCK_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiUnicodeCollationProtocolGuid, L"EFI_UNICODE_COLLATION_PROTOCOL_GUID" }, \
-  { &my_gEfiUnicodeCollation2ProtocolGuid, L"EFI_UNICODE_COLLATION2_PROTOCOL_GUID" }, \
-  { &my_gEfiPciRootBridgeIoProtocolGuid, L"EFI_PCI_ROOT_BRIDGE_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiPciIoProtocolGuid, L"EFI_PCI_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiScsiIoProtocolGuid, L"EFI_SCSI_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiExtScsiPassThruProtocolGuid, L"EFI_EXT_SCSI_PASS_THRU_PROTOCOL_GUID" }, \
-  { &my_gEfiScsiPassThruProtocolGuid, L"EFI_SCSI_PASS_THRU_PROTOCOL_GUID" }, \
-  { &my_gEfiIScsiInitiatorNameProtocolGuid, L"EFI_I_SCSI_INITIATOR_NAME_PROTOCOL_GUID" }, \
-  { &my_gEfiUsb2HcProtocolGuid, L"EFI_USB2_HC_PROTOCOL_GUID" }, \
-  { &my_gEfiUsbHcProtocolGuid, L"EFI_USB_HC_PROTOCOL_GUID" }, \
-  { &my_gEfiUsbIoProtocolGuid, L"EFI_USB_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiAcpiTableProtocolGuid, L"EFI_ACPI_TABLE_PROTOCOL_GUID" }, \
-  { &my_gEfiEbcProtocolGuid, L"EFI_EBC_PROTOCOL_GUID" }, \
-  { &my_gEfiSimpleNetworkProtocolGuid, L"EFI_SIMPLE_NETWORK_PROTOCOL_GUID" }, \
-  { &my_gEfiNetworkInterfaceIdentifierProtocolGuid31, L"EFI_NETWORK_INTERFACE_IDENTIFIER_PROTOCOL_GUID_31" }, \
-  { &my_gEfiNetworkInterfaceIdentifierProtocolGuid, L"EFI_NETWORK_INTERFACE_IDENTIFIER_PROTOCOL_GUID" }, \
-  { &my_gEfiPxeBaseCodeCallbackProtocolGuid, L"EFI_PXE_BASE_CODE_CALLBACK_PROTOCOL_GUID" }, \
-  { &my_gEfiPxeBaseCodeProtocolGuid, L"EFI_PXE_BASE_CODE_PROTOCOL_GUID" }, \
-  { &my_gEfiBisProtocolGuid, L"EFI_BIS_PROTOCOL_GUID" }, \
-  { &my_gEfiManagedNetworkServiceBindingProtocolGuid, L"EFI_MANAGED_NETWORK_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiManagedNetworkProtocolGuid, L"EFI_MANAGED_NETWORK_PROTOCOL_GUID" }, \
-  { &my_gEfiArpServiceBindingProtocolGuid, L"EFI_ARP_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiArpProtocolGuid, L"EFI_ARP_PROTOCOL_GUID" }, \
-  { &my_gEfiDhcp4ServiceBindingProtocolGuid, L"EFI_DHCP4_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiDhcp4ProtocolGuid, L"EFI_DHCP4_PROTOCOL_GUID" }, \
-  { &my_gEfiTcp4ServiceBindingProtocolGuid, L"EFI_TCP4_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiTcp4ProtocolGuid, L"EFI_TCP4_PROTOCOL_GUID" }, \
-  { &my_gEfiIp4ServiceBindingProtocolGuid, L"EFI_IP4_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiIp4ProtocolGuid, L"EFI_IP4_PROTOCOL_GUID" }, \
-  { &my_gEfiIp4ConfigProtocolGuid, L"EFI_IP4_CONFIG_PROTOCOL_GUID" }, \
-  { &my_gEfiUdp4ServiceBindingProtocolGuid, L"EFI_UDP4_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiUdp4ProtocolGuid, L"EFI_UDP4_PROTOCOL_GUID" }, \
-  { &my_gEfiMtftp4ServiceBindingProtocolGuid, L"EFI_MTFTP4_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiMtftp4ProtocolGuid, L"EFI_MTFTP4_PROTOCOL_GUID" }, \
-  { &my_gEfiAuthenticationInfoProtocolGuid, L"EFI_AUTHENTICATION_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiHashServiceBindingProtocolGuid, L"EFI_HASH_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiHashProtocolGuid, L"EFI_HASH_PROTOCOL_GUID" }, \
-  { &my_gEfiTcgProtocolGuid, L"EFI_TCG_PROTOCOL_GUID" }, \
-  { &my_gEfiTrEEProtocolGuid, L"EFI_TR_E_E_PROTOCOL_GUID" }, \
-  { &my_gEfiTcg2FinalEventsTableGuid, L"EFI_TCG2_FINAL_EVENTS_TABLE_GUID" }, \
-  { &my_gEfiFormBrowser2ProtocolGuid, L"EFI_FORM_BROWSER2_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiStringProtocolGuid, L"EFI_HII_STRING_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiImageProtocolGuid, L"EFI_HII_IMAGE_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiConfigRoutingProtocolGuid, L"EFI_HII_CONFIG_ROUTING_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiDatabaseProtocolGuid, L"EFI_HII_DATABASE_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiFontProtocolGuid, L"EFI_HII_FONT_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiConfigAccessProtocolGuid, L"EFI_HII_CONFIG_ACCESS_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiPackageListProtocolGuid, L"EFI_HII_PACKAGE_LIST_PROTOCOL_GUID" }, \
-  { &my_gEfiIp6ServiceBindingProtocolGuid, L"EFI_IP6_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiIp6ProtocolGuid, L"EFI_IP6_PROTOCOL_GUID" }, \
-  { &my_gEfiIp6ConfigProtocolGuid, L"EFI_IP6_CONFIG_PROTOCOL_GUID" }, \
-  { &my_gEfiMtftp6ServiceBindingProtocolGuid, L"EFI_MTFTP6_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiMtftp6ProtocolGuid, L"EFI_MTFTP6_PROTOCOL_GUID" }, \
-  { &my_gEfiDhcp6ServiceBindingProtocolGuid, L"EFI_DHCP6_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiDhcp6ProtocolGuid, L"EFI_DHCP6_PROTOCOL_GUID" }, \
-  { &my_gEfiUdp6ServiceBindingProtocolGuid, L"EFI_UDP6_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiUdp6ProtocolGuid, L"EFI_UDP6_PROTOCOL_GUID" }, \
-  { &my_gEfiTcp6ServiceBindingProtocolGuid, L"EFI_TCP6_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiTcp6ProtocolGuid, L"EFI_TCP6_PROTOCOL_GUID" }, \
-  { &my_gEfiVlanConfigProtocolGuid, L"EFI_VLAN_CONFIG_PROTOCOL_GUID" }, \
-  { &my_gEfiEapProtocolGuid, L"EFI_EAP_PROTOCOL_GUID" }, \
-  { &my_gEfiEapManagementProtocolGuid, L"EFI_EAP_MANAGEMENT_PROTOCOL_GUID" }, \
-  { &my_gEfiFtp4ServiceBindingProtocolGuid, L"EFI_FTP4_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiFtp4ProtocolGuid, L"EFI_FTP4_PROTOCOL_GUID" }, \
-  { &my_gEfiIpSecConfigProtocolGuid, L"EFI_IP_SEC_CONFIG_PROTOCOL_GUID" }, \
-  { &my_gEfiDriverHealthProtocolGuid, L"EFI_DRIVER_HEALTH_PROTOCOL_GUID" }, \
-  { &my_gEfiDeferredImageLoadProtocolGuid, L"EFI_DEFERRED_IMAGE_LOAD_PROTOCOL_GUID" }, \
-  { &my_gEfiUserCredentialProtocolGuid, L"EFI_USER_CREDENTIAL_PROTOCOL_GUID" }, \
-  { &my_gEfiUserManagerProtocolGuid, L"EFI_USER_MANAGER_PROTOCOL_GUID" }, \
-  { &my_gEfiAtaPassThruProtocolGuid, L"EFI_ATA_PASS_THRU_PROTOCOL_GUID" }, \
-  { &my_gEfiFirmwareManagementProtocolGuid, L"EFI_FIRMWARE_MANAGEMENT_PROTOCOL_GUID" }, \
-  { &my_gEfiIpSecProtocolGuid, L"EFI_IP_SEC_PROTOCOL_GUID" }, \
-  { &my_gEfiIpSec2ProtocolGuid, L"EFI_IP_SEC2_PROTOCOL_GUID" }, \
-  { &my_gEfiKmsProtocolGuid, L"EFI_KMS_PROTOCOL_GUID" }, \
-  { &my_gEfiBlockIo2ProtocolGuid, L"EFI_BLOCK_IO2_PROTOCOL_GUID" }, \
-  { &my_gEfiStorageSecurityCommandProtocolGuid, L"EFI_STORAGE_SECURITY_COMMAND_PROTOCOL_GUID" }, \
-  { &my_gEfiUserCredential2ProtocolGuid, L"EFI_USER_CREDENTIAL2_PROTOCOL_GUID" }, \
-  { &my_gEfiDiskIo2ProtocolGuid, L"EFI_DISK_IO2_PROTOCOL_GUID" }, \
-  { &my_gEfiTimestampProtocolGuid, L"EFI_TIMESTAMP_PROTOCOL_GUID" }, \
-  { &my_gEfiRngProtocolGuid, L"EFI_RNG_PROTOCOL_GUID" }, \
-  { &my_gEfiAdapterInformationProtocolGuid, L"EFI_ADAPTER_INFORMATION_PROTOCOL_GUID" }, \
-  { &my_gEfiNvmExpressPassThruProtocolGuid, L"EFI_NVM_EXPRESS_PASS_THRU_PROTOCOL_GUID" }, \
-  { &my_gEfiHash2ServiceBindingProtocolGuid, L"EFI_HASH2_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiHash2ProtocolGuid, L"EFI_HASH2_PROTOCOL_GUID" }, \
-  { &my_gEfiBlockIoCryptoProtocolGuid, L"EFI_BLOCK_IO_CRYPTO_PROTOCOL_GUID" }, \
-  { &my_gEfiSmartCardReaderProtocolGuid, L"EFI_SMART_CARD_READER_PROTOCOL_GUID" }, \
-  { &my_gEfiSmartCardEdgeProtocolGuid, L"EFI_SMART_CARD_EDGE_PROTOCOL_GUID" }, \
-  { &my_gEfiUsbFunctionIoProtocolGuid, L"EFI_USB_FUNCTION_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiBluetoothHcProtocolGuid, L"EFI_BLUETOOTH_HC_PROTOCOL_GUID" }, \
-  { &my_gEfiBluetoothIoServiceBindingProtocolGuid, L"EFI_BLUETOOTH_IO_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiBluetoothIoProtocolGuid, L"EFI_BLUETOOTH_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiBluetoothConfigProtocolGuid, L"EFI_BLUETOOTH_CONFIG_PROTOCOL_GUID" }, \
-  { &my_gEfiRegularExpressionProtocolGuid, L"EFI_REGULAR_EXPRESSION_PROTOCOL_GUID" }, \
-  { &my_gEfiBootManagerPolicyProtocolGuid, L"EFI_BOOT_MANAGER_POLICY_PROTOCOL_GUID" }, \
-  { &my_gEfiConfigKeywordHandlerProtocolGuid, L"EFI_CONFIG_KEYWORD_HANDLER_PROTOCOL_GUID" }, \
-  { &my_gEfiWiFiProtocolGuid, L"EFI_WI_FI_PROTOCOL_GUID" }, \
-  { &my_gEfiEapManagement2ProtocolGuid, L"EFI_EAP_MANAGEMENT2_PROTOCOL_GUID" }, \
-  { &my_gEfiEapConfigurationProtocolGuid, L"EFI_EAP_CONFIGURATION_PROTOCOL_GUID" }, \
-  { &my_gEfiPkcs7VerifyProtocolGuid, L"EFI_PKCS7_VERIFY_PROTOCOL_GUID" }, \
-  { &my_gEfiIp4Config2ProtocolGuid, L"EFI_IP4_CONFIG2_PROTOCOL_GUID" }, \
-  { &my_gEfiDns4ServiceBindingProtocolGuid, L"EFI_DNS4_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiDns4ProtocolGuid, L"EFI_DNS4_PROTOCOL_GUID" }, \
-  { &my_gEfiDns6ServiceBindingProtocolGuid, L"EFI_DNS6_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiDns6ProtocolGuid, L"EFI_DNS6_PROTOCOL_GUID" }, \
-  { &my_gEfiHttpServiceBindingProtocolGuid, L"EFI_HTTP_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiHttpProtocolGuid, L"EFI_HTTP_PROTOCOL_GUID" }, \
-  { &my_gEfiHttpUtilitiesProtocolGuid, L"EFI_HTTP_UTILITIES_PROTOCOL_GUID" }, \
-  { &my_gEfiTlsServiceBindingProtocolGuid, L"EFI_TLS_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiTlsProtocolGuid, L"EFI_TLS_PROTOCOL_GUID" }, \
-  { &my_gEfiTlsConfigurationProtocolGuid, L"EFI_TLS_CONFIGURATION_PROTOCOL_GUID" }, \
-  { &my_gEfiRestProtocolGuid, L"EFI_REST_PROTOCOL_GUID" }, \
-  { &my_gEfiSupplicantServiceBindingProtocolGuid, L"EFI_SUPPLICANT_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiSupplicantProtocolGuid, L"EFI_SUPPLICANT_PROTOCOL_GUID" }, \
-  { &my_gEfiWiFi2ProtocolGuid, L"EFI_WI_FI2_PROTOCOL_GUID" }, \
-  { &my_gEfiRamDiskProtocolGuid, L"EFI_RAM_DISK_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiImageDecoderProtocolGuid, L"EFI_HII_IMAGE_DECODER_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiImageExProtocolGuid, L"EFI_HII_IMAGE_EX_PROTOCOL_GUID" }, \
-  { &my_gEfiSdMmcPassThruProtocolGuid, L"EFI_SD_MMC_PASS_THRU_PROTOCOL_GUID" }, \
-  { &my_gEfiEraseBlockProtocolGuid, L"EFI_ERASE_BLOCK_PROTOCOL_GUID" }, \
-  { &my_gEfiBluetoothAttributeProtocolGuid, L"EFI_BLUETOOTH_ATTRIBUTE_PROTOCOL_GUID" }, \
-  { &my_gEfiBluetoothAttributeServiceBindingProtocolGuid, L"EFI_BLUETOOTH_ATTRIBUTE_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gEfiBluetoothLeConfigProtocolGuid, L"EFI_BLUETOOTH_LE_CONFIG_PROTOCOL_GUID" }, \
-  { &my_gEfiUfsDeviceConfigProtocolGuid, L"EFI_UFS_DEVICE_CONFIG_PROTOCOL_GUID" }, \
-  { &my_gEfiHttpBootCallbackProtocolGuid, L"EFI_HTTP_BOOT_CALLBACK_PROTOCOL_GUID" }, \
-  { &my_gEfiResetNotificationProtocolGuid, L"EFI_RESET_NOTIFICATION_PROTOCOL_GUID" }, \
-  { &my_gEfiPartitionInfoProtocolGuid, L"EFI_PARTITION_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiPopupProtocolGuid, L"EFI_HII_POPUP_PROTOCOL_GUID" }, \
-  { &my_gEfiNvdimmLabelProtocolGuid, L"EFI_NVDIMM_LABEL_PROTOCOL_GUID" }, \
-  { &my_gEfiShellProtocolGuid, L"EFI_SHELL_PROTOCOL_GUID" }, \
-  { &my_gEfiShellParametersProtocolGuid, L"EFI_SHELL_PARAMETERS_PROTOCOL_GUID" }, \
-  { &my_gEfiShellDynamicCommandProtocolGuid, L"EFI_SHELL_DYNAMIC_COMMAND_PROTOCOL_GUID" }, \
-  { &my_gEfiNetworkPkgTokenSpaceGuid, L"EFI_NETWORK_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gIp6ConfigNvDataGuid, L"IP6_CONFIG_NV_DATA_GUID" }, \
-  { &my_gIScsiConfigGuid, L"I_SCSI_CONFIG_GUID" }, \
-  { &my_gHttpBootConfigGuid, L"HTTP_BOOT_CONFIG_GUID" }, \
-  { &my_gTlsAuthConfigGuid, L"TLS_AUTH_CONFIG_GUID" }, \
-  { &my_gEfiTlsCaCertificateGuid, L"EFI_TLS_CA_CERTIFICATE_GUID" }, \
-  { &my_gEfiWinNtPassThroughGuid, L"EFI_WIN_NT_PASS_THROUGH_GUID" }, \
-  { &my_gEfiWinNtConsoleGuid, L"EFI_WIN_NT_CONSOLE_GUID" }, \
-  { &my_gEfiWinNtUgaGuid, L"EFI_WIN_NT_UGA_GUID" }, \
-  { &my_gEfiWinNtGopGuid, L"EFI_WIN_NT_GOP_GUID" }, \
-  { &my_gEfiWinNtSerialPortGuid, L"EFI_WIN_NT_SERIAL_PORT_GUID" }, \
-  { &my_gEfiWinNtFileSystemGuid, L"EFI_WIN_NT_FILE_SYSTEM_GUID" }, \
-  { &my_gEfiWinNtPhysicalDisksGuid, L"EFI_WIN_NT_PHYSICAL_DISKS_GUID" }, \
-  { &my_gEfiWinNtVirtualDisksGuid, L"EFI_WIN_NT_VIRTUAL_DISKS_GUID" }, \
-  { &my_gEfiNt32PkgTokenSpaceGuid, L"EFI_NT32_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiWinNtSystemConfigGuid, L"EFI_WIN_NT_SYSTEM_CONFIG_GUID" }, \
-  { &my_gPeiNtThunkPpiGuid, L"PEI_NT_THUNK_PPI_GUID" }, \
-  { &my_gPeiNtAutoScanPpiGuid, L"PEI_NT_AUTO_SCAN_PPI_GUID" }, \
-  { &my_gNtPeiLoadFilePpiGuid, L"NT_PEI_LOAD_FILE_PPI_GUID" }, \
-  { &my_gNtFwhPpiGuid, L"NT_FWH_PPI_GUID" }, \
-  { &my_gWinNtBusDriverGuid, L"WIN_NT_BUS_DRIVER_GUID" }, \
-  { &my_gEfiWinNtThunkProtocolGuid, L"EFI_WIN_NT_THUNK_PROTOCOL_GUID" }, \
-  { &my_gEfiWinNtIoProtocolGuid, L"EFI_WIN_NT_IO_PROTOCOL_GUID" }, \
-  { &my_gOmap35xxTokenSpaceGuid, L"OMAP35XX_TOKEN_SPACE_GUID" }, \
-  { &my_gOptionRomPkgTokenSpaceGuid, L"OPTION_ROM_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gUefiOvmfPkgTokenSpaceGuid, L"UEFI_OVMF_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiXenInfoGuid, L"EFI_XEN_INFO_GUID" }, \
-  { &my_gOvmfPlatformConfigGuid, L"OVMF_PLATFORM_CONFIG_GUID" }, \
-  { &my_gVirtioMmioTransportGuid, L"VIRTIO_MMIO_TRANSPORT_GUID" }, \
-  { &my_gXenBusRootDeviceGuid, L"XEN_BUS_ROOT_DEVICE_GUID" }, \
-  { &my_gRootBridgesConnectedEventGroupGuid, L"ROOT_BRIDGES_CONNECTED_EVENT_GROUP_GUID" }, \
-  { &my_gVirtioDeviceProtocolGuid, L"VIRTIO_DEVICE_PROTOCOL_GUID" }, \
-  { &my_gBlockMmioProtocolGuid, L"BLOCK_MMIO_PROTOCOL_GUID" }, \
-  { &my_gXenBusProtocolGuid, L"XEN_BUS_PROTOCOL_GUID" }, \
-  { &my_gXenIoProtocolGuid, L"XEN_IO_PROTOCOL_GUID" }, \
-  { &my_gIoMmuAbsentProtocolGuid, L"IO_MMU_ABSENT_PROTOCOL_GUID" }, \
-  { &my_gPcAtChipsetPkgTokenSpaceGuid, L"PC_AT_CHIPSET_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gQuarkPlatformTokenSpaceGuid, L"QUARK_PLATFORM_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiMemoryConfigDataGuid, L"EFI_MEMORY_CONFIG_DATA_GUID" }, \
-  { &my_gPowerManagementAcpiTableStorageGuid, L"POWER_MANAGEMENT_ACPI_TABLE_STORAGE_GUID" }, \
-  { &my_gEfiQuarkCapsuleGuid, L"EFI_QUARK_CAPSULE_GUID" }, \
-  { &my_gQuarkVariableLockGuid, L"QUARK_VARIABLE_LOCK_GUID" }, \
-  { &my_gEfiGlobalNvsAreaProtocolGuid, L"EFI_GLOBAL_NVS_AREA_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmSpiReadyProtocolGuid, L"EFI_SMM_SPI_READY_PROTOCOL_GUID" }, \
-  { &my_gEfiIioUdsProtocolGuid, L"EFI_IIO_UDS_PROTOCOL_GUID" }, \
-  { &my_gEfiQuarkNcSocIdTokenSpaceGuid, L"EFI_QUARK_NC_SOC_ID_TOKEN_SPACE_GUID" }, \
-  { &my_gQncS3CodeInLockBoxGuid, L"QNC_S3_CODE_IN_LOCK_BOX_GUID" }, \
-  { &my_gQncS3ContextInLockBoxGuid, L"QNC_S3_CONTEXT_IN_LOCK_BOX_GUID" }, \
-  { &my_gEfiQuarkSCSocIdTokenSpaceGuid, L"EFI_QUARK_S_C_SOC_ID_TOKEN_SPACE_GUID" }, \
-  { &my_gQNCMemoryInitPpiGuid, L"Q_N_C_MEMORY_INIT_PPI_GUID" }, \
-  { &my_gEfiPlatformPolicyProtocolGuid, L"EFI_PLATFORM_POLICY_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmIchnDispatch2ProtocolGuid, L"EFI_SMM_ICHN_DISPATCH2_PROTOCOL_GUID" }, \
-  { &my_gEfiSpiProtocolGuid, L"EFI_SPI_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmSpiProtocolGuid, L"EFI_SMM_SPI_PROTOCOL_GUID" }, \
-  { &my_gEfiQncS3SupportProtocolGuid, L"EFI_QNC_S3_SUPPORT_PROTOCOL_GUID" }, \
-  { &my_gEfiSDHostIoProtocolGuid, L"EFI_S_D_HOST_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiSecurityPkgTokenSpaceGuid, L"EFI_SECURITY_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiSecureBootEnableDisableGuid, L"EFI_SECURE_BOOT_ENABLE_DISABLE_GUID" }, \
-  { &my_gEfiCustomModeEnableGuid, L"EFI_CUSTOM_MODE_ENABLE_GUID" }, \
-  { &my_gEfiVendorKeysNvGuid, L"EFI_VENDOR_KEYS_NV_GUID" }, \
-  { &my_gEfiCertDbGuid, L"EFI_CERT_DB_GUID" }, \
-  { &my_gTcgEventEntryHobGuid, L"TCG_EVENT_ENTRY_HOB_GUID" }, \
-  { &my_gTcgEvent2EntryHobGuid, L"TCG_EVENT2_ENTRY_HOB_GUID" }, \
-  { &my_gTpmErrorHobGuid, L"TPM_ERROR_HOB_GUID" }, \
-  { &my_gTpm2StartupLocalityHobGuid, L"TPM2_STARTUP_LOCALITY_HOB_GUID" }, \
-  { &my_gMeasuredFvHobGuid, L"MEASURED_FV_HOB_GUID" }, \
-  { &my_gEfiPhysicalPresenceGuid, L"EFI_PHYSICAL_PRESENCE_GUID" }, \
-  { &my_gEfiTcg2PhysicalPresenceGuid, L"EFI_TCG2_PHYSICAL_PRESENCE_GUID" }, \
-  { &my_gPwdCredentialProviderGuid, L"PWD_CREDENTIAL_PROVIDER_GUID" }, \
-  { &my_gUsbCredentialProviderGuid, L"USB_CREDENTIAL_PROVIDER_GUID" }, \
-  { &my_gUserIdentifyManagerGuid, L"USER_IDENTIFY_MANAGER_GUID" }, \
-  { &my_gUserProfileManagerGuid, L"USER_PROFILE_MANAGER_GUID" }, \
-  { &my_gTcgConfigFormSetGuid, L"TCG_CONFIG_FORM_SET_GUID" }, \
-  { &my_gTcg2ConfigFormSetGuid, L"TCG2_CONFIG_FORM_SET_GUID" }, \
-  { &my_gSecureBootConfigFormSetGuid, L"SECURE_BOOT_CONFIG_FORM_SET_GUID" }, \
-  { &my_gEfiTpmDeviceInstanceTpm12Guid, L"EFI_TPM_DEVICE_INSTANCE_TPM12_GUID" }, \
-  { &my_gEfiTpmDeviceInstanceTpm20DtpmGuid, L"EFI_TPM_DEVICE_INSTANCE_TPM20_DTPM_GUID" }, \
-  { &my_gEfiTpmDeviceSelectedGuid, L"EFI_TPM_DEVICE_SELECTED_GUID" }, \
-  { &my_gOpalExtraInfoVariableGuid, L"OPAL_EXTRA_INFO_VARIABLE_GUID" }, \
-  { &my_gPeiLockPhysicalPresencePpiGuid, L"PEI_LOCK_PHYSICAL_PRESENCE_PPI_GUID" }, \
-  { &my_gPeiTpmInitializedPpiGuid, L"PEI_TPM_INITIALIZED_PPI_GUID" }, \
-  { &my_gPeiTpmInitializationDonePpiGuid, L"PEI_TPM_INITIALIZATION_DONE_PPI_GUID" }, \
-  { &my_gEfiPeiFirmwareVolumeInfoMeasurementExcludedPpiGuid, L"EFI_PEI_FIRMWARE_VOLUME_INFO_MEASUREMENT_EXCLUDED_PPI_GUID" }, \
-  { &my_gEdkiiPeiFirmwareVolumeInfoPrehashedFvPpiGuid, L"EDKII_PEI_FIRMWARE_VOLUME_INFO_PREHASHED_FV_PPI_GUID" }, \
-  { &my_gEfiShellEnvironment2ExtGuid, L"EFI_SHELL_ENVIRONMENT2_EXT_GUID" }, \
-  { &my_gEfiShellPkgTokenSpaceGuid, L"EFI_SHELL_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gShellVariableGuid, L"SHELL_VARIABLE_GUID" }, \
-  { &my_gShellMapGuid, L"SHELL_MAP_GUID" }, \
-  { &my_gShellAliasGuid, L"SHELL_ALIAS_GUID" }, \
-  { &my_gHandleParsingHiiGuid, L"HANDLE_PARSING_HII_GUID" }, \
-  { &my_gShellDebug1HiiGuid, L"SHELL_DEBUG1_HII_GUID" }, \
-  { &my_gShellDriver1HiiGuid, L"SHELL_DRIVER1_HII_GUID" }, \
-  { &my_gShellInstall1HiiGuid, L"SHELL_INSTALL1_HII_GUID" }, \
-  { &my_gShellLevel1HiiGuid, L"SHELL_LEVEL1_HII_GUID" }, \
-  { &my_gShellLevel2HiiGuid, L"SHELL_LEVEL2_HII_GUID" }, \
-  { &my_gShellLevel3HiiGuid, L"SHELL_LEVEL3_HII_GUID" }, \
-  { &my_gShellNetwork1HiiGuid, L"SHELL_NETWORK1_HII_GUID" }, \
-  { &my_gShellNetwork2HiiGuid, L"SHELL_NETWORK2_HII_GUID" }, \
-  { &my_gShellTftpHiiGuid, L"SHELL_TFTP_HII_GUID" }, \
-  { &my_gShellBcfgHiiGuid, L"SHELL_BCFG_HII_GUID" }, \
-  { &my_gUefiShellFileGuid, L"UEFI_SHELL_FILE_GUID" }, \
-  { &my_gEfiShellEnvironment2Guid, L"EFI_SHELL_ENVIRONMENT2_GUID" }, \
-  { &my_gEfiShellInterfaceGuid, L"EFI_SHELL_INTERFACE_GUID" }, \
-  { &my_gEfiSignedCapsulePkgTokenSpaceGuid, L"EFI_SIGNED_CAPSULE_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gEdkiiSystemFirmwareImageDescriptorFileGuid, L"EDKII_SYSTEM_FIRMWARE_IMAGE_DESCRIPTOR_FILE_GUID" }, \
-  { &my_gEdkiiSystemFmpCapsuleConfigFileGuid, L"EDKII_SYSTEM_FMP_CAPSULE_CONFIG_FILE_GUID" }, \
-  { &my_gEdkiiSystemFmpCapsuleDriverFvFileGuid, L"EDKII_SYSTEM_FMP_CAPSULE_DRIVER_FV_FILE_GUID" }, \
-  { &my_gEfiDebugAgentGuid, L"EFI_DEBUG_AGENT_GUID" }, \
-  { &my_gEfiSourceLevelDebugPkgTokenSpaceGuid, L"EFI_SOURCE_LEVEL_DEBUG_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gStdLibTokenSpaceGuid, L"STD_LIB_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiSocketProtocolGuid, L"EFI_SOCKET_PROTOCOL_GUID" }, \
-  { &my_gEfiSocketServiceBindingProtocolGuid, L"EFI_SOCKET_SERVICE_BINDING_PROTOCOL_GUID" }, \
-  { &my_gUefiCpuPkgTokenSpaceGuid, L"UEFI_CPU_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gMsegSmramGuid, L"MSEG_SMRAM_GUID" }, \
-  { &my_gEdkiiCpuFeaturesSetDoneGuid, L"EDKII_CPU_FEATURES_SET_DONE_GUID" }, \
-  { &my_gEdkiiCpuFeaturesInitDoneGuid, L"EDKII_CPU_FEATURES_INIT_DONE_GUID" }, \
-  { &my_gEfiSmmCpuServiceProtocolGuid, L"EFI_SMM_CPU_SERVICE_PROTOCOL_GUID" }, \
-  { &my_gEfiSmMonitorInitProtocolGuid, L"EFI_SM_MONITOR_INIT_PROTOCOL_GUID" }, \
-  { &my_gVlvPolicyPpiGuid, L"VLV_POLICY_PPI_GUID" }, \
-  { &my_gVlvMmioPolicyPpiGuid, L"VLV_MMIO_POLICY_PPI_GUID" }, \
-  { &my_gPeiSmbusPolicyPpiGuid, L"PEI_SMBUS_POLICY_PPI_GUID" }, \
-  { &my_gSeCfTPMPpiGuid, L"SE_CF_T_P_M_PPI_GUID" }, \
-  { &my_gPchUsbPolicyPpiGuid, L"PCH_USB_POLICY_PPI_GUID" }, \
-  { &my_gPchInitPpiGuid, L"PCH_INIT_PPI_GUID" }, \
-  { &my_gPchPlatformPolicyPpiGuid, L"PCH_PLATFORM_POLICY_PPI_GUID" }, \
-  { &my_gPeiSpiPpiGuid, L"PEI_SPI_PPI_GUID" }, \
-  { &my_gVlvPeiInitPpiGuid, L"VLV_PEI_INIT_PPI_GUID" }, \
-  { &my_gSeCUmaPpiGuid, L"SE_C_UMA_PPI_GUID" }, \
-  { &my_gPeiSeCPlatformPolicyPpiGuid, L"PEI_SE_C_PLATFORM_POLICY_PPI_GUID" }, \
-  { &my_gPeiHeciPpiGuid, L"PEI_HECI_PPI_GUID" }, \
-  { &my_gPeiSdhcPpiGuid, L"PEI_SDHC_PPI_GUID" }, \
-  { &my_gPeiBlockIoPpiGuid, L"PEI_BLOCK_IO_PPI_GUID" }, \
-  { &my_gSeCfTPMPolicyPpiGuid, L"SE_CF_T_P_M_POLICY_PPI_GUID" }, \
-  { &my_gPchPeiInitPpiGuid, L"PCH_PEI_INIT_PPI_GUID" }, \
-  { &my_gPttPassThruPpiGuid, L"PTT_PASS_THRU_PPI_GUID" }, \
-  { &my_gPpmPlatformPolicyProtocolGuid, L"PPM_PLATFORM_POLICY_PROTOCOL_GUID" }, \
-  { &my_gMemInfoProtocolGuid, L"MEM_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmIchnDispatchExProtocolGuid, L"EFI_SMM_ICHN_DISPATCH_EX_PROTOCOL_GUID" }, \
-  { &my_gPchResetProtocolGuid, L"PCH_RESET_PROTOCOL_GUID" }, \
-  { &my_gPchResetCallbackProtocolGuid, L"PCH_RESET_CALLBACK_PROTOCOL_GUID" }, \
-  { &my_gDxePchPlatformPolicyProtocolGuid, L"DXE_PCH_PLATFORM_POLICY_PROTOCOL_GUID" }, \
-  { &my_gEfiPchInfoProtocolGuid, L"EFI_PCH_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiPchExtendedResetProtocolGuid, L"EFI_PCH_EXTENDED_RESET_PROTOCOL_GUID" }, \
-  { &my_gEfiActiveBiosProtocolGuid, L"EFI_ACTIVE_BIOS_PROTOCOL_GUID" }, \
-  { &my_gDxeIchPlatformPolicyProtocolGuid, L"DXE_ICH_PLATFORM_POLICY_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmSmbusProtocolGuid, L"EFI_SMM_SMBUS_PROTOCOL_GUID" }, \
-  { &my_gDxeVlvPlatformPolicyGuid, L"DXE_VLV_PLATFORM_POLICY_GUID" }, \
-  { &my_gIgdOpRegionProtocolGuid, L"IGD_OP_REGION_PROTOCOL_GUID" }, \
-  { &my_gEfiHeciProtocolGuid, L"EFI_HECI_PROTOCOL_GUID" }, \
-  { &my_gPlatformSeCHookProtocolGuid, L"PLATFORM_SE_C_HOOK_PROTOCOL_GUID" }, \
-  { &my_gEfiSeCRcInfoProtocolGuid, L"EFI_SE_C_RC_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiTdtProtocolGuid, L"EFI_TDT_PROTOCOL_GUID" }, \
-  { &my_gDxePlatformSeCPolicyGuid, L"DXE_PLATFORM_SE_C_POLICY_GUID" }, \
-  { &my_gLpssDummyProtocolGuid, L"LPSS_DUMMY_PROTOCOL_GUID" }, \
-  { &my_gEfiEmmcCardInfoProtocolGuid, L"EFI_EMMC_CARD_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiTdtOperationProtocolGuid, L"EFI_TDT_OPERATION_PROTOCOL_GUID" }, \
-  { &my_gEfiDFUResultGuid, L"EFI_D_F_U_RESULT_GUID" }, \
-  { &my_gPttPassThruProtocolGuid, L"PTT_PASS_THRU_PROTOCOL_GUID" }, \
-  { &my_gEfiCPTokenSpaceGuid, L"EFI_C_P_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiSmbusArpMapGuid, L"EFI_SMBUS_ARP_MAP_GUID" }, \
-  { &my_gEfiVLVTokenSpaceGuid, L"EFI_V_L_V_TOKEN_SPACE_GUID" }, \
-  { &my_gSataControllerDriverGuid, L"SATA_CONTROLLER_DRIVER_GUID" }, \
-  { &my_gDxePchPolicyUpdateProtocolGuid, L"DXE_PCH_POLICY_UPDATE_PROTOCOL_GUID" }, \
-  { &my_gEfiSetupVariableGuid, L"EFI_SETUP_VARIABLE_GUID" }, \
-  { &my_gPchInitVariableGuid, L"PCH_INIT_VARIABLE_GUID" }, \
-  { &my_gVlvRefCodePkgTokenSpaceGuid, L"VLV_REF_CODE_PKG_TOKEN_SPACE_GUID" }, \
-  { &my_gSeCPlatformReadyToBootGuid, L"SE_C_PLATFORM_READY_TO_BOOT_GUID" }, \
-  { &my_gAmtReadyToBootGuid, L"AMT_READY_TO_BOOT_GUID" }, \
-  { &my_gEfiVlv2VariableGuid, L"EFI_VLV2_VARIABLE_GUID" }, \
-  { &my_gPeiSpeakerInterfacePpiGuid, L"PEI_SPEAKER_INTERFACE_PPI_GUID" }, \
-  { &my_gPeiMfgMemoryTestPpiGuid, L"PEI_MFG_MEMORY_TEST_PPI_GUID" }, \
-  { &my_gPeiSha256HashPpiGuid, L"PEI_SHA256_HASH_PPI_GUID" }, \
-  { &my_gEfiPlatformBootModeGuid, L"EFI_PLATFORM_BOOT_MODE_GUID" }, \
-  { &my_gEfiPlatformInfoGuid, L"EFI_PLATFORM_INFO_GUID" }, \
-  { &my_gPlatformModuleTokenSpaceGuid, L"PLATFORM_MODULE_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiSerialPortTokenSpaceGuid, L"EFI_SERIAL_PORT_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiIchTokenSpaceGuid, L"EFI_ICH_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiPchTokenSpaceGuid, L"EFI_PCH_TOKEN_SPACE_GUID" }, \
-  { &my_gEfiSioVariableGuid, L"EFI_SIO_VARIABLE_GUID" }, \
-  { &my_gProcessorProducerGuid, L"PROCESSOR_PRODUCER_GUID" }, \
-  { &my_gEfiPowerOnHobGuid, L"EFI_POWER_ON_HOB_GUID" }, \
-  { &my_gEfiPlatformCpuInfoGuid, L"EFI_PLATFORM_CPU_INFO_GUID" }, \
-  { &my_gEfiBiosIdGuid, L"EFI_BIOS_ID_GUID" }, \
-  { &my_gEfiBoardFeaturesGuid, L"EFI_BOARD_FEATURES_GUID" }, \
-  { &my_gItkDataVarGuid, L"ITK_DATA_VAR_GUID" }, \
-  { &my_gDmiDataGuid, L"DMI_DATA_GUID" }, \
-  { &my_gIdccDataHubGuid, L"IDCC_DATA_HUB_GUID" }, \
-  { &my_gMfgModeVariableGuid, L"MFG_MODE_VARIABLE_GUID" }, \
-  { &my_gEfiAcpiTableStorageGuid, L"EFI_ACPI_TABLE_STORAGE_GUID" }, \
-  { &my_gACPIOSFRMfgStringVariableGuid, L"A_C_P_I_O_S_F_R_MFG_STRING_VARIABLE_GUID" }, \
-  { &my_gACPIOSFRModelStringVariableGuid, L"A_C_P_I_O_S_F_R_MODEL_STRING_VARIABLE_GUID" }, \
-  { &my_gEfiPciLanInfoGuid, L"EFI_PCI_LAN_INFO_GUID" }, \
-  { &my_gFirmwareIdGuid, L"FIRMWARE_ID_GUID" }, \
-  { &my_gOsSelectionVariableGuid, L"OS_SELECTION_VARIABLE_GUID" }, \
-  { &my_gEfiPlatformCpuProtocolGuid, L"EFI_PLATFORM_CPU_PROTOCOL_GUID" }, \
-  { &my_gEfiTpmMpDriverProtocolGuid, L"EFI_TPM_MP_DRIVER_PROTOCOL_GUID" }, \
-  { &my_gEfiLpcWpce791PolicyProtocolGuid, L"EFI_LPC_WPCE791_POLICY_PROTOCOL_GUID" }, \
-  { &my_gUsbPolicyGuid, L"USB_POLICY_GUID" }, \
-  { &my_gEfiSpeakerInterfaceProtocolGuid, L"EFI_SPEAKER_INTERFACE_PROTOCOL_GUID" }, \
-  { &my_gEfiSmbiosSlotPopulationGuid, L"EFI_SMBIOS_SLOT_POPULATION_GUID" }, \
-  { &my_gObservableProtocolGuid, L"OBSERVABLE_PROTOCOL_GUID" }, \
-  { &my_gEfiCk505ClockPlatformInfoGuid, L"EFI_CK505_CLOCK_PLATFORM_INFO_GUID" }, \
-  { &my_gEfiLpcWpc83627PolicyProtocolGuid, L"EFI_LPC_WPC83627_POLICY_PROTOCOL_GUID" }, \
-  { &my_gEfiTcoResetProtocolGuid, L"EFI_TCO_RESET_PROTOCOL_GUID" }, \
-  { &my_gEfiWatchdogTimerDriverProtocolGuid, L"EFI_WATCHDOG_TIMER_DRIVER_PROTOCOL_GUID" }, \
-  { &my_gEfiPlatformIdeInitProtocolGuid, L"EFI_PLATFORM_IDE_INIT_PROTOCOL_GUID" }, \
-  { &my_gEnhancedSpeedstepProtocolGuid, L"ENHANCED_SPEEDSTEP_PROTOCOL_GUID" }, \
-  { &my_gEfiGopDisplayBrightnessProtocolGuid, L"EFI_GOP_DISPLAY_BRIGHTNESS_PROTOCOL_GUID" }, \
-  { &my_gEfiUsbKeyboardConnectGuid, L"EFI_USB_KEYBOARD_CONNECT_GUID" }, \
-  { &my_gEfiMmioDeviceProtocolGuid, L"EFI_MMIO_DEVICE_PROTOCOL_GUID" }, \
-  { &my_gEfiI2cAcpiProtocolGuid, L"EFI_I2C_ACPI_PROTOCOL_GUID" }, \
-  { &my_gEfiI2cBusProtocolGuid, L"EFI_I2C_BUS_PROTOCOL_GUID" }, \
-  { &my_gEfiI2cSlaveProtocolGuid, L"EFI_I2C_SLAVE_PROTOCOL_GUID" }, \
-  { &my_gEfiSpiAcpiProtocolGuid, L"EFI_SPI_ACPI_PROTOCOL_GUID" }, \
-  { &my_gEfiSpiHostProtocolGuid, L"EFI_SPI_HOST_PROTOCOL_GUID" }, \
-  { &my_gEfiSpiBusProtocolGuid, L"EFI_SPI_BUS_PROTOCOL_GUID" }, \
-  { &my_gEfiGpioOperationProtocolGuid, L"EFI_GPIO_OPERATION_PROTOCOL_GUID" }, \
-  { &my_gEfiEsrtOperationProtocolGuid, L"EFI_ESRT_OPERATION_PROTOCOL_GUID" }, \
-  { &my_gEfiFirmwareClassGuid, L"EFI_FIRMWARE_CLASS_GUID" }, \
-  { &my_gEfiDFUVerGuid, L"EFI_D_F_U_VER_GUID" }, \
-  { &my_gEfiCapsuleCrashLogVarGuid, L"EFI_CAPSULE_CRASH_LOG_VAR_GUID" }, \
-  { &my_gEfiCapsuleCrashGuid, L"EFI_CAPSULE_CRASH_GUID" }, \
-  { &my_gAcousticSetupProtocolGuid, L"ACOUSTIC_SETUP_PROTOCOL_GUID" }, \
-  { &my_gAddBootOptionGuid, L"ADD_BOOT_OPTION_GUID" }, \
-  { &my_gAdvancedFormSetGuid, L"ADVANCED_FORM_SET_GUID" }, \
-  { &my_gAhciBusInitProtocolGuid, L"AHCI_BUS_INIT_PROTOCOL_GUID" }, \
-  { &my_gAhciSmmProtocolGuid, L"AHCI_SMM_PROTOCOL_GUID" }, \
-  { &my_gAmicsmPcibusnumXlatProtocolGuid, L"AMICSM_PCIBUSNUM_XLAT_PROTOCOL_GUID" }, \
-  { &my_gAmitsesetupGuid, L"AMITSESETUP_GUID" }, \
-  { &my_gAmitseAdminPasswordValidGuid, L"AMITSE_ADMIN_PASSWORD_VALID_GUID" }, \
-  { &my_gAmitseAfterFirstBootOptionGuid, L"AMITSE_AFTER_FIRST_BOOT_OPTION_GUID" }, \
-  { &my_gAmitseBootOrderChangeGuid, L"AMITSE_BOOT_ORDER_CHANGE_GUID" }, \
-  { &my_gAmitseDriverHealthCtrlGuid, L"AMITSE_DRIVER_HEALTH_CTRL_GUID" }, \
-  { &my_gAmitseDriverHealthEnbGuid, L"AMITSE_DRIVER_HEALTH_ENB_GUID" }, \
-  { &my_gAmitseDriverHealthGuid, L"AMITSE_DRIVER_HEALTH_GUID" }, \
-  { &my_gAmitseEventBeforeBootGuid, L"AMITSE_EVENT_BEFORE_BOOT_GUID" }, \
-  { &my_gAmitseInvalidPasswordGuid, L"AMITSE_INVALID_PASSWORD_GUID" }, \
-  { &my_gAmitseNvramUpdateGuid, L"AMITSE_NVRAM_UPDATE_GUID" }, \
-  { &my_gAmitsePasswordPromptEnterGuid, L"AMITSE_PASSWORD_PROMPT_ENTER_GUID" }, \
-  { &my_gAmitsePasswordPromptExitGuid, L"AMITSE_PASSWORD_PROMPT_EXIT_GUID" }, \
-  { &my_gAmitseSetupEnterGuid, L"AMITSE_SETUP_ENTER_GUID" }, \
-  { &my_gAmitseUserPasswordValidGuid, L"AMITSE_USER_PASSWORD_VALID_GUID" }, \
-  { &my_gAmiAptioSigOwnerGuid, L"AMI_APTIO_SIG_OWNER_GUID" }, \
-  { &my_gAmiBbsDevicePathGuid, L"AMI_BBS_DEVICE_PATH_GUID" }, \
-  { &my_gAmiBeforeCpuRcProtocolGuid, L"AMI_BEFORE_CPU_RC_PROTOCOL_GUID" }, \
-  { &my_gAmiBiosppiFlagsManagementGuid, L"AMI_BIOSPPI_FLAGS_MANAGEMENT_GUID" }, \
-  { &my_gAmiBoardInfoProtocolGuid, L"AMI_BOARD_INFO_PROTOCOL_GUID" }, \
-  { &my_gAmiBoardInfoSectionGuid, L"AMI_BOARD_INFO_SECTION_GUID" }, \
-  { &my_gAmiCallbackGuid, L"AMI_CALLBACK_GUID" }, \
-  { &my_gAmiCapsuleHobGuid, L"AMI_CAPSULE_HOB_GUID" }, \
-  { &my_gAmiCcidIoProtocolGuid, L"AMI_CCID_IO_PROTOCOL_GUID" }, \
-  { &my_gAmiCcidPresenceGuid, L"AMI_CCID_PRESENCE_GUID" }, \
-  { &my_gAmiCmosBadFlagHobGuid, L"AMI_CMOS_BAD_FLAG_HOB_GUID" }, \
-  { &my_gAmiCpuidCksumHobGuid, L"AMI_CPUID_CKSUM_HOB_GUID" }, \
-  { &my_gAmiCpuInfo2ProtocolGuid, L"AMI_CPU_INFO_2_PROTOCOL_GUID" }, \
-  { &my_gAmiCsmDriverStartedGuid, L"AMI_CSM_DRIVER_STARTED_GUID" }, \
-  { &my_gAmiCsmThunkProtocolGuid, L"AMI_CSM_THUNK_PROTOCOL_GUID" }, \
-  { &my_gAmiDddtPresentFlagHobGuid, L"AMI_DDDT_PRESENT_FLAG_HOB_GUID" }, \
-  { &my_gAmiDebuggerCpuProtocolGuid, L"AMI_DEBUGGER_CPU_PROTOCOL_GUID" }, \
-  { &my_gAmiDebugportHobGuid, L"AMI_DEBUGPORT_HOB_GUID" }, \
-  { &my_gAmiDeviceNameDevicePathGuid, L"AMI_DEVICE_NAME_DEVICE_PATH_GUID" }, \
-  { &my_gAmiDigitalSignatureProtocolGuid, L"AMI_DIGITAL_SIGNATURE_PROTOCOL_GUID" }, \
-  { &my_gAmiDimmSpdDataHobGuid, L"AMI_DIMM_SPD_DATA_HOB_GUID" }, \
-  { &my_gAmiEarlyBistPpiGuid, L"AMI_EARLY_BIST_PPI_GUID" }, \
-  { &my_gAmiEfikeycodeProtocolGuid, L"AMI_EFIKEYCODE_PROTOCOL_GUID" }, \
-  { &my_gAmiFastBootProtocolGuid, L"AMI_FAST_BOOT_PROTOCOL_GUID" }, \
-  { &my_gAmiFwRecoveryCapsuleGuid, L"AMI_FW_RECOVERY_CAPSULE_GUID" }, \
-  { &my_gAmiHeciSmmGuid, L"AMI_HECI_SMM_GUID" }, \
-  { &my_gAmiInternalFactoryTdcTdpHobGuid, L"AMI_INTERNAL_FACTORY_TDC_TDP_HOB_GUID" }, \
-  { &my_gAmiInternalUcodeHobGuid, L"AMI_INTERNAL_UCODE_HOB_GUID" }, \
-  { &my_gAmiIntSmmCommProtocolGuid, L"AMI_INT_SMM_COMM_PROTOCOL_GUID" }, \
-  { &my_gAmiIrqDmaMaskVariableGuid, L"AMI_IRQ_DMA_MASK_VARIABLE_GUID" }, \
-  { &my_gAmiIso9660MediaGuid, L"AMI_ISO9660_MEDIA_GUID" }, \
-  { &my_gAmiLoadCsmGuid, L"AMI_LOAD_CSM_GUID" }, \
-  { &my_gAmiMaskedDevicePathGuid, L"AMI_MASKED_DEVICE_PATH_GUID" }, \
-  { &my_gAmiMeasurePciopromGuid, L"AMI_MEASURE_PCIOPROM_GUID" }, \
-  { &my_gAmiMediaDevicePathGuid, L"AMI_MEDIA_DEVICE_PATH_GUID" }, \
-  { &my_gAmiMemoryErrorReportPpiGuid, L"AMI_MEMORY_ERROR_REPORT_PPI_GUID" }, \
-  { &my_gAmiMrcInfoHobGuid, L"AMI_MRC_INFO_HOB_GUID" }, \
-  { &my_gAmiNbMrcInfoGuid, L"AMI_NB_MRC_INFO_GUID" }, \
-  { &my_gAmiNvramSpdMapGuid, L"AMI_NVRAM_SPD_MAP_GUID" }, \
-  { &my_gAmiOpromPolicyProtocolGuid, L"AMI_OPROM_POLICY_PROTOCOL_GUID" }, \
-  { &my_gAmiOsPpiConfirmationOverrideGuid, L"AMI_OS_PPI_CONFIRMATION_OVERRIDE_GUID" }, \
-  { &my_gAmiPbKeyRsa2048Guid, L"AMI_PB_KEY_RSA2048_GUID" }, \
-  { &my_gAmiPciBusExtProtocolGuid, L"AMI_PCI_BUS_EXT_PROTOCOL_GUID" }, \
-  { &my_gAmiPeimHobGuid, L"AMI_PEIM_HOB_GUID" }, \
-  { &my_gAmiPeimLoadHobGuid, L"AMI_PEIM_LOAD_HOB_GUID" }, \
-  { &my_gAmiPeiAfterMrcGuid, L"AMI_PEI_AFTER_MRC_GUID" }, \
-  { &my_gAmiPeiCpuinitPolicyPpiGuid, L"AMI_PEI_CPUINIT_POLICY_PPI_GUID" }, \
-  { &my_gAmiPeiEndMemoryDetectGuid, L"AMI_PEI_END_MEMORY_DETECT_GUID" }, \
-  { &my_gAmiPeiEndOfMrcGuid, L"AMI_PEI_END_OF_MRC_GUID" }, \
-  { &my_gAmiPeiMrcDefaultGuid, L"AMI_PEI_MRC_DEFAULT_GUID" }, \
-  { &my_gAmiPeiNbinitPolicyPpiGuid, L"AMI_PEI_NBINIT_POLICY_PPI_GUID" }, \
-  { &my_gAmiPeiNbCpuOnlyResetPpiGuid, L"AMI_PEI_NB_CPU_ONLY_RESET_PPI_GUID" }, \
-  { &my_gAmiPeiNbCustomPpiGuid, L"AMI_PEI_NB_CUSTOM_PPI_GUID" }, \
-  { &my_gAmiPeiPciTableInitPpiGuid, L"AMI_PEI_PCI_TABLE_INIT_PPI_GUID" }, \
-  { &my_gAmiPeiSbinitPolicyPpiGuid, L"AMI_PEI_SBINIT_POLICY_PPI_GUID" }, \
-  { &my_gAmiPeiSbCustomPpiGuid, L"AMI_PEI_SB_CUSTOM_PPI_GUID" }, \
-  { &my_gAmiPeiSbOemPlatformPolicyOverridePpiGuid, L"AMI_PEI_SB_OEM_PLATFORM_POLICY_OVERRIDE_PPI_GUID" }, \
-  { &my_gAmiPerfTuneDataHobGuid, L"AMI_PERF_TUNE_DATA_HOB_GUID" }, \
-  { &my_gAmiPllOverVotageFlagHobGuid, L"AMI_PLL_OVER_VOTAGE_FLAG_HOB_GUID" }, \
-  { &my_gAmiPostManagerProtocolGuid, L"AMI_POST_MANAGER_PROTOCOL_GUID" }, \
-  { &my_gAmiRecoveryImageHobGuid, L"AMI_RECOVERY_IMAGE_HOB_GUID" }, \
-  { &my_gAmiResetTypeHobGuid, L"AMI_RESET_TYPE_HOB_GUID" }, \
-  { &my_gAmiResetTypeVariableGuid, L"AMI_RESET_TYPE_VARIABLE_GUID" }, \
-  { &my_gAmiRomLayoutHobGuid, L"AMI_ROM_LAYOUT_HOB_GUID" }, \
-  { &my_gAmiSbSmiProtocolGuid, L"AMI_SB_SMI_PROTOCOL_GUID" }, \
-  { &my_gAmiSmbiosCpuInfoProtocolGuid, L"AMI_SMBIOS_CPU_INFO_PROTOCOL_GUID" }, \
-  { &my_gAmiSmbiosMemoryInfoHobGuid, L"AMI_SMBIOS_MEMORY_INFO_HOB_GUID" }, \
-  { &my_gAmiSmbusHobGuid, L"AMI_SMBUS_HOB_GUID" }, \
-  { &my_gAmiSmmDigitalSignatureProtocolGuid, L"AMI_SMM_DIGITAL_SIGNATURE_PROTOCOL_GUID" }, \
-  { &my_gAmiSmmInfoProtocolGuid, L"AMI_SMM_INFO_PROTOCOL_GUID" }, \
-  { &my_gAmiStandardDefaultsVariableGuid, L"AMI_STANDARD_DEFAULTS_VARIABLE_GUID" }, \
-  { &my_gAmiStatusCodeCpuBistDataGuid, L"AMI_STATUS_CODE_CPU_BIST_DATA_GUID" }, \
-  { &my_gAmiTcgConfirmationFlagsGuid, L"AMI_TCG_CONFIRMATION_FLAGS_GUID" }, \
-  { &my_gAmiTcgEfiOsVariableGuid, L"AMI_TCG_EFI_OS_VARIABLE_GUID" }, \
-  { &my_gAmiTcgPermFlagsGuid, L"AMI_TCG_PERM_FLAGS_GUID" }, \
-  { &my_gAmiTcgPlatformPpiAfterMemGuid, L"AMI_TCG_PLATFORM_PPI_AFTER_MEM_GUID" }, \
-  { &my_gAmiTcgPlatformPpiBeforeMemGuid, L"AMI_TCG_PLATFORM_PPI_BEFORE_MEM_GUID" }, \
-  { &my_gAmiTcgPlatformPpiGuid, L"AMI_TCG_PLATFORM_PPI_GUID" }, \
-  { &my_gAmiTcgPlatformProtocolGuid, L"AMI_TCG_PLATFORM_PROTOCOL_GUID" }, \
-  { &my_gAmiUsbSmmProtocolGuid, L"AMI_USB_SMM_PROTOCOL_GUID" }, \
-  { &my_gAmtForcePushPetHobGuid, L"AMT_FORCE_PUSH_PET_HOB_GUID" }, \
-  { &my_gAmtForcePushPetPolicyGuid, L"AMT_FORCE_PUSH_PET_POLICY_GUID" }, \
-  { &my_gAmtForcePushPetVariableGuid, L"AMT_FORCE_PUSH_PET_VARIABLE_GUID" }, \
-  { &my_gAmtInt16CsmGuid, L"AMT_INT16_CSM_GUID" }, \
-  { &my_gAoacEcWakeupCustomPpiGuid, L"AOAC_EC_WAKEUP_CUSTOM_PPI_GUID" }, \
-  { &my_gAoacFfsTableStorageGuid, L"AOAC_FFS_TABLE_STORAGE_GUID" }, \
-  { &my_gAptioFwCapsuleGuid, L"APTIO_FW_CAPSULE_GUID" }, \
-  { &my_gAptioHiiProtocolGuid, L"APTIO_HII_PROTOCOL_GUID" }, \
-  { &my_gAuthvarMailboxVariableGuid, L"AUTHVAR_MAILBOX_VARIABLE_GUID" }, \
-  { &my_gBdsAllDriversConnectedProtocolGuid, L"BDS_ALL_DRIVERS_CONNECTED_PROTOCOL_GUID" }, \
-  { &my_gBdsConnectDriversProtocolGuid, L"BDS_CONNECT_DRIVERS_PROTOCOL_GUID" }, \
-  { &my_gBlockDeviceRecoveryCapsuleGuid, L"BLOCK_DEVICE_RECOVERY_CAPSULE_GUID" }, \
-  { &my_gBootFlowVariableGuid, L"BOOT_FLOW_VARIABLE_GUID" }, \
-  { &my_gBootFormSetGuid, L"BOOT_FORM_SET_GUID" }, \
-  { &my_gBootManagerGuid, L"BOOT_MANAGER_GUID" }, \
-  { &my_gBootNowCountGuid, L"BOOT_NOW_COUNT_GUID" }, \
-  { &my_gChipsetFormSetGuid, L"CHIPSET_FORM_SET_GUID" }, \
-  { &my_gCmosManagerHobGuid, L"CMOS_MANAGER_HOB_GUID" }, \
-  { &my_gConsoleInDevicesStartedProtocolGuid, L"CONSOLE_IN_DEVICES_STARTED_PROTOCOL_GUID" }, \
-  { &my_gConsoleOutDevicesStartedProtocolGuid, L"CONSOLE_OUT_DEVICES_STARTED_PROTOCOL_GUID" }, \
-  { &my_gCpuMicrocodeFileGuid, L"CPU_MICROCODE_FILE_GUID" }, \
-  { &my_gCpuWakeUpBufferVariableGuid, L"CPU_WAKE_UP_BUFFER_VARIABLE_GUID" }, \
-  { &my_gCsmVideoPolicyProtocolGuid, L"CSM_VIDEO_POLICY_PROTOCOL_GUID" }, \
-  { &my_gDcaHobGuid, L"DCA_HOB_GUID" }, \
-  { &my_gDebuggerTerminalVarGuid, L"DEBUGGER_TERMINAL_VAR_GUID" }, \
-  { &my_gDefineGuidCrbdxebinGuid, L"DEFINE_GUID_CRBDXEBin_GUID" }, \
-  { &my_gDefineGuidCrbsmibinGuid, L"DEFINE_GUID_CRBSMIBin_GUID" }, \
-  { &my_gDefineGuidAcpiplatformpeibinGuid, L"DEFINE_GUID_AcpiPlatformPeiBin_GUID" }, \
-  { &my_gDefineGuidOempeibinGuid, L"DEFINE_GUID_OEMPEIBin_GUID" }, \
-  { &my_gDefineGuidSbdxebinGuid, L"DEFINE_GUID_SBDXEBin_GUID" }, \
-  { &my_gDefineGuidOemdxebinGuid, L"DEFINE_GUID_OEMDXEBin_GUID" }, \
-  { &my_gDefineGuidSbpeibinGuid, L"DEFINE_GUID_SBPEIBin_GUID" }, \
-  { &my_gDefineGuidCrbpeibinGuid, L"DEFINE_GUID_CRBPEIBin_GUID" }, \
-  { &my_gDefineGuidAcpiplatformsmibinGuid, L"DEFINE_GUID_AcpiPlatformSmiBin_GUID" }, \
-  { &my_gDefineGuidNbpeibinGuid, L"DEFINE_GUID_NBPEIBin_GUID" }, \
-  { &my_gDefineGuidNbdxebinGuid, L"DEFINE_GUID_NBDXEBin_GUID" }, \
-  { &my_gDefineGuidSbrunbinGuid, L"DEFINE_GUID_SBRunBin_GUID" }, \
-  { &my_gDelBootOptionGuid, L"DEL_BOOT_OPTION_GUID" }, \
-  { &my_gDimmTsInfoGuid, L"DIMM_TS_INFO_GUID" }, \
-  { &my_gDxeCpuCacheProtocolGuid, L"DXE_CPU_CACHE_PROTOCOL_GUID" }, \
-  { &my_gDxeCpuInfoProtocolGuid, L"DXE_CPU_INFO_PROTOCOL_GUID" }, \
-  { &my_gDxeEnhancedSpeedstepProtocolGuid, L"DXE_ENHANCED_SPEEDSTEP_PROTOCOL_GUID" }, \
-  { &my_gDxePlatformAmtPolicyGuid, L"DXE_PLATFORM_AMT_POLICY_GUID" }, \
-  { &my_gDxePlatformSaPolicyGuid, L"DXE_PLATFORM_SA_POLICY_GUID" }, \
-  { &my_gDxePlatformSgPolicyGuid, L"DXE_PLATFORM_SG_POLICY_GUID" }, \
-  { &my_gDxePlatformTdtPolicyGuid, L"DXE_PLATFORM_TDT_POLICY_GUID" }, \
-  { &my_gDxeTxtPolicyProtocolGuid, L"DXE_TXT_POLICY_PROTOCOL_GUID" }, \
-  { &my_gDynamicPageCountGuid, L"DYNAMIC_PAGE_COUNT_GUID" }, \
-  { &my_gEfiActiveManagementProtocolGuid, L"EFI_ACTIVE_MANAGEMENT_PROTOCOL_GUID" }, \
-  { &my_gEfiAhciInt13InitProtocolGuid, L"EFI_AHCI_INT13_INIT_PROTOCOL_GUID" }, \
-  { &my_gEfiAlertStandardFormatProtocolGuid, L"EFI_ALERT_STANDARD_FORMAT_PROTOCOL_GUID" }, \
-  { &my_gEfiAlternateFvBlockGuid, L"EFI_ALTERNATE_FV_BLOCK_GUID" }, \
-  { &my_gEfiAmiLegacybootProtocolGuid, L"EFI_AMI_LEGACYBOOT_PROTOCOL_GUID" }, \
-  { &my_gEfiAuthorizationProtocolGuid, L"EFI_AUTHORIZATION_PROTOCOL_GUID" }, \
-  { &my_gEfiBdatAccessGuid, L"EFI_BDAT_ACCESS_GUID" }, \
-  { &my_gEfiCacheInstallPpiGuid, L"EFI_CACHE_INSTALL_PPI_GUID" }, \
-  { &my_gEfiCapsuleAmiGuid, L"EFI_CAPSULE_AMI_GUID" }, \
-  { &my_gEfiCapsuleInfoGuid, L"EFI_CAPSULE_INFO_GUID" }, \
-  { &my_gEfiClpProtocolGuid, L"EFI_CLP_PROTOCOL_GUID" }, \
-  { &my_gEfiCmosDataHobInstalledGuid, L"EFI_CMOS_DATA_HOB_INSTALLED_GUID" }, \
-  { &my_gEfiCompatibleMemoryTestedProtocolGuid, L"EFI_COMPATIBLE_MEMORY_TESTED_PROTOCOL_GUID" }, \
-  { &my_gEfiConsoleLockGuid, L"EFI_CONSOLE_LOCK_GUID" }, \
-  { &my_gEfiCpuTypeFruGuid, L"EFI_CPU_TYPE_FRU_GUID" }, \
-  { &my_gEfiCustomizedDecompressProtocolGuid, L"EFI_CUSTOMIZED_DECOMPRESS_PROTOCOL_GUID" }, \
-  { &my_gEfiDebugAssertProtocolGuid, L"EFI_DEBUG_ASSERT_PROTOCOL_GUID" }, \
-  { &my_gEfiDebugMaskPpiGuid, L"EFI_DEBUG_MASK_PPI_GUID" }, \
-  { &my_gEfiDmiFormatFruGuid, L"EFI_DMI_FORMAT_FRU_GUID" }, \
-  { &my_gEfiDxeCmosAccessGuid, L"EFI_DXE_CMOS_ACCESS_GUID" }, \
-  { &my_gEfiEmul6064kbdinputProtocolGuid, L"EFI_EMUL6064KBDINPUT_PROTOCOL_GUID" }, \
-  { &my_gEfiEmul6064msinputProtocolGuid, L"EFI_EMUL6064MSINPUT_PROTOCOL_GUID" }, \
-  { &my_gEfiEmul6064trapProtocolGuid, L"EFI_EMUL6064TRAP_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalElogServicesProtocolGuid, L"EFI_EXTENDED_SAL_ELOG_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalLockServicesProtocolGuid, L"EFI_EXTENDED_SAL_LOCK_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalSensorServicesProtocolGuid, L"EFI_EXTENDED_SAL_SENSOR_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalSmComLayerServicesProtocolGuid, L"EFI_EXTENDED_SAL_SM_COM_LAYER_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiExtendedSalSstGuid, L"EFI_EXTENDED_SAL_SST_GUID" }, \
-  { &my_gEfiExtendedSalVirtualServicesProtocolGuid, L"EFI_EXTENDED_SAL_VIRTUAL_SERVICES_PROTOCOL_GUID" }, \
-  { &my_gEfiFirmwareVolumeDispatchProtocolGuid, L"EFI_FIRMWARE_VOLUME_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiFrameworkDevicePathGuid, L"EFI_FRAMEWORK_DEVICE_PATH_GUID" }, \
-  { &my_gEfiFtwLiteProtocolGuid, L"EFI_FTW_LITE_PROTOCOL_GUID" }, \
-  { &my_gEfiFvbExtensionProtocolGuid, L"EFI_FVB_EXTENSION_PROTOCOL_GUID" }, \
-  { &my_gEfiGpioProtocolGuid, L"EFI_GPIO_PROTOCOL_GUID" }, \
-  { &my_gEfiGuid, L"EFI_GUID" }, \
-  { &my_gEfiHiiExtProtocolGuid, L"EFI_HII_EXT_PROTOCOL_GUID" }, \
-  { &my_gEfiHiiFrontPageClassGuid, L"EFI_HII_FRONT_PAGE_CLASS_GUID" }, \
-  { &my_gEfiHiiOldProtocolGuid, L"EFI_HII_OLD_PROTOCOL_GUID" }, \
-  { &my_gEfiHotKeysProtocolGuid, L"EFI_HOT_KEYS_PROTOCOL_GUID" }, \
-  { &my_gEfiHtBistHobGuid, L"EFI_HT_BIST_HOB_GUID" }, \
-  { &my_gEfiIderControllerDriverProtocolGuid, L"EFI_IDER_CONTROLLER_DRIVER_PROTOCOL_GUID" }, \
-  { &my_gEfiIntelMfgFormatFruGuid, L"EFI_INTEL_MFG_FORMAT_FRU_GUID" }, \
-  { &my_gEfiIobaseHobGuid, L"EFI_IOBASE_HOB_GUID" }, \
-  { &my_gEfiIpProtocolGuid, L"EFI_IP_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacyBiosExtProtocolGuid, L"EFI_LEGACY_BIOS_EXT_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacyBiosThunkProtocolGuid, L"EFI_LEGACY_BIOS_THUNK_PROTOCOL_GUID" }, \
-  { &my_gEfiLegacySredirProtocolGuid, L"EFI_LEGACY_SREDIR_PROTOCOL_GUID" }, \
-  { &my_gEfiLightIsaIoProtocolGuid, L"EFI_LIGHT_ISA_IO_PROTOCOL_GUID" }, \
-  { &my_gEfiMemoryProducerGuid, L"EFI_MEMORY_PRODUCER_GUID" }, \
-  { &my_gEfiMemorySubclassDriverGuid, L"EFI_MEMORY_SUBCLASS_DRIVER_GUID" }, \
-  { &my_gEfiMemoryTypeFruGuid, L"EFI_MEMORY_TYPE_FRU_GUID" }, \
-  { &my_gEfiMeBiosExtensionSetupGuid, L"EFI_ME_BIOS_EXTENSION_SETUP_GUID" }, \
-  { &my_gEfiMeFwSkuVariableGuid, L"EFI_ME_FW_SKU_VARIABLE_GUID" }, \
-  { &my_gEfiMiniShellFileGuid, L"EFI_MINI_SHELL_FILE_GUID" }, \
-  { &my_gEfiMiscProducerGuid, L"EFI_MISC_PRODUCER_GUID" }, \
-  { &my_gEfiMiscSubclassDriverGuid, L"EFI_MISC_SUBCLASS_DRIVER_GUID" }, \
-  { &my_gEfiNbErrorLogDispatchProtocolGuid, L"EFI_NB_ERROR_LOG_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiNbMrcInfoGuid, L"EFI_NB_MRC_INFO_GUID" }, \
-  { &my_gEfiNicIp4ConfigProtocolGuid, L"EFI_NIC_IP4_CONFIG_PROTOCOL_GUID" }, \
-  { &my_gEfiNicIp4ConfigVariableGuid, L"EFI_NIC_IP4_CONFIG_VARIABLE_GUID" }, \
-  { &my_gEfiNonsmmemul6064trapProtocolGuid, L"EFI_NONSMMEMUL6064TRAP_PROTOCOL_GUID" }, \
-  { &my_gEfiPathFileNameGuid, L"EFI_PATH_FILE_NAME_GUID" }, \
-  { &my_gEfiPccardCsProtocolGuid, L"EFI_PCCARD_CS_PROTOCOL_GUID" }, \
-  { &my_gEfiPccardSsProtocolGuid, L"EFI_PCCARD_SS_PROTOCOL_GUID" }, \
-  { &my_gEfiPchS3ImageGuid, L"EFI_PCH_S3_IMAGE_GUID" }, \
-  { &my_gEfiPciHotplugDeviceGuid, L"EFI_PCI_HOTPLUG_DEVICE_GUID" }, \
-  { &my_gEfiPcmciaRequestProtocolGuid, L"EFI_PCMCIA_REQUEST_PROTOCOL_GUID" }, \
-  { &my_gEfiPeiAmiKeycodePpiGuid, L"EFI_PEI_AMI_KEYCODE_PPI_GUID" }, \
-  { &my_gEfiPeiCmosAccessGuid, L"EFI_PEI_CMOS_ACCESS_GUID" }, \
-  { &my_gEfiPeiConsplitAmiKeycodePpiGuid, L"EFI_PEI_CONSPLIT_AMI_KEYCODE_PPI_GUID" }, \
-  { &my_gEfiPeiCorePrivateGuid, L"EFI_PEI_CORE_PRIVATE_GUID" }, \
-  { &my_gEfiPeiFlushInstructionCacheGuid, L"EFI_PEI_FLUSH_INSTRUCTION_CACHE_GUID" }, \
-  { &my_gEfiPeiPerformanceHobGuid, L"EFI_PEI_PERFORMANCE_HOB_GUID" }, \
-  { &my_gEfiPeiPeCoffLoaderGuid, L"EFI_PEI_PE_COFF_LOADER_GUID" }, \
-  { &my_gEfiPeiPlatformpeiExecutedPpiGuid, L"EFI_PEI_PLATFORMPEI_EXECUTED_PPI_GUID" }, \
-  { &my_gEfiPeiTransferControlGuid, L"EFI_PEI_TRANSFER_CONTROL_GUID" }, \
-  { &my_gEfiPerformanceProtocolGuid, L"EFI_PERFORMANCE_PROTOCOL_GUID" }, \
-  { &my_gEfiPlatformInfoProtocolGuid, L"EFI_PLATFORM_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiPlatformMemtestProtocolGuid, L"EFI_PLATFORM_MEMTEST_PROTOCOL_GUID" }, \
-  { &my_gEfiPpmGlobalNvsAreaProtocolGuid, L"EFI_PPM_GLOBAL_NVS_AREA_PROTOCOL_GUID" }, \
-  { &my_gEfiPpmInfoProtocolGuid, L"EFI_PPM_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiPrimaryConsoleInDeviceGuid, L"EFI_PRIMARY_CONSOLE_IN_DEVICE_GUID" }, \
-  { &my_gEfiPrimaryConsoleOutDeviceGuid, L"EFI_PRIMARY_CONSOLE_OUT_DEVICE_GUID" }, \
-  { &my_gEfiPrimaryStandardErrorDeviceGuid, L"EFI_PRIMARY_STANDARD_ERROR_DEVICE_GUID" }, \
-  { &my_gEfiPxeDhcp4CallbackProtocolGuid, L"EFI_PXE_DHCP4_CALLBACK_PROTOCOL_GUID" }, \
-  { &my_gEfiPxeDhcp4ProtocolGuid, L"EFI_PXE_DHCP4_PROTOCOL_GUID" }, \
-  { &my_gEfiSaInfoProtocolGuid, L"EFI_SA_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiSbPcieErrorLogDispatchProtocolGuid, L"EFI_SB_PCIE_ERROR_LOG_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSecSmiFlashGuid, L"EFI_SEC_SMI_FLASH_GUID" }, \
-  { &my_gEfiSerialGpioProtocolGuid, L"EFI_SERIAL_GPIO_PROTOCOL_GUID" }, \
-  { &my_gEfiShellFileGuid, L"EFI_SHELL_FILE_GUID" }, \
-  { &my_gEfiSimpleAudioOutProtocolGuid, L"EFI_SIMPLE_AUDIO_OUT_PROTOCOL_GUID" }, \
-  { &my_gEfiSmbiosBoardProtocolGuid, L"EFI_SMBIOS_BOARD_PROTOCOL_GUID" }, \
-  { &my_gEfiSmbiosDynamicDataGuid, L"EFI_SMBIOS_DYNAMIC_DATA_GUID" }, \
-  { &my_gEfiSmbiosNvramDataGuid, L"EFI_SMBIOS_NVRAM_DATA_GUID" }, \
-  { &my_gEfiSmbiosStaticDataGuid, L"EFI_SMBIOS_STATIC_DATA_GUID" }, \
-  { &my_gEfiSmmBiosWriteDispatchProtocolGuid, L"EFI_SMM_BIOS_WRITE_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmCmosAccessGuid, L"EFI_SMM_CMOS_ACCESS_GUID" }, \
-  { &my_gEfiSmmIoTrapDispatchProtocolGuid, L"EFI_SMM_IO_TRAP_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmRcToAptioBridgeGuid, L"EFI_SMM_RC_TO_APTIO_BRIDGE_GUID" }, \
-  { &my_gEfiSmmRuntimeProtocolGuid, L"EFI_SMM_RUNTIME_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmRuntimeServicesTableGuid, L"EFI_SMM_RUNTIME_SERVICES_TABLE_GUID" }, \
-  { &my_gEfiSmmTcoDispatchProtocolGuid, L"EFI_SMM_TCO_DISPATCH_PROTOCOL_GUID" }, \
-  { &my_gEfiSmmThunkProtocolGuid, L"EFI_SMM_THUNK_PROTOCOL_GUID" }, \
-  { &my_gEfiSmramNvsHeaderGuid, L"EFI_SMRAM_NVS_HEADER_GUID" }, \
-  { &my_gEfiSmtpProtocolGuid, L"EFI_SMTP_PROTOCOL_GUID" }, \
-  { &my_gEfiStandardCallerIdGuid, L"EFI_STANDARD_CALLER_ID_GUID" }, \
-  { &my_gEfiStatusCodeArchProtocolGuid, L"EFI_STATUS_CODE_ARCH_PROTOCOL_GUID" }, \
-  { &my_gEfiStatusCodeDataTypeAssertGuid, L"EFI_STATUS_CODE_DATA_TYPE_ASSERT_GUID" }, \
-  { &my_gEfiStatusCodeDataTypeErrorGuid, L"EFI_STATUS_CODE_DATA_TYPE_ERROR_GUID" }, \
-  { &my_gEfiStatusCodeDataTypeExceptionHandlerGuid, L"EFI_STATUS_CODE_DATA_TYPE_EXCEPTION_HANDLER_GUID" }, \
-  { &my_gEfiStatusCodeDataTypeProgressCodeGuid, L"EFI_STATUS_CODE_DATA_TYPE_PROGRESS_CODE_GUID" }, \
-  { &my_gEfiSystemNvDataHobGuid, L"EFI_SYSTEM_NV_DATA_HOB_GUID" }, \
-  { &my_gEfiSystemTypeFruGuid, L"EFI_SYSTEM_TYPE_FRU_GUID" }, \
-  { &my_gEfiTcgLogHobGuid, L"EFI_TCG_LOG_HOB_GUID" }, \
-  { &my_gEfiTcgPlatformProtocolGuid, L"EFI_TCG_PLATFORM_PROTOCOL_GUID" }, \
-  { &my_gEfiTcgWakeEventDataHobGuid, L"EFI_TCG_WAKE_EVENT_DATA_HOB_GUID" }, \
-  { &my_gEfiTcpProtocolGuid, L"EFI_TCP_PROTOCOL_GUID" }, \
-  { &my_gEfiTcpSockProtocolGuid, L"EFI_TCP_SOCK_PROTOCOL_GUID" }, \
-  { &my_gEfiTelnetServerProtocolGuid, L"EFI_TELNET_SERVER_PROTOCOL_GUID" }, \
-  { &my_gEfiTianoDecompressProtocolGuid, L"EFI_TIANO_DECOMPRESS_PROTOCOL_GUID" }, \
-  { &my_gEfiTimeVariableGuid, L"EFI_TIME_VARIABLE_GUID" }, \
-  { &my_gEfiTpmStateInitHubGuid, L"EFI_TPM_STATE_INIT_HUB_GUID" }, \
-  { &my_gEfiTxtInfoProtocolGuid, L"EFI_TXT_INFO_PROTOCOL_GUID" }, \
-  { &my_gEfiUdpProtocolGuid, L"EFI_UDP_PROTOCOL_GUID" }, \
-  { &my_gEfiUgaSplashProtocolGuid, L"EFI_UGA_SPLASH_PROTOCOL_GUID" }, \
-  { &my_gEfiUsbAtapiProtocolGuid, L"EFI_USB_ATAPI_PROTOCOL_GUID" }, \
-  { &my_gEfiUsbPolicyProtocolGuid, L"EFI_USB_POLICY_PROTOCOL_GUID" }, \
-  { &my_gEfiUsbProtocolGuid, L"EFI_USB_PROTOCOL_GUID" }, \
-  { &my_gEfiVariableStoreProtocolGuid, L"EFI_VARIABLE_STORE_PROTOCOL_GUID" }, \
-  { &my_gEfiVirtualMemoryAccessProtocolGuid, L"EFI_VIRTUAL_MEMORY_ACCESS_PROTOCOL_GUID" }, \
-  { &my_gErrorManagerGuid, L"ERROR_MANAGER_GUID" }, \
-  { &my_gExitFormSetGuid, L"EXIT_FORM_SET_GUID" }, \
-  { &my_gFastBootTseProtocolGuid, L"FAST_BOOT_TSE_PROTOCOL_GUID" }, \
-  { &my_gFastBootVariableGuid, L"FAST_BOOT_VARIABLE_GUID" }, \
-  { &my_gFidFfsSectionGuid, L"FID_FFS_SECTION_GUID" }, \
-  { &my_gFidTableGuid, L"FID_TABLE_GUID" }, \
-  { &my_gFirmwarePerformanceProtocolGuid, L"FIRMWARE_PERFORMANCE_PROTOCOL_GUID" }, \
-  { &my_gFlashProtocolGuid, L"FLASH_PROTOCOL_GUID" }, \
-  { &my_gFlashSmmProtocolGuid, L"FLASH_SMM_PROTOCOL_GUID" }, \
-  { &my_gFlashUpdateGuid, L"FLASH_UPDATE_GUID" }, \
-  { &my_gFontFfsFileGuid, L"FONT_FFS_FILE_GUID" }, \
-  { &my_gFpdtPerformanceProtocolGuid, L"FPDT_PERFORMANCE_PROTOCOL_GUID" }, \
-  { &my_gFwVersionGuid, L"FW_VERSION_GUID" }, \
-  { &my_gHddSecurityEndProtocolGuid, L"HDD_SECURITY_END_PROTOCOL_GUID" }, \
-  { &my_gHddSecurityInitProtocolGuid, L"HDD_SECURITY_INIT_PROTOCOL_GUID" }, \
-  { &my_gHddSmartInitProtocolGuid, L"HDD_SMART_INIT_PROTOCOL_GUID" }, \
-  { &my_gHddUnlockedGuid, L"HDD_UNLOCKED_GUID" }, \
-  { &my_gHiiResourcesFfsSectionGuid, L"HII_RESOURCES_FFS_SECTION_GUID" }, \
-  { &my_gHotPlugDeviceGuid, L"HOT_PLUG_DEVICE_GUID" }, \
-  { &my_gIccOverclockingProtocolGuid, L"ICC_OVERCLOCKING_PROTOCOL_GUID" }, \
-  { &my_gIccPersistentDataGuid, L"ICC_PERSISTENT_DATA_GUID" }, \
-  { &my_gIccVolatileSetupDataGuid, L"ICC_VOLATILE_SETUP_DATA_GUID" }, \
-  { &my_gIdeBusDriverBindingProtocolGuid, L"IDE_BUS_DRIVER_BINDING_PROTOCOL_GUID" }, \
-  { &my_gIdeBusInitProtocolGuid, L"IDE_BUS_INIT_PROTOCOL_GUID" }, \
-  { &my_gIdeControllerProtocolGuid, L"IDE_CONTROLLER_PROTOCOL_GUID" }, \
-  { &my_gIdeHpaInterfaceGuid, L"IDE_HPA_INTERFACE_GUID" }, \
-  { &my_gIdePowerMgmtInterfaceGuid, L"IDE_POWER_MGMT_INTERFACE_GUID" }, \
-  { &my_gIdeSecurityInterfaceGuid, L"IDE_SECURITY_INTERFACE_GUID" }, \
-  { &my_gIdeSecurityPwnvGuid, L"IDE_SECURITY_PWNV_GUID" }, \
-  { &my_gIdeSetupProtocolGuid, L"IDE_SETUP_PROTOCOL_GUID" }, \
-  { &my_gIdeSmartInterfaceGuid, L"IDE_SMART_INTERFACE_GUID" }, \
-  { &my_gIffsAcpiTableStorageGuid, L"IFFS_ACPI_TABLE_STORAGE_GUID" }, \
-  { &my_gIffsGlobalNvsAreaProtocolGuid, L"IFFS_GLOBAL_NVS_AREA_PROTOCOL_GUID" }, \
-  { &my_gIffsGptGuid, L"IFFS_GPT_GUID" }, \
-  { &my_gIffsInfoProtocolGuid, L"IFFS_INFO_PROTOCOL_GUID" }, \
-  { &my_gIffsPartitionStatusProtocolGuid, L"IFFS_PARTITION_STATUS_PROTOCOL_GUID" }, \
-  { &my_gIffsPersistentDataGuid, L"IFFS_PERSISTENT_DATA_GUID" }, \
-  { &my_gIffsPlatformPolicyProtocolGuid, L"IFFS_PLATFORM_POLICY_PROTOCOL_GUID" }, \
-  { &my_gIffsPpiGuid, L"IFFS_PPI_GUID" }, \
-  { &my_gIntelMebxProtocolGuid, L"INTEL_MEBX_PROTOCOL_GUID" }, \
-  { &my_gMainFormSetGuid, L"MAIN_FORM_SET_GUID" }, \
-  { &my_gMdesStatusCodeProtocolGuid, L"MDES_STATUS_CODE_PROTOCOL_GUID" }, \
-  { &my_gMebxFileGuid, L"MEBX_FILE_GUID" }, \
-  { &my_gMeudErrorGuid, L"MEUD_ERROR_GUID" }, \
-  { &my_gMeudFileGuid, L"MEUD_FILE_GUID" }, \
-  { &my_gMeAlertAtHandlerGuid, L"ME_ALERT_AT_HANDLER_GUID" }, \
-  { &my_gMeBiosPayloadDataProtocolGuid, L"ME_BIOS_PAYLOAD_DATA_PROTOCOL_GUID" }, \
-  { &my_gMeInfoSetupGuid, L"ME_INFO_SETUP_GUID" }, \
-  { &my_gMePlatformGetResetTypeGuid, L"ME_PLATFORM_GET_RESET_TYPE_GUID" }, \
-  { &my_gMicrocodeLoaderPpiGuid, L"MICROCODE_LOADER_PPI_GUID" }, \
-  { &my_gMxm30PeiGuid, L"MXM30_PEI_GUID" }, \
-  { &my_gMxm3EfiGuid, L"MXM3_EFI_GUID" }, \
-  { &my_gMxmoem1Guid, L"MXMOEM1_GUID" }, \
-  { &my_gNbciEfiGuid, L"NBCI_EFI_GUID" }, \
-  { &my_gNetworkStackGuid, L"NETWORK_STACK_GUID" }, \
-  { &my_gNvramHobGuid, L"NVRAM_HOB_GUID" }, \
-  { &my_gNvramMailboxAddressVariableGuid, L"NVRAM_MAILBOX_ADDRESS_VARIABLE_GUID" }, \
-  { &my_gOemRecoveryCapsuleGuid, L"OEM_RECOVERY_CAPSULE_GUID" }, \
-  { &my_gOemRomHole0Guid, L"OEM_ROM_HOLE_0_GUID" }, \
-  { &my_gOemRomHole1Guid, L"OEM_ROM_HOLE_1_GUID" }, \
-  { &my_gOemTseVarGuid, L"OEM_TSE_VAR_GUID" }, \
-  { &my_gOnboardRaidGuid, L"ONBOARD_RAID_GUID" }, \
-  { &my_gOpalSecInitProtocolGuid, L"OPAL_SEC_INIT_PROTOCOL_GUID" }, \
-  { &my_gOpromStartEndProtocolGuid, L"OPROM_START_END_PROTOCOL_GUID" }, \
-  { &my_gPartitionVariableGuid, L"PARTITION_VARIABLE_GUID" }, \
-  { &my_gPasswordHobGuid, L"PASSWORD_HOB_GUID" }, \
-  { &my_gPchDmiTcVcPpiGuid, L"PCH_DMI_TC_VC_PPI_GUID" }, \
-  { &my_gPchEfiRaidDriverExecutionGuid, L"PCH_EFI_RAID_DRIVER_EXECUTION_GUID" }, \
-  { &my_gPchMeUmaPpiGuid, L"PCH_ME_UMA_PPI_GUID" }, \
-  { &my_gPeiAmtPlatformPolicyPpiGuid, L"PEI_AMT_PLATFORM_POLICY_PPI_GUID" }, \
-  { &my_gPeiAmtStatusCodePpiGuid, L"PEI_AMT_STATUS_CODE_PPI_GUID" }, \
-  { &my_gPeiApStartupFileGuid, L"PEI_AP_STARTUP_FILE_GUID" }, \
-  { &my_gPeiAtaPolicyPpiGuid, L"PEI_ATA_POLICY_PPI_GUID" }, \
-  { &my_gPeiBaseMemoryTestGuid, L"PEI_BASE_MEMORY_TEST_GUID" }, \
-  { &my_gPeiBiosAcmFileGuid, L"PEI_BIOS_ACM_FILE_GUID" }, \
-  { &my_gPeiBootScriptDonePpiGuid, L"PEI_BOOT_SCRIPT_DONE_PPI_GUID" }, \
-  { &my_gPeiCachePpiGuid, L"PEI_CACHE_PPI_GUID" }, \
-  { &my_gPeiCpuPlatformPolicyPpiGuid, L"PEI_CPU_PLATFORM_POLICY_PPI_GUID" }, \
-  { &my_gPeiFlashMapPpiGuid, L"PEI_FLASH_MAP_PPI_GUID" }, \
-  { &my_gPeiIdeRecoveryNativeModePpiGuid, L"PEI_IDE_RECOVERY_NATIVE_MODE_PPI_GUID" }, \
-  { &my_gPeiIffsTransitionStartPpiGuid, L"PEI_IFFS_TRANSITION_START_PPI_GUID" }, \
-  { &my_gPeiInMemoryGuid, L"PEI_IN_MEMORY_GUID" }, \
-  { &my_gPeiPlatformMemoryRangePpiGuid, L"PEI_PLATFORM_MEMORY_RANGE_PPI_GUID" }, \
-  { &my_gPeiPlatformMemorySizePpiGuid, L"PEI_PLATFORM_MEMORY_SIZE_PPI_GUID" }, \
-  { &my_gPeiStatusCodeMemoryPpiGuid, L"PEI_STATUS_CODE_MEMORY_PPI_GUID" }, \
-  { &my_gPeiTcgInternalFlagsGuid, L"PEI_TCG_INTERNAL_FLAGS_GUID" }, \
-  { &my_gPeiTcgPpiGuid, L"PEI_TCG_PPI_GUID" }, \
-  { &my_gPeiTpmPpi2Guid, L"PEI_TPM_PPI_2_GUID" }, \
-  { &my_gPeiTxtMemoryUnlockedPpiGuid, L"PEI_TXT_MEMORY_UNLOCKED_PPI_GUID" }, \
-  { &my_gPerfTunePpiGuid, L"PERF_TUNE_PPI_GUID" }, \
-  { &my_gPerfTuneProtocolGuid, L"PERF_TUNE_PROTOCOL_GUID" }, \
-  { &my_gPerfTuneWdtPpiGuid, L"PERF_TUNE_WDT_PPI_GUID" }, \
-  { &my_gPerfTuneWdtProtocolGuid, L"PERF_TUNE_WDT_PROTOCOL_GUID" }, \
-  { &my_gPkpubKeyGuid, L"PKPUB_KEY_GUID" }, \
-  { &my_gPkPubFfsFileEfiAuthVarGuid, L"PK_PUB_FFS_FILE_EFI_AUTH_VAR_GUID" }, \
-  { &my_gPlatformIdeProtocolGuid, L"PLATFORM_IDE_PROTOCOL_GUID" }, \
-  { &my_gPlatformMeHookPpiGuid, L"PLATFORM_ME_HOOK_PPI_GUID" }, \
-  { &my_gPpmProcessorSupportProtocol3Guid, L"PPM_PROCESSOR_SUPPORT_PROTOCOL_3_GUID" }, \
-  { &my_gPrKeyFfsFileRawGuid, L"PR_KEY_FFS_FILE_RAW_GUID" }, \
-  { &my_gPrKeyGuid, L"PR_KEY_GUID" }, \
-  { &my_gPtidFfsTableStorageGuid, L"PTID_FFS_TABLE_STORAGE_GUID" }, \
-  { &my_gRecoveryFormSetGuid, L"RECOVERY_FORM_SET_GUID" }, \
-  { &my_gRomCacheEnablePpiGuid, L"ROM_CACHE_ENABLE_PPI_GUID" }, \
-  { &my_gRomImageAddressGuid, L"ROM_IMAGE_ADDRESS_GUID" }, \
-  { &my_gRomImageMemoryHobGuid, L"ROM_IMAGE_MEMORY_HOB_GUID" }, \
-  { &my_gRomLayoutFfsGuid, L"ROM_LAYOUT_FFS_GUID" }, \
-  { &my_gRomLayoutSectionGuid, L"ROM_LAYOUT_SECTION_GUID" }, \
-  { &my_gRsdpPlusProtocolGuid, L"RSDP_PLUS_PROTOCOL_GUID" }, \
-  { &my_gSataControllerProtocolGuid, L"SATA_CONTROLLER_PROTOCOL_GUID" }, \
-  { &my_gSaPegDataHobGuid, L"SA_PEG_DATA_HOB_GUID" }, \
-  { &my_gSaPegDataVariableGuid, L"SA_PEG_DATA_VARIABLE_GUID" }, \
-  { &my_gSaPlatformPolicyPpiGuid, L"SA_PLATFORM_POLICY_PPI_GUID" }, \
-  { &my_gSecurityFormSetGuid, L"SECURITY_FORM_SET_GUID" }, \
-  { &my_gSerialRecoveryCapsuleGuid, L"SERIAL_RECOVERY_CAPSULE_GUID" }, \
-  { &my_gSetupDefaultsFfsGuid, L"SETUP_DEFAULTS_FFS_GUID" }, \
-  { &my_gSgoemAcpiSsdtGuid, L"SGOEM_ACPI_SSDT_GUID" }, \
-  { &my_gSgtpvAcpiSsdtGuid, L"SGTPV_ACPI_SSDT_GUID" }, \
-  { &my_gSgAcpiTableStorageGuid, L"SG_ACPI_TABLE_STORAGE_GUID" }, \
-  { &my_gSgInfoHobGuid, L"SG_INFO_HOB_GUID" }, \
-  { &my_gSgPeiInitPpiGuid, L"SG_PEI_INIT_PPI_GUID" }, \
-  { &my_gSgPlatformPolicyPpiGuid, L"SG_PLATFORM_POLICY_PPI_GUID" }, \
-  { &my_gSioDevStatusVarGuid, L"SIO_DEV_STATUS_VAR_GUID" }, \
-  { &my_gSioIoProtocolGuid, L"SIO_IO_PROTOCOL_GUID" }, \
-  { &my_gSmmChildDispatcher2Guid, L"SMM_CHILD_DISPATCHER2_GUID" }, \
-  { &my_gSmramCpuDataHeaderGuid, L"SMRAM_CPU_DATA_HEADER_GUID" }, \
-  { &my_gSmramCpuDataVariableGuid, L"SMRAM_CPU_DATA_VARIABLE_GUID" }, \
-  { &my_gSmBusControllerIdentifierGuid, L"SM_BUS_CONTROLLER_IDENTIFIER_GUID" }, \
-  { &my_gSystemAccessGuid, L"SYSTEM_ACCESS_GUID" }, \
-  { &my_gTcgLockDownVarGuid, L"TCG_LOCK_DOWN_VAR_GUID" }, \
-  { &my_gTcgPlatformSetupPeiPolicyGuid, L"TCG_PLATFORM_SETUP_PEI_POLICY_GUID" }, \
-  { &my_gTcgPlatformSetupPolicyGuid, L"TCG_PLATFORM_SETUP_POLICY_GUID" }, \
-  { &my_gTcgPpiSyncFlagGuid, L"TCG_PPI_SYNC_FLAG_GUID" }, \
-  { &my_gTdthiProtocolFixedGuid, L"TDTHI_PROTOCOL_FIXED_GUID" }, \
-  { &my_gTdthiProtocolGuid, L"TDTHI_PROTOCOL_GUID" }, \
-  { &my_gTdtVolatileSetupDataGuid, L"TDT_VOLATILE_SETUP_DATA_GUID" }, \
-  { &my_gTpmBootFlowVariableGuid, L"TPM_BOOT_FLOW_VARIABLE_GUID" }, \
-  { &my_gTxtInfoHobGuid, L"TXT_INFO_HOB_GUID" }, \
-  { &my_gTxtOneTouchGuid, L"TXT_ONE_TOUCH_GUID" }, \
-  { &my_gTxtOneTouchOpProtocolGuid, L"TXT_ONE_TOUCH_OP_PROTOCOL_GUID" }, \
-  { &my_gUsbTimingPolicyProtocolGuid, L"USB_TIMING_POLICY_PROTOCOL_GUID" }, \
-  { &my_gUserDefaultsGuid, L"USER_DEFAULTS_GUID" }, \
-  { &my_gWdtAppProtocolGuid, L"WDT_APP_PROTOCOL_GUID" }, \
-  { &my_gWdtHobGuid, L"WDT_HOB_GUID" }, \
-  { &my_gWdtPersistentDataGuid, L"WDT_PERSISTENT_DATA_GUID" }, \
-  { &my_gWdtPpiGuid, L"WDT_PPI_GUID" }, \
-  { &my_gWdtProtocolGuid, L"WDT_PROTOCOL_GUID" }, \
-  { &my_gAsrockAcpis4DxeGuid, L"ASROCK_ACPIS4_DXE_GUID" }, \
-  { &my_gAsrockUsbrtGuid, L"ASROCK_USBRT_GUID" }, \
-  { &my_gAsrockRaidSetupGuid, L"ASROCK_RAID_SETUP_GUID" }, \
-  { &my_gAsrockRaidLoaderGuid, L"ASROCK_RAID_LOADER_GUID" }, \
-  { &my_gAsrockSioslpsmiGuid, L"ASROCK_SIOSLPSMI_GUID" }, \
-  { &my_gAsrockPleddxeGuid, L"ASROCK_PLEDDXE_GUID" }, \
-  { &my_gAsrockADefaultDxeGuid, L"ASROCK_A_DEFAULT_DXE_GUID" }, \
-  { &my_gAsrockUserDefSetupDxeGuid, L"ASROCK_USER_DEF_SETUP_DXE_GUID" }, \
-  { &my_gAsrockWakeupCtrlSmmGuid, L"ASROCK_WAKEUP_CTRL_SMM_GUID" }, \
-  { &my_gAsrockAmiAgesaDxeGuid, L"ASROCK_AMI_AGESA_DXE_GUID" }, \
-  { &my_gAsrockHddReadySmiGuid, L"ASROCK_HDD_READY_SMI_GUID" }, \
-  { &my_gAsrockMouseDriverGuid, L"ASROCK_MOUSE_DRIVER_GUID" }, \
-  { &my_gAsrockIdesmmGuid, L"ASROCK_IDESMM_GUID" }, \
-  { &my_gAsrockBfgsmiGuid, L"ASROCK_BFGSMI_GUID" }, \
-  { &my_gAsrockAsrlogodxeGuid, L"ASROCK_ASRLOGODXE_GUID" }, \
-  { &my_gAsrockAsm104XDxeGuid, L"ASROCK_ASM104_X_DXE_GUID" }, \
-  { &my_gAsrockHdaudioSmiGuid, L"ASROCK_HDAUDIO_SMI_GUID" }, \
-  { &my_gAsrockSmBusDxeGuid, L"ASROCK_SM_BUS_DXE_GUID" }, \
-  { &my_gAsrockUsbint13Guid, L"ASROCK_USBINT13_GUID" }, \
-  { &my_gAsrockSlpSupportGuid, L"ASROCK_SLP_SUPPORT_GUID" }, \
-  { &my_gAsrockPataControllerGuid, L"ASROCK_PATA_CONTROLLER_GUID" }, \
-  { &my_gAsrockSataControllerGuid, L"ASROCK_SATA_CONTROLLER_GUID" }, \
-  { &my_gAsrockAcpis4SmmGuid, L"ASROCK_ACPIS4_SMM_GUID" }, \
-  { &my_gAsrockPostReportGuid, L"ASROCK_POST_REPORT_GUID" }, \
-  { &my_gAsrockClockGenDxeGuid, L"ASROCK_CLOCK_GEN_DXE_GUID" }, \
-  { &my_gAsrockUhcdGuid, L"ASROCK_UHCD_GUID" }, \
-  { &my_gAsrockLegacyRegionGuid, L"ASROCK_LEGACY_REGION_GUID" }, \
-  { &my_gAsrockSleepSmiGuid, L"ASROCK_SLEEP_SMI_GUID" }, \
-  { &my_gAsrockCmosManagerSmmGuid, L"ASROCK_CMOS_MANAGER_SMM_GUID" }, \
-  { &my_gAsrockAmdAgesaDxeDriverGuid, L"ASROCK_AMD_AGESA_DXE_DRIVER_GUID" }, \
-  { &my_gAsrockReFlashGuid, L"ASROCK_RE_FLASH_GUID" }, \
-  { &my_gAsrockLegacyInterruptGuid, L"ASROCK_LEGACY_INTERRUPT_GUID" }, \
-  { &my_gAsrockSmmChildDispatcherGuid, L"ASROCK_SMM_CHILD_DISPATCHER_GUID" }, \
-  { &my_gAsrockBfgdxeGuid, L"ASROCK_BFGDXE_GUID" }, \
-  { &my_gAsrockIflashsetupGuid, L"ASROCK_IFLASHSETUP_GUID" }, \
-  { &my_gAsrockS4SleepdelayGuid, L"ASROCK_S4_SLEEPDELAY_GUID" }, \
-  { &my_gAsrockHddReadyDxeGuid, L"ASROCK_HDD_READY_DXE_GUID" }, \
-  { &my_gAsrockRtlandxeGuid, L"ASROCK_RTLANDXE_GUID" }, \
-  { &my_gAsrockAmdSb900DxeGuid, L"ASROCK_AMD_SB900_DXE_GUID" }, \
-  { &my_gAsrockSb900SmbusLightGuid, L"ASROCK_SB900_SMBUS_LIGHT_GUID" }, \
-  { &my_gAsrockAaftblSmiGuid, L"ASROCK_AAFTBL_SMI_GUID" }, \
-  { &my_gAsrockNvramidGuid, L"ASROCK_NVRAMID_GUID" }, \
-  { &my_gAsrockIdeSecurityGuid, L"ASROCK_IDE_SECURITY_GUID" }, \
-  { &my_gAsrockAsm1061DxeGuid, L"ASROCK_ASM1061_DXE_GUID" }, \
-  { &my_gAsrockAsm104XSmiGuid, L"ASROCK_ASM104_X_SMI_GUID" }, \
-  { &my_gAsrockRtlansmiGuid, L"ASROCK_RTLANSMI_GUID" }, \
-  { &my_gAsrockGecUpdateSmiGuid, L"ASROCK_GEC_UPDATE_SMI_GUID" }, \
-  { &my_gAsrockApmoffGuid, L"ASROCK_APMOFF_GUID" }, \
-  { &my_gAsrockSmiflashGuid, L"ASROCK_SMIFLASH_GUID" }, \
-  { &my_gAsrockRaidX64Guid, L"ASROCK_RAID_X64_GUID" }, \
-  { &my_gAsrockAmdSb900SmmGuid, L"ASROCK_AMD_SB900_SMM_GUID" }, \
-  { &my_gAsrockFirewireGuid, L"ASROCK_FIREWIRE_GUID" }, \
-  { &my_gAsrockIdeSmartGuid, L"ASROCK_IDE_SMART_GUID" }, \
-  { &my_gAsrockSbInterfaceDxeGuid, L"ASROCK_SB_INTERFACE_DXE_GUID" }, \
-  { &my_gAsrockAmdSb900SmmDispatcherGuid, L"ASROCK_AMD_SB900_SMM_DISPATCHER_GUID" }, \
-  { &my_gAsrockAmdcpuDxeGuid, L"ASROCK_AMDCPU_DXE_GUID" }, \
-  { &my_gAsrockSmbiosDmieditGuid, L"ASROCK_SMBIOS_DMIEDIT_GUID" }, \
-  { &my_gAsrockSecuritySelectDxeGuid, L"ASROCK_SECURITY_SELECT_DXE_GUID" }, \
-  { &my_gAsrockFileExplorerLiteGuid, L"ASROCK_FILE_EXPLORER_LITE_GUID" }, \
-  { &my_gAsrockPledsmmGuid, L"ASROCK_PLEDSMM_GUID" }, \
-  { &my_gAsrockCpuSmbiosDriverGuid, L"ASROCK_CPU_SMBIOS_DRIVER_GUID" }, \
-  { &my_gAsrockAaftblDxeGuid, L"ASROCK_AAFTBL_DXE_GUID" }, \
-  { &my_gDellComputraceBinaryGuid, L"DELL_COMPUTRACE_BINARY_GUID" }, \
-  { &my_gDellMebxSetupBinaryGuid, L"DELL_MEBX_SETUP_BINARY_GUID" }, \
-  { &my_gDellErrorLogConfigGuid, L"DELL_ERROR_LOG_CONFIG_GUID" }, \
-  { &my_gDellFpThunkGuid, L"DELL_FP_THUNK_GUID" }, \
-  { &my_gDellIntelLomSmmGuid, L"DELL_INTEL_LOM_SMM_GUID" }, \
-  { &my_gDellLegacyVideoRomGuid, L"DELL_LEGACY_VIDEO_ROM_GUID" }, \
-  { &my_gDellPchS3SupportGuid, L"DELL_PCH_S3_SUPPORT_GUID" }, \
-  { &my_gDellSpiPartMicronGuid, L"DELL_SPI_PART_MICRON_GUID" }, \
-  { &my_gDellDcpRegisterGuid, L"DELL_DCP_REGISTER_GUID" }, \
-  { &my_gDellAhciDxeGuid, L"DELL_AHCI_DXE_GUID" }, \
-  { &my_gDellSimpleBootFlagSrcGuid, L"DELL_SIMPLE_BOOT_FLAG_SRC_GUID" }, \
-  { &my_gDellEdiagsDxeGuid, L"DELL_EDIAGS_DXE_GUID" }, \
-  { &my_gDellAcpiOemConfigGuid, L"DELL_ACPI_OEM_CONFIG_GUID" }, \
-  { &my_gDellSpiPartMxicGuid, L"DELL_SPI_PART_MXIC_GUID" }, \
-  { &my_gDellDtwlanSmmGuid, L"DELL_DTWLAN_SMM_GUID" }, \
-  { &my_gDellLegacy16RomGuid, L"DELL_LEGACY16_ROM_GUID" }, \
-  { &my_gDellDeviceNameConfigGuid, L"DELL_DEVICE_NAME_CONFIG_GUID" }, \
-  { &my_gDellAi13RomGuid, L"DELL_AI13_ROM_GUID" }, \
-  { &my_gDellJpegDecoderGuid, L"DELL_JPEG_DECODER_GUID" }, \
-  { &my_gDellDaHddProtectionGuid, L"DELL_DA_HDD_PROTECTION_GUID" }, \
-  { &my_gDellDccsSmmDriverGuid, L"DELL_DCCS_SMM_DRIVER_GUID" }, \
-  { &my_gDellIntrusionDetectSmmGuid, L"DELL_INTRUSION_DETECT_SMM_GUID" }, \
-  { &my_gDellVirtRtcSmmGuid, L"DELL_VIRT_RTC_SMM_GUID" }, \
-  { &my_gDellSmmHwmDriverGuid, L"DELL_SMM_HWM_DRIVER_GUID" }, \
-  { &my_gDellSmBiosStrucDbGuid, L"DELL_SM_BIOS_STRUC_DB_GUID" }, \
-  { &my_gDellCenturyRolloverSmmGuid, L"DELL_CENTURY_ROLLOVER_SMM_GUID" }, \
-  { &my_gDellSmmSecurityVaultGuid, L"DELL_SMM_SECURITY_VAULT_GUID" }, \
-  { &my_gDellDxeSwSmiGuid, L"DELL_DXE_SW_SMI_GUID" }, \
-  { &my_gDellSmmSbAcpiGuid, L"DELL_SMM_SB_ACPI_GUID" }, \
-  { &my_gDellSmmAccessGuid, L"DELL_SMM_ACCESS_GUID" }, \
-  { &my_gDellMfgModeSmmDriverGuid, L"DELL_MFG_MODE_SMM_DRIVER_GUID" }, \
-  { &my_gDellSpiPartAtmelGuid, L"DELL_SPI_PART_ATMEL_GUID" }, \
-  { &my_gDellEdiagsConfigGuid, L"DELL_EDIAGS_CONFIG_GUID" }, \
-  { &my_gDellVariableSmmGuid, L"DELL_VARIABLE_SMM_GUID" }, \
-  { &my_gDellSmmGpioPolicyGuid, L"DELL_SMM_GPIO_POLICY_GUID" }, \
-  { &my_gDellAcpiGuid, L"DELL_ACPI_GUID" }, \
-  { &my_gDellRuntimeAcpiDxeGuid, L"DELL_RUNTIME_ACPI_DXE_GUID" }, \
-  { &my_gDellServiceMenuGuid, L"DELL_SERVICE_MENU_GUID" }, \
-  { &my_gDellMonotonicCounterGuid, L"DELL_MONOTONIC_COUNTER_GUID" }, \
-  { &my_gDellCsmOemRomGuid, L"DELL_CSM_OEM_ROM_GUID" }, \
-  { &my_gDellDiagsSbControlSmmGuid, L"DELL_DIAGS_SB_CONTROL_SMM_GUID" }, \
-  { &my_gDellAmtPlatformPolicyGuid, L"DELL_AMT_PLATFORM_POLICY_GUID" }, \
-  { &my_gDellMfgAuthenticationGuid, L"DELL_MFG_AUTHENTICATION_GUID" }, \
-  { &my_gDellSmBiosStrucDaGuid, L"DELL_SM_BIOS_STRUC_DA_GUID" }, \
-  { &my_gDellDxeComputraceGuid, L"DELL_DXE_COMPUTRACE_GUID" }, \
-  { &my_gDellSmmStatusCodeGuid, L"DELL_SMM_STATUS_CODE_GUID" }, \
-  { &my_gDellPowerButtonConfigGuid, L"DELL_POWER_BUTTON_CONFIG_GUID" }, \
-  { &my_gDellRebootDxeGuid, L"DELL_REBOOT_DXE_GUID" }, \
-  { &my_gDellFlashIoDxeGuid, L"DELL_FLASH_IO_DXE_GUID" }, \
-  { &my_gDellSmBiosStrucB1Guid, L"DELL_SM_BIOS_STRUC_B1_GUID" }, \
-  { &my_gDellIoTrapGuid, L"DELL_IO_TRAP_GUID" }, \
-  { &my_gDellSmBiosDxeDriverGuid, L"DELL_SM_BIOS_DXE_DRIVER_GUID" }, \
-  { &my_gDellUpdateMemoryRecordGuid, L"DELL_UPDATE_MEMORY_RECORD_GUID" }, \
-  { &my_gDellBiosBlkIoSrcGuid, L"DELL_BIOS_BLK_IO_SRC_GUID" }, \
-  { &my_gDellAcpis3SaveGuid, L"DELL_ACPIS3_SAVE_GUID" }, \
-  { &my_gDellSbServicesSmmGuid, L"DELL_SB_SERVICES_SMM_GUID" }, \
-  { &my_gDellSystemIdConfigDxeGuid, L"DELL_SYSTEM_ID_CONFIG_DXE_GUID" }, \
-  { &my_gDellOromKbAccessGuid, L"DELL_OROM_KB_ACCESS_GUID" }, \
-  { &my_gDellSmsc5544DxeGuid, L"DELL_SMSC5544_DXE_GUID" }, \
-  { &my_gDellAmtPetAlertGuid, L"DELL_AMT_PET_ALERT_GUID" }, \
-  { &my_gDellCsmVideoGuid, L"DELL_CSM_VIDEO_GUID" }, \
-  { &my_gDellBindingsSmmGuid, L"DELL_BINDINGS_SMM_GUID" }, \
-  { &my_gDellEdiagsSmmGuid, L"DELL_EDIAGS_SMM_GUID" }, \
-  { &my_gDellPbaUpekDpbaGuid, L"DELL_PBA_UPEK_DPBA_GUID" }, \
-  { &my_gDellPpmPolicyInitDxeGuid, L"DELL_PPM_POLICY_INIT_DXE_GUID" }, \
-  { &my_gDellGenericSioDxeGuid, L"DELL_GENERIC_SIO_DXE_GUID" }, \
-  { &my_gDellSmBiosSmmDaCiGuid, L"DELL_SM_BIOS_SMM_DA_CI_GUID" }, \
-  { &my_gDellUsbMouseGuid, L"DELL_USB_MOUSE_GUID" }, \
-  { &my_gDellDxeGpioPolicyGuid, L"DELL_DXE_GPIO_POLICY_GUID" }, \
-  { &my_gDellGsetGuid, L"DELL_GSET_GUID" }, \
-  { &my_gDellUhciGuid, L"DELL_UHCI_GUID" }, \
-  { &my_gDellSpiPartPromJetGuid, L"DELL_SPI_PART_PROM_JET_GUID" }, \
-  { &my_gDellPciHotPlugGuid, L"DELL_PCI_HOT_PLUG_GUID" }, \
-  { &my_gDellSmbProtocolAccessGuid, L"DELL_SMB_PROTOCOL_ACCESS_GUID" }, \
-  { &my_gDellAlertStandardFormatDxeGuid, L"DELL_ALERT_STANDARD_FORMAT_DXE_GUID" }, \
-  { &my_gDellLegUsbMemSmmGuid, L"DELL_LEG_USB_MEM_SMM_GUID" }, \
-  { &my_gDellErrorHandlerSmmGuid, L"DELL_ERROR_HANDLER_SMM_GUID" }, \
-  { &my_gDellDefaultBootListSmmGuid, L"DELL_DEFAULT_BOOT_LIST_SMM_GUID" }, \
-  { &my_gDellTpmdxeGuid, L"DELL_TPMDXE_GUID" }, \
-  { &my_gDellOemSxSmmGuid, L"DELL_OEM_SX_SMM_GUID" }, \
-  { &my_gDellAcLossSmmGuid, L"DELL_AC_LOSS_SMM_GUID" }, \
-  { &my_gDellDiagsSbControlDxeGuid, L"DELL_DIAGS_SB_CONTROL_DXE_GUID" }, \
-  { &my_gDellSmmLegacyRegionGuid, L"DELL_SMM_LEGACY_REGION_GUID" }, \
-  { &my_gDellPs2EmulGuid, L"DELL_PS2_EMUL_GUID" }, \
-  { &my_gDellMemoryS4Guid, L"DELL_MEMORY_S4_GUID" }, \
-  { &my_gDellSbServicesDxeGuid, L"DELL_SB_SERVICES_DXE_GUID" }, \
-  { &my_gDellStopShipConfigGuid, L"DELL_STOP_SHIP_CONFIG_GUID" }, \
-  { &my_gDellBlockIoGuid, L"DELL_BLOCK_IO_GUID" }, \
-  { &my_gDellPciBusGuid, L"DELL_PCI_BUS_GUID" }, \
-  { &my_gDellTxTdxeGuid, L"DELL_TX_TDXE_GUID" }, \
-  { &my_gDellSmBiosStrucD3Guid, L"DELL_SM_BIOS_STRUC_D3_GUID" }, \
-  { &my_gDellSmbBootPriorityGuid, L"DELL_SMB_BOOT_PRIORITY_GUID" }, \
-  { &my_gDellSpiControllerSmmGuid, L"DELL_SPI_CONTROLLER_SMM_GUID" }, \
-  { &my_gDellMePciPlatformConfigDxeGuid, L"DELL_ME_PCI_PLATFORM_CONFIG_DXE_GUID" }, \
-  { &my_gDellPbaUpekDxeGuid, L"DELL_PBA_UPEK_DXE_GUID" }, \
-  { &my_gDellGpeConfigGuid, L"DELL_GPE_CONFIG_GUID" }, \
-  { &my_gDellPowerOffSmmGuid, L"DELL_POWER_OFF_SMM_GUID" }, \
-  { &my_gDellGpeGuid, L"DELL_GPE_GUID" }, \
-  { &my_gDellPasswordMgrSmmGuid, L"DELL_PASSWORD_MGR_SMM_GUID" }, \
-  { &my_gDellSmmSbGpioControlGuid, L"DELL_SMM_SB_GPIO_CONTROL_GUID" }, \
-  { &my_gDellRaidRomGuid, L"DELL_RAID_ROM_GUID" }, \
-  { &my_gDellSmmDispatcherGuid, L"DELL_SMM_DISPATCHER_GUID" }, \
-  { &my_gDellDxeSioGpioControlGuid, L"DELL_DXE_SIO_GPIO_CONTROL_GUID" }, \
-  { &my_gDellVariableDxeGuid, L"DELL_VARIABLE_DXE_GUID" }, \
-  { &my_gDellCpuSmmGuid, L"DELL_CPU_SMM_GUID" }, \
-  { &my_gDellChassisConfigSmmGuid, L"DELL_CHASSIS_CONFIG_SMM_GUID" }, \
-  { &my_gDellSmmDelayGuid, L"DELL_SMM_DELAY_GUID" }, \
-  { &my_gDellSpiPartEonGuid, L"DELL_SPI_PART_EON_GUID" }, \
-  { &my_gDellChassisConfigDxeGuid, L"DELL_CHASSIS_CONFIG_DXE_GUID" }, \
-  { &my_gDellHiiparserDxeDriverGuid, L"DELL_HIIPARSER_DXE_DRIVER_GUID" }, \
-  { &my_gDellBindingsDxeGuid, L"DELL_BINDINGS_DXE_GUID" }, \
-  { &my_gDellHeciDxeGuid, L"DELL_HECI_DXE_GUID" }, \
-  { &my_gDellSmmBbsmanagerLegacyGuid, L"DELL_SMM_BBSMANAGER_LEGACY_GUID" }, \
-  { &my_gDellGrasslakeConfigGuid, L"DELL_GRASSLAKE_CONFIG_GUID" }, \
-  { &my_gDellIdeSmmGuid, L"DELL_IDE_SMM_GUID" }, \
-  { &my_gDellPasswordMgrDxeGuid, L"DELL_PASSWORD_MGR_DXE_GUID" }, \
-  { &my_gDellMeFwDowngradeGuid, L"DELL_ME_FW_DOWNGRADE_GUID" }, \
-  { &my_gDellCsmConfigGuid, L"DELL_CSM_CONFIG_GUID" }, \
-  { &my_gDellGpeOromGuid, L"DELL_GPE_OROM_GUID" }, \
-  { &my_gDellSmBiosSmmDriverGuid, L"DELL_SM_BIOS_SMM_DRIVER_GUID" }, \
-  { &my_gDellPchSmbusSmmGuid, L"DELL_PCH_SMBUS_SMM_GUID" }, \
-  { &my_gDellDashBiosManagerGuid, L"DELL_DASH_BIOS_MANAGER_GUID" }, \
-  { &my_gDellWdtDxeGuid, L"DELL_WDT_DXE_GUID" }, \
-  { &my_gDellCoreDxeGuid, L"DELL_CORE_DXE_GUID" }, \
-  { &my_gDellPasswordUiGuid, L"DELL_PASSWORD_UI_GUID" }, \
-  { &my_gDellHotSosSmmDriverGuid, L"DELL_HOT_SOS_SMM_DRIVER_GUID" }, \
-  { &my_gDellSioConfigDxeGuid, L"DELL_SIO_CONFIG_DXE_GUID" }, \
-  { &my_gDellTcgDxeGuid, L"DELL_TCG_DXE_GUID" }, \
-  { &my_gDellAcpiConfigGuid, L"DELL_ACPI_CONFIG_GUID" }, \
-  { &my_gDellFlashScreenDxeGuid, L"DELL_FLASH_SCREEN_DXE_GUID" }, \
-  { &my_gDellTxtDxeGuid, L"DELL_TXT_DXE_GUID" }, \
-  { &my_gDellDiagsDxeDriverGuid, L"DELL_DIAGS_DXE_DRIVER_GUID" }, \
-  { &my_gDellFlashUpdateDxeGuid, L"DELL_FLASH_UPDATE_DXE_GUID" }, \
-  { &my_gDellSmmGpeGuid, L"DELL_SMM_GPE_GUID" }, \
-  { &my_gDellRtcAutoOnSmmGuid, L"DELL_RTC_AUTO_ON_SMM_GUID" }, \
-  { &my_gDellSmmFlashWriteProtectGuid, L"DELL_SMM_FLASH_WRITE_PROTECT_GUID" }, \
-  { &my_gDellDiagsConfigGuid, L"DELL_DIAGS_CONFIG_GUID" }, \
-  { &my_gDellAudioConfigDxeGuid, L"DELL_AUDIO_CONFIG_DXE_GUID" }, \
-  { &my_gDellSpecialBootStubGuid, L"DELL_SPECIAL_BOOT_STUB_GUID" }, \
-  { &my_gDellDaServiceTagGuid, L"DELL_DA_SERVICE_TAG_GUID" }, \
-  { &my_gDellDxeSbAcpiGuid, L"DELL_DXE_SB_ACPI_GUID" }, \
-  { &my_gDellMonotonicCounterSmmGuid, L"DELL_MONOTONIC_COUNTER_SMM_GUID" }, \
-  { &my_gDellSmmSbGenericGuid, L"DELL_SMM_SB_GENERIC_GUID" }, \
-  { &my_gDellAcpiModeEnableGuid, L"DELL_ACPI_MODE_ENABLE_GUID" }, \
-  { &my_gDellSmmSioEmiGuid, L"DELL_SMM_SIO_EMI_GUID" }, \
-  { &my_gDellPstateControlGuid, L"DELL_PSTATE_CONTROL_GUID" }, \
-  { &my_gDellDaEppidGuid, L"DELL_DA_EPPID_GUID" }, \
-  { &my_gDellProgressBarGuid, L"DELL_PROGRESS_BAR_GUID" }, \
-  { &my_gDellPbaMgrSmmGuid, L"DELL_PBA_MGR_SMM_GUID" }, \
-  { &my_gDellAmtSetupGuid, L"DELL_AMT_SETUP_GUID" }, \
-  { &my_gDellStorageAgentsDxeGuid, L"DELL_STORAGE_AGENTS_DXE_GUID" }, \
-  { &my_gDellVariableRuntimeDxeGuid, L"DELL_VARIABLE_RUNTIME_DXE_GUID" }, \
-  { &my_gDellPbaScardDxeGuid, L"DELL_PBA_SCARD_DXE_GUID" }, \
-  { &my_gDellSolPostMessageGuid, L"DELL_SOL_POST_MESSAGE_GUID" }, \
-  { &my_gDellTerminalGuid, L"DELL_TERMINAL_GUID" }, \
-  { &my_gDellSmBiosStrucD0Guid, L"DELL_SM_BIOS_STRUC_D0_GUID" }, \
-  { &my_gDellSmmRuntimeGuid, L"DELL_SMM_RUNTIME_GUID" }, \
-  { &my_gDellFlashIoSmmGuid, L"DELL_FLASH_IO_SMM_GUID" }, \
-  { &my_gDellSystemPwSmmGuid, L"DELL_SYSTEM_PW_SMM_GUID" }, \
-  { &my_gDellPciRootBridgeGuid, L"DELL_PCI_ROOT_BRIDGE_GUID" }, \
-  { &my_gDellPowerOffConfigGuid, L"DELL_POWER_OFF_CONFIG_GUID" }, \
-  { &my_gDellDxeHwmDriverGuid, L"DELL_DXE_HWM_DRIVER_GUID" }, \
-  { &my_gDellPxeUndiRomGuid, L"DELL_PXE_UNDI_ROM_GUID" }, \
-  { &my_gDellPwByPassSmmGuid, L"DELL_PW_BY_PASS_SMM_GUID" }, \
-  { &my_gDellHotKeyHandlerSmmGuid, L"DELL_HOT_KEY_HANDLER_SMM_GUID" }, \
-  { &my_gDellPowerManagementDxeGuid, L"DELL_POWER_MANAGEMENT_DXE_GUID" }, \
-  { &my_gDellAcRecoverySmmGuid, L"DELL_AC_RECOVERY_SMM_GUID" }, \
-  { &my_gDellSmmSioDashGuid, L"DELL_SMM_SIO_DASH_GUID" }, \
-  { &my_gDellSmmEventDxeGuid, L"DELL_SMM_EVENT_DXE_GUID" }, \
-  { &my_gDellSetupPrepGuid, L"DELL_SETUP_PREP_GUID" }, \
-  { &my_gDellDxePrereqGuid, L"DELL_DXE_PREREQ_GUID" }, \
-  { &my_gDellSpiPartStMicroGuid, L"DELL_SPI_PART_ST_MICRO_GUID" }, \
-  { &my_gDellDiagsLegacyGuid, L"DELL_DIAGS_LEGACY_GUID" }, \
-  { &my_gDellAcpiPlatformGuid, L"DELL_ACPI_PLATFORM_GUID" }, \
-  { &my_gDellPowerManagementGuid, L"DELL_POWER_MANAGEMENT_GUID" }, \
-  { &my_gDellAhciSmmGuid, L"DELL_AHCI_SMM_GUID" }, \
-  { &my_gDellMePlatformConfigDxeGuid, L"DELL_ME_PLATFORM_CONFIG_DXE_GUID" }, \
-  { &my_gDellPciHostBridgeGuid, L"DELL_PCI_HOST_BRIDGE_GUID" }, \
-  { &my_gDellSmmServicesGuid, L"DELL_SMM_SERVICES_GUID" }, \
-  { &my_gDellModBayConfigGuid, L"DELL_MOD_BAY_CONFIG_GUID" }, \
-  { &my_gDellServiceResetSmmGuid, L"DELL_SERVICE_RESET_SMM_GUID" }, \
-  { &my_gDellEcConfigDxeGuid, L"DELL_EC_CONFIG_DXE_GUID" }, \
-  { &my_gDellErrorHandlerDxeGuid, L"DELL_ERROR_HANDLER_DXE_GUID" }, \
-  { &my_gDellDefaultBootListDxeGuid, L"DELL_DEFAULT_BOOT_LIST_DXE_GUID" }, \
-  { &my_gDellAhcisrcGuid, L"DELL_AHCISRC_GUID" }, \
-  { &my_gDellSbAccessSmmGuid, L"DELL_SB_ACCESS_SMM_GUID" }, \
-  { &my_gDellImgSrvBaseRomGuid, L"DELL_IMG_SRV_BASE_ROM_GUID" }, \
-  { &my_gDellSmartTimerGuid, L"DELL_SMART_TIMER_GUID" }, \
-  { &my_gDellPbaFpDxeGuid, L"DELL_PBA_FP_DXE_GUID" }, \
-  { &my_gDellHeciSmmGuid, L"DELL_HECI_SMM_GUID" }, \
-  { &my_gDellSmmComputraceGuid, L"DELL_SMM_COMPUTRACE_GUID" }, \
-  { &my_gDellFileSystemGuid, L"DELL_FILE_SYSTEM_GUID" }, \
-  { &my_gDellDirtyShutdownDxeGuid, L"DELL_DIRTY_SHUTDOWN_DXE_GUID" }, \
-  { &my_gDellSbAcpiConfigGuid, L"DELL_SB_ACPI_CONFIG_GUID" }, \
-  { &my_gDellTcgSetupGuid, L"DELL_TCG_SETUP_GUID" }, \
-  { &my_gDellServiceResetDxeGuid, L"DELL_SERVICE_RESET_DXE_GUID" }, \
-  { &my_gDellBiosExtensionLoaderGuid, L"DELL_BIOS_EXTENSION_LOADER_GUID" }, \
-  { &my_gDellHotSosDxeDriverGuid, L"DELL_HOT_SOS_DXE_DRIVER_GUID" }, \
-  { &my_gDellSmBiosStrucDeGuid, L"DELL_SM_BIOS_STRUC_DE_GUID" }, \
-  { &my_gDellSbSmmHooksGuid, L"DELL_SB_SMM_HOOKS_GUID" }, \
-  { &my_gDellBbsmanagerDxeGuid, L"DELL_BBSMANAGER_DXE_GUID" }, \
-  { &my_gDellGsetConfigGuid, L"DELL_GSET_CONFIG_GUID" }, \
-  { &my_gDellMultiDisplayDxeGuid, L"DELL_MULTI_DISPLAY_DXE_GUID" }, \
-  { &my_gDellAmiBoardInfoGuid, L"DELL_AMI_BOARD_INFO_GUID" }, \
-  { &my_gDellDaNonVolitileStorageGuid, L"DELL_DA_NON_VOLITILE_STORAGE_GUID" }, \
-  { &my_gDellDxeMainGuid, L"DELL_DXE_MAIN_GUID" }, \
-  { &my_gDellSioPolicyConfigDxeGuid, L"DELL_SIO_POLICY_CONFIG_DXE_GUID" }, \
-  { &my_gDellCsmcoreGuid, L"DELL_CSMCORE_GUID" }, \
-  { &my_gDellHddPwSmmGuid, L"DELL_HDD_PW_SMM_GUID" }, \
-  { &my_gDellSmmControlGuid, L"DELL_SMM_CONTROL_GUID" }, \
-  { &my_gDellPciExpressDxeGuid, L"DELL_PCI_EXPRESS_DXE_GUID" }, \
-  { &my_gDellSpiPartSstGuid, L"DELL_SPI_PART_SST_GUID" }, \
-  { &my_gDellSpiControllerDxeGuid, L"DELL_SPI_CONTROLLER_DXE_GUID" }, \
-  { &my_gDellSmbFactDefaultGuid, L"DELL_SMB_FACT_DEFAULT_GUID" }, \
-  { &my_gDellSmmSioGpioControlGuid, L"DELL_SMM_SIO_GPIO_CONTROL_GUID" }, \
-  { &my_gDellImageServerSmmGuid, L"DELL_IMAGE_SERVER_SMM_GUID" }, \
-  { &my_gDellPbaMgrDxeGuid, L"DELL_PBA_MGR_DXE_GUID" }, \
-  { &my_gDellImageServerDxeGuid, L"DELL_IMAGE_SERVER_DXE_GUID" }, \
-  { &my_gDellLomConfigGuid, L"DELL_LOM_CONFIG_GUID" }, \
-  { &my_gDellLegacyUsbSmmGuid, L"DELL_LEGACY_USB_SMM_GUID" }, \
-  { &my_gDellAmtSmbiosGuid, L"DELL_AMT_SMBIOS_GUID" }, \
-  { &my_gDellTcgMorGuid, L"DELL_TCG_MOR_GUID" }, \
-  { &my_gDellDoSiodiagLedDxeGuid, L"DELL_DO_SIODIAG_LED_DXE_GUID" }, \
-  { &my_gDellAudioDxeGuid, L"DELL_AUDIO_DXE_GUID" }, \
-  { &my_gDellFvMainnestedGuid, L"DELL_FV_MAINNESTED_GUID" }, \
-  { &my_gDellSmmCryptoAlgorithmGuid, L"DELL_SMM_CRYPTO_ALGORITHM_GUID" }, \
-  { &my_gDellPchSmiDispatcherGuid, L"DELL_PCH_SMI_DISPATCHER_GUID" }, \
-  { &my_gDellSmbios64Guid, L"DELL_SMBIOS64_GUID" }, \
-  { &my_gDellAmitseGuid, L"DELL_AMITSE_GUID" }, \
-  { &my_gDellDxeDelayGuid, L"DELL_DXE_DELAY_GUID" }, \
-  { &my_gDellLegUsbMemInfoDxeGuid, L"DELL_LEG_USB_MEM_INFO_DXE_GUID" }, \
-  { &my_gDellSecurityConfigGuid, L"DELL_SECURITY_CONFIG_GUID" }, \
-  { &my_gDellSmbVersionManifestGuid, L"DELL_SMB_VERSION_MANIFEST_GUID" }, \
-  { &my_gDellSmbiosupdateDataGuid, L"DELL_SMBIOSUPDATE_DATA_GUID" }, \
-  { &my_gDellPchResetGuid, L"DELL_PCH_RESET_GUID" }, \
-  { &my_gDellSataControllerGuid, L"DELL_SATA_CONTROLLER_GUID" }, \
-  { &my_gDellAlertStandardFormatSmmGuid, L"DELL_ALERT_STANDARD_FORMAT_SMM_GUID" }, \
-  { &my_gDellDaTaaMacGuid, L"DELL_DA_TAA_MAC_GUID" }, \
-  { &my_gDellHotKeyHandlerDxeGuid, L"DELL_HOT_KEY_HANDLER_DXE_GUID" }, \
-  { &my_gDellCmosManagerDxeSrcGuid, L"DELL_CMOS_MANAGER_DXE_SRC_GUID" }, \
-  { &my_gDellDxeGpioControlGuid, L"DELL_DXE_GPIO_CONTROL_GUID" }, \
-  { &my_gDellDtLegUsbPolicyGuid, L"DELL_DT_LEG_USB_POLICY_GUID" }, \
-  { &my_gDellPxeBaseRomGuid, L"DELL_PXE_BASE_ROM_GUID" }, \
-  { &my_gDellSmiVariableGuid, L"DELL_SMI_VARIABLE_GUID" }, \
-  { &my_gDellPowerButtonDxeGuid, L"DELL_POWER_BUTTON_DXE_GUID" }, \
-  { &my_gDellActiveBiosGuid, L"DELL_ACTIVE_BIOS_GUID" }, \
-  { &my_gDellD010AlegacyVideoRomGuid, L"DELL_D010_ALEGACY_VIDEO_ROM_GUID" }, \
-  { &my_gDellSmmDiagLedsGuid, L"DELL_SMM_DIAG_LEDS_GUID" }, \
-  { &my_gDellFlashWriteProtectGuid, L"DELL_FLASH_WRITE_PROTECT_GUID" }, \
-  { &my_gDellLegacyInterruptGuid, L"DELL_LEGACY_INTERRUPT_GUID" }, \
-  { &my_gDellSaveMemoryConfigDxeGuid, L"DELL_SAVE_MEMORY_CONFIG_DXE_GUID" }, \
-  { &my_gDellSpiPartWinbondGuid, L"DELL_SPI_PART_WINBOND_GUID" }, \
-  { &my_gDellDaAssetTagGuid, L"DELL_DA_ASSET_TAG_GUID" }, \
-  { &my_gDellIdeRcontrollerGuid, L"DELL_IDE_RCONTROLLER_GUID" }, \
-  { &my_gDellPbaUshGuid, L"DELL_PBA_USH_GUID" }, \
-  { &my_gDellLegacyTcgSupportGuid, L"DELL_LEGACY_TCG_SUPPORT_GUID" }, \
-  { &my_gDellSmbStrucB2ConfigGuid, L"DELL_SMB_STRUC_B2_CONFIG_GUID" }, \
-  { &my_gDellTdtAmGuid, L"DELL_TDT_AM_GUID" }, \
-  { &my_gDellHotKeysConfigGuid, L"DELL_HOT_KEYS_CONFIG_GUID" }, \
-  { &my_gDellSmmEventSmmGuid, L"DELL_SMM_EVENT_SMM_GUID" }, \
-  { &my_gDellDashConfigGuid, L"DELL_DASH_CONFIG_GUID" }, \
-  { &my_gDellSmmMultiPlatformGuid, L"DELL_SMM_MULTI_PLATFORM_GUID" }, \
-  { &my_gDellRuntimeGuid, L"DELL_RUNTIME_GUID" }, \
-  { &my_gDellSmBiosStrucD2Guid, L"DELL_SM_BIOS_STRUC_D2_GUID" }, \
-  { &my_gDellCspLibDxeGuid, L"DELL_CSP_LIB_DXE_GUID" }, \
-  { &my_gDellTcgSmmGuid, L"DELL_TCG_SMM_GUID" }, \
-  { &my_gDellSmbiosBoardGuid, L"DELL_SMBIOS_BOARD_GUID" }, \
-  { &my_gDellSmmBaseGuid, L"DELL_SMM_BASE_GUID" }, \
-  { &my_gDellSlpMarkerCtrlGuid, L"DELL_SLP_MARKER_CTRL_GUID" }, \
-  { &my_gDellThrottlingDriverGuid, L"DELL_THROTTLING_DRIVER_GUID" }, \
-  { &my_gDellTerminalPlatformPolicyGuid, L"DELL_TERMINAL_PLATFORM_POLICY_GUID" }, \
-  { &my_gDellDiagsSmmGuid, L"DELL_DIAGS_SMM_GUID" }, \
-  { &my_gDellHddSmartSmmGuid, L"DELL_HDD_SMART_SMM_GUID" }, \
-  { &my_gDellPchPolicyInitDxeGuid, L"DELL_PCH_POLICY_INIT_DXE_GUID" }, \
-  { &my_gDellNbConfigDxeGuid, L"DELL_NB_CONFIG_DXE_GUID" }, \
-  { &my_gDellIAmtdxeGuid, L"DELL_I_AMTDXE_GUID" }, \
-  { &my_gDellAmtWrapperDxeGuid, L"DELL_AMT_WRAPPER_DXE_GUID" }, \
-  { &my_gDellPhysicalPresenceGuid, L"DELL_PHYSICAL_PRESENCE_GUID" }, \
-  { &my_gDellSmmGpioControlGuid, L"DELL_SMM_GPIO_CONTROL_GUID" }, \
-  { &my_gDellSmBiosStrucD9Guid, L"DELL_SM_BIOS_STRUC_D9_GUID" }, \
-  { &my_gDellStorageAgentsSmmGuid, L"DELL_STORAGE_AGENTS_SMM_GUID" }, \
-  { &my_gDellSmbBbsInfoGuid, L"DELL_SMB_BBS_INFO_GUID" }, \
-  { &my_gDellSmBiosStrucB2Guid, L"DELL_SM_BIOS_STRUC_B2_GUID" }, \
-  { &my_gDellTdtDxeGuid, L"DELL_TDT_DXE_GUID" }, \
-  { &my_gDellSaInitDxeGuid, L"DELL_SA_INIT_DXE_GUID" }, \
-  { &my_gDellPchInitDxeGuid, L"DELL_PCH_INIT_DXE_GUID" }, \
-  { &my_gDellSmbiosGetFlashData64Guid, L"DELL_SMBIOS_GET_FLASH_DATA64_GUID" }, \
-  { &my_gDellIdeDxeGuid, L"DELL_IDE_DXE_GUID" }, \
-  { &my_gDellMfgModeDxeDriverGuid, L"DELL_MFG_MODE_DXE_DRIVER_GUID" }, \
-  { &my_gDellDaOwnerTagGuid, L"DELL_DA_OWNER_TAG_GUID" }, \
-  { &my_gDellDaBfaGuid, L"DELL_DA_BFA_GUID" }, \
-  { &my_gDellCpuDxeGuid, L"DELL_CPU_DXE_GUID" }, \
-  { &my_gDellPchSmbusDxeGuid, L"DELL_PCH_SMBUS_DXE_GUID" }, \
-  { &my_gDellDaPasswordsGuid, L"DELL_DA_PASSWORDS_GUID" }, \
-  { &my_gDellSlpConfigGuid, L"DELL_SLP_CONFIG_GUID" }, \
-  { &my_gDellDxeSbGpioControlGuid, L"DELL_DXE_SB_GPIO_CONTROL_GUID" }, \
-  { &my_gDellSmbDaTokensConfigGuid, L"DELL_SMB_DA_TOKENS_CONFIG_GUID" }, \
-  { &my_gDellOemBadgingSupportGuid, L"DELL_OEM_BADGING_SUPPORT_GUID" }, \
-  { &my_gDellSmmCircBuffGuid, L"DELL_SMM_CIRC_BUFF_GUID" }, \
-  { &my_gDellPowerButtonGuid, L"DELL_POWER_BUTTON_GUID" }, \
-  { &my_gDellAsfTableGuid, L"DELL_ASF_TABLE_GUID" }, \
-  { &my_gDellRuntimeAcpiSmmGuid, L"DELL_RUNTIME_ACPI_SMM_GUID" }, \
-  { &my_gDellTagsConfigGuid, L"DELL_TAGS_CONFIG_GUID" }, \
-  { &my_gDellSmBiosStrucFanGuid, L"DELL_SM_BIOS_STRUC_FAN_GUID" }, \
-  { &my_gDellSmmAsfInitGuid, L"DELL_SMM_ASF_INIT_GUID" }, \
-  { &my_gDellSmBiosStrucD8Guid, L"DELL_SM_BIOS_STRUC_D8_GUID" }, \
-  { &my_gDellSmBiosMemoryGuid, L"DELL_SM_BIOS_MEMORY_GUID" }, \
-  { &my_gDellS3ResumeGuid, L"DELL_S3_RESUME_GUID" }, \
-  { &my_gDellDxeDiagLedsGuid, L"DELL_DXE_DIAG_LEDS_GUID" }, \
-  { &my_gDellWarmBootSmmGuid, L"DELL_WARM_BOOT_SMM_GUID" }, \
-  { &my_gDellBootScriptSmiHandlerGuid, L"DELL_BOOT_SCRIPT_SMI_HANDLER_GUID" }, \
-  { &my_gDellTpmSmmGuid, L"DELL_TPM_SMM_GUID" }, \
-  { &my_gDellDxeSioEmiGuid, L"DELL_DXE_SIO_EMI_GUID" }, \
-  { &my_gDellGt2LegacyVideoRomGuid, L"DELL_GT2_LEGACY_VIDEO_ROM_GUID" }, \
-  { &my_gDellSmBiosStrucThermGuid, L"DELL_SM_BIOS_STRUC_THERM_GUID" }, \
-  { &my_gDellVideoConfigDxeGuid, L"DELL_VIDEO_CONFIG_DXE_GUID" }, \
-  { &my_gDellSmbRunRomGuid, L"DELL_SMB_RUN_ROM_GUID" }, \
-  { &my_gDellBbsmanagerSmmGuid, L"DELL_BBSMANAGER_SMM_GUID" }, \
-  { &my_gDellPhysicalPresenceSmmGuid, L"DELL_PHYSICAL_PRESENCE_SMM_GUID" }, \
-  { &my_gDellMeLocalFwUpdateDxeGuid, L"DELL_ME_LOCAL_FW_UPDATE_DXE_GUID" }, \
-  { &my_gDellPciSerialGuid, L"DELL_PCI_SERIAL_GUID" }, \
-  { &my_gDellPchSerialGpioGuid, L"DELL_PCH_SERIAL_GPIO_GUID" }, \
-  { &my_gDellSmiCpuDecodeGuid, L"DELL_SMI_CPU_DECODE_GUID" }, \
-  { &my_gDellSmmS3Guid, L"DELL_SMM_S3_GUID" }, \
-  { &my_gDellCpuPeiBeforeMemGuid, L"DELL_CPU_PEI_BEFORE_MEM_GUID" }, \
-  { &my_gDellWdtPeiGuid, L"DELL_WDT_PEI_GUID" }, \
-  { &my_gDellPeiHwmInitGuid, L"DELL_PEI_HWM_INIT_GUID" }, \
-  { &my_gDellCpuPeiGuid, L"DELL_CPU_PEI_GUID" }, \
-  { &my_gDellAudioConfigPeiGuid, L"DELL_AUDIO_CONFIG_PEI_GUID" }, \
-  { &my_gDellTcgPeiGuid, L"DELL_TCG_PEI_GUID" }, \
-  { &my_gDellMemoryInitGuid, L"DELL_MEMORY_INIT_GUID" }, \
-  { &my_gDellAlertStandardFormatPeiGuid, L"DELL_ALERT_STANDARD_FORMAT_PEI_GUID" }, \
-  { &my_gDellAmtConfigPeiGuid, L"DELL_AMT_CONFIG_PEI_GUID" }, \
-  { &my_gDellOpPresenceGuid, L"DELL_OP_PRESENCE_GUID" }, \
-  { &my_gDellStartWatchDogGuid, L"DELL_START_WATCH_DOG_GUID" }, \
-  { &my_gDellErrorHandlerPeiGuid, L"DELL_ERROR_HANDLER_PEI_GUID" }, \
-  { &my_gDellPchSmbusArpDisabledGuid, L"DELL_PCH_SMBUS_ARP_DISABLED_GUID" }, \
-  { &my_gDellPchUsbGuid, L"DELL_PCH_USB_GUID" }, \
-  { &my_gDellTcgPei2Guid, L"DELL_TCG_PEI2_GUID" }, \
-  { &my_gDellSbPowerOffPeiGuid, L"DELL_SB_POWER_OFF_PEI_GUID" }, \
-  { &my_gDellCmosManagerPeiSrcGuid, L"DELL_CMOS_MANAGER_PEI_SRC_GUID" }, \
-  { &my_gDellMfgModePeiDriverGuid, L"DELL_MFG_MODE_PEI_DRIVER_GUID" }, \
-  { &my_gDellCorePeiGuid, L"DELL_CORE_PEI_GUID" }, \
-  { &my_gDellHeciPeiGuid, L"DELL_HECI_PEI_GUID" }, \
-  { &my_gDellAudioPeiGuid, L"DELL_AUDIO_PEI_GUID" }, \
-  { &my_gDellFlashUpdatePeiGuid, L"DELL_FLASH_UPDATE_PEI_GUID" }, \
-  { &my_gDellWarmBootPeiGuid, L"DELL_WARM_BOOT_PEI_GUID" }, \
-  { &my_gDellPeiMainGuid, L"DELL_PEI_MAIN_GUID" }, \
-  { &my_gDellDoSiodiagLedPeiGuid, L"DELL_DO_SIODIAG_LED_PEI_GUID" }, \
-  { &my_gDellPchMeUmaGuid, L"DELL_PCH_ME_UMA_GUID" }, \
-  { &my_gDellPeiDiagLedsGuid, L"DELL_PEI_DIAG_LEDS_GUID" }, \
-  { &my_gDellTxtPeiGuid, L"DELL_TXT_PEI_GUID" }, \
-  { &my_gDellTxtConfigPeiGuid, L"DELL_TXT_CONFIG_PEI_GUID" }, \
-  { &my_gDellPeiSioEmiGuid, L"DELL_PEI_SIO_EMI_GUID" }, \
-  { &my_gDellSystemIdConfigPeiGuid, L"DELL_SYSTEM_ID_CONFIG_PEI_GUID" }, \
-  { &my_gDellNbConfigPeiGuid, L"DELL_NB_CONFIG_PEI_GUID" }, \
-  { &my_gDellDirtyShutdownPeiGuid, L"DELL_DIRTY_SHUTDOWN_PEI_GUID" }, \
-  { &my_gDellSioPolicyConfigPeiGuid, L"DELL_SIO_POLICY_CONFIG_PEI_GUID" }, \
-  { &my_gDellAclossPeiGuid, L"DELL_ACLOSS_PEI_GUID" }, \
-  { &my_gDellSbConfigPeiGuid, L"DELL_SB_CONFIG_PEI_GUID" }, \
-  { &my_gDellVideoConfigPeiGuid, L"DELL_VIDEO_CONFIG_PEI_GUID" }, \
-  { &my_gDellEcConfigPeiGuid, L"DELL_EC_CONFIG_PEI_GUID" }, \
-  { &my_gDellSaInitPeimGuid, L"DELL_SA_INIT_PEIM_GUID" }, \
-  { &my_gDellPchInitPeimGuid, L"DELL_PCH_INIT_PEIM_GUID" }, \
-  { &my_gLenovoSystemUsbSwitchDxeGuid, L"LENOVO_SYSTEM_USB_SWITCH_DXE_GUID" }, \
-  { &my_gLenovoSystemScsiBusDxeGuid, L"LENOVO_SYSTEM_SCSI_BUS_DXE_GUID" }, \
-  { &my_gLenovoSystemAhciBusDxeGuid, L"LENOVO_SYSTEM_AHCI_BUS_DXE_GUID" }, \
-  { &my_gLenovoMnpDxeBinGuid, L"LENOVO_MNP_DXE_BIN_GUID" }, \
-  { &my_gLenovoIsscSmmGuid, L"LENOVO_ISSC_SMM_GUID" }, \
-  { &my_gLenovoEcIoSmmGuid, L"LENOVO_EC_IO_SMM_GUID" }, \
-  { &my_gLenovoEn25Qh32FlashPartDxeGuid, L"LENOVO_EN25_QH32_FLASH_PART_DXE_GUID" }, \
-  { &my_gLenovoMtmFormatSmmGuid, L"LENOVO_MTM_FORMAT_SMM_GUID" }, \
-  { &my_gLenovoDxeRicohInitGuid, L"LENOVO_DXE_RICOH_INIT_GUID" }, \
-  { &my_gLenovoSecurityVariableDxeGuid, L"LENOVO_SECURITY_VARIABLE_DXE_GUID" }, \
-  { &my_gLenovoIbexPeakFlashControllerDxeGuid, L"LENOVO_IBEX_PEAK_FLASH_CONTROLLER_DXE_GUID" }, \
-  { &my_gLenovoBoardInfoSmmGuid, L"LENOVO_BOARD_INFO_SMM_GUID" }, \
-  { &my_gLenovoSystemMetronomeDxeGuid, L"LENOVO_SYSTEM_METRONOME_DXE_GUID" }, \
-  { &my_gLenovoSlp2DxeGuid, L"LENOVO_SLP2_DXE_GUID" }, \
-  { &my_gLenovoCryptServiceSmmGuid, L"LENOVO_CRYPT_SERVICE_SMM_GUID" }, \
-  { &my_gLenovoSystemScsiDiskDxeGuid, L"LENOVO_SYSTEM_SCSI_DISK_DXE_GUID" }, \
-  { &my_gLenovoSystemUsbSwitchSmmGuid, L"LENOVO_SYSTEM_USB_SWITCH_SMM_GUID" }, \
-  { &my_gLenovoEcFwUpdateDxeGuid, L"LENOVO_EC_FW_UPDATE_DXE_GUID" }, \
-  { &my_gLenovoSetupUnderOsDxeGuid, L"LENOVO_SETUP_UNDER_OS_DXE_GUID" }, \
-  { &my_gLenovoBdsCtrlGuid, L"LENOVO_BDS_CTRL_GUID" }, \
-  { &my_gLenovoSystemFirmwareDeviceDxeGuid, L"LENOVO_SYSTEM_FIRMWARE_DEVICE_DXE_GUID" }, \
-  { &my_gLenovoEcIoDxeGuid, L"LENOVO_EC_IO_DXE_GUID" }, \
-  { &my_gLenovoSystemSmmAhciAspiLegacyRtGuid, L"LENOVO_SYSTEM_SMM_AHCI_ASPI_LEGACY_RT_GUID" }, \
-  { &my_gLenovoBootMenuDxeGuid, L"LENOVO_BOOT_MENU_DXE_GUID" }, \
-  { &my_gLenovoFpPbaGuid, L"LENOVO_FP_PBA_GUID" }, \
-  { &my_gLenovoSystemEbcDxeGuid, L"LENOVO_SYSTEM_EBC_DXE_GUID" }, \
-  { &my_gLenovoSystemSmmServicesSmmGuid, L"LENOVO_SYSTEM_SMM_SERVICES_SMM_GUID" }, \
-  { &my_gLenovoEcServiceGuid, L"LENOVO_EC_SERVICE_GUID" }, \
-  { &my_gLenovoSecureFlashVerifySmmGuid, L"LENOVO_SECURE_FLASH_VERIFY_SMM_GUID" }, \
-  { &my_gLenovoEn25Qh128FlashPartSmmGuid, L"LENOVO_EN25_QH128_FLASH_PART_SMM_GUID" }, \
-  { &my_gLenovoComputraceSmiServicesGuid, L"LENOVO_COMPUTRACE_SMI_SERVICES_GUID" }, \
-  { &my_gLenovoSmmVideoInt10Guid, L"LENOVO_SMM_VIDEO_INT10_GUID" }, \
-  { &my_gLenovoTcpDxeBinGuid, L"LENOVO_TCP_DXE_BIN_GUID" }, \
-  { &my_gLenovoSystemBootScriptSaveDxeGuid, L"LENOVO_SYSTEM_BOOT_SCRIPT_SAVE_DXE_GUID" }, \
-  { &my_gLenovoEaiaDxeGuid, L"LENOVO_EAIA_DXE_GUID" }, \
-  { &my_gLenovoSystemPs2MouseDxeGuid, L"LENOVO_SYSTEM_PS2_MOUSE_DXE_GUID" }, \
-  { &my_gLenovoSmartCardDetectDxeGuid, L"LENOVO_SMART_CARD_DETECT_DXE_GUID" }, \
-  { &my_gLenovoPlatformFlashDxeGuid, L"LENOVO_PLATFORM_FLASH_DXE_GUID" }, \
-  { &my_gLenovoMx25L3206EflashPartSmmGuid, L"LENOVO_MX25_L3206_EFLASH_PART_SMM_GUID" }, \
-  { &my_gLenovoTpmEnablerDxeGuid, L"LENOVO_TPM_ENABLER_DXE_GUID" }, \
-  { &my_gLenovoSystemUsbSupportPolicySmmGuid, L"LENOVO_SYSTEM_USB_SUPPORT_POLICY_SMM_GUID" }, \
-  { &my_gLenovoSystemUsbBusDxeGuid, L"LENOVO_SYSTEM_USB_BUS_DXE_GUID" }, \
-  { &my_gLenovoSystemUsbSupportPolicyDxeGuid, L"LENOVO_SYSTEM_USB_SUPPORT_POLICY_DXE_GUID" }, \
-  { &my_gLenovoSmmOemint15Guid, L"LENOVO_SMM_OEMINT15_GUID" }, \
-  { &my_gLenovoSystemStatusCodeGenericRtGuid, L"LENOVO_SYSTEM_STATUS_CODE_GENERIC_RT_GUID" }, \
-  { &my_gLenovoCryptServiceGuid, L"LENOVO_CRYPT_SERVICE_GUID" }, \
-  { &my_gLenovoTcgServicesDxeGuid, L"LENOVO_TCG_SERVICES_DXE_GUID" }, \
-  { &my_gLenovoFdiskOemGuid, L"LENOVO_FDISK_OEM_GUID" }, \
-  { &my_gLenovoPchSpiSmmGuid, L"LENOVO_PCH_SPI_SMM_GUID" }, \
-  { &my_gLenovoIvbGopDriverGuid, L"LENOVO_IVB_GOP_DRIVER_GUID" }, \
-  { &my_gLenovoSystemStatusCodePort80RtGuid, L"LENOVO_SYSTEM_STATUS_CODE_PORT80_RT_GUID" }, \
-  { &my_gLenovoW25Q64FlashPartDxeGuid, L"LENOVO_W25_Q64_FLASH_PART_DXE_GUID" }, \
-  { &my_gLenovoSystemUsbMemoryManagerSmmGuid, L"LENOVO_SYSTEM_USB_MEMORY_MANAGER_SMM_GUID" }, \
-  { &my_gLenovoSystemAcpiS3SaveDxeGuid, L"LENOVO_SYSTEM_ACPI_S3_SAVE_DXE_GUID" }, \
-  { &my_gLenovoSaLateInitSmmGuid, L"LENOVO_SA_LATE_INIT_SMM_GUID" }, \
-  { &my_gLenovoSystemUsbMouseDxeGuid, L"LENOVO_SYSTEM_USB_MOUSE_DXE_GUID" }, \
-  { &my_gLenovoSystemUsbKbDxeGuid, L"LENOVO_SYSTEM_USB_KB_DXE_GUID" }, \
-  { &my_gLenovoPlatformDxeGuid, L"LENOVO_PLATFORM_DXE_GUID" }, \
-  { &my_gLenovoPchBiosWriteProtectGuid, L"LENOVO_PCH_BIOS_WRITE_PROTECT_GUID" }, \
-  { &my_gLenovoTpAcpiNvsInitDxeGuid, L"LENOVO_TP_ACPI_NVS_INIT_DXE_GUID" }, \
-  { &my_gLenovoSnbGopDriverGuid, L"LENOVO_SNB_GOP_DRIVER_GUID" }, \
-  { &my_gLenovoSystemUsbDatabaseSmmGuid, L"LENOVO_SYSTEM_USB_DATABASE_SMM_GUID" }, \
-  { &my_gLenovoSystemFormBrowserCoreDxeGuid, L"LENOVO_SYSTEM_FORM_BROWSER_CORE_DXE_GUID" }, \
-  { &my_gLenovoBiosExtensionLoaderGuid, L"LENOVO_BIOS_EXTENSION_LOADER_GUID" }, \
-  { &my_gLenovoSystemHiiDatabaseDxeGuid, L"LENOVO_SYSTEM_HII_DATABASE_DXE_GUID" }, \
-  { &my_gLenovoAtpDxeGuid, L"LENOVO_ATP_DXE_GUID" }, \
-  { &my_gLenovoDxeMainGuid, L"LENOVO_DXE_MAIN_GUID" }, \
-  { &my_gLenovoSystemSplashDxeGuid, L"LENOVO_SYSTEM_SPLASH_DXE_GUID" }, \
-  { &my_gLenovoSystemImageDisplayDxeGuid, L"LENOVO_SYSTEM_IMAGE_DISPLAY_DXE_GUID" }, \
-  { &my_gLenovoSystemRtcRtGuid, L"LENOVO_SYSTEM_RTC_RT_GUID" }, \
-  { &my_gLenovoSystemIdeAtaAtapiPassThruDxeGuid, L"LENOVO_SYSTEM_IDE_ATA_ATAPI_PASS_THRU_DXE_GUID" }, \
-  { &my_gLenovoSetupMainDxeGuid, L"LENOVO_SETUP_MAIN_DXE_GUID" }, \
-  { &my_gLenovoMePciUpdateGuid, L"LENOVO_ME_PCI_UPDATE_GUID" }, \
-  { &my_gLenovoPhxGopDxeGuid, L"LENOVO_PHX_GOP_DXE_GUID" }, \
-  { &my_gLenovoMx25L64XflashPartDxeGuid, L"LENOVO_MX25_L64_XFLASH_PART_DXE_GUID" }, \
-  { &my_gLenovoAoacSmmGuid, L"LENOVO_AOAC_SMM_GUID" }, \
-  { &my_gLenovoSystemHiiImageDisplayDxeGuid, L"LENOVO_SYSTEM_HII_IMAGE_DISPLAY_DXE_GUID" }, \
-  { &my_gLenovoSystemPs2KeyboardDxeGuid, L"LENOVO_SYSTEM_PS2_KEYBOARD_DXE_GUID" }, \
-  { &my_gLenovoRebootCpGuid, L"LENOVO_REBOOT_CP_GUID" }, \
-  { &my_gLenovoSystemCryptSvcRtGuid, L"LENOVO_SYSTEM_CRYPT_SVC_RT_GUID" }, \
-  { &my_gLenovoPlatformPciDxeGuid, L"LENOVO_PLATFORM_PCI_DXE_GUID" }, \
-  { &my_gLenovoFitDiagnosticsLoaderGuid, L"LENOVO_FIT_DIAGNOSTICS_LOADER_GUID" }, \
-  { &my_gLenovoIbexPeakGlobalSmiControlGuid, L"LENOVO_IBEX_PEAK_GLOBAL_SMI_CONTROL_GUID" }, \
-  { &my_gLenovoVproIderAsfBootGuid, L"LENOVO_VPRO_IDER_ASF_BOOT_GUID" }, \
-  { &my_gLenovoSystemConSplitterDxeGuid, L"LENOVO_SYSTEM_CON_SPLITTER_DXE_GUID" }, \
-  { &my_gLenovoIFfsSmmGuid, L"LENOVO_I_FFS_SMM_GUID" }, \
-  { &my_gLenovoSystemPartitionDxeGuid, L"LENOVO_SYSTEM_PARTITION_DXE_GUID" }, \
-  { &my_gLenovoMailBoxDxeGuid, L"LENOVO_MAIL_BOX_DXE_GUID" }, \
-  { &my_gLenovoVariableInitSmmGuid, L"LENOVO_VARIABLE_INIT_SMM_GUID" }, \
-  { &my_gLenovoSystemAhciAtaAtapiPassThruDxeGuid, L"LENOVO_SYSTEM_AHCI_ATA_ATAPI_PASS_THRU_DXE_GUID" }, \
-  { &my_gLenovoComputraceLoaderDxeGuid, L"LENOVO_COMPUTRACE_LOADER_DXE_GUID" }, \
-  { &my_gLenovoSystemCmosSmmGuid, L"LENOVO_SYSTEM_CMOS_SMM_GUID" }, \
-  { &my_gLenovoMiscGaIoDxeGuid, L"LENOVO_MISC_GA_IO_DXE_GUID" }, \
-  { &my_gLenovoAt24Rf08EepromSmmGuid, L"LENOVO_AT24_RF08_EEPROM_SMM_GUID" }, \
-  { &my_gLenovoSecuritySmiDispatchGuid, L"LENOVO_SECURITY_SMI_DISPATCH_GUID" }, \
-  { &my_gLenovoSystemPpisNeededByDxeCoreGuid, L"LENOVO_SYSTEM_PPIS_NEEDED_BY_DXE_CORE_GUID" }, \
-  { &my_gLenovoSystemErrorLogSmmGuid, L"LENOVO_SYSTEM_ERROR_LOG_SMM_GUID" }, \
-  { &my_gLenovoVproHiiDxeGuid, L"LENOVO_VPRO_HII_DXE_GUID" }, \
-  { &my_gLenovoComputraceEnablerDxeGuid, L"LENOVO_COMPUTRACE_ENABLER_DXE_GUID" }, \
-  { &my_gLenovoEn25Qh64FlashPartSmmGuid, L"LENOVO_EN25_QH64_FLASH_PART_SMM_GUID" }, \
-  { &my_gLenovoPchEmulateKbcGuid, L"LENOVO_PCH_EMULATE_KBC_GUID" }, \
-  { &my_gLenovoSystemSmbiosEventLogDxeGuid, L"LENOVO_SYSTEM_SMBIOS_EVENT_LOG_DXE_GUID" }, \
-  { &my_gLenovoHpmSmmGuid, L"LENOVO_HPM_SMM_GUID" }, \
-  { &my_gLenovoSystemCrc32SectionExtractDxeGuid, L"LENOVO_SYSTEM_CRC32_SECTION_EXTRACT_DXE_GUID" }, \
-  { &my_gLenovoSystemConPlatformDxeGuid, L"LENOVO_SYSTEM_CON_PLATFORM_DXE_GUID" }, \
-  { &my_gLenovoPlatformS3SaveDxeGuid, L"LENOVO_PLATFORM_S3_SAVE_DXE_GUID" }, \
-  { &my_gLenovoTdtAmGuid, L"LENOVO_TDT_AM_GUID" }, \
-  { &my_gLenovoArpDxeBinGuid, L"LENOVO_ARP_DXE_BIN_GUID" }, \
-  { &my_gLenovoHpmDxeGuid, L"LENOVO_HPM_DXE_GUID" }, \
-  { &my_gLenovoSystemDataHubDxeGuid, L"LENOVO_SYSTEM_DATA_HUB_DXE_GUID" }, \
-  { &my_gLenovoSystemFlashCommunicationDxeGuid, L"LENOVO_SYSTEM_FLASH_COMMUNICATION_DXE_GUID" }, \
-  { &my_gLenovoSystemFirmwareDeviceSmmGuid, L"LENOVO_SYSTEM_FIRMWARE_DEVICE_SMM_GUID" }, \
-  { &my_gLenovoDriveEraseDxeGuid, L"LENOVO_DRIVE_ERASE_DXE_GUID" }, \
-  { &my_gLenovoSmmBaseRuntimeGuid, L"LENOVO_SMM_BASE_RUNTIME_GUID" }, \
-  { &my_gLenovoDriveEraseSmmGuid, L"LENOVO_DRIVE_ERASE_SMM_GUID" }, \
-  { &my_gLenovoPriorBootGuid, L"LENOVO_PRIOR_BOOT_GUID" }, \
-  { &my_gLenovoDiskControllerSmbiosGuid, L"LENOVO_DISK_CONTROLLER_SMBIOS_GUID" }, \
-  { &my_gLenovoDxeRealtekCrcInitGuid, L"LENOVO_DXE_REALTEK_CRC_INIT_GUID" }, \
-  { &my_gLenovoPlatformCsmDxeGuid, L"LENOVO_PLATFORM_CSM_DXE_GUID" }, \
-  { &my_gLenovoSecureErrorManagerDxeGuid, L"LENOVO_SECURE_ERROR_MANAGER_DXE_GUID" }, \
-  { &my_gLenovoIp6DxeBinGuid, L"LENOVO_IP6_DXE_BIN_GUID" }, \
-  { &my_gLenovoSetupRestartDxeGuid, L"LENOVO_SETUP_RESTART_DXE_GUID" }, \
-  { &my_gLenovoSystemImageDecoderDxeGuid, L"LENOVO_SYSTEM_IMAGE_DECODER_DXE_GUID" }, \
-  { &my_gLenovoSetupConfigDxeGuid, L"LENOVO_SETUP_CONFIG_DXE_GUID" }, \
-  { &my_gLenovoSmbiosCompatiInfoGuid, L"LENOVO_SMBIOS_COMPATI_INFO_GUID" }, \
-  { &my_gLenovoSystemKbcInitDxeGuid, L"LENOVO_SYSTEM_KBC_INIT_DXE_GUID" }, \
-  { &my_gLenovoRemoteConfigUpdateDxeGuid, L"LENOVO_REMOTE_CONFIG_UPDATE_DXE_GUID" }, \
-  { &my_gLenovoCpuInitDxeGuid, L"LENOVO_CPU_INIT_DXE_GUID" }, \
-  { &my_gLenovoCpuInitPhnxDxeGuid, L"LENOVO_CPU_INIT_PHNX_DXE_GUID" }, \
-  { &my_gLenovoSystemVariableSmmGuid, L"LENOVO_SYSTEM_VARIABLE_SMM_GUID" }, \
-  { &my_gLenovoSetupUnderOsSmmGuid, L"LENOVO_SETUP_UNDER_OS_SMM_GUID" }, \
-  { &my_gLenovoRnRconfigGuid, L"LENOVO_RN_RCONFIG_GUID" }, \
-  { &my_gLenovoVariableDxeGuid, L"LENOVO_VARIABLE_DXE_GUID" }, \
-  { &my_gLenovoMiscGaIoSmmGuid, L"LENOVO_MISC_GA_IO_SMM_GUID" }, \
-  { &my_gLenovoW25Q32FlashPartDxeGuid, L"LENOVO_W25_Q32_FLASH_PART_DXE_GUID" }, \
-  { &my_gLenovoSystemIdeBusDxeGuid, L"LENOVO_SYSTEM_IDE_BUS_DXE_GUID" }, \
-  { &my_gLenovoOemMilestoneGuid, L"LENOVO_OEM_MILESTONE_GUID" }, \
-  { &my_gLenovoSetupSecurityDxeGuid, L"LENOVO_SETUP_SECURITY_DXE_GUID" }, \
-  { &my_gLenovoSecureKeyDxeGuid, L"LENOVO_SECURE_KEY_DXE_GUID" }, \
-  { &my_gLenovoUdp4DxeBinGuid, L"LENOVO_UDP4_DXE_BIN_GUID" }, \
-  { &my_gLenovoN25Q064FlashPartSmmGuid, L"LENOVO_N25_Q064_FLASH_PART_SMM_GUID" }, \
-  { &my_gLenovoSmbiosVproGuid, L"LENOVO_SMBIOS_VPRO_GUID" }, \
-  { &my_gLenovoW25Q64FlashPartSmmGuid, L"LENOVO_W25_Q64_FLASH_PART_SMM_GUID" }, \
-  { &my_gLenovoSystemIsaKbcDxeGuid, L"LENOVO_SYSTEM_ISA_KBC_DXE_GUID" }, \
-  { &my_gLenovoPlatformFlashSmmGuid, L"LENOVO_PLATFORM_FLASH_SMM_GUID" }, \
-  { &my_gLenovoPiSaveStateAccessGuid, L"LENOVO_PI_SAVE_STATE_ACCESS_GUID" }, \
-  { &my_gLenovoSystemAcpiSupportDxeGuid, L"LENOVO_SYSTEM_ACPI_SUPPORT_DXE_GUID" }, \
-  { &my_gLenovoSystemSetup2DxeGuid, L"LENOVO_SYSTEM_SETUP2_DXE_GUID" }, \
-  { &my_gLenovoSystemIdeAtaAtapiPassThruSmmGuid, L"LENOVO_SYSTEM_IDE_ATA_ATAPI_PASS_THRU_SMM_GUID" }, \
-  { &my_gLenovoSystemBootManagerDxeGuid, L"LENOVO_SYSTEM_BOOT_MANAGER_DXE_GUID" }, \
-  { &my_gLenovoBlockPowerButtonDxeGuid, L"LENOVO_BLOCK_POWER_BUTTON_DXE_GUID" }, \
-  { &my_gLenovoSystemAcpiNumaDxeGuid, L"LENOVO_SYSTEM_ACPI_NUMA_DXE_GUID" }, \
-  { &my_gLenovoSystemAcpiTableLoaderDxeGuid, L"LENOVO_SYSTEM_ACPI_TABLE_LOADER_DXE_GUID" }, \
-  { &my_gLenovoDigitalThermalSensorSmmGuid, L"LENOVO_DIGITAL_THERMAL_SENSOR_SMM_GUID" }, \
-  { &my_gLenovoSystemFixedBusNumbersDxeGuid, L"LENOVO_SYSTEM_FIXED_BUS_NUMBERS_DXE_GUID" }, \
-  { &my_gLenovoSystemVariableDxeGuid, L"LENOVO_SYSTEM_VARIABLE_DXE_GUID" }, \
-  { &my_gLenovoSystemSwSmiAllocatorRtGuid, L"LENOVO_SYSTEM_SW_SMI_ALLOCATOR_RT_GUID" }, \
-  { &my_gLenovoSystem8259InterruptControllerDxeGuid, L"LENOVO_SYSTEM8259_INTERRUPT_CONTROLLER_DXE_GUID" }, \
-  { &my_gLenovoWmaPolicyDxeGuid, L"LENOVO_WMA_POLICY_DXE_GUID" }, \
-  { &my_gLenovoLanUefiGuid, L"LENOVO_LAN_UEFI_GUID" }, \
-  { &my_gLenovoPopManagerDxeGuid, L"LENOVO_POP_MANAGER_DXE_GUID" }, \
-  { &my_gLenovoSystemUsbMemoryManagerDxeGuid, L"LENOVO_SYSTEM_USB_MEMORY_MANAGER_DXE_GUID" }, \
-  { &my_gLenovoAtpSmiServicesGuid, L"LENOVO_ATP_SMI_SERVICES_GUID" }, \
-  { &my_gLenovoModulesSmmThunkSmmGuid, L"LENOVO_MODULES_SMM_THUNK_SMM_GUID" }, \
-  { &my_gLenovoVproPetAlertGuid, L"LENOVO_VPRO_PET_ALERT_GUID" }, \
-  { &my_gLenovoSmmRelocDxeGuid, L"LENOVO_SMM_RELOC_DXE_GUID" }, \
-  { &my_gLenovoIgdCustomizeGuid, L"LENOVO_IGD_CUSTOMIZE_GUID" }, \
-  { &my_gLenovoSetupDateTimeDxeGuid, L"LENOVO_SETUP_DATE_TIME_DXE_GUID" }, \
-  { &my_gLenovoTranslateServiceGuid, L"LENOVO_TRANSLATE_SERVICE_GUID" }, \
-  { &my_gLenovoMeConfigGuid, L"LENOVO_ME_CONFIG_GUID" }, \
-  { &my_gLenovoSystemOemActivationDxeGuid, L"LENOVO_SYSTEM_OEM_ACTIVATION_DXE_GUID" }, \
-  { &my_gLenovoSystemPciIsaBusDxeGuid, L"LENOVO_SYSTEM_PCI_ISA_BUS_DXE_GUID" }, \
-  { &my_gLenovoLegacyBiosMiscSmmGuid, L"LENOVO_LEGACY_BIOS_MISC_SMM_GUID" }, \
-  { &my_gLenovoInitMePolicyGuid, L"LENOVO_INIT_ME_POLICY_GUID" }, \
-  { &my_gLenovoSetupAutomationSmmGuid, L"LENOVO_SETUP_AUTOMATION_SMM_GUID" }, \
-  { &my_gLenovoN25Q064FlashPartDxeGuid, L"LENOVO_N25_Q064_FLASH_PART_DXE_GUID" }, \
-  { &my_gLenovoHdpManagerSmmGuid, L"LENOVO_HDP_MANAGER_SMM_GUID" }, \
-  { &my_gLenovoSystemXhciResetSystemGuid, L"LENOVO_SYSTEM_XHCI_RESET_SYSTEM_GUID" }, \
-  { &my_gLenovoNationalLpcPc87393Guid, L"LENOVO_NATIONAL_LPC_PC87393_GUID" }, \
-  { &my_gLenovoSystemEnglishDxeGuid, L"LENOVO_SYSTEM_ENGLISH_DXE_GUID" }, \
-  { &my_gLenovoAbsoluteComputraceInstallerWin8Guid, L"LENOVO_ABSOLUTE_COMPUTRACE_INSTALLER_WIN8_GUID" }, \
-  { &my_gLenovoWmaPciDxeGuid, L"LENOVO_WMA_PCI_DXE_GUID" }, \
-  { &my_gLenovoDptfGuid, L"LENOVO_DPTF_GUID" }, \
-  { &my_gLenovoSystemIsaSerialDxeGuid, L"LENOVO_SYSTEM_ISA_SERIAL_DXE_GUID" }, \
-  { &my_gLenovoSystemPciBusDxeGuid, L"LENOVO_SYSTEM_PCI_BUS_DXE_GUID" }, \
-  { &my_gLenovoDhcp4DxeBinGuid, L"LENOVO_DHCP4_DXE_BIN_GUID" }, \
-  { &my_gLenovoSystemXhciDxeGuid, L"LENOVO_SYSTEM_XHCI_DXE_GUID" }, \
-  { &my_gLenovoDxeCmosInitGuid, L"LENOVO_DXE_CMOS_INIT_GUID" }, \
-  { &my_gLenovoTcgServicesSmmGuid, L"LENOVO_TCG_SERVICES_SMM_GUID" }, \
-  { &my_gLenovoDhcp6DxeBinGuid, L"LENOVO_DHCP6_DXE_BIN_GUID" }, \
-  { &my_gLenovoSystemEnhancedFatDxeGuid, L"LENOVO_SYSTEM_ENHANCED_FAT_DXE_GUID" }, \
-  { &my_gLenovoSystemNullMemoryTestDxeGuid, L"LENOVO_SYSTEM_NULL_MEMORY_TEST_DXE_GUID" }, \
-  { &my_gLenovoSmmCf9TrapGuid, L"LENOVO_SMM_CF9_TRAP_GUID" }, \
-  { &my_gLenovoMtftp6DxeBinGuid, L"LENOVO_MTFTP6_DXE_BIN_GUID" }, \
-  { &my_gLenovoPlatformResetRuntimeDxeGuid, L"LENOVO_PLATFORM_RESET_RUNTIME_DXE_GUID" }, \
-  { &my_gLenovoSystemDevicePathDxeGuid, L"LENOVO_SYSTEM_DEVICE_PATH_DXE_GUID" }, \
-  { &my_gLenovoSmmCoreDispatcherGuid, L"LENOVO_SMM_CORE_DISPATCHER_GUID" }, \
-  { &my_gLenovoMebxGuid, L"LENOVO_MEBX_GUID" }, \
-  { &my_gLenovoEn25Qh128FlashPartDxeGuid, L"LENOVO_EN25_QH128_FLASH_PART_DXE_GUID" }, \
-  { &my_gLenovoIsscDxeGuid, L"LENOVO_ISSC_DXE_GUID" }, \
-  { &my_gLenovoSystemTerminalDxeGuid, L"LENOVO_SYSTEM_TERMINAL_DXE_GUID" }, \
-  { &my_gLenovoSystemCapsuleRtGuid, L"LENOVO_SYSTEM_CAPSULE_RT_GUID" }, \
-  { &my_gLenovoPchConfigGuid, L"LENOVO_PCH_CONFIG_GUID" }, \
-  { &my_gLenovoIp4DxeBinGuid, L"LENOVO_IP4_DXE_BIN_GUID" }, \
-  { &my_gLenovoSystemUsbMassStorageDxeGuid, L"LENOVO_SYSTEM_USB_MASS_STORAGE_DXE_GUID" }, \
-  { &my_gLenovoSystemErrorLogDxeGuid, L"LENOVO_SYSTEM_ERROR_LOG_DXE_GUID" }, \
-  { &my_gLenovoDpcDxeBinGuid, L"LENOVO_DPC_DXE_BIN_GUID" }, \
-  { &my_gLenovoSnpDxeBinGuid, L"LENOVO_SNP_DXE_BIN_GUID" }, \
-  { &my_gLenovoSecureUpdateDxeGuid, L"LENOVO_SECURE_UPDATE_DXE_GUID" }, \
-  { &my_gLenovoOemHookSmmGuid, L"LENOVO_OEM_HOOK_SMM_GUID" }, \
-  { &my_gLenovoPlatformSetupDxeGuid, L"LENOVO_PLATFORM_SETUP_DXE_GUID" }, \
-  { &my_gLenovoMx25L3206EflashPartDxeGuid, L"LENOVO_MX25_L3206_EFLASH_PART_DXE_GUID" }, \
-  { &my_gLenovoSystemAcpiTablesDxeGuid, L"LENOVO_SYSTEM_ACPI_TABLES_DXE_GUID" }, \
-  { &my_gLenovoSmBiosHoleGuid, L"LENOVO_SM_BIOS_HOLE_GUID" }, \
-  { &my_gLenovoSystemDiagnosticSplashScreenAppGuid, L"LENOVO_SYSTEM_DIAGNOSTIC_SPLASH_SCREEN_APP_GUID" }, \
-  { &my_gLenovoPciExpressGuid, L"LENOVO_PCI_EXPRESS_GUID" }, \
-  { &my_gLenovoSystemSecureBootDxeGuid, L"LENOVO_SYSTEM_SECURE_BOOT_DXE_GUID" }, \
-  { &my_gLenovoPromptServiceGuid, L"LENOVO_PROMPT_SERVICE_GUID" }, \
-  { &my_gLenovoSystemFormBrowserSimpleTextViewLayoutDxeGuid, L"LENOVO_SYSTEM_FORM_BROWSER_SIMPLE_TEXT_VIEW_LAYOUT_DXE_GUID" }, \
-  { &my_gLenovoSmmRelocPeimGuid, L"LENOVO_SMM_RELOC_PEIM_GUID" }, \
-  { &my_gLenovoSystemFrameworkHiiDatabaseDxeGuid, L"LENOVO_SYSTEM_FRAMEWORK_HII_DATABASE_DXE_GUID" }, \
-  { &my_gLenovoInitVproPolicyGuid, L"LENOVO_INIT_VPRO_POLICY_GUID" }, \
-  { &my_gLenovoVariableInitDxeGuid, L"LENOVO_VARIABLE_INIT_DXE_GUID" }, \
-  { &my_gLenovoVproMebxHotkeyGuid, L"LENOVO_VPRO_MEBX_HOTKEY_GUID" }, \
-  { &my_gLenovoEn25Qh64FlashPartDxeGuid, L"LENOVO_EN25_QH64_FLASH_PART_DXE_GUID" }, \
-  { &my_gLenovoPchPcieSmmGuid, L"LENOVO_PCH_PCIE_SMM_GUID" }, \
-  { &my_gLenovoSystemMonotonicCounterRtGuid, L"LENOVO_SYSTEM_MONOTONIC_COUNTER_RT_GUID" }, \
-  { &my_gLenovoIncompatiblePciDeviceGuid, L"LENOVO_INCOMPATIBLE_PCI_DEVICE_GUID" }, \
-  { &my_gLenovoPchResetGuid, L"LENOVO_PCH_RESET_GUID" }, \
-  { &my_gLenovoAoacDxeGuid, L"LENOVO_AOAC_DXE_GUID" }, \
-  { &my_gLenovoSystemAhciBusSmmGuid, L"LENOVO_SYSTEM_AHCI_BUS_SMM_GUID" }, \
-  { &my_gLenovoSystemRuntimeDxeGuid, L"LENOVO_SYSTEM_RUNTIME_DXE_GUID" }, \
-  { &my_gLenovoMebxSetupBrowserGuid, L"LENOVO_MEBX_SETUP_BROWSER_GUID" }, \
-  { &my_gLenovoOsOptDefaultDxeGuid, L"LENOVO_OS_OPT_DEFAULT_DXE_GUID" }, \
-  { &my_gLenovoSoundServiceGuid, L"LENOVO_SOUND_SERVICE_GUID" }, \
-  { &my_gLenovoIFfsDxeGuid, L"LENOVO_I_FFS_DXE_GUID" }, \
-  { &my_gLenovoSystemSmmCommunicationSmmGuid, L"LENOVO_SYSTEM_SMM_COMMUNICATION_SMM_GUID" }, \
-  { &my_gLenovoUserManagerDxeGuid, L"LENOVO_USER_MANAGER_DXE_GUID" }, \
-  { &my_gLenovoUefiPxeBcDxeBinGuid, L"LENOVO_UEFI_PXE_BC_DXE_BIN_GUID" }, \
-  { &my_gLenovoBoardInfoDxeGuid, L"LENOVO_BOARD_INFO_DXE_GUID" }, \
-  { &my_gLenovoSystemFlashCommunicationSmmGuid, L"LENOVO_SYSTEM_FLASH_COMMUNICATION_SMM_GUID" }, \
-  { &my_gLenovoSmbiosTcgDxeGuid, L"LENOVO_SMBIOS_TCG_DXE_GUID" }, \
-  { &my_gLenovoCpuIoGuid, L"LENOVO_CPU_IO_GUID" }, \
-  { &my_gLenovoOsOptDefaultSmmGuid, L"LENOVO_OS_OPT_DEFAULT_SMM_GUID" }, \
-  { &my_gLenovoSystemAhciAtaAtapiPassThruSmmGuid, L"LENOVO_SYSTEM_AHCI_ATA_ATAPI_PASS_THRU_SMM_GUID" }, \
-  { &my_gLenovoSystemErrorMenuDxeGuid, L"LENOVO_SYSTEM_ERROR_MENU_DXE_GUID" }, \
-  { &my_gLenovoSystemEhciDxeGuid, L"LENOVO_SYSTEM_EHCI_DXE_GUID" }, \
-  { &my_gLenovoStatusCodeMeDebugDxeGuid, L"LENOVO_STATUS_CODE_ME_DEBUG_DXE_GUID" }, \
-  { &my_gLenovoSystemTextConsoleVgaDxeGuid, L"LENOVO_SYSTEM_TEXT_CONSOLE_VGA_DXE_GUID" }, \
-  { &my_gLenovoMailBoxSmmGuid, L"LENOVO_MAIL_BOX_SMM_GUID" }, \
-  { &my_gLenovoSmmFdiskOemGuid, L"LENOVO_SMM_FDISK_OEM_GUID" }, \
-  { &my_gLenovoSystemStatusCodePort80SmmGuid, L"LENOVO_SYSTEM_STATUS_CODE_PORT80_SMM_GUID" }, \
-  { &my_gLenovoPchSpiRuntimeGuid, L"LENOVO_PCH_SPI_RUNTIME_GUID" }, \
-  { &my_gLenovoSmmAslSmiGuid, L"LENOVO_SMM_ASL_SMI_GUID" }, \
-  { &my_gLenovoVariableDefaultGuid, L"LENOVO_VARIABLE_DEFAULT_GUID" }, \
-  { &my_gLenovoPchS3SupportGuid, L"LENOVO_PCH_S3_SUPPORT_GUID" }, \
-  { &my_gLenovoSvpManagerDxeGuid, L"LENOVO_SVP_MANAGER_DXE_GUID" }, \
-  { &my_gLenovoSystemDiagnosticSummaryScreenDxeGuid, L"LENOVO_SYSTEM_DIAGNOSTIC_SUMMARY_SCREEN_DXE_GUID" }, \
-  { &my_gLenovoSystemAcceleratorKeyDxeGuid, L"LENOVO_SYSTEM_ACCELERATOR_KEY_DXE_GUID" }, \
-  { &my_gLenovoSystemFlashUpdateDriverDxeGuid, L"LENOVO_SYSTEM_FLASH_UPDATE_DRIVER_DXE_GUID" }, \
-  { &my_gLenovoSmapiSmmGuid, L"LENOVO_SMAPI_SMM_GUID" }, \
-  { &my_gLenovoSystemDiskIoDxeGuid, L"LENOVO_SYSTEM_DISK_IO_DXE_GUID" }, \
-  { &my_gLenovoSystemDataHubStdErrDxeGuid, L"LENOVO_SYSTEM_DATA_HUB_STD_ERR_DXE_GUID" }, \
-  { &my_gLenovoSystemKeyDescDxeGuid, L"LENOVO_SYSTEM_KEY_DESC_DXE_GUID" }, \
-  { &my_gLenovoHdpManagerDxeGuid, L"LENOVO_HDP_MANAGER_DXE_GUID" }, \
-  { &my_gLenovoPlatformSmmGuid, L"LENOVO_PLATFORM_SMM_GUID" }, \
-  { &my_gLenovoEn25Qh32FlashPartSmmGuid, L"LENOVO_EN25_QH32_FLASH_PART_SMM_GUID" }, \
-  { &my_gLenovoVideoInitDxeGuid, L"LENOVO_VIDEO_INIT_DXE_GUID" }, \
-  { &my_gLenovoSystemFontDxeGuid, L"LENOVO_SYSTEM_FONT_DXE_GUID" }, \
-  { &my_gLenovoSystemSetupAdvancedDxeGuid, L"LENOVO_SYSTEM_SETUP_ADVANCED_DXE_GUID" }, \
-  { &my_gLenovoSystemGraphicsConsoleDxeGuid, L"LENOVO_SYSTEM_GRAPHICS_CONSOLE_DXE_GUID" }, \
-  { &my_gLenovoSystemSmBiosSmmGuid, L"LENOVO_SYSTEM_SM_BIOS_SMM_GUID" }, \
-  { &my_gLenovoSystemBusIsaRtcSmmGuid, L"LENOVO_SYSTEM_BUS_ISA_RTC_SMM_GUID" }, \
-  { &my_gLenovoSystemAcpiSmiServicesDxe2Guid, L"LENOVO_SYSTEM_ACPI_SMI_SERVICES_DXE2_GUID" }, \
-  { &my_gLenovoPlatformHiiAdvancedDxeGuid, L"LENOVO_PLATFORM_HII_ADVANCED_DXE_GUID" }, \
-  { &my_gLenovoVariableSmmGuid, L"LENOVO_VARIABLE_SMM_GUID" }, \
-  { &my_gLenovoSystemFormBrowserSimpleTextViewDxeGuid, L"LENOVO_SYSTEM_FORM_BROWSER_SIMPLE_TEXT_VIEW_DXE_GUID" }, \
-  { &my_gLenovoN25Q032FlashPartSmmGuid, L"LENOVO_N25_Q032_FLASH_PART_SMM_GUID" }, \
-  { &my_gLenovoMfgBenchEventDxeGuid, L"LENOVO_MFG_BENCH_EVENT_DXE_GUID" }, \
-  { &my_gLenovoUdp6DxeBinGuid, L"LENOVO_UDP6_DXE_BIN_GUID" }, \
-  { &my_gLenovoSystemStatusCodeGenericSmmGuid, L"LENOVO_SYSTEM_STATUS_CODE_GENERIC_SMM_GUID" }, \
-  { &my_gLenovoMx25L64XflashPartSmmGuid, L"LENOVO_MX25_L64_XFLASH_PART_SMM_GUID" }, \
-  { &my_gLenovoMtftp4DxeBinGuid, L"LENOVO_MTFTP4_DXE_BIN_GUID" }, \
-  { &my_gLenovoIFfsDxePolicyInitGuid, L"LENOVO_I_FFS_DXE_POLICY_INIT_GUID" }, \
-  { &my_gLenovoWmaUsbDxeGuid, L"LENOVO_WMA_USB_DXE_GUID" }, \
-  { &my_gLenovoSystemScsiOpromPassThruDxeGuid, L"LENOVO_SYSTEM_SCSI_OPROM_PASS_THRU_DXE_GUID" }, \
-  { &my_gLenovoPasswordCpGuid, L"LENOVO_PASSWORD_CP_GUID" }, \
-  { &my_gLenovoSystemDiagnosticSplashScreenDxeGuid, L"LENOVO_SYSTEM_DIAGNOSTIC_SPLASH_SCREEN_DXE_GUID" }, \
-  { &my_gLenovoIbexPeakFlashControllerSmmGuid, L"LENOVO_IBEX_PEAK_FLASH_CONTROLLER_SMM_GUID" }, \
-  { &my_gLenovoSmmSleepEventGuid, L"LENOVO_SMM_SLEEP_EVENT_GUID" }, \
-  { &my_gLenovoAt24Rf08EepromDxeGuid, L"LENOVO_AT24_RF08_EEPROM_DXE_GUID" }, \
-  { &my_gLenovoKbdConfigGuid, L"LENOVO_KBD_CONFIG_GUID" }, \
-  { &my_gLenovoSystemLegacyBiosDxeGuid, L"LENOVO_SYSTEM_LEGACY_BIOS_DXE_GUID" }, \
-  { &my_gLenovoVproCiraHotKeyGuid, L"LENOVO_VPRO_CIRA_HOT_KEY_GUID" }, \
-  { &my_gLenovoOemHookGuid, L"LENOVO_OEM_HOOK_GUID" }, \
-  { &my_gLenovoSystemSmbiosDxeGuid, L"LENOVO_SYSTEM_SMBIOS_DXE_GUID" }, \
-  { &my_gLenovoSecureKeySmmGuid, L"LENOVO_SECURE_KEY_SMM_GUID" }, \
-  { &my_gLenovoMeConOutReadyGuid, L"LENOVO_ME_CON_OUT_READY_GUID" }, \
-  { &my_gLenovoFingerprintCpGuid, L"LENOVO_FINGERPRINT_CP_GUID" }, \
-  { &my_gLenovoSystemSmmUsbLegacySmmGuid, L"LENOVO_SYSTEM_SMM_USB_LEGACY_SMM_GUID" }, \
-  { &my_gLenovoSystemWatchdogTimerDxeGuid, L"LENOVO_SYSTEM_WATCHDOG_TIMER_DXE_GUID" }, \
-  { &my_gLenovoN25Q032FlashPartDxeGuid, L"LENOVO_N25_Q032_FLASH_PART_DXE_GUID" }, \
-  { &my_gLenovoSystemSecurityStubDxeGuid, L"LENOVO_SYSTEM_SECURITY_STUB_DXE_GUID" }, \
-  { &my_gLenovoSvpManagerSmmGuid, L"LENOVO_SVP_MANAGER_SMM_GUID" }, \
-  { &my_gLenovoStartupMenuDxeGuid, L"LENOVO_STARTUP_MENU_DXE_GUID" }, \
-  { &my_gLenovoPlatformS3SaveSmmGuid, L"LENOVO_PLATFORM_S3_SAVE_SMM_GUID" }, \
-  { &my_gLenovoSystemCmosDxeGuid, L"LENOVO_SYSTEM_CMOS_DXE_GUID" }, \
-  { &my_gLenovoFingerprintSmmGuid, L"LENOVO_FINGERPRINT_SMM_GUID" }, \
-  { &my_gLenovoPowerManagement2Guid, L"LENOVO_POWER_MANAGEMENT2_GUID" }, \
-  { &my_gLenovoW25Q32FlashPartSmmGuid, L"LENOVO_W25_Q32_FLASH_PART_SMM_GUID" }, \
-  { &my_gLenovoSystemUsbDatabaseDxeGuid, L"LENOVO_SYSTEM_USB_DATABASE_DXE_GUID" }, \
-  { &my_gLenovoTcgSmmGuid, L"LENOVO_TCG_SMM_GUID" }, \
-  { &my_gLenovoSlp2SmmGuid, L"LENOVO_SLP2_SMM_GUID" }, \
-  { &my_gLenovoFitDiagnosticsGuid, L"LENOVO_FIT_DIAGNOSTICS_GUID" }, \
-  { &my_gLenovoSystemSecureFlashSleepTrapSmmGuid, L"LENOVO_SYSTEM_SECURE_FLASH_SLEEP_TRAP_SMM_GUID" }, \
-  { &my_gLenovoTxtDxeGuid, L"LENOVO_TXT_DXE_GUID" }, \
-  { &my_gLenovoEaiaPeiGuid, L"LENOVO_EAIA_PEI_GUID" }, \
-  { &my_gLenovoPlatformStage2PeiGuid, L"LENOVO_PLATFORM_STAGE2_PEI_GUID" }, \
-  { &my_gLenovoMiscGaIoPeimGuid, L"LENOVO_MISC_GA_IO_PEIM_GUID" }, \
-  { &my_gLenovoPeiMainGuid, L"LENOVO_PEI_MAIN_GUID" }, \
-  { &my_gLenovoPlatformStage1PeiGuid, L"LENOVO_PLATFORM_STAGE1_PEI_GUID" }, \
-  { &my_gLenovoFlashProtectPeiGuid, L"LENOVO_FLASH_PROTECT_PEI_GUID" }, \
-  { &my_gLenovoSystemAcpiTablesPeiGuid, L"LENOVO_SYSTEM_ACPI_TABLES_PEI_GUID" }, \
-  { &my_gLenovoOemSecPeiGuid, L"LENOVO_OEM_SEC_PEI_GUID" }, \
-  { &my_gLenovoSystemUsbBotPeiGuid, L"LENOVO_SYSTEM_USB_BOT_PEI_GUID" }, \
-  { &my_gLenovoSystemBootModePeiGuid, L"LENOVO_SYSTEM_BOOT_MODE_PEI_GUID" }, \
-  { &my_gLenovoPeiCpuIoGuid, L"LENOVO_PEI_CPU_IO_GUID" }, \
-  { &my_gLenovoSystemS3ResumePeiGuid, L"LENOVO_SYSTEM_S3_RESUME_PEI_GUID" }, \
-  { &my_gLenovoVideoInitPeimGuid, L"LENOVO_VIDEO_INIT_PEIM_GUID" }, \
-  { &my_gLenovoAt24Rf08EepromPeiGuid, L"LENOVO_AT24_RF08_EEPROM_PEI_GUID" }, \
-  { &my_gLenovoPostValidatorPeiGuid, L"LENOVO_POST_VALIDATOR_PEI_GUID" }, \
-  { &my_gLenovoSystemFvFileLoaderGuid, L"LENOVO_SYSTEM_FV_FILE_LOADER_GUID" }, \
-  { &my_gLenovoMailBoxPeiGuid, L"LENOVO_MAIL_BOX_PEI_GUID" }, \
-  { &my_gLenovoEcIoPeimGuid, L"LENOVO_EC_IO_PEIM_GUID" }, \
-  { &my_gLenovoModuleS3ResumePeimGuid, L"LENOVO_MODULE_S3_RESUME_PEIM_GUID" }, \
-  { &my_gLenovoCpuS3PeimGuid, L"LENOVO_CPU_S3_PEIM_GUID" }, \
-  { &my_gLenovoUserManagerPeiGuid, L"LENOVO_USER_MANAGER_PEI_GUID" }, \
-  { &my_gLenovoProtectPbpeiGuid, L"LENOVO_PROTECT_PBPEI_GUID" }, \
-  { &my_gLenovoIsscPeiGuid, L"LENOVO_ISSC_PEI_GUID" }, \
-  { &my_gLenovoPlatformStage0PeiGuid, L"LENOVO_PLATFORM_STAGE0_PEI_GUID" }
+#define GUID_DB_COUNT             1931
+#define GUID_DB_NAME_POOL_SIZE    56898
+#define GUID_DB_HASH_BUCKET_COUNT 512
+#define GUID_DB_HASH_SLOT_COUNT   2048
+#define GUID_DB_HASH_EMPTY_SLOT   0xFFFF
+
+#define GUID_DB_GUIDS \
+  { 0xA4EE0728, 0xE5D7, 0x4AC5, { 0xB2, 0x1E, 0x65, 0x8E, 0xD8, 0x57, 0xE8, 0x34 } }, \
+  { 0xCBD2E4D5, 0x7068, 0x4FF5, { 0xB4, 0x62, 0x98, 0x22, 0xB4, 0xAD, 0x8D, 0x60 } }, \
+  { 0xB199DEA9, 0xFD5C, 0x4A84, { 0x80, 0x82, 0x2F, 0x41, 0x70, 0x78, 0x03, 0x05 } }, \
+  { 0x50BEA1E5, 0xA2C5, 0x46E9, { 0x9B, 0x3A, 0x59, 0x59, 0x65, 0x16, 0xB0, 0x0A } }, \
+  { 0xE11FACA0, 0x4710, 0x4C8E, { 0xA7, 0xA2, 0x01, 0xBA, 0xA2, 0x59, 0x1B, 0x4C } }, \
+  { 0x16C8A6D0, 0xFE8A, 0x4082, { 0xA2, 0x08, 0xCF, 0x89, 0xC4, 0x29, 0x04, 0x33 } }, \
+  { 0xDC2CD8BD, 0x402C, 0x4DC4, { 0x9B, 0xE0, 0x0C, 0x43, 0x2B, 0x07, 0xFA, 0x34 } }, \
+  { 0x0AD3D31B, 0xB3D8, 0x4506, { 0xAE, 0x71, 0x2E, 0xF1, 0x10, 0x06, 0xD9, 0x0F } }, \
+  { 0x878AC2CC, 0x5343, 0x46F2, { 0xB5, 0x63, 0x51, 0xF8, 0x9D, 0xAF, 0x56, 0xBA } }, \
+  { 0xEC2E931B, 0x3281, 0x48A5, { 0x81, 0x07, 0xDF, 0x8A, 0x8B, 0xED, 0x3C, 0x5D } }, \
+  { 0xE1475E0C, 0x1746, 0x4802, { 0x86, 0x2E, 0x01, 0x1C, 0x2C, 0x2D, 0x9D, 0x86 } }, \
+  { 0x3677D529, 0x326F, 0x4603, { 0xA9, 0x26, 0xEA, 0xAC, 0xE0, 0x1D, 0xCB, 0xB0 } }, \
+  { 0x3C699197, 0x093C, 0x4C69, { 0xB0, 0x6B, 0x12, 0x8A, 0xE3, 0x48, 0x1D, 0xC9 } }, \
+  { 0xB091E7D2, 0x05A0, 0x4198, { 0x94, 0xF0, 0x74, 0xB7, 0xB8, 0xC5, 0x54, 0x59 } }, \
+  { 0x7462660F, 0x1CBD, 0x48DA, { 0xAD, 0x11, 0x91, 0x71, 0x79, 0x13, 0x83, 0x1C } }, \
+  { 0xED150714, 0xDF30, 0x407D, { 0xB2, 0x4A, 0x4B, 0x74, 0x2F, 0xD5, 0xCE, 0xA2 } }, \
+  { 0xD6A2CB7F, 0x6A18, 0x4E2F, { 0xB4, 0x3B, 0x99, 0x20, 0xA7, 0x33, 0x70, 0x0A } }, \
+  { 0x7701D7E5, 0x7D1D, 0x4432, { 0xA4, 0x68, 0x67, 0x3D, 0xAB, 0x8A, 0xDE, 0x60 } }, \
+  { 0x6568A3D6, 0x015F, 0x4B4A, { 0x9C, 0x89, 0x1D, 0x14, 0x63, 0x14, 0x13, 0x0A } }, \
+  { 0x60B5E939, 0x0FCF, 0x4227, { 0xBA, 0x83, 0x6B, 0xBE, 0xD4, 0x5B, 0xC0, 0xE3 } }, \
+  { 0x9E0C30BC, 0x3F06, 0x4BA6, { 0x82, 0x88, 0x09, 0x17, 0x9B, 0x85, 0x5D, 0xBE } }, \
+  { 0xDF2D868E, 0x32FC, 0x4CF0, { 0x8E, 0x6B, 0xFF, 0xD9, 0x5D, 0x13, 0x43, 0xD0 } }, \
+  { 0x910DCA07, 0x1F94, 0x4EE7, { 0xAF, 0x2F, 0xFF, 0x72, 0xF3, 0x15, 0x43, 0x53 } }, \
+  { 0xB1B621D5, 0xF19C, 0x41A5, { 0x83, 0x0B, 0xD9, 0x15, 0x2C, 0x69, 0xAA, 0xE0 } }, \
+  { 0x16958446, 0x19B7, 0x480B, { 0xB0, 0x47, 0x74, 0x85, 0xAD, 0x3F, 0x71, 0x6D } }, \
+  { 0x25A4FD4A, 0x9703, 0x4BA9, { 0xA1, 0x90, 0xB7, 0xC8, 0x4E, 0xFB, 0x3E, 0x57 } }, \
+  { 0x7EBB920D, 0x1AAF, 0x46D9, { 0xB2, 0xAF, 0x54, 0x1E, 0x1D, 0xCE, 0x14, 0x8B } }, \
+  { 0x2B7A240D, 0xD5AD, 0x4FD6, { 0xBE, 0x1C, 0xDF, 0xA4, 0x41, 0x5F, 0x55, 0x26 } }, \
+  { 0x25462CDA, 0x221F, 0x47DF, { 0xAC, 0x1D, 0x25, 0x9C, 0xFA, 0xA4, 0xE3, 0x26 } }, \
+  { 0x2D2358B4, 0xE96C, 0x484D, { 0xB2, 0xDD, 0x7C, 0x2E, 0xDF, 0xC7, 0xD5, 0x6F } }, \
+  { 0x2890B3EA, 0x053D, 0x1643, { 0xAD, 0x0C, 0xD6, 0x48, 0x08, 0xDA, 0x3F, 0xF1 } }, \
+  { 0x32898322, 0x2DA1, 0x474A, { 0xBA, 0xAA, 0xF3, 0xF7, 0xCF, 0x56, 0x94, 0x70 } }, \
+  { 0x9546E07C, 0x2CBB, 0x4C88, { 0x98, 0x6C, 0xCD, 0x34, 0x10, 0x86, 0xF0, 0x44 } }, \
+  { 0xBF4B9D10, 0x13EC, 0x43DD, { 0x88, 0x80, 0xE9, 0x0B, 0x71, 0x8F, 0x27, 0xDE } }, \
+  { 0x735F8C64, 0xD696, 0x44D0, { 0xBD, 0xF2, 0x44, 0x7F, 0xD0, 0x5A, 0x54, 0x06 } }, \
+  { 0x17A0A3D7, 0xC0A5, 0x4635, { 0xBB, 0xD5, 0x07, 0x21, 0x87, 0xDF, 0xE2, 0xEE } }, \
+  { 0xB323179B, 0x97FB, 0x477E, { 0xB0, 0xFE, 0xD8, 0x85, 0x91, 0xFA, 0x11, 0xAB } }, \
+  { 0x3E591C00, 0x9E4A, 0x11DF, { 0x92, 0x44, 0x00, 0x02, 0xA5, 0xD5, 0xC5, 0x1B } }, \
+  { 0x74BD9FE0, 0x8902, 0x11E3, { 0xB9, 0xD3, 0xF7, 0x22, 0x38, 0xFC, 0x9A, 0x31 } }, \
+  { 0x524685A0, 0x89A0, 0x11E3, { 0x9D, 0x4D, 0xBF, 0xA9, 0xF6, 0xA4, 0x03, 0x08 } }, \
+  { 0x021BD2CA, 0x51D2, 0x11E3, { 0x8E, 0x56, 0xB7, 0x54, 0x17, 0xC7, 0x0B, 0x44 } }, \
+  { 0x52CE9845, 0x5AF4, 0x43E2, { 0xBA, 0xFD, 0x23, 0x08, 0x12, 0x54, 0x7A, 0xC2 } }, \
+  { 0x9859BB19, 0x407C, 0x4F8B, { 0xBC, 0xE1, 0xF8, 0xDA, 0x65, 0x65, 0xF4, 0xA5 } }, \
+  { 0x5CF32E0B, 0x8EDF, 0x2E44, { 0x9C, 0xDA, 0x93, 0x20, 0x5E, 0x99, 0xEC, 0x1C } }, \
+  { 0x453368F6, 0x7C85, 0x434A, { 0xA9, 0x8A, 0x72, 0xD1, 0xB7, 0xFF, 0xA9, 0x26 } }, \
+  { 0x30FD316A, 0x6728, 0x2E41, { 0xA6, 0x90, 0x0D, 0x13, 0x33, 0xD8, 0xCA, 0xC1 } }, \
+  { 0x3B1E4B7C, 0x09D8, 0x944F, { 0xA4, 0x08, 0x13, 0x09, 0xEB, 0x8B, 0x44, 0x27 } }, \
+  { 0x6888A4AE, 0xAFCE, 0xE84B, { 0x91, 0x02, 0xF7, 0xB9, 0xDA, 0xE6, 0xA0, 0x30 } }, \
+  { 0xFD5FBE54, 0x8C35, 0xB345, { 0x8A, 0x0F, 0x7A, 0xC8, 0xA5, 0xFD, 0x05, 0x21 } }, \
+  { 0xF8626165, 0x6CEB, 0x924A, { 0xBA, 0xFC, 0xF1, 0x3A, 0xB9, 0xD6, 0x57, 0x28 } }, \
+  { 0xF2BA331A, 0x8985, 0x11DB, { 0xA4, 0x06, 0x00, 0x40, 0xD0, 0x2B, 0x18, 0x35 } }, \
+  { 0xF2BDCC96, 0x8985, 0x11DB, { 0x87, 0x19, 0x00, 0x40, 0xD0, 0x2B, 0x18, 0x35 } }, \
+  { 0xD083E94C, 0x6560, 0x42E4, { 0xB6, 0xD4, 0x2D, 0xF7, 0x5A, 0xDF, 0x6A, 0x2A } }, \
+  { 0xA31280AD, 0x481E, 0x41B6, { 0x95, 0xE8, 0x12, 0x7F, 0x4C, 0x98, 0x47, 0x79 } }, \
+  { 0xC020489E, 0x6DB2, 0x4EF2, { 0x9A, 0xA5, 0xCA, 0x06, 0xFC, 0x11, 0xD3, 0x6A } }, \
+  { 0x2E3044AC, 0x879F, 0x490F, { 0x97, 0x60, 0xBB, 0xDF, 0xAF, 0x69, 0x5F, 0x50 } }, \
+  { 0xA56074DB, 0x65FE, 0x45F7, { 0xBD, 0x21, 0x2D, 0x2B, 0xDD, 0x8E, 0x96, 0x52 } }, \
+  { 0x283FA2EE, 0x532C, 0x484D, { 0x93, 0x83, 0x9F, 0x93, 0xB3, 0x6F, 0x0B, 0x7E } }, \
+  { 0xCF31FAC5, 0xC24E, 0x11D2, { 0x85, 0xF3, 0x00, 0xA0, 0xC9, 0x3E, 0xC9, 0x3B } }, \
+  { 0x847BC3FE, 0xB974, 0x446D, { 0x94, 0x49, 0x5A, 0xD5, 0x41, 0x2E, 0x99, 0x3B } }, \
+  { 0x3EBFA8E6, 0x511D, 0x4B5B, { 0xA9, 0x5F, 0xFB, 0x38, 0x26, 0x0F, 0x1C, 0x27 } }, \
+  { 0xF76E0A70, 0xB5ED, 0x4C38, { 0xAC, 0x9A, 0xE5, 0xF5, 0x4B, 0xF1, 0x6E, 0x34 } }, \
+  { 0x642237C7, 0x35D4, 0x472D, { 0x83, 0x65, 0x12, 0xE0, 0xCC, 0xF2, 0x7A, 0x22 } }, \
+  { 0x1F2D63E1, 0xFEBD, 0x4DC7, { 0x9C, 0xC5, 0xBA, 0x2B, 0x1C, 0xEF, 0x9C, 0x5B } }, \
+  { 0x3B4D9B23, 0x95AC, 0x44F6, { 0x9F, 0xCD, 0x0E, 0x95, 0x94, 0x58, 0x6C, 0x72 } }, \
+  { 0x0E8C545B, 0xA2EE, 0x470D, { 0x8E, 0x26, 0xBD, 0xA1, 0xA1, 0x3C, 0x0A, 0xA3 } }, \
+  { 0xFAB7E9E1, 0x39DD, 0x4F2B, { 0x84, 0x08, 0xE2, 0x0E, 0x90, 0x6C, 0xB6, 0xDE } }, \
+  { 0xC7735A2F, 0x88F5, 0x4882, { 0xAE, 0x63, 0xFA, 0xAC, 0x8C, 0x8B, 0x86, 0xB3 } }, \
+  { 0x7EE2BD44, 0x3DA0, 0x11D4, { 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x64A892DC, 0x5561, 0x4536, { 0x92, 0xC7, 0x79, 0x9B, 0xFC, 0x18, 0x33, 0x55 } }, \
+  { 0x170E13C0, 0xBF1B, 0x4218, { 0x87, 0x1D, 0x2A, 0xBD, 0xC6, 0xF8, 0x87, 0xBC } }, \
+  { 0xD088A413, 0x0A70, 0x4217, { 0xBA, 0x55, 0x9A, 0x3C, 0xB6, 0x5C, 0x41, 0xB3 } }, \
+  { 0x7F0013A7, 0xDC79, 0x4B22, { 0x80, 0x99, 0x11, 0xF7, 0x5F, 0xDC, 0x82, 0x9D } }, \
+  { 0x4E8F4EBB, 0x64B9, 0x4E05, { 0x9B, 0x18, 0x4C, 0xFE, 0x49, 0x23, 0x50, 0x97 } }, \
+  { 0x772484B2, 0x7482, 0x4B91, { 0x9F, 0x9A, 0xAD, 0x43, 0xF8, 0x1C, 0x58, 0x81 } }, \
+  { 0x26FDEB7E, 0xB8AF, 0x4CCF, { 0xAA, 0x97, 0x02, 0x63, 0x3C, 0xE4, 0x8C, 0xA7 } }, \
+  { 0x3B6686BD, 0x0D76, 0x4030, { 0xB7, 0x0E, 0xB5, 0x51, 0x9E, 0x2F, 0xC5, 0xA0 } }, \
+  { 0x98B8D59B, 0xE8BA, 0x48EE, { 0x98, 0xDD, 0xC2, 0x95, 0x39, 0x2F, 0x1E, 0xDB } }, \
+  { 0xF328E36C, 0x23B6, 0x4A95, { 0x85, 0x4B, 0x32, 0xE1, 0x95, 0x34, 0xCD, 0x75 } }, \
+  { 0x7A9354D9, 0x0468, 0x444A, { 0x81, 0xCE, 0x0B, 0xF6, 0x17, 0xD8, 0x90, 0xDF } }, \
+  { 0x125F2DE1, 0xFB85, 0x440C, { 0xA5, 0x4C, 0x4D, 0x99, 0x35, 0x8A, 0x8D, 0x38 } }, \
+  { 0xDBFF9D55, 0x89B7, 0x46DA, { 0xBD, 0xDF, 0x67, 0x7D, 0x3D, 0xC0, 0x24, 0x1D } }, \
+  { 0x470E1529, 0xB79E, 0x4E32, { 0xA0, 0xFE, 0x6A, 0x15, 0x6D, 0x29, 0xF9, 0xB2 } }, \
+  { 0xDB9A1E3D, 0x45CB, 0x4ABB, { 0x85, 0x3B, 0xE5, 0x38, 0x7F, 0xDB, 0x2E, 0x2D } }, \
+  { 0x783658A3, 0x4172, 0x4421, { 0xA2, 0x99, 0xE0, 0x09, 0x07, 0x9C, 0x0C, 0xB4 } }, \
+  { 0x31CE593D, 0x108A, 0x485D, { 0xAD, 0xB2, 0x78, 0xF2, 0x1F, 0x29, 0x66, 0xBE } }, \
+  { 0x0FC9013A, 0x0568, 0x4BA9, { 0x9B, 0x7E, 0xC9, 0xC3, 0x90, 0xA6, 0x60, 0x9B } }, \
+  { 0x38321DBA, 0x4FE0, 0x4E17, { 0x8A, 0xEC, 0x41, 0x30, 0x55, 0xEA, 0xED, 0xC1 } }, \
+  { 0xB0732526, 0x38C8, 0x4B40, { 0x88, 0x77, 0x61, 0xC7, 0xB0, 0x6A, 0xAC, 0x45 } }, \
+  { 0xAE80D021, 0x618E, 0x11D4, { 0xBC, 0xD7, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x389F751F, 0x1838, 0x4388, { 0x83, 0x90, 0xCD, 0x81, 0x54, 0xBD, 0x27, 0xF8 } }, \
+  { 0x448F5DA4, 0x6DD7, 0x4FE1, { 0x93, 0x07, 0x69, 0x22, 0x41, 0x92, 0x21, 0x5D } }, \
+  { 0xD7AD636E, 0xB997, 0x459B, { 0xBF, 0x3F, 0x88, 0x46, 0x89, 0x79, 0x80, 0xE1 } }, \
+  { 0x5542CCE1, 0xDF5C, 0x4D1B, { 0xAB, 0xCA, 0x36, 0x4F, 0x77, 0xD3, 0x99, 0xFB } }, \
+  { 0xF33261E7, 0x23CB, 0x11D5, { 0xBD, 0x5C, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x1390954D, 0xDA95, 0x4227, { 0x93, 0x28, 0x72, 0x82, 0xC2, 0x17, 0xDA, 0xA8 } }, \
+  { 0x3792095A, 0xE309, 0x4C1E, { 0xAA, 0x01, 0x85, 0xF5, 0x65, 0x5A, 0x17, 0xF1 } }, \
+  { 0x8D12E231, 0xC667, 0x4FD1, { 0x98, 0xF2, 0x24, 0x49, 0xA7, 0xE7, 0xB2, 0xE5 } }, \
+  { 0xE541B773, 0xDD11, 0x420C, { 0xB0, 0x26, 0xDF, 0x99, 0x36, 0x53, 0xF8, 0xBF } }, \
+  { 0x14FC52BE, 0x01DC, 0x426C, { 0x91, 0xAE, 0xA2, 0x3C, 0x3E, 0x22, 0x0A, 0xE8 } }, \
+  { 0x9CCA03FC, 0x4C9E, 0x4A19, { 0x9B, 0x06, 0xED, 0x7B, 0x47, 0x9B, 0xDE, 0x55 } }, \
+  { 0xA05B6FFD, 0x87AF, 0x4E42, { 0x95, 0xC9, 0x62, 0x28, 0xB6, 0x3C, 0xF3, 0xF3 } }, \
+  { 0xE0744B81, 0x9513, 0x49CD, { 0x8C, 0xEA, 0xE9, 0x24, 0x5E, 0x70, 0x39, 0xDA } }, \
+  { 0x78965B98, 0xB0BF, 0x449E, { 0x8B, 0x22, 0xD2, 0x91, 0x4E, 0x49, 0x8A, 0x98 } }, \
+  { 0xB709EFA0, 0x47A6, 0x4B41, { 0xB9, 0x31, 0x12, 0xEC, 0xE7, 0xA8, 0xEE, 0x56 } }, \
+  { 0xC50B323E, 0x9075, 0x4F2A, { 0xAC, 0x8E, 0xD2, 0x59, 0x6A, 0x10, 0x85, 0xCC } }, \
+  { 0x5F439A0B, 0x45D8, 0x4682, { 0xA4, 0xF4, 0xF0, 0x57, 0x6B, 0x51, 0x34, 0x41 } }, \
+  { 0xF3E4543D, 0xCF35, 0x6CEF, { 0x35, 0xC4, 0x4F, 0xE6, 0x34, 0x4D, 0xFC, 0x54 } }, \
+  { 0xE5A1333E, 0xE1B4, 0x4D55, { 0xCE, 0xEB, 0x35, 0xC3, 0xEF, 0x13, 0x34, 0x43 } }, \
+  { 0x0FB7C852, 0xADCA, 0x4853, { 0x8D, 0x0F, 0xFB, 0xA7, 0x1B, 0x1C, 0xE1, 0x1A } }, \
+  { 0xDE28BC59, 0x6228, 0x41BD, { 0xBD, 0xF6, 0xA3, 0xB9, 0xAD, 0xB5, 0x8D, 0xA1 } }, \
+  { 0x21F302AD, 0x6E94, 0x471B, { 0x84, 0xBC, 0xB1, 0x48, 0x00, 0x40, 0x3A, 0x1D } }, \
+  { 0x912740BE, 0x2284, 0x4734, { 0xB9, 0x71, 0x84, 0xB0, 0x27, 0x35, 0x3F, 0x0C } }, \
+  { 0x69A79759, 0x1373, 0x4367, { 0xA6, 0xC4, 0xC7, 0xF5, 0x9E, 0xFD, 0x98, 0x6E } }, \
+  { 0x721ACF02, 0x4D77, 0x4C2A, { 0xB3, 0xDC, 0x27, 0x0B, 0x7B, 0xA9, 0xE4, 0xB0 } }, \
+  { 0x73FF4F56, 0xAA8E, 0x4451, { 0xB3, 0x16, 0x36, 0x35, 0x36, 0x67, 0xAD, 0x44 } }, \
+  { 0x56ED21B6, 0xBA23, 0x429E, { 0x89, 0x32, 0x37, 0x6D, 0x8E, 0x18, 0x2E, 0xE3 } }, \
+  { 0xBD44F629, 0xEAE7, 0x4198, { 0x87, 0xF1, 0x39, 0xFA, 0xB0, 0xFD, 0x71, 0x7E } }, \
+  { 0xC9122295, 0x56ED, 0x4D4E, { 0x06, 0xA6, 0x50, 0x8D, 0x89, 0x4D, 0x3E, 0x40 } }, \
+  { 0x6D86FB36, 0xBA90, 0x472C, { 0xB5, 0x83, 0x3F, 0xBE, 0xD3, 0xFB, 0x20, 0x9A } }, \
+  { 0xC4A58D6D, 0x3677, 0x49CB, { 0xA0, 0x0A, 0x94, 0x70, 0x76, 0x5F, 0xB5, 0x5E } }, \
+  { 0xBBCFF46C, 0xC8D3, 0x4113, { 0x89, 0x85, 0xB9, 0xD4, 0xF3, 0xB3, 0xF6, 0x4E } }, \
+  { 0xD038747C, 0xD00C, 0x4980, { 0xB3, 0x19, 0x49, 0x01, 0x99, 0xA4, 0x7D, 0x55 } }, \
+  { 0x9C7C3AA7, 0x5332, 0x4917, { 0x82, 0xB9, 0x56, 0xA5, 0xF3, 0xE6, 0x2A, 0x07 } }, \
+  { 0x00D6B14B, 0x7DD0, 0x4062, { 0x88, 0x21, 0xE5, 0xF9, 0x6A, 0x2A, 0x1B, 0x00 } }, \
+  { 0x798E722E, 0x15B2, 0x4E13, { 0x8A, 0xE9, 0x6B, 0xA3, 0x0F, 0xF7, 0xF1, 0x67 } }, \
+  { 0x96D4FDCD, 0x1502, 0x424D, { 0x9D, 0x4C, 0x9B, 0x12, 0xD2, 0xDC, 0xAE, 0x5C } }, \
+  { 0x3D17E448, 0x0466, 0x4E20, { 0x99, 0x9F, 0xB2, 0xE1, 0x34, 0x88, 0xEE, 0x22 } }, \
+  { 0xEA296D92, 0x0B69, 0x423C, { 0x8C, 0x28, 0x33, 0xB4, 0xE0, 0xA9, 0x12, 0x68 } }, \
+  { 0x3C7D193C, 0x682C, 0x4C14, { 0xA6, 0x8F, 0x55, 0x2D, 0xEA, 0x4F, 0x43, 0x7E } }, \
+  { 0x0F0B1735, 0x87A0, 0x4193, { 0xB2, 0x66, 0x53, 0x8C, 0x38, 0xAF, 0x48, 0xCE } }, \
+  { 0x82DDD68B, 0x9163, 0x4187, { 0x9B, 0x27, 0x20, 0xA8, 0xFD, 0x60, 0xA7, 0x1D } }, \
+  { 0x31CA5D1A, 0xD511, 0x4931, { 0xB7, 0x82, 0xAE, 0x6B, 0x2B, 0x17, 0x8C, 0xD7 } }, \
+  { 0xFFF12B8D, 0x7696, 0x4C8B, { 0xA9, 0x85, 0x27, 0x47, 0x07, 0x5B, 0x4F, 0x50 } }, \
+  { 0x9E58292B, 0x7C68, 0x497D, { 0xA0, 0xCE, 0x65, 0x00, 0xFD, 0x9F, 0x1B, 0x95 } }, \
+  { 0x1D3E9CB8, 0x43AF, 0x490B, { 0x83, 0x0A, 0x35, 0x16, 0xAA, 0x53, 0x20, 0x47 } }, \
+  { 0xD3B36F2C, 0xD551, 0x11D4, { 0x9A, 0x46, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xD3B36F2B, 0xD551, 0x11D4, { 0x9A, 0x46, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x4C19049F, 0x4137, 0x4DD3, { 0x9C, 0x10, 0x8B, 0x97, 0xA8, 0x3F, 0xFD, 0xFA } }, \
+  { 0x711C703F, 0xC285, 0x4B10, { 0xA3, 0xB0, 0x36, 0xEC, 0xBD, 0x3C, 0x8B, 0xE2 } }, \
+  { 0xD3B36F2D, 0xD551, 0x11D4, { 0x9A, 0x46, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xDDCF3616, 0x3275, 0x4164, { 0x98, 0xB6, 0xFE, 0x85, 0x70, 0x7F, 0xFE, 0x7D } }, \
+  { 0xAAF32C78, 0x947B, 0x439A, { 0xA1, 0x80, 0x2E, 0x14, 0x4E, 0xC3, 0x77, 0x92 } }, \
+  { 0x8CFDB8C8, 0xD6B2, 0x40F3, { 0x8E, 0x97, 0x02, 0x30, 0x7C, 0xC9, 0x8B, 0x7C } }, \
+  { 0x93BA1826, 0xDFFB, 0x45DD, { 0x82, 0xA7, 0xE7, 0xDC, 0xAA, 0x3B, 0xBD, 0xF3 } }, \
+  { 0x76B6BDFA, 0x2ACD, 0x4462, { 0x9E, 0x3F, 0xCB, 0x58, 0xC9, 0x69, 0xD9, 0x37 } }, \
+  { 0xF866226A, 0xEAA5, 0x4F5A, { 0xA9, 0x0A, 0x6C, 0xFB, 0xA5, 0x7C, 0x58, 0x8E } }, \
+  { 0x1EA81BEC, 0xF01A, 0x4D98, { 0xA2, 0x01, 0x4A, 0x61, 0xCE, 0x2F, 0xC0, 0x22 } }, \
+  { 0x931FC048, 0xC71D, 0x4455, { 0x89, 0x30, 0x47, 0x06, 0x30, 0xE3, 0x0E, 0xE5 } }, \
+  { 0xFC1BCDB0, 0x7D31, 0x49AA, { 0x93, 0x6A, 0xA4, 0x60, 0x0D, 0x9D, 0xD0, 0x83 } }, \
+  { 0xE701458C, 0x4900, 0x4CA5, { 0xB7, 0x72, 0x3D, 0x37, 0x94, 0x9F, 0x79, 0x27 } }, \
+  { 0x060CC026, 0x4C0D, 0x4DDA, { 0x8F, 0x41, 0x59, 0x5F, 0xEF, 0x00, 0xA5, 0x02 } }, \
+  { 0x9A4E9246, 0xD553, 0x11D5, { 0x87, 0xE2, 0x00, 0x06, 0x29, 0x45, 0xC3, 0xB9 } }, \
+  { 0x2CA88B53, 0xD296, 0x4080, { 0xA4, 0xA5, 0xCA, 0xD9, 0xBA, 0xE2, 0x4B, 0x09 } }, \
+  { 0x59D1C24F, 0x50F1, 0x401A, { 0xB1, 0x01, 0xF3, 0x3E, 0x0D, 0xAE, 0xD4, 0x43 } }, \
+  { 0x3C8D294C, 0x5FC3, 0x4451, { 0xBB, 0x31, 0xC4, 0xC0, 0x32, 0x29, 0x5E, 0x6C } }, \
+  { 0x0FFBCE19, 0x324C, 0x4690, { 0xA0, 0x09, 0x98, 0xC6, 0xAE, 0x2E, 0xB1, 0x86 } }, \
+  { 0xB38573B6, 0x6200, 0x4AC5, { 0xB5, 0x1D, 0x82, 0xE6, 0x59, 0x38, 0xD7, 0x83 } }, \
+  { 0x2E3D2E75, 0x9B2E, 0x412D, { 0xB4, 0xB1, 0x70, 0x41, 0x6B, 0x87, 0x00, 0xFF } }, \
+  { 0x5CAC0099, 0x0DC9, 0x48E5, { 0x80, 0x68, 0xBB, 0x95, 0xF5, 0x40, 0x0A, 0x9F } }, \
+  { 0x2A3CFEBD, 0x27E8, 0x4D0A, { 0x8B, 0x79, 0xD6, 0x88, 0xC2, 0xA3, 0xE1, 0xC0 } }, \
+  { 0xAF9FFD67, 0xEC10, 0x488A, { 0x9D, 0xFC, 0x6C, 0xBF, 0x5E, 0xE2, 0x2C, 0x2E } }, \
+  { 0x0EF98D3A, 0x3E33, 0x497A, { 0xA4, 0x01, 0x77, 0xBE, 0x3E, 0xB7, 0x4F, 0x38 } }, \
+  { 0x3079818C, 0x46D4, 0x4A73, { 0xAE, 0xF3, 0xE3, 0xE4, 0x6C, 0xF1, 0xEE, 0xDB } }, \
+  { 0x79CB58C4, 0xAC51, 0x442F, { 0xAF, 0xD7, 0x98, 0xE4, 0x7D, 0x2E, 0x99, 0x08 } }, \
+  { 0x0C0F3B43, 0x44DE, 0x4907, { 0xB4, 0x78, 0x22, 0x5F, 0x6F, 0x62, 0x89, 0xDC } }, \
+  { 0x3A4D7A7C, 0x018A, 0x4B42, { 0x81, 0xB3, 0xDC, 0x10, 0xE3, 0xB5, 0x91, 0xBD } }, \
+  { 0x4F4EF7F0, 0xAA29, 0x4CE9, { 0xBA, 0x41, 0x64, 0x3E, 0x01, 0x23, 0xA9, 0x9F } }, \
+  { 0xA04A27F4, 0xDF00, 0x4D42, { 0xB5, 0x52, 0x39, 0x51, 0x13, 0x02, 0x11, 0x3D } }, \
+  { 0xB3F56470, 0x6141, 0x4621, { 0x8F, 0x19, 0x70, 0x4E, 0x57, 0x7A, 0xA9, 0xE8 } }, \
+  { 0xF5E655D9, 0x02A6, 0x46F2, { 0x9E, 0x76, 0xB8, 0xBE, 0x8E, 0x60, 0xAB, 0x22 } }, \
+  { 0x8614567D, 0x35BE, 0x4415, { 0x8D, 0x88, 0xBD, 0x7D, 0x0C, 0x9C, 0x70, 0xC0 } }, \
+  { 0x9B942747, 0x154E, 0x4D29, { 0xA4, 0x36, 0xBF, 0x71, 0x00, 0xC8, 0xB5, 0x3B } }, \
+  { 0xD79DF6B0, 0xEF44, 0x43BD, { 0x97, 0x97, 0x43, 0xE9, 0x3B, 0xCF, 0x5F, 0xA8 } }, \
+  { 0x6456ED61, 0x3579, 0x41C9, { 0x8A, 0x26, 0x0A, 0x0B, 0xD6, 0x2B, 0x78, 0xFC } }, \
+  { 0x786EC0AC, 0x65AE, 0x4D1B, { 0xB1, 0x37, 0x0D, 0x11, 0x0A, 0x48, 0x37, 0x97 } }, \
+  { 0x00000000, 0x0000, 0x0000, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, \
+  { 0xEB704011, 0x1402, 0x11D3, { 0x8E, 0x77, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0xC095791A, 0x3001, 0x47B2, { 0x80, 0xC9, 0xEA, 0xC7, 0x31, 0x9F, 0x2F, 0xA4 } }, \
+  { 0x0DC65ADC, 0xA973, 0x4130, { 0x8D, 0xF0, 0x2A, 0xDB, 0xEB, 0x9E, 0x4A, 0x31 } }, \
+  { 0x4F6C5507, 0x232F, 0x4787, { 0xB9, 0x5E, 0x72, 0xF8, 0x62, 0x49, 0x0C, 0xB1 } }, \
+  { 0xDB4E8151, 0x57ED, 0x4BED, { 0x88, 0x33, 0x67, 0x51, 0xB5, 0xD1, 0xA8, 0xD7 } }, \
+  { 0xF6EE6DBB, 0xD67F, 0x4EA0, { 0x8B, 0x96, 0x6A, 0x71, 0xB1, 0x9D, 0x84, 0xAD } }, \
+  { 0x821C9A09, 0x541A, 0x40F6, { 0x9F, 0x43, 0x0A, 0xD1, 0x93, 0xA1, 0x2C, 0xFE } }, \
+  { 0xE22BBCCA, 0x516A, 0x46A8, { 0x80, 0xE2, 0x67, 0x45, 0xE8, 0x36, 0x93, 0xBD } }, \
+  { 0x04B37FE8, 0xF6AE, 0x480B, { 0xBD, 0xD5, 0x37, 0xD9, 0x8C, 0x5E, 0x89, 0xAA } }, \
+  { 0x3D532050, 0x5CDA, 0x4FD0, { 0x87, 0x9E, 0x0F, 0x7F, 0x63, 0x0D, 0x5A, 0xFB } }, \
+  { 0xEE4E5898, 0x3914, 0x4259, { 0x9D, 0x6E, 0xDC, 0x7B, 0xD7, 0x94, 0x03, 0xCF } }, \
+  { 0xD42AE6BD, 0x1352, 0x4BFB, { 0x90, 0x9A, 0xCA, 0x72, 0xA6, 0xEA, 0xE8, 0x89 } }, \
+  { 0x7D916D80, 0x5BB1, 0x458C, { 0xA4, 0x8F, 0xE2, 0x5F, 0xDD, 0x51, 0xEF, 0x94 } }, \
+  { 0xB2DEDC91, 0xD59F, 0x48D2, { 0x89, 0x8A, 0x12, 0x49, 0x0C, 0x74, 0xA4, 0xE0 } }, \
+  { 0xE58809F8, 0xFBC1, 0x48E2, { 0x88, 0x3A, 0xA3, 0x0F, 0xDC, 0x4B, 0x44, 0x1E } }, \
+  { 0x2A46715F, 0x3581, 0x4A55, { 0x8E, 0x73, 0x2B, 0x76, 0x9A, 0xAA, 0x30, 0xC5 } }, \
+  { 0x4E28CA50, 0xD582, 0x44AC, { 0xA1, 0x1F, 0xE3, 0xD5, 0x65, 0x26, 0xDB, 0x34 } }, \
+  { 0x6B9FD3F7, 0x16DF, 0x45E8, { 0xBD, 0x39, 0xB9, 0x4A, 0x66, 0x54, 0x1A, 0x5D } }, \
+  { 0x49174342, 0x7108, 0x409B, { 0x8B, 0xBE, 0x65, 0xFD, 0xA8, 0x53, 0x89, 0xF5 } }, \
+  { 0xC7D35798, 0xE4D2, 0x4A93, { 0xB1, 0x45, 0x54, 0x88, 0x9F, 0x02, 0x58, 0x4B } }, \
+  { 0x94440339, 0xCC93, 0x4506, { 0xB4, 0xC6, 0xEE, 0x8D, 0x0F, 0x4C, 0xA1, 0x91 } }, \
+  { 0xEAEE5615, 0x0CFD, 0x45FC, { 0x87, 0x69, 0xA0, 0xD8, 0x56, 0x95, 0xAF, 0x85 } }, \
+  { 0xC5F25542, 0x2A79, 0x4A26, { 0x81, 0xBB, 0x4E, 0xA6, 0x32, 0x33, 0xB3, 0x09 } }, \
+  { 0xB20005B0, 0xBB2D, 0x496F, { 0x86, 0x9C, 0x23, 0x0B, 0x44, 0x79, 0xE7, 0xD1 } }, \
+  { 0x1DD1D619, 0xF9B8, 0x463E, { 0x86, 0x81, 0xD1, 0xDC, 0x7C, 0x07, 0xB7, 0x2C } }, \
+  { 0x2EA77912, 0x80A8, 0x4947, { 0xBE, 0x69, 0xCD, 0xD0, 0x0A, 0xFB, 0xE5, 0x56 } }, \
+  { 0xA8CDA0A2, 0x4F37, 0x4A1B, { 0x8E, 0x10, 0x8E, 0xF3, 0xCC, 0x3B, 0xF3, 0xA8 } }, \
+  { 0xB1BE0BC5, 0x6C28, 0x442D, { 0xAA, 0x37, 0x15, 0x1B, 0x42, 0x57, 0xBD, 0x78 } }, \
+  { 0xF0966B41, 0xC23F, 0x41B9, { 0x96, 0x04, 0x0F, 0xF7, 0xE1, 0x11, 0x96, 0x5A } }, \
+  { 0x3B387BFD, 0x7ABC, 0x4CF2, { 0xA0, 0xCA, 0xB6, 0xA1, 0x6C, 0x1B, 0x1B, 0x25 } }, \
+  { 0x96F5296D, 0x05F7, 0x4F3C, { 0x84, 0x67, 0xE4, 0x56, 0x89, 0x0E, 0x0C, 0xB5 } }, \
+  { 0x8F9D4825, 0x797D, 0x48FC, { 0x84, 0x71, 0x84, 0x50, 0x25, 0x79, 0x2E, 0xF6 } }, \
+  { 0x5CB5C776, 0x60D5, 0x45EE, { 0x88, 0x3C, 0x45, 0x27, 0x08, 0xCD, 0x74, 0x3F } }, \
+  { 0xF05976EF, 0x83F1, 0x4F3D, { 0x86, 0x19, 0xF7, 0x59, 0x5D, 0x41, 0xE5, 0x38 } }, \
+  { 0x0CC252D2, 0xC106, 0x4661, { 0xB5, 0xBD, 0x31, 0x47, 0xA4, 0xF8, 0x1F, 0x92 } }, \
+  { 0x309DE7F1, 0x7F5E, 0x4ACE, { 0xB4, 0x9C, 0x53, 0x1B, 0xE5, 0xAA, 0x95, 0xEF } }, \
+  { 0x577D959C, 0xE967, 0x4546, { 0x86, 0x20, 0xC7, 0x78, 0xFA, 0xE5, 0xDA, 0x05 } }, \
+  { 0x480F8AE9, 0x0C46, 0x4AA9, { 0xBC, 0x89, 0xDB, 0x9F, 0xBA, 0x61, 0x98, 0x06 } }, \
+  { 0x3EBD9E82, 0x2C78, 0x4DE6, { 0x97, 0x86, 0x8D, 0x4B, 0xFC, 0xB7, 0xC8, 0x81 } }, \
+  { 0x3868FC3B, 0x7E45, 0x43A7, { 0x90, 0x6C, 0x4B, 0xA4, 0x7D, 0xE1, 0x75, 0x4D } }, \
+  { 0x1259F60D, 0xB754, 0x468E, { 0xA7, 0x89, 0x4D, 0xB8, 0x5D, 0x55, 0xE8, 0x7E } }, \
+  { 0x67C4F112, 0x3385, 0x4E55, { 0x9C, 0x5B, 0xC0, 0x5B, 0x71, 0x7C, 0x42, 0x28 } }, \
+  { 0xED32D533, 0x99E6, 0x4209, { 0x9C, 0xC0, 0x2D, 0x72, 0xCD, 0xD9, 0x98, 0xA7 } }, \
+  { 0xCD3D0A05, 0x9E24, 0x437C, { 0xA8, 0x91, 0x1E, 0xE0, 0x53, 0xDB, 0x76, 0x38 } }, \
+  { 0xAF23B340, 0x97B4, 0x4685, { 0x8D, 0x4F, 0xA3, 0xF2, 0x81, 0x69, 0xB2, 0x1D } }, \
+  { 0xB0D8F3C1, 0xB7DE, 0x4C11, { 0xBC, 0x89, 0x2F, 0xB5, 0x62, 0xC8, 0xC4, 0x11 } }, \
+  { 0xD326D041, 0xBD31, 0x4C01, { 0xB5, 0xA8, 0x62, 0x8B, 0xE8, 0x7F, 0x06, 0x53 } }, \
+  { 0x4C8A2451, 0xC207, 0x405B, { 0x96, 0x94, 0x99, 0xEA, 0x13, 0x25, 0x13, 0x41 } }, \
+  { 0xBD445D79, 0xB7AD, 0x4F04, { 0x9A, 0xD8, 0x29, 0xBD, 0x20, 0x40, 0xEB, 0x3C } }, \
+  { 0x1F73B18D, 0x4630, 0x43C1, { 0xA1, 0xDE, 0x6F, 0x80, 0x85, 0x5D, 0x7D, 0xA4 } }, \
+  { 0xAAEACCFD, 0xF27B, 0x4C17, { 0xB6, 0x10, 0x75, 0xCA, 0x1F, 0x2D, 0xFB, 0x52 } }, \
+  { 0x2A72D11E, 0x7376, 0x40F6, { 0x9C, 0x68, 0x23, 0xFA, 0x2F, 0xE3, 0x63, 0xF1 } }, \
+  { 0xCDEA2BD3, 0xFC25, 0x4C1C, { 0xB9, 0x7C, 0xB3, 0x11, 0x86, 0x06, 0x49, 0x90 } }, \
+  { 0x4B5DC1DF, 0x1EAA, 0x48B2, { 0xA7, 0xE9, 0xEA, 0xC4, 0x89, 0xA0, 0x0B, 0x5C } }, \
+  { 0x9BBE29E9, 0xFDA1, 0x41EC, { 0xAD, 0x52, 0x45, 0x22, 0x13, 0x74, 0x2D, 0x2E } }, \
+  { 0xA770C357, 0xB693, 0x4E6D, { 0xA6, 0xCF, 0xD2, 0x1C, 0x72, 0x8E, 0x55, 0x0B } }, \
+  { 0xEBC01AF5, 0x07A9, 0x489E, { 0xB7, 0xCE, 0xDC, 0x08, 0x9E, 0x45, 0x9B, 0x2F } }, \
+  { 0xA340C064, 0x723C, 0x4A9C, { 0xA4, 0xDD, 0xD5, 0xB4, 0x7A, 0x26, 0xFB, 0xB0 } }, \
+  { 0x296EB418, 0xC4C8, 0x4E05, { 0xAB, 0x59, 0x39, 0xE8, 0xAF, 0x56, 0xF0, 0x0A } }, \
+  { 0x85A8AB57, 0x0644, 0x4110, { 0x85, 0x0F, 0x98, 0x13, 0x22, 0x04, 0x70, 0x70 } }, \
+  { 0x6E057ECF, 0xFA99, 0x4F39, { 0x95, 0xBC, 0x59, 0xF9, 0x92, 0x1D, 0x17, 0xE4 } }, \
+  { 0x53CD299F, 0x2BC1, 0x40C0, { 0x8C, 0x07, 0x23, 0xF6, 0x4F, 0xDB, 0x30, 0xE0 } }, \
+  { 0x2C03C536, 0x4594, 0x4515, { 0x9E, 0x7A, 0xD3, 0xD2, 0x04, 0xFE, 0x13, 0x63 } }, \
+  { 0xDBC6381F, 0x5554, 0x4D14, { 0x8F, 0xFD, 0x76, 0xD7, 0x87, 0xB8, 0xAC, 0xBF } }, \
+  { 0x5169AF60, 0x8C5A, 0x4243, { 0xB3, 0xE9, 0x56, 0xC5, 0x6D, 0x18, 0xEE, 0x26 } }, \
+  { 0x4DF19259, 0xDC71, 0x4D46, { 0xBE, 0xF1, 0x35, 0x7B, 0xB5, 0x78, 0xC4, 0x18 } }, \
+  { 0x0D51905B, 0xB77E, 0x452A, { 0xA2, 0xC0, 0xEC, 0xA0, 0xCC, 0x8D, 0x51, 0x4A } }, \
+  { 0x4E939DE9, 0xD948, 0x4B0F, { 0x88, 0xED, 0xE6, 0xE1, 0xCE, 0x51, 0x7C, 0x1E } }, \
+  { 0x69B792EA, 0x39CE, 0x402D, { 0xA2, 0xA6, 0xF7, 0x21, 0xDE, 0x35, 0x1D, 0xFE } }, \
+  { 0x695D7835, 0x8D47, 0x4C11, { 0xAB, 0x22, 0xFA, 0x8A, 0xCC, 0xE7, 0xAE, 0x7A } }, \
+  { 0x2DF6BA0B, 0x7092, 0x440D, { 0xBD, 0x04, 0xFB, 0x09, 0x1E, 0xC3, 0xF3, 0xC1 } }, \
+  { 0x1849BDA2, 0x6952, 0x4E86, { 0xA1, 0xDB, 0x55, 0x9A, 0x3C, 0x47, 0x9D, 0xF1 } }, \
+  { 0x8BE4DF61, 0x93CA, 0x11D2, { 0xAA, 0x0D, 0x00, 0xE0, 0x98, 0x03, 0x2B, 0x8C } }, \
+  { 0x7BAEC70B, 0x57E0, 0x4C76, { 0x8E, 0x87, 0x2F, 0x9E, 0x28, 0x08, 0x83, 0x43 } }, \
+  { 0xDFA66065, 0xB419, 0x11D3, { 0x9A, 0x2D, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xE0C14753, 0xF9BE, 0x11D2, { 0x9A, 0x0C, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xAD15A0D6, 0x8BEC, 0x4ACF, { 0xA0, 0x73, 0xD0, 0x1D, 0xE7, 0x7E, 0x2D, 0x88 } }, \
+  { 0x37499A9D, 0x542F, 0x4C89, { 0xA0, 0x26, 0x35, 0xDA, 0x14, 0x20, 0x94, 0xE4 } }, \
+  { 0xD487DDB4, 0x008B, 0x11D9, { 0xAF, 0xDC, 0x00, 0x10, 0x83, 0xFF, 0xCA, 0x4D } }, \
+  { 0x024DEE41, 0x33E7, 0x11D3, { 0x9D, 0x69, 0x00, 0x08, 0xC7, 0x81, 0xF3, 0x9F } }, \
+  { 0xC12A7328, 0xF81F, 0x11D2, { 0xBA, 0x4B, 0x00, 0xA0, 0xC9, 0x3E, 0xC9, 0x3B } }, \
+  { 0x49152E77, 0x1ADA, 0x4764, { 0xB7, 0xA2, 0x7A, 0xFE, 0xFE, 0xD9, 0x5E, 0x8B } }, \
+  { 0x8868E871, 0xE4F1, 0x11D3, { 0xBC, 0x22, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0xEB9D2D30, 0x2D88, 0x11D3, { 0x9A, 0x16, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xEB9D2D31, 0x2D88, 0x11D3, { 0x9A, 0x16, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xEB9D2D2F, 0x2D88, 0x11D3, { 0x9A, 0x16, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xEB9D2D32, 0x2D88, 0x11D3, { 0x9A, 0x16, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xC280C73E, 0x15CA, 0x11DA, { 0xB0, 0xCA, 0x00, 0x10, 0x83, 0xFF, 0xCA, 0x4D } }, \
+  { 0xD6062B50, 0x15CA, 0x11DA, { 0x92, 0x19, 0x00, 0x10, 0x83, 0xFF, 0xCA, 0x4D } }, \
+  { 0xDB47D7D3, 0xFE81, 0x11D3, { 0x9A, 0x35, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x09576E93, 0x6D3F, 0x11D2, { 0x8E, 0x39, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x09576E92, 0x6D3F, 0x11D2, { 0x8E, 0x39, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0xEDD35E31, 0x07B9, 0x11D2, { 0x83, 0xA3, 0x00, 0xA0, 0xC9, 0x1F, 0xAD, 0xCF } }, \
+  { 0x345ECC0E, 0x0CB6, 0x4B75, { 0xBB, 0x57, 0x1B, 0x12, 0x9C, 0x47, 0x33, 0x3E } }, \
+  { 0x14982A4F, 0xB0ED, 0x45B8, { 0xA8, 0x11, 0x5A, 0x7A, 0x9B, 0xC2, 0x32, 0xDF } }, \
+  { 0x0AF7C79C, 0x65B5, 0x4319, { 0xB0, 0xAE, 0x44, 0xEC, 0x48, 0x4E, 0x4A, 0xD7 } }, \
+  { 0xCAA4381E, 0x750C, 0x4770, { 0xB8, 0x70, 0x7A, 0x23, 0xB4, 0xE4, 0x21, 0x30 } }, \
+  { 0xEFA96432, 0xDE33, 0x4DD2, { 0xAE, 0xE6, 0x32, 0x8C, 0x33, 0xDF, 0x77, 0x7A } }, \
+  { 0x51AA59DE, 0xFDF2, 0x4EA3, { 0xBC, 0x63, 0x87, 0x5F, 0xB7, 0x84, 0x2E, 0xE9 } }, \
+  { 0x8DF01A06, 0x9BD5, 0x4BF7, { 0xB0, 0x21, 0xDB, 0x4F, 0xD9, 0xCC, 0xF4, 0x5B } }, \
+  { 0x2AE9D80F, 0x3FB2, 0x4095, { 0xB7, 0xB1, 0xE9, 0x31, 0x57, 0xB9, 0x46, 0xB6 } }, \
+  { 0x7CE88FB3, 0x4BD7, 0x4679, { 0x87, 0xA8, 0xA8, 0xD8, 0xDE, 0xE5, 0x0D, 0x2B } }, \
+  { 0x78BEE926, 0x692F, 0x48FD, { 0x9E, 0xDB, 0x01, 0x42, 0x2E, 0xF0, 0xD7, 0xAB } }, \
+  { 0x13FA7698, 0xC831, 0x49C7, { 0x87, 0xEA, 0x8F, 0x43, 0xFC, 0xC2, 0x51, 0x96 } }, \
+  { 0x27ABF055, 0xB1B8, 0x4C26, { 0x80, 0x48, 0x74, 0x8F, 0x37, 0xBA, 0xA2, 0xDF } }, \
+  { 0xEBA4E8D2, 0x3858, 0x41EC, { 0xA2, 0x81, 0x26, 0x47, 0xBA, 0x96, 0x60, 0xD0 } }, \
+  { 0x93039971, 0x8545, 0x4B04, { 0xB4, 0x5E, 0x32, 0xEB, 0x83, 0x26, 0x04, 0x0E } }, \
+  { 0xF22FC20C, 0x8CF4, 0x45EB, { 0x8E, 0x06, 0xAD, 0x4E, 0x50, 0xB9, 0x5D, 0xD3 } }, \
+  { 0x337F4407, 0x5AEE, 0x4B83, { 0xB2, 0xA7, 0x4E, 0xAD, 0xCA, 0x30, 0x88, 0xCD } }, \
+  { 0x3BD2F4EC, 0xE524, 0x46E4, { 0xA9, 0xD8, 0x51, 0x01, 0x17, 0x42, 0x55, 0x62 } }, \
+  { 0xE20939BE, 0x32D4, 0x41BE, { 0xA1, 0x50, 0x89, 0x7F, 0x85, 0xD4, 0x98, 0x29 } }, \
+  { 0xBB983CCF, 0x151D, 0x40E1, { 0xA0, 0x7B, 0x4A, 0x17, 0xBE, 0x16, 0x82, 0x92 } }, \
+  { 0xA7717414, 0xC616, 0x4977, { 0x94, 0x20, 0x84, 0x47, 0x12, 0xA7, 0x35, 0xBF } }, \
+  { 0x2DCE8BB1, 0xBDD7, 0x450E, { 0xB9, 0xAD, 0x9C, 0xF4, 0xEB, 0xD4, 0xF8, 0x90 } }, \
+  { 0x4E292F96, 0xD843, 0x4A55, { 0xA8, 0xC2, 0xD4, 0x81, 0xF2, 0x7E, 0xBE, 0xEE } }, \
+  { 0xE8F56FFE, 0x919C, 0x4CC5, { 0xBA, 0x88, 0x65, 0xAB, 0xE1, 0x49, 0x13, 0xBB } }, \
+  { 0xCF93C01F, 0x1A16, 0x4DFC, { 0xB8, 0xBC, 0x9C, 0x4D, 0xAF, 0x67, 0xC1, 0x04 } }, \
+  { 0xCC5263E8, 0x9308, 0x454A, { 0x89, 0xD0, 0x34, 0x0B, 0xD3, 0x9B, 0xC9, 0x8E } }, \
+  { 0x5BAD89FF, 0xB7E6, 0x42C9, { 0x81, 0x4A, 0xCF, 0x24, 0x85, 0xD6, 0xE9, 0x8A } }, \
+  { 0x3D61A466, 0xAB40, 0x409A, { 0xA6, 0x98, 0xF3, 0x62, 0xD4, 0x64, 0xB3, 0x8F } }, \
+  { 0x667DD791, 0xC6B3, 0x4C27, { 0x8A, 0x6B, 0x0F, 0x8E, 0x72, 0x2D, 0xEB, 0x41 } }, \
+  { 0x9876CCAD, 0x47B4, 0x4BDB, { 0xB6, 0x5E, 0x16, 0xF1, 0x93, 0xC4, 0xF3, 0xDB } }, \
+  { 0xDC3EA0B0, 0xA144, 0x4797, { 0xB9, 0x5B, 0x53, 0xFA, 0x24, 0x2B, 0x6E, 0x1D } }, \
+  { 0xA5BC1114, 0x6F64, 0x4EDE, { 0xB8, 0x63, 0x3E, 0x83, 0xED, 0x7C, 0x83, 0xB1 } }, \
+  { 0xD995E954, 0xBBC1, 0x430F, { 0xAD, 0x91, 0xB4, 0x4D, 0xCB, 0x3C, 0x6F, 0x35 } }, \
+  { 0x81212A96, 0x09ED, 0x4996, { 0x94, 0x71, 0x8D, 0x72, 0x9C, 0x8E, 0x69, 0xED } }, \
+  { 0xC5753963, 0x3B84, 0x4095, { 0xBF, 0x78, 0xED, 0xDA, 0xD3, 0xF9, 0xC9, 0xDD } }, \
+  { 0xEB5E4685, 0xCA66, 0x4769, { 0xB6, 0xA2, 0x26, 0x06, 0x8B, 0x00, 0x13, 0x26 } }, \
+  { 0x5B51FEF7, 0xC79D, 0x4434, { 0x8F, 0x1B, 0xAA, 0x62, 0xDE, 0x3E, 0x2C, 0x64 } }, \
+  { 0x71761D37, 0x32B2, 0x45CD, { 0xA7, 0xD0, 0xB0, 0xFE, 0xDD, 0x93, 0xE8, 0xCF } }, \
+  { 0x036F84E1, 0x7F37, 0x428C, { 0xA7, 0x9E, 0x57, 0x5F, 0xDF, 0xAA, 0x84, 0xEC } }, \
+  { 0xBAF1E6DE, 0x209E, 0x4ADB, { 0x8D, 0x96, 0xFD, 0x8B, 0x71, 0xF3, 0xF6, 0x83 } }, \
+  { 0x5CF32E68, 0x7660, 0x449B, { 0x80, 0xE6, 0x7E, 0xA3, 0x6E, 0x03, 0xF6, 0xA8 } }, \
+  { 0xF8E5058C, 0xCCB6, 0x4714, { 0xB2, 0x20, 0x3F, 0x7E, 0x3A, 0x64, 0x0B, 0xD1 } }, \
+  { 0x5F03BA33, 0x8C6B, 0x4C24, { 0xAA, 0x2E, 0x14, 0xA2, 0x65, 0x7B, 0xD4, 0x54 } }, \
+  { 0x32CBA21F, 0xF308, 0x4CBC, { 0x9A, 0xB5, 0xF5, 0xA3, 0x69, 0x9F, 0x04, 0x4A } }, \
+  { 0x5917EF16, 0xF723, 0x4BB9, { 0xA6, 0x4B, 0xD8, 0xC5, 0x32, 0xF4, 0xD8, 0xB5 } }, \
+  { 0x8A6B4A83, 0x42FE, 0x45D2, { 0xA2, 0xEF, 0x46, 0xF0, 0x6C, 0x7D, 0x98, 0x52 } }, \
+  { 0x85B75607, 0xF7CE, 0x471E, { 0xB7, 0xE4, 0x2A, 0xEA, 0x5F, 0x72, 0x32, 0xEE } }, \
+  { 0x1DB29AE0, 0x9DCB, 0x43BC, { 0x8D, 0x87, 0x5D, 0xA1, 0x49, 0x64, 0xDD, 0xE2 } }, \
+  { 0xBDB38125, 0x4D63, 0x49F4, { 0x82, 0x12, 0x61, 0xCF, 0x5A, 0x19, 0x0A, 0xF8 } }, \
+  { 0xD719B2CB, 0x3D3A, 0x4596, { 0xA3, 0xBC, 0xDA, 0xD0, 0x0E, 0x67, 0x65, 0x6F } }, \
+  { 0xC1C41626, 0x504C, 0x4092, { 0xAC, 0xA9, 0x41, 0xF9, 0x36, 0x93, 0x43, 0x28 } }, \
+  { 0x3C5766E8, 0x269C, 0x4E34, { 0xAA, 0x14, 0xED, 0x77, 0x6E, 0x85, 0xB3, 0xB6 } }, \
+  { 0xE2B36190, 0x879B, 0x4A3D, { 0xAD, 0x8D, 0xF2, 0xE7, 0xBB, 0xA3, 0x27, 0x84 } }, \
+  { 0x826CA512, 0xCF10, 0x4AC9, { 0xB1, 0x87, 0xBE, 0x01, 0x49, 0x66, 0x31, 0xBD } }, \
+  { 0x67F8444F, 0x8743, 0x48F1, { 0xA3, 0x28, 0x1E, 0xAA, 0xB8, 0x73, 0x60, 0x80 } }, \
+  { 0xA5C059A1, 0x94E4, 0x4AA7, { 0x87, 0xB5, 0xAB, 0x15, 0x5C, 0x2B, 0xF0, 0x72 } }, \
+  { 0xEC8A3D69, 0x6DDF, 0x4108, { 0x94, 0x76, 0x73, 0x37, 0xFC, 0x52, 0x21, 0x36 } }, \
+  { 0xA3B3E6F8, 0xEFCA, 0x4BC1, { 0x88, 0xFB, 0xCB, 0x87, 0x33, 0x9B, 0x25, 0x79 } }, \
+  { 0x70F64793, 0xC323, 0x4261, { 0xAC, 0x2C, 0xD8, 0x76, 0xF2, 0x7C, 0x53, 0x45 } }, \
+  { 0x978FE043, 0xD7AF, 0x422E, { 0x8A, 0x92, 0x2B, 0x48, 0xE4, 0x63, 0xBD, 0xE6 } }, \
+  { 0x43BE0B44, 0x874B, 0x4EAD, { 0xB0, 0x9C, 0x24, 0x1A, 0x4F, 0xBD, 0x7E, 0xB3 } }, \
+  { 0x40093F23, 0x630C, 0x4626, { 0x9C, 0x48, 0x40, 0x37, 0x3B, 0x19, 0xCB, 0xBE } }, \
+  { 0xB9237513, 0x6C44, 0x4411, { 0xA9, 0x90, 0x21, 0xE5, 0x56, 0xE0, 0x5A, 0xDE } }, \
+  { 0x78BE11C4, 0xEE44, 0x4A22, { 0x9F, 0x05, 0x03, 0x85, 0x2E, 0xC5, 0xC9, 0x78 } }, \
+  { 0xF7AD60F8, 0xEFA8, 0x44A3, { 0x91, 0x13, 0x23, 0x1F, 0x39, 0x9E, 0xB4, 0xC7 } }, \
+  { 0xD1C17AA1, 0xCAC5, 0x400F, { 0xBE, 0x17, 0xE2, 0xA2, 0xAE, 0x06, 0x67, 0x7C } }, \
+  { 0x3FA4F847, 0xD8EB, 0x4DF4, { 0xBD, 0x49, 0x10, 0x3A, 0x0A, 0x84, 0x7B, 0xBC } }, \
+  { 0xDCBC3662, 0x9CDA, 0x4B52, { 0xA0, 0x4C, 0x82, 0xEB, 0x1D, 0x23, 0x48, 0xC7 } }, \
+  { 0x1C178237, 0x6897, 0x459E, { 0x9D, 0x36, 0x67, 0xCE, 0x8E, 0xF9, 0x4F, 0x76 } }, \
+  { 0x453C5E5A, 0x482D, 0x43F0, { 0x87, 0xC9, 0x59, 0x41, 0xF3, 0xA3, 0x8A, 0xC2 } }, \
+  { 0x6BB4F5CD, 0x8022, 0x448D, { 0xBC, 0x6D, 0x77, 0x1B, 0xAE, 0x93, 0x5F, 0xC6 } }, \
+  { 0x2F240E12, 0xE14D, 0x475C, { 0x83, 0xB0, 0xEF, 0xFF, 0x22, 0xD7, 0x7B, 0xE7 } }, \
+  { 0x4776E33F, 0xDB47, 0x479A, { 0xA2, 0x5F, 0xA1, 0xCD, 0x0A, 0xFA, 0xB3, 0x8B } }, \
+  { 0xDC7E8613, 0xC4BB, 0x4DB0, { 0x84, 0x62, 0x13, 0x51, 0x13, 0x57, 0xAB, 0xE2 } }, \
+  { 0xA0E8EE6A, 0x0E92, 0x44D4, { 0x86, 0x1B, 0x0E, 0xAA, 0x4A, 0xCA, 0x44, 0xA2 } }, \
+  { 0xD7E69789, 0x1F68, 0x45E8, { 0x96, 0xEF, 0x3B, 0x64, 0x07, 0xA5, 0xB2, 0xDC } }, \
+  { 0x56417BED, 0x6BBE, 0x4882, { 0x86, 0xA0, 0x3A, 0xE8, 0xBB, 0x17, 0xF8, 0xF9 } }, \
+  { 0xF66447D4, 0x75A6, 0x463E, { 0xA8, 0x19, 0x07, 0x7F, 0x2D, 0xDA, 0x05, 0xE9 } }, \
+  { 0xA477AF13, 0x877D, 0x4060, { 0xBA, 0xA1, 0x25, 0xD1, 0xBE, 0xA0, 0x8A, 0xD3 } }, \
+  { 0x4E1356C2, 0x0EED, 0x463F, { 0x81, 0x47, 0x99, 0x33, 0xAB, 0xDB, 0xC7, 0xD5 } }, \
+  { 0x0B6E5233, 0xA65C, 0x44C9, { 0x94, 0x07, 0xD9, 0xAB, 0x83, 0xBF, 0xC8, 0xBD } }, \
+  { 0xFF3E5307, 0x9FD0, 0x48C9, { 0x85, 0xF1, 0x8A, 0xD5, 0x6C, 0x70, 0x1E, 0x01 } }, \
+  { 0x093E0FAE, 0xA6C4, 0x4F50, { 0x9F, 0x1B, 0xD4, 0x1E, 0x2B, 0x89, 0xC1, 0x9A } }, \
+  { 0x4AAFD29D, 0x68DF, 0x49EE, { 0x8A, 0xA9, 0x34, 0x7D, 0x37, 0x56, 0x65, 0xA7 } }, \
+  { 0x24C5DC2F, 0x53E2, 0x40CA, { 0x9E, 0xD6, 0xA5, 0xD9, 0xA4, 0x9F, 0x46, 0x3B } }, \
+  { 0x8628752A, 0x6CB7, 0x4814, { 0x96, 0xFC, 0x24, 0xA8, 0x15, 0xAC, 0x22, 0x26 } }, \
+  { 0x6DCBD5ED, 0xE82D, 0x4C44, { 0xBD, 0xA1, 0x71, 0x94, 0x19, 0x9A, 0xD9, 0x2A } }, \
+  { 0x3BD2A492, 0x96C0, 0x4079, { 0xB4, 0x20, 0xFC, 0xF9, 0x8E, 0xF1, 0x03, 0xED } }, \
+  { 0x7076876E, 0x80C2, 0x4EE6, { 0xAA, 0xD2, 0x28, 0xB3, 0x49, 0xA6, 0x86, 0x5B } }, \
+  { 0x446DBF63, 0x2502, 0x4CDA, { 0xBC, 0xFA, 0x24, 0x65, 0xD2, 0xB0, 0xFE, 0x9D } }, \
+  { 0xA7AF67CB, 0x603B, 0x4D42, { 0xBA, 0x21, 0x70, 0xBF, 0xB6, 0x29, 0x3F, 0x96 } }, \
+  { 0xC5149B43, 0xAE85, 0x4F53, { 0x99, 0x82, 0xB9, 0x43, 0x35, 0xD3, 0xA9, 0xE7 } }, \
+  { 0x44F0DE6E, 0x4D8C, 0x4045, { 0xA8, 0xC7, 0x4D, 0xD1, 0x68, 0x85, 0x6B, 0x9E } }, \
+  { 0x63C4785A, 0xCA34, 0x4012, { 0xA3, 0xC8, 0x0B, 0x6A, 0x32, 0x4F, 0x55, 0x46 } }, \
+  { 0xACD03321, 0x777E, 0x4D3D, { 0xB1, 0xC8, 0x20, 0xCF, 0xD8, 0x88, 0x20, 0xC9 } }, \
+  { 0xE43176D7, 0xB6E8, 0x4827, { 0xB7, 0x84, 0x7F, 0xFD, 0xC4, 0xB6, 0x85, 0x61 } }, \
+  { 0xD7C74207, 0xA831, 0x4A26, { 0xB1, 0xF5, 0xD1, 0x93, 0x06, 0x5C, 0xE8, 0xB6 } }, \
+  { 0x1FBD2960, 0x4130, 0x41E5, { 0x94, 0xAC, 0xD2, 0xCF, 0x03, 0x7F, 0xB3, 0x7C } }, \
+  { 0x114DA5EF, 0x2CF1, 0x4E12, { 0x9B, 0xBB, 0xC4, 0x70, 0xB5, 0x52, 0x05, 0xD9 } }, \
+  { 0x39B68C46, 0xF7FB, 0x441B, { 0xB6, 0xEC, 0x16, 0xB0, 0xF6, 0x98, 0x21, 0xF3 } }, \
+  { 0x880AACA3, 0x4ADC, 0x4A04, { 0x90, 0x79, 0xB7, 0x47, 0x34, 0x08, 0x25, 0xE5 } }, \
+  { 0xB122A263, 0x3661, 0x4F68, { 0x99, 0x29, 0x78, 0xF8, 0xB0, 0xD6, 0x21, 0x80 } }, \
+  { 0x4BD56BE3, 0x4975, 0x4D8A, { 0xA0, 0xAD, 0xC4, 0x91, 0x20, 0x4B, 0x5D, 0x4D } }, \
+  { 0x5F05B20F, 0x4A56, 0xC231, { 0xFA, 0x0B, 0xA7, 0xB1, 0xF1, 0x10, 0x04, 0x1D } }, \
+  { 0x9A473A4A, 0x4CEB, 0xB95A, { 0x41, 0x5E, 0x5B, 0xA0, 0xBC, 0x63, 0x9B, 0x2E } }, \
+  { 0x63E60A51, 0x497D, 0xD427, { 0xC4, 0xA5, 0xB8, 0xAB, 0xDC, 0x3A, 0xAE, 0xB6 } }, \
+  { 0x61EC04FC, 0x48E6, 0xD813, { 0x25, 0xC9, 0x8D, 0xAA, 0x44, 0x75, 0x0B, 0x12 } }, \
+  { 0x2F87BA6A, 0x5C04, 0x4385, { 0xA7, 0x80, 0xF3, 0xBF, 0x78, 0xA9, 0x7B, 0xEC } }, \
+  { 0x689E4C62, 0x70BF, 0x4CF3, { 0x88, 0xBB, 0x33, 0xB3, 0x18, 0x26, 0x86, 0x70 } }, \
+  { 0x9317EC24, 0x7CB0, 0x4D0E, { 0x8B, 0x32, 0x2E, 0xD9, 0x20, 0x9C, 0xD8, 0xAF } }, \
+  { 0x7B2349E0, 0x522D, 0x4F8E, { 0xB9, 0x27, 0x69, 0xD9, 0x7C, 0x9E, 0x79, 0x5F } }, \
+  { 0x3629DDB1, 0x228C, 0x452E, { 0xB6, 0x16, 0x09, 0xED, 0x31, 0x6A, 0x97, 0x00 } }, \
+  { 0xE1C1D0A9, 0x40B1, 0x4632, { 0xBD, 0xCC, 0xD9, 0xD6, 0xE5, 0x29, 0x56, 0x31 } }, \
+  { 0xC1E63AC4, 0xD0CF, 0x4CE6, { 0x83, 0x5B, 0xEE, 0xD0, 0xE6, 0xA8, 0xA4, 0x5B } }, \
+  { 0xF2FD1544, 0x9794, 0x4A2C, { 0x99, 0x2E, 0xE5, 0xBB, 0xCF, 0x20, 0xE3, 0x94 } }, \
+  { 0xCAB0E94C, 0xE15F, 0x11E3, { 0x91, 0x8D, 0xB8, 0xE8, 0x56, 0x2C, 0xBA, 0xFA } }, \
+  { 0xD04159DC, 0xE15F, 0x11E3, { 0xB2, 0x61, 0xB8, 0xE8, 0x56, 0x2C, 0xBA, 0xFA } }, \
+  { 0x113B2126, 0xFC8A, 0x11E3, { 0xBD, 0x6C, 0xB8, 0xE8, 0x56, 0x2C, 0xBA, 0xFA } }, \
+  { 0x77AB535A, 0x45FC, 0x624B, { 0x55, 0x60, 0xF7, 0xB2, 0x81, 0xD1, 0xF9, 0x6E } }, \
+  { 0x3D5ABD30, 0x4175, 0x87CE, { 0x6D, 0x64, 0xD2, 0xAD, 0xE5, 0x23, 0xC4, 0xBB } }, \
+  { 0x5CEA02C9, 0x4D07, 0x69D3, { 0x26, 0x9F, 0x44, 0x96, 0xFB, 0xE0, 0x96, 0xF9 } }, \
+  { 0x08018188, 0x42CD, 0xBB48, { 0x10, 0x0F, 0x53, 0x87, 0xD5, 0x3D, 0xED, 0x3D } }, \
+  { 0xDCFA911D, 0x26EB, 0x469F, { 0xA2, 0x20, 0x38, 0xB7, 0xDC, 0x46, 0x12, 0x20 } }, \
+  { 0xE19E3D16, 0xBC11, 0x11E4, { 0x9C, 0xAA, 0xC2, 0x05, 0x1D, 0x5D, 0x46, 0xB0 } }, \
+  { 0xEFEFD093, 0x0D9B, 0x46EB, { 0xA8, 0x56, 0x48, 0x35, 0x07, 0x00, 0xC9, 0x08 } }, \
+  { 0xAF060190, 0x5E3A, 0x4025, { 0xAF, 0xBD, 0xE1, 0xF9, 0x05, 0xBF, 0xAA, 0x4C } }, \
+  { 0x18633BFC, 0x1735, 0x4217, { 0x8A, 0xC9, 0x17, 0x23, 0x92, 0x82, 0xD3, 0xF8 } }, \
+  { 0xFC510EE7, 0xFFDC, 0x11D4, { 0xBD, 0x41, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x8C8CE578, 0x8A3D, 0x4F1C, { 0x99, 0x35, 0x89, 0x61, 0x85, 0xC3, 0x2D, 0xD3 } }, \
+  { 0x1BA0062E, 0xC779, 0x4582, { 0x85, 0x66, 0x33, 0x6A, 0xE8, 0xF7, 0x8F, 0x09 } }, \
+  { 0xF8E21975, 0x0899, 0x4F58, { 0xA4, 0xBE, 0x55, 0x25, 0xA9, 0xC6, 0xD7, 0x7A } }, \
+  { 0x4ED4BF27, 0x4092, 0x42E9, { 0x80, 0x7D, 0x52, 0x7B, 0x1D, 0x00, 0xC9, 0xBD } }, \
+  { 0x564B33CD, 0xC92A, 0x4593, { 0x90, 0xBF, 0x24, 0x73, 0xE4, 0x3C, 0x63, 0x22 } }, \
+  { 0x2A571201, 0x4966, 0x47F6, { 0x8B, 0x86, 0xF3, 0x1E, 0x41, 0xF3, 0x2F, 0x10 } }, \
+  { 0x7739F24C, 0x93D7, 0x11D4, { 0x9A, 0x3A, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x05AD34BA, 0x6F02, 0x4214, { 0x95, 0x2E, 0x4D, 0xA0, 0x39, 0x8E, 0x2B, 0xB9 } }, \
+  { 0x414E6BDD, 0xE47B, 0x47CC, { 0xB2, 0x44, 0xBB, 0x61, 0x02, 0x0C, 0xF5, 0x16 } }, \
+  { 0x7081E22F, 0xCAC6, 0x4053, { 0x94, 0x68, 0x67, 0x57, 0x82, 0xCF, 0x88, 0xE5 } }, \
+  { 0x5E948FE3, 0x26D3, 0x42B5, { 0xAF, 0x17, 0x61, 0x02, 0x87, 0x18, 0x8D, 0xEC } }, \
+  { 0x08F74BAA, 0xEA36, 0x41D9, { 0x95, 0x21, 0x21, 0xA7, 0x0F, 0x87, 0x80, 0xBC } }, \
+  { 0xCB871572, 0xC11A, 0x47B5, { 0xB4, 0x92, 0x67, 0x5E, 0xAF, 0xA7, 0x77, 0x27 } }, \
+  { 0x9E498932, 0x4ABC, 0x45AF, { 0xA3, 0x4D, 0x02, 0x47, 0x78, 0x7B, 0xE7, 0xC6 } }, \
+  { 0x92D11080, 0x496F, 0x4D95, { 0xBE, 0x7E, 0x03, 0x74, 0x88, 0x38, 0x2B, 0x0A } }, \
+  { 0x335984BD, 0xE805, 0x409A, { 0xB8, 0xF8, 0xD2, 0x7E, 0xCE, 0x5F, 0xF7, 0xA6 } }, \
+  { 0x5473C07A, 0x3DCB, 0x4DCA, { 0xBD, 0x6F, 0x1E, 0x96, 0x89, 0xE7, 0x34, 0x9A } }, \
+  { 0x02CE967A, 0xDD7E, 0x4FFC, { 0x9E, 0xE7, 0x81, 0x0C, 0xF0, 0x47, 0x08, 0x80 } }, \
+  { 0x0F9D89E8, 0x9259, 0x4F76, { 0xA5, 0xAF, 0x0C, 0x89, 0xE3, 0x40, 0x23, 0xDF } }, \
+  { 0x996EC11C, 0x5397, 0x4E73, { 0xB5, 0x8F, 0x82, 0x7E, 0x52, 0x90, 0x6D, 0xEF } }, \
+  { 0x6BE272C7, 0x1320, 0x4CCD, { 0x90, 0x17, 0xD4, 0x61, 0x2C, 0x01, 0x2B, 0x25 } }, \
+  { 0x3AB14680, 0x5D3F, 0x4A4D, { 0xBC, 0xDC, 0xCC, 0x38, 0x00, 0x18, 0xC7, 0xF7 } }, \
+  { 0x39F62CCE, 0x6825, 0x4669, { 0xBB, 0x56, 0x54, 0x1A, 0xBA, 0x75, 0x3A, 0x07 } }, \
+  { 0x4B3029CC, 0x6B98, 0x47FB, { 0xBC, 0x96, 0x76, 0xDC, 0xB8, 0x04, 0x41, 0xF0 } }, \
+  { 0xE5CB2AC9, 0xD35D, 0x4430, { 0x93, 0x6E, 0x1D, 0xE3, 0x32, 0x47, 0x8D, 0xE7 } }, \
+  { 0x8DEEC992, 0xD39C, 0x4A5C, { 0xAB, 0x6B, 0x98, 0x6E, 0x14, 0x24, 0x2B, 0x9D } }, \
+  { 0x3B8C8162, 0x188C, 0x46A4, { 0xAE, 0xC9, 0xBE, 0x43, 0xF1, 0xD6, 0x56, 0x97 } }, \
+  { 0xA55701F5, 0xE3EF, 0x43DE, { 0xAC, 0x72, 0x24, 0x9B, 0x57, 0x3F, 0xAD, 0x2C } }, \
+  { 0xFC06B535, 0x5E1F, 0x4562, { 0x9F, 0x25, 0x0A, 0x3B, 0x9A, 0xDB, 0x63, 0xC3 } }, \
+  { 0x1CF3F8B3, 0xC5B1, 0x49A2, { 0xAA, 0x59, 0x5E, 0xEF, 0x92, 0xFF, 0xA6, 0x3C } }, \
+  { 0x48AB7F57, 0xDC34, 0x4F6C, { 0xA7, 0xD3, 0xB0, 0xB5, 0xB0, 0xA7, 0x43, 0x14 } }, \
+  { 0x11B34006, 0xD85B, 0x4D0A, { 0xA2, 0x90, 0xD5, 0xA5, 0x71, 0x31, 0x0E, 0xF7 } }, \
+  { 0x5BE40F57, 0xFA68, 0x4610, { 0xBB, 0xBF, 0xE9, 0xC5, 0xFC, 0xDA, 0xD3, 0x65 } }, \
+  { 0x665E3FF6, 0x46CC, 0x11D4, { 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x26BACCB1, 0x6F42, 0x11D4, { 0xBC, 0xE7, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x26BACCB2, 0x6F42, 0x11D4, { 0xBC, 0xE7, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x1DA97072, 0xBDDC, 0x4B30, { 0x99, 0xF1, 0x72, 0xA0, 0xB5, 0x6F, 0xFF, 0x2A } }, \
+  { 0x27CFAC87, 0x46CC, 0x11D4, { 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x27CFAC88, 0x46CC, 0x11D4, { 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xB7DFB4E1, 0x052F, 0x449F, { 0x87, 0xBE, 0x98, 0x18, 0xFC, 0x91, 0xB7, 0x33 } }, \
+  { 0xA46423E3, 0x4617, 0x49F1, { 0xB9, 0xFF, 0xD1, 0xBF, 0xA9, 0x11, 0x58, 0x39 } }, \
+  { 0x78E4D245, 0xCD4D, 0x4A05, { 0xA2, 0xBA, 0x47, 0x43, 0xE8, 0x6C, 0xFC, 0xAB } }, \
+  { 0x26BACCB3, 0x6F42, 0x11D4, { 0xBC, 0xE7, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x6441F818, 0x6362, 0x4E44, { 0xB5, 0x70, 0x7D, 0xBA, 0x31, 0xDD, 0x24, 0x53 } }, \
+  { 0x1E5668E2, 0x8481, 0x11D4, { 0xBC, 0xF1, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x665E3FF5, 0x46CC, 0x11D4, { 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xD2B2B828, 0x0826, 0x48A7, { 0xB3, 0xDF, 0x98, 0x3C, 0x00, 0x60, 0x24, 0xF0 } }, \
+  { 0xE49D33ED, 0x513D, 0x4634, { 0xB6, 0x98, 0x6F, 0x55, 0xAA, 0x75, 0x1C, 0x1B } }, \
+  { 0x220E73B6, 0x6BDB, 0x4413, { 0x84, 0x05, 0xB9, 0x74, 0xB1, 0x08, 0x61, 0x9A } }, \
+  { 0x8F644FA9, 0xE850, 0x4DB1, { 0x9C, 0xE2, 0x0B, 0x44, 0x69, 0x8E, 0x8D, 0xA4 } }, \
+  { 0x5053697E, 0x2CBC, 0x4819, { 0x90, 0xD9, 0x05, 0x80, 0xDE, 0xEE, 0x57, 0x54 } }, \
+  { 0x3FDDA605, 0xA76E, 0x4F46, { 0xAD, 0x29, 0x12, 0xF4, 0x53, 0x1B, 0x3D, 0x08 } }, \
+  { 0xCF8034BE, 0x6768, 0x4D8B, { 0xB7, 0x39, 0x7C, 0xCE, 0x68, 0x3A, 0x9F, 0xBE } }, \
+  { 0x07D75280, 0x27D4, 0x4D69, { 0x90, 0xD0, 0x56, 0x43, 0xE2, 0x38, 0xB3, 0x41 } }, \
+  { 0xB5B35764, 0x460C, 0x4A06, { 0x99, 0xFC, 0x77, 0xA1, 0x7C, 0x1B, 0x5C, 0xEB } }, \
+  { 0x30CFE3E7, 0x3DE1, 0x4586, { 0xBE, 0x20, 0xDE, 0xAB, 0xA1, 0xB3, 0xB7, 0x93 } }, \
+  { 0xEB23F55A, 0x7863, 0x4AC2, { 0x8D, 0x3D, 0x95, 0x65, 0x35, 0xDE, 0x03, 0x75 } }, \
+  { 0xAA0E8BC1, 0xDABC, 0x46B0, { 0xA8, 0x44, 0x37, 0xB8, 0x16, 0x9B, 0x2B, 0xEA } }, \
+  { 0x19CB87AB, 0x2CB9, 0x4665, { 0x83, 0x60, 0xDD, 0xCF, 0x60, 0x54, 0xF7, 0x9D } }, \
+  { 0xA1E37052, 0x80D9, 0x4E65, { 0xA3, 0x17, 0x3E, 0x9A, 0x55, 0xC4, 0x3E, 0xC9 } }, \
+  { 0xD432A67F, 0x14DC, 0x484B, { 0xB3, 0xBB, 0x3F, 0x02, 0x91, 0x84, 0x93, 0x27 } }, \
+  { 0x03583FF6, 0xCB36, 0x4940, { 0x94, 0x7E, 0xB9, 0xB3, 0x9F, 0x4A, 0xFA, 0xF7 } }, \
+  { 0xE857CAF6, 0xC046, 0x45DC, { 0xBE, 0x3F, 0xEE, 0x07, 0x65, 0xFB, 0xA8, 0x87 } }, \
+  { 0x320AFE62, 0xE593, 0x49CB, { 0xA9, 0xF1, 0xD4, 0xC2, 0xF4, 0xAF, 0x01, 0x4C } }, \
+  { 0x86212936, 0x0E76, 0x41C8, { 0xA0, 0x3A, 0x2A, 0xF2, 0xFC, 0x1C, 0x39, 0xE2 } }, \
+  { 0x2FF29FA7, 0x5E80, 0x4ED9, { 0xB3, 0x80, 0x01, 0x7D, 0x3C, 0x55, 0x4F, 0xF4 } }, \
+  { 0xEB97088E, 0xCFDF, 0x49C6, { 0xBE, 0x4B, 0xD9, 0x06, 0xA5, 0xB2, 0x0E, 0x86 } }, \
+  { 0x215FDD18, 0xBD50, 0x4FEB, { 0x89, 0x0B, 0x58, 0xCA, 0x0B, 0x47, 0x39, 0xE9 } }, \
+  { 0x3242A9D8, 0xCE70, 0x4AA0, { 0x95, 0x5D, 0x5E, 0x7B, 0x14, 0x0D, 0xE4, 0xD2 } }, \
+  { 0xF4CCBFB7, 0xF6E0, 0x47FD, { 0x9D, 0xD4, 0x10, 0xA8, 0xF1, 0x50, 0xC1, 0x91 } }, \
+  { 0xC2702B74, 0x800C, 0x4131, { 0x87, 0x46, 0x8F, 0xB5, 0xB8, 0x9C, 0xE4, 0xAC } }, \
+  { 0x843DC720, 0xAB1E, 0x42CB, { 0x93, 0x57, 0x8A, 0x00, 0x78, 0xF3, 0x56, 0x1B } }, \
+  { 0x26EEB3DE, 0xB689, 0x492E, { 0x80, 0xF0, 0xBE, 0x8B, 0xD7, 0xDA, 0x4B, 0xA7 } }, \
+  { 0x47B7FA8C, 0xF4BD, 0x4AF6, { 0x82, 0x00, 0x33, 0x30, 0x86, 0xF0, 0xD2, 0xC8 } }, \
+  { 0x60FF8964, 0xE906, 0x41D0, { 0xAF, 0xED, 0xF2, 0x41, 0xE9, 0x74, 0xE0, 0x8E } }, \
+  { 0xC68ED8E2, 0x9DC6, 0x4CBD, { 0x9D, 0x94, 0xDB, 0x65, 0xAC, 0xC5, 0xC3, 0x32 } }, \
+  { 0x6AFD2B77, 0x98C1, 0x4ACD, { 0xA6, 0xF9, 0x8A, 0x94, 0x39, 0xDE, 0x0F, 0xB1 } }, \
+  { 0xEB346B97, 0x975F, 0x4A9F, { 0x8B, 0x22, 0xF8, 0xE9, 0x2B, 0xB3, 0xD5, 0x69 } }, \
+  { 0x8BC1714D, 0xFFCB, 0x41C3, { 0x89, 0xDC, 0x6C, 0x74, 0xD0, 0x6D, 0x98, 0xEA } }, \
+  { 0x18A3C6DC, 0x5EEA, 0x48C8, { 0xA1, 0xC1, 0xB5, 0x33, 0x89, 0xF9, 0x89, 0x99 } }, \
+  { 0x456D2859, 0xA84B, 0x4E47, { 0xA2, 0xEE, 0x32, 0x76, 0xD8, 0x86, 0x99, 0x7D } }, \
+  { 0x4CEC368E, 0x8E8E, 0x4D71, { 0x8B, 0xE1, 0x95, 0x8C, 0x45, 0xFC, 0x8A, 0x53 } }, \
+  { 0xEE9B8D90, 0xC5A6, 0x40A2, { 0xBD, 0xE2, 0x52, 0x55, 0x8D, 0x33, 0xCC, 0xA1 } }, \
+  { 0x25566B03, 0xB577, 0x4CBF, { 0x95, 0x8C, 0xED, 0x66, 0x3E, 0xA2, 0x43, 0x80 } }, \
+  { 0x7300C4A1, 0x43F2, 0x4017, { 0xA5, 0x1B, 0xC8, 0x1A, 0x7F, 0x40, 0x58, 0x5B } }, \
+  { 0x1B1183FA, 0x1823, 0x46A7, { 0x88, 0x72, 0x9C, 0x57, 0x87, 0x55, 0x40, 0x9D } }, \
+  { 0x58DC368D, 0x7BFA, 0x4E77, { 0xAB, 0xBC, 0x0E, 0x29, 0x41, 0x8D, 0xF9, 0x30 } }, \
+  { 0x13A3F0F6, 0x264A, 0x3EF0, { 0xF2, 0xE0, 0xDE, 0xC5, 0x12, 0x34, 0x2F, 0x34 } }, \
+  { 0xAD61F191, 0xAE5F, 0x4C0E, { 0xB9, 0xFA, 0xE8, 0x69, 0xD2, 0x88, 0xC6, 0x4F } }, \
+  { 0x70101EAF, 0x0085, 0x440C, { 0xB3, 0x56, 0x8E, 0xE3, 0x6F, 0xEF, 0x24, 0xF0 } }, \
+  { 0xB60DC6E8, 0x3B6F, 0x11D5, { 0xAF, 0x09, 0x00, 0xA0, 0xC9, 0x44, 0xA0, 0x5B } }, \
+  { 0xDE0EE9A4, 0x3C7A, 0x44F2, { 0xB7, 0x8B, 0xE3, 0xCC, 0xD6, 0x9C, 0x3A, 0xF7 } }, \
+  { 0x5AEA42B5, 0x31E1, 0x4515, { 0xBC, 0x31, 0xB8, 0xD5, 0x25, 0x75, 0x65, 0xA6 } }, \
+  { 0x53A58D06, 0xAC27, 0x4D8C, { 0xB5, 0xE9, 0xF0, 0x8A, 0x80, 0x65, 0x41, 0x70 } }, \
+  { 0x7E97A470, 0xEFDB, 0x4D02, { 0x8F, 0xCE, 0x61, 0x90, 0xD2, 0x7B, 0xA2, 0x96 } }, \
+  { 0x4ECB6C53, 0xC641, 0x4370, { 0x8C, 0xB2, 0x3B, 0x0E, 0x49, 0x6E, 0x83, 0x78 } }, \
+  { 0x899AFD18, 0x75E8, 0x408B, { 0xA4, 0x1A, 0x6E, 0x2E, 0x7E, 0xCD, 0xF4, 0x54 } }, \
+  { 0x7D019990, 0x8CE1, 0x46F5, { 0xA7, 0x76, 0x3C, 0x51, 0x98, 0x67, 0x6A, 0xA0 } }, \
+  { 0x00DBD91D, 0x55E9, 0x420F, { 0x96, 0x39, 0x5E, 0x9F, 0x84, 0x37, 0xB4, 0x4F } }, \
+  { 0xA2271DF1, 0xBCBB, 0x4F1D, { 0x98, 0xA9, 0x06, 0xBC, 0x17, 0x2F, 0x07, 0x1A } }, \
+  { 0x697D81A2, 0xCF18, 0x4DC0, { 0x9E, 0x0D, 0x06, 0x11, 0x3B, 0x61, 0x8A, 0x3F } }, \
+  { 0xE1CD9D21, 0x0FC2, 0x438D, { 0x97, 0x03, 0x04, 0xE6, 0x6D, 0x96, 0x1E, 0x57 } }, \
+  { 0xD9E9FA06, 0x0FE0, 0x41C3, { 0x96, 0xFB, 0x83, 0x42, 0x5A, 0x33, 0x94, 0xF8 } }, \
+  { 0x2A591128, 0x6CC7, 0x42B1, { 0x8A, 0xF0, 0x58, 0x93, 0x3B, 0x68, 0x2D, 0xBB } }, \
+  { 0xA46B1A31, 0xAD66, 0x4905, { 0x92, 0xF6, 0x2B, 0x46, 0x59, 0xDC, 0x30, 0x63 } }, \
+  { 0x0EDC9494, 0x2743, 0x4BA5, { 0x88, 0x18, 0x0A, 0xEF, 0x52, 0x13, 0xF1, 0x88 } }, \
+  { 0xCB3FD86E, 0x38A3, 0x4C03, { 0x9A, 0x5C, 0x90, 0xCF, 0xA3, 0xA2, 0xAB, 0x7A } }, \
+  { 0x94AB2F58, 0x1438, 0x4EF1, { 0x91, 0x52, 0x18, 0x94, 0x1A, 0x3A, 0x0E, 0x68 } }, \
+  { 0x24E70042, 0xD5C5, 0x4260, { 0x8C, 0x39, 0x0A, 0xD3, 0xAA, 0x32, 0xE9, 0x3D } }, \
+  { 0xBCDAF080, 0x1BDE, 0x4E22, { 0xAE, 0x6A, 0x43, 0x54, 0x1E, 0x12, 0x8E, 0xC4 } }, \
+  { 0xFAD7933A, 0x6C21, 0x4234, { 0xA4, 0x34, 0x0A, 0x8A, 0x0D, 0x2B, 0x07, 0x81 } }, \
+  { 0xB91978DF, 0x9FC1, 0x427D, { 0xBB, 0x05, 0x4C, 0x82, 0x84, 0x55, 0xCA, 0x27 } }, \
+  { 0xFD0F4478, 0x0EFD, 0x461D, { 0xBA, 0x2D, 0xE5, 0x8C, 0x45, 0xFD, 0x5F, 0x5E } }, \
+  { 0x578C315A, 0x68CF, 0x4E81, { 0xB5, 0xC6, 0x22, 0xDB, 0x40, 0xD0, 0x10, 0xBC } }, \
+  { 0xB60A3E6B, 0x18C4, 0x46E5, { 0xA2, 0x9A, 0xC9, 0xA1, 0x06, 0x65, 0xA2, 0x8E } }, \
+  { 0xDA8CD7C4, 0x1C00, 0x49E2, { 0x80, 0x3E, 0x52, 0x14, 0xE7, 0x01, 0x89, 0x4C } }, \
+  { 0x70B221AF, 0xFDFF, 0x4FDE, { 0x99, 0x68, 0x1A, 0xF6, 0x23, 0xA9, 0x56, 0xD9 } }, \
+  { 0x75032015, 0xD156, 0x423E, { 0xBF, 0xA3, 0x7A, 0x65, 0xAB, 0xA4, 0x71, 0x05 } }, \
+  { 0x39136FC7, 0x1A11, 0x49DE, { 0xBF, 0x35, 0x0E, 0x78, 0xDD, 0xB5, 0x24, 0xFC } }, \
+  { 0xF01BED57, 0x04BC, 0x4F3F, { 0x96, 0x60, 0xD6, 0xF2, 0xEA, 0x22, 0x82, 0x59 } }, \
+  { 0x62331B78, 0xD8D0, 0x4C8C, { 0x8C, 0xCB, 0xD2, 0x7D, 0xFE, 0x32, 0xDB, 0x9B } }, \
+  { 0x5E3848D4, 0x0DB5, 0x4FC0, { 0x97, 0x29, 0x3F, 0x35, 0x3D, 0x4F, 0x87, 0x9F } }, \
+  { 0x85A6D3E6, 0xB65B, 0x4AFC, { 0xB3, 0x8F, 0xC6, 0xD5, 0x4A, 0xF6, 0xDD, 0xC8 } }, \
+  { 0xC74E5DB2, 0xFA96, 0x4AE2, { 0xB3, 0x99, 0x15, 0x97, 0x7F, 0xE3, 0x00, 0x2D } }, \
+  { 0xB57EC3FE, 0xF833, 0x4BA6, { 0x85, 0x78, 0x2A, 0x7D, 0x6A, 0x87, 0x44, 0x4B } }, \
+  { 0x995C6ECA, 0x171B, 0x45FD, { 0xA3, 0xAA, 0xFD, 0x4C, 0x9C, 0x9D, 0xEF, 0x59 } }, \
+  { 0xE9F02217, 0x2093, 0x4470, { 0x8A, 0x54, 0x5C, 0x2C, 0xFF, 0xE7, 0x3E, 0xCB } }, \
+  { 0xAAB18F19, 0xFE14, 0x4666, { 0x86, 0x04, 0x87, 0xFF, 0x6D, 0x66, 0x2C, 0x9A } }, \
+  { 0x2755590C, 0x6F3C, 0x42FA, { 0x9E, 0xA4, 0xA3, 0xBA, 0x54, 0x3C, 0xDA, 0x25 } }, \
+  { 0xD8117CFE, 0x94A6, 0x11D4, { 0x9A, 0x3A, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xAF6AC311, 0x84C3, 0x11D2, { 0x8E, 0x3C, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x09576E91, 0x6D3F, 0x11D2, { 0x8E, 0x39, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x05C99A21, 0xC70F, 0x4AD2, { 0x8A, 0x5F, 0x35, 0xDF, 0x33, 0x43, 0xF5, 0x1E } }, \
+  { 0x8B843E20, 0x8132, 0x4852, { 0x90, 0xCC, 0x55, 0x1A, 0x4E, 0x4A, 0x7F, 0x1C } }, \
+  { 0x0379BE4E, 0xD706, 0x437D, { 0xB0, 0x37, 0xED, 0xB8, 0x2F, 0xB7, 0x72, 0xA4 } }, \
+  { 0x18A031AB, 0xB443, 0x4D1A, { 0xA5, 0xC0, 0x0C, 0x09, 0x26, 0x1E, 0x9F, 0x71 } }, \
+  { 0x6B30C738, 0xA391, 0x11D4, { 0x9A, 0x3B, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xB1EE129E, 0xDA36, 0x4181, { 0x91, 0xF8, 0x04, 0xA4, 0x92, 0x37, 0x66, 0xA7 } }, \
+  { 0x3BC1B285, 0x8A15, 0x4A82, { 0xAA, 0xBF, 0x4D, 0x7D, 0x13, 0xFB, 0x32, 0x65 } }, \
+  { 0x4D330321, 0x025F, 0x4AAC, { 0x90, 0xD8, 0x5E, 0xD9, 0x00, 0x17, 0x3B, 0x63 } }, \
+  { 0x0784924F, 0xE296, 0x11D4, { 0x9A, 0x49, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x6A7A5CFF, 0xE8D9, 0x4F70, { 0xBA, 0xDA, 0x75, 0xAB, 0x30, 0x25, 0xCE, 0x14 } }, \
+  { 0x107A772C, 0xD5E1, 0x11D4, { 0x9A, 0x46, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xBFD7DC1D, 0x24F1, 0x40D9, { 0x82, 0xE7, 0x2E, 0x09, 0xBB, 0x6B, 0x4E, 0xBE } }, \
+  { 0x107A772B, 0xD5E1, 0x11D4, { 0x9A, 0x46, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x642CD590, 0x8059, 0x4C0A, { 0xA9, 0x58, 0xC5, 0xEC, 0x07, 0xD2, 0x3C, 0x4B } }, \
+  { 0x5C198761, 0x16A8, 0x4E69, { 0x97, 0x2C, 0x89, 0xD6, 0x79, 0x54, 0xF8, 0x1D } }, \
+  { 0x387477C1, 0x69C7, 0x11D2, { 0x8E, 0x39, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0xDD9E7534, 0x7762, 0x4698, { 0x8C, 0x14, 0xF5, 0x85, 0x17, 0xA6, 0x25, 0xAA } }, \
+  { 0x387477C2, 0x69C7, 0x11D2, { 0x8E, 0x39, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x31878C87, 0x0B75, 0x11D5, { 0x9A, 0x4F, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x8D59D32B, 0xC655, 0x4AE9, { 0x9B, 0x15, 0xF2, 0x59, 0x04, 0x99, 0x2A, 0x43 } }, \
+  { 0xBB25CF6F, 0xF1D4, 0x11D2, { 0x9A, 0x0C, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0xFD } }, \
+  { 0x9042A9DE, 0x23DC, 0x4A38, { 0x96, 0xFB, 0x7A, 0xDE, 0xD0, 0x80, 0x51, 0x6A } }, \
+  { 0x1C0C34F6, 0xD380, 0x41FA, { 0xA0, 0x49, 0x8A, 0xD0, 0x6C, 0x1A, 0x66, 0xAA } }, \
+  { 0xBD8C1056, 0x9F36, 0x44EC, { 0x92, 0xA8, 0xA6, 0x33, 0x7F, 0x81, 0x79, 0x86 } }, \
+  { 0x48ECB431, 0xFB72, 0x45C0, { 0xA9, 0x22, 0xF4, 0x58, 0xFE, 0x04, 0x0B, 0xD5 } }, \
+  { 0x61A4D49E, 0x6F68, 0x4F1B, { 0xB9, 0x22, 0xA8, 0x6E, 0xED, 0x0B, 0x07, 0xA2 } }, \
+  { 0x982C298B, 0xF4FA, 0x41CB, { 0xB8, 0x38, 0x77, 0xAA, 0x68, 0x8F, 0xB8, 0x39 } }, \
+  { 0x5B1B31A1, 0x9562, 0x11D2, { 0x8E, 0x3F, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0xBC62157E, 0x3E33, 0x4FEC, { 0x99, 0x20, 0x2D, 0x3B, 0x36, 0xD7, 0x50, 0xDF } }, \
+  { 0x56EC3091, 0x954C, 0x11D2, { 0x8E, 0x3F, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x4006C0C1, 0xFCB3, 0x403E, { 0x99, 0x6D, 0x4A, 0x6C, 0x87, 0x24, 0xE0, 0x6D } }, \
+  { 0x1E93E633, 0xD65A, 0x459E, { 0xAB, 0x84, 0x93, 0xD9, 0xEC, 0x26, 0x6D, 0x18 } }, \
+  { 0xCE345171, 0xBA0B, 0x11D2, { 0x8E, 0x4F, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x964E5B21, 0x6459, 0x11D2, { 0x8E, 0x39, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x1D85CD7F, 0xF43D, 0x11D2, { 0x9A, 0x0C, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xA4C751FC, 0x23AE, 0x4C3E, { 0x92, 0xE9, 0x49, 0x64, 0xCF, 0x63, 0xF3, 0x49 } }, \
+  { 0x2F707EBB, 0x4A1A, 0x11D4, { 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x4CF5B200, 0x68B8, 0x4CA5, { 0x9E, 0xEC, 0xB2, 0x3E, 0x3F, 0x50, 0x02, 0x9A } }, \
+  { 0x932F47E6, 0x2362, 0x4002, { 0x80, 0x3E, 0x3C, 0xD5, 0x4B, 0x13, 0x8F, 0x85 } }, \
+  { 0x143B7632, 0xB81B, 0x4CB7, { 0xAB, 0xD3, 0xB6, 0x25, 0xA5, 0xB9, 0xBF, 0xFE } }, \
+  { 0xA59E8FCF, 0xBDA0, 0x43BB, { 0x90, 0xB1, 0xD3, 0x73, 0x2E, 0xCA, 0xA8, 0x77 } }, \
+  { 0x59324945, 0xEC44, 0x4C0D, { 0xB1, 0xCD, 0x9D, 0xB1, 0x39, 0xDF, 0x07, 0x0C } }, \
+  { 0x3E745226, 0x9818, 0x45B6, { 0xA2, 0xAC, 0xD7, 0xCD, 0x0E, 0x8B, 0xA2, 0xBC } }, \
+  { 0xF5089266, 0x1AA0, 0x4953, { 0x97, 0xD8, 0x56, 0x2F, 0x8A, 0x73, 0xB5, 0x19 } }, \
+  { 0x2B2F68D6, 0x0CD2, 0x44CF, { 0x8E, 0x8B, 0xBB, 0xA2, 0x0B, 0x1B, 0x5B, 0x75 } }, \
+  { 0xFFE06BDD, 0x6107, 0x46A6, { 0x7B, 0xB2, 0x5A, 0x9C, 0x7E, 0xC5, 0x27, 0x5C } }, \
+  { 0x13AC6DD1, 0x73D0, 0x11D4, { 0xB0, 0x6B, 0x00, 0xAA, 0x00, 0xBD, 0x6D, 0xE7 } }, \
+  { 0xA19832B9, 0xAC25, 0x11D3, { 0x9A, 0x2D, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x1ACED566, 0x76ED, 0x4218, { 0xBC, 0x81, 0x76, 0x7F, 0x1F, 0x97, 0x7A, 0x89 } }, \
+  { 0xE18541CD, 0xF755, 0x4F73, { 0x92, 0x8D, 0x64, 0x3C, 0x8A, 0x79, 0xB2, 0x29 } }, \
+  { 0x245DCA21, 0xFB7B, 0x11D3, { 0x8F, 0x01, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x03C4E603, 0xAC28, 0x11D3, { 0x9A, 0x2D, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x0B64AAB0, 0x5429, 0x11D4, { 0x98, 0x16, 0x00, 0xA0, 0xC9, 0x1F, 0xAD, 0xCF } }, \
+  { 0xF36FF770, 0xA7E1, 0x42CF, { 0x9E, 0xD2, 0x56, 0xF0, 0xF2, 0x71, 0xF4, 0x4C } }, \
+  { 0x7AB33A91, 0xACE5, 0x4326, { 0xB5, 0x72, 0xE7, 0xEE, 0x33, 0xD3, 0x9F, 0x16 } }, \
+  { 0xF44C00EE, 0x1F2C, 0x4A00, { 0xAA, 0x09, 0x1C, 0x9F, 0x3E, 0x08, 0x00, 0xA3 } }, \
+  { 0xF4B427BB, 0xBA21, 0x4F16, { 0xBC, 0x4E, 0x43, 0xE4, 0x16, 0xAB, 0x61, 0x9C } }, \
+  { 0x9D9A39D8, 0xBD42, 0x4A73, { 0xA4, 0xD5, 0x8E, 0xE9, 0x4B, 0xE1, 0x13, 0x80 } }, \
+  { 0x8A219718, 0x4EF5, 0x4761, { 0x91, 0xC8, 0xC0, 0xF0, 0x4B, 0xDA, 0x9E, 0x56 } }, \
+  { 0x00720665, 0x67EB, 0x4A99, { 0xBA, 0xF7, 0xD3, 0xC3, 0x3A, 0x1C, 0x7C, 0xC9 } }, \
+  { 0x65530BC7, 0xA359, 0x410F, { 0xB0, 0x10, 0x5A, 0xAD, 0xC7, 0xEC, 0x2B, 0x62 } }, \
+  { 0xC51711E7, 0xB4BF, 0x404A, { 0xBF, 0xB8, 0x0A, 0x04, 0x8E, 0xF1, 0xFF, 0xE4 } }, \
+  { 0x41D94CD2, 0x35B6, 0x455A, { 0x82, 0x58, 0xD4, 0xE5, 0x13, 0x34, 0xAA, 0xDD } }, \
+  { 0x3B95AA31, 0x3793, 0x434B, { 0x86, 0x67, 0xC8, 0x07, 0x08, 0x92, 0xE0, 0x5E } }, \
+  { 0x83F01464, 0x99BD, 0x45E5, { 0xB3, 0x83, 0xAF, 0x63, 0x05, 0xD8, 0xE9, 0xE6 } }, \
+  { 0x3AD9DF29, 0x4501, 0x478D, { 0xB1, 0xF8, 0x7F, 0x7F, 0xE7, 0x0E, 0x50, 0xF3 } }, \
+  { 0x2FE800BE, 0x8F01, 0x4AA6, { 0x94, 0x6B, 0xD7, 0x13, 0x88, 0xE1, 0x83, 0x3F } }, \
+  { 0x78247C57, 0x63DB, 0x4708, { 0x99, 0xC2, 0xA8, 0xB4, 0xA9, 0xA6, 0x1F, 0x6B } }, \
+  { 0x7671D9D0, 0x53DB, 0x4173, { 0xAA, 0x69, 0x23, 0x27, 0xF2, 0x1F, 0x0B, 0xC7 } }, \
+  { 0x42881C98, 0xA4F3, 0x44B0, { 0xA3, 0x9D, 0xDF, 0xA1, 0x86, 0x67, 0xD8, 0xCD } }, \
+  { 0xC5184932, 0xDBA5, 0x46DB, { 0xA5, 0xBA, 0xCC, 0x0B, 0xDA, 0x9C, 0x14, 0x35 } }, \
+  { 0xF541796D, 0xA62E, 0x4954, { 0xA7, 0x75, 0x95, 0x84, 0xF6, 0x1B, 0x9C, 0xDD } }, \
+  { 0x607F766C, 0x7455, 0x42BE, { 0x93, 0x0B, 0xE4, 0xD7, 0x6D, 0xB2, 0x72, 0x0F } }, \
+  { 0x1E2ED096, 0x30E2, 0x4254, { 0xBD, 0x89, 0x86, 0x3B, 0xBE, 0xF8, 0x23, 0x25 } }, \
+  { 0xB9D4C360, 0xBCFB, 0x4F9B, { 0x92, 0x98, 0x53, 0xC1, 0x36, 0x98, 0x22, 0x58 } }, \
+  { 0x0FD96974, 0x23AA, 0x4CDC, { 0xB9, 0xCB, 0x98, 0xD1, 0x77, 0x50, 0x32, 0x2A } }, \
+  { 0x31A6406A, 0x6BDF, 0x4E46, { 0xB2, 0xA2, 0xEB, 0xAA, 0x89, 0xC4, 0x09, 0x20 } }, \
+  { 0x587E72D7, 0xCC50, 0x4F79, { 0x82, 0x09, 0xCA, 0x29, 0x1F, 0xC1, 0xA1, 0x0F } }, \
+  { 0xEF9FC172, 0xA1B2, 0x4693, { 0xB3, 0x27, 0x6D, 0x32, 0xFC, 0x41, 0x60, 0x42 } }, \
+  { 0xE9CA4775, 0x8657, 0x47FC, { 0x97, 0xE7, 0x7E, 0xD6, 0x5A, 0x08, 0x43, 0x24 } }, \
+  { 0x330D4706, 0xF2A0, 0x4E4F, { 0xA3, 0x69, 0xB6, 0x6F, 0xA8, 0xD5, 0x43, 0x85 } }, \
+  { 0x6A1EE763, 0xD47A, 0x43B4, { 0xAA, 0xBE, 0xEF, 0x1D, 0xE2, 0xAB, 0x56, 0xFC } }, \
+  { 0xEC835DD3, 0xFE0F, 0x617B, { 0xA6, 0x21, 0xB3, 0x50, 0xC3, 0xE1, 0x33, 0x88 } }, \
+  { 0x2C8759D5, 0x5C2D, 0x66EF, { 0x92, 0x5F, 0xB6, 0x6C, 0x10, 0x19, 0x57, 0xE2 } }, \
+  { 0x937FE521, 0x95AE, 0x4D1A, { 0x89, 0x29, 0x48, 0xBC, 0xD9, 0x0A, 0xD3, 0x1A } }, \
+  { 0xD9760FF3, 0x3CCA, 0x4267, { 0x80, 0xF9, 0x75, 0x27, 0xFA, 0xFA, 0x42, 0x23 } }, \
+  { 0xBF0A78BA, 0xEC29, 0x49CF, { 0xA1, 0xC9, 0x7A, 0xE5, 0x4E, 0xAB, 0x6A, 0x51 } }, \
+  { 0x9FB9A8A1, 0x2F4A, 0x43A6, { 0x88, 0x9C, 0xD0, 0xF7, 0xB6, 0xC4, 0x7A, 0xD5 } }, \
+  { 0x87C8BAD7, 0x0595, 0x4053, { 0x82, 0x97, 0xDE, 0xDE, 0x39, 0x5F, 0x5D, 0x5B } }, \
+  { 0x66ED4721, 0x3C98, 0x4D3E, { 0x81, 0xE3, 0xD0, 0x3D, 0xD3, 0x9A, 0x72, 0x54 } }, \
+  { 0x4F948815, 0xB4B9, 0x43CB, { 0x8A, 0x33, 0x90, 0xE0, 0x60, 0xB3, 0x49, 0x55 } }, \
+  { 0xEC20EB79, 0x6C1A, 0x4664, { 0x9A, 0x0D, 0xD2, 0xE4, 0xCC, 0x16, 0xD6, 0x64 } }, \
+  { 0x46E44855, 0xBD60, 0x4AB7, { 0xAB, 0x0D, 0xA6, 0x79, 0xB9, 0x44, 0x7D, 0x77 } }, \
+  { 0x9E23D768, 0xD2F3, 0x4366, { 0x9F, 0xC3, 0x3A, 0x7A, 0xBA, 0x86, 0x43, 0x74 } }, \
+  { 0x5D9F96DB, 0xE731, 0x4CAA, { 0xA0, 0x0D, 0x72, 0xE1, 0x87, 0xCD, 0x77, 0x62 } }, \
+  { 0xBB62E663, 0x625D, 0x40B2, { 0xA0, 0x88, 0xBB, 0xE8, 0x36, 0x23, 0xA2, 0x45 } }, \
+  { 0x0FAAECB1, 0x226E, 0x4782, { 0xAA, 0xCE, 0x7D, 0xB9, 0xBC, 0xBF, 0x4D, 0xAF } }, \
+  { 0xEB338826, 0x681B, 0x4295, { 0xB3, 0x56, 0x2B, 0x36, 0x4C, 0x75, 0x7B, 0x09 } }, \
+  { 0xCE5E5929, 0xC7A3, 0x4602, { 0xAD, 0x9E, 0xC9, 0xDA, 0xF9, 0x4E, 0xBF, 0xCF } }, \
+  { 0x2A534210, 0x9280, 0x41D8, { 0xAE, 0x79, 0xCA, 0xDA, 0x01, 0xA2, 0xB1, 0x27 } }, \
+  { 0x15853D7C, 0x3DDF, 0x43E0, { 0xA1, 0xCB, 0xEB, 0xF8, 0x5B, 0x8F, 0x87, 0x2C } }, \
+  { 0x71EE5E94, 0x65B9, 0x45D5, { 0x82, 0x1A, 0x3A, 0x4D, 0x86, 0xCF, 0xE6, 0xBE } }, \
+  { 0x6FD5B00C, 0xD426, 0x4283, { 0x98, 0x87, 0x6C, 0xF5, 0xCF, 0x1C, 0xB1, 0xFE } }, \
+  { 0x1D3DE7F0, 0x0807, 0x424F, { 0xAA, 0x69, 0x11, 0xA5, 0x4E, 0x19, 0xA4, 0x6F } }, \
+  { 0x86C77A67, 0x0B97, 0x4633, { 0xA1, 0x87, 0x49, 0x10, 0x4D, 0x06, 0x85, 0xC7 } }, \
+  { 0xDFB386F7, 0xE100, 0x43AD, { 0x9C, 0x9A, 0xED, 0x90, 0xD0, 0x8A, 0x5E, 0x12 } }, \
+  { 0xA3979E64, 0xACE8, 0x4DDC, { 0xBC, 0x07, 0x4D, 0x66, 0xB8, 0xFD, 0x09, 0x77 } }, \
+  { 0xEC3A978D, 0x7C4E, 0x48FA, { 0x9A, 0xBE, 0x6A, 0xD9, 0x1C, 0xC8, 0xF8, 0x11 } }, \
+  { 0xA77B2472, 0xE282, 0x4E9F, { 0xA2, 0x45, 0xC2, 0xC0, 0xE2, 0x7B, 0xBC, 0xC1 } }, \
+  { 0xC88B0B6D, 0x0DFC, 0x49A7, { 0x9C, 0xB4, 0x49, 0x07, 0x4B, 0x4C, 0x3A, 0x78 } }, \
+  { 0xE98ADB03, 0xB8B9, 0x4AF8, { 0xBA, 0x20, 0x26, 0xE9, 0x11, 0x4C, 0xBC, 0xE5 } }, \
+  { 0x151C8EAE, 0x7F2C, 0x472C, { 0x9E, 0x54, 0x98, 0x28, 0x19, 0x4F, 0x6A, 0x88 } }, \
+  { 0xAFBFDE41, 0x2E6E, 0x4262, { 0xBA, 0x65, 0x62, 0xB9, 0x23, 0x6E, 0x54, 0x95 } }, \
+  { 0x3152BCA5, 0xEADE, 0x433D, { 0x86, 0x2E, 0xC0, 0x1C, 0xDC, 0x29, 0x1F, 0x44 } }, \
+  { 0xE5DD1403, 0xD622, 0xC24E, { 0x84, 0x88, 0xC7, 0x1B, 0x17, 0xF5, 0xE8, 0x02 } }, \
+  { 0x52C78312, 0x8EDC, 0x4233, { 0x98, 0xF2, 0x1A, 0x1A, 0xA5, 0xE3, 0x88, 0xA5 } }, \
+  { 0xDA836F8D, 0x217F, 0x4CA0, { 0x99, 0xC2, 0x1C, 0xA4, 0xE1, 0x60, 0x77, 0xEA } }, \
+  { 0x55B1D734, 0xC5E1, 0x49DB, { 0x96, 0x47, 0xB1, 0x6A, 0xFB, 0x0E, 0x30, 0x5B } }, \
+  { 0xA00490BA, 0x3F1A, 0x4B4C, { 0xAB, 0x90, 0x4F, 0xA9, 0x97, 0x26, 0xA1, 0xE8 } }, \
+  { 0x2A4D1ADF, 0x21DC, 0x4B81, { 0xA4, 0x2F, 0x8B, 0x8E, 0xE2, 0x38, 0x00, 0x60 } }, \
+  { 0xD317F29B, 0xA325, 0x4712, { 0x9B, 0xF1, 0xC6, 0x19, 0x54, 0xDC, 0x19, 0x8C } }, \
+  { 0x32D2963A, 0xFE5D, 0x4F30, { 0xB6, 0x33, 0x6E, 0x5D, 0xC5, 0x58, 0x03, 0xCC } }, \
+  { 0xB3930571, 0xBEBA, 0x4FC5, { 0x92, 0x03, 0x94, 0x27, 0x24, 0x2E, 0x6A, 0x43 } }, \
+  { 0x388278D3, 0x7B85, 0x42F0, { 0xAB, 0xA9, 0xFB, 0x4B, 0xFD, 0x69, 0xF5, 0xAB } }, \
+  { 0x467313DE, 0x4E30, 0x43F1, { 0x94, 0x3E, 0x32, 0x3F, 0x89, 0x84, 0x5D, 0xB5 } }, \
+  { 0x62960CF3, 0x40FF, 0x4263, { 0xA7, 0x7C, 0xDF, 0xDE, 0xBD, 0x19, 0x1B, 0x4B } }, \
+  { 0xB3F79D9A, 0x436C, 0xDC11, { 0xB0, 0x52, 0xCD, 0x85, 0xDF, 0x52, 0x4C, 0xE6 } }, \
+  { 0xFEDF8E0C, 0xE147, 0x11E3, { 0x99, 0x03, 0xB8, 0xE8, 0x56, 0x2C, 0xBA, 0xFA } }, \
+  { 0x0A8BADD5, 0x03B8, 0x4D19, { 0xB1, 0x28, 0x7B, 0x8F, 0x0E, 0xDA, 0xA5, 0x96 } }, \
+  { 0x0DA55BC9, 0x45F8, 0x4BB4, { 0x87, 0x19, 0x52, 0x24, 0xF1, 0x8A, 0x4D, 0x45 } }, \
+  { 0x5E93C847, 0x456D, 0x40B3, { 0xA6, 0xB4, 0x78, 0xB0, 0xC9, 0xCF, 0x7F, 0x20 } }, \
+  { 0xE5B58DBB, 0x7688, 0x44B4, { 0x97, 0xBF, 0x5F, 0x1D, 0x4B, 0x7C, 0xC8, 0xDB } }, \
+  { 0x47889FB2, 0xD671, 0x4FAB, { 0xA0, 0xCA, 0xDF, 0x0E, 0x44, 0xDF, 0x70, 0xD6 } }, \
+  { 0x5B446ED1, 0xE30B, 0x4FAA, { 0x87, 0x1A, 0x36, 0x54, 0xEC, 0xA3, 0x60, 0x80 } }, \
+  { 0xB625B186, 0xE063, 0x44F7, { 0x89, 0x05, 0x6A, 0x74, 0xDC, 0x6F, 0x52, 0xB4 } }, \
+  { 0xAE3D28CC, 0xE05B, 0x4FA1, { 0xA0, 0x11, 0x7E, 0xB5, 0x5A, 0x3F, 0x14, 0x01 } }, \
+  { 0x7F1647C8, 0xB76E, 0x44B2, { 0xA5, 0x65, 0xF7, 0x0F, 0xF1, 0x9C, 0xD1, 0x9E } }, \
+  { 0xCA37BC1F, 0xA327, 0x4AE9, { 0x82, 0x8A, 0x8C, 0x40, 0xD8, 0x50, 0x6A, 0x17 } }, \
+  { 0xBDC8E6AF, 0xD9BC, 0x4379, { 0xA7, 0x2A, 0xE0, 0xC4, 0xE7, 0x5D, 0xAE, 0x1C } }, \
+  { 0x7A59B29B, 0x910B, 0x4171, { 0x82, 0x42, 0xA8, 0x5A, 0x0D, 0xF2, 0x5B, 0x5B } }, \
+  { 0x3E35C163, 0x4074, 0x45DD, { 0x43, 0x1E, 0x23, 0x98, 0x9D, 0xD8, 0x6B, 0x32 } }, \
+  { 0x952CB795, 0xFF36, 0x48CF, { 0xA2, 0x49, 0x4D, 0xF4, 0x86, 0xD6, 0xAB, 0x8D } }, \
+  { 0x00CA959F, 0x6CFA, 0x4DB1, { 0x95, 0xBC, 0xE4, 0x6C, 0x47, 0x51, 0x43, 0x90 } }, \
+  { 0x1682FE44, 0xBD7A, 0x4407, { 0xB7, 0xC7, 0xDC, 0xA3, 0x7C, 0xA3, 0x92, 0x2D } }, \
+  { 0x0DB48A36, 0x4E54, 0xEA9C, { 0x9B, 0x09, 0x1E, 0xA5, 0xBE, 0x3A, 0x66, 0x0B } }, \
+  { 0x45BCD98E, 0x59AD, 0x4174, { 0x95, 0x46, 0x34, 0x4A, 0x07, 0x48, 0x58, 0x98 } }, \
+  { 0x54FCC43E, 0xAA89, 0x4333, { 0x9A, 0x85, 0xCD, 0xEA, 0x24, 0x05, 0x1E, 0x9E } }, \
+  { 0x1B0FB9BF, 0x699D, 0x4FDD, { 0xA7, 0xC3, 0x25, 0x46, 0x68, 0x1B, 0xF6, 0x3B } }, \
+  { 0xAB38A0DF, 0x6873, 0x44A9, { 0x87, 0xE6, 0xD4, 0xEB, 0x56, 0x14, 0x84, 0x49 } }, \
+  { 0x9E66F251, 0x727C, 0x418C, { 0xBF, 0xD6, 0xC2, 0xB4, 0x25, 0x28, 0x18, 0xEA } }, \
+  { 0x1A1241E6, 0x8F19, 0x41A9, { 0xBC, 0x0E, 0xE8, 0xEF, 0x39, 0xE0, 0x65, 0x46 } }, \
+  { 0x716EF0D9, 0xFF83, 0x4F69, { 0x81, 0xE9, 0x51, 0x8B, 0xD3, 0x9A, 0x8E, 0x70 } }, \
+  { 0x95A9A93E, 0xA86E, 0x4926, { 0xAA, 0xEF, 0x99, 0x18, 0xE7, 0x72, 0xD9, 0x87 } }, \
+  { 0x898890E9, 0x84B2, 0x4F3A, { 0x8C, 0x58, 0xD8, 0x57, 0x78, 0x13, 0xE0, 0xAC } }, \
+  { 0x5639867A, 0x8C8E, 0x408D, { 0xAC, 0x2F, 0x4B, 0x61, 0xBD, 0xC0, 0xBB, 0xBB } }, \
+  { 0x8F76DA58, 0x1F99, 0x4275, { 0xA4, 0xEC, 0x47, 0x56, 0x51, 0x5B, 0x1C, 0xE8 } }, \
+  { 0xB81BFAB0, 0x0EB3, 0x4CF9, { 0x84, 0x65, 0x7F, 0xA9, 0x86, 0x36, 0x16, 0x64 } }, \
+  { 0xBA23B311, 0x343D, 0x11E6, { 0x91, 0x85, 0x58, 0x20, 0xB1, 0xD6, 0x52, 0x99 } }, \
+  { 0x9DA34AE0, 0xEAF9, 0x4BBF, { 0x8E, 0xC3, 0xFD, 0x60, 0x22, 0x6C, 0x44, 0xBE } }, \
+  { 0x8CF2F62C, 0xBC9B, 0x4821, { 0x80, 0x8D, 0xEC, 0x9E, 0xC4, 0x21, 0xA1, 0xA0 } }, \
+  { 0x4311EDC0, 0x6054, 0x46D4, { 0x9E, 0x40, 0x89, 0x3E, 0xA9, 0x52, 0xFC, 0xCC } }, \
+  { 0xD40B6B80, 0x97D5, 0x4282, { 0xBB, 0x1D, 0x22, 0x3A, 0x16, 0x91, 0x80, 0x58 } }, \
+  { 0x6302D008, 0x7F9B, 0x4F30, { 0x87, 0xAC, 0x60, 0xC9, 0xFE, 0xF5, 0xDA, 0x4E } }, \
+  { 0x752F3136, 0x4E16, 0x4FDC, { 0xA2, 0x2A, 0xE5, 0xF4, 0x68, 0x12, 0xF4, 0xCA } }, \
+  { 0x3C7200E9, 0x005F, 0x4EA4, { 0x87, 0xDE, 0xA3, 0xDF, 0xAC, 0x8A, 0x27, 0xC3 } }, \
+  { 0x02EEA107, 0x98DB, 0x400E, { 0x98, 0x30, 0x46, 0x0A, 0x15, 0x42, 0xD7, 0x99 } }, \
+  { 0x4B47D616, 0xA8D6, 0x4552, { 0x9D, 0x44, 0xCC, 0xAD, 0x2E, 0x0F, 0x4C, 0xF9 } }, \
+  { 0x4D20583A, 0x7765, 0x4E7A, { 0x8A, 0x67, 0xDC, 0xDE, 0x74, 0xEE, 0x3E, 0xC5 } }, \
+  { 0xB0EAE4F8, 0x9A04, 0x4C6D, { 0xA7, 0x48, 0x79, 0x3D, 0xAA, 0x0F, 0x65, 0xDF } }, \
+  { 0xFD2340D0, 0x3DAB, 0x4349, { 0xA6, 0xC7, 0x3B, 0x4F, 0x12, 0xB4, 0x8E, 0xAE } }, \
+  { 0xCC664EB8, 0x3C24, 0x4086, { 0xB6, 0xF6, 0x34, 0xE8, 0x56, 0xBC, 0xE3, 0x6E } }, \
+  { 0xBA73672C, 0xA5D3, 0x11D4, { 0xBD, 0x00, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0xAB248E99, 0xABE1, 0x11D4, { 0xBD, 0x0D, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x4E11E955, 0xCCCA, 0x11D4, { 0xBD, 0x0D, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x0C95A93D, 0xA006, 0x11D4, { 0xBC, 0xFA, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x0C95A935, 0xA006, 0x11D4, { 0xBC, 0xFA, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x0C95A92F, 0xA006, 0x11D4, { 0xBC, 0xFA, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x0C95A928, 0xA006, 0x11D4, { 0xBC, 0xFA, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0xB347F047, 0xAF8C, 0x490E, { 0xAC, 0x07, 0x0A, 0xA9, 0xB7, 0xE5, 0x38, 0x58 } }, \
+  { 0x0419F582, 0x0625, 0x4531, { 0x8A, 0x33, 0x85, 0xA9, 0x96, 0x5C, 0x95, 0xBC } }, \
+  { 0x58C518B1, 0x76F3, 0x11D4, { 0xBC, 0xEA, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x96EB4AD6, 0xA32A, 0x11D4, { 0xBC, 0xFD, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0xD3B46F3B, 0xD441, 0x1244, { 0x9A, 0x12, 0x00, 0x12, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x7235C51C, 0x0C80, 0x4CAB, { 0x87, 0xAC, 0x3B, 0x08, 0x4A, 0x63, 0x04, 0xB1 } }, \
+  { 0x837DCA9E, 0xE874, 0x4D82, { 0xB2, 0x9A, 0x23, 0xFE, 0x0E, 0x23, 0xD1, 0xE2 } }, \
+  { 0xA732241F, 0x383D, 0x4D9C, { 0x8A, 0xE1, 0x8E, 0x09, 0x83, 0x75, 0x89, 0xD7 } }, \
+  { 0x24A2D66F, 0xEEDD, 0x4086, { 0x90, 0x42, 0xF2, 0x6E, 0x47, 0x97, 0xEE, 0x69 } }, \
+  { 0xFA920010, 0x6785, 0x4941, { 0xB6, 0xEC, 0x49, 0x8C, 0x57, 0x9F, 0x16, 0x0A } }, \
+  { 0x6B558CE3, 0x69E5, 0x4C67, { 0xA6, 0x34, 0xF7, 0xFE, 0x72, 0xAD, 0xBE, 0x84 } }, \
+  { 0x3D3CA290, 0xB9A5, 0x11E3, { 0xB7, 0x5D, 0xB8, 0xAC, 0x6F, 0x7D, 0x65, 0xE6 } }, \
+  { 0x6EFAC84F, 0x0AB0, 0x4747, { 0x81, 0xBE, 0x85, 0x55, 0x62, 0x59, 0x04, 0x49 } }, \
+  { 0xF8775D50, 0x8ABD, 0x4ADF, { 0x92, 0xAC, 0x85, 0x3E, 0x51, 0xF6, 0xC8, 0xDC } }, \
+  { 0x80DBD530, 0xB74C, 0x4F11, { 0x8C, 0x03, 0x41, 0x86, 0x65, 0x53, 0x28, 0x31 } }, \
+  { 0x161BE597, 0xE9C5, 0x49DB, { 0xAE, 0x50, 0xC4, 0x62, 0xAB, 0x54, 0xEE, 0xDA } }, \
+  { 0xD400D1E4, 0xA314, 0x442B, { 0x89, 0xED, 0xA9, 0x2E, 0x4C, 0x81, 0x97, 0xCB } }, \
+  { 0xEEF749C2, 0xC047, 0x4D6E, { 0xB1, 0xBC, 0xD3, 0x6E, 0xB3, 0xA5, 0x55, 0x9C } }, \
+  { 0x074E1E48, 0x8132, 0x47A1, { 0x8C, 0x2C, 0x3F, 0x14, 0xAD, 0x9A, 0x66, 0xDC } }, \
+  { 0x7A5DBC75, 0x5B2B, 0x4E67, { 0xBD, 0xE1, 0xD4, 0x8E, 0xEE, 0x76, 0x15, 0x62 } }, \
+  { 0xA7CED760, 0xC71C, 0x4E1A, { 0xAC, 0xB1, 0x89, 0x60, 0x4D, 0x52, 0x16, 0xCB } }, \
+  { 0x1F18C5B3, 0x29ED, 0x4D9E, { 0xA5, 0x04, 0x6D, 0x97, 0x8E, 0x7E, 0xD5, 0x69 } }, \
+  { 0xE5769EA9, 0xE706, 0x454B, { 0x95, 0x7F, 0xAF, 0xC6, 0xDB, 0x4B, 0x8A, 0x0D } }, \
+  { 0x2977064F, 0xAB96, 0x4FA9, { 0x85, 0x45, 0xF9, 0xC4, 0x02, 0x51, 0xE0, 0x7F } }, \
+  { 0xADF3A128, 0x416D, 0x4060, { 0x8D, 0xDF, 0x30, 0xA1, 0xD7, 0xAA, 0xB6, 0x99 } }, \
+  { 0x1156EFC6, 0xEA32, 0x4396, { 0xB5, 0xD5, 0x26, 0x93, 0x2E, 0x83, 0xC3, 0x13 } }, \
+  { 0xD9072C35, 0xEB8F, 0x43AD, { 0xA2, 0x20, 0x34, 0xD4, 0x0E, 0x2A, 0x82, 0x85 } }, \
+  { 0xE287D20B, 0xD897, 0x4E1E, { 0xA5, 0xD9, 0x97, 0x77, 0x63, 0x93, 0x6A, 0x04 } }, \
+  { 0xB63F8EC7, 0xA9C9, 0x4472, { 0xA4, 0xC0, 0x4D, 0x8B, 0xF3, 0x65, 0xCC, 0x51 } }, \
+  { 0xF0A30BC7, 0xAF08, 0x4556, { 0x99, 0xC4, 0x00, 0x10, 0x09, 0xC9, 0x3A, 0x44 } }, \
+  { 0xC076EC0C, 0x7028, 0x4399, { 0xA0, 0x72, 0x71, 0xEE, 0x5C, 0x44, 0x8B, 0x9F } }, \
+  { 0x9073E4E0, 0x60EC, 0x4B6E, { 0x99, 0x03, 0x4C, 0x22, 0x3C, 0x26, 0x0F, 0x3C } }, \
+  { 0xD9BEE56E, 0x75DC, 0x49D9, { 0xB4, 0xD7, 0xB5, 0x34, 0x21, 0x0F, 0x63, 0x7A } }, \
+  { 0x2B9FFB52, 0x1B13, 0x416F, { 0xA8, 0x7B, 0xBC, 0x93, 0x0D, 0xEF, 0x92, 0xA8 } }, \
+  { 0xD26C221E, 0x2430, 0x4C8A, { 0x91, 0x70, 0x3F, 0xCB, 0x45, 0x00, 0x41, 0x3F } }, \
+  { 0xEF598499, 0xB25E, 0x473A, { 0xBF, 0xAF, 0xE7, 0xE5, 0x7D, 0xCE, 0x82, 0xC4 } }, \
+  { 0x0397B0C9, 0x22E8, 0x459E, { 0xA4, 0xFF, 0x99, 0xBC, 0x65, 0x27, 0x09, 0x29 } }, \
+  { 0xB2360B42, 0x7173, 0x420A, { 0x86, 0x96, 0x46, 0xCA, 0x6B, 0xAB, 0x10, 0x60 } }, \
+  { 0x0F6499B1, 0xE9AD, 0x493D, { 0xB9, 0xC2, 0x2F, 0x90, 0x81, 0x5C, 0x6C, 0xBC } }, \
+  { 0xAEB9C5C1, 0x94F1, 0x4D02, { 0xBF, 0xD9, 0x46, 0x02, 0xDB, 0x2D, 0x3C, 0x54 } }, \
+  { 0x78B9EC8B, 0xC000, 0x46C5, { 0xAC, 0x93, 0x24, 0xA0, 0xC1, 0xBB, 0x00, 0xCE } }, \
+  { 0xD0849ED1, 0xA88C, 0x4BA6, { 0xB1, 0xD6, 0xAB, 0x50, 0xE2, 0x80, 0xB7, 0xA9 } }, \
+  { 0x3CCD3DD8, 0x8D45, 0x4FED, { 0x96, 0x2D, 0x2B, 0x38, 0xCD, 0x82, 0xB3, 0xC4 } }, \
+  { 0xC35F272C, 0x97C2, 0x465A, { 0xA2, 0x16, 0x69, 0x6B, 0x66, 0x8A, 0x8C, 0xFE } }, \
+  { 0xB0F901E4, 0xC424, 0x45DE, { 0x90, 0x81, 0x95, 0xE2, 0x0B, 0xDE, 0x6F, 0xB5 } }, \
+  { 0x6339D487, 0x26BA, 0x424B, { 0x9A, 0x5D, 0x68, 0x7E, 0x25, 0xD7, 0x40, 0xBC } }, \
+  { 0x5DAF50A5, 0xEA81, 0x4DE2, { 0x8F, 0x9B, 0xCA, 0xBD, 0xA9, 0xCF, 0x5C, 0x14 } }, \
+  { 0x8B01E5B6, 0x4F19, 0x46E8, { 0xAB, 0x93, 0x1C, 0x53, 0x67, 0x1B, 0x90, 0xCC } }, \
+  { 0x286BF25A, 0xC2C3, 0x408C, { 0xB3, 0xB4, 0x25, 0xE6, 0x75, 0x8B, 0x73, 0x17 } }, \
+  { 0x7F4158D3, 0x074D, 0x456D, { 0x8C, 0xB2, 0x01, 0xF9, 0xC8, 0xF7, 0x9D, 0xAA } }, \
+  { 0x44A2AD5D, 0x612C, 0x47B3, { 0xB0, 0x6E, 0xC8, 0xF5, 0x0B, 0xFB, 0xF0, 0x7D } }, \
+  { 0xD2C18636, 0x40E5, 0x4EB5, { 0xA3, 0x1B, 0x36, 0x69, 0x5F, 0xD4, 0x2C, 0x87 } }, \
+  { 0x158DEF5A, 0xF656, 0x419C, { 0xB0, 0x27, 0x7A, 0x31, 0x92, 0xC0, 0x79, 0xD2 } }, \
+  { 0x51271E13, 0x7DE3, 0x43AF, { 0x8B, 0xC2, 0x71, 0xAD, 0x3B, 0x82, 0x43, 0x25 } }, \
+  { 0x0053D9D6, 0x2659, 0x4599, { 0xA2, 0x6B, 0xEF, 0x45, 0x36, 0xE6, 0x31, 0xA9 } }, \
+  { 0xB8969637, 0x81DE, 0x43AF, { 0xBC, 0x9A, 0x24, 0xD9, 0x89, 0x13, 0xF2, 0xF6 } }, \
+  { 0x25F200AA, 0xD3CB, 0x470A, { 0xBF, 0x51, 0xE7, 0xD1, 0x62, 0xD2, 0x2E, 0x6F } }, \
+  { 0x0AF0B742, 0x63EC, 0x45BD, { 0x8D, 0xB6, 0x71, 0xAD, 0x7F, 0x2F, 0xE8, 0xE8 } }, \
+  { 0x7D574D54, 0xD364, 0x4D4A, { 0x95, 0xE3, 0x49, 0x45, 0xDB, 0x7A, 0xD3, 0xEE } }, \
+  { 0xDEC5DAA4, 0x6781, 0x4820, { 0x9C, 0x63, 0xA7, 0xB0, 0xE4, 0xF1, 0xDB, 0x31 } }, \
+  { 0xF95A7CCC, 0x4C55, 0x4426, { 0xA7, 0xB4, 0xDC, 0x89, 0x61, 0x95, 0x0B, 0xAE } }, \
+  { 0x4344558D, 0x4EF9, 0x4725, { 0xB1, 0xE4, 0x33, 0x76, 0xE8, 0xD6, 0x97, 0x4F } }, \
+  { 0xF3D301BB, 0xF4A5, 0x45A8, { 0xB0, 0xB7, 0xFA, 0x99, 0x9C, 0x62, 0x37, 0xAE } }, \
+  { 0x0174B2B5, 0xF505, 0x4B12, { 0xAA, 0x60, 0x59, 0xDF, 0xF8, 0xD6, 0xEA, 0x37 } }, \
+  { 0x738A9314, 0x82C1, 0x4592, { 0x8F, 0xF7, 0xC1, 0xBD, 0xF1, 0xB2, 0x0E, 0xD4 } }, \
+  { 0x5F5F605D, 0x1583, 0x4A2D, { 0xA6, 0xB2, 0xEB, 0x12, 0xDA, 0xB4, 0xA2, 0xB6 } }, \
+  { 0x7C04A583, 0x9E3E, 0x4F1C, { 0xAD, 0x65, 0xE0, 0x52, 0x68, 0xD0, 0xB4, 0xD1 } }, \
+  { 0x47C7B221, 0xC42A, 0x11D2, { 0x8E, 0x57, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x47C7B223, 0xC42A, 0x11D2, { 0x8E, 0x57, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x90B2B846, 0xCA6D, 0x4D6E, { 0xA8, 0xD3, 0xC1, 0x40, 0xA8, 0xE1, 0x10, 0xAC } }, \
+  { 0x812136D3, 0x4D3A, 0x433A, { 0x94, 0x18, 0x29, 0xBB, 0x9B, 0xF7, 0x8F, 0x6E } }, \
+  { 0xCE57B167, 0xB0E4, 0x41E8, { 0xA8, 0x97, 0x5F, 0x4F, 0xEB, 0x78, 0x1D, 0x40 } }, \
+  { 0x865A5A9B, 0xB85D, 0x474C, { 0x84, 0x55, 0x65, 0xD1, 0xBE, 0x84, 0x4B, 0xE2 } }, \
+  { 0x58E6ED63, 0x1694, 0x440B, { 0x93, 0x88, 0xE9, 0x8F, 0xED, 0x6B, 0x65, 0xAF } }, \
+  { 0x8AAEDB2A, 0xA6BB, 0x47C6, { 0x94, 0xCE, 0x1B, 0x80, 0x96, 0x42, 0x3F, 0x2A } }, \
+  { 0x5802BCE4, 0xEEEE, 0x4E33, { 0xA1, 0x30, 0xEB, 0xAD, 0x27, 0xF0, 0xE4, 0x39 } }, \
+  { 0xA82485CE, 0xAD6B, 0x4101, { 0x99, 0xD3, 0xE1, 0x35, 0x8C, 0x9E, 0x7E, 0x37 } }, \
+  { 0xC77C3A41, 0x61AB, 0x4143, { 0x98, 0x3E, 0x33, 0x39, 0x28, 0x06, 0x28, 0xE5 } }, \
+  { 0x1D202CAB, 0xC8AB, 0x4D5C, { 0x94, 0xF7, 0x3C, 0xFC, 0xC0, 0xD3, 0xD3, 0x35 } }, \
+  { 0x228F344D, 0xB3DE, 0x43BB, { 0xA4, 0xD7, 0xEA, 0x20, 0x0B, 0x1B, 0x14, 0x82 } }, \
+  { 0xDDABFEAC, 0xEF63, 0x452C, { 0x8F, 0x39, 0xED, 0x7F, 0xAE, 0xD8, 0x26, 0x5E } }, \
+  { 0x6F20F7C8, 0xE5EF, 0x4F21, { 0x8D, 0x19, 0xED, 0xC5, 0xF0, 0xC4, 0x96, 0xAE } }, \
+  { 0x3920405B, 0xC897, 0x44DA, { 0x88, 0xF3, 0x4C, 0x49, 0x8A, 0x6F, 0xF7, 0x36 } }, \
+  { 0xDB63592C, 0xB8CC, 0x44C8, { 0x91, 0x8C, 0x51, 0xF5, 0x34, 0x59, 0x8A, 0x5A } }, \
+  { 0x3A3300AB, 0xC929, 0x487D, { 0xAB, 0x34, 0x15, 0x9B, 0xC1, 0x35, 0x62, 0xC0 } }, \
+  { 0x4B0165A9, 0x61D6, 0x4E23, { 0xA0, 0xB5, 0x3E, 0xC7, 0x9C, 0x2E, 0x30, 0xD5 } }, \
+  { 0xD31F0400, 0x7D16, 0x4316, { 0xBF, 0x88, 0x60, 0x65, 0x88, 0x3B, 0x40, 0x2B } }, \
+  { 0xF0BBFCA0, 0x684E, 0x48B3, { 0xBA, 0xE2, 0x6C, 0x84, 0xB8, 0x9E, 0x53, 0x39 } }, \
+  { 0xEBBE2D1B, 0x1647, 0x4BDA, { 0xAB, 0x9A, 0x78, 0x63, 0xE3, 0x96, 0xD4, 0x1A } }, \
+  { 0xF617B358, 0x12CF, 0x414A, { 0xA0, 0x69, 0x60, 0x67, 0x7B, 0xDA, 0x13, 0xB3 } }, \
+  { 0x72E40094, 0x2EE1, 0x497A, { 0x8F, 0x33, 0x4C, 0x93, 0x4A, 0x9E, 0x9C, 0x0C } }, \
+  { 0x5BAB88BA, 0xE0E2, 0x4674, { 0xB6, 0xAD, 0xB8, 0x12, 0xF6, 0x88, 0x1C, 0xD6 } }, \
+  { 0xCDC5DDDF, 0xE79D, 0x41EC, { 0xA9, 0xB0, 0x65, 0x65, 0x49, 0x0D, 0xB9, 0xD3 } }, \
+  { 0xCFB33810, 0x6E87, 0x4284, { 0xB2, 0x03, 0xA6, 0x6A, 0xBE, 0x07, 0xF6, 0xE8 } }, \
+  { 0xBC52476E, 0xF67E, 0x4301, { 0xB2, 0x62, 0x36, 0x9C, 0x48, 0x78, 0xAA, 0xC2 } }, \
+  { 0x11FBFDFB, 0x10D2, 0x43E6, { 0xB5, 0xB1, 0xB4, 0x38, 0x6E, 0xDC, 0xCB, 0x9A } }, \
+  { 0x0BF70067, 0xD53B, 0x42DF, { 0xB7, 0x70, 0xE9, 0x2C, 0x91, 0xC6, 0x14, 0x11 } }, \
+  { 0xF8BFF014, 0x18FB, 0x4EF9, { 0xB1, 0x0C, 0xAE, 0x22, 0x73, 0x8D, 0xBE, 0xED } }, \
+  { 0xAF4CC162, 0xD41C, 0x455A, { 0xAB, 0x45, 0x6D, 0xBC, 0xC1, 0xCD, 0x32, 0xF3 } }, \
+  { 0x1EBE5AB9, 0x2129, 0x49E7, { 0x84, 0xD7, 0xEE, 0xB9, 0xFC, 0xE5, 0xDE, 0xDD } }, \
+  { 0xFD301BA4, 0x5E62, 0x4679, { 0xA0, 0x6F, 0xE0, 0x9A, 0xAB, 0xDD, 0x2A, 0x91 } }, \
+  { 0x14A7C46F, 0xBC02, 0x4047, { 0x9F, 0x18, 0xA5, 0xD7, 0x25, 0xD8, 0xBD, 0x19 } }, \
+  { 0x073E2576, 0xF6C1, 0x4B91, { 0x92, 0xA9, 0xD4, 0x67, 0x5D, 0xDA, 0x34, 0xB1 } }, \
+  { 0x707BE83E, 0x0BF6, 0x40A5, { 0xBE, 0x64, 0x34, 0xC0, 0x3A, 0xA0, 0xB8, 0xE2 } }, \
+  { 0xBB929DA9, 0x68F7, 0x4035, { 0xB2, 0x2C, 0xA3, 0xBB, 0x3F, 0x23, 0xDA, 0x55 } }, \
+  { 0x1A819E49, 0xD8EE, 0x48CB, { 0x9A, 0x9C, 0x0A, 0xA0, 0xD2, 0x81, 0x0A, 0x38 } }, \
+  { 0xEC87D643, 0xEBA4, 0x4BB5, { 0xA1, 0xE5, 0x3F, 0x3E, 0x36, 0xB2, 0x0D, 0xA9 } }, \
+  { 0xE6C2F70A, 0xB604, 0x4877, { 0x85, 0xBA, 0xDE, 0xEC, 0x89, 0xE1, 0x17, 0xEB } }, \
+  { 0x03FDF171, 0x1D67, 0x4ACE, { 0xA9, 0x04, 0x3E, 0x36, 0xD3, 0x38, 0xFA, 0x74 } }, \
+  { 0x40B09B5A, 0xF0EF, 0x4627, { 0x93, 0xD5, 0x27, 0xF0, 0x4B, 0x75, 0x4D, 0x05 } }, \
+  { 0x10BA6BBE, 0xA97E, 0x41C3, { 0x9A, 0x07, 0x60, 0x7A, 0xD9, 0xBD, 0x60, 0xE5 } }, \
+  { 0xCE845704, 0x1683, 0x4D38, { 0xA4, 0xF9, 0x7D, 0x0B, 0x50, 0x77, 0x57, 0x93 } }, \
+  { 0x1E2ACC41, 0xE26A, 0x483D, { 0xAF, 0xC7, 0xA0, 0x56, 0xC3, 0x4E, 0x08, 0x7B } }, \
+  { 0x560BF58A, 0x1E0D, 0x4D7E, { 0x95, 0x3F, 0x29, 0x80, 0xA2, 0x61, 0xE0, 0x31 } }, \
+  { 0x1BF06AEA, 0x5BEC, 0x4A8D, { 0x95, 0x76, 0x74, 0x9B, 0x09, 0x56, 0x2D, 0x30 } }, \
+  { 0x0468A601, 0xC535, 0x46FD, { 0xA9, 0x5D, 0xBB, 0xAB, 0x99, 0x1B, 0x17, 0x8C } }, \
+  { 0xBB9C7AB7, 0xB8D9, 0x4BF3, { 0x9C, 0x29, 0x9B, 0xF3, 0x41, 0xE2, 0x17, 0xBC } }, \
+  { 0xC3E36D09, 0x8294, 0x4B97, { 0xA8, 0x57, 0xD5, 0x28, 0x8F, 0xE3, 0x3E, 0x28 } }, \
+  { 0x94B9E8AE, 0x8877, 0x479A, { 0x98, 0x42, 0xF5, 0x97, 0x4B, 0x82, 0xCE, 0xD3 } }, \
+  { 0x3812723D, 0x7E48, 0x4E29, { 0xBC, 0x27, 0xF5, 0xA3, 0x9A, 0xC9, 0x4E, 0xF1 } }, \
+  { 0x70E56C5E, 0x280C, 0x44B0, { 0xA4, 0x97, 0x09, 0x68, 0x1A, 0xBC, 0x37, 0x5E } }, \
+  { 0x788E1D9F, 0x1EAB, 0x47D2, { 0xA2, 0xF3, 0x78, 0xCA, 0xE8, 0x7D, 0x60, 0x12 } }, \
+  { 0xEF14FD78, 0x0793, 0x4E2B, { 0xAC, 0x6D, 0x06, 0x28, 0x47, 0xE0, 0x17, 0x91 } }, \
+  { 0x7E374E25, 0x8E01, 0x4FEE, { 0x87, 0xF2, 0x39, 0x0C, 0x23, 0xC6, 0x06, 0xCD } }, \
+  { 0x72234213, 0x0FD7, 0x48A1, { 0xA5, 0x9F, 0xB4, 0x1B, 0xC1, 0x07, 0xFB, 0xCD } }, \
+  { 0xCA1BCAD9, 0xE021, 0x4547, { 0xA1, 0xB0, 0x5B, 0x22, 0xC7, 0xF6, 0x87, 0xF4 } }, \
+  { 0x0D9A1427, 0xE02A, 0x437D, { 0x92, 0x6B, 0xAA, 0x52, 0x1F, 0xD7, 0x22, 0xBA } }, \
+  { 0x5E559C23, 0x1FAA, 0x4AE1, { 0x8D, 0x4A, 0xC6, 0xCF, 0x02, 0x6C, 0x76, 0x6F } }, \
+  { 0x86843F56, 0x675D, 0x40A5, { 0x95, 0x30, 0xBC, 0x85, 0x83, 0x72, 0xF1, 0x03 } }, \
+  { 0xBD26CDC9, 0xA092, 0x462A, { 0x87, 0x7A, 0x5A, 0xB6, 0xAD, 0xCE, 0x48, 0x12 } }, \
+  { 0xDE161CFE, 0x1E60, 0x42A1, { 0x8C, 0xC3, 0xEE, 0x7E, 0xF0, 0x73, 0x52, 0x12 } }, \
+  { 0xAB2BEE2F, 0xC1A6, 0x4399, { 0x85, 0x3D, 0xC0, 0x7C, 0x77, 0x4F, 0xFD, 0x0D } }, \
+  { 0xF617B358, 0x12CF, 0x414A, { 0xA0, 0x69, 0x60, 0x67, 0x7B, 0xDA, 0x13, 0xB4 } }, \
+  { 0x400B4476, 0x3081, 0x11D6, { 0x87, 0xED, 0x00, 0x06, 0x29, 0x45, 0xC3, 0xB9 } }, \
+  { 0xEF7BF7D6, 0xF8FF, 0x4A76, { 0x82, 0x47, 0xC0, 0xD0, 0xD1, 0xCC, 0x49, 0xC0 } }, \
+  { 0xE227C522, 0xD5FE, 0x4A53, { 0x87, 0xB1, 0x0F, 0xBE, 0x57, 0x0F, 0x98, 0xE9 } }, \
+  { 0x3C485EA4, 0x449A, 0x46CE, { 0xBB, 0x08, 0x2A, 0x33, 0x6E, 0xA9, 0x6B, 0x4E } }, \
+  { 0xD3ECC567, 0x9FD5, 0x44C1, { 0x86, 0xCF, 0x5D, 0xA7, 0xA2, 0x4F, 0x4B, 0x5D } }, \
+  { 0xA6A79162, 0xE325, 0x4C30, { 0xBC, 0xC3, 0x59, 0x37, 0x30, 0x64, 0xEF, 0xB3 } }, \
+  { 0xD5B06D16, 0x2EA1, 0x4DEF, { 0x98, 0xD0, 0xA0, 0x5D, 0x40, 0x72, 0x84, 0x17 } }, \
+  { 0x377C66A3, 0x8FE7, 0x4EE8, { 0x85, 0xB8, 0xF1, 0xA2, 0x82, 0x56, 0x9E, 0x3B } }, \
+  { 0x91A1DDCF, 0x5374, 0x4939, { 0x89, 0x51, 0xD7, 0x29, 0x3F, 0x1A, 0x78, 0x6F } }, \
+  { 0x6FF23F1D, 0x877C, 0x4B1B, { 0x93, 0xFC, 0xF1, 0x42, 0xB2, 0xEE, 0xA6, 0xA7 } }, \
+  { 0xAD9C4381, 0x1EDE, 0x430C, { 0x8D, 0x42, 0x23, 0x76, 0x7C, 0x46, 0x5D, 0x52 } }, \
+  { 0x24486226, 0xF8C2, 0x41F5, { 0xB9, 0xDD, 0x78, 0x3E, 0x9E, 0x56, 0xDE, 0xA0 } }, \
+  { 0xF30C2915, 0x5782, 0x4E6A, { 0xA8, 0x46, 0x05, 0xBA, 0xBC, 0xE7, 0xB6, 0xA0 } }, \
+  { 0x9FA1B225, 0x3346, 0x461B, { 0xA0, 0x69, 0xED, 0x01, 0xB6, 0x73, 0xD2, 0x40 } }, \
+  { 0xF2C1910E, 0xF5C9, 0x4B72, { 0xB2, 0x43, 0x6D, 0x59, 0x09, 0x6A, 0x79, 0xF0 } }, \
+  { 0x9F49A879, 0x3D71, 0x42B3, { 0xA0, 0xAD, 0xDD, 0xB1, 0xF3, 0x30, 0x10, 0xA3 } }, \
+  { 0x951B65E5, 0x8872, 0x41ED, { 0xAD, 0x1D, 0xD5, 0x68, 0x1F, 0x4A, 0xF0, 0x33 } }, \
+  { 0x137B3044, 0xF6D7, 0x473E, { 0xA6, 0x25, 0x9F, 0xB9, 0x25, 0x05, 0xC1, 0x80 } }, \
+  { 0x38DDFE8F, 0x8991, 0x44AA, { 0x98, 0x89, 0x83, 0xF4, 0x91, 0x84, 0x65, 0xB0 } }, \
+  { 0x4549AB47, 0x6E60, 0x4293, { 0xB9, 0x1D, 0x31, 0xB6, 0x10, 0xAD, 0x80, 0x56 } }, \
+  { 0xB122A262, 0x3551, 0x4F48, { 0x88, 0x92, 0x55, 0xF6, 0xC0, 0x61, 0x42, 0x90 } }, \
+  { 0x0DC73AED, 0xCBF6, 0x4A25, { 0xA6, 0x8D, 0x59, 0xC8, 0x0F, 0x44, 0xC7, 0xC3 } }, \
+  { 0xF3FF1468, 0x04BA, 0x4966, { 0x9F, 0xB2, 0xE4, 0xA7, 0x90, 0x05, 0x46, 0x50 } }, \
+  { 0x0E1D2972, 0x65AF, 0x4AC1, { 0xBF, 0xA3, 0xCE, 0xF4, 0xAB, 0x0C, 0x38, 0xFE } }, \
+  { 0xC1D7859D, 0x5719, 0x46C3, { 0xA2, 0x98, 0xD0, 0x71, 0xE3, 0x02, 0x64, 0xD1 } }, \
+  { 0x19D96D3F, 0x6A6A, 0x47D2, { 0xB1, 0x95, 0x7B, 0x24, 0x32, 0xDA, 0x3B, 0xE2 } }, \
+  { 0xE14F04FA, 0x8706, 0x4353, { 0x92, 0xF2, 0x9C, 0x24, 0x24, 0x74, 0x6F, 0x9F } }, \
+  { 0xB2FA4764, 0x3B6E, 0x43D3, { 0x91, 0xDF, 0x87, 0xD1, 0x5A, 0x3E, 0x56, 0x68 } }, \
+  { 0xB2FA5764, 0x3B6E, 0x43D3, { 0x91, 0xDF, 0x87, 0xD1, 0x5A, 0x3E, 0x56, 0x68 } }, \
+  { 0xCB5C54C0, 0x230D, 0x43DB, { 0x92, 0x2C, 0x24, 0xD3, 0x4F, 0x8C, 0x91, 0x5C } }, \
+  { 0xC811FA38, 0x42C8, 0x4579, { 0xA9, 0xBB, 0x60, 0xE9, 0x4E, 0xDD, 0xFB, 0x34 } }, \
+  { 0x541D5A75, 0x95EE, 0x43C7, { 0x9E, 0x5D, 0x23, 0x94, 0xDC, 0x48, 0x62, 0x49 } }, \
+  { 0xC48D651C, 0x9D0E, 0x4CE7, { 0xAD, 0x39, 0xED, 0xD1, 0xAB, 0x83, 0x6B, 0x30 } }, \
+  { 0x1B6BC809, 0xC986, 0x4937, { 0x93, 0x4F, 0x1E, 0xA5, 0x86, 0x22, 0xFE, 0x50 } }, \
+  { 0x58279C2D, 0xFB19, 0x466E, { 0xB4, 0x2E, 0xCD, 0x43, 0x70, 0x16, 0xDC, 0x25 } }, \
+  { 0x0885F288, 0x418C, 0x4BE1, { 0xA6, 0xAF, 0x8B, 0xAD, 0x61, 0xDA, 0x08, 0xFE } }, \
+  { 0x7459A7D4, 0x6533, 0x4480, { 0xBB, 0xA7, 0x79, 0xE2, 0x5A, 0x44, 0x43, 0xC9 } }, \
+  { 0x3677770F, 0xEFB2, 0x43B2, { 0xB8, 0xAE, 0xB3, 0x02, 0xE9, 0x60, 0x48, 0x82 } }, \
+  { 0xD69240C0, 0xDD40, 0x4F2D, { 0x98, 0x63, 0x48, 0x48, 0xDA, 0x6E, 0x61, 0x5F } }, \
+  { 0xD84BEFF0, 0x159A, 0x4B60, { 0x9A, 0xB9, 0xAC, 0x5C, 0x47, 0x4B, 0xD3, 0xB1 } }, \
+  { 0x073E7E01, 0x2611, 0x4E85, { 0xB8, 0x96, 0xA3, 0xB6, 0x76, 0x7C, 0xBA, 0x00 } }, \
+  { 0xB9B038B0, 0xE2B6, 0x4AAB, { 0x94, 0x35, 0x41, 0x65, 0xEC, 0xFE, 0xD0, 0x32 } }, \
+  { 0x71202EEE, 0x5F53, 0x40D9, { 0xAB, 0x3D, 0x9E, 0x0C, 0x26, 0xD9, 0x66, 0x57 } }, \
+  { 0xAB1404CA, 0x4801, 0x4208, { 0x98, 0xBF, 0x30, 0xD5, 0x21, 0xDA, 0xD4, 0xD3 } }, \
+  { 0x26DC4851, 0x195F, 0x4AE1, { 0x9A, 0x19, 0xFB, 0xF8, 0x83, 0xBB, 0xB3, 0x5E } }, \
+  { 0x1DB184AE, 0x81F5, 0x4E72, { 0x85, 0x44, 0x2B, 0xAB, 0x0C, 0x2C, 0xAC, 0x5C } }, \
+  { 0x1D26ADC3, 0xB011, 0xEE2C, { 0x21, 0x77, 0x89, 0xBB, 0xAA, 0xCC, 0x33, 0x92 } }, \
+  { 0xE9008D70, 0x2A4E, 0x47EA, { 0x8E, 0xC4, 0x72, 0xE2, 0x57, 0x67, 0xE5, 0xEF } }, \
+  { 0x0273146C, 0x96C4, 0x45A1, { 0xA7, 0xAF, 0x78, 0xE0, 0x52, 0x4A, 0x0A, 0xE2 } }, \
+  { 0xE6F4F8F7, 0x4992, 0x47B2, { 0x83, 0x02, 0x85, 0x08, 0x74, 0x5E, 0x4A, 0x23 } }, \
+  { 0x9CF0F18E, 0x7C7D, 0x49DE, { 0xB5, 0xAA, 0xBB, 0xBA, 0xD6, 0xB2, 0x10, 0x07 } }, \
+  { 0xBF66FDF7, 0xF64C, 0x4B11, { 0x8A, 0xB7, 0xF8, 0x43, 0xAA, 0x2A, 0x8B, 0xEA } }, \
+  { 0xB167C2F5, 0xE26A, 0x4DFF, { 0x8E, 0x1C, 0x08, 0x07, 0xC7, 0xF0, 0x2A, 0x88 } }, \
+  { 0x5FDEE00D, 0xDA40, 0x405A, { 0xB9, 0x2E, 0xCF, 0x4A, 0x80, 0xEA, 0x8F, 0x76 } }, \
+  { 0xB098F766, 0xB17A, 0x4005, { 0x83, 0x09, 0xEB, 0x23, 0xF1, 0x44, 0x8C, 0x15 } }, \
+  { 0xD4CA32B1, 0xB1F2, 0x4FF3, { 0xB4, 0x75, 0x66, 0xE7, 0xB8, 0x19, 0x2A, 0x3B } }, \
+  { 0xAC9CF0A8, 0xE551, 0x4BE2, { 0xAD, 0x0A, 0xE1, 0xB5, 0x64, 0xEE, 0xA2, 0x73 } }, \
+  { 0x3EA824D1, 0x81E3, 0x4FF5, { 0xBD, 0x43, 0xBB, 0x9C, 0x65, 0xDF, 0x7C, 0x46 } }, \
+  { 0x2362EA9C, 0x84E5, 0x4DFF, { 0x83, 0xBC, 0xB5, 0xAC, 0xEC, 0xB5, 0x7C, 0xBB } }, \
+  { 0x4E7AF417, 0xC200, 0x400A, { 0x9D, 0x18, 0x86, 0x5A, 0xDA, 0xD3, 0x08, 0x96 } }, \
+  { 0xAB21ACC3, 0xBA33, 0xEE2C, { 0x66, 0xBC, 0x12, 0x56, 0x77, 0x11, 0x1A, 0xB2 } }, \
+  { 0xE894B313, 0x54CA, 0x4BB2, { 0x8C, 0xDD, 0x85, 0x1E, 0x8A, 0xC9, 0x02, 0x7C } }, \
+  { 0x2D6447EF, 0x3BC9, 0x41A0, { 0xAC, 0x19, 0x4D, 0x51, 0xD0, 0x1B, 0x4C, 0xE6 } }, \
+  { 0x5F87BA17, 0x957D, 0x433D, { 0x9E, 0x15, 0xC0, 0xE7, 0xC8, 0x79, 0x88, 0x99 } }, \
+  { 0xD4CA32B3, 0xB1FE, 0x4FF7, { 0xB0, 0x73, 0x60, 0xED, 0xBB, 0x16, 0x22, 0x33 } }, \
+  { 0x0ADFB62D, 0xFF74, 0x484C, { 0x89, 0x44, 0xF8, 0x5C, 0x4B, 0xEA, 0x87, 0xA8 } }, \
+  { 0x3496A19A, 0x2E99, 0x41BA, { 0x83, 0x3E, 0x0F, 0xDE, 0x2E, 0xBF, 0x2A, 0x55 } }, \
+  { 0x5E794317, 0xA07E, 0x45DF, { 0x94, 0xBB, 0x1C, 0x99, 0x7D, 0x62, 0x32, 0xCA } }, \
+  { 0xFC9A50C1, 0x8B3D, 0x40D0, { 0x99, 0x12, 0x6E, 0x26, 0xD7, 0x89, 0x6C, 0xBA } }, \
+  { 0x982D8C6F, 0xF6F6, 0x4135, { 0xA3, 0x09, 0xA4, 0x59, 0x3E, 0xA5, 0x64, 0x17 } }, \
+  { 0x94567C6F, 0xF7A9, 0x4229, { 0x13, 0x30, 0xFE, 0x11, 0xCC, 0xAB, 0x3A, 0x11 } }, \
+  { 0xB27DAB38, 0x9814, 0x4E06, { 0xA5, 0xA2, 0x65, 0xAE, 0x9A, 0x14, 0x25, 0x8F } }, \
+  { 0xFC8BE767, 0x89F1, 0x4D6E, { 0x80, 0x99, 0x6F, 0x02, 0x1E, 0xBC, 0x87, 0xCC } }, \
+  { 0xBA7C46D1, 0x9C5E, 0x4FC8, { 0x94, 0x3D, 0x1A, 0x49, 0x1F, 0x23, 0xFE, 0x01 } }, \
+  { 0x16287BA4, 0x5B9D, 0x4D98, { 0x91, 0x9F, 0x7B, 0x7B, 0x78, 0xCB, 0x2B, 0xE0 } }, \
+  { 0x99E275E7, 0x75A0, 0x4B37, { 0xA2, 0xE6, 0xC5, 0x38, 0x5E, 0x6C, 0x00, 0xCB } }, \
+  { 0xB3DAE700, 0x2A77, 0x4EA4, { 0xAF, 0x79, 0x32, 0x97, 0xB4, 0x84, 0xBE, 0x61 } }, \
+  { 0x5023B95C, 0xDB26, 0x429B, { 0xA6, 0x48, 0xBD, 0x47, 0x66, 0x4C, 0x80, 0x12 } }, \
+  { 0xA6351A87, 0x2965, 0x4718, { 0x88, 0xC7, 0x0B, 0x5B, 0x5A, 0xC0, 0xB5, 0xE4 } }, \
+  { 0x6737934B, 0xA27E, 0x4C05, { 0xAD, 0x5B, 0x6A, 0xB8, 0x62, 0x73, 0x68, 0x0B } }, \
+  { 0x717FC150, 0xABD9, 0x4614, { 0x80, 0x15, 0x0B, 0x33, 0x23, 0xEA, 0xB9, 0x5C } }, \
+  { 0x542D6248, 0x4198, 0x4960, { 0x9F, 0x59, 0x23, 0x84, 0x64, 0x6D, 0x63, 0xB4 } }, \
+  { 0x04627B9B, 0x385E, 0x4744, { 0x90, 0x21, 0xE6, 0x63, 0x19, 0xF2, 0x03, 0x94 } }, \
+  { 0xF42A009D, 0x977F, 0x4F08, { 0x94, 0x40, 0xBC, 0xA5, 0xA3, 0xBE, 0xD9, 0xAF } }, \
+  { 0x4D6C0496, 0x8DE4, 0x4AF2, { 0x9A, 0x2E, 0x9B, 0xE5, 0xB9, 0x15, 0x6A, 0xC5 } }, \
+  { 0x181E874D, 0xC089, 0x4C99, { 0x8E, 0xC2, 0x6D, 0x67, 0x61, 0x34, 0x82, 0x20 } }, \
+  { 0x8A91B1E1, 0x56C7, 0x4ADC, { 0xAB, 0xEB, 0x1C, 0x2C, 0xA1, 0x72, 0x9E, 0xFF } }, \
+  { 0xDAC3CB98, 0x2295, 0x412E, { 0x82, 0x6D, 0xFD, 0xEE, 0xA3, 0x20, 0xCF, 0x31 } }, \
+  { 0x39E8CDA1, 0x6A35, 0x4CDD, { 0xA9, 0x02, 0xD1, 0xA7, 0x95, 0xF7, 0x03, 0x80 } }, \
+  { 0x308DD02C, 0x092B, 0x4123, { 0xA2, 0xAF, 0x3E, 0xF4, 0x44, 0x0A, 0x6B, 0x4A } }, \
+  { 0xD7642443, 0x87B7, 0x4832, { 0x96, 0x07, 0x0E, 0x1E, 0xA8, 0x1C, 0x1D, 0x86 } }, \
+  { 0x589BC616, 0xBB4F, 0x47ED, { 0x92, 0xF7, 0x93, 0x39, 0x3C, 0x69, 0x7E, 0x25 } }, \
+  { 0x3D6CDB0A, 0x5B1F, 0x43A3, { 0xA4, 0x3B, 0x44, 0x12, 0x67, 0xF9, 0xDA, 0xB5 } }, \
+  { 0x7D6B8734, 0xB754, 0x443F, { 0xB5, 0x88, 0x77, 0x43, 0x84, 0x3A, 0xD3, 0xF1 } }, \
+  { 0x017CB4B7, 0xB80C, 0x4040, { 0xB6, 0xC8, 0xEA, 0x98, 0x2B, 0xBB, 0x25, 0xB7 } }, \
+  { 0x91ABC830, 0x16FC, 0x4D9E, { 0xA1, 0x89, 0x5F, 0xC8, 0xBB, 0x41, 0x14, 0x02 } }, \
+  { 0xEB5198EB, 0xE7F5, 0x45A1, { 0x9C, 0xCB, 0xE5, 0x33, 0x64, 0xBB, 0x49, 0x92 } }, \
+  { 0x4599D26F, 0x1A11, 0x49B8, { 0xB9, 0x1F, 0x85, 0x87, 0x45, 0xCF, 0xF8, 0x24 } }, \
+  { 0xCD541D77, 0x6699, 0x4B36, { 0xA3, 0x1E, 0x1A, 0xA4, 0xC5, 0xD5, 0xB9, 0x46 } }, \
+  { 0x7D3DCEEE, 0xCBCE, 0x4EA7, { 0x87, 0x09, 0x6E, 0x55, 0x2F, 0x1E, 0xDB, 0xDE } }, \
+  { 0xA8A2093B, 0xFEFA, 0x43C1, { 0x8E, 0x62, 0xCE, 0x52, 0x68, 0x47, 0x26, 0x5E } }, \
+  { 0x2325F2FC, 0x5683, 0x4648, { 0x97, 0xC4, 0x9A, 0x52, 0x0D, 0xFB, 0xE3, 0x25 } }, \
+  { 0x320BDC39, 0x3FA0, 0x4BA9, { 0xBF, 0x2D, 0xB3, 0x3F, 0x72, 0xBA, 0x9C, 0xA1 } }, \
+  { 0x3EF7500E, 0xCF55, 0x474F, { 0x8E, 0x7E, 0x00, 0x9E, 0x0E, 0xAC, 0xEC, 0xD2 } }, \
+  { 0x4EFA0DB6, 0x26DC, 0x4BB1, { 0xA7, 0x6F, 0x14, 0xBC, 0x63, 0x0C, 0x7B, 0x3C } }, \
+  { 0xACC8E1E4, 0x9F9F, 0x4E40, { 0xA5, 0x7E, 0xF9, 0x9E, 0x52, 0xF3, 0x4C, 0xA5 } }, \
+  { 0xD7AC94AF, 0xA498, 0x45EC, { 0xBF, 0xA2, 0xA5, 0x6E, 0x95, 0x34, 0x61, 0x8B } }, \
+  { 0x6046E678, 0x24EF, 0x4005, { 0xBA, 0x39, 0xBD, 0xA1, 0x1F, 0x6D, 0x55, 0x5D } }, \
+  { 0xFB045DB2, 0x598E, 0x485A, { 0xBA, 0x30, 0x5D, 0x7B, 0x1B, 0x1B, 0xD5, 0x4D } }, \
+  { 0x4A3CA68B, 0x7723, 0x48FB, { 0x80, 0x3D, 0x57, 0x8C, 0xC1, 0xFE, 0xC4, 0x4D } }, \
+  { 0xEA816D2C, 0xCEE5, 0x4F02, { 0x99, 0xB5, 0xD3, 0x90, 0x5C, 0xBB, 0xD0, 0x77 } }, \
+  { 0x532B6532, 0x6499, 0x428D, { 0xAC, 0xB1, 0xF6, 0xF7, 0x79, 0xC9, 0x4D, 0xF9 } }, \
+  { 0xDBC9FD21, 0xFAD8, 0x45B0, { 0x9E, 0x78, 0x27, 0x15, 0x88, 0x67, 0xCC, 0x93 } }, \
+  { 0x3AA83745, 0x9454, 0x4F7A, { 0xA7, 0xC0, 0x90, 0xDB, 0xD0, 0x2F, 0xAB, 0x8E } }, \
+  { 0x0BA8263C, 0xA8BD, 0x4AAD, { 0xB4, 0x02, 0x6A, 0x6A, 0xF2, 0xF7, 0xE7, 0x7D } }, \
+  { 0xEF152FB4, 0x7B2F, 0x427D, { 0xBD, 0xB4, 0x7E, 0x0A, 0x05, 0x82, 0x6E, 0x64 } }, \
+  { 0x8B33FFE0, 0xD71C, 0x4F82, { 0x9C, 0xEB, 0xC9, 0x70, 0x58, 0xC1, 0x3F, 0x8E } }, \
+  { 0xB4909CF3, 0x7B93, 0x4751, { 0x9B, 0xD8, 0x5B, 0xA8, 0x22, 0x0B, 0x9B, 0xB2 } }, \
+  { 0x052E6EB0, 0xF240, 0x42C5, { 0x83, 0x09, 0x45, 0x87, 0x45, 0x45, 0xC6, 0xB4 } }, \
+  { 0xADFE34C8, 0x9AE1, 0x4F8F, { 0xBE, 0x13, 0xCF, 0x96, 0xA2, 0xCB, 0x2C, 0x5B } }, \
+  { 0xD5367802, 0xB873, 0x4C0F, { 0xB5, 0x44, 0x31, 0xB7, 0xCC, 0xF5, 0xC5, 0x55 } }, \
+  { 0x2DF1E051, 0x906D, 0x4EFF, { 0x86, 0x9D, 0x24, 0xE6, 0x53, 0x78, 0xFB, 0x9E } }, \
+  { 0xEF9A3971, 0xC1A0, 0x4A93, { 0xBD, 0x40, 0x5A, 0xA1, 0x65, 0xF2, 0xDC, 0x3A } }, \
+  { 0x17088572, 0x377F, 0x44EF, { 0x8F, 0x4E, 0xB0, 0x9F, 0xFF, 0x46, 0xA0, 0x70 } }, \
+  { 0xDF665292, 0x79D7, 0x40E2, { 0xBA, 0x51, 0xF7, 0xD4, 0x94, 0x62, 0x81, 0x85 } }, \
+  { 0x3A4E4376, 0x4871, 0x4B0E, { 0xA0, 0x2F, 0xED, 0x36, 0xF2, 0xAE, 0xCD, 0x00 } }, \
+  { 0x6865C455, 0x8626, 0x40D8, { 0x90, 0xF4, 0xA6, 0x94, 0x60, 0xA4, 0xAB, 0x5A } }, \
+  { 0x97CA1A5B, 0xB760, 0x4D1F, { 0xA5, 0x4B, 0xD1, 0x90, 0x92, 0x03, 0x2C, 0x90 } }, \
+  { 0x16271FCA, 0x55D9, 0x4A33, { 0x93, 0xFC, 0x5A, 0x3E, 0xB1, 0x28, 0xDE, 0xB6 } }, \
+  { 0x221F1D4F, 0x034C, 0x4BEA, { 0xB2, 0xBB, 0xB7, 0xA9, 0x67, 0x2B, 0x06, 0xD7 } }, \
+  { 0x333BB2A3, 0x4F20, 0x4C8B, { 0xAC, 0x38, 0x06, 0x72, 0xD7, 0x43, 0x15, 0xF8 } }, \
+  { 0x6E59DF06, 0x62D3, 0x40B0, { 0x82, 0xB5, 0x17, 0x5C, 0xF8, 0x4A, 0x94, 0xE4 } }, \
+  { 0xB7D19491, 0xE55A, 0x470D, { 0x85, 0x08, 0x85, 0xA5, 0xDF, 0xA4, 0x19, 0x74 } }, \
+  { 0xBFE205C9, 0x5B17, 0x4F8F, { 0x93, 0x75, 0x89, 0x61, 0x4A, 0xF8, 0xE1, 0x99 } }, \
+  { 0xC1FBD624, 0x27EA, 0x40D1, { 0xAA, 0x48, 0x94, 0xC3, 0xDC, 0x5C, 0x7E, 0x0D } }, \
+  { 0x0D1ED2F7, 0xE92B, 0x4562, { 0x92, 0xDD, 0x5C, 0x82, 0xEC, 0x91, 0x7E, 0xAE } }, \
+  { 0xDFD8D5CC, 0x5AED, 0x4820, { 0xA2, 0xB6, 0x5C, 0x55, 0xE4, 0xE6, 0x40, 0xEF } }, \
+  { 0x79AA6086, 0x035A, 0x4AD9, { 0xA8, 0x9A, 0xA6, 0xD5, 0xAA, 0x27, 0xF0, 0xE2 } }, \
+  { 0xE4ECD0B2, 0xE277, 0x4F2B, { 0xBE, 0xCB, 0xE4, 0xD7, 0x5C, 0x9A, 0x81, 0x2E } }, \
+  { 0xE23F86E1, 0x056E, 0x4888, { 0xB6, 0x85, 0xCF, 0xCD, 0x67, 0xC1, 0x79, 0xD4 } }, \
+  { 0xF6C73719, 0xF34C, 0x479C, { 0xB3, 0x2F, 0x27, 0x7F, 0xCB, 0xBC, 0xFE, 0x4F } }, \
+  { 0xCE673A28, 0x800D, 0x4B4A, { 0x83, 0x16, 0x26, 0x61, 0xF9, 0xB3, 0xD9, 0xC6 } }, \
+  { 0x5C6FA2C9, 0x9768, 0x45F6, { 0x8E, 0x64, 0x5A, 0xEC, 0xCA, 0xDA, 0xB4, 0x81 } }, \
+  { 0xE223CF65, 0xF6CE, 0x4122, { 0xB3, 0xAF, 0x4B, 0xD1, 0x8A, 0xFF, 0x40, 0xA1 } }, \
+  { 0x00E98021, 0xF4FE, 0x46CC, { 0xAB, 0x2D, 0x89, 0x4C, 0x37, 0x3A, 0xFA, 0x01 } }, \
+  { 0xB2AB115E, 0xC8B6, 0x4036, { 0xBF, 0x31, 0xE7, 0x4B, 0xD8, 0x92, 0x6C, 0xCE } }, \
+  { 0xCD2333D7, 0x6A0A, 0x4C76, { 0x83, 0x50, 0x24, 0x0A, 0xDA, 0x36, 0xA2, 0xC7 } }, \
+  { 0x6199DC36, 0xE114, 0x4E0D, { 0x80, 0x99, 0x99, 0xA0, 0xBD, 0x80, 0xA9, 0x71 } }, \
+  { 0x20DAF0FC, 0x5548, 0x44DC, { 0xA4, 0x2A, 0x60, 0xEA, 0xF0, 0xA2, 0x2E, 0x47 } }, \
+  { 0x43F66FFD, 0xB288, 0x4139, { 0xBA, 0xD5, 0xB8, 0x98, 0x03, 0xE7, 0x30, 0xA2 } }, \
+  { 0xB63BF800, 0xF267, 0x4F55, { 0x92, 0x17, 0xE9, 0x7F, 0xB3, 0xB6, 0x98, 0x46 } }, \
+  { 0x8555FD40, 0x140B, 0x4F3C, { 0x90, 0x5E, 0x3B, 0xF3, 0x78, 0xA0, 0x99, 0xFA } }, \
+  { 0x67820532, 0x7613, 0x4DD3, { 0x9E, 0xD7, 0x3D, 0x9B, 0xE3, 0xA7, 0xDA, 0x63 } }, \
+  { 0xCC93A70B, 0xEC27, 0x49C5, { 0x8B, 0x34, 0x13, 0x93, 0x1E, 0xFE, 0xD6, 0xE2 } }, \
+  { 0xF496922D, 0x172F, 0x4BBC, { 0xA1, 0xEB, 0x0E, 0xEB, 0x94, 0x9C, 0x34, 0x86 } }, \
+  { 0x120D28AA, 0x6630, 0x46F0, { 0x81, 0x57, 0xC0, 0xAD, 0xC2, 0x38, 0x3B, 0xF5 } }, \
+  { 0x995188B1, 0x9F96, 0x11D4, { 0x87, 0xAE, 0x00, 0x06, 0x29, 0x2E, 0x8A, 0x3B } }, \
+  { 0xB979746A, 0x8C1F, 0x4A2B, { 0x97, 0xE4, 0x78, 0xE9, 0x3A, 0x71, 0xA7, 0x0A } }, \
+  { 0xFAC2EFAD, 0x8511, 0x4E34, { 0x9C, 0xAE, 0x16, 0xA2, 0x57, 0xBA, 0x94, 0x88 } }, \
+  { 0x8B34EAC7, 0x2690, 0x460B, { 0x8B, 0xA5, 0xD5, 0xCF, 0x32, 0x83, 0x17, 0x35 } }, \
+  { 0xCBBEE336, 0x2682, 0x4CD6, { 0x81, 0x8B, 0x0A, 0x0D, 0x96, 0x7E, 0x5A, 0x67 } }, \
+  { 0x5A6A93F4, 0x2907, 0x4A34, { 0xBD, 0x11, 0x6C, 0xA8, 0xA0, 0x95, 0x9E, 0x09 } }, \
+  { 0x64C475EF, 0x344B, 0x492C, { 0x93, 0xAD, 0xAB, 0x9E, 0xB4, 0x39, 0x50, 0x04 } }, \
+  { 0x368CDA0D, 0xCF31, 0x4B9B, { 0x8C, 0xF6, 0xE7, 0xD1, 0xBF, 0xFF, 0x15, 0x7E } }, \
+  { 0xF064C91F, 0x188C, 0x4F56, { 0xB7, 0xFD, 0x30, 0xA9, 0xB8, 0x6A, 0x29, 0xF3 } }, \
+  { 0x9A44198E, 0xA4A2, 0x44E6, { 0x8A, 0x1F, 0x39, 0xBE, 0xFD, 0xAC, 0x89, 0x6F } }, \
+  { 0xBE499C92, 0x7D4B, 0x11D4, { 0xBC, 0xEE, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x67EF7A73, 0x2594, 0x4A5E, { 0x93, 0x0A, 0xE1, 0x66, 0xFA, 0xBC, 0xD2, 0xC8 } }, \
+  { 0x9851740C, 0x22E0, 0x440D, { 0x90, 0x90, 0xEF, 0x2D, 0x71, 0xC2, 0x51, 0xC9 } }, \
+  { 0x62CEEF5A, 0x1D7C, 0x4943, { 0x9B, 0x3A, 0x95, 0xE2, 0x49, 0x4C, 0x89, 0x90 } }, \
+  { 0x7578B307, 0xB25B, 0x44F9, { 0x89, 0x2E, 0x20, 0x9B, 0x0E, 0x39, 0x93, 0xC6 } }, \
+  { 0x6EA0F71C, 0x614A, 0x437E, { 0x8F, 0x49, 0x24, 0x3A, 0xD4, 0xE8, 0x32, 0x68 } }, \
+  { 0xD5E4EE5F, 0x3E0A, 0x453C, { 0xA7, 0x25, 0xB6, 0x92, 0xBB, 0x06, 0x36, 0x5A } }, \
+  { 0x76B75C23, 0xFE4F, 0x4E17, { 0xA2, 0xAD, 0x1A, 0x65, 0x3D, 0xBB, 0x49, 0x4A } }, \
+  { 0x4A153B6E, 0x85A1, 0x4982, { 0x98, 0xF4, 0x6A, 0x8C, 0xFC, 0xA4, 0xAB, 0xA1 } }, \
+  { 0x04356799, 0x81B7, 0x4E08, { 0xA3, 0x8D, 0xD9, 0x78, 0xFA, 0x47, 0xBA, 0x42 } }, \
+  { 0x38802700, 0x868A, 0x4B4E, { 0x81, 0xD4, 0x4F, 0x1B, 0xDC, 0xCF, 0xB4, 0x6F } }, \
+  { 0xC1A74056, 0x260E, 0x4871, { 0xA0, 0x31, 0xE6, 0x45, 0xA6, 0x5B, 0x6E, 0x11 } }, \
+  { 0x7AA35A69, 0x506C, 0x444F, { 0xA7, 0xAF, 0x69, 0x4B, 0xF5, 0x6F, 0x71, 0xC8 } }, \
+  { 0xB7084E63, 0x46B7, 0x4D1A, { 0x86, 0x77, 0xE3, 0x0B, 0x53, 0xDB, 0xF0, 0x50 } }, \
+  { 0x3F557189, 0x8DAE, 0x45AE, { 0xA0, 0xB3, 0x2B, 0x99, 0xCA, 0x7A, 0xA7, 0xA0 } }, \
+  { 0x53A4C71B, 0xB581, 0x4170, { 0x91, 0xB3, 0x8D, 0xB8, 0x7A, 0x4B, 0x5C, 0x46 } }, \
+  { 0xB5D09084, 0x80AD, 0x4759, { 0xB5, 0x1C, 0x27, 0x54, 0x8A, 0xFB, 0x8B, 0x8D } }, \
+  { 0xFD44820B, 0xF1AB, 0x41C0, { 0xAE, 0x4E, 0x0C, 0x55, 0x55, 0x6E, 0xB9, 0xBD } }, \
+  { 0x2A57AE75, 0x8B7A, 0x4C64, { 0x86, 0x56, 0xDB, 0x51, 0xDD, 0xC3, 0x6F, 0x7B } }, \
+  { 0x94D411B7, 0x7669, 0x45C3, { 0xBA, 0x3B, 0xF3, 0xA5, 0x8A, 0x71, 0x56, 0x81 } }, \
+  { 0xCD361957, 0xAFBE, 0x425E, { 0xA3, 0x58, 0x5F, 0x58, 0x89, 0xCF, 0xFE, 0x7B } }, \
+  { 0xF1E48287, 0x3FE1, 0x4535, { 0x89, 0xAB, 0x48, 0xD6, 0xC3, 0xDA, 0x27, 0x59 } }, \
+  { 0xBE644001, 0xE7D4, 0x48B1, { 0xB0, 0x96, 0x8B, 0xA0, 0x47, 0xBC, 0x7A, 0xE7 } }, \
+  { 0x956A2ED0, 0xA6CF, 0x409A, { 0xB8, 0xF5, 0x35, 0xF1, 0x4C, 0x3E, 0x3C, 0x02 } }, \
+  { 0x79E8C9C7, 0x1152, 0x4F00, { 0xB8, 0x31, 0x14, 0xF1, 0xC4, 0x04, 0x1A, 0xE0 } }, \
+  { 0xD4A28A3E, 0xDCF2, 0x43CF, { 0xA2, 0xB7, 0xF3, 0x57, 0x2A, 0x7C, 0xAB, 0x09 } }, \
+  { 0x89DEEF37, 0x31D8, 0x469C, { 0x95, 0xB6, 0x01, 0x69, 0xBC, 0x86, 0x6C, 0xFB } }, \
+  { 0x8E008510, 0x9BB1, 0x457D, { 0x9F, 0x70, 0x89, 0x7A, 0xBA, 0x86, 0x5D, 0xB9 } }, \
+  { 0x4C51A7BA, 0x7195, 0x442D, { 0x87, 0x92, 0xBE, 0xEA, 0x6E, 0x2F, 0xF6, 0xEC } }, \
+  { 0xA062CF1F, 0x8473, 0x4AA3, { 0x87, 0x93, 0x60, 0x0B, 0xC4, 0xFF, 0xA9, 0xA9 } }, \
+  { 0x7CC7ED80, 0x9A68, 0x4781, { 0x80, 0xE4, 0xDA, 0x16, 0x99, 0x10, 0x5A, 0xFE } }, \
+  { 0x1D7ADD6E, 0xB2DA, 0x4B0B, { 0xB2, 0x9F, 0x49, 0xCB, 0x42, 0xF4, 0x63, 0x56 } }, \
+  { 0x1767CEED, 0xDB82, 0x47CD, { 0xBF, 0x2B, 0x68, 0x45, 0x8A, 0x8C, 0xCF, 0xFF } }, \
+  { 0xD50234F4, 0x6F4B, 0x43E8, { 0xA0, 0x13, 0x3C, 0x1E, 0x33, 0xD9, 0xB9, 0xB1 } }, \
+  { 0x1BAD711C, 0xD451, 0x4241, { 0xB1, 0xF3, 0x85, 0x37, 0x81, 0x2E, 0x0C, 0x70 } }, \
+  { 0xE1A21D94, 0x4A20, 0x4E0E, { 0xAE, 0x09, 0xA9, 0xA2, 0x1F, 0x24, 0xBB, 0x9E } }, \
+  { 0x86AD232B, 0xD33A, 0x465C, { 0xBF, 0x5F, 0x41, 0x37, 0x0B, 0xA9, 0x2F, 0xE2 } }, \
+  { 0x62512C92, 0x63C4, 0x4D80, { 0x82, 0xB1, 0xC1, 0xA4, 0xDC, 0x44, 0x80, 0xE5 } }, \
+  { 0xF50E702C, 0x8653, 0x4CDE, { 0xBB, 0xCE, 0x43, 0xB4, 0xD5, 0x5B, 0x34, 0xB8 } }, \
+  { 0xFF2D54D4, 0x5C55, 0x4C06, { 0x85, 0x49, 0xC3, 0x62, 0x7C, 0xB8, 0xB9, 0x95 } }, \
+  { 0xD7BD52B0, 0xB2DC, 0x4F08, { 0xB4, 0x67, 0xDE, 0x50, 0xD7, 0x28, 0xF6, 0xBD } }, \
+  { 0x0DCA3D4D, 0x12DA, 0x4728, { 0xBF, 0x7E, 0x86, 0xCE, 0xB9, 0x28, 0xD0, 0x67 } }, \
+  { 0xD8944553, 0xC4DD, 0x41F4, { 0x9B, 0x30, 0xE1, 0x39, 0x7C, 0xFB, 0x26, 0x7B } }, \
+  { 0x68B81E51, 0x2583, 0x4582, { 0x95, 0xDB, 0xC5, 0x72, 0x32, 0x36, 0xC4, 0xF1 } }, \
+  { 0x7644C181, 0xFA6E, 0x46DA, { 0x80, 0xCB, 0x04, 0xB9, 0x90, 0x40, 0x62, 0xE8 } }, \
+  { 0xCA54F443, 0x1EF2, 0x4DAB, { 0x9E, 0x7E, 0x6D, 0xB7, 0xB7, 0x20, 0xB5, 0x87 } }, \
+  { 0xC38E6D34, 0x5A7F, 0x4BF9, { 0xBE, 0x57, 0x94, 0xDD, 0x30, 0x38, 0x02, 0x76 } }, \
+  { 0x271DD6F2, 0x54CB, 0x45E6, { 0x85, 0x85, 0x8C, 0x92, 0x3C, 0x1A, 0xC7, 0x06 } }, \
+  { 0x0B280816, 0x52E7, 0x4E51, { 0xAA, 0x57, 0x11, 0xBD, 0x41, 0xCB, 0xEF, 0xC3 } }, \
+  { 0xF238F47C, 0x1DE9, 0x4E8B, { 0x81, 0xB9, 0xCC, 0x92, 0x4E, 0x6B, 0x5B, 0xE5 } }, \
+  { 0xFFECFFFF, 0x923C, 0x14D2, { 0x9E, 0x3F, 0x22, 0xA0, 0xC9, 0x69, 0x56, 0x3B } }, \
+  { 0xD9035175, 0x8CE2, 0x47DE, { 0xA8, 0xB8, 0xCC, 0x98, 0xE5, 0xE2, 0xA8, 0x85 } }, \
+  { 0x0859BA18, 0x7DD7, 0x4ED7, { 0xA8, 0x8E, 0x10, 0x9C, 0x63, 0x91, 0x7B, 0xDD } }, \
+  { 0x6C50CDCB, 0x7F46, 0x4DCC, { 0x8D, 0xDD, 0xD9, 0xF0, 0xA3, 0xC6, 0x11, 0x28 } }, \
+  { 0xD71DB106, 0xE32D, 0x4225, { 0xBF, 0xF4, 0xDE, 0x6D, 0x77, 0x87, 0x17, 0x61 } }, \
+  { 0xE451DCBE, 0x96A1, 0x4729, { 0xA5, 0xCF, 0x6B, 0x9C, 0x2C, 0xFF, 0x47, 0xFD } }, \
+  { 0x62BDF38A, 0xE3D5, 0x492C, { 0x95, 0x0C, 0x23, 0xA7, 0xF6, 0x6E, 0x67, 0x2E } }, \
+  { 0x5A68191B, 0x9B97, 0x4752, { 0x99, 0x46, 0xE3, 0x6A, 0x5D, 0xA9, 0x42, 0xB1 } }, \
+  { 0xC1544C01, 0x92A4, 0x4198, { 0x8A, 0x84, 0x77, 0x85, 0x83, 0xC2, 0x36, 0x21 } }, \
+  { 0x03C4E624, 0xAC28, 0x11D3, { 0x9A, 0x2D, 0x00, 0x90, 0x29, 0x3F, 0xC1, 0x4D } }, \
+  { 0x493B5BAC, 0xBB9E, 0x4BF5, { 0x83, 0x79, 0x20, 0xE2, 0xAC, 0xA9, 0x85, 0x41 } }, \
+  { 0xF281FC6E, 0xF4C4, 0x431C, { 0x96, 0x2B, 0x2F, 0x13, 0xAE, 0x79, 0x84, 0xEC } }, \
+  { 0xF52C3858, 0x5EF8, 0x4D41, { 0x83, 0x4E, 0xC3, 0x9E, 0xEF, 0x8A, 0x45, 0xA3 } }, \
+  { 0xC57AD6B7, 0x0515, 0x40A8, { 0x9D, 0x21, 0x55, 0x16, 0x52, 0x85, 0x4E, 0x37 } }, \
+  { 0xC723F288, 0x52F9, 0x4D80, { 0xB6, 0x33, 0xE1, 0x52, 0xF9, 0x30, 0xA0, 0xDC } }, \
+  { 0x0903DD14, 0x2CA0, 0x458A, { 0xB5, 0xEB, 0x0C, 0x0C, 0xA3, 0x0D, 0x78, 0x5C } }, \
+  { 0xE380280C, 0x4C35, 0x4AA3, { 0xB9, 0x61, 0x7A, 0xE4, 0x89, 0xA2, 0xB9, 0x26 } }, \
+  { 0x4B3082A3, 0x80C6, 0x4D7E, { 0x9C, 0xD0, 0x58, 0x39, 0x17, 0x26, 0x5D, 0xF1 } }, \
+  { 0xDAF4BF89, 0xCE71, 0x4917, { 0xB5, 0x22, 0xC8, 0x9D, 0x32, 0xFB, 0xC5, 0x9F } }, \
+  { 0xE512DFE4, 0xBF44, 0x480D, { 0x9B, 0x7A, 0x77, 0x7B, 0x0B, 0xE3, 0x27, 0x75 } }, \
+  { 0xE5D3026A, 0x1CA5, 0x40F0, { 0x8F, 0xB6, 0x4B, 0x1A, 0xFA, 0x3C, 0x6E, 0xAA } }, \
+  { 0xDB7F536B, 0xEDE4, 0x4714, { 0xA5, 0xC8, 0xE3, 0x46, 0xEB, 0xAA, 0x20, 0x1D } }, \
+  { 0xFCDF7788, 0x7878, 0x11FF, { 0xCC, 0x77, 0x88, 0xCC, 0xCC, 0x77, 0x88, 0xCC } }, \
+  { 0xA56897A1, 0xA77F, 0x4600, { 0x84, 0xDB, 0x22, 0xB0, 0xA8, 0x01, 0xFA, 0x9A } }, \
+  { 0x395C33FE, 0x287F, 0x413E, { 0xA0, 0x55, 0x80, 0x88, 0xC0, 0xE1, 0xD4, 0x3E } }, \
+  { 0x0E2D6BB1, 0xC624, 0x446D, { 0x99, 0x82, 0x69, 0x3C, 0xD1, 0x81, 0xA6, 0x07 } }, \
+  { 0x2A82FCE6, 0x8BB6, 0x413E, { 0xB9, 0xEB, 0x45, 0xDF, 0xC0, 0x52, 0x2D, 0xF3 } }, \
+  { 0xEC7F4FA1, 0xB217, 0x42FC, { 0xA7, 0xF7, 0x02, 0x0C, 0x43, 0x05, 0xD5, 0xBA } }, \
+  { 0x5F67D40C, 0x1D06, 0x4E3E, { 0x8B, 0x4A, 0xD2, 0x71, 0x3F, 0x46, 0xE1, 0xDC } }, \
+  { 0xC9DCF469, 0xA7C4, 0x11D5, { 0x87, 0xDA, 0x00, 0x06, 0x29, 0x45, 0xC3, 0xB9 } }, \
+  { 0xD98E3EA3, 0x6F39, 0x4BE4, { 0x82, 0xCE, 0x5A, 0x89, 0x0C, 0xCB, 0x2C, 0x95 } }, \
+  { 0xDA571595, 0x4D99, 0x487C, { 0x82, 0x7C, 0x26, 0x22, 0x67, 0x7D, 0x33, 0x07 } }, \
+  { 0xAB359CE3, 0x99B3, 0xAE18, { 0xC8, 0x9D, 0x95, 0xD3, 0xB0, 0x72, 0xE1, 0x9B } }, \
+  { 0x3BC2BD12, 0xAD2E, 0x11D5, { 0x87, 0xDD, 0x00, 0x06, 0x29, 0x45, 0xC3, 0xB9 } }, \
+  { 0xA356AB39, 0x35C4, 0x35DA, { 0xB3, 0x7A, 0xF8, 0xEA, 0x9E, 0x8B, 0x36, 0xA3 } }, \
+  { 0xD6E5092D, 0xC7B2, 0x4872, { 0xAF, 0x66, 0xFD, 0xC0, 0xE6, 0xF9, 0x5E, 0x78 } }, \
+  { 0xAAB16018, 0x679D, 0x4461, { 0xBA, 0x20, 0xE7, 0x0C, 0xF7, 0x86, 0x6A, 0x9B } }, \
+  { 0x5F7D4E0E, 0x3D6D, 0x42BC, { 0xA9, 0x42, 0x0E, 0x91, 0xE8, 0x3E, 0x3C, 0x31 } }, \
+  { 0x8C4C9A41, 0xBF56, 0x4627, { 0x9E, 0x0A, 0xC8, 0x38, 0x6D, 0x66, 0x11, 0x5C } }, \
+  { 0xBBB810BB, 0x5EF0, 0x4E8F, { 0xB2, 0x98, 0xAD, 0x74, 0xAA, 0x50, 0xEF, 0x0A } }, \
+  { 0x02B3D5F2, 0xAC28, 0x11D3, { 0x9A, 0x2D, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x5187359B, 0x790D, 0x425B, { 0xA5, 0x93, 0xCA, 0x1C, 0xDB, 0x3C, 0xEB, 0xAD } }, \
+  { 0x6D3569D4, 0x85E5, 0x4943, { 0xAE, 0x46, 0xEE, 0x67, 0xA6, 0xE1, 0xAB, 0x5A } }, \
+  { 0xE84CF29C, 0x191F, 0x4EAE, { 0x96, 0xE1, 0xF4, 0x6A, 0xEC, 0xEA, 0xEA, 0x0B } }, \
+  { 0x9D0DA369, 0x540B, 0x46F8, { 0x85, 0xA0, 0x2B, 0x5F, 0x2C, 0x30, 0x1E, 0x15 } }, \
+  { 0xA0C6D918, 0x8DEE, 0x41BB, { 0x9D, 0x92, 0x67, 0x53, 0xA5, 0x72, 0xB6, 0x52 } }, \
+  { 0x601211DC, 0x0B12, 0x4C09, { 0xAE, 0x27, 0xAB, 0x0E, 0xC9, 0x69, 0x24, 0x68 } }, \
+  { 0xC56FB1B2, 0x017B, 0x4984, { 0xA3, 0xF6, 0x3F, 0x73, 0x4F, 0xFA, 0x9E, 0x33 } }, \
+  { 0xA45B3A0D, 0x2E55, 0x4C03, { 0xAD, 0x9C, 0x27, 0xD4, 0x82, 0x0B, 0x50, 0x7E } }, \
+  { 0x2B2F68DA, 0x0CD2, 0x44CF, { 0x8E, 0x8B, 0xBB, 0xA2, 0x0B, 0x1B, 0x5B, 0x75 } }, \
+  { 0x5859CB76, 0x6BEF, 0x468A, { 0xBE, 0x2D, 0xB3, 0xDD, 0x1A, 0x27, 0xF0, 0x12 } }, \
+  { 0x2AD8E2D2, 0x2E91, 0x4CD1, { 0x95, 0xF5, 0xE7, 0x8F, 0xE5, 0xEB, 0xE3, 0x16 } }, \
+  { 0xF088CD91, 0xA046, 0x11D2, { 0x8E, 0x42, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x745D377A, 0xB988, 0x47B2, { 0xB1, 0x8F, 0xBB, 0xC8, 0x0D, 0xC5, 0x66, 0x98 } }, \
+  { 0xADDEBF82, 0xA560, 0x46B9, { 0xA2, 0x80, 0x78, 0xC6, 0xAB, 0x61, 0xAE, 0xDA } }, \
+  { 0xA43B03DC, 0xC18A, 0x41B1, { 0x91, 0xC8, 0x3F, 0xF9, 0xAA, 0xA2, 0x57, 0x13 } }, \
+  { 0x0FBA43B8, 0xACDB, 0x4EE2, { 0xAB, 0x31, 0x0F, 0xA4, 0xD5, 0xB6, 0xC3, 0xC5 } }, \
+  { 0xB540A530, 0x6978, 0x4DA7, { 0x91, 0xCB, 0x72, 0x07, 0xD7, 0x64, 0xD2, 0x62 } }, \
+  { 0x2EBE0275, 0x6458, 0x4AF9, { 0x91, 0xED, 0xD3, 0xF4, 0xED, 0xB1, 0x00, 0xAA } }, \
+  { 0x3FD1D3A2, 0x99F7, 0x420B, { 0xBC, 0x69, 0x8B, 0xB1, 0xD4, 0x92, 0xA3, 0x32 } }, \
+  { 0xBC412D75, 0x2729, 0x4C3A, { 0xB1, 0x93, 0x5B, 0x9A, 0x58, 0x8F, 0xF6, 0x6F } }, \
+  { 0x755B6596, 0x6896, 0x4BA3, { 0xB3, 0xDD, 0x1C, 0x62, 0x9F, 0xD1, 0xEA, 0x88 } }, \
+  { 0xECB867AB, 0x8DF4, 0x492D, { 0x81, 0x50, 0xA7, 0xFD, 0x1B, 0x9B, 0x5A, 0x75 } }, \
+  { 0x974231D5, 0xED4B, 0x44D1, { 0x88, 0x70, 0xCE, 0x51, 0x5C, 0xC1, 0x4D, 0x68 } }, \
+  { 0xDAC2B117, 0xB5FB, 0x4964, { 0xA3, 0x12, 0x0D, 0xCC, 0x77, 0x06, 0x1B, 0x9B } }, \
+  { 0x444C3203, 0xF8B1, 0x42A7, { 0xAB, 0xE9, 0x2E, 0x58, 0x02, 0x5B, 0xE1, 0x2A } }, \
+  { 0xB5C59087, 0xFEAC, 0x4B41, { 0x9D, 0x80, 0x79, 0x0B, 0xA5, 0xAA, 0x07, 0x0F } }, \
+  { 0xAD77AE29, 0x4C20, 0x4FDD, { 0x85, 0x04, 0x81, 0x76, 0x61, 0x9B, 0x67, 0x6A } }, \
+  { 0xCE6F86BB, 0xB800, 0x4C71, { 0xB2, 0xD1, 0x38, 0x97, 0xA3, 0xBC, 0x1D, 0xAE } }, \
+  { 0x9401BD4F, 0x1A00, 0x4990, { 0xAB, 0x56, 0xDA, 0xF0, 0xE4, 0xE3, 0x48, 0xDE } }, \
+  { 0x1FD29BE6, 0x70D0, 0x42A4, { 0xA6, 0xE7, 0xE5, 0xD1, 0x0E, 0x6A, 0xC3, 0x76 } }, \
+  { 0x97E409E6, 0x4CC1, 0x11D9, { 0x81, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, \
+  { 0x220AC432, 0x1D43, 0x49E5, { 0xA7, 0x4F, 0x4C, 0x9D, 0xA6, 0x7A, 0xD2, 0x3B } }, \
+  { 0x8E8CBC58, 0x834C, 0x41E3, { 0xB8, 0xCA, 0xF0, 0x0C, 0xCF, 0x5A, 0x71, 0x7C } }, \
+  { 0x64192DCA, 0xD034, 0x49D2, { 0xA6, 0xDE, 0x65, 0xA8, 0x29, 0xEB, 0x4C, 0x74 } }, \
+  { 0x7B77FB8B, 0x1E0D, 0x4D7E, { 0x95, 0x3F, 0x39, 0x80, 0xA2, 0x61, 0xE0, 0x77 } }, \
+  { 0x8AA67071, 0x8BEC, 0x47AB, { 0x83, 0xC8, 0xCD, 0x0E, 0xB7, 0x23, 0xD0, 0x72 } }, \
+  { 0xE159A956, 0x3299, 0x4EE9, { 0x91, 0x76, 0x65, 0x18, 0x1A, 0x4E, 0x5E, 0x9F } }, \
+  { 0x20E28787, 0xDF32, 0x4BDA, { 0xB7, 0xE7, 0xCB, 0xBD, 0xA3, 0x37, 0x1E, 0xF8 } }, \
+  { 0x51AA65FC, 0x82B6, 0x49E6, { 0x95, 0xE2, 0xE6, 0x82, 0x7A, 0x8D, 0x7D, 0xB4 } }, \
+  { 0x67BC3883, 0x7E79, 0x4BC1, { 0xA3, 0x3E, 0x3A, 0xF7, 0xD1, 0x75, 0x89, 0xBA } }, \
+  { 0xF4F63529, 0x281E, 0x4040, { 0xA3, 0x13, 0xC1, 0xD6, 0x76, 0x63, 0x84, 0xBE } }, \
+  { 0x69967A8C, 0x1159, 0x4522, { 0xAA, 0x89, 0x74, 0xCD, 0xC6, 0xE5, 0x99, 0xA0 } }, \
+  { 0x5578AE16, 0xF1C9, 0x4E8F, { 0xB1, 0x29, 0xBA, 0x07, 0xF8, 0xFC, 0xF8, 0x4A } }, \
+  { 0xFFBD9AD2, 0xF1DB, 0x4F92, { 0xA6, 0x49, 0xEB, 0x9E, 0xED, 0xEA, 0x86, 0xB5 } }, \
+  { 0x60AC3A8F, 0x4D66, 0x4CD4, { 0x89, 0x5A, 0xC3, 0xF0, 0x6E, 0x66, 0x65, 0xEE } }, \
+  { 0xA5559F06, 0x6415, 0x4759, { 0x88, 0x69, 0xDE, 0x15, 0xF9, 0xCD, 0x9C, 0x9B } }, \
+  { 0xD3BFE2DE, 0x3DAF, 0x11DF, { 0xBA, 0x40, 0xE3, 0xA5, 0x56, 0xD8, 0x95, 0x93 } }, \
+  { 0xD231DB5B, 0x4A9C, 0x4092, { 0xA8, 0xC5, 0x9C, 0xA0, 0xBC, 0x7D, 0x6A, 0xA6 } }, \
+  { 0x65639144, 0xD492, 0x4328, { 0xA4, 0x98, 0xF4, 0xB5, 0x54, 0x5E, 0x4A, 0x30 } }, \
+  { 0xF9F0B131, 0xF346, 0x4F16, { 0x80, 0xDD, 0xF9, 0x41, 0x07, 0x2B, 0x3A, 0x7D } }, \
+  { 0x42BBACA3, 0x7161, 0x4891, { 0xAC, 0x10, 0xC7, 0x5E, 0x2E, 0x4D, 0xF6, 0x14 } }, \
+  { 0x01AB1829, 0xCECD, 0x4CFA, { 0xA1, 0x8C, 0xEA, 0x75, 0xD6, 0x6F, 0x3E, 0x74 } }, \
+  { 0x985EEE91, 0xBCAC, 0x4238, { 0x87, 0x78, 0x57, 0xEF, 0xDC, 0x93, 0xF2, 0x4E } }, \
+  { 0xE5D0875A, 0xF647, 0x4E16, { 0xBE, 0x4D, 0x95, 0x02, 0x40, 0x29, 0xCC, 0x44 } }, \
+  { 0x7C81C66A, 0x4F11, 0x47AB, { 0x82, 0xD3, 0x67, 0xC4, 0xD6, 0x35, 0xAE, 0xD1 } }, \
+  { 0x0732BD39, 0xD6B0, 0x4039, { 0xB6, 0xC2, 0x96, 0x54, 0x46, 0x6D, 0xE5, 0x25 } }, \
+  { 0xFEAAA7A6, 0xCB95, 0x4670, { 0xB4, 0x99, 0x87, 0x7F, 0xA6, 0xCA, 0x6B, 0xAE } }, \
+  { 0xB441DF87, 0x8D94, 0x4811, { 0x85, 0xF7, 0x0F, 0x9A, 0x7B, 0xF8, 0x9D, 0x2A } }, \
+  { 0x71A19494, 0x2AB6, 0x4E96, { 0x85, 0x81, 0xCF, 0x34, 0x25, 0x42, 0x73, 0xFE } }, \
+  { 0x78259433, 0x7B6D, 0x4DB3, { 0x9A, 0xE8, 0x36, 0xC4, 0xC2, 0xC3, 0xA1, 0x7D } }, \
+  { 0xB8CDCED7, 0xBDC4, 0x4464, { 0x9A, 0x1A, 0xFF, 0x3F, 0xBD, 0xF7, 0x48, 0x69 } }, \
+  { 0x4EA9D4FE, 0xE6F6, 0x410B, { 0x90, 0x37, 0x0F, 0x98, 0xB5, 0x96, 0x8B, 0x65 } }, \
+  { 0x6707536E, 0x46AF, 0x42D3, { 0x8F, 0x6C, 0x15, 0xF2, 0xF2, 0x02, 0xC2, 0x34 } }, \
+  { 0x4EA9D4FE, 0xE6F6, 0x410B, { 0x80, 0x37, 0x0F, 0x98, 0xB5, 0x96, 0x8B, 0x65 } }, \
+  { 0xD1405D16, 0x7AFC, 0x4695, { 0xBB, 0x12, 0x41, 0x45, 0x9D, 0x36, 0x95, 0xA2 } }, \
+  { 0xC0EC00FD, 0xC2F8, 0x4E47, { 0x90, 0xEF, 0x9C, 0x81, 0x55, 0x28, 0x5B, 0xEC } }, \
+  { 0x54913A6D, 0xF4EE, 0x4CDB, { 0x84, 0x75, 0x74, 0x06, 0x2B, 0xFC, 0xEC, 0xF5 } }, \
+  { 0x595A6EDC, 0x6D2C, 0x474A, { 0x90, 0x82, 0x3B, 0x99, 0x28, 0x51, 0xDF, 0xFE } }, \
+  { 0x05CA01FC, 0x0FC1, 0x11DC, { 0x90, 0x11, 0x00, 0x17, 0x31, 0x53, 0xEB, 0xA8 } }, \
+  { 0x05CA01FD, 0x0FC1, 0x11DC, { 0x90, 0x11, 0x00, 0x17, 0x31, 0x53, 0xEB, 0xA8 } }, \
+  { 0xF4B2C007, 0x94A1, 0x4CD5, { 0xA7, 0x10, 0xF4, 0x14, 0x1F, 0xCE, 0xBC, 0xA0 } }, \
+  { 0x5D206DD3, 0x516A, 0x47DC, { 0xA1, 0xBC, 0x6D, 0xA2, 0x04, 0xAA, 0xBE, 0x08 } }, \
+  { 0x59AF16B0, 0x661D, 0x4865, { 0xA3, 0x81, 0x38, 0xDE, 0x68, 0x38, 0x5D, 0x8D } }, \
+  { 0xF2A128FF, 0x257B, 0x456E, { 0x9D, 0xE8, 0x63, 0xE7, 0xC7, 0xDC, 0xDF, 0xAC } }, \
+  { 0x8DB699CC, 0xBC81, 0x41E2, { 0xAA, 0xC6, 0xD8, 0x1D, 0x53, 0x00, 0xD7, 0x59 } }, \
+  { 0x79CE097A, 0x91AA, 0x41FF, { 0xB3, 0xA8, 0x53, 0x45, 0x59, 0xB3, 0x0D, 0xB1 } }, \
+  { 0x99D5757C, 0xD906, 0x11E0, { 0x8D, 0x78, 0x8D, 0xE4, 0x48, 0x24, 0x01, 0x9B } }, \
+  { 0xDD6C613A, 0x5A77, 0x4B4F, { 0xA6, 0x1E, 0x3B, 0xDD, 0x2A, 0xE2, 0x1D, 0x81 } }, \
+  { 0xC0557EED, 0x9A89, 0x4770, { 0x96, 0x26, 0xFC, 0xA0, 0x51, 0xF2, 0xBA, 0x09 } }, \
+  { 0xA6C0E11E, 0x929E, 0x42B3, { 0x90, 0xCC, 0x4F, 0x77, 0x8E, 0x03, 0xFF, 0x57 } }, \
+  { 0x9E625A27, 0x4840, 0x47CC, { 0xA6, 0xB5, 0x1E, 0x93, 0x11, 0xCF, 0xC6, 0x0E } }, \
+  { 0x6737F69B, 0xB8CC, 0x45BC, { 0x93, 0x27, 0xCC, 0xF5, 0xEE, 0xF7, 0x0C, 0xDE } }, \
+  { 0xA60C7DCD, 0x512F, 0x4F02, { 0xB1, 0x80, 0x52, 0x2E, 0x01, 0x5E, 0x06, 0xB7 } }, \
+  { 0x3FEEC852, 0xF14C, 0x4E7F, { 0x97, 0xFD, 0x4C, 0x3A, 0x8C, 0x5B, 0xBE, 0xCC } }, \
+  { 0x4E0F9BD4, 0xE338, 0x4B26, { 0x84, 0x3E, 0xBD, 0x3A, 0xD9, 0xB2, 0x83, 0x7B } }, \
+  { 0x95DFCAE5, 0xBB28, 0x4D6B, { 0xB1, 0xE2, 0x3A, 0xF3, 0xA6, 0xBF, 0x43, 0x4F } }, \
+  { 0x80E1202E, 0x2697, 0x4264, { 0x9C, 0xC9, 0x80, 0x76, 0x2C, 0x3E, 0x58, 0x63 } }, \
+  { 0xDDE1BC72, 0xD45E, 0x4209, { 0xAB, 0x85, 0x14, 0x46, 0x2D, 0x2F, 0x50, 0x74 } }, \
+  { 0xEE2F45D2, 0x5BA4, 0x441E, { 0x8A, 0x1D, 0xAA, 0x22, 0xDF, 0xA3, 0xB6, 0xC5 } }, \
+  { 0x0DCA793A, 0xEA96, 0x42D8, { 0xBD, 0x7B, 0xDC, 0x7F, 0x68, 0x4E, 0x38, 0xC1 } }, \
+  { 0x88A15A4F, 0x977D, 0x4682, { 0xB1, 0x7C, 0xDA, 0x1F, 0x31, 0x6C, 0x1F, 0x32 } }, \
+  { 0xA33319B5, 0x8EE1, 0x45E0, { 0x8C, 0x9F, 0x80, 0x9F, 0x5B, 0x09, 0x02, 0xCC } }, \
+  { 0x2ACB6627, 0xDF02, 0x4E23, { 0xB4, 0xF9, 0x6A, 0x93, 0xFA, 0x6E, 0x9D, 0xA6 } }, \
+  { 0x5F5D3502, 0x8A4B, 0x40CA, { 0x88, 0xA2, 0x23, 0x05, 0x42, 0x7A, 0x13, 0x1A } }, \
+  { 0xC4975200, 0x64F1, 0x4FB6, { 0x97, 0x73, 0xF6, 0xA9, 0xF8, 0x9D, 0x98, 0x5E } }, \
+  { 0x981CEAEE, 0x931C, 0x4A17, { 0xB9, 0xC8, 0x66, 0xC7, 0xBC, 0xFD, 0x77, 0xE1 } }, \
+  { 0x699ADD70, 0x8554, 0x4993, { 0x83, 0xF6, 0xD2, 0xCD, 0xC0, 0x81, 0xDD, 0x85 } }, \
+  { 0x9221315B, 0x30BB, 0x46B5, { 0x81, 0x3E, 0x1B, 0x1B, 0xF4, 0x71, 0x2B, 0xD3 } }, \
+  { 0x5B232086, 0x350A, 0x42C7, { 0xA7, 0x0E, 0x34, 0x97, 0xB5, 0x76, 0x5D, 0x85 } }, \
+  { 0x6A061113, 0xFE54, 0x4A07, { 0xA2, 0x8E, 0x0A, 0x69, 0x35, 0x9E, 0xB0, 0x69 } }, \
+  { 0xCACB3817, 0x81E6, 0x497E, { 0x87, 0xFF, 0xC8, 0xFA, 0x8F, 0x24, 0xEC, 0x28 } }, \
+  { 0x648CE07B, 0xAE5D, 0x4973, { 0xBD, 0x3C, 0x8C, 0x91, 0x53, 0xC0, 0x5D, 0xC5 } }, \
+  { 0x5820DE98, 0xFC8E, 0x4B0B, { 0xA4, 0xB9, 0x0A, 0x94, 0x0D, 0x16, 0x2A, 0x7E } }, \
+  { 0x964E5B21, 0x6000, 0x23D2, { 0x9E, 0x39, 0x01, 0xA0, 0xC9, 0x69, 0x72, 0x3B } }, \
+  { 0x950C3A26, 0xE0C2, 0x491C, { 0xB6, 0xB2, 0x03, 0x74, 0xF5, 0xC7, 0x3B, 0x96 } }, \
+  { 0x5848FD2D, 0xD6AF, 0x474B, { 0x82, 0x75, 0x95, 0xDD, 0xE7, 0x0A, 0xE8, 0x23 } }, \
+  { 0x429501D9, 0xE447, 0x40F4, { 0x86, 0x7B, 0x75, 0xC9, 0x3A, 0x1D, 0xB5, 0x4E } }, \
+  { 0x882F2546, 0xEF1F, 0x4090, { 0x9F, 0x9C, 0x93, 0x84, 0x5A, 0xD7, 0x84, 0x1C } }, \
+  { 0xE770BB69, 0xBCB4, 0x4D04, { 0x9E, 0x97, 0x23, 0xFF, 0x94, 0x56, 0xFE, 0xAC } }, \
+  { 0x6E605536, 0xA30A, 0x4D56, { 0x93, 0x9E, 0x1C, 0x37, 0x3F, 0x79, 0x8D, 0x7B } }, \
+  { 0xBB6CBEFF, 0xE072, 0x40D2, { 0xA6, 0xEB, 0xBA, 0xB7, 0x5B, 0xDE, 0x87, 0xE7 } }, \
+  { 0xFA8F55E8, 0xAB22, 0x42DD, { 0xB9, 0x16, 0x7D, 0xCE, 0x39, 0x00, 0x25, 0x74 } }, \
+  { 0x3C4852D6, 0xD47B, 0x4F46, { 0xB0, 0x5E, 0xB5, 0xED, 0xC1, 0xAA, 0x43, 0x0A } }, \
+  { 0x7B77FB8B, 0x1E0D, 0x4D7E, { 0x95, 0x3F, 0x39, 0x80, 0xA2, 0x61, 0xE0, 0x76 } }, \
+  { 0xB6460A49, 0x0AC1, 0x484F, { 0xAE, 0x58, 0xF1, 0x6E, 0xB2, 0x39, 0xDB, 0x3D } }, \
+  { 0x2986883F, 0x88E0, 0x48D0, { 0x4B, 0x82, 0x20, 0xC2, 0x69, 0x48, 0xDD, 0xAC } }, \
+  { 0x3D989471, 0xCFAC, 0x46B7, { 0x9B, 0x1C, 0x08, 0x43, 0x01, 0x09, 0x40, 0x2D } }, \
+  { 0xFA2338AD, 0x80DF, 0x49D0, { 0x93, 0x96, 0xCF, 0x71, 0x45, 0xD0, 0x3A, 0x76 } }, \
+  { 0x89E3C1DC, 0xB5E3, 0x4D34, { 0xAE, 0xAD, 0xDD, 0x7E, 0xB2, 0x82, 0x8C, 0x18 } }, \
+  { 0xC4CC0DE8, 0x0687, 0x4422, { 0x99, 0xC1, 0x65, 0x35, 0x1A, 0x5D, 0x5F, 0x95 } }, \
+  { 0x92C7D0BB, 0x679E, 0x479D, { 0x87, 0x8D, 0xD4, 0xB8, 0x29, 0x68, 0x57, 0x8B } }, \
+  { 0x65675786, 0xACCA, 0x4B11, { 0x8A, 0xB7, 0xF8, 0x43, 0xAA, 0x2A, 0x8B, 0xEA } }, \
+  { 0x78CE2354, 0xCFBC, 0x4643, { 0xAE, 0xBA, 0x07, 0xA2, 0x7F, 0xA8, 0x92, 0xBF } }, \
+  { 0xB42B8D12, 0x2ACB, 0x499A, { 0xA9, 0x20, 0xDD, 0x5B, 0xE6, 0xCF, 0x09, 0xB1 } }, \
+  { 0x041FD986, 0xB016, 0x47CE, { 0xAF, 0xC5, 0x22, 0x69, 0xED, 0xD4, 0xAD, 0x64 } }, \
+  { 0x04EAAAA1, 0x29A1, 0x11D7, { 0x88, 0x38, 0x00, 0x50, 0x04, 0x73, 0xD4, 0xEB } }, \
+  { 0x0916E322, 0x3740, 0x31CE, { 0xAD, 0x62, 0xBD, 0x17, 0x2C, 0xEC, 0xCA, 0x36 } }, \
+  { 0x09CE2C2D, 0x4D83, 0x44B8, { 0x97, 0xD0, 0x10, 0x85, 0xEB, 0x54, 0x90, 0xB8 } }, \
+  { 0x0C3798AA, 0xD22E, 0x4DD6, { 0x8C, 0xB4, 0x3C, 0x9C, 0xFB, 0x1D, 0x86, 0xD3 } }, \
+  { 0x0F886E75, 0x3029, 0x4ECF, { 0xB6, 0x94, 0x22, 0x89, 0x4D, 0x3F, 0x21, 0x43 } }, \
+  { 0x1216BD2A, 0xC05E, 0x4C6D, { 0x91, 0xE7, 0xEB, 0x8E, 0x37, 0xAD, 0x3B, 0x7A } }, \
+  { 0x132EC73B, 0xBD26, 0x4FBF, { 0xB1, 0x93, 0x8A, 0xCB, 0x50, 0xEF, 0xBD, 0x89 } }, \
+  { 0x1B6E9D50, 0x12E4, 0x4B55, { 0x81, 0xD9, 0x1A, 0xBF, 0xEC, 0x59, 0xD4, 0xFC } }, \
+  { 0x1DFB7BFA, 0xBF8E, 0x4D11, { 0x97, 0x66, 0x2F, 0xB0, 0xD0, 0x44, 0x23, 0x10 } }, \
+  { 0x2167F964, 0x7298, 0x4A8F, { 0x9A, 0x2A, 0xBF, 0xE4, 0x98, 0xD6, 0x00, 0xA8 } }, \
+  { 0x2ADB8F5B, 0xC7D4, 0x4E7E, { 0xBE, 0x2A, 0x23, 0x63, 0x4D, 0xF6, 0x68, 0xA1 } }, \
+  { 0x316B1230, 0x0500, 0x4592, { 0x8C, 0x09, 0xEA, 0xBA, 0x0F, 0xB6, 0xB0, 0x7F } }, \
+  { 0x3A53114D, 0x5673, 0x4DD9, { 0xB5, 0xB3, 0xCB, 0x72, 0xC3, 0x47, 0x66, 0x9B } }, \
+  { 0x3D9FC54D, 0x19E5, 0x4AD0, { 0xB9, 0x86, 0x02, 0xD6, 0x87, 0xD7, 0x60, 0xE5 } }, \
+  { 0x405F8FE6, 0x5213, 0x4B85, { 0xB8, 0x21, 0x97, 0xB7, 0x7A, 0xFF, 0x79, 0x5B } }, \
+  { 0x4AC94F68, 0xE651, 0x4B38, { 0xA1, 0xD8, 0x2D, 0x5D, 0xEF, 0xFA, 0x0F, 0x60 } }, \
+  { 0x4B680E2D, 0x0D63, 0x4F62, { 0xB9, 0x30, 0x7A, 0xE9, 0x95, 0xB9, 0xB3, 0xA3 } }, \
+  { 0x4C006CD9, 0x19BA, 0x4617, { 0x84, 0x83, 0x60, 0x91, 0x94, 0xA1, 0xAC, 0xFC } }, \
+  { 0x4C494E55, 0x5849, 0x5342, { 0x45, 0x54, 0x54, 0x45, 0x52, 0x21, 0x21, 0x21 } }, \
+  { 0x4F9147CB, 0x972E, 0x4F5C, { 0xB8, 0x69, 0xA0, 0x21, 0x82, 0xC9, 0xD9, 0x3C } }, \
+  { 0x510DF6A1, 0xB6C1, 0x4948, { 0xAE, 0xE7, 0x59, 0xF2, 0x20, 0xF8, 0x98, 0xBD } }, \
+  { 0x5199296F, 0x2808, 0x4AFA, { 0x94, 0xC4, 0x99, 0xF6, 0xB0, 0x6C, 0x87, 0x1E } }, \
+  { 0x5446C293, 0x339B, 0x47CD, { 0xB7, 0x19, 0x58, 0x5D, 0xE3, 0x94, 0x08, 0xCC } }, \
+  { 0x5640497F, 0x645E, 0x4611, { 0xB9, 0x15, 0xE6, 0x82, 0xC8, 0xBD, 0x47, 0x83 } }, \
+  { 0x580DD900, 0x385D, 0x11D7, { 0x88, 0x3A, 0x00, 0x50, 0x04, 0x73, 0xD4, 0xEB } }, \
+  { 0x59242DD8, 0xE7CF, 0x4979, { 0xB6, 0x0E, 0xA6, 0x06, 0x7E, 0x2A, 0x18, 0x5F } }, \
+  { 0x6298FE18, 0xD5EF, 0x42B7, { 0xBB, 0x0C, 0x29, 0x53, 0x28, 0x3F, 0x57, 0x04 } }, \
+  { 0x6869C5B3, 0xAC8D, 0x4973, { 0x8B, 0x37, 0xE3, 0x54, 0xDB, 0xF3, 0x4A, 0xDD } }, \
+  { 0x6950AFFF, 0x6EE3, 0x11DD, { 0xAD, 0x8B, 0x08, 0x00, 0x20, 0x0C, 0x9A, 0x66 } }, \
+  { 0x70E1A818, 0x0BE1, 0x4449, { 0xBF, 0xD4, 0x9E, 0xF6, 0x8C, 0x7F, 0x02, 0xA8 } }, \
+  { 0x71ED12D1, 0x250B, 0x42FB, { 0x8C, 0x17, 0x10, 0xDC, 0xFA, 0x77, 0x17, 0x01 } }, \
+  { 0x753630C9, 0xFAE5, 0x47A9, { 0xBB, 0xBF, 0x88, 0xD6, 0x21, 0xCD, 0x72, 0x82 } }, \
+  { 0x7687A497, 0xFF4E, 0x48FF, { 0xBC, 0xAA, 0x67, 0xDB, 0xF6, 0x5C, 0x42, 0xD1 } }, \
+  { 0x77E5B618, 0x2612, 0x4C28, { 0xBC, 0xDF, 0xA2, 0xB1, 0x4D, 0x8A, 0x3E, 0xFE } }, \
+  { 0x7BBC4123, 0x5D5E, 0x4C1C, { 0x95, 0xD1, 0x30, 0xEB, 0xA4, 0x87, 0x01, 0xCA } }, \
+  { 0x81E4B34A, 0x268C, 0x4FCC, { 0x8E, 0x39, 0x1C, 0x1D, 0x3E, 0x6F, 0x6E, 0x69 } }, \
+  { 0x8B0E1353, 0x358C, 0x4E2F, { 0x93, 0x45, 0xEE, 0xBF, 0x1D, 0xAB, 0x98, 0x9B } }, \
+  { 0x8B12F29F, 0x7135, 0x4EAB, { 0xAF, 0xDA, 0x05, 0x12, 0xF7, 0x4B, 0x65, 0xEA } }, \
+  { 0x981AD9CD, 0x8685, 0x4AAB, { 0xAF, 0xDA, 0x05, 0x12, 0xF7, 0x4B, 0x65, 0xEA } }, \
+  { 0x9EF8C276, 0xB3E6, 0x4AD9, { 0x8F, 0xE7, 0xC7, 0x4F, 0x71, 0xC4, 0x72, 0x48 } }, \
+  { 0xA16BA302, 0x6514, 0x4287, { 0xBE, 0xE3, 0x62, 0x23, 0xB7, 0xDE, 0x2C, 0x21 } }, \
+  { 0xA9B700CF, 0x019E, 0x4D8B, { 0xA3, 0xA7, 0x88, 0xE1, 0xEA, 0x01, 0x69, 0x9E } }, \
+  { 0xA9CE66D5, 0x6D37, 0x451E, { 0xA9, 0xBF, 0xF5, 0x8F, 0x7A, 0x0B, 0x3C, 0xC2 } }, \
+  { 0xAD1F487A, 0xBA56, 0x48DC, { 0x8E, 0xAA, 0xE8, 0xFB, 0xEA, 0x74, 0xB8, 0xF2 } }, \
+  { 0xB324F29B, 0x5E97, 0x4BF9, { 0xB4, 0xE0, 0x51, 0x25, 0xC1, 0xF6, 0x05, 0xD5 } }, \
+  { 0xB859281C, 0x16FA, 0x45A8, { 0x92, 0x01, 0x1C, 0x38, 0x30, 0xA9, 0x73, 0xBD } }, \
+  { 0xBB9175E1, 0x3E95, 0x4B7E, { 0x87, 0x50, 0x9D, 0x6A, 0xA3, 0x4E, 0xB7, 0xF6 } }, \
+  { 0xBC327DBD, 0xB982, 0x4F55, { 0x9F, 0x79, 0x05, 0x6A, 0xD7, 0xE9, 0x87, 0xC5 } }, \
+  { 0xC468B382, 0x4550, 0x4909, { 0xAD, 0x57, 0x24, 0x96, 0x14, 0x1B, 0x3F, 0x4A } }, \
+  { 0xC7C89169, 0x1A42, 0x4E5E, { 0xB3, 0x4B, 0xE6, 0x83, 0x06, 0x71, 0xC9, 0xA6 } }, \
+  { 0xC8B64E46, 0x9819, 0x45AB, { 0x87, 0x5D, 0x09, 0xDF, 0xDA, 0x6D, 0x8B, 0x1B } }, \
+  { 0xD57C852E, 0x809F, 0x45CF, { 0xA3, 0x77, 0xD7, 0x7B, 0xC0, 0xCB, 0x78, 0xEE } }, \
+  { 0xD7E6ABC1, 0x971B, 0x461B, { 0xB5, 0xE4, 0x3C, 0x37, 0x66, 0x26, 0x7A, 0xD9 } }, \
+  { 0xDF73ABDA, 0x7A42, 0x4E5E, { 0xB3, 0x4B, 0xE6, 0x83, 0x06, 0x71, 0xC9, 0xA6 } }, \
+  { 0xE1B26D32, 0x414F, 0x46DB, { 0x9A, 0xEE, 0x42, 0x00, 0x77, 0xF3, 0x5D, 0xBE } }, \
+  { 0xE2A74738, 0x8934, 0x48F5, { 0x84, 0x12, 0x99, 0xE9, 0x48, 0xC8, 0xDC, 0x1B } }, \
+  { 0xE469AA26, 0x9268, 0x4EB0, { 0xA0, 0x87, 0xDD, 0x4C, 0xEE, 0x37, 0x40, 0x4B } }, \
+  { 0xE706CB54, 0x84B8, 0x40BD, { 0x83, 0x2F, 0x7F, 0xB2, 0xD5, 0xCB, 0x87, 0xB3 } }, \
+  { 0xE92BAE14, 0x3DFD, 0x4C70, { 0x9F, 0xE6, 0x38, 0x99, 0xF3, 0x6C, 0x78, 0x46 } }, \
+  { 0xEA4DAEE8, 0xA851, 0x4A9F, { 0xAB, 0xF4, 0xB7, 0x9F, 0xA2, 0x52, 0x82, 0x91 } }, \
+  { 0xFF11E702, 0x8923, 0x47CC, { 0xAD, 0x30, 0xD9, 0xE0, 0xE2, 0x40, 0xDD, 0x10 } }, \
+  { 0x25247A74, 0x9440, 0x47D5, { 0xBF, 0x0A, 0xED, 0x92, 0xA4, 0xD6, 0xEB, 0xA4 } }, \
+  { 0x17772369, 0xD262, 0x4B90, { 0x9F, 0x31, 0xBD, 0xC4, 0x1F, 0x26, 0x63, 0xA5 } }, \
+  { 0x038CE287, 0xB806, 0x45B6, { 0xA8, 0x19, 0x51, 0x4D, 0xAF, 0x4B, 0x91, 0xB9 } }, \
+  { 0x041CE993, 0x6677, 0x4720, { 0xA6, 0x65, 0x37, 0x5B, 0x80, 0xFF, 0xE0, 0x12 } }, \
+  { 0x08ABE065, 0xC359, 0x4B95, { 0x8D, 0x59, 0xC1, 0xB5, 0x8E, 0xB6, 0x57, 0xB5 } }, \
+  { 0x08E56A30, 0x62ED, 0x41C6, { 0x92, 0x40, 0xB7, 0x45, 0x5E, 0xE6, 0x53, 0xD7 } }, \
+  { 0x08F2C63B, 0x08DE, 0x4CCD, { 0x86, 0x70, 0xAC, 0xFE, 0x64, 0x4A, 0x1C, 0x48 } }, \
+  { 0x0914DE08, 0x434D, 0x4F9F, { 0x93, 0xB3, 0x6F, 0xA4, 0x8A, 0xEA, 0xF7, 0xE0 } }, \
+  { 0x099FD87F, 0x4B39, 0x43F6, { 0xAB, 0x47, 0xF8, 0x01, 0xF9, 0x92, 0x09, 0xF7 } }, \
+  { 0x09B98059, 0x2D74, 0x43C5, { 0x97, 0x09, 0xAD, 0x0A, 0x00, 0x51, 0x86, 0x7D } }, \
+  { 0x0A7521E1, 0x09F1, 0x44AE, { 0x9B, 0x5F, 0x27, 0x81, 0xB7, 0x89, 0x71, 0xD6 } }, \
+  { 0x0B234DF1, 0x0080, 0x412B, { 0x87, 0x16, 0x8A, 0x81, 0xA3, 0xA1, 0x1F, 0xAA } }, \
+  { 0x0B2E406A, 0xED5B, 0x4668, { 0xBC, 0xD1, 0x2B, 0x1D, 0xB0, 0x18, 0x41, 0xFC } }, \
+  { 0x0B7BF76C, 0x721A, 0x44FB, { 0xA7, 0x58, 0x52, 0xE1, 0x3C, 0xA4, 0x57, 0xF1 } }, \
+  { 0x0BA38E92, 0x154A, 0x4BE2, { 0xA5, 0xE0, 0xBE, 0x80, 0x57, 0x1C, 0xDB, 0x71 } }, \
+  { 0x0BB12CAC, 0xCFA9, 0x4839, { 0xA4, 0xC2, 0x17, 0x97, 0x24, 0x81, 0x09, 0xD0 } }, \
+  { 0x0BC22608, 0xECC5, 0x47B9, { 0xA0, 0x38, 0x4F, 0x0A, 0x68, 0x37, 0x2E, 0x44 } }, \
+  { 0x0CD3D2FA, 0xB21D, 0x47B5, { 0xBA, 0x95, 0xD8, 0xC0, 0x0B, 0x38, 0xF3, 0x24 } }, \
+  { 0x0D24A235, 0x9C12, 0x446C, { 0x8E, 0xCB, 0xEF, 0xC1, 0xF5, 0x28, 0x02, 0x09 } }, \
+  { 0x0D28C529, 0x87D4, 0x4298, { 0x8A, 0x54, 0x40, 0xF2, 0x2A, 0x9F, 0xE2, 0x4A } }, \
+  { 0x0D81FDC5, 0xCB98, 0x4B9F, { 0xB9, 0x3B, 0x70, 0xA9, 0xC0, 0x66, 0x3A, 0xBE } }, \
+  { 0x0DDE9636, 0x8321, 0x4EDF, { 0x9F, 0x14, 0x0B, 0xFC, 0xA3, 0xB4, 0x73, 0xF5 } }, \
+  { 0x0E7383B1, 0x83EE, 0x41A4, { 0x93, 0x9E, 0x24, 0xC8, 0x86, 0xF0, 0x3A, 0xD6 } }, \
+  { 0x0EA3D651, 0x49B4, 0x47D9, { 0xBD, 0xC3, 0xE4, 0xA3, 0x79, 0xF3, 0xDE, 0x76 } }, \
+  { 0x0EB4FAC0, 0xA3EC, 0x4FED, { 0x97, 0x83, 0xA8, 0xD0, 0xFF, 0xD1, 0xAE, 0x33 } }, \
+  { 0x1181E16D, 0xAF11, 0x4C52, { 0x84, 0x7E, 0x51, 0x6D, 0xD0, 0x9B, 0xD3, 0x76 } }, \
+  { 0x119F3764, 0xA7C2, 0x4329, { 0xB2, 0x5C, 0xE6, 0x30, 0x5E, 0x74, 0x30, 0x49 } }, \
+  { 0x11DD0F6C, 0x209B, 0x47CE, { 0x8A, 0x98, 0x41, 0x8C, 0x9B, 0x7C, 0xC7, 0x56 } }, \
+  { 0x12963E55, 0x5826, 0x469E, { 0xA9, 0x34, 0xA3, 0xCB, 0xB3, 0x07, 0x6E, 0xC5 } }, \
+  { 0x1323C7F8, 0xDAD5, 0x4126, { 0xA5, 0x4B, 0x7A, 0x05, 0xFB, 0xF4, 0x15, 0x15 } }, \
+  { 0x1478454A, 0x4584, 0x4CCA, { 0xB0, 0xD2, 0x12, 0x0A, 0xCE, 0x12, 0x9D, 0xBB } }, \
+  { 0x14E7D9BE, 0x7834, 0x477E, { 0xA9, 0x42, 0xFF, 0x5F, 0x82, 0x3E, 0xE2, 0x49 } }, \
+  { 0x150EC16F, 0x0BB6, 0x42A8, { 0xB6, 0x05, 0x79, 0x79, 0x4B, 0x89, 0xD1, 0x5B } }, \
+  { 0x166FD043, 0xEA13, 0x4848, { 0xBB, 0x3C, 0x6F, 0xA2, 0x95, 0xB9, 0x46, 0x27 } }, \
+  { 0x16C368FE, 0xF174, 0x4881, { 0x92, 0xCE, 0x38, 0x86, 0x99, 0xD3, 0x4D, 0x95 } }, \
+  { 0x16D0A23E, 0xC09C, 0x407D, { 0xA1, 0x4A, 0xAD, 0x05, 0x8F, 0xDD, 0x0C, 0xA1 } }, \
+  { 0x17390333, 0x4CE6, 0x48A8, { 0xAF, 0xB9, 0x0E, 0xF5, 0x5B, 0x66, 0x6B, 0x74 } }, \
+  { 0x1916F73E, 0xC824, 0x4F91, { 0xAC, 0x9C, 0xBF, 0x1F, 0xD2, 0x8E, 0x44, 0x31 } }, \
+  { 0x194EE52B, 0x02FE, 0x418D, { 0xAA, 0x10, 0x2E, 0x61, 0xE5, 0x1C, 0xB8, 0x94 } }, \
+  { 0x1A1D1204, 0xE385, 0x4943, { 0xA8, 0x92, 0x53, 0x34, 0xCE, 0x38, 0x09, 0xAC } }, \
+  { 0x1AFE6BD0, 0xC9C5, 0x44D4, { 0xB7, 0xBD, 0x8F, 0x5E, 0x7D, 0x0F, 0x25, 0x60 } }, \
+  { 0x1BE65202, 0x9318, 0x492D, { 0xA5, 0x51, 0x08, 0xDF, 0x2B, 0xD6, 0x0A, 0xEE } }, \
+  { 0x1C33C958, 0xFEA4, 0x435F, { 0x93, 0xEF, 0x0A, 0x9C, 0x14, 0xAE, 0x87, 0xE4 } }, \
+  { 0x1C733CB5, 0x4C8F, 0x44D9, { 0xBB, 0xF0, 0x95, 0x47, 0x70, 0x89, 0xEB, 0x08 } }, \
+  { 0x1CE692F0, 0x3317, 0x4574, { 0x8B, 0x57, 0x48, 0x00, 0xED, 0x09, 0x1F, 0x40 } }, \
+  { 0x1D82219F, 0x386F, 0x4F26, { 0xAF, 0xAC, 0x61, 0x3F, 0x24, 0x2C, 0x07, 0x60 } }, \
+  { 0x1EF02CF1, 0xBF69, 0x49C3, { 0x8F, 0xDC, 0x5B, 0xB5, 0x5D, 0x22, 0x4C, 0xFA } }, \
+  { 0x2000A832, 0xC674, 0x486A, { 0x81, 0xBE, 0xCB, 0x46, 0x70, 0xA4, 0xF7, 0xFD } }, \
+  { 0x216A681C, 0x9E51, 0x415F, { 0x9A, 0xDA, 0xCB, 0x9F, 0xBC, 0xD0, 0x5F, 0x5D } }, \
+  { 0x231D3A65, 0x9442, 0x4507, { 0xA4, 0xE4, 0xE9, 0xD2, 0x17, 0x65, 0x78, 0xF1 } }, \
+  { 0x2374EDDF, 0xF203, 0x4FC0, { 0xA2, 0x0E, 0x61, 0xBA, 0xD7, 0x30, 0x89, 0xD6 } }, \
+  { 0x2386E231, 0xA9CF, 0x4F52, { 0x94, 0x6A, 0x6F, 0x6B, 0x6C, 0x13, 0x3B, 0x46 } }, \
+  { 0x24CCD374, 0x3DF6, 0x4181, { 0x86, 0xF6, 0xE3, 0xC6, 0x69, 0x20, 0xA1, 0x45 } }, \
+  { 0x25ACF158, 0xDD61, 0x4E64, { 0x9A, 0x49, 0x55, 0x85, 0x1E, 0x9A, 0x26, 0xC7 } }, \
+  { 0x26A2481E, 0x4424, 0x46A2, { 0x99, 0x43, 0xCC, 0x40, 0x39, 0xEA, 0xD8, 0xF8 } }, \
+  { 0x26C04CF3, 0xF5FB, 0x4968, { 0x8D, 0x57, 0xC7, 0xFA, 0x0A, 0x93, 0x27, 0x83 } }, \
+  { 0x27287751, 0x867A, 0x46CD, { 0x91, 0xAF, 0x41, 0x6F, 0xF6, 0xAE, 0x3D, 0xFE } }, \
+  { 0x27587B71, 0x37F9, 0x4A48, { 0xB5, 0x70, 0x58, 0xB6, 0xD1, 0x4F, 0x6D, 0xEC } }, \
+  { 0x27F3838F, 0xBA27, 0x4FFA, { 0xB3, 0x74, 0x35, 0xBE, 0xA2, 0x8A, 0x43, 0x1B } }, \
+  { 0x290EA249, 0x6E88, 0x423C, { 0xB0, 0xDA, 0x75, 0xCD, 0xDE, 0x79, 0x20, 0xCC } }, \
+  { 0x29CF55F8, 0xB675, 0x4F5D, { 0x8F, 0x2F, 0xB8, 0x7A, 0x3E, 0xCF, 0xD0, 0x63 } }, \
+  { 0x2AEDA0EB, 0x1392, 0x4232, { 0xA4, 0xF9, 0xC5, 0x7A, 0x3C, 0x2F, 0xA2, 0xD9 } }, \
+  { 0x2D6DCB78, 0xCAE2, 0x4459, { 0x92, 0x7C, 0x64, 0xA6, 0xB7, 0xE6, 0x4A, 0x75 } }, \
+  { 0x2D7522FA, 0x67F0, 0x4768, { 0xB6, 0xE0, 0xFD, 0x76, 0xF1, 0x7F, 0x4B, 0x04 } }, \
+  { 0x2DF10014, 0xCF21, 0x4280, { 0x8C, 0x3F, 0xE5, 0x39, 0xB8, 0xEE, 0x51, 0x50 } }, \
+  { 0x2DF61403, 0xC180, 0x45A5, { 0xA2, 0x2B, 0x1A, 0x3D, 0xB8, 0x8F, 0xE9, 0xBA } }, \
+  { 0x2E3F2275, 0x89CD, 0x4DE4, { 0xBD, 0x84, 0xBE, 0xBF, 0xD9, 0x4B, 0xCD, 0xCC } }, \
+  { 0x2EFF67E3, 0x5987, 0x46E8, { 0x81, 0x11, 0x80, 0xFF, 0xA6, 0x7A, 0xEB, 0x93 } }, \
+  { 0x2FB216ED, 0x4A67, 0x4833, { 0x9F, 0x5C, 0x24, 0x81, 0x24, 0xCD, 0x9A, 0xAC } }, \
+  { 0x2FB92EFA, 0x2EE0, 0x4BAE, { 0x9E, 0xB6, 0x74, 0x44, 0x12, 0x5E, 0x1E, 0xF7 } }, \
+  { 0x2FB92EFA, 0x2EE0, 0x4BAE, { 0x9E, 0xB6, 0x74, 0x64, 0x12, 0x5E, 0x1E, 0xF7 } }, \
+  { 0x2FFDAF4A, 0xA9B5, 0x4EF6, { 0xAA, 0x3B, 0xA8, 0x96, 0x11, 0xAA, 0xB2, 0x84 } }, \
+  { 0x3022E512, 0xB94A, 0x4F12, { 0x80, 0x6D, 0x7E, 0xF1, 0x17, 0x78, 0x99, 0xD8 } }, \
+  { 0x329F126F, 0x299E, 0x4BC5, { 0x83, 0x10, 0x17, 0x9F, 0x10, 0xEB, 0x46, 0xC9 } }, \
+  { 0x33C6406D, 0x2F6B, 0x41B5, { 0x87, 0x05, 0x52, 0xBA, 0xFB, 0x63, 0x3C, 0x09 } }, \
+  { 0x36AEBB56, 0x1F8B, 0x4BC1, { 0x8E, 0xFE, 0x40, 0x85, 0xA5, 0xD4, 0xC4, 0x0A } }, \
+  { 0x37287C8B, 0xDC93, 0x45D5, { 0x9A, 0xAF, 0x3C, 0xD2, 0xE9, 0x06, 0xB1, 0x2B } }, \
+  { 0x37287C8B, 0xDC93, 0x45D5, { 0x9A, 0xAF, 0x3C, 0xD2, 0xE9, 0x06, 0xFF, 0xFF } }, \
+  { 0x386EB7BA, 0x6344, 0x44E8, { 0x98, 0x5C, 0x39, 0x78, 0xFD, 0x47, 0x91, 0x6B } }, \
+  { 0x38871BF0, 0xC64A, 0x4896, { 0xB8, 0xE4, 0x62, 0xD4, 0x85, 0x0C, 0x7E, 0x68 } }, \
+  { 0x38871BF0, 0xC64A, 0x4896, { 0xB8, 0xE4, 0x62, 0xD7, 0x75, 0x0C, 0x7D, 0x68 } }, \
+  { 0x38EF2B8B, 0xCF3D, 0x47E2, { 0x97, 0xE3, 0x55, 0x71, 0x15, 0xE4, 0x39, 0x85 } }, \
+  { 0x3962DEB5, 0xFDF6, 0x4829, { 0x88, 0x9C, 0xD5, 0x44, 0x91, 0x8E, 0x84, 0xD9 } }, \
+  { 0x39A7FADC, 0x9A24, 0x4553, { 0x8C, 0xBD, 0x9B, 0x72, 0xB2, 0x4C, 0x22, 0xFD } }, \
+  { 0x3A29DD19, 0x2C84, 0x4A70, { 0x9A, 0x01, 0xFB, 0xDD, 0xAF, 0xFB, 0x64, 0x61 } }, \
+  { 0x3A4044D2, 0xF614, 0x4124, { 0xA7, 0x72, 0x20, 0x7B, 0xCD, 0xBE, 0x3D, 0xB0 } }, \
+  { 0x3B37B724, 0x4AF7, 0x4A35, { 0x97, 0xB3, 0xD2, 0xFB, 0x8F, 0x4F, 0x56, 0x3C } }, \
+  { 0x3BC1C867, 0x2274, 0x43F8, { 0xA4, 0xBA, 0x93, 0x9A, 0x5B, 0xD6, 0xD4, 0x73 } }, \
+  { 0x3C1DE39F, 0xD207, 0x408A, { 0xAA, 0xCC, 0x73, 0x1C, 0xFB, 0x7F, 0x1D, 0xD7 } }, \
+  { 0x3D5674D0, 0xAE75, 0x4723, { 0x91, 0x59, 0x1D, 0x65, 0x3B, 0x40, 0x40, 0x2F } }, \
+  { 0x3DDE54E9, 0x8D18, 0x4EA8, { 0x94, 0x23, 0xC2, 0xE8, 0x46, 0xE1, 0x8E, 0x23 } }, \
+  { 0x41846A2E, 0x7AAA, 0x4498, { 0xBC, 0x26, 0xB5, 0xAC, 0xD4, 0x9F, 0x92, 0xE1 } }, \
+  { 0x418FAF6C, 0x2BCF, 0x4141, { 0x89, 0x83, 0x9D, 0x33, 0xE1, 0xB6, 0x7B, 0x4C } }, \
+  { 0x41F46692, 0x9513, 0x4D1C, { 0x8B, 0xB3, 0xB6, 0xA1, 0x68, 0x18, 0x2D, 0xE4 } }, \
+  { 0x42C32DCF, 0xF25A, 0x47F3, { 0x8F, 0x4C, 0xAB, 0xD4, 0x78, 0xD7, 0x7F, 0x50 } }, \
+  { 0x45FDB42B, 0x1F95, 0x4A53, { 0x9B, 0xA4, 0x1C, 0x8B, 0xFB, 0x8B, 0xCB, 0x01 } }, \
+  { 0x46FCD5D8, 0xA9B3, 0x42E3, { 0x90, 0x4A, 0x01, 0x2F, 0x07, 0xBC, 0x5F, 0x5C } }, \
+  { 0x4772C6DA, 0x506D, 0x4C95, { 0xAC, 0x17, 0xAE, 0x66, 0x88, 0x5F, 0x6D, 0x53 } }, \
+  { 0x47B2138F, 0x5A6B, 0x4C65, { 0x91, 0x67, 0x87, 0x40, 0x59, 0x5D, 0x16, 0xAD } }, \
+  { 0x47E83D0C, 0x2AF4, 0x468D, { 0x91, 0x91, 0x9C, 0xE4, 0x68, 0xC1, 0x8E, 0x9E } }, \
+  { 0x492261E4, 0x0659, 0x424C, { 0x82, 0xB6, 0x73, 0x27, 0x43, 0x89, 0xE7, 0xA7 } }, \
+  { 0x4A37320B, 0x3FB3, 0x4365, { 0x97, 0x30, 0x9E, 0x89, 0xC6, 0x00, 0x39, 0x5D } }, \
+  { 0x4A64F200, 0xF99C, 0x42F3, { 0x80, 0xC7, 0x0D, 0x91, 0xE2, 0xD3, 0xEB, 0x5D } }, \
+  { 0x4B87C89B, 0x39A9, 0x478F, { 0xA4, 0xB6, 0x81, 0x6A, 0x9E, 0xDC, 0x50, 0x87 } }, \
+  { 0x4E98A9FE, 0xDF5A, 0x4136, { 0xB9, 0x22, 0x4F, 0xB9, 0x70, 0xCB, 0xD7, 0x33 } }, \
+  { 0x51D687C8, 0x196E, 0x4CFE, { 0x8A, 0x0C, 0x83, 0x68, 0x98, 0x0E, 0xA8, 0xB6 } }, \
+  { 0x52312CDF, 0xD4A9, 0x453E, { 0xA9, 0xDF, 0x9F, 0xDA, 0xF5, 0x1C, 0xD6, 0x22 } }, \
+  { 0x52A88B2A, 0x65FD, 0x4951, { 0x8B, 0x25, 0x06, 0xFB, 0x65, 0x98, 0x12, 0x8B } }, \
+  { 0x54BD6A5D, 0x38F2, 0x44BD, { 0x84, 0xAB, 0x10, 0x8B, 0xE4, 0xF4, 0x59, 0x14 } }, \
+  { 0x55A267FC, 0x6607, 0x4023, { 0x88, 0x4E, 0x48, 0xE5, 0xD3, 0xD3, 0xF4, 0xE2 } }, \
+  { 0x55BB5A4B, 0x3B3F, 0x442C, { 0xBF, 0x09, 0x0F, 0x87, 0xA6, 0x7E, 0x8E, 0xE7 } }, \
+  { 0x55E76644, 0x78A5, 0x4A82, { 0xA9, 0x00, 0x71, 0x26, 0xA5, 0x79, 0x88, 0x92 } }, \
+  { 0x55F6A413, 0x280F, 0x41E3, { 0x93, 0x94, 0x65, 0x80, 0xF2, 0x9D, 0xD7, 0xD0 } }, \
+  { 0x56EEE346, 0x500C, 0x4936, { 0x95, 0x1A, 0x2D, 0xA5, 0xF0, 0xFF, 0x39, 0xBB } }, \
+  { 0x571D1ED1, 0xC2D9, 0x418E, { 0x95, 0x3A, 0x24, 0x8E, 0xBC, 0x68, 0x70, 0x48 } }, \
+  { 0x57F435A8, 0x1C37, 0x4834, { 0xAD, 0x61, 0xB0, 0x3D, 0x94, 0xDD, 0xCE, 0xF3 } }, \
+  { 0x5820EEB4, 0xC135, 0x4854, { 0x9D, 0x2A, 0xAA, 0x9E, 0xFC, 0x44, 0x75, 0xE9 } }, \
+  { 0x587E8797, 0xC2FB, 0x41B7, { 0xAE, 0x9B, 0xF5, 0x3A, 0x6C, 0x56, 0x2D, 0xF5 } }, \
+  { 0x58CDC779, 0xDC8C, 0x491B, { 0xBA, 0xC3, 0xF8, 0x6E, 0x06, 0xD1, 0x86, 0x5F } }, \
+  { 0x590915CC, 0x8622, 0x4D61, { 0xBE, 0x64, 0xC3, 0x3E, 0xE7, 0x60, 0x14, 0x1F } }, \
+  { 0x59287178, 0x59B2, 0x49CA, { 0xBC, 0x63, 0x53, 0x2B, 0x12, 0xEA, 0x2C, 0x53 } }, \
+  { 0x59378206, 0x861B, 0x4380, { 0xA3, 0x49, 0x2F, 0x2F, 0x4F, 0x03, 0x0C, 0x4B } }, \
+  { 0x5AAB83E5, 0xF027, 0x4CA7, { 0xBF, 0xD0, 0x16, 0x35, 0x8C, 0xC9, 0xE4, 0x53 } }, \
+  { 0x5AE3F37E, 0x4EAE, 0x41AE, { 0x82, 0x40, 0x35, 0x46, 0x5B, 0x5E, 0x81, 0xEB } }, \
+  { 0x5D44BE77, 0x5669, 0x41D0, { 0xB6, 0x85, 0x1B, 0xF3, 0xF8, 0x3E, 0xFB, 0x98 } }, \
+  { 0x5DA9E544, 0xDC2D, 0x4670, { 0xA3, 0xD5, 0x98, 0x52, 0x36, 0xD5, 0xDE, 0x45 } }, \
+  { 0x5DB37E5C, 0x2EEB, 0x43F8, { 0xAD, 0xA0, 0x24, 0x37, 0x02, 0xD3, 0x94, 0x5D } }, \
+  { 0x5E9CABA3, 0xF2B1, 0x497A, { 0xAD, 0xAC, 0x24, 0xF5, 0x75, 0xE9, 0xCD, 0xE9 } }, \
+  { 0x5EDA3123, 0x0840, 0x45F7, { 0xAD, 0xAB, 0x13, 0xA6, 0x55, 0xEF, 0x3B, 0xB7 } }, \
+  { 0x60EBDAA4, 0x1565, 0x4D9A, { 0x99, 0xC8, 0x88, 0xDF, 0xA6, 0x55, 0x49, 0xA5 } }, \
+  { 0x612E0D09, 0x5D11, 0x4516, { 0x82, 0xEE, 0x6D, 0xD6, 0x05, 0xFE, 0x26, 0x5F } }, \
+  { 0x631B4DF7, 0xBAEA, 0x4C1F, { 0xA0, 0x61, 0x5B, 0x64, 0x62, 0x65, 0x28, 0x22 } }, \
+  { 0x6426C814, 0x601A, 0x4116, { 0x9E, 0x9F, 0xBF, 0x9D, 0x6F, 0x8F, 0x25, 0x4F } }, \
+  { 0x65E9EB9D, 0x812D, 0x4161, { 0x99, 0xC5, 0x05, 0xAC, 0x4B, 0xCC, 0xA4, 0x94 } }, \
+  { 0x67499F84, 0xF2E5, 0x4DD2, { 0x9E, 0x56, 0xC6, 0xE3, 0x89, 0xDD, 0x61, 0x73 } }, \
+  { 0x69EF78BC, 0x3B71, 0x4ECC, { 0x83, 0x4F, 0x3B, 0x74, 0xF9, 0x14, 0x84, 0x30 } }, \
+  { 0x69F97A4E, 0x1395, 0x434A, { 0xA5, 0xD3, 0xFF, 0x9C, 0xEA, 0x28, 0x48, 0x85 } }, \
+  { 0x6AA1A3CC, 0x52C4, 0x4B03, { 0x99, 0xF7, 0x28, 0x8F, 0x34, 0x5C, 0x1D, 0xB3 } }, \
+  { 0x6B287864, 0x759C, 0x42C4, { 0xB4, 0x35, 0xA7, 0x4A, 0xB6, 0x94, 0xCD, 0x3B } }, \
+  { 0x6E8CD2B7, 0xB636, 0x4859, { 0x85, 0xED, 0xC6, 0x37, 0xBD, 0xCA, 0x59, 0x19 } }, \
+  { 0x6E97D4F4, 0x1898, 0x4408, { 0xA6, 0x2D, 0x99, 0xCA, 0xDE, 0xD3, 0x2F, 0xD8 } }, \
+  { 0x7122810D, 0xCCD3, 0x4B09, { 0xA0, 0xAB, 0x8D, 0x10, 0x76, 0x45, 0xC9, 0x78 } }, \
+  { 0x71287108, 0xBF58, 0x41EA, { 0xB7, 0x1C, 0xB3, 0x62, 0x2D, 0xEB, 0xCA, 0x9D } }, \
+  { 0x750890A6, 0x7ACF, 0x4F4F, { 0x81, 0xBD, 0xB4, 0x00, 0xC2, 0xBE, 0xA9, 0x5A } }, \
+  { 0x758880AB, 0x4CA2, 0x4DAA, { 0xA8, 0x3E, 0xD1, 0xF9, 0xAD, 0xF2, 0xC2, 0xF1 } }, \
+  { 0x75BE667C, 0x48E1, 0x452D, { 0xB0, 0xFC, 0x36, 0x31, 0x38, 0xED, 0x87, 0xFF } }, \
+  { 0x76A1DF7D, 0x754C, 0x40E1, { 0xBC, 0x72, 0x3F, 0xCA, 0xD8, 0x42, 0xDE, 0xF6 } }, \
+  { 0x76BE1ABF, 0x1E1E, 0x321D, { 0xB7, 0xF0, 0x9E, 0x09, 0x84, 0xFD, 0xDA, 0xBC } }, \
+  { 0x76E1E9EE, 0x5FC7, 0x4613, { 0xB9, 0x6F, 0xFA, 0x79, 0x77, 0x96, 0x57, 0x3A } }, \
+  { 0x773CB08B, 0x511A, 0x4BD5, { 0x85, 0xAD, 0x41, 0xD4, 0xF4, 0xB6, 0x4A, 0x52 } }, \
+  { 0x7808F5C2, 0x9CB0, 0x4609, { 0x90, 0x7F, 0xB1, 0x84, 0x53, 0xC3, 0x63, 0xB4 } }, \
+  { 0x787D4843, 0x68AC, 0x4C28, { 0xBE, 0x53, 0xBA, 0xC2, 0x72, 0xBA, 0xEC, 0xF9 } }, \
+  { 0x79E39A83, 0xD013, 0x4B2E, { 0x83, 0x6A, 0xA9, 0x9A, 0x71, 0x47, 0x35, 0x1C } }, \
+  { 0x7A08CB98, 0xE9BC, 0x41C3, { 0xBE, 0x19, 0xB3, 0x02, 0xF3, 0xF1, 0xF5, 0x23 } }, \
+  { 0x7A08CB98, 0xE9BC, 0x41C3, { 0xBE, 0x19, 0xB3, 0x02, 0xF3, 0xF1, 0xF5, 0x95 } }, \
+  { 0x7BBB9525, 0x97BA, 0x4516, { 0xB6, 0x60, 0x1B, 0x0E, 0xB7, 0x87, 0x44, 0xA5 } }, \
+  { 0x7C79AC8C, 0x5E6C, 0x4E3D, { 0xBA, 0x6F, 0xC2, 0x60, 0xEE, 0x7C, 0x17, 0x2E } }, \
+  { 0x7CB919C8, 0xD499, 0x4629, { 0xAC, 0xB3, 0x22, 0x76, 0x9E, 0x34, 0x3D, 0xDB } }, \
+  { 0x80AADD0D, 0x8053, 0x4BA7, { 0x94, 0x1B, 0x36, 0xF4, 0x8B, 0xB2, 0x30, 0x01 } }, \
+  { 0x80E66E0A, 0xCCD1, 0x43FA, { 0xA7, 0xB1, 0x2D, 0x5E, 0xE0, 0xF1, 0x39, 0x10 } }, \
+  { 0x80F03C1F, 0x89BD, 0x4240, { 0x93, 0xA8, 0xAC, 0x99, 0xE9, 0xA9, 0x29, 0xFC } }, \
+  { 0x82833414, 0xC8F4, 0x4B62, { 0xAB, 0x6A, 0xE4, 0xD5, 0xDA, 0xAB, 0x13, 0x0F } }, \
+  { 0x82FBE26B, 0x53D4, 0x448F, { 0x92, 0x4C, 0x7B, 0xE0, 0x12, 0x6E, 0xCA, 0x4F } }, \
+  { 0x83B698B9, 0x0208, 0x4ECF, { 0xBB, 0x83, 0xCE, 0x42, 0xD0, 0xBE, 0xFC, 0x4A } }, \
+  { 0x8467C103, 0x6FF6, 0x4D66, { 0x86, 0xF6, 0xE1, 0x12, 0x4C, 0x11, 0x1E, 0x94 } }, \
+  { 0x84991287, 0x3FF0, 0x4FCC, { 0x9C, 0x11, 0xC7, 0xE0, 0x41, 0x86, 0x2C, 0x76 } }, \
+  { 0x858189AC, 0x0ECA, 0x4666, { 0xBA, 0xB8, 0x99, 0x72, 0x40, 0x99, 0x53, 0xC8 } }, \
+  { 0x87C73C1C, 0x1529, 0x4EF5, { 0xA3, 0xFA, 0x08, 0xD7, 0x3E, 0xF8, 0xC8, 0x27 } }, \
+  { 0x88D01BB9, 0x247A, 0x46F6, { 0xBB, 0x6E, 0xBB, 0xA4, 0x9F, 0x11, 0x24, 0xF8 } }, \
+  { 0x899407D7, 0x99FE, 0x43D8, { 0x9A, 0x21, 0x79, 0xEC, 0x32, 0x8C, 0xAC, 0x21 } }, \
+  { 0x89BF244F, 0xE569, 0x416F, { 0xB1, 0x10, 0x8A, 0xE5, 0xEF, 0xD5, 0x17, 0x1C } }, \
+  { 0x8A9F7CFC, 0x5BFC, 0x458F, { 0x98, 0x6F, 0xBC, 0x3D, 0x1B, 0xA7, 0xAC, 0x89 } }, \
+  { 0x8B529353, 0x1FCC, 0x4AC0, { 0xA1, 0x21, 0x90, 0xBE, 0x9F, 0x9C, 0xBF, 0x7A } }, \
+  { 0x8B5FBABD, 0xF51F, 0x4942, { 0xBF, 0x16, 0x16, 0xAA, 0xA3, 0x8A, 0xE5, 0x2B } }, \
+  { 0x8C783970, 0xF02A, 0x4A4D, { 0xAF, 0x09, 0x87, 0x97, 0xA5, 0x1E, 0xEC, 0x8D } }, \
+  { 0xBC3245BD, 0xB982, 0x4F55, { 0x9F, 0x79, 0x05, 0x6A, 0xD7, 0xE9, 0x87, 0xC5 } }, \
+  { 0x8D32716A, 0x60DF, 0x4BDE, { 0x86, 0x47, 0x3D, 0x17, 0x8C, 0xC8, 0x2B, 0x6C } }, \
+  { 0x8D6756B9, 0xE55E, 0x4D6A, { 0xA3, 0xA5, 0x5E, 0x4D, 0x72, 0xDD, 0xF7, 0x72 } }, \
+  { 0x8DCE1957, 0xD774, 0x4FDA, { 0xB9, 0x0F, 0x0B, 0x23, 0x1C, 0xB2, 0xE0, 0xCC } }, \
+  { 0x8E201427, 0x463A, 0x4D24, { 0xA0, 0xF4, 0x25, 0xA8, 0x75, 0xF6, 0x1B, 0xAA } }, \
+  { 0x8EC38829, 0xA59F, 0x40E3, { 0xBA, 0xD0, 0x85, 0xF8, 0x15, 0xA1, 0x57, 0xD1 } }, \
+  { 0x8EC40FB3, 0x4205, 0x4D57, { 0x90, 0x39, 0xA1, 0x92, 0x83, 0x2C, 0x7C, 0xED } }, \
+  { 0x8F439D8B, 0x07B2, 0x4121, { 0xAA, 0x95, 0x8A, 0xC9, 0x15, 0x71, 0xAA, 0x75 } }, \
+  { 0x8F439D8B, 0x07B2, 0x4121, { 0xAA, 0x95, 0x8A, 0xC9, 0x15, 0x71, 0xFF, 0xFF } }, \
+  { 0x8F5A2E02, 0x538C, 0x4D59, { 0xB9, 0x20, 0xC4, 0x78, 0x6A, 0xCB, 0xC5, 0x52 } }, \
+  { 0x8FB82DA4, 0xC3BE, 0x42A6, { 0x8A, 0x70, 0x7B, 0x94, 0xD6, 0x09, 0x72, 0xA6 } }, \
+  { 0x903718F3, 0x575D, 0x4D9C, { 0xBC, 0x78, 0x65, 0xA1, 0x13, 0x81, 0xA0, 0x26 } }, \
+  { 0x90CB75DB, 0x71FC, 0x489D, { 0xAA, 0xCF, 0x94, 0x34, 0x77, 0xEC, 0x72, 0x12 } }, \
+  { 0x91BA201E, 0x1621, 0x46FC, { 0x82, 0x5A, 0xB0, 0x36, 0x3E, 0xCA, 0xD4, 0xBC } }, \
+  { 0x921CD783, 0x3E22, 0x4579, { 0xA7, 0x1F, 0x00, 0xD7, 0x41, 0x97, 0xFC, 0xC8 } }, \
+  { 0x92C78E4E, 0xC994, 0x4F9E, { 0x82, 0xAB, 0xAF, 0x1D, 0xBA, 0x68, 0x58, 0xC9 } }, \
+  { 0x93022F8C, 0x1F09, 0x47EF, { 0xBB, 0xB2, 0x58, 0x14, 0xFF, 0x60, 0x9D, 0xF5 } }, \
+  { 0x937710D0, 0xEF10, 0x42BE, { 0x92, 0xE1, 0x84, 0x94, 0x72, 0x2B, 0x17, 0xB5 } }, \
+  { 0x94925FB1, 0xEEF4, 0x41ED, { 0xBD, 0x7A, 0xCD, 0xB0, 0x4A, 0xAA, 0x81, 0xC7 } }, \
+  { 0x94EDD12A, 0x419B, 0x447F, { 0x94, 0x34, 0x9B, 0x3B, 0x70, 0x78, 0x39, 0x03 } }, \
+  { 0x973BE267, 0x0960, 0x40C7, { 0x98, 0x56, 0xFA, 0x73, 0xC9, 0x2A, 0x46, 0xBA } }, \
+  { 0x97CC7188, 0x79C9, 0x449F, { 0xB9, 0x69, 0x06, 0x5B, 0x64, 0xBF, 0x9C, 0x69 } }, \
+  { 0x98D8A754, 0x8482, 0x46E2, { 0x82, 0x8C, 0xBB, 0x63, 0x2F, 0x34, 0xD9, 0xF7 } }, \
+  { 0x995D96C1, 0x6651, 0x46B0, { 0xBF, 0x3E, 0x83, 0xC0, 0x17, 0xB4, 0x3B, 0x1D } }, \
+  { 0x99A1E3F5, 0x0887, 0x43C7, { 0xB0, 0x0A, 0xF1, 0x4A, 0x64, 0x6B, 0xC1, 0x42 } }, \
+  { 0x9AB332EF, 0x81D9, 0x43D1, { 0x86, 0x7A, 0x03, 0xDD, 0x57, 0x4E, 0x85, 0x66 } }, \
+  { 0x9AF1DA25, 0xF06C, 0x43BB, { 0xBE, 0x88, 0x83, 0x45, 0x50, 0xBF, 0x76, 0x5B } }, \
+  { 0x9BFF300D, 0xD647, 0x480E, { 0x9F, 0xF3, 0x20, 0x06, 0xD3, 0xD7, 0xCC, 0xC6 } }, \
+  { 0x9F3A0016, 0xAE55, 0x4288, { 0x82, 0x9D, 0xD2, 0x2F, 0xD3, 0x44, 0xC3, 0x47 } }, \
+  { 0x9FB63BF9, 0xB522, 0x4203, { 0x9A, 0x53, 0x20, 0xEC, 0x85, 0x4A, 0x31, 0x2A } }, \
+  { 0x9FCFD3EE, 0x38C3, 0x4AAF, { 0x95, 0x12, 0xEC, 0x41, 0x63, 0x71, 0xF6, 0x4A } }, \
+  { 0xA041B8D6, 0x3F17, 0x4582, { 0xAA, 0xC7, 0x5A, 0x61, 0x56, 0x72, 0xE2, 0x95 } }, \
+  { 0xA062CF1F, 0x8473, 0x4AA3, { 0x87, 0x93, 0x60, 0x0B, 0xC4, 0xFF, 0xE9, 0xA8 } }, \
+  { 0xA0B87E92, 0x6392, 0x47FE, { 0x9A, 0xA0, 0x90, 0x20, 0x31, 0x47, 0xEC, 0x04 } }, \
+  { 0xA0BAD9F7, 0xAB78, 0x491B, { 0xB5, 0x83, 0xC5, 0x2B, 0x7F, 0x84, 0xB9, 0xE0 } }, \
+  { 0xA19FB0EE, 0x05F4, 0x4CD6, { 0x8F, 0x28, 0x59, 0xB7, 0x82, 0xFF, 0x95, 0xC6 } }, \
+  { 0xA287558B, 0xD9DD, 0x461B, { 0xA9, 0x29, 0xEC, 0x2A, 0xD2, 0xFE, 0xF5, 0x91 } }, \
+  { 0xA37A9E43, 0x9077, 0x4539, { 0x9B, 0x90, 0xBD, 0x71, 0x9B, 0x03, 0x2B, 0x23 } }, \
+  { 0xA3D93A29, 0x501B, 0x4F6E, { 0x86, 0x9A, 0x6F, 0xD4, 0xBC, 0xEF, 0x90, 0xA7 } }, \
+  { 0xA74B3AEF, 0x2502, 0x40C5, { 0x83, 0xA9, 0x35, 0x24, 0x77, 0x62, 0x73, 0xEA } }, \
+  { 0xA79DC347, 0xDEB4, 0x4A4E, { 0x84, 0x97, 0xCA, 0x5F, 0x8E, 0x7F, 0x06, 0x01 } }, \
+  { 0xA7B36DCF, 0xC75A, 0x4BE8, { 0xBE, 0x2F, 0xE4, 0x84, 0x0C, 0xBE, 0x16, 0x3B } }, \
+  { 0xA833441A, 0x0CA0, 0x4032, { 0x85, 0x9A, 0x3C, 0xFF, 0x7B, 0x66, 0x46, 0xA7 } }, \
+  { 0xA8752510, 0xD83E, 0x400A, { 0x85, 0xDE, 0xFD, 0x15, 0x87, 0x88, 0x2A, 0xFE } }, \
+  { 0xA8A2F6E1, 0x6F62, 0x4CFB, { 0x9E, 0x47, 0x93, 0xCF, 0xD6, 0xD6, 0xE4, 0x76 } }, \
+  { 0xA8C67255, 0xE029, 0x4B1A, { 0x96, 0x8E, 0xEC, 0xA6, 0xE9, 0xC1, 0x1C, 0x73 } }, \
+  { 0xAD416CE3, 0xA483, 0x45B1, { 0x94, 0xC2, 0x4B, 0x4E, 0x4D, 0x57, 0x55, 0x62 } }, \
+  { 0xAD4A0D05, 0x806D, 0x4FE4, { 0x96, 0xAD, 0x3B, 0xD6, 0x2D, 0x8C, 0x4C, 0xE0 } }, \
+  { 0xAE24851D, 0xE414, 0x4062, { 0x95, 0x9D, 0x5F, 0x43, 0xEA, 0x99, 0x36, 0x3C } }, \
+  { 0xAE717C2F, 0x1A42, 0x4F2B, { 0x88, 0x61, 0x78, 0xB7, 0x9C, 0xA0, 0x7E, 0x07 } }, \
+  { 0xAFE751C5, 0x05D4, 0x4898, { 0xBF, 0x94, 0x1A, 0x4B, 0x50, 0xF3, 0x5F, 0xD4 } }, \
+  { 0xB0D6ED53, 0xB844, 0x43F5, { 0xBD, 0x2F, 0x61, 0x09, 0x52, 0x64, 0xE7, 0x7E } }, \
+  { 0xB13EDD38, 0x684C, 0x41ED, { 0xA3, 0x05, 0xD7, 0xB7, 0xE3, 0x24, 0x97, 0xDF } }, \
+  { 0xB1DA0ADF, 0x4F77, 0x4070, { 0xA8, 0x8E, 0xBF, 0xFE, 0x1C, 0x60, 0x52, 0x9A } }, \
+  { 0xB4186561, 0x8967, 0x4113, { 0xBC, 0x5F, 0x28, 0x4B, 0x76, 0x70, 0xC4, 0xA0 } }, \
+  { 0xB45B5FC4, 0xD6A6, 0x4523, { 0xA2, 0x29, 0xE7, 0x77, 0x20, 0x97, 0xEF, 0x14 } }, \
+  { 0xB71ECD12, 0xE01E, 0x440B, { 0xAA, 0x52, 0x4D, 0x6E, 0x59, 0xD4, 0x5B, 0x3C } }, \
+  { 0xB941CF11, 0xE648, 0x401C, { 0x92, 0xA1, 0x34, 0x2A, 0x70, 0xC6, 0xB7, 0x42 } }, \
+  { 0xB98999A4, 0xE96F, 0x475A, { 0x99, 0xFC, 0x76, 0x21, 0x26, 0xF5, 0x0F, 0x5A } }, \
+  { 0xBB1FBD4F, 0x2E30, 0x4793, { 0x9B, 0xED, 0x74, 0xF6, 0x72, 0xBC, 0x8F, 0xFE } }, \
+  { 0xBB65942B, 0x521F, 0x4EC3, { 0xBA, 0xF9, 0xA9, 0x25, 0x40, 0xCF, 0x60, 0xD2 } }, \
+  { 0xBB87B31D, 0xF366, 0x47E9, { 0x88, 0x5E, 0xE8, 0x16, 0xB0, 0x9B, 0x97, 0xB6 } }, \
+  { 0xBCABB6DD, 0x3E9F, 0x47E2, { 0xB8, 0xFB, 0x10, 0xB3, 0x9A, 0xF6, 0x34, 0x2C } }, \
+  { 0xBCBB3912, 0x29FA, 0x4B25, { 0xB6, 0x19, 0x3C, 0x0D, 0x73, 0x9F, 0xEF, 0x51 } }, \
+  { 0xBD45A258, 0xC7BD, 0x4BF0, { 0xB2, 0x54, 0xD0, 0xD4, 0x5E, 0x02, 0xF8, 0x77 } }, \
+  { 0xBDCBB03C, 0x545E, 0x43C1, { 0x8A, 0xA8, 0xF0, 0x58, 0xC4, 0xFA, 0x81, 0xA8 } }, \
+  { 0xBDE92229, 0xF9A5, 0x4897, { 0x81, 0xE4, 0x8B, 0xAB, 0x67, 0x92, 0xA3, 0x95 } }, \
+  { 0xBDFAAD26, 0x4D7F, 0x44A6, { 0x87, 0x19, 0x37, 0x5E, 0xCB, 0x4A, 0xA4, 0x07 } }, \
+  { 0xBE216BA8, 0x38C4, 0x4535, { 0xA6, 0xCA, 0x5D, 0xCA, 0x5B, 0x43, 0xAD, 0xDF } }, \
+  { 0xBF27A268, 0xF369, 0x43A2, { 0xB2, 0x95, 0x24, 0x2D, 0xEE, 0x7F, 0x3C, 0x29 } }, \
+  { 0xBFD59D42, 0xFE0F, 0x4251, { 0xB7, 0x72, 0x4B, 0x09, 0x8A, 0x1A, 0xEC, 0x85 } }, \
+  { 0xC0B9206E, 0xB6AB, 0x4DF0, { 0xB3, 0xD6, 0x28, 0x6A, 0xC7, 0x66, 0x98, 0xBD } }, \
+  { 0xC10A9E4D, 0xBDB4, 0x4B1A, { 0x82, 0xCC, 0xD9, 0x01, 0xF8, 0x6F, 0x57, 0x39 } }, \
+  { 0xC1443436, 0xB954, 0x43BA, { 0x82, 0x78, 0xC1, 0xE4, 0x42, 0xC2, 0x15, 0x39 } }, \
+  { 0xC1C418F9, 0x591D, 0x461C, { 0x82, 0xA2, 0xB9, 0xCD, 0x96, 0xDF, 0xEA, 0x86 } }, \
+  { 0xC41459C2, 0xA281, 0x40D3, { 0xB3, 0x0A, 0x2B, 0x9D, 0xFF, 0x3F, 0x3D, 0xA0 } }, \
+  { 0xC4331752, 0x8BAC, 0x4F2A, { 0xA9, 0xC3, 0x41, 0x8A, 0xDF, 0xB0, 0x33, 0xC4 } }, \
+  { 0xC4C7A1A9, 0xD639, 0x442D, { 0xB3, 0x58, 0x09, 0xD0, 0x6A, 0xE1, 0x8B, 0xFC } }, \
+  { 0xC4F2D007, 0x37FD, 0x422D, { 0xB6, 0x3D, 0x7E, 0xD7, 0x38, 0x86, 0xE6, 0xCA } }, \
+  { 0xC65AF0E1, 0x82B3, 0x416A, { 0x8F, 0x0A, 0xDD, 0xD0, 0xD3, 0x09, 0x8C, 0x58 } }, \
+  { 0xC67CBA49, 0xB3C6, 0x4CBA, { 0x96, 0x71, 0xBF, 0x27, 0x88, 0x71, 0x21, 0x28 } }, \
+  { 0xC7B11F3C, 0x89E9, 0x445F, { 0xA9, 0x72, 0x67, 0x1B, 0x8B, 0x17, 0x58, 0x0D } }, \
+  { 0xC810485E, 0xD0EC, 0x4E98, { 0xAA, 0xB5, 0x12, 0x0C, 0x7E, 0x55, 0x44, 0x28 } }, \
+  { 0xC86181CD, 0xB38C, 0x49DD, { 0xA1, 0x76, 0x7D, 0xC3, 0x59, 0x18, 0x16, 0xA9 } }, \
+  { 0xC87DBB18, 0x9ADD, 0x41D5, { 0x80, 0xD7, 0x4C, 0x8D, 0x79, 0x5A, 0xD9, 0x42 } }, \
+  { 0xC89CEC07, 0xC4EE, 0x440C, { 0xBF, 0xC5, 0xA2, 0x2F, 0x43, 0x37, 0x2F, 0x22 } }, \
+  { 0xC9D9CE44, 0x708D, 0x4E27, { 0xB9, 0x89, 0xE3, 0x5A, 0x33, 0x99, 0x9C, 0x28 } }, \
+  { 0xCBC59C4A, 0x383A, 0x41EB, { 0xA8, 0xEE, 0x44, 0x98, 0xAE, 0xA5, 0x67, 0xE4 } }, \
+  { 0xCCCC8702, 0xBD68, 0x45B1, { 0x82, 0x37, 0xC7, 0xDD, 0x00, 0x4C, 0xDB, 0x37 } }, \
+  { 0xCD84562C, 0x6864, 0x40A3, { 0xA0, 0x81, 0xC8, 0xD3, 0x5E, 0x82, 0xB9, 0x20 } }, \
+  { 0xCDC11AE9, 0x01E7, 0x42CB, { 0x88, 0xEB, 0xFD, 0xFF, 0xD8, 0x81, 0x98, 0x93 } }, \
+  { 0xCEF68C66, 0x06AB, 0x4FB3, { 0xA3, 0xED, 0x5F, 0xFA, 0x88, 0x5B, 0x57, 0x25 } }, \
+  { 0xD0632C90, 0xAFD7, 0x4492, { 0xB1, 0x86, 0x25, 0x7C, 0x63, 0x14, 0x3C, 0x61 } }, \
+  { 0xD15170BE, 0xD512, 0x4894, { 0xB8, 0x63, 0x9D, 0x0E, 0x6F, 0xF5, 0xC5, 0x61 } }, \
+  { 0xD472AB34, 0x8E21, 0x4343, { 0x8B, 0xFF, 0x01, 0xEC, 0xDE, 0x29, 0x23, 0x75 } }, \
+  { 0xD4A79A0D, 0xB67D, 0x4E83, { 0x8E, 0xFB, 0x45, 0x59, 0x24, 0x37, 0x29, 0x34 } }, \
+  { 0xD4B61940, 0x73AB, 0x48A5, { 0x9E, 0x26, 0x53, 0xA4, 0xCA, 0x4A, 0x2C, 0x37 } }, \
+  { 0xD61B6C7A, 0x653A, 0x45A9, { 0x8A, 0xF3, 0x63, 0xA8, 0xA5, 0x07, 0x66, 0x39 } }, \
+  { 0xD6AC4AC2, 0x8BC2, 0x4CDD, { 0x87, 0x76, 0x28, 0x0E, 0x14, 0x69, 0xDE, 0x02 } }, \
+  { 0xD700E3BC, 0x4291, 0x4749, { 0x87, 0xAF, 0x43, 0x2A, 0x02, 0x3D, 0xE6, 0x58 } }, \
+  { 0xD739F969, 0xFB2D, 0x4BC2, { 0xAF, 0xE7, 0x08, 0x13, 0x27, 0xD3, 0xFE, 0xDE } }, \
+  { 0xD77C900D, 0xA1C7, 0x41C5, { 0xB9, 0x89, 0x0C, 0x3D, 0x37, 0xFC, 0xA4, 0x32 } }, \
+  { 0xD85A4A0C, 0x2E73, 0x4491, { 0x92, 0xE1, 0xDC, 0xEF, 0xC3, 0x88, 0x2A, 0x68 } }, \
+  { 0xD9389EFA, 0x2C9A, 0x4696, { 0x8B, 0xB6, 0xFC, 0x5F, 0x39, 0x8D, 0x8D, 0xF3 } }, \
+  { 0xD9CD0AA0, 0xC20F, 0x4810, { 0x99, 0x9E, 0xD9, 0x91, 0xFD, 0x04, 0x84, 0xD9 } }, \
+  { 0xDA451AF6, 0x88D1, 0x4FD7, { 0xB8, 0x6E, 0x44, 0xBC, 0x47, 0xEE, 0x1F, 0x7E } }, \
+  { 0xDC7063FC, 0xE01D, 0x476F, { 0x9B, 0xF3, 0xDE, 0x01, 0x08, 0x84, 0xBC, 0x53 } }, \
+  { 0xDC9CACE8, 0x8C2E, 0x4FE7, { 0x9E, 0x41, 0xE1, 0x8C, 0x75, 0xFE, 0x9B, 0x66 } }, \
+  { 0xDCAA4B60, 0x408F, 0x4BAD, { 0x99, 0xB9, 0xB8, 0x80, 0xD4, 0xEF, 0x09, 0x50 } }, \
+  { 0xDE23ACEE, 0xCF55, 0x4FB6, { 0xAA, 0x77, 0x98, 0x4A, 0xB5, 0x3D, 0xE8, 0x11 } }, \
+  { 0xDE23ACEE, 0xCF55, 0x4FB6, { 0xAA, 0x77, 0x98, 0x4A, 0xB5, 0x3D, 0xE8, 0x23 } }, \
+  { 0xDED7956D, 0x7E20, 0x4F20, { 0x91, 0xA1, 0x19, 0x04, 0x39, 0xB0, 0x4D, 0x5B } }, \
+  { 0xDEFBFC7A, 0xCC02, 0x4225, { 0x88, 0xAD, 0x3C, 0x41, 0xE6, 0x21, 0x78, 0x5B } }, \
+  { 0xDFE7EE64, 0xD4FD, 0x4424, { 0xBF, 0x1F, 0x85, 0xDA, 0x52, 0x42, 0x36, 0xFB } }, \
+  { 0xDFF4E6C8, 0x234C, 0x453E, { 0xA9, 0x2D, 0xFA, 0x50, 0x5E, 0x90, 0xD5, 0x39 } }, \
+  { 0xE0364FEE, 0x1440, 0x4A41, { 0xAD, 0x3E, 0x50, 0xE0, 0xB1, 0x06, 0xA8, 0x3D } }, \
+  { 0xE03ABADF, 0xE536, 0x4E88, { 0xB3, 0xA0, 0xB7, 0x7F, 0x78, 0xEB, 0x34, 0xFE } }, \
+  { 0xE052D8A6, 0x224A, 0x4C32, { 0x8D, 0x37, 0x2E, 0x0A, 0xE1, 0x62, 0x36, 0x4D } }, \
+  { 0xE10539B8, 0x1C35, 0x4B84, { 0x85, 0x93, 0x81, 0x55, 0x5D, 0x06, 0x5D, 0xD5 } }, \
+  { 0xE2CFB356, 0x39A9, 0x497B, { 0xB6, 0xB1, 0x95, 0xB9, 0xD2, 0xEB, 0x28, 0x17 } }, \
+  { 0xE305E101, 0x913A, 0x4A51, { 0x8E, 0x0E, 0xB4, 0x61, 0x8C, 0x5D, 0xB3, 0x26 } }, \
+  { 0xE374574A, 0x2ADF, 0x43DB, { 0xA7, 0x78, 0x88, 0xA7, 0x5F, 0xC0, 0x80, 0x26 } }, \
+  { 0xE3932A34, 0x5729, 0x4F24, { 0x9F, 0xB1, 0xD7, 0x40, 0x9B, 0x45, 0x6A, 0x15 } }, \
+  { 0xE3ED7C21, 0x9DB8, 0x47C7, { 0x8E, 0x7D, 0x7D, 0xB9, 0x7F, 0xE2, 0x06, 0x3E } }, \
+  { 0xE566B097, 0x4378, 0x485F, { 0x91, 0xD0, 0x1C, 0x09, 0x7C, 0x19, 0x0C, 0xE2 } }, \
+  { 0xE72527CF, 0x505B, 0x4B50, { 0x99, 0xCD, 0xA3, 0x24, 0x67, 0xFA, 0x4A, 0xA4 } }, \
+  { 0xE77E53A5, 0xA5B8, 0x45DC, { 0xBA, 0xEB, 0x66, 0xC8, 0x6F, 0x1A, 0xC8, 0x11 } }, \
+  { 0xE807983E, 0xD366, 0x40C9, { 0x84, 0x6A, 0x0E, 0xD7, 0xE6, 0x02, 0x2C, 0x96 } }, \
+  { 0xE975314A, 0x1464, 0x411F, { 0x85, 0xE4, 0x04, 0x1D, 0x90, 0x3C, 0xB6, 0xC4 } }, \
+  { 0xEB78CE7E, 0x4107, 0x4EF5, { 0x86, 0xCB, 0x22, 0xE8, 0xD8, 0xAC, 0x49, 0x50 } }, \
+  { 0xECD81473, 0x0533, 0x4844, { 0xBC, 0x77, 0x48, 0xF0, 0xDE, 0x27, 0x51, 0x9B } }, \
+  { 0xEDA39402, 0xF375, 0x4496, { 0x92, 0xD3, 0x83, 0xB4, 0x3C, 0xB8, 0xA7, 0x6A } }, \
+  { 0xEFD652CC, 0x0E99, 0x40F0, { 0x96, 0xC0, 0xE0, 0x8C, 0x08, 0x90, 0x70, 0xFC } }, \
+  { 0xF0D8DEAA, 0xC495, 0x4139, { 0xB1, 0xFC, 0x78, 0xB7, 0x01, 0x68, 0x26, 0x0A } }, \
+  { 0xF0FFF864, 0x8454, 0x46E5, { 0x9F, 0x2B, 0xCF, 0x14, 0xF0, 0xA4, 0x1A, 0x48 } }, \
+  { 0xF1A18726, 0xFD79, 0x4DF5, { 0xA3, 0x26, 0xE2, 0x0B, 0x8C, 0xC4, 0x6B, 0x06 } }, \
+  { 0xF317B29B, 0x7DC9, 0x4114, { 0x90, 0x86, 0xD7, 0x13, 0x7E, 0xF4, 0xF1, 0x18 } }, \
+  { 0xF31C76B9, 0x0B55, 0x4456, { 0x99, 0xFE, 0x50, 0xA9, 0xC5, 0xEC, 0x11, 0x6C } }, \
+  { 0xF64EFABA, 0xD0A9, 0x42C3, { 0xB5, 0xE8, 0x39, 0x1B, 0x48, 0x64, 0x7B, 0xF1 } }, \
+  { 0xF6CDAAE0, 0xB301, 0x4202, { 0x89, 0xF6, 0x86, 0x23, 0xE6, 0xAE, 0xD2, 0x6E } }, \
+  { 0xF7D7F748, 0xCCDE, 0x481F, { 0x9B, 0x86, 0x2E, 0xF5, 0xED, 0xAC, 0xC2, 0x1D } }, \
+  { 0xF8BB41A2, 0x485E, 0x4B9D, { 0x88, 0xCF, 0x15, 0x1E, 0x62, 0xF8, 0x4D, 0xDE } }, \
+  { 0xF9109394, 0xE5A3, 0x4E61, { 0xB1, 0x68, 0xDC, 0x34, 0xD5, 0x34, 0x45, 0x1E } }, \
+  { 0xF935FF1B, 0xAFF0, 0x40F3, { 0xB7, 0x7A, 0xB7, 0x95, 0xA7, 0xA7, 0xD7, 0x14 } }, \
+  { 0xF94AB34A, 0x8069, 0x4A9F, { 0xAD, 0x08, 0x95, 0x34, 0xEF, 0x37, 0xD9, 0xBE } }, \
+  { 0xFB142B99, 0xDF57, 0x46CB, { 0xBC, 0x69, 0x0B, 0xF8, 0x58, 0xA7, 0x34, 0xF9 } }, \
+  { 0xFC1B7640, 0x3466, 0x4C06, { 0xB1, 0xCC, 0x1C, 0x93, 0x53, 0x94, 0xB5, 0xC2 } }, \
+  { 0xFC87501F, 0xF707, 0x49A2, { 0xB6, 0x76, 0x77, 0x71, 0x7D, 0xD9, 0x04, 0xDC } }, \
+  { 0x0997E770, 0x756E, 0x4139, { 0xBF, 0x3F, 0x7F, 0xC2, 0xA3, 0x08, 0x17, 0x7E } }, \
+  { 0x3B42EF57, 0x16D3, 0x44CB, { 0x86, 0x32, 0x9F, 0xDB, 0x06, 0xB4, 0x14, 0x51 } }, \
+  { 0x4FE772E8, 0xFE3E, 0x4086, { 0xB6, 0x38, 0x8C, 0x49, 0x3C, 0x49, 0x04, 0x88 } }, \
+  { 0x5479E09C, 0x2E74, 0x481B, { 0x89, 0xF8, 0xB0, 0x17, 0x2E, 0x38, 0x8D, 0x1F } }, \
+  { 0x643DF777, 0xF312, 0x42ED, { 0x81, 0xCC, 0x1B, 0x1F, 0x57, 0xE1, 0x8A, 0xD6 } }, \
+  { 0x6B4FDBD2, 0x47E1, 0x4A09, { 0xBA, 0x8E, 0x8E, 0x04, 0x1F, 0x20, 0x8B, 0x95 } }, \
+  { 0x70E65212, 0xF3AD, 0x495F, { 0xB3, 0xA1, 0x7A, 0x63, 0x54, 0x2E, 0xD7, 0xD5 } }, \
+  { 0xB6A2AFF3, 0x767C, 0x5658, { 0xC3, 0x7A, 0xD1, 0xC8, 0x2E, 0xF7, 0x65, 0x43 } }, \
+  { 0x0013BE6B, 0x2198, 0x43F1, { 0x93, 0xBA, 0x2A, 0x7E, 0xD7, 0xB1, 0xE1, 0xCC } }, \
+  { 0x0167CCC4, 0xD0F7, 0x4F21, { 0xA3, 0xEF, 0x9E, 0x64, 0xB7, 0xCD, 0xCE, 0x8B } }, \
+  { 0x0167CCC4, 0xD0F7, 0x4F21, { 0xA3, 0xEF, 0x9E, 0x64, 0xB7, 0xCD, 0xCE, 0x8C } }, \
+  { 0x025BBFC7, 0xE6A9, 0x4B8B, { 0x82, 0xAD, 0x68, 0x15, 0xA1, 0xAE, 0xAF, 0x4A } }, \
+  { 0x03BF5679, 0x5749, 0x4BC5, { 0xA5, 0x3F, 0x47, 0x47, 0x1D, 0xA7, 0x67, 0xC8 } }, \
+  { 0x03EBDB4B, 0x96BA, 0x4F40, { 0x83, 0x29, 0x7F, 0x3A, 0xA8, 0x86, 0x57, 0x07 } }, \
+  { 0x051A0B77, 0xC066, 0x4610, { 0x99, 0x04, 0xBF, 0x25, 0xC2, 0x96, 0xD6, 0xE6 } }, \
+  { 0x06384570, 0x1680, 0x4620, { 0x9D, 0x00, 0x6A, 0xD9, 0xE3, 0xCC, 0xB1, 0x9F } }, \
+  { 0x06968B6E, 0xF620, 0x4E8D, { 0xA6, 0xA6, 0x52, 0x55, 0x23, 0x54, 0xDD, 0x75 } }, \
+  { 0x06DE824A, 0xA4E2, 0x4295, { 0xA3, 0xF6, 0x03, 0xB3, 0xFE, 0xF5, 0xB1, 0x09 } }, \
+  { 0x0723F88B, 0x810F, 0x4E44, { 0x92, 0xA0, 0xA5, 0xC8, 0x3B, 0x43, 0x36, 0x98 } }, \
+  { 0x0770E7A0, 0x9C3A, 0x499C, { 0xA3, 0x11, 0x2F, 0x83, 0x85, 0x08, 0x05, 0x56 } }, \
+  { 0x07A9330A, 0xF347, 0x11D4, { 0x9A, 0x49, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x087E9760, 0x1FB5, 0x49F7, { 0x87, 0x9A, 0x85, 0x3D, 0x2B, 0x21, 0x4C, 0xC7 } }, \
+  { 0x08FBD32F, 0x867F, 0x452B, { 0xB1, 0x34, 0x70, 0x51, 0x61, 0xF7, 0x33, 0x33 } }, \
+  { 0x0A66E322, 0x3740, 0x4CCE, { 0xAD, 0x62, 0xBD, 0x17, 0x2C, 0xEC, 0xCA, 0x35 } }, \
+  { 0x0B6A8DE0, 0x6281, 0x40A2, { 0x8E, 0x9A, 0x09, 0xF1, 0xA1, 0x8A, 0x6D, 0x40 } }, \
+  { 0x0C396FCA, 0x6BDA, 0x4A15, { 0xB6, 0xA3, 0xA6, 0xFA, 0x45, 0x44, 0xBD, 0xB7 } }, \
+  { 0x0D648466, 0x36BD, 0x42C6, { 0xB2, 0x87, 0x7C, 0x3B, 0xAA, 0x25, 0x75, 0xC0 } }, \
+  { 0x0FE159B5, 0x076F, 0x4C36, { 0xBF, 0x26, 0xD7, 0x24, 0xF2, 0x83, 0x12, 0x52 } }, \
+  { 0x10149626, 0x5583, 0x4364, { 0x82, 0x2F, 0xA4, 0x59, 0xB8, 0x12, 0x13, 0x02 } }, \
+  { 0x114CA60C, 0xD965, 0x4C13, { 0xBE, 0xF7, 0xC4, 0x06, 0x22, 0x48, 0xE1, 0xFA } }, \
+  { 0x124A2E7A, 0x1949, 0x483E, { 0x89, 0x9F, 0x60, 0x32, 0x90, 0x4C, 0xA0, 0xA7 } }, \
+  { 0x126A762D, 0x5758, 0x4FCA, { 0x85, 0x31, 0x20, 0x1A, 0x7F, 0x57, 0xF8, 0x50 } }, \
+  { 0x12E7691F, 0x1EEE, 0x4ED4, { 0x87, 0x93, 0x69, 0xE2, 0x80, 0x1D, 0x60, 0x2A } }, \
+  { 0x13AC6DD0, 0x73D0, 0x11D4, { 0xB0, 0x6B, 0x00, 0xAA, 0x00, 0xBD, 0x6D, 0xE7 } }, \
+  { 0x1504BA7B, 0x58F8, 0x4D12, { 0x96, 0x38, 0xB4, 0x94, 0xA7, 0x04, 0x43, 0x76 } }, \
+  { 0x15C80344, 0xF980, 0x4BF5, { 0xAA, 0xA0, 0xBF, 0xBE, 0x02, 0x7A, 0xEF, 0x16 } }, \
+  { 0x15DD5676, 0x2679, 0x4E24, { 0x9C, 0xAA, 0x85, 0xB2, 0x2D, 0xD8, 0x93, 0xEB } }, \
+  { 0x170D9568, 0xC969, 0x4FA1, { 0xA5, 0x33, 0xDB, 0x67, 0x79, 0xBF, 0xBE, 0x62 } }, \
+  { 0x18578E75, 0xD073, 0x4203, { 0x90, 0xD2, 0x87, 0x88, 0xA8, 0x71, 0xE4, 0x4D } }, \
+  { 0x19B6F165, 0x7855, 0x42E8, { 0xAA, 0x6F, 0x23, 0x61, 0xCA, 0x87, 0xE0, 0x24 } }, \
+  { 0x1A7E4468, 0x2F55, 0x4A56, { 0x90, 0x3C, 0x01, 0x26, 0x5E, 0xB7, 0x62, 0x2B } }, \
+  { 0x1C6B2FAF, 0xD8BD, 0x44D1, { 0xA9, 0x1E, 0x73, 0x21, 0xB4, 0xC2, 0xF3, 0xD1 } }, \
+  { 0x1D201235, 0x2F40, 0x4FBC, { 0x86, 0x50, 0x85, 0x02, 0x09, 0x2D, 0x62, 0xAB } }, \
+  { 0x202A2B0E, 0x9A31, 0x4812, { 0xB2, 0x91, 0x87, 0x47, 0xDF, 0x15, 0x24, 0x39 } }, \
+  { 0x22BF0B85, 0x4EB3, 0x479B, { 0xA9, 0xE9, 0xA5, 0xF7, 0xCF, 0xCC, 0xA7, 0x87 } }, \
+  { 0x2338337A, 0x47B0, 0x4C41, { 0x9C, 0xA7, 0x01, 0x60, 0xFB, 0x94, 0xDF, 0xF4 } }, \
+  { 0x238D654D, 0xA6AD, 0x41C8, { 0xA3, 0x1B, 0x67, 0xA3, 0x20, 0x86, 0x25, 0xC3 } }, \
+  { 0x23D93EAA, 0x0723, 0x4559, { 0xB7, 0x68, 0x5E, 0x22, 0xDF, 0x76, 0x2D, 0xE4 } }, \
+  { 0x240612B7, 0xA063, 0x11D4, { 0x9A, 0x3A, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4C } }, \
+  { 0x240612B7, 0xA063, 0x11D4, { 0x9A, 0x3A, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x240612B7, 0xA063, 0x11D4, { 0x9A, 0x3A, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4E } }, \
+  { 0x243C8C8A, 0xBBD0, 0x4AA9, { 0xBE, 0x17, 0xCF, 0x9B, 0x58, 0x31, 0x30, 0xEC } }, \
+  { 0x246F9F0A, 0x11E3, 0x459A, { 0xAE, 0x06, 0x37, 0x2B, 0xDC, 0x4D, 0xE8, 0x06 } }, \
+  { 0x2554EF5E, 0xC9CA, 0x4A48, { 0x9D, 0x94, 0x24, 0x9E, 0xB1, 0xE8, 0x7C, 0x2D } }, \
+  { 0x25F49067, 0xA65B, 0x48F5, { 0xBB, 0xBE, 0x35, 0x41, 0x8C, 0x48, 0x88, 0x36 } }, \
+  { 0x26DDBA9F, 0x5B0D, 0x4E80, { 0x86, 0xB2, 0x80, 0xDA, 0xE4, 0xD0, 0x1B, 0x0E } }, \
+  { 0x27F4917B, 0xA707, 0x4AAD, { 0x96, 0x76, 0x26, 0xDF, 0x16, 0x8C, 0xBF, 0x0D } }, \
+  { 0x28B5A45C, 0xCC5D, 0x4221, { 0x9D, 0xFF, 0x86, 0xB0, 0xF4, 0x2D, 0xDC, 0x01 } }, \
+  { 0x29A1A717, 0x36E9, 0x49E0, { 0xB3, 0x81, 0xEA, 0x3B, 0x5F, 0xF7, 0x09, 0x42 } }, \
+  { 0x2A4224A1, 0x2609, 0x40A7, { 0x88, 0xE2, 0xA6, 0x8D, 0xC0, 0xF1, 0xD1, 0x80 } }, \
+  { 0x2ACB1E45, 0xDFA4, 0x4FF3, { 0x8F, 0x81, 0x91, 0xF7, 0xD7, 0x87, 0xD2, 0x2D } }, \
+  { 0x2BDED685, 0xF733, 0x455F, { 0xA8, 0x40, 0x43, 0xA2, 0x2B, 0x79, 0x1F, 0xB3 } }, \
+  { 0x2D1E361C, 0x7B3F, 0x4D15, { 0x8B, 0x1F, 0x66, 0xE5, 0x51, 0xFA, 0xBD, 0xC7 } }, \
+  { 0x2D2E62AA, 0x9ECF, 0x43B7, { 0x82, 0x19, 0x94, 0xE7, 0xFC, 0x71, 0x3D, 0xFE } }, \
+  { 0x2D2E62CF, 0x9ECF, 0x43B7, { 0x82, 0x19, 0x94, 0xE7, 0xFC, 0x71, 0x3D, 0xFE } }, \
+  { 0x2D6F37BF, 0x9AFC, 0x4AA5, { 0xA0, 0x26, 0x32, 0xB2, 0xFC, 0xF3, 0x0F, 0xB9 } }, \
+  { 0x2EE81ACB, 0x64B2, 0x41AE, { 0x86, 0x35, 0x70, 0x30, 0xD1, 0x6C, 0x4A, 0xA8 } }, \
+  { 0x301A0BC3, 0xBA16, 0x49F9, { 0x85, 0x8B, 0xDE, 0xE0, 0x5F, 0x91, 0xE7, 0xB8 } }, \
+  { 0x311032C4, 0x98A6, 0x4E06, { 0x8C, 0x03, 0xD8, 0x15, 0xFD, 0x1F, 0xE7, 0x09 } }, \
+  { 0x316190D1, 0x5E48, 0x4C15, { 0xAC, 0x72, 0x37, 0x53, 0x2F, 0x3A, 0x1E, 0xC1 } }, \
+  { 0x32442D09, 0x1D11, 0x4E27, { 0x8A, 0xAB, 0x90, 0xFE, 0x6A, 0xCB, 0x04, 0x89 } }, \
+  { 0x32C1C9F8, 0xD53F, 0x41C8, { 0x94, 0xD0, 0xF6, 0x73, 0x9F, 0x23, 0x10, 0x11 } }, \
+  { 0x348C4D62, 0xBFBD, 0x4882, { 0x9E, 0xCE, 0xC8, 0x0B, 0xB1, 0xC4, 0x78, 0x3B } }, \
+  { 0x34D51EB9, 0x76DB, 0x4CAF, { 0x94, 0xAE, 0x93, 0x48, 0x56, 0xE8, 0x95, 0xF6 } }, \
+  { 0x35B898CA, 0xB6A9, 0x49CE, { 0x8C, 0x72, 0x90, 0x47, 0x35, 0xCC, 0x49, 0xB7 } }, \
+  { 0x37087B94, 0xEF41, 0x4977, { 0x93, 0xE2, 0x3F, 0x6A, 0xDF, 0xDD, 0x06, 0xE1 } }, \
+  { 0x371FA4B8, 0x8042, 0x4ED6, { 0xAD, 0xA7, 0xA9, 0x87, 0xBD, 0x2C, 0xDF, 0x0A } }, \
+  { 0x378D7B65, 0x8DA9, 0x4773, { 0xB6, 0xE4, 0xA4, 0x78, 0x26, 0xA8, 0x33, 0xE1 } }, \
+  { 0x37A0D020, 0xCCD1, 0x11DD, { 0xAD, 0x8B, 0x08, 0x00, 0x20, 0x0C, 0x9A, 0x66 } }, \
+  { 0x37AFCF55, 0x2E8C, 0x4722, { 0xB9, 0x50, 0xB4, 0x8B, 0x91, 0x65, 0xC5, 0x6B } }, \
+  { 0x37DDC7E9, 0x7C1D, 0x4E1B, { 0xB2, 0xCB, 0x4E, 0xD5, 0xD1, 0x25, 0x27, 0xB3 } }, \
+  { 0x37ECDF24, 0x8453, 0x476A, { 0xAB, 0x58, 0xF4, 0xCF, 0x8B, 0xFE, 0x67, 0x42 } }, \
+  { 0x389244DB, 0x3D6E, 0x4E50, { 0x83, 0x5D, 0x5A, 0x77, 0x5A, 0x32, 0x5D, 0x89 } }, \
+  { 0x3A2AEC67, 0x77B8, 0x40AE, { 0x92, 0x81, 0x03, 0x51, 0x9C, 0x9E, 0x7F, 0x08 } }, \
+  { 0x3C14C099, 0x3143, 0x46EF, { 0xAF, 0x18, 0xDE, 0x4A, 0xD2, 0xC3, 0xA7, 0x99 } }, \
+  { 0x3DC82376, 0x637B, 0x40A6, { 0xA8, 0xFC, 0xA5, 0x65, 0x41, 0x7F, 0x2C, 0x38 } }, \
+  { 0x3DFC255F, 0x9C86, 0x48BC, { 0x97, 0x2D, 0xE5, 0x22, 0x53, 0x37, 0x68, 0xDB } }, \
+  { 0x3E44AD09, 0xD88B, 0x4C52, { 0xB4, 0x1B, 0xB8, 0xC0, 0x05, 0x36, 0x47, 0x4A } }, \
+  { 0x3F7753EF, 0xD36F, 0x45CC, { 0x8A, 0x1A, 0x2E, 0xAA, 0xFF, 0x10, 0x38, 0xB6 } }, \
+  { 0x3F7E615B, 0x0D45, 0x4F80, { 0x88, 0xDC, 0x26, 0xB2, 0x34, 0x95, 0x85, 0x60 } }, \
+  { 0x3FB856A5, 0xC8B0, 0x4760, { 0xB4, 0x9A, 0x2E, 0xDD, 0x4F, 0xA3, 0x5B, 0xFA } }, \
+  { 0x401471E4, 0x9E79, 0x4664, { 0xBF, 0xB0, 0x17, 0x95, 0x24, 0x23, 0x05, 0x67 } }, \
+  { 0x408EDCEC, 0xCF6D, 0x477C, { 0xA5, 0xA8, 0xB4, 0x84, 0x4E, 0x3D, 0xE2, 0x81 } }, \
+  { 0x43172851, 0xCF7E, 0x4345, { 0x9F, 0xE0, 0xD7, 0x01, 0x2B, 0xB1, 0x7B, 0x88 } }, \
+  { 0x43B93232, 0xAFBE, 0x11D4, { 0xBD, 0x0F, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 } }, \
+  { 0x43BB9EAB, 0x7D57, 0x4DEF, { 0xB0, 0xA2, 0xA3, 0xA9, 0xF9, 0xC6, 0xEA, 0xE3 } }, \
+  { 0x44CF7D20, 0xDFF6, 0x4209, { 0x9A, 0x1F, 0xF6, 0xCD, 0x5F, 0x5C, 0xE8, 0x8B } }, \
+  { 0x44F23590, 0xDC88, 0x11DD, { 0xAD, 0x8B, 0x08, 0x00, 0x20, 0x0C, 0x9A, 0x66 } }, \
+  { 0x4589CBF3, 0x03F9, 0x4998, { 0x9D, 0x6F, 0x26, 0x34, 0x3C, 0x69, 0x56, 0x2A } }, \
+  { 0x46D8ACDD, 0x29C3, 0x4013, { 0x81, 0xE8, 0x37, 0xA4, 0x25, 0xAB, 0x4F, 0x99 } }, \
+  { 0x4A5227D3, 0x0BEF, 0x4CAA, { 0xAC, 0xBD, 0xEC, 0x84, 0x44, 0x6C, 0x5C, 0x6C } }, \
+  { 0x4B6B21A1, 0xF26B, 0x404F, { 0x86, 0x94, 0xDB, 0x1C, 0x63, 0xA1, 0xD9, 0x2A } }, \
+  { 0x4C7D1568, 0xCF73, 0x4676, { 0xA0, 0x79, 0x16, 0xF7, 0xF9, 0x60, 0x0C, 0xCC } }, \
+  { 0x4D37DA42, 0x3A0C, 0x4EDA, { 0xB9, 0xEB, 0xBC, 0x0E, 0x1D, 0xB4, 0x71, 0x3B } }, \
+  { 0x4D62B5E9, 0x71C8, 0x412A, { 0x86, 0x04, 0x87, 0x8C, 0x92, 0x1D, 0x9A, 0xD1 } }, \
+  { 0x4ECEC19C, 0x6E5F, 0x4815, { 0x83, 0x42, 0xB5, 0x5F, 0x2C, 0xC5, 0xDF, 0xC1 } }, \
+  { 0x4EFC51DA, 0x23A6, 0x4790, { 0xA2, 0x92, 0x49, 0x85, 0xC7, 0xF5, 0xCD, 0xEF } }, \
+  { 0x501BD93A, 0xF1A9, 0x4F4C, { 0xA9, 0x46, 0x78, 0x67, 0xDF, 0x97, 0x55, 0x37 } }, \
+  { 0x510550E0, 0xBBCE, 0x4EBF, { 0xBB, 0xA0, 0x94, 0x6E, 0x3D, 0x18, 0xE7, 0x05 } }, \
+  { 0x5112A2AA, 0xE175, 0x477E, { 0xA4, 0xE4, 0xD0, 0xB7, 0xE6, 0x89, 0xBA, 0x9F } }, \
+  { 0x515B224B, 0xB059, 0x460B, { 0x85, 0xC7, 0xC2, 0x86, 0x58, 0xF4, 0xB8, 0x98 } }, \
+  { 0x51C9F40C, 0x5243, 0x4473, { 0xB2, 0x65, 0xB3, 0xC8, 0xFF, 0xAF, 0xF9, 0xFA } }, \
+  { 0x51CCF399, 0x4FDF, 0x4E55, { 0xA4, 0x5B, 0xE1, 0x23, 0xF8, 0x4D, 0x45, 0x6A } }, \
+  { 0x51D4BACC, 0xE70A, 0x4136, { 0x94, 0x26, 0x54, 0x69, 0x73, 0xED, 0x93, 0x8C } }, \
+  { 0x520F9C58, 0x9F9D, 0x48C6, { 0xA0, 0xA0, 0xD9, 0xFE, 0x6D, 0x8F, 0xDE, 0x77 } }, \
+  { 0x529D3F93, 0xE8E9, 0x4E73, { 0xB1, 0xE1, 0xBD, 0xF6, 0xA9, 0xD5, 0x01, 0x13 } }, \
+  { 0x539D8AAD, 0xC6AC, 0x426C, { 0xB6, 0x1F, 0x22, 0x8E, 0x6D, 0x15, 0x01, 0xB6 } }, \
+  { 0x53BCC14F, 0xC24F, 0x434C, { 0xB2, 0x94, 0x8E, 0xD2, 0xD4, 0xCC, 0x18, 0x60 } }, \
+  { 0x546AD295, 0x0C64, 0x4CE6, { 0xA0, 0x6F, 0xFB, 0x9C, 0xD0, 0x4B, 0x41, 0xCD } }, \
+  { 0x54C32CBF, 0xA3B9, 0x4CCE, { 0x9C, 0x43, 0xE0, 0x59, 0xE3, 0x22, 0x55, 0xDF } }, \
+  { 0x550303D2, 0xF033, 0x4468, { 0x85, 0x7A, 0x44, 0x2C, 0x10, 0xE1, 0x99, 0xE9 } }, \
+  { 0x5552575A, 0x7E00, 0x4D61, { 0xA3, 0xA4, 0xF7, 0x54, 0x73, 0x51, 0xB4, 0x9E } }, \
+  { 0x55F9900A, 0xBFB0, 0x4B30, { 0x83, 0xEE, 0x7F, 0x43, 0x7F, 0xAF, 0xAE, 0x33 } }, \
+  { 0x57F48613, 0x300A, 0x4101, { 0xA7, 0x6D, 0x4F, 0x73, 0xC5, 0x33, 0xB5, 0xB8 } }, \
+  { 0x5A3F3BD1, 0xB7A6, 0x404B, { 0xA0, 0xF7, 0x28, 0x5E, 0x1B, 0x89, 0x8B, 0x00 } }, \
+  { 0x5B74C741, 0x4A5F, 0x4A8E, { 0xB6, 0x89, 0xD8, 0x04, 0xAB, 0x43, 0x68, 0xFD } }, \
+  { 0x5BDDE605, 0xB107, 0x419E, { 0x95, 0x10, 0xAA, 0x3C, 0x43, 0x4E, 0xBB, 0xE4 } }, \
+  { 0x5BDEE236, 0x0CB5, 0x4D86, { 0xA6, 0x08, 0xEE, 0x7B, 0x0C, 0x5F, 0x29, 0x56 } }, \
+  { 0x5BEDB5CC, 0xD830, 0x4EB2, { 0x87, 0x42, 0x2D, 0x4C, 0xC9, 0xB5, 0x4F, 0x2C } }, \
+  { 0x5D758BFB, 0xB323, 0x4F6C, { 0x90, 0x17, 0xA3, 0x23, 0x8C, 0xE6, 0x51, 0x63 } }, \
+  { 0x5F65D21A, 0x8867, 0x45D3, { 0xA4, 0x1A, 0x52, 0x6F, 0x9F, 0xE2, 0xC5, 0x98 } }, \
+  { 0x5FC8EEE0, 0x9BF2, 0x498F, { 0xB4, 0xD3, 0xC5, 0x1E, 0xD4, 0xC8, 0x7B, 0xB4 } }, \
+  { 0x605E41B8, 0xE923, 0x47CC, { 0x87, 0xB1, 0xA6, 0xE3, 0x85, 0x26, 0xE7, 0x8D } }, \
+  { 0x61141CA0, 0x1444, 0x4C4E, { 0xA1, 0x6D, 0xB6, 0x01, 0xE0, 0xA0, 0x94, 0x66 } }, \
+  { 0x621DE6C6, 0x0F5E, 0x4EE3, { 0xA1, 0x02, 0x0B, 0xDE, 0x76, 0x9A, 0x0A, 0xD4 } }, \
+  { 0x62D171CB, 0x78CD, 0x4480, { 0x86, 0x78, 0xC6, 0xA2, 0xA7, 0x97, 0xA8, 0xDE } }, \
+  { 0x63438C6E, 0x971C, 0x4E40, { 0x8F, 0x0B, 0x11, 0x09, 0x45, 0x7B, 0xE3, 0x33 } }, \
+  { 0x65246A3B, 0x33EF, 0x4F7E, { 0xB6, 0x57, 0xA4, 0xA6, 0x33, 0xF1, 0x30, 0xB0 } }, \
+  { 0x65A72030, 0xB02E, 0x4BF3, { 0x84, 0x24, 0xBA, 0x5F, 0x2F, 0xC5, 0x6D, 0xE7 } }, \
+  { 0x665D3F60, 0xAD3E, 0x4CAD, { 0x8E, 0x26, 0xDB, 0x46, 0xEE, 0xE9, 0xF1, 0xB5 } }, \
+  { 0x66EECF40, 0x6312, 0x4A1A, { 0xA8, 0x3A, 0xB3, 0xB2, 0xF8, 0xD8, 0xA7, 0x1A } }, \
+  { 0x67AFDE5F, 0xEF16, 0x47B8, { 0xBA, 0x19, 0xC2, 0x1B, 0x39, 0x07, 0xDB, 0xF1 } }, \
+  { 0x68BC3095, 0x8839, 0x4A97, { 0x8F, 0xEA, 0xBE, 0xE0, 0x6E, 0xCA, 0x7B, 0xBB } }, \
+  { 0x69FD8E47, 0xA161, 0x4550, { 0xB0, 0x1A, 0x55, 0x94, 0xCE, 0xB2, 0xB2, 0xB2 } }, \
+  { 0x6A628EFE, 0x3682, 0x4FDC, { 0xA3, 0x1E, 0xC6, 0x35, 0xBD, 0xF1, 0x8C, 0xC8 } }, \
+  { 0x6A7B1C86, 0x590E, 0x47A7, { 0x97, 0x1A, 0xC4, 0x9B, 0x40, 0x8D, 0x5E, 0xD7 } }, \
+  { 0x6A8A395F, 0x4C07, 0x49D1, { 0xB9, 0x4C, 0x22, 0xED, 0x50, 0xD4, 0x25, 0xF8 } }, \
+  { 0x6D6963AB, 0x906D, 0x4A65, { 0xA7, 0xCA, 0xBD, 0x40, 0xE5, 0xD6, 0xAF, 0x2B } }, \
+  { 0x6E32EAF6, 0x32D1, 0x43E0, { 0xB6, 0xE1, 0xDC, 0xF6, 0xDA, 0x81, 0xDF, 0x76 } }, \
+  { 0x6E5228F3, 0x933E, 0x4961, { 0x95, 0x73, 0x0F, 0x1E, 0x61, 0xB5, 0x22, 0xAC } }, \
+  { 0x6E6E4A75, 0xEF14, 0x47FB, { 0xB4, 0x3A, 0x67, 0xEC, 0x43, 0xB8, 0x7D, 0x22 } }, \
+  { 0x6E6F05AC, 0x234B, 0x465B, { 0x94, 0x50, 0xC3, 0x6E, 0x6D, 0x75, 0x66, 0xC5 } }, \
+  { 0x706C1E0C, 0x44FC, 0x4012, { 0x9B, 0x71, 0x3D, 0xBF, 0xEC, 0x76, 0x2F, 0x35 } }, \
+  { 0x707B3C6E, 0x99A6, 0x4E17, { 0x84, 0xA0, 0x40, 0x28, 0x4C, 0x1B, 0x3F, 0x38 } }, \
+  { 0x717A0EAA, 0x9B18, 0x461A, { 0xB6, 0xEC, 0xAC, 0x09, 0x79, 0x4C, 0xA6, 0x31 } }, \
+  { 0x721C8B66, 0x426C, 0x4E86, { 0x8E, 0x99, 0x34, 0x57, 0xC4, 0x6A, 0xB0, 0xB9 } }, \
+  { 0x7391A960, 0xCCD1, 0x11DD, { 0xAD, 0x8B, 0x08, 0x00, 0x20, 0x0C, 0x9A, 0x66 } }, \
+  { 0x73DAB30F, 0x3F9C, 0x4160, { 0xB0, 0x64, 0x43, 0x9C, 0xE1, 0x6C, 0x3E, 0xDE } }, \
+  { 0x74A016D4, 0x4E4B, 0x45B5, { 0xAE, 0x97, 0x4E, 0x6E, 0x33, 0xD6, 0x51, 0x25 } }, \
+  { 0x758AF8A7, 0x2A04, 0x4937, { 0x99, 0xE0, 0x83, 0x7D, 0x1F, 0x97, 0xC7, 0x6F } }, \
+  { 0x77617ECB, 0xE229, 0x4E20, { 0xB8, 0xF9, 0xDF, 0x82, 0x45, 0x62, 0x4D, 0x7A } }, \
+  { 0x77A6009E, 0x116E, 0x464D, { 0x8E, 0xF8, 0xB3, 0x52, 0x01, 0xA0, 0x22, 0xDD } }, \
+  { 0x78FFCA55, 0x4869, 0x4393, { 0xBE, 0xE9, 0x72, 0xE5, 0x8B, 0xD3, 0xBE, 0x38 } }, \
+  { 0x793CBEA0, 0xDA56, 0x47F2, { 0x82, 0x64, 0x24, 0x31, 0x0C, 0xB7, 0x51, 0x96 } }, \
+  { 0x794610DA, 0xD0EE, 0x466B, { 0x81, 0xB3, 0x81, 0x97, 0x21, 0x3A, 0x69, 0x78 } }, \
+  { 0x79CA4208, 0xBBA1, 0x4A9A, { 0x84, 0x56, 0xE1, 0xE6, 0x6A, 0x81, 0x48, 0x4E } }, \
+  { 0x79E0EDD7, 0x9D1D, 0x4F41, { 0xAE, 0x1A, 0xF8, 0x96, 0x16, 0x9E, 0x52, 0x16 } }, \
+  { 0x79F90154, 0x83F4, 0x478C, { 0x80, 0xBF, 0x87, 0x8A, 0xC3, 0x2E, 0x0A, 0x2C } }, \
+  { 0x7B6F1DA6, 0xEA4F, 0x4938, { 0xA7, 0x9F, 0x0C, 0x58, 0xE1, 0x44, 0x2A, 0xA1 } }, \
+  { 0x7BE725B2, 0xF56C, 0x41C7, { 0x9F, 0x03, 0x1E, 0x7B, 0x56, 0xB6, 0x59, 0x71 } }, \
+  { 0x7CAB2E8A, 0xB799, 0x4540, { 0x85, 0x17, 0x58, 0x64, 0x4D, 0x03, 0xCC, 0x9F } }, \
+  { 0x7E715650, 0x10E6, 0x4B7B, { 0x89, 0x6A, 0x4D, 0xC5, 0xFC, 0x74, 0x2B, 0xC5 } }, \
+  { 0x7EA76D38, 0xC57A, 0x412D, { 0xAF, 0x1D, 0xD5, 0x8B, 0xEE, 0x2B, 0x85, 0xB1 } }, \
+  { 0x7FED72EE, 0x0170, 0x4814, { 0x98, 0x78, 0xA8, 0xFB, 0x18, 0x64, 0xDF, 0xAF } }, \
+  { 0x81334616, 0x86CE, 0x49C2, { 0xB6, 0xF9, 0x18, 0x04, 0xE6, 0x1C, 0x73, 0xF6 } }, \
+  { 0x8218965D, 0x20C0, 0x4DD6, { 0x81, 0xA0, 0x84, 0x5C, 0x52, 0x27, 0x07, 0x43 } }, \
+  { 0x826BCF56, 0xBAC4, 0x43F4, { 0x8E, 0xA1, 0x8C, 0xDF, 0x0A, 0x12, 0x1A, 0xBD } }, \
+  { 0x82988420, 0x7467, 0x4490, { 0x90, 0x59, 0xFE, 0xB4, 0x48, 0xDD, 0x19, 0x63 } }, \
+  { 0x851A6355, 0xCE10, 0x4F67, { 0x9D, 0x13, 0x91, 0xB3, 0x28, 0x1A, 0x95, 0xD3 } }, \
+  { 0x864B10FE, 0x3D5E, 0x4908, { 0x88, 0xCC, 0xF0, 0x8D, 0x4E, 0xDC, 0x00, 0x50 } }, \
+  { 0x86E82AC3, 0xD6AF, 0x47A4, { 0x8C, 0x93, 0x0C, 0x76, 0xC7, 0xB3, 0xCC, 0xD3 } }, \
+  { 0x87E328F9, 0x93A5, 0x4375, { 0xBA, 0x69, 0x93, 0xA7, 0xA7, 0x7A, 0x5D, 0x9B } }, \
+  { 0x880D81BF, 0xDA88, 0x49E1, { 0x95, 0x43, 0xA5, 0x82, 0x47, 0xFE, 0xAD, 0x1A } }, \
+  { 0x886ACB20, 0x78C0, 0x4F88, { 0x9D, 0x3C, 0xBA, 0xDC, 0xE3, 0x7E, 0xDA, 0x47 } }, \
+  { 0x89173692, 0x9AC2, 0x4C86, { 0x9E, 0xCC, 0xF3, 0x77, 0x82, 0xDD, 0xEB, 0xAA } }, \
+  { 0x8E5C4BEA, 0x34FF, 0x4E32, { 0x83, 0x58, 0x33, 0x63, 0xDA, 0x01, 0xE6, 0x28 } }, \
+  { 0x8E973F83, 0xABCA, 0x49E4, { 0xA9, 0x40, 0x4E, 0xAD, 0x5A, 0x6D, 0x8A, 0x1E } }, \
+  { 0x8F26EF0A, 0x4F7F, 0x4E4B, { 0x98, 0x02, 0x8C, 0x22, 0xB7, 0x00, 0xFF, 0xAC } }, \
+  { 0x8FEEECF1, 0xBCFD, 0x4A78, { 0x92, 0x31, 0x48, 0x01, 0x56, 0x6B, 0x35, 0x67 } }, \
+  { 0x90E01103, 0xF784, 0x4020, { 0x91, 0xAC, 0xC5, 0x1E, 0x8B, 0xF5, 0x53, 0xB2 } }, \
+  { 0x918ABA30, 0x3D8D, 0x4BB5, { 0xB8, 0x49, 0x45, 0xCC, 0x4F, 0xC7, 0xDE, 0x7C } }, \
+  { 0x93B80003, 0x9FB3, 0x11D4, { 0x9A, 0x3A, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x93B80004, 0x9FB3, 0x11D4, { 0x9A, 0x3A, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0x94734718, 0x0BBC, 0x47FB, { 0x96, 0xA5, 0xEE, 0x7A, 0x5A, 0xE6, 0xA2, 0xAD } }, \
+  { 0x949822BC, 0x26D3, 0x4BC6, { 0x95, 0x4B, 0xF2, 0xC5, 0x81, 0x34, 0x2D, 0xE1 } }, \
+  { 0x95BF86AD, 0xA1E0, 0x4143, { 0xB4, 0x87, 0x00, 0x4B, 0x1C, 0x2E, 0x05, 0xFA } }, \
+  { 0x95C051C5, 0xF123, 0x432E, { 0x93, 0x83, 0xB9, 0xCF, 0x11, 0x3F, 0x08, 0x2E } }, \
+  { 0x95E3669D, 0x34BE, 0x4775, { 0xA6, 0x51, 0x7E, 0xA4, 0x1B, 0x69, 0xD8, 0x9E } }, \
+  { 0x961578FE, 0xB6B7, 0x44C3, { 0xAF, 0x35, 0x6B, 0xC7, 0x05, 0xCD, 0x2B, 0x1F } }, \
+  { 0x96B5C032, 0xDF4C, 0x4B6E, { 0x82, 0x32, 0x43, 0x8D, 0xCF, 0x44, 0x8D, 0x0E } }, \
+  { 0x970F9BDA, 0x88FC, 0x494C, { 0x9E, 0xA1, 0x26, 0x41, 0x96, 0x63, 0xCE, 0x11 } }, \
+  { 0x99F03B99, 0x98D8, 0x49DD, { 0xA8, 0xD3, 0x32, 0x19, 0xD0, 0xFF, 0xE4, 0x1E } }, \
+  { 0x9A9A912B, 0x5F53, 0x4586, { 0x88, 0x20, 0x70, 0x44, 0x85, 0xA2, 0x9D, 0x21 } }, \
+  { 0x9B680FCE, 0xAD6B, 0x4F3A, { 0xB6, 0x0B, 0xF5, 0x98, 0x99, 0x00, 0x34, 0x43 } }, \
+  { 0x9CC55D7D, 0xFBFF, 0x431C, { 0xBC, 0x14, 0x33, 0x4E, 0xAE, 0xA6, 0x05, 0x2B } }, \
+  { 0x9CFD802C, 0x09A1, 0x43D6, { 0x82, 0x17, 0xAA, 0x49, 0xC1, 0xF9, 0x0D, 0x2C } }, \
+  { 0x9D58058E, 0xC8DD, 0x4A9F, { 0xB1, 0x76, 0xDF, 0xCB, 0x92, 0x35, 0x48, 0x15 } }, \
+  { 0x9D5EB938, 0x9A44, 0x4568, { 0x81, 0x92, 0xC1, 0x56, 0x3B, 0xEB, 0xAA, 0x01 } }, \
+  { 0x9E863906, 0xA40F, 0x4875, { 0x97, 0x7F, 0x5B, 0x93, 0xFF, 0x23, 0x7F, 0xC6 } }, \
+  { 0x9EA5DF0F, 0xA35C, 0x48C1, { 0xBA, 0xC9, 0xF6, 0x34, 0x52, 0xB4, 0x7C, 0x3E } }, \
+  { 0x9FA2F805, 0x3D86, 0x42BC, { 0xA9, 0xC3, 0x2B, 0x26, 0xA5, 0xDF, 0x09, 0xF9 } }, \
+  { 0x9FB1A1F3, 0x3B71, 0x4324, { 0xB3, 0x9A, 0x74, 0x5C, 0xBB, 0x01, 0x5F, 0xFF } }, \
+  { 0x9FB4B4A7, 0x42C0, 0x4BCD, { 0x85, 0x40, 0x9B, 0xCC, 0x67, 0x11, 0xF8, 0x3E } }, \
+  { 0xA196BA47, 0x8ED3, 0x4188, { 0xA7, 0x65, 0xFA, 0x96, 0x4D, 0xD7, 0xED, 0x7A } }, \
+  { 0xA210F973, 0x229D, 0x4F4D, { 0xAA, 0x37, 0x98, 0x95, 0xE6, 0xC9, 0xEA, 0xBA } }, \
+  { 0xA2F436EA, 0xA127, 0x4EF8, { 0x95, 0x7C, 0x80, 0x48, 0x60, 0x6F, 0xF6, 0x70 } }, \
+  { 0xA4928C81, 0x0703, 0x4AD7, { 0xA3, 0x2B, 0x75, 0x25, 0xBC, 0x3F, 0xE1, 0xF5 } }, \
+  { 0xA4B9A806, 0xB574, 0x4354, { 0xBF, 0xC7, 0x05, 0x21, 0x7D, 0xC0, 0xFA, 0xF4 } }, \
+  { 0xA4F2909C, 0x5E2A, 0x438A, { 0x91, 0xBA, 0x27, 0x2B, 0x09, 0x23, 0x04, 0x9A } }, \
+  { 0xA4FD00D3, 0x821A, 0x4519, { 0x85, 0xBB, 0x2E, 0x19, 0x87, 0xA6, 0xF4, 0xE1 } }, \
+  { 0xA6688890, 0xBFF0, 0x4F03, { 0x9B, 0x1E, 0x76, 0xAE, 0x86, 0xEE, 0xC5, 0xAB } }, \
+  { 0xA6A1C030, 0xF956, 0x4A9E, { 0x95, 0x40, 0xD0, 0xE8, 0x1D, 0x2E, 0x33, 0xF2 } }, \
+  { 0xA7D8D9A6, 0x6AB0, 0x4AEB, { 0xAD, 0x9D, 0x16, 0x3E, 0x59, 0xA7, 0xA3, 0x80 } }, \
+  { 0xA89EC8E0, 0x0BA1, 0x40AA, { 0xA0, 0x3E, 0xAB, 0xDD, 0xA5, 0x29, 0x5C, 0xDE } }, \
+  { 0xA94A6AEF, 0xD69B, 0x4010, { 0xBA, 0x24, 0xF9, 0x1E, 0x1F, 0xE6, 0x2A, 0xDA } }, \
+  { 0xAA382865, 0x12B0, 0x44E5, { 0xA7, 0x31, 0x6D, 0xEF, 0x4D, 0xF3, 0x4C, 0xE7 } }, \
+  { 0xAADFA1AC, 0xE923, 0x4673, { 0xB1, 0xB8, 0x71, 0x4A, 0xD8, 0x49, 0xF7, 0x90 } }, \
+  { 0xAC3435BB, 0xB1D3, 0x4EF8, { 0x95, 0x7C, 0x80, 0x48, 0x60, 0x6F, 0xF6, 0x71 } }, \
+  { 0xAC5919D9, 0xF137, 0x4F87, { 0x86, 0x9F, 0xD8, 0x63, 0xED, 0xA8, 0x8E, 0xD2 } }, \
+  { 0xAC60ED9F, 0x523E, 0x4F5B, { 0x94, 0xCA, 0x39, 0x61, 0x34, 0x6A, 0x00, 0xBA } }, \
+  { 0xAC6FD56A, 0x3D41, 0x4EFD, { 0xA1, 0xB9, 0x87, 0x02, 0x93, 0x81, 0x1A, 0x28 } }, \
+  { 0xACA0F10C, 0x04C9, 0x4C4E, { 0x9D, 0x7B, 0xB7, 0xA0, 0x97, 0xF5, 0xE1, 0xEC } }, \
+  { 0xACAEAA7A, 0xC039, 0x4424, { 0x88, 0xDA, 0xF4, 0x22, 0x12, 0xEA, 0x0E, 0x55 } }, \
+  { 0xAD608272, 0xD07F, 0x4964, { 0x80, 0x1E, 0x7B, 0xD3, 0xB7, 0x88, 0x86, 0x52 } }, \
+  { 0xAD70855E, 0x0CC5, 0x4ABF, { 0x89, 0x79, 0xBE, 0x76, 0x2A, 0x94, 0x9E, 0xA3 } }, \
+  { 0xAF59F2F5, 0x5E28, 0x4E03, { 0x80, 0xE2, 0x47, 0x27, 0x54, 0x5A, 0xF8, 0x11 } }, \
+  { 0xB2A23305, 0x9455, 0x489C, { 0xAA, 0x81, 0x21, 0xDB, 0x48, 0xC4, 0x1E, 0xAB } }, \
+  { 0xB31FF060, 0x8363, 0x11DF, { 0x83, 0x95, 0x08, 0x00, 0x20, 0x0C, 0x9A, 0x66 } }, \
+  { 0xB601F8C4, 0x43B7, 0x4784, { 0x95, 0xB1, 0xF4, 0x22, 0x6C, 0xB4, 0x0C, 0xEE } }, \
+  { 0xB62EFBBB, 0x3923, 0x4CB9, { 0xA6, 0xE8, 0xDB, 0x81, 0x8E, 0x82, 0x8A, 0x80 } }, \
+  { 0xB63EBF4E, 0xD196, 0x40BA, { 0xAB, 0x63, 0x1F, 0xA9, 0xA6, 0x06, 0x8E, 0x84 } }, \
+  { 0xB65971BE, 0xBABF, 0x49ED, { 0x9D, 0xD2, 0x48, 0xEC, 0x8D, 0xB4, 0xAB, 0xD3 } }, \
+  { 0xB6B9295F, 0xCABF, 0x4CEC, { 0xBB, 0x14, 0xFE, 0x42, 0x46, 0xF2, 0x17, 0x3A } }, \
+  { 0xB74BB37A, 0xECA2, 0x4F79, { 0xA5, 0x44, 0x90, 0x56, 0x9A, 0xBE, 0x6B, 0x99 } }, \
+  { 0xB8A6E7C5, 0xB8FD, 0x425C, { 0xA6, 0x7E, 0x10, 0x09, 0xDF, 0x1F, 0x10, 0xB5 } }, \
+  { 0xB95E9FDA, 0x26DE, 0x48D2, { 0x88, 0x07, 0x1F, 0x91, 0x07, 0xAC, 0x5E, 0x3A } }, \
+  { 0xB9A3F174, 0x1B36, 0x4AEC, { 0x99, 0xE2, 0xF2, 0x85, 0x5E, 0xB4, 0xC3, 0xDE } }, \
+  { 0xB9CABA9B, 0xE5C5, 0x41DC, { 0x86, 0xE2, 0xE7, 0xCE, 0xF8, 0x7B, 0x81, 0xCB } }, \
+  { 0xB9F93638, 0x35F5, 0x447D, { 0xB9, 0x08, 0xA2, 0xB8, 0x52, 0xAA, 0x0B, 0x89 } }, \
+  { 0xBAE7599F, 0x3C6B, 0x43B7, { 0xBD, 0xF0, 0x9C, 0xE0, 0x7A, 0xA9, 0x1A, 0xA6 } }, \
+  { 0xBAF029A0, 0xB2F3, 0x45EE, { 0x8B, 0x52, 0xD4, 0x02, 0x17, 0x7B, 0xE6, 0xB8 } }, \
+  { 0xBCB59C90, 0xDC86, 0x11DD, { 0xAD, 0x8B, 0x08, 0x00, 0x20, 0x0C, 0x9A, 0x66 } }, \
+  { 0xBD6736AC, 0xB126, 0x4FEA, { 0x9D, 0x1D, 0x17, 0x4D, 0x4A, 0x89, 0x9F, 0x22 } }, \
+  { 0xBDFE430E, 0x8F2A, 0x4DB0, { 0x99, 0x91, 0x6F, 0x85, 0x65, 0x94, 0x77, 0x7E } }, \
+  { 0xBF73D2BF, 0xAC8C, 0x4D83, { 0xA3, 0xB9, 0x4A, 0x0F, 0x42, 0x00, 0x74, 0xB3 } }, \
+  { 0xBF89F10D, 0xB205, 0x474F, { 0x96, 0xE3, 0x7A, 0x7B, 0xB1, 0xB4, 0xA4, 0x07 } }, \
+  { 0xBFEE74C2, 0x60BD, 0x467B, { 0x92, 0x61, 0xB7, 0x2A, 0x88, 0x1E, 0x49, 0xEE } }, \
+  { 0xC07CCCFC, 0xB4BF, 0x4A30, { 0xA2, 0x5F, 0x1F, 0x57, 0xC0, 0x52, 0x26, 0x29 } }, \
+  { 0xC0CFEB8B, 0x6EE1, 0x443B, { 0xBC, 0xC9, 0x85, 0x4E, 0x7C, 0x9B, 0x41, 0x6D } }, \
+  { 0xC194C6EA, 0xB68C, 0x4981, { 0xB6, 0x4B, 0x9B, 0xD2, 0x71, 0x47, 0x4B, 0x20 } }, \
+  { 0xC3EE3EF0, 0x63E6, 0x4F59, { 0xA4, 0x37, 0xAF, 0xA6, 0x3C, 0x46, 0xC8, 0x35 } }, \
+  { 0xC69BF28B, 0x16C3, 0x434F, { 0xA4, 0xA4, 0x29, 0x2B, 0xDB, 0x0F, 0x4D, 0x12 } }, \
+  { 0xC7EA9787, 0xCA0A, 0x43B4, { 0xB1, 0xE5, 0x25, 0xEF, 0x87, 0x39, 0x1F, 0x8D } }, \
+  { 0xC80EA8F3, 0xA3C9, 0x4225, { 0xAA, 0x60, 0x76, 0x9D, 0xD4, 0xC7, 0x4E, 0x43 } }, \
+  { 0xC82919D6, 0x33FD, 0x43ED, { 0x80, 0x0C, 0x63, 0x5A, 0x33, 0x69, 0xD0, 0xF3 } }, \
+  { 0xC89851DD, 0x5EA0, 0x42CE, { 0x89, 0x34, 0xEB, 0x8E, 0xA6, 0x08, 0xFB, 0xA9 } }, \
+  { 0xC8AB0F4E, 0x26FE, 0x40F1, { 0x95, 0x79, 0xEA, 0x8D, 0x30, 0xD5, 0x03, 0xA4 } }, \
+  { 0xC97809C0, 0x5F90, 0x4466, { 0x8B, 0x38, 0x34, 0x1D, 0x7A, 0x67, 0xCF, 0x54 } }, \
+  { 0xCA261A26, 0x7718, 0x4B9B, { 0x8A, 0x07, 0x51, 0x78, 0xB1, 0xAE, 0x3A, 0x02 } }, \
+  { 0xCA515306, 0x00CE, 0x4032, { 0x87, 0x4E, 0x11, 0xB7, 0x55, 0xFF, 0x68, 0x66 } }, \
+  { 0xCA7ACEF3, 0x1181, 0x4AE0, { 0x95, 0xA7, 0x0F, 0x1F, 0xD8, 0xAF, 0xD2, 0xED } }, \
+  { 0xCA9725C0, 0x12E5, 0x4FAC, { 0xAD, 0x58, 0xD9, 0xAA, 0xB0, 0x3B, 0x8F, 0x11 } }, \
+  { 0xCB73C3D9, 0x2F01, 0x4342, { 0xAE, 0x67, 0x04, 0xDD, 0xE5, 0x26, 0x40, 0x92 } }, \
+  { 0xCBCA3D88, 0xCB1E, 0x49C3, { 0xB4, 0x48, 0x5F, 0xF2, 0x87, 0xC5, 0x8D, 0x40 } }, \
+  { 0xCC71B046, 0xCF07, 0x4DAE, { 0xAE, 0xAD, 0x70, 0x46, 0x84, 0x5B, 0xCD, 0x8A } }, \
+  { 0xCC84D725, 0xDA1E, 0x46A7, { 0x9E, 0x75, 0x4B, 0xAC, 0xF1, 0xFD, 0x39, 0x02 } }, \
+  { 0xCCABD229, 0x51C4, 0x4DE7, { 0xAE, 0x2F, 0x3A, 0xAF, 0x71, 0xF9, 0xEC, 0xE5 } }, \
+  { 0xCCCB0C28, 0x4B24, 0x11D5, { 0x9A, 0x5A, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } }, \
+  { 0xCD92B9B9, 0x2D4C, 0x466B, { 0x84, 0x58, 0x95, 0x44, 0x7D, 0x8E, 0x4A, 0xFE } }, \
+  { 0xCDC0191E, 0x1891, 0x4119, { 0x81, 0x7E, 0x0B, 0x6A, 0x36, 0x85, 0xA5, 0x11 } }, \
+  { 0xCF9668F7, 0xB0F0, 0x4D7F, { 0xB4, 0x1E, 0xAE, 0xC7, 0x94, 0xEE, 0xC7, 0xFC } }, \
+  { 0xCFEF94C4, 0x4167, 0x466A, { 0x88, 0x93, 0x87, 0x79, 0x45, 0x9D, 0xFA, 0x86 } }, \
+  { 0xD5196882, 0xA970, 0x4510, { 0x8F, 0xB9, 0xD7, 0x58, 0x3B, 0x69, 0x06, 0xE7 } }, \
+  { 0xD687E479, 0xDB37, 0x4BCE, { 0x86, 0x4A, 0x02, 0xEE, 0xF6, 0x81, 0x9D, 0xF1 } }, \
+  { 0xD689F8C7, 0xC354, 0x4215, { 0xAA, 0x48, 0xB6, 0xAD, 0x66, 0xC7, 0x7E, 0xAF } }, \
+  { 0xD83977DF, 0x34C3, 0x4A21, { 0xA1, 0x04, 0x36, 0x9B, 0x8D, 0x4F, 0xA7, 0xB7 } }, \
+  { 0xD912C7BC, 0xF098, 0x4367, { 0x92, 0xBA, 0xE9, 0x11, 0x08, 0x3C, 0x7B, 0x0E } }, \
+  { 0xDA5D9983, 0x033C, 0x4823, { 0x93, 0x49, 0x8B, 0x1B, 0x6A, 0x79, 0x80, 0x30 } }, \
+  { 0xDB4DB11A, 0x0E5C, 0x40B5, { 0x8E, 0x46, 0x17, 0xD0, 0x44, 0x86, 0xA2, 0x1B } }, \
+  { 0xDC3641B8, 0x2FA8, 0x4ED3, { 0xBC, 0x1F, 0xF9, 0x96, 0x2A, 0x03, 0x45, 0x4B } }, \
+  { 0xDDB412A6, 0xE3F3, 0x4E9E, { 0x90, 0xA3, 0x2A, 0x99, 0x12, 0x70, 0x21, 0x9C } }, \
+  { 0xE0ADB57E, 0xE1B6, 0x44EC, { 0xBF, 0x2E, 0x84, 0x28, 0x74, 0xA2, 0x6C, 0x83 } }, \
+  { 0xE1AD4352, 0x2610, 0x4DD6, { 0xBB, 0x8F, 0x8B, 0xB2, 0xB0, 0x33, 0x83, 0xA3 } }, \
+  { 0xE4F272DA, 0x237F, 0x454C, { 0x88, 0x68, 0xFC, 0xF0, 0x96, 0xCF, 0x1C, 0x6C } }, \
+  { 0xE5D0BBDC, 0x1BBC, 0x49B7, { 0xA8, 0xB6, 0x67, 0xAA, 0xF0, 0xA1, 0xCD, 0x9E } }, \
+  { 0xE84AEF95, 0x7CA6, 0x4B2F, { 0xA3, 0x98, 0xB1, 0x4D, 0x1C, 0x67, 0xA0, 0xB1 } }, \
+  { 0xE8DC00BA, 0x411F, 0x4D52, { 0xB9, 0x25, 0x50, 0x78, 0x54, 0x36, 0xAC, 0x81 } }, \
+  { 0xE94DB579, 0x061B, 0x437B, { 0x83, 0xC2, 0x65, 0xC0, 0xAE, 0x7C, 0x14, 0xE2 } }, \
+  { 0xE9B4B126, 0x4E13, 0x41F5, { 0x9E, 0x4C, 0x9B, 0xF8, 0x8B, 0x3C, 0x1B, 0x0C } }, \
+  { 0xEA2EC402, 0x2FD5, 0x475F, { 0x92, 0x2C, 0x98, 0xEA, 0xE0, 0x37, 0x63, 0x12 } }, \
+  { 0xEA9E92E1, 0x22EF, 0x4B5F, { 0xA5, 0xEE, 0x13, 0x17, 0xB1, 0xE7, 0x7B, 0x10 } }, \
+  { 0xEAAF7109, 0xEC2D, 0x4A30, { 0xBF, 0x4F, 0x62, 0x14, 0x08, 0x63, 0x0E, 0x4C } }, \
+  { 0xEAF59C0E, 0xBD46, 0x413A, { 0x9A, 0xE9, 0xDD, 0x9F, 0x6D, 0x1A, 0x92, 0x7D } }, \
+  { 0xEB6EEBF4, 0x1EC3, 0x4D69, { 0x9D, 0x82, 0x65, 0xBF, 0x6C, 0x57, 0x9B, 0x34 } }, \
+  { 0xEC5A555B, 0x6384, 0x4C00, { 0x86, 0x25, 0x2C, 0x17, 0x68, 0xB9, 0x5B, 0x38 } }, \
+  { 0xEE30FD26, 0x1524, 0x4CA2, { 0xB5, 0x6D, 0x34, 0x58, 0x30, 0xDC, 0x9C, 0xDB } }, \
+  { 0xEF33C296, 0xF64C, 0x4146, { 0xAD, 0x04, 0x34, 0x78, 0x99, 0x70, 0x2C, 0x84 } }, \
+  { 0xF099D67F, 0x71AE, 0x4C36, { 0xB2, 0xA3, 0xDC, 0xEB, 0x0E, 0xB2, 0xB7, 0xD8 } }, \
+  { 0xF1BDCEC7, 0x31D1, 0x4F0F, { 0xAF, 0x62, 0xD0, 0x2A, 0x44, 0x07, 0x60, 0x26 } }, \
+  { 0xF1EFB523, 0x3D59, 0x4888, { 0xBB, 0x71, 0xEA, 0xA5, 0xA9, 0x66, 0x28, 0xFA } }, \
+  { 0xF46D8EA6, 0x4A67, 0x4872, { 0xB0, 0xD1, 0xD4, 0xFD, 0xEA, 0x0B, 0x69, 0x2F } }, \
+  { 0xF46EE6F4, 0x4785, 0x43A3, { 0x92, 0x3D, 0x7F, 0x78, 0x6C, 0x3C, 0x84, 0x79 } }, \
+  { 0xF5AC7057, 0x5650, 0x466E, { 0xB6, 0x92, 0x76, 0xA4, 0x72, 0x23, 0xEF, 0xB0 } }, \
+  { 0xF642A9D7, 0x26B7, 0x47CB, { 0xAC, 0xC8, 0x13, 0x59, 0x51, 0xAC, 0x93, 0xF8 } }, \
+  { 0xF746D37F, 0xF6C6, 0x43C0, { 0x94, 0xDB, 0x46, 0x6F, 0x5F, 0x10, 0xE0, 0x30 } }, \
+  { 0xF7731B4C, 0x58A2, 0x4DF4, { 0x89, 0x80, 0x56, 0x45, 0xD3, 0x9E, 0xCE, 0x58 } }, \
+  { 0xF8CA70B4, 0x6A85, 0x4616, { 0x8B, 0xDE, 0x3E, 0xC5, 0x69, 0x64, 0x4A, 0xC3 } }, \
+  { 0xF94700A3, 0xF49F, 0x4CD2, { 0xBF, 0x25, 0x19, 0xE2, 0x80, 0xB7, 0x2E, 0x3B } }, \
+  { 0xF94A048B, 0x7FC4, 0x4ABC, { 0x85, 0xA6, 0x86, 0x16, 0xA6, 0xD3, 0xCD, 0xCE } }, \
+  { 0xFA4F6740, 0xB95A, 0x43F9, { 0x90, 0xB5, 0x78, 0xD8, 0x14, 0x7C, 0x02, 0x19 } }, \
+  { 0xFBB3F083, 0x5787, 0x45AF, { 0xBA, 0xDC, 0x66, 0x48, 0x54, 0x10, 0x0F, 0x20 } }, \
+  { 0xFCE47C4E, 0x5ECC, 0x4A41, { 0xB9, 0x0E, 0x0B, 0xAB, 0x09, 0x96, 0x8D, 0x02 } }, \
+  { 0xFF917E22, 0xA228, 0x448D, { 0xBD, 0xAA, 0x68, 0xEF, 0xCC, 0xDD, 0xA5, 0xD3 } }, \
+  { 0xC2223A0B, 0x80D3, 0x4C35, { 0x89, 0x1F, 0xBD, 0x0C, 0xC4, 0xE9, 0x90, 0xF0 } }, \
+  { 0xEA42B5E6, 0x5E01, 0x4C6E, { 0x81, 0x89, 0xC1, 0xEF, 0xA6, 0xAC, 0xFD, 0x01 } }
+
+#define GUID_DB_NAME_OFFSETS \
+  0x00000000, 0x00000016, 0x00000035, 0x00000054, 0x0000006B, 0x00000084, 0x000000A0, 0x000000BC, \
+  0x000000D6, 0x000000E5, 0x00000100, 0x00000120, 0x00000142, 0x0000015C, 0x00000173, 0x00000191, \
+  0x000001AE, 0x000001C6, 0x000001E1, 0x00000207, 0x0000021B, 0x00000241, 0x00000259, 0x00000281, \
+  0x00000290, 0x0000029D, 0x000002AF, 0x000002D3, 0x000002ED, 0x0000030F, 0x0000032A, 0x0000034B, \
+  0x0000036D, 0x0000039F, 0x000003B4, 0x000003DB, 0x000003F7, 0x00000414, 0x0000042F, 0x00000458, \
+  0x00000480, 0x00000499, 0x000004B5, 0x000004D4, 0x000004EC, 0x00000507, 0x00000529, 0x00000548, \
+  0x00000563, 0x00000579, 0x00000590, 0x000005A7, 0x000005BF, 0x000005E4, 0x00000601, 0x00000625, \
+  0x0000063A, 0x0000065D, 0x00000677, 0x0000068C, 0x000006A7, 0x000006C4, 0x000006E0, 0x000006F9, \
+  0x00000714, 0x00000730, 0x00000744, 0x00000765, 0x00000785, 0x0000079E, 0x000007B9, 0x000007D9, \
+  0x000007F4, 0x0000080D, 0x00000827, 0x0000083F, 0x0000085C, 0x0000086D, 0x00000887, 0x000008A3, \
+  0x000008C1, 0x000008E0, 0x000008FF, 0x00000922, 0x00000940, 0x00000967, 0x0000098A, 0x000009AA, \
+  0x000009C7, 0x000009E0, 0x000009FB, 0x00000A1D, 0x00000A42, 0x00000A58, 0x00000A7C, 0x00000AA3, \
+  0x00000ABE, 0x00000ADB, 0x00000AF9, 0x00000B1B, 0x00000B3D, 0x00000B6B, 0x00000B8E, 0x00000BB1, \
+  0x00000BDF, 0x00000C0B, 0x00000C2F, 0x00000C43, 0x00000C63, 0x00000C82, 0x00000CAF, 0x00000CE2, \
+  0x00000D07, 0x00000D1C, 0x00000D42, 0x00000D64, 0x00000D83, 0x00000D9D, 0x00000DBC, 0x00000DD5, \
+  0x00000DE2, 0x00000E00, 0x00000E26, 0x00000E51, 0x00000E7B, 0x00000EA6, 0x00000EC1, 0x00000EE2, \
+  0x00000F0B, 0x00000F22, 0x00000F3F, 0x00000F52, 0x00000F6E, 0x00000F85, 0x00000FA0, 0x00000FC3, \
+  0x00000FE3, 0x00000FFF, 0x0000101A, 0x0000103B, 0x00001053, 0x00001072, 0x00001084, 0x000010A4, \
+  0x000010C2, 0x000010DA, 0x000010F4, 0x00001112, 0x0000112F, 0x00001150, 0x00001179, 0x00001193, \
+  0x000011B2, 0x000011D7, 0x00001203, 0x0000121D, 0x00001232, 0x00001250, 0x0000126E, 0x0000128F, \
+  0x000012A8, 0x000012CC, 0x000012E3, 0x000012FC, 0x00001323, 0x00001349, 0x0000136A, 0x00001387, \
+  0x000013A8, 0x000013C4, 0x000013E1, 0x000013FC, 0x0000141C, 0x00001435, 0x0000144F, 0x00001466, \
+  0x00001484, 0x0000148E, 0x0000149E, 0x000014BC, 0x000014E1, 0x00001506, 0x00001520, 0x0000154A, \
+  0x00001564, 0x00001582, 0x0000159C, 0x000015BA, 0x000015D6, 0x000015F6, 0x00001608, 0x00001626, \
+  0x0000163E, 0x00001655, 0x00001682, 0x000016AC, 0x000016C5, 0x000016ED, 0x00001715, 0x0000173D, \
+  0x00001765, 0x0000178D, 0x000017B6, 0x000017DD, 0x00001805, 0x0000182D, 0x0000184A, 0x00001878, \
+  0x00001894, 0x000018B0, 0x000018D0, 0x000018E9, 0x00001904, 0x00001927, 0x00001950, 0x00001966, \
+  0x0000198D, 0x000019B8, 0x000019DD, 0x00001A06, 0x00001A25, 0x00001A47, 0x00001A65, 0x00001A87, \
+  0x00001AB3, 0x00001AD0, 0x00001AEB, 0x00001B0D, 0x00001B2B, 0x00001B51, 0x00001B6D, 0x00001B8C, \
+  0x00001BB4, 0x00001BD9, 0x00001C01, 0x00001C1F, 0x00001C4A, 0x00001C6E, 0x00001C94, 0x00001CB6, \
+  0x00001CD6, 0x00001CE9, 0x00001D00, 0x00001D1D, 0x00001D49, 0x00001D64, 0x00001D8D, 0x00001DC0, \
+  0x00001DF4, 0x00001E25, 0x00001E3E, 0x00001E53, 0x00001E63, 0x00001E74, 0x00001E88, 0x00001EA2, \
+  0x00001EBB, 0x00001ED9, 0x00001EF8, 0x00001F18, 0x00001F2C, 0x00001F42, 0x00001F58, 0x00001F6B, \
+  0x00001F85, 0x00001FA8, 0x00001FCC, 0x00001FF6, 0x00002010, 0x00002023, 0x0000204A, 0x00002078, \
+  0x00002096, 0x000020B3, 0x000020D2, 0x000020F1, 0x00002110, 0x0000212F, 0x0000214C, 0x00002169, \
+  0x0000218A, 0x000021B0, 0x000021D2, 0x000021EF, 0x00002213, 0x00002236, 0x0000225B, 0x00002276, \
+  0x0000229D, 0x000022CC, 0x000022EE, 0x00002313, 0x00002338, 0x0000235D, 0x00002383, 0x000023A9, \
+  0x000023CE, 0x000023F4, 0x0000241A, 0x00002443, 0x0000246D, 0x00002494, 0x000024B0, 0x000024D0, \
+  0x000024EF, 0x0000250E, 0x00002534, 0x0000255E, 0x00002582, 0x000025A6, 0x000025CD, 0x000025F5, \
+  0x0000261F, 0x0000264A, 0x00002673, 0x0000269E, 0x000026C4, 0x000026EB, 0x00002716, 0x00002737, \
+  0x0000274C, 0x00002762, 0x0000277F, 0x00002792, 0x000027AD, 0x000027C0, 0x000027DF, 0x000027FE, \
+  0x0000281D, 0x0000283C, 0x0000285C, 0x0000287C, 0x0000289C, 0x000028B7, 0x000028D3, 0x000028EE, \
+  0x0000290A, 0x00002925, 0x00002943, 0x0000295F, 0x0000297D, 0x0000299B, 0x000029B9, 0x000029D7, \
+  0x000029F5, 0x00002A13, 0x00002A33, 0x00002A53, 0x00002A75, 0x00002A97, 0x00002AAC, 0x00002AC1, \
+  0x00002AD6, 0x00002AEA, 0x00002B0E, 0x00002B34, 0x00002B49, 0x00002B63, 0x00002B7D, 0x00002B97, \
+  0x00002BBE, 0x00002BE5, 0x00002C0B, 0x00002C2C, 0x00002C4C, 0x00002C62, 0x00002C84, 0x00002CA7, \
+  0x00002CCD, 0x00002CE5, 0x00002CFF, 0x00002D1E, 0x00002D46, 0x00002D70, 0x00002D93, 0x00002DB3, \
+  0x00002DDB, 0x00002E01, 0x00002E34, 0x00002E58, 0x00002E74, 0x00002E8A, 0x00002EAD, 0x00002EC9, \
+  0x00002EE0, 0x00002F05, 0x00002F2A, 0x00002F53, 0x00002F69, 0x00002F7D, 0x00002F9E, 0x00002FBD, \
+  0x00002FDE, 0x00003003, 0x00003028, 0x0000304C, 0x00003065, 0x00003072, 0x00003091, 0x000030B3, \
+  0x000030D4, 0x000030F4, 0x00003118, 0x00003133, 0x00003145, 0x00003161, 0x00003182, 0x0000319E, \
+  0x000031BF, 0x000031E1, 0x00003202, 0x00003224, 0x0000324A, 0x0000326D, 0x0000328C, 0x000032AC, \
+  0x000032CE, 0x000032EC, 0x00003310, 0x00003332, 0x0000334D, 0x0000336E, 0x00003390, 0x000033B4, \
+  0x000033CC, 0x000033F5, 0x0000341C, 0x00003443, 0x00003469, 0x0000347B, 0x00003496, 0x000034B1, \
+  0x000034CC, 0x000034ED, 0x00003516, 0x0000353D, 0x0000355A, 0x00003579, 0x00003599, 0x000035BB, \
+  0x000035D8, 0x000035FE, 0x0000361E, 0x00003644, 0x0000366A, 0x00003685, 0x000036A8, 0x000036D0, \
+  0x000036EF, 0x0000370C, 0x00003742, 0x00003761, 0x00003780, 0x000037AB, 0x000037DD, 0x00003801, \
+  0x00003828, 0x0000384E, 0x0000386A, 0x00003883, 0x000038A3, 0x000038C7, 0x000038E5, 0x00003907, \
+  0x00003922, 0x00003938, 0x00003956, 0x00003972, 0x00003990, 0x000039AF, 0x000039D3, 0x000039F7, \
+  0x00003A1F, 0x00003A43, 0x00003A65, 0x00003A7F, 0x00003AA8, 0x00003ACB, 0x00003AEE, 0x00003B1D, \
+  0x00003B41, 0x00003B65, 0x00003B94, 0x00003BC1, 0x00003BE9, 0x00003BFF, 0x00003C19, 0x00003C3A, \
+  0x00003C5D, 0x00003C89, 0x00003CB9, 0x00003CE7, 0x00003D13, 0x00003D44, 0x00003D70, 0x00003D9E, \
+  0x00003DD2, 0x00003E03, 0x00003E2E, 0x00003E5A, 0x00003E87, 0x00003EB3, 0x00003EDF, 0x00003F0D, \
+  0x00003F3D, 0x00003F5E, 0x00003F7F, 0x00003F98, 0x00003FC1, 0x00003FDF, 0x00003FFE, 0x0000401B, \
+  0x00004034, 0x00004054, 0x0000406F, 0x000040A2, 0x000040CA, 0x000040ED, 0x00004119, 0x00004140, \
+  0x00004164, 0x0000417D, 0x0000419D, 0x000041C5, 0x000041E2, 0x00004206, 0x00004226, 0x00004243, \
+  0x0000425F, 0x0000427D, 0x000042A5, 0x000042CB, 0x000042F3, 0x00004314, 0x0000433F, 0x00004368, \
+  0x00004397, 0x000043BD, 0x000043E2, 0x00004404, 0x00004425, 0x0000444D, 0x00004474, 0x000044A7, \
+  0x000044D6, 0x000044F7, 0x0000451E, 0x00004540, 0x00004561, 0x00004584, 0x000045A0, 0x000045C2, \
+  0x000045E4, 0x00004602, 0x00004622, 0x0000463B, 0x00004656, 0x00004675, 0x000046A0, 0x000046BC, \
+  0x000046D9, 0x000046F3, 0x0000470D, 0x00004728, 0x0000474C, 0x00004771, 0x00004796, 0x000047AF, \
+  0x000047C9, 0x000047EE, 0x0000480F, 0x00004837, 0x00004851, 0x0000486A, 0x00004883, 0x000048A0, \
+  0x000048B6, 0x000048D7, 0x00004909, 0x00004938, 0x00004961, 0x00004981, 0x00004997, 0x000049C9, \
+  0x000049EB, 0x00004A11, 0x00004A27, 0x00004A4F, 0x00004A67, 0x00004A8E, 0x00004AA5, 0x00004ACB, \
+  0x00004AE1, 0x00004AFE, 0x00004B25, 0x00004B3C, 0x00004B65, 0x00004B7E, 0x00004BA4, 0x00004BCB, \
+  0x00004BE2, 0x00004BF8, 0x00004C11, 0x00004C32, 0x00004C52, 0x00004C6F, 0x00004C8B, 0x00004CB0, \
+  0x00004CCF, 0x00004CEA, 0x00004D0E, 0x00004D31, 0x00004D57, 0x00004D6D, 0x00004D8A, 0x00004DB3, \
+  0x00004DCC, 0x00004DF4, 0x00004E0C, 0x00004E33, 0x00004E4A, 0x00004E71, 0x00004E88, 0x00004EA6, \
+  0x00004EBC, 0x00004EDD, 0x00004F04, 0x00004F1B, 0x00004F3B, 0x00004F5B, 0x00004F81, 0x00004FA3, \
+  0x00004FC2, 0x00004FE2, 0x00005008, 0x00005021, 0x0000503B, 0x00005051, 0x0000506D, 0x00005098, \
+  0x000050BB, 0x000050D6, 0x000050F2, 0x00005108, 0x0000512E, 0x00005156, 0x0000517E, 0x00005196, \
+  0x000051B8, 0x000051DC, 0x000051FE, 0x00005220, 0x0000523F, 0x0000526E, 0x0000528D, 0x000052B0, \
+  0x000052D5, 0x000052FB, 0x00005324, 0x0000533C, 0x0000535E, 0x00005382, 0x000053A1, 0x000053BF, \
+  0x000053E6, 0x000053FD, 0x00005424, 0x0000543B, 0x00005462, 0x00005479, 0x0000549A, 0x000054C0, \
+  0x000054D6, 0x000054FA, 0x00005511, 0x0000553E, 0x0000555B, 0x00005574, 0x0000558F, 0x000055B3, \
+  0x000055D2, 0x000055F5, 0x00005613, 0x00005639, 0x0000566F, 0x00005695, 0x000056B9, 0x000056DE, \
+  0x00005703, 0x00005724, 0x00005740, 0x0000575F, 0x00005777, 0x0000579A, 0x000057C2, 0x000057DA, \
+  0x000057ED, 0x00005803, 0x00005818, 0x00005834, 0x00005851, 0x00005869, 0x0000587D, 0x00005891, \
+  0x000058AD, 0x000058C9, 0x000058E8, 0x00005906, 0x00005924, 0x0000593B, 0x0000595A, 0x00005976, \
+  0x00005988, 0x000059A2, 0x000059BD, 0x000059D6, 0x000059FE, 0x00005A1A, 0x00005A33, 0x00005A49, \
+  0x00005A5E, 0x00005A7A, 0x00005A96, 0x00005ABF, 0x00005AD6, 0x00005AEF, 0x00005B11, 0x00005B31, \
+  0x00005B4B, 0x00005B68, 0x00005B88, 0x00005BAA, 0x00005BCF, 0x00005BE5, 0x00005BFF, 0x00005C20, \
+  0x00005C3E, 0x00005C62, 0x00005C7E, 0x00005C96, 0x00005CA7, 0x00005CC0, 0x00005CDA, 0x00005CED, \
+  0x00005D0C, 0x00005D21, 0x00005D3C, 0x00005D5C, 0x00005D79, 0x00005D96, 0x00005DB1, 0x00005DCB, \
+  0x00005DE4, 0x00005DFE, 0x00005E1F, 0x00005E42, 0x00005E6A, 0x00005E87, 0x00005EA5, 0x00005EC5, \
+  0x00005ED9, 0x00005EE8, 0x00005EF9, 0x00005F11, 0x00005F27, 0x00005F3E, 0x00005F56, 0x00005F6C, \
+  0x00005F82, 0x00005F98, 0x00005FB0, 0x00005FC8, 0x00005FDC, 0x00005FF0, 0x00006005, 0x00006021, \
+  0x0000603A, 0x0000606B, 0x00006095, 0x000060C2, 0x000060D7, 0x000060F0, 0x00006119, 0x00006129, \
+  0x0000614A, 0x0000616C, 0x0000618E, 0x000061B0, 0x000061D2, 0x000061E9, 0x00006210, 0x00006228, \
+  0x00006249, 0x0000626F, 0x0000628A, 0x000062AF, 0x000062CD, 0x000062F3, 0x0000630F, 0x0000632C, \
+  0x00006348, 0x0000635F, 0x00006380, 0x0000639F, 0x000063B5, 0x000063D3, 0x000063EC, 0x0000640D, \
+  0x0000642D, 0x00006443, 0x0000645F, 0x00006476, 0x00006492, 0x000064B6, 0x000064CE, 0x000064E5, \
+  0x00006506, 0x0000651D, 0x00006534, 0x00006550, 0x00006567, 0x0000657D, 0x00006595, 0x000065AB, \
+  0x000065C6, 0x000065D7, 0x000065EF, 0x00006601, 0x0000660F, 0x00006622, 0x00006639, 0x00006655, \
+  0x0000667E, 0x000066A9, 0x000066BF, 0x000066D0, 0x000066EB, 0x0000670A, 0x0000672A, 0x0000674F, \
+  0x0000675F, 0x00006783, 0x000067A3, 0x000067BC, 0x000067DF, 0x00006805, 0x00006821, 0x00006849, \
+  0x0000686D, 0x0000688E, 0x000068B7, 0x000068D5, 0x000068F3, 0x0000690E, 0x00006928, 0x00006944, \
+  0x0000695F, 0x0000697A, 0x00006994, 0x000069B5, 0x000069D6, 0x000069EE, 0x00006A01, 0x00006A20, \
+  0x00006A37, 0x00006A54, 0x00006A69, 0x00006A80, 0x00006A9C, 0x00006AB3, 0x00006AD7, 0x00006AE8, \
+  0x00006B09, 0x00006B2D, 0x00006B4B, 0x00006B6A, 0x00006B88, 0x00006BA2, 0x00006BC0, 0x00006BDD, \
+  0x00006BF6, 0x00006C18, 0x00006C39, 0x00006C51, 0x00006C71, 0x00006C8A, 0x00006CA3, 0x00006CC3, \
+  0x00006CE5, 0x00006D02, 0x00006D1E, 0x00006D30, 0x00006D45, 0x00006D5F, 0x00006D76, 0x00006D91, \
+  0x00006DAA, 0x00006DC7, 0x00006DE3, 0x00006DFF, 0x00006E1E, 0x00006E3D, 0x00006E54, 0x00006E75, \
+  0x00006E99, 0x00006EB4, 0x00006ED1, 0x00006EED, 0x00006F0A, 0x00006F1C, 0x00006F42, 0x00006F5E, \
+  0x00006F7D, 0x00006F9C, 0x00006FB3, 0x00006FC5, 0x00006FE1, 0x00006FFB, 0x00007016, 0x0000702C, \
+  0x00007041, 0x00007058, 0x00007077, 0x0000708F, 0x000070AD, 0x000070C9, 0x000070EB, 0x0000710A, \
+  0x00007126, 0x0000713E, 0x0000715B, 0x00007173, 0x0000718C, 0x000071AE, 0x000071CE, 0x000071E1, \
+  0x00007209, 0x00007224, 0x00007248, 0x0000726B, 0x0000728B, 0x000072A8, 0x000072C0, 0x000072DF, \
+  0x000072F9, 0x00007315, 0x00007334, 0x00007355, 0x00007368, 0x00007384, 0x0000739A, 0x000073B2, \
+  0x000073D0, 0x000073F8, 0x0000741A, 0x0000743D, 0x00007455, 0x00007468, 0x0000747A, 0x0000748E, \
+  0x000074A4, 0x000074BA, 0x000074E3, 0x0000750D, 0x00007525, 0x00007546, 0x00007565, 0x00007572, \
+  0x0000758D, 0x000075A8, 0x000075C3, 0x000075E7, 0x00007602, 0x0000761C, 0x00007637, 0x00007651, \
+  0x0000766C, 0x00007690, 0x000076AA, 0x000076C4, 0x000076DE, 0x000076F3, 0x00007705, 0x00007721, \
+  0x0000773C, 0x00007761, 0x0000777E, 0x0000779A, 0x000077B6, 0x000077D3, 0x000077F0, 0x00007808, \
+  0x0000782C, 0x0000784E, 0x00007876, 0x00007892, 0x000078B3, 0x000078D3, 0x000078E8, 0x000078FD, \
+  0x00007913, 0x00007929, 0x0000794A, 0x00007975, 0x0000798B, 0x000079A1, 0x000079C9, 0x000079E8, \
+  0x00007A00, 0x00007A19, 0x00007A3C, 0x00007A5E, 0x00007A7D, 0x00007AAA, 0x00007AD7, 0x00007B06, \
+  0x00007B3B, 0x00007B55, 0x00007B85, 0x00007BB0, 0x00007BCF, 0x00007BEA, 0x00007C0A, 0x00007C21, \
+  0x00007C2A, 0x00007C44, 0x00007C62, 0x00007C7C, 0x00007C97, 0x00007CAC, 0x00007CD5, 0x00007CF3, \
+  0x00007D07, 0x00007D1C, 0x00007D3E, 0x00007D62, 0x00007D82, 0x00007DA1, 0x00007DBA, 0x00007DDA, \
+  0x00007DF3, 0x00007E14, 0x00007E30, 0x00007E49, 0x00007E60, 0x00007E7E, 0x00007EA6, 0x00007EBB, \
+  0x00007EDC, 0x00007EFD, 0x00007F22, 0x00007F3A, 0x00007F56, 0x00007F72, 0x00007F88, 0x00007FA4, \
+  0x00007FC5, 0x00007FE3, 0x00008003, 0x00008026, 0x0000804C, 0x00008067, 0x0000808A, 0x000080AE, \
+  0x000080D5, 0x000080FA, 0x00008116, 0x00008130, 0x0000815D, 0x0000817B, 0x0000818F, 0x000081B2, \
+  0x000081D1, 0x000081EE, 0x00008209, 0x00008225, 0x0000824F, 0x00008268, 0x0000828F, 0x000082AF, \
+  0x000082CD, 0x000082F1, 0x00008314, 0x00008330, 0x0000834A, 0x00008361, 0x0000837D, 0x000083A0, \
+  0x000083C6, 0x000083EB, 0x0000841C, 0x00008449, 0x00008465, 0x0000847E, 0x00008493, 0x000084B2, \
+  0x000084D3, 0x000084E9, 0x00008504, 0x00008524, 0x00008547, 0x0000855E, 0x0000857A, 0x00008595, \
+  0x000085AB, 0x000085C8, 0x000085E4, 0x00008601, 0x00008617, 0x00008638, 0x00008660, 0x00008673, \
+  0x00008686, 0x000086A2, 0x000086BA, 0x000086CF, 0x000086DE, 0x00008701, 0x00008715, 0x0000872D, \
+  0x0000873F, 0x00008752, 0x00008771, 0x00008781, 0x000087A0, 0x000087C0, 0x000087DD, 0x000087EF, \
+  0x0000880E, 0x00008823, 0x00008842, 0x0000885B, 0x00008878, 0x0000889D, 0x000088B8, 0x000088D5, \
+  0x000088EC, 0x0000890A, 0x00008926, 0x0000893D, 0x00008955, 0x0000896E, 0x0000898B, 0x000089AE, \
+  0x000089BC, 0x000089D4, 0x000089F8, 0x00008A12, 0x00008A35, 0x00008A4E, 0x00008A61, 0x00008A80, \
+  0x00008A8F, 0x00008A9F, 0x00008AAE, 0x00008AC7, 0x00008AEA, 0x00008AFD, 0x00008B1D, 0x00008B2B, \
+  0x00008B38, 0x00008B46, 0x00008B59, 0x00008B68, 0x00008B8C, 0x00008BA6, 0x00008BBA, 0x00008BCE, \
+  0x00008BDF, 0x00008BF1, 0x00008C0D, 0x00008C2B, 0x00008C43, 0x00008C55, 0x00008C78, 0x00008C90, \
+  0x00008CAC, 0x00008CBB, 0x00008CDD, 0x00008CF8, 0x00008D1E, 0x00008D37, 0x00008D43, 0x00008D5F, \
+  0x00008D76, 0x00008D8D, 0x00008DA7, 0x00008DBB, 0x00008DD3, 0x00008DEB, 0x00008E09, 0x00008E1E, \
+  0x00008E38, 0x00008E4F, 0x00008E6C, 0x00008E84, 0x00008E99, 0x00008EAE, 0x00008EC9, 0x00008EDA, \
+  0x00008EF2, 0x00008F07, 0x00008F22, 0x00008F3D, 0x00008F5A, 0x00008F7C, 0x00008F8F, 0x00008FA6, \
+  0x00008FC5, 0x00008FDF, 0x00008FF3, 0x00009010, 0x0000902C, 0x0000903E, 0x00009051, 0x00009070, \
+  0x00009090, 0x000090A3, 0x000090B9, 0x000090C6, 0x000090DF, 0x000090F1, 0x00009108, 0x0000911A, \
+  0x00009131, 0x00009149, 0x0000915F, 0x00009173, 0x0000918D, 0x000091AC, 0x000091C8, 0x000091E2, \
+  0x000091FC, 0x00009215, 0x00009228, 0x0000923B, 0x00009252, 0x0000926B, 0x00009283, 0x0000929A, \
+  0x000092AF, 0x000092C7, 0x000092E3, 0x000092FF, 0x00009316, 0x0000932E, 0x00009348, 0x00009359, \
+  0x00009373, 0x00009389, 0x000093A6, 0x000093C7, 0x000093DC, 0x000093F9, 0x0000941A, 0x0000942D, \
+  0x00009445, 0x0000945F, 0x00009479, 0x0000948E, 0x000094A8, 0x000094C6, 0x000094DD, 0x000094F1, \
+  0x0000950A, 0x00009522, 0x0000953B, 0x00009550, 0x0000956B, 0x0000957E, 0x00009593, 0x000095A8, \
+  0x000095C2, 0x000095D7, 0x000095ED, 0x0000960A, 0x0000962F, 0x00009646, 0x00009661, 0x00009681, \
+  0x000096A0, 0x000096B4, 0x000096D2, 0x000096E9, 0x00009705, 0x00009721, 0x0000973C, 0x0000974F, \
+  0x00009767, 0x00009782, 0x0000979B, 0x000097B5, 0x000097CC, 0x000097DF, 0x000097FE, 0x00009813, \
+  0x0000982D, 0x00009845, 0x0000985A, 0x00009871, 0x0000988E, 0x000098A1, 0x000098B8, 0x000098D4, \
+  0x000098EE, 0x0000990D, 0x00009924, 0x0000993D, 0x00009958, 0x00009977, 0x00009994, 0x000099A9, \
+  0x000099BF, 0x000099D4, 0x000099F2, 0x00009A0B, 0x00009A23, 0x00009A3A, 0x00009A54, 0x00009A63, \
+  0x00009A7E, 0x00009A95, 0x00009AB1, 0x00009AC7, 0x00009AE6, 0x00009B04, 0x00009B21, 0x00009B3C, \
+  0x00009B55, 0x00009B6F, 0x00009B8D, 0x00009BA2, 0x00009BB9, 0x00009BD4, 0x00009BE6, 0x00009C03, \
+  0x00009C22, 0x00009C3C, 0x00009C52, 0x00009C6C, 0x00009C8B, 0x00009CA4, 0x00009CBB, 0x00009CD3, \
+  0x00009CE7, 0x00009CFE, 0x00009D13, 0x00009D2B, 0x00009D49, 0x00009D63, 0x00009D7F, 0x00009D93, \
+  0x00009DAD, 0x00009DBC, 0x00009DCB, 0x00009DE7, 0x00009DFE, 0x00009E1C, 0x00009E40, 0x00009E5A, \
+  0x00009E76, 0x00009E96, 0x00009EA7, 0x00009EBC, 0x00009ED2, 0x00009EF1, 0x00009F0D, 0x00009F20, \
+  0x00009F34, 0x00009F4E, 0x00009F69, 0x00009F7C, 0x00009F8E, 0x00009FA0, 0x00009FBB, 0x00009FD7, \
+  0x00009FF4, 0x0000A019, 0x0000A030, 0x0000A045, 0x0000A05D, 0x0000A06B, 0x0000A086, 0x0000A0A4, \
+  0x0000A0B7, 0x0000A0D0, 0x0000A0EF, 0x0000A106, 0x0000A118, 0x0000A135, 0x0000A149, 0x0000A160, \
+  0x0000A17D, 0x0000A19C, 0x0000A1B3, 0x0000A1C6, 0x0000A1E6, 0x0000A201, 0x0000A213, 0x0000A22E, \
+  0x0000A248, 0x0000A25D, 0x0000A270, 0x0000A28D, 0x0000A2A5, 0x0000A2C1, 0x0000A2D3, 0x0000A2E6, \
+  0x0000A2FC, 0x0000A319, 0x0000A332, 0x0000A344, 0x0000A35A, 0x0000A375, 0x0000A387, 0x0000A3A2, \
+  0x0000A3BD, 0x0000A3CF, 0x0000A3E9, 0x0000A40B, 0x0000A422, 0x0000A43D, 0x0000A459, 0x0000A472, \
+  0x0000A488, 0x0000A4A8, 0x0000A4C1, 0x0000A4DC, 0x0000A4F2, 0x0000A50B, 0x0000A51E, 0x0000A535, \
+  0x0000A54B, 0x0000A55F, 0x0000A57C, 0x0000A59B, 0x0000A5B3, 0x0000A5CE, 0x0000A5E1, 0x0000A5FC, \
+  0x0000A612, 0x0000A629, 0x0000A641, 0x0000A65B, 0x0000A676, 0x0000A68F, 0x0000A6A6, 0x0000A6BF, \
+  0x0000A6DD, 0x0000A6FC, 0x0000A716, 0x0000A72D, 0x0000A745, 0x0000A75A, 0x0000A76F, 0x0000A78B, \
+  0x0000A7A2, 0x0000A7BA, 0x0000A7D5, 0x0000A7E8, 0x0000A809, 0x0000A823, 0x0000A83A, 0x0000A853, \
+  0x0000A86F, 0x0000A887, 0x0000A8A3, 0x0000A8C3, 0x0000A8D5, 0x0000A8ED, 0x0000A908, 0x0000A91E, \
+  0x0000A933, 0x0000A946, 0x0000A95F, 0x0000A975, 0x0000A992, 0x0000A9AB, 0x0000A9BF, 0x0000A9DB, \
+  0x0000A9FB, 0x0000AA18, 0x0000AA33, 0x0000AA4A, 0x0000AA63, 0x0000AA79, 0x0000AA95, 0x0000AAAE, \
+  0x0000AAD0, 0x0000AAE3, 0x0000AB03, 0x0000AB15, 0x0000AB2A, 0x0000AB40, 0x0000AB5A, 0x0000AB71, \
+  0x0000AB8E, 0x0000ABA9, 0x0000ABC8, 0x0000ABE3, 0x0000ABF9, 0x0000AC14, 0x0000AC29, 0x0000AC42, \
+  0x0000AC57, 0x0000AC69, 0x0000AC86, 0x0000AC9A, 0x0000ACB2, 0x0000ACD1, 0x0000ACEE, 0x0000AD01, \
+  0x0000AD12, 0x0000AD26, 0x0000AD45, 0x0000AD5F, 0x0000AD7E, 0x0000AD9A, 0x0000ADAE, 0x0000ADC8, \
+  0x0000ADEC, 0x0000AE01, 0x0000AE1F, 0x0000AE3E, 0x0000AE59, 0x0000AE75, 0x0000AE8C, 0x0000AEA3, \
+  0x0000AEBE, 0x0000AED4, 0x0000AEF5, 0x0000AF0D, 0x0000AF2B, 0x0000AF46, 0x0000AF67, 0x0000AF82, \
+  0x0000AF99, 0x0000AFB3, 0x0000AFC5, 0x0000AFE2, 0x0000B000, 0x0000B011, 0x0000B02B, 0x0000B043, \
+  0x0000B059, 0x0000B076, 0x0000B088, 0x0000B0A3, 0x0000B0B9, 0x0000B0CB, 0x0000B0E2, 0x0000B0F5, \
+  0x0000B10F, 0x0000B12B, 0x0000B14E, 0x0000B162, 0x0000B17A, 0x0000B198, 0x0000B1B0, 0x0000B1C3, \
+  0x0000B1DD, 0x0000B1F9, 0x0000B214, 0x0000B22F, 0x0000B24C, 0x0000B263, 0x0000B27E, 0x0000B290, \
+  0x0000B2A6, 0x0000B2BD, 0x0000B2DF, 0x0000B2F1, 0x0000B30F, 0x0000B326, 0x0000B337, 0x0000B349, \
+  0x0000B361, 0x0000B378, 0x0000B38D, 0x0000B3AB, 0x0000B3CA, 0x0000B3E8, 0x0000B400, 0x0000B417, \
+  0x0000B42B, 0x0000B446, 0x0000B45C, 0x0000B478, 0x0000B48F, 0x0000B4AA, 0x0000B4C3, 0x0000B4D7, \
+  0x0000B4EF, 0x0000B507, 0x0000B529, 0x0000B53B, 0x0000B551, 0x0000B570, 0x0000B58E, 0x0000B5A9, \
+  0x0000B5BF, 0x0000B5D8, 0x0000B5F8, 0x0000B619, 0x0000B62E, 0x0000B648, 0x0000B661, 0x0000B672, \
+  0x0000B688, 0x0000B69E, 0x0000B6B8, 0x0000B6D9, 0x0000B6EB, 0x0000B6FE, 0x0000B713, 0x0000B735, \
+  0x0000B755, 0x0000B775, 0x0000B78D, 0x0000B7A2, 0x0000B7B8, 0x0000B7DD, 0x0000B7F8, 0x0000B813, \
+  0x0000B835, 0x0000B860, 0x0000B87B, 0x0000B89C, 0x0000B8B1, 0x0000B8CF, 0x0000B8F0, 0x0000B912, \
+  0x0000B92F, 0x0000B94E, 0x0000B963, 0x0000B98A, 0x0000B9A0, 0x0000B9CB, 0x0000B9E5, 0x0000B9F8, \
+  0x0000BA13, 0x0000BA37, 0x0000BA4E, 0x0000BA72, 0x0000BA98, 0x0000BABC, 0x0000BAD8, 0x0000BAF0, \
+  0x0000BB18, 0x0000BB2D, 0x0000BB4E, 0x0000BB70, 0x0000BB8F, 0x0000BBB6, 0x0000BBD2, 0x0000BBFC, \
+  0x0000BC1B, 0x0000BC45, 0x0000BC5E, 0x0000BC88, 0x0000BCA2, 0x0000BCBF, 0x0000BCD5, 0x0000BCED, \
+  0x0000BD08, 0x0000BD31, 0x0000BD54, 0x0000BD7E, 0x0000BDA2, 0x0000BDBF, 0x0000BDE0, 0x0000BDFE, \
+  0x0000BE17, 0x0000BE3A, 0x0000BE5B, 0x0000BE76, 0x0000BE9A, 0x0000BEC3, 0x0000BEE5, 0x0000BF09, \
+  0x0000BF1D, 0x0000BF32, 0x0000BF50, 0x0000BF75, 0x0000BF8F, 0x0000BFBE, 0x0000BFD9, 0x0000BFF3, \
+  0x0000C00B, 0x0000C030, 0x0000C045, 0x0000C06E, 0x0000C092, 0x0000C0A8, 0x0000C0C8, 0x0000C0E5, \
+  0x0000C108, 0x0000C131, 0x0000C150, 0x0000C174, 0x0000C18A, 0x0000C1AB, 0x0000C1C4, 0x0000C1E2, \
+  0x0000C212, 0x0000C234, 0x0000C250, 0x0000C26B, 0x0000C28C, 0x0000C2AE, 0x0000C2D9, 0x0000C2FA, \
+  0x0000C313, 0x0000C336, 0x0000C35B, 0x0000C377, 0x0000C39F, 0x0000C3B3, 0x0000C3E0, 0x0000C404, \
+  0x0000C425, 0x0000C438, 0x0000C450, 0x0000C464, 0x0000C484, 0x0000C4AF, 0x0000C4D6, 0x0000C4F2, \
+  0x0000C50F, 0x0000C52B, 0x0000C542, 0x0000C565, 0x0000C586, 0x0000C5A3, 0x0000C5C8, 0x0000C5E0, \
+  0x0000C5FE, 0x0000C623, 0x0000C640, 0x0000C660, 0x0000C680, 0x0000C6A5, 0x0000C6BE, 0x0000C6DC, \
+  0x0000C6FC, 0x0000C71B, 0x0000C732, 0x0000C74B, 0x0000C766, 0x0000C789, 0x0000C7A8, 0x0000C7C2, \
+  0x0000C7E1, 0x0000C7FC, 0x0000C815, 0x0000C839, 0x0000C851, 0x0000C874, 0x0000C893, 0x0000C8B2, \
+  0x0000C8D3, 0x0000C8F7, 0x0000C915, 0x0000C944, 0x0000C968, 0x0000C98B, 0x0000C9AC, 0x0000C9D5, \
+  0x0000C9FC, 0x0000CA25, 0x0000CA45, 0x0000CA6C, 0x0000CA9C, 0x0000CAB7, 0x0000CACC, 0x0000CAE8, \
+  0x0000CB12, 0x0000CB2F, 0x0000CB51, 0x0000CB6C, 0x0000CB86, 0x0000CBA0, 0x0000CBC0, 0x0000CBDE, \
+  0x0000CBF4, 0x0000CC1A, 0x0000CC3D, 0x0000CC5E, 0x0000CC79, 0x0000CC9A, 0x0000CCBE, 0x0000CCDA, \
+  0x0000CCFF, 0x0000CD20, 0x0000CD3F, 0x0000CD6E, 0x0000CD86, 0x0000CD97, 0x0000CDB9, 0x0000CDD8, \
+  0x0000CDF2, 0x0000CE0E, 0x0000CE28, 0x0000CE45, 0x0000CE5F, 0x0000CE83, 0x0000CEAB, 0x0000CEC4, \
+  0x0000CEDF, 0x0000CF06, 0x0000CF29, 0x0000CF49, 0x0000CF5A, 0x0000CF80, 0x0000CF95, 0x0000CFB5, \
+  0x0000CFD3, 0x0000CFEA, 0x0000D002, 0x0000D02A, 0x0000D04B, 0x0000D063, 0x0000D07B, 0x0000D099, \
+  0x0000D0B2, 0x0000D0D1, 0x0000D0F8, 0x0000D11B, 0x0000D134, 0x0000D164, 0x0000D17C, 0x0000D19F, \
+  0x0000D1BA, 0x0000D1F6, 0x0000D224, 0x0000D241, 0x0000D25F, 0x0000D27C, 0x0000D2A1, 0x0000D2BA, \
+  0x0000D2E2, 0x0000D306, 0x0000D31C, 0x0000D331, 0x0000D351, 0x0000D370, 0x0000D38F, 0x0000D3AE, \
+  0x0000D3C8, 0x0000D3DE, 0x0000D407, 0x0000D424, 0x0000D444, 0x0000D45F, 0x0000D48A, 0x0000D4A5, \
+  0x0000D4B8, 0x0000D4D7, 0x0000D507, 0x0000D529, 0x0000D545, 0x0000D56A, 0x0000D592, 0x0000D5AB, \
+  0x0000D5C5, 0x0000D5EF, 0x0000D60B, 0x0000D623, 0x0000D640, 0x0000D65B, 0x0000D677, 0x0000D6A8, \
+  0x0000D6CF, 0x0000D6FA, 0x0000D710, 0x0000D72F, 0x0000D757, 0x0000D777, 0x0000D793, 0x0000D7AC, \
+  0x0000D7D1, 0x0000D7EC, 0x0000D808, 0x0000D82E, 0x0000D856, 0x0000D875, 0x0000D898, 0x0000D8C2, \
+  0x0000D8E8, 0x0000D901, 0x0000D936, 0x0000D95A, 0x0000D97A, 0x0000D993, 0x0000D9BE, 0x0000D9E3, \
+  0x0000D9FE, 0x0000DA20, 0x0000DA38, 0x0000DA64, 0x0000DA7C, 0x0000DAAC, 0x0000DAD7, 0x0000DAF3, \
+  0x0000DB14, 0x0000DB2B, 0x0000DB4E, 0x0000DB6C, 0x0000DB81, 0x0000DB9F, 0x0000DBBA, 0x0000DBD7, \
+  0x0000DBF2, 0x0000DC18, 0x0000DC3E, 0x0000DC62, 0x0000DC87, 0x0000DCA3, 0x0000DCC0, 0x0000DCE1, \
+  0x0000DCFD, 0x0000DD19, 0x0000DD37, 0x0000DD5A, 0x0000DD7E, 0x0000DD92, 0x0000DDA7, 0x0000DDC3, \
+  0x0000DDF2, 0x0000DE06, 0x0000DE28
+
+#define GUID_DB_NAME_POOL \
+  "ARM_MP_CORE_INFO_GUID\0" \
+  "VARIABLE_RUNTIME_DXE_FILE_GUID\0" \
+  "EARLY_P_L011_BASE_ADDRESS_GUID\0" \
+  "ARM_VIRT_VARIABLE_GUID\0" \
+  "FDT_CLIENT_PROTOCOL_GUID\0" \
+  "UEFI_SYSTEM_TABLE_INFO_GUID\0" \
+  "UEFI_FRAME_BUFFER_INFO_GUID\0" \
+  "UEFI_ACPI_BOARD_INFO_GUID\0" \
+  "BMP_IMAGE_GUID\0" \
+  "PLATFORM_G_O_P_POLICY_GUID\0" \
+  "EFI_RUNTIME_CRYPT_PROTOCOL_GUID\0" \
+  "EFI_PCI_EXPRESS_BASE_ADDRESS_GUID\0" \
+  "EFI_ACPI_DESCRIPTION_GUID\0" \
+  "EFI_FLASH_MAP_HOB_GUID\0" \
+  "EFI_PCI_OPTION_ROM_TABLE_GUID\0" \
+  "DUET_CONSOLE_OUT_CONFIG_GUID\0" \
+  "DXE_CORE_FILE_NAME_GUID\0" \
+  "LDR_MEMORY_DESCRIPTOR_GUID\0" \
+  "EFI_SMM_BASE_THUNK_COMMUNICATION_GUID\0" \
+  "EFI_BOOT_STATE_GUID\0" \
+  "FRAMEWORK_BDS_FRONT_PAGE_FORMSET_GUID\0" \
+  "EFI_PRINT_PROTOCOL_GUID\0" \
+  "EFI_SMM_BASE_HELPER_READY_PROTOCOL_GUID\0" \
+  "FDT_TABLE_GUID\0" \
+  "FDT_HOB_GUID\0" \
+  "FDT_VARIABLE_GUID\0" \
+  "EDKII_PLATFORM_HAS_DEVICE_TREE_GUID\0" \
+  "DT_PLATFORM_FORM_SET_GUID\0" \
+  "DT_PLATFORM_DEFAULT_DTB_FILE_GUID\0" \
+  "CONSOLE_PREF_FORM_SET_GUID\0" \
+  "HARDWARE_INTERRUPT_PROTOCOL_GUID\0" \
+  "HARDWARE_INTERRUPT2_PROTOCOL_GUID\0" \
+  "EFI_DEBUG_SUPPORT_PERIODIC_CALLBACK_PROTOCOL_GUID\0" \
+  "EMBEDDED_DEVICE_GUID\0" \
+  "EMBEDDED_EXTERNAL_DEVICE_PROTOCOL_GUID\0" \
+  "EMBEDDED_GPIO_PROTOCOL_GUID\0" \
+  "PE_COFF_LOADER_PROTOCOL_GUID\0" \
+  "EFI_MMC_HOST_PROTOCOL_GUID\0" \
+  "ANDROID_FASTBOOT_TRANSPORT_PROTOCOL_GUID\0" \
+  "ANDROID_FASTBOOT_PLATFORM_PROTOCOL_GUID\0" \
+  "USB_DEVICE_PROTOCOL_GUID\0" \
+  "PLATFORM_GPIO_PROTOCOL_GUID\0" \
+  "ANDROID_BOOT_IMG_PROTOCOL_GUID\0" \
+  "EMU_THUNK_PROTOCOL_GUID\0" \
+  "EMU_IO_THUNK_PROTOCOL_GUID\0" \
+  "EMU_GRAPHICS_WINDOW_PROTOCOL_GUID\0" \
+  "EMU_THREAD_THUNK_PROTOCOL_GUID\0" \
+  "EMU_BLOCK_IO_PROTOCOL_GUID\0" \
+  "EMU_SNP_PROTOCOL_GUID\0" \
+  "EMU_SYSTEM_CONFIG_GUID\0" \
+  "EMU_VIRTUAL_DISKS_GUID\0" \
+  "EMU_PHYSICAL_DISKS_GUID\0" \
+  "EFI_DATA_HUB_STATUS_CODE_RECORD_GUID\0" \
+  "TIANO_CUSTOM_DECOMPRESS_GUID\0" \
+  "EFI_ACPI_VARIABLE_COMPATIBLITY_GUID\0" \
+  "EFI_LEGACY_BIOS_GUID\0" \
+  "EFI_LEGACY_DEV_ORDER_VARIABLE_GUID\0" \
+  "EFI_UPDATE_DATA_FILE_GUID\0" \
+  "BLOCK_IO_VENDOR_GUID\0" \
+  "BOOT_MANAGER_FORM_SET_GUID\0" \
+  "DEVICE_MANAGER_FORM_SET_GUID\0" \
+  "DRIVER_HEALTH_FORM_SET_GUID\0" \
+  "BOOT_MAINT_FORM_SET_GUID\0" \
+  "FILE_EXPLORE_FORM_SET_GUID\0" \
+  "BDS_LIB_STRING_PACKAGE_GUID\0" \
+  "LAST_ENUM_LANG_GUID\0" \
+  "HD_BOOT_DEVICE_PATH_VARIABL_GUID\0" \
+  "EFI_VGA_MINI_PORT_PROTOCOL_GUID\0" \
+  "EFI_ISA_IO_PROTOCOL_GUID\0" \
+  "EFI_ISA_ACPI_PROTOCOL_GUID\0" \
+  "EFI_O_E_M_BADGING_PROTOCOL_GUID\0" \
+  "EXIT_PM_AUTH_PROTOCOL_GUID\0" \
+  "EFI_CACHE_SUB_CLASS_GUID\0" \
+  "EFI_MEMORY_SUB_CLASS_GUID\0" \
+  "EFI_MISC_SUB_CLASS_GUID\0" \
+  "EFI_PROCESSOR_SUB_CLASS_GUID\0" \
+  "EFI_CAPSULE_GUID\0" \
+  "EFI_CONFIG_FILE_NAME_GUID\0" \
+  "SMM_COMMUNICATE_HEADER_GUID\0" \
+  "EFI_FIRMWARE_FILE_SYSTEM_GUID\0" \
+  "EFI_ACPI_S3_SAVE_PROTOCOL_GUID\0" \
+  "EFI_ACPI_SUPPORT_PROTOCOL_GUID\0" \
+  "EFI_BOOT_SCRIPT_SAVE_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_BIOS_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_BIOS_PLATFORM_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_INTERRUPT_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_REGION_PROTOCOL_GUID\0" \
+  "EFI_LEGACY8259_PROTOCOL_GUID\0" \
+  "EFI_CPU_IO_PROTOCOL_GUID\0" \
+  "EFI_DATA_HUB_PROTOCOL_GUID\0" \
+  "EFI_FIRMWARE_VOLUME_PROTOCOL_GUID\0" \
+  "EFI_SECTION_EXTRACTION_PROTOCOL_GUID\0" \
+  "EFI_HII_PROTOCOL_GUID\0" \
+  "EFI_HII_COMPATIBILITY_PROTOCOL_GUID\0" \
+  "FRAMEWORK_EFI_MP_SERVICE_PROTOCOL_GUID\0" \
+  "EFI_SMM_BASE_PROTOCOL_GUID\0" \
+  "EFI_SMM_ACCESS_PROTOCOL_GUID\0" \
+  "EFI_SMM_CONTROL_PROTOCOL_GUID\0" \
+  "EFI_SMM_SW_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_SX_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_PERIODIC_TIMER_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_USB_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_GPI_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_STANDBY_BUTTON_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_POWER_BUTTON_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_ICHN_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_CPU_IO_GUID\0" \
+  "EFI_FORM_CALLBACK_PROTOCOL_GUID\0" \
+  "EFI_FORM_BROWSER_PROTOCOL_GUID\0" \
+  "EFI_FORM_BROWSER_COMPATIBILITY_PROTOCOL_GUID\0" \
+  "FRAMERWORK_EFI_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID\0" \
+  "EFI_SMM_CPU_SAVE_STATE_PROTOCOL_GUID\0" \
+  "FSP_HEADER_FILE_GUID\0" \
+  "FSP_RESERVED_MEMORY_RESOURCE_HOB_GUID\0" \
+  "FSP_NON_VOLATILE_STORAGE_HOB_GUID\0" \
+  "FSP_BOOT_LOADER_TOLUM_HOB_GUID\0" \
+  "FSP_PERFORMANCE_DATA_GUID\0" \
+  "FSP_EVENT_END_OF_FIRMWARE_GUID\0" \
+  "FSP_API_PERFORMANCE_GUID\0" \
+  "FSP_HOB_GUID\0" \
+  "ADD_PERF_RECORD_PROTOCOL_GUID\0" \
+  "FSP_BOOT_LOADER_TEMPORARY_MEMORY_GUID\0" \
+  "FSP_RESERVED_MEMORY_RESOURCE_HOB_TSEG_GUID\0" \
+  "FSP_RESERVED_MEMORY_RESOURCE_HOB_GFX_GUID\0" \
+  "FSP_RESERVED_MEMORY_RESOURCE_HOB_MISC_GUID\0" \
+  "INTEL_SMBIOS_DATA_HOB_GUID\0" \
+  "MICROCODE_FMP_IMAGE_TYPE_ID_GUID\0" \
+  "EDKII_PLATFORM_V_TD_POLICY_PROTOCOL_GUID\0" \
+  "PCD_DATA_BASE_HOB_GUID\0" \
+  "PCD_DATA_BASE_SIGNATURE_GUID\0" \
+  "EFI_IFR_TIANO_GUID\0" \
+  "EDKII_IFR_BIT_VARSTORE_GUID\0" \
+  "EFI_IFR_FRAMEWORK_GUID\0" \
+  "EFI_SYSTEM_NV_DATA_FV_GUID\0" \
+  "EDKII_WORKING_BLOCK_SIGNATURE_GUID\0" \
+  "EDKII_FAULT_TOLERANT_WRITE_GUID\0" \
+  "EFI_CONSOLE_OUT_DEVICE_GUID\0" \
+  "EFI_CONSOLE_IN_DEVICE_GUID\0" \
+  "EFI_MEMORY_TYPE_INFORMATION_GUID\0" \
+  "EFI_CAPSULE_VENDOR_GUID\0" \
+  "EFI_STANDARD_ERROR_DEVICE_GUID\0" \
+  "EFI_VARIABLE_GUID\0" \
+  "EFI_AUTHENTICATED_VARIABLE_GUID\0" \
+  "EFI_VARIABLE_INDEX_TABLE_GUID\0" \
+  "SMM_VARIABLE_WRITE_GUID\0" \
+  "PERFORMANCE_PROTOCOL_GUID\0" \
+  "SMM_PERFORMANCE_PROTOCOL_GUID\0" \
+  "PERFORMANCE_EX_PROTOCOL_GUID\0" \
+  "SMM_PERFORMANCE_EX_PROTOCOL_GUID\0" \
+  "EFI_CRC32_GUIDED_SECTION_EXTRACTION_GUID\0" \
+  "STATUS_CODE_CALLBACK_GUID\0" \
+  "MEMORY_STATUS_CODE_RECORD_GUID\0" \
+  "EFI_STATUS_CODE_DATA_TYPE_DEBUG_GUID\0" \
+  "LOAD_FIXED_ADDRESS_CONFIGURATION_TABLE_GUID\0" \
+  "EFI_GENERIC_VARIABLE_GUID\0" \
+  "IDLE_LOOP_EVENT_GUID\0" \
+  "RECOVERY_ON_FAT_USB_DISK_GUID\0" \
+  "RECOVERY_ON_FAT_IDE_DISK_GUID\0" \
+  "RECOVERY_ON_FAT_FLOPPY_DISK_GUID\0" \
+  "RECOVERY_ON_DATA_CD_GUID\0" \
+  "EFI_SMM_LOCK_BOX_COMMUNICATION_GUID\0" \
+  "EFI_ACPI_VARIABLE_GUID\0" \
+  "EFI_ACPI_S3_CONTEXT_GUID\0" \
+  "EFI_BOOT_SCRIPT_EXECUTOR_VARIABLE_GUID\0" \
+  "EFI_BOOT_SCRIPT_EXECUTOR_CONTEXT_GUID\0" \
+  "USB_KEYBOARD_LAYOUT_PACKAGE_GUID\0" \
+  "USB_KEYBOARD_LAYOUT_KEY_GUID\0" \
+  "HII_RESOURCE_SAMLE_FORM_SET_GUID\0" \
+  "DRIVER_SAMPLE_FORM_SET_GUID\0" \
+  "DRIVER_SAMPLE_INVENTORY_GUID\0" \
+  "EFI_IFR_REFRESH_ID_OP_GUID\0" \
+  "PLATFORM_OVERRIDES_MANAGER_GUID\0" \
+  "IP4_CONFIG2_NV_DATA_GUID\0" \
+  "VLAN_CONFIG_FORM_SET_GUID\0" \
+  "IP4_I_SCSI_CONFIG_GUID\0" \
+  "I_SCSI_C_H_A_P_AUTH_INFO_GUID\0" \
+  "ZERO_GUID\0" \
+  "MTC_VENDOR_GUID\0" \
+  "EFI_FIRMWARE_PERFORMANCE_GUID\0" \
+  "FIRMWARE_PERFORMANCE_S3_POINTER_GUID\0" \
+  "EVENT_EXIT_BOOT_SERVICES_FAILED_GUID\0" \
+  "CONNECT_CON_IN_EVENT_GUID\0" \
+  "EDKII_STATUS_CODE_DATA_TYPE_VARIABLE_GUID\0" \
+  "EDKII_MEMORY_PROFILE_GUID\0" \
+  "EDKII_SMM_MEMORY_PROFILE_GUID\0" \
+  "EDKII_VAR_ERROR_FLAG_GUID\0" \
+  "BROTLI_CUSTOM_DECOMPRESS_GUID\0" \
+  "LZMA_CUSTOM_DECOMPRESS_GUID\0" \
+  "LZMA_F86_CUSTOM_DECOMPRESS_GUID\0" \
+  "EFI_TTY_TERM_GUID\0" \
+  "EFI_IFR_BOOT_MAINTENANCE_GUID\0" \
+  "EFI_IFR_FRONT_PAGE_GUID\0" \
+  "RAM_DISK_FORM_SET_GUID\0" \
+  "EDKII_PI_SMM_COMMUNICATION_REGION_TABLE_GUID\0" \
+  "EDKII_PI_SMM_MEMORY_ATTRIBUTES_TABLE_GUID\0" \
+  "SMI_HANDLER_PROFILE_GUID\0" \
+  "EDKII_NON_DISCOVERABLE_AHCI_DEVICE_GUID\0" \
+  "EDKII_NON_DISCOVERABLE_AMBA_DEVICE_GUID\0" \
+  "EDKII_NON_DISCOVERABLE_EHCI_DEVICE_GUID\0" \
+  "EDKII_NON_DISCOVERABLE_NVME_DEVICE_GUID\0" \
+  "EDKII_NON_DISCOVERABLE_OHCI_DEVICE_GUID\0" \
+  "EDKII_NON_DISCOVERABLE_SDHCI_DEVICE_GUID\0" \
+  "EDKII_NON_DISCOVERABLE_UFS_DEVICE_GUID\0" \
+  "EDKII_NON_DISCOVERABLE_UHCI_DEVICE_GUID\0" \
+  "EDKII_NON_DISCOVERABLE_XHCI_DEVICE_GUID\0" \
+  "EDKII_PLATFORM_HAS_ACPI_GUID\0" \
+  "EDKII_FPDT_EXTENDED_FIRMWARE_PERFORMANCE_GUID\0" \
+  "EDKII_END_OF_S3_RESUME_GUID\0" \
+  "EDKII_S3_SMM_INIT_DONE_GUID\0" \
+  "EFI_LOAD_PE_IMAGE_PROTOCOL_GUID\0" \
+  "EFI_PRINT2_PROTOCOL_GUID\0" \
+  "EFI_PRINT2_S_PROTOCOL_GUID\0" \
+  "EFI_GENERIC_MEM_TEST_PROTOCOL_GUID\0" \
+  "EFI_DEBUGGER_CONFIGURATION_PROTOCOL_GUID\0" \
+  "EFI_DPC_PROTOCOL_GUID\0" \
+  "EFI_FAULT_TOLERANT_WRITE_PROTOCOL_GUID\0" \
+  "EFI_SMM_FAULT_TOLERANT_WRITE_PROTOCOL_GUID\0" \
+  "EFI_SWAP_ADDRESS_RANGE_PROTOCOL_GUID\0" \
+  "EFI_SMM_SWAP_ADDRESS_RANGE_PROTOCOL_GUID\0" \
+  "EFI_SMM_VARIABLE_PROTOCOL_GUID\0" \
+  "EDKII_VARIABLE_LOCK_PROTOCOL_GUID\0" \
+  "EDKII_VAR_CHECK_PROTOCOL_GUID\0" \
+  "EDKII_SMM_VAR_CHECK_PROTOCOL_GUID\0" \
+  "EFI_SMM_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID\0" \
+  "EFI_DEBUG_MASK_PROTOCOL_GUID\0" \
+  "EFI_LOCK_BOX_PROTOCOL_GUID\0" \
+  "EFI_FORM_BROWSER_EX_PROTOCOL_GUID\0" \
+  "EFI_EBC_VM_TEST_PROTOCOL_GUID\0" \
+  "EFI_EBC_SIMPLE_DEBUGGER_PROTOCOL_GUID\0" \
+  "EFI_BOOT_LOGO_PROTOCOL_GUID\0" \
+  "EDKII_BOOT_LOGO2_PROTOCOL_GUID\0" \
+  "EDKII_FORM_DISPLAY_ENGINE_PROTOCOL_GUID\0" \
+  "EDKII_FORM_BROWSER_EX2_PROTOCOL_GUID\0" \
+  "EDKII_UFS_HOST_CONTROLLER_PROTOCOL_GUID\0" \
+  "ESRT_MANAGEMENT_PROTOCOL_GUID\0" \
+  "EDKII_SMM_EXIT_BOOT_SERVICES_PROTOCOL_GUID\0" \
+  "EDKII_SMM_LEGACY_BOOT_PROTOCOL_GUID\0" \
+  "EDKII_SMM_READY_TO_BOOT_PROTOCOL_GUID\0" \
+  "EDKII_PLATFORM_LOGO_PROTOCOL_GUID\0" \
+  "EFI_FILE_EXPLORER_PROTOCOL_GUID\0" \
+  "IPMI_PROTOCOL_GUID\0" \
+  "SMM_IPMI_PROTOCOL_GUID\0" \
+  "EFI_PS2_POLICY_PROTOCOL_GUID\0" \
+  "EDKII_NON_DISCOVERABLE_DEVICE_PROTOCOL_GUID\0" \
+  "EDKII_IO_MMU_PROTOCOL_GUID\0" \
+  "EDKII_SMM_MEMORY_ATTRIBUTE_PROTOCOL_GUID\0" \
+  "EDKII_PLATFORM_SPECIFIC_RESET_FILTER_PROTOCOL_GUID\0" \
+  "EDKII_PLATFORM_SPECIFIC_RESET_HANDLER_PROTOCOL_GUID\0" \
+  "EDKII_FIRMWARE_MANAGEMENT_PROGRESS_PROTOCOL_GUID\0" \
+  "EFI_GLOBAL_VARIABLE_GUID\0" \
+  "EFI_V_T100_PLUS_GUID\0" \
+  "EFI_V_T100_GUID\0" \
+  "EFI_PC_ANSI_GUID\0" \
+  "EFI_V_T_U_T_F8_GUID\0" \
+  "EFI_UART_DEVICE_PATH_GUID\0" \
+  "EFI_SAS_DEVICE_PATH_GUID\0" \
+  "EFI_PART_TYPE_LEGACY_MBR_GUID\0" \
+  "EFI_PART_TYPE_SYSTEM_PART_GUID\0" \
+  "EFI_DEBUG_IMAGE_INFO_TABLE_GUID\0" \
+  "EFI_ACPI_TABLE_GUID\0" \
+  "EFI_ACPI10_TABLE_GUID\0" \
+  "EFI_SMBIOS_TABLE_GUID\0" \
+  "EFI_MPS_TABLE_GUID\0" \
+  "EFI_SAL_SYSTEM_TABLE_GUID\0" \
+  "EFI_AUTHENTICATION_CHAP_LOCAL_GUID\0" \
+  "EFI_AUTHENTICATION_CHAP_RADIUS_GUID\0" \
+  "EFI_FILE_SYSTEM_VOLUME_LABEL_INFO_ID_GUID\0" \
+  "EFI_FILE_SYSTEM_INFO_GUID\0" \
+  "EFI_FILE_INFO_GUID\0" \
+  "BOOT_OBJECT_AUTHORIZATION_PARMSET_GUID\0" \
+  "EFI_PLATFORM_TO_DRIVER_CONFIGURATION_CLP_GUID\0" \
+  "EFI_HII_KEY_BOARD_LAYOUT_GUID\0" \
+  "EFI_HASH_ALGORITHM_M_D5_GUID\0" \
+  "EFI_HASH_ALGORITHM_SHA512_GUID\0" \
+  "EFI_HASH_ALGORITHM_SHA384_GUID\0" \
+  "EFI_HASH_ALGORITHM_SHA256_GUID\0" \
+  "EFI_HASH_ALGORITHM_SHA224_GUID\0" \
+  "EFI_HASH_ALGORITHM_SHA1_GUID\0" \
+  "EFI_EVENT_READY_TO_BOOT_GUID\0" \
+  "EFI_EVENT_MEMORY_MAP_CHANGE_GUID\0" \
+  "EFI_EVENT_VIRTUAL_ADDRESS_CHANGE_GUID\0" \
+  "EFI_EVENT_EXIT_BOOT_SERVICES_GUID\0" \
+  "EFI_DEBUG_PORT_VARIABLE_GUID\0" \
+  "EFI_HII_PLATFORM_SETUP_FORMSET_GUID\0" \
+  "EFI_HII_DRIVER_HEALTH_FORMSET_GUID\0" \
+  "EFI_HII_USER_CREDENTIAL_FORMSET_GUID\0" \
+  "EFI_HII_STANDARD_FORM_GUID\0" \
+  "EFI_MEMORY_OVERWRITE_CONTROL_DATA_GUID\0" \
+  "EFI_MEMORY_OVERWRITE_REQUEST_CONTROL_LOCK_GUID\0" \
+  "EFI_CERT_TYPE_RSA2048_SHA256_GUID\0" \
+  "EFI_EVENT_NOTIFICATION_TYPE_CMC_GUID\0" \
+  "EFI_EVENT_NOTIFICATION_TYPE_CPE_GUID\0" \
+  "EFI_EVENT_NOTIFICATION_TYPE_MCE_GUID\0" \
+  "EFI_EVENT_NOTIFICATION_TYPE_PCIE_GUID\0" \
+  "EFI_EVENT_NOTIFICATION_TYPE_INIT_GUID\0" \
+  "EFI_EVENT_NOTIFICATION_TYPE_NMI_GUID\0" \
+  "EFI_EVENT_NOTIFICATION_TYPE_BOOT_GUID\0" \
+  "EFI_EVENT_NOTIFICATION_TYPE_DMAR_GUID\0" \
+  "EFI_PROCESSOR_GENERIC_ERROR_SECTION_GUID\0" \
+  "EFI_PROCESSOR_SPECIFIC_ERROR_SECTION_GUID\0" \
+  "EFI_PLATFORM_MEMORY_ERROR_SECTION_GUID\0" \
+  "EFI_PCIE_ERROR_SECTION_GUID\0" \
+  "EFI_FIRMWARE_ERROR_SECTION_GUID\0" \
+  "EFI_PCI_BUS_ERROR_SECTION_GUID\0" \
+  "EFI_PCI_DEV_ERROR_SECTION_GUID\0" \
+  "EFI_D_M_AR_GENERIC_ERROR_SECTION_GUID\0" \
+  "EFI_DIRECTED_IO_D_M_AR_ERROR_SECTION_GUID\0" \
+  "EFI_IOMMU_D_M_AR_ERROR_SECTION_GUID\0" \
+  "EFI_EVENT_USER_PROFILE_CHANGED_GUID\0" \
+  "EFI_USER_CREDENTIAL_CLASS_UNKNOWN_GUID\0" \
+  "EFI_USER_CREDENTIAL_CLASS_PASSWORD_GUID\0" \
+  "EFI_USER_CREDENTIAL_CLASS_SMART_CARD_GUID\0" \
+  "EFI_USER_CREDENTIAL_CLASS_FINGERPRINT_GUID\0" \
+  "EFI_USER_CREDENTIAL_CLASS_HANDPRINT_GUID\0" \
+  "EFI_USER_CREDENTIAL_CLASS_SECURE_CARD_GUID\0" \
+  "EFI_USER_INFO_ACCESS_SETUP_ADMIN_GUID\0" \
+  "EFI_USER_INFO_ACCESS_SETUP_NORMAL_GUID\0" \
+  "EFI_USER_INFO_ACCESS_SETUP_RESTRICTED_GUID\0" \
+  "EFI_IMAGE_SECURITY_DATABASE_GUID\0" \
+  "EFI_CERT_SHA256_GUID\0" \
+  "EFI_CERT_RSA2048_GUID\0" \
+  "EFI_CERT_RSA2048_SHA256_GUID\0" \
+  "EFI_CERT_SHA1_GUID\0" \
+  "EFI_CERT_RSA2048_SHA1_GUID\0" \
+  "EFI_CERT_X509_GUID\0" \
+  "EFI_KMS_FORMAT_GENERIC128_GUID\0" \
+  "EFI_KMS_FORMAT_GENERIC160_GUID\0" \
+  "EFI_KMS_FORMAT_GENERIC256_GUID\0" \
+  "EFI_KMS_FORMAT_GENERIC512_GUID\0" \
+  "EFI_KMS_FORMAT_GENERIC1024_GUID\0" \
+  "EFI_KMS_FORMAT_GENERIC2048_GUID\0" \
+  "EFI_KMS_FORMAT_GENERIC3072_GUID\0" \
+  "EFI_KMS_FORMAT_MD2128_GUID\0" \
+  "EFI_KMS_FORMAT_MDC2128_GUID\0" \
+  "EFI_KMS_FORMAT_MD4128_GUID\0" \
+  "EFI_KMS_FORMAT_MDC4128_GUID\0" \
+  "EFI_KMS_FORMAT_MD5128_GUID\0" \
+  "EFI_KMS_FORMAT_MD5SHA128_GUID\0" \
+  "EFI_KMS_FORMAT_SHA1160_GUID\0" \
+  "EFI_KMS_FORMAT_SHA256256_GUID\0" \
+  "EFI_KMS_FORMAT_SHA512512_GUID\0" \
+  "EFI_KMS_FORMAT_AESXTS128_GUID\0" \
+  "EFI_KMS_FORMAT_AESXTS256_GUID\0" \
+  "EFI_KMS_FORMAT_AESCBC128_GUID\0" \
+  "EFI_KMS_FORMAT_AESCBC256_GUID\0" \
+  "EFI_KMS_FORMAT_RSASHA11024_GUID\0" \
+  "EFI_KMS_FORMAT_RSASHA12048_GUID\0" \
+  "EFI_KMS_FORMAT_RSASHA2562048_GUID\0" \
+  "EFI_KMS_FORMAT_RSASHA2563072_GUID\0" \
+  "EFI_CERT_SHA224_GUID\0" \
+  "EFI_CERT_SHA384_GUID\0" \
+  "EFI_CERT_SHA512_GUID\0" \
+  "EFI_CERT_PKCS7_GUID\0" \
+  "EFI_HASH_ALGORITHM_SHA1_NO_PAD_GUID\0" \
+  "EFI_HASH_ALGORITHM_SHA256_NO_PAD_GUID\0" \
+  "EFI_FMP_CAPSULE_GUID\0" \
+  "EFI_CERT_X509_SHA256_GUID\0" \
+  "EFI_CERT_X509_SHA384_GUID\0" \
+  "EFI_CERT_X509_SHA512_GUID\0" \
+  "EFI_RNG_ALGORITHM_SP80090_HASH256_GUID\0" \
+  "EFI_RNG_ALGORITHM_SP80090_HMAC256_GUID\0" \
+  "EFI_RNG_ALGORITHM_SP80090_CTR256_GUID\0" \
+  "EFI_RNG_ALGORITHM_X9313_DES_GUID\0" \
+  "EFI_RNG_ALGORITHM_X931_AES_GUID\0" \
+  "EFI_RNG_ALGORITHM_RAW\0" \
+  "EFI_ADAPTER_INFO_MEDIA_STATE_GUID\0" \
+  "EFI_ADAPTER_INFO_NETWORK_BOOT_GUID\0" \
+  "EFI_ADAPTER_INFO_SAN_MAC_ADDRESS_GUID\0" \
+  "EFI_CAPSULE_REPORT_GUID\0" \
+  "EFI_PROPERTIES_TABLE_GUID\0" \
+  "EFI_SYSTEM_RESOURCE_TABLE_GUID\0" \
+  "EFI_ADAPTER_INFO_UNDI_IPV6_SUPPORT_GUID\0" \
+  "EFI_REGEX_SYNTAX_TYPE_POSIX_EXTENDED_GUID\0" \
+  "EFI_REGEX_SYNTAX_TYPE_ECMA262_GUID\0" \
+  "EFI_REGEX_SYNTAX_TYPE_PERL_GUID\0" \
+  "EFI_PLATFORM_MEMORY2_ERROR_SECTION_GUID\0" \
+  "EFI_BLOCK_IO_CRYPTO_ALGO_AES_XTS_GUID\0" \
+  "EFI_BLOCK_IO_CRYPTO_ALGO_AES_CBC_MS_BITLOCKER_GUID\0" \
+  "EFI_PADDING_RSASSA_PKCS1_V1_P5_GUID\0" \
+  "EFI_PADDING_RSASSA_PSS_GUID\0" \
+  "EFI_PADDING_NONE_GUID\0" \
+  "EFI_PADDING_RSAES_PKCS1_V1_P5_GUID\0" \
+  "EFI_PADDING_RSAES_OAEP_GUID\0" \
+  "EFI_SMBIOS3_TABLE_GUID\0" \
+  "EFI_BOOT_MANAGER_POLICY_CONSOLE_GUID\0" \
+  "EFI_BOOT_MANAGER_POLICY_NETWORK_GUID\0" \
+  "EFI_BOOT_MANAGER_POLICY_CONNECT_ALL_GUID\0" \
+  "EFI_VIRTUAL_DISK_GUID\0" \
+  "EFI_VIRTUAL_CD_GUID\0" \
+  "EFI_PERSISTENT_VIRTUAL_DISK_GUID\0" \
+  "EFI_PERSISTENT_VIRTUAL_CD_GUID\0" \
+  "EFI_MEMORY_ATTRIBUTES_TABLE_GUID\0" \
+  "EFI_ARM_PROCESSOR_ERROR_SECTION_GUID\0" \
+  "EFI_HII_IMAGE_DECODER_NAME_JPEG_GUID\0" \
+  "EFI_HII_IMAGE_DECODER_NAME_PNG_GUID\0" \
+  "EFI_BTT_ABSTRACTION_GUID\0" \
+  "APRIORI_GUID\0" \
+  "EFI_FIRMWARE_FILE_SYSTEM2_GUID\0" \
+  "EFI_FIRMWARE_VOLUME_TOP_FILE_GUID\0" \
+  "EFI_HOB_MEMORY_ALLOC_MODULE_GUID\0" \
+  "EFI_HOB_MEMORY_ALLOC_STACK_GUID\0" \
+  "EFI_HOB_MEMORY_ALLOC_BSP_STORE_GUID\0" \
+  "EFI_EVENT_LEGACY_BOOT_GUID\0" \
+  "EFI_HOB_LIST_GUID\0" \
+  "EFI_DXE_SERVICES_TABLE_GUID\0" \
+  "EFI_HARDWARE_ERROR_VARIABLE_GUID\0" \
+  "EFI_EVENT_DXE_DISPATCH_GUID\0" \
+  "EFI_DISK_INFO_IDE_INTERFACE_GUID\0" \
+  "EFI_DISK_INFO_SCSI_INTERFACE_GUID\0" \
+  "EFI_DISK_INFO_USB_INTERFACE_GUID\0" \
+  "EFI_DISK_INFO_AHCI_INTERFACE_GUID\0" \
+  "EFI_STATUS_CODE_DATA_TYPE_STRING_GUID\0" \
+  "EFI_STATUS_CODE_SPECIFIC_DATA_GUID\0" \
+  "EFI_FIRMWARE_FILE_SYSTEM3_GUID\0" \
+  "EFI_END_OF_DXE_EVENT_GROUP_GUID\0" \
+  "EFI_FIRMWARE_CONTENTS_SIGNED_GUID\0" \
+  "EFI_VECTOR_HANDOFF_TABLE_GUID\0" \
+  "ADAPTER_INFO_PLATFORM_SECURITY_GUID\0" \
+  "EFI_DISK_INFO_NVME_INTERFACE_GUID\0" \
+  "EFI_GRAPHICS_INFO_HOB_GUID\0" \
+  "EFI_DISK_INFO_UFS_INTERFACE_GUID\0" \
+  "EFI_GRAPHICS_DEVICE_INFO_HOB_GUID\0" \
+  "EFI_DISK_INFO_SD_MMC_INTERFACE_GUID\0" \
+  "WINDOWS_UX_CAPSULE_GUID\0" \
+  "EFI_IA32_X64_ERROR_TYPE_CACHE_CHECK_GUID\0" \
+  "EFI_IA32_X64_ERROR_TYPE_TLB_CHECK_GUID\0" \
+  "EFI_IA32_X64_ERROR_TYPE_BUS_CHECK_GUID\0" \
+  "EFI_IA32_X64_ERROR_TYPE_MS_CHECK_GUID\0" \
+  "PCD_PROTOCOL_GUID\0" \
+  "GET_PCD_INFO_PROTOCOL_GUID\0" \
+  "EFI_BDS_ARCH_PROTOCOL_GUID\0" \
+  "EFI_CPU_ARCH_PROTOCOL_GUID\0" \
+  "EFI_METRONOME_ARCH_PROTOCOL_GUID\0" \
+  "EFI_MONOTONIC_COUNTER_ARCH_PROTOCOL_GUID\0" \
+  "EFI_REAL_TIME_CLOCK_ARCH_PROTOCOL_GUID\0" \
+  "EFI_RESET_ARCH_PROTOCOL_GUID\0" \
+  "EFI_RUNTIME_ARCH_PROTOCOL_GUID\0" \
+  "EFI_SECURITY_ARCH_PROTOCOL_GUID\0" \
+  "EFI_SECURITY_POLICY_PROTOCOL_GUID\0" \
+  "EFI_TIMER_ARCH_PROTOCOL_GUID\0" \
+  "EFI_VARIABLE_WRITE_ARCH_PROTOCOL_GUID\0" \
+  "EFI_VARIABLE_ARCH_PROTOCOL_GUID\0" \
+  "EFI_WATCHDOG_TIMER_ARCH_PROTOCOL_GUID\0" \
+  "EFI_STATUS_CODE_RUNTIME_PROTOCOL_GUID\0" \
+  "EFI_SMBUS_HC_PROTOCOL_GUID\0" \
+  "EFI_FIRMWARE_VOLUME2_PROTOCOL_GUID\0" \
+  "EFI_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID\0" \
+  "EFI_CAPSULE_ARCH_PROTOCOL_GUID\0" \
+  "EFI_MP_SERVICE_PROTOCOL_GUID\0" \
+  "EFI_PCI_HOST_BRIDGE_RESOURCE_ALLOCATION_PROTOCOL_GUID\0" \
+  "EFI_PCI_PLATFORM_PROTOCOL_GUID\0" \
+  "EFI_PCI_OVERRIDE_PROTOCOL_GUID\0" \
+  "EFI_PCI_ENUMERATION_COMPLETE_PROTOCOL_GUID\0" \
+  "EFI_INCOMPATIBLE_PCI_DEVICE_SUPPORT_PROTOCOL_GUID\0" \
+  "EFI_PCI_HOT_PLUG_INIT_PROTOCOL_GUID\0" \
+  "EFI_PCI_HOT_PLUG_REQUEST_PROTOCOL_GUID\0" \
+  "EFI_IDE_CONTROLLER_INIT_PROTOCOL_GUID\0" \
+  "EFI_DISK_INFO_PROTOCOL_GUID\0" \
+  "EFI_SMBIOS_PROTOCOL_GUID\0" \
+  "EFI_S3_SAVE_STATE_PROTOCOL_GUID\0" \
+  "EFI_S3_SMM_SAVE_STATE_PROTOCOL_GUID\0" \
+  "EFI_RSC_HANDLER_PROTOCOL_GUID\0" \
+  "EFI_SMM_RSC_HANDLER_PROTOCOL_GUID\0" \
+  "EFI_ACPI_SDT_PROTOCOL_GUID\0" \
+  "EFI_SIO_PROTOCOL_GUID\0" \
+  "EFI_SMM_CPU_IO2_PROTOCOL_GUID\0" \
+  "EFI_SMM_BASE2_PROTOCOL_GUID\0" \
+  "EFI_SMM_ACCESS2_PROTOCOL_GUID\0" \
+  "EFI_SMM_CONTROL2_PROTOCOL_GUID\0" \
+  "EFI_SMM_CONFIGURATION_PROTOCOL_GUID\0" \
+  "EFI_SMM_READY_TO_LOCK_PROTOCOL_GUID\0" \
+  "EFI_DXE_SMM_READY_TO_LOCK_PROTOCOL_GUID\0" \
+  "EFI_SMM_COMMUNICATION_PROTOCOL_GUID\0" \
+  "EFI_SMM_STATUS_CODE_PROTOCOL_GUID\0" \
+  "EFI_SMM_CPU_PROTOCOL_GUID\0" \
+  "EFI_SMM_PCI_ROOT_BRIDGE_IO_PROTOCOL_GUID\0" \
+  "EFI_SMM_SW_DISPATCH2_PROTOCOL_GUID\0" \
+  "EFI_SMM_SX_DISPATCH2_PROTOCOL_GUID\0" \
+  "EFI_SMM_PERIODIC_TIMER_DISPATCH2_PROTOCOL_GUID\0" \
+  "EFI_SMM_USB_DISPATCH2_PROTOCOL_GUID\0" \
+  "EFI_SMM_GPI_DISPATCH2_PROTOCOL_GUID\0" \
+  "EFI_SMM_STANDBY_BUTTON_DISPATCH2_PROTOCOL_GUID\0" \
+  "EFI_SMM_POWER_BUTTON_DISPATCH2_PROTOCOL_GUID\0" \
+  "EFI_SMM_IO_TRAP_DISPATCH2_PROTOCOL_GUID\0" \
+  "EFI_PCD_PROTOCOL_GUID\0" \
+  "EFI_CPU_IO2_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_REGION2_PROTOCOL_GUID\0" \
+  "EFI_SAL_MCA_INIT_PMI_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_BOOT_SERVICE_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_BASE_IO_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_STALL_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_RTC_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_VARIABLE_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_MTC_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_RESET_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_STATUS_CODE_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_FV_BLOCK_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_MP_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_PAL_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_BASE_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_MCA_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_PCI_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_CACHE_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_MCA_LOG_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_SECURITY2_ARCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_END_OF_DXE_PROTOCOL_GUID\0" \
+  "EFI_ISA_HC_PROTOCOL_GUID\0" \
+  "EFI_ISA_HC_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_SIO_CONTROL_PROTOCOL_GUID\0" \
+  "EFI_GET_PCD_INFO_PROTOCOL_GUID\0" \
+  "EFI_I2C_MASTER_PROTOCOL_GUID\0" \
+  "EFI_I2C_IO_PROTOCOL_GUID\0" \
+  "EFI_I2C_ENUMERATE_PROTOCOL_GUID\0" \
+  "EFI_I2C_HOST_PROTOCOL_GUID\0" \
+  "EFI_I2C_BUS_CONFIGURATION_MANAGEMENT_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_SPI_CONTROLLER_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_SPI_FLASH_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_SPI_SMM_CONTROLLER_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_SPI_SMM_FLASH_PROTOCOL_GUID\0" \
+  "EFI_SPI_CONFIGURATION_PROTOCOL_GUID\0" \
+  "EFI_SPI_HC_PROTOCOL_GUID\0" \
+  "EFI_SPI_NOR_FLASH_PROTOCOL_GUID\0" \
+  "EFI_SPI_SMM_CONFIGURATION_PROTOCOL_GUID\0" \
+  "EFI_SPI_SMM_HC_PROTOCOL_GUID\0" \
+  "EFI_SPI_SMM_NOR_FLASH_PROTOCOL_GUID\0" \
+  "EFI_DEBUG_SUPPORT_PROTOCOL_GUID\0" \
+  "EFI_DECOMPRESS_PROTOCOL_GUID\0" \
+  "EFI_DEVICE_IO_PROTOCOL_GUID\0" \
+  "EFI_DEVICE_PATH_PROTOCOL_GUID\0" \
+  "EFI_DEVICE_PATH_FROM_TEXT_PROTOCOL_GUID\0" \
+  "EFI_DEVICE_PATH_TO_TEXT_PROTOCOL_GUID\0" \
+  "EFI_DEVICE_PATH_UTILITIES_PROTOCOL_GUID\0" \
+  "EFI_DRIVER_BINDING_PROTOCOL_GUID\0" \
+  "EFI_PLATFORM_DRIVER_OVERRIDE_PROTOCOL_GUID\0" \
+  "EFI_DRIVER_FAMILY_OVERRIDE_PROTOCOL_GUID\0" \
+  "EFI_BUS_SPECIFIC_DRIVER_OVERRIDE_PROTOCOL_GUID\0" \
+  "EFI_DRIVER_DIAGNOSTICS2_PROTOCOL_GUID\0" \
+  "EFI_DRIVER_DIAGNOSTICS_PROTOCOL_GUID\0" \
+  "EFI_COMPONENT_NAME2_PROTOCOL_GUID\0" \
+  "EFI_COMPONENT_NAME_PROTOCOL_GUID\0" \
+  "EFI_DRIVER_CONFIGURATION2_PROTOCOL_GUID\0" \
+  "EFI_DRIVER_CONFIGURATION_PROTOCOL_GUID\0" \
+  "EFI_PLATFORM_TO_DRIVER_CONFIGURATION_PROTOCOL_GUID\0" \
+  "EFI_DRIVER_SUPPORTED_EFI_VERSION_PROTOCOL_GUID\0" \
+  "EFI_SIMPLE_TEXT_IN_PROTOCOL_GUID\0" \
+  "EFI_SIMPLE_TEXT_INPUT_EX_PROTOCOL_GUID\0" \
+  "EFI_SIMPLE_TEXT_OUT_PROTOCOL_GUID\0" \
+  "EFI_SIMPLE_POINTER_PROTOCOL_GUID\0" \
+  "EFI_ABSOLUTE_POINTER_PROTOCOL_GUID\0" \
+  "EFI_SERIAL_IO_PROTOCOL_GUID\0" \
+  "EFI_GRAPHICS_OUTPUT_PROTOCOL_GUID\0" \
+  "EFI_EDID_DISCOVERED_PROTOCOL_GUID\0" \
+  "EFI_EDID_ACTIVE_PROTOCOL_GUID\0" \
+  "EFI_EDID_OVERRIDE_PROTOCOL_GUID\0" \
+  "EFI_UGA_IO_PROTOCOL_GUID\0" \
+  "EFI_UGA_DRAW_PROTOCOL_GUID\0" \
+  "EFI_LOADED_IMAGE_PROTOCOL_GUID\0" \
+  "EFI_LOADED_IMAGE_DEVICE_PATH_PROTOCOL_GUID\0" \
+  "EFI_LOAD_FILE_PROTOCOL_GUID\0" \
+  "EFI_LOAD_FILE2_PROTOCOL_GUID\0" \
+  "EFI_TAPE_IO_PROTOCOL_GUID\0" \
+  "EFI_DISK_IO_PROTOCOL_GUID\0" \
+  "EFI_BLOCK_IO_PROTOCOL_GUID\0" \
+  "EFI_UNICODE_COLLATION_PROTOCOL_GUID\0" \
+  "EFI_UNICODE_COLLATION2_PROTOCOL_GUID\0" \
+  "EFI_PCI_ROOT_BRIDGE_IO_PROTOCOL_GUID\0" \
+  "EFI_PCI_IO_PROTOCOL_GUID\0" \
+  "EFI_SCSI_IO_PROTOCOL_GUID\0" \
+  "EFI_EXT_SCSI_PASS_THRU_PROTOCOL_GUID\0" \
+  "EFI_SCSI_PASS_THRU_PROTOCOL_GUID\0" \
+  "EFI_I_SCSI_INITIATOR_NAME_PROTOCOL_GUID\0" \
+  "EFI_USB2_HC_PROTOCOL_GUID\0" \
+  "EFI_USB_HC_PROTOCOL_GUID\0" \
+  "EFI_USB_IO_PROTOCOL_GUID\0" \
+  "EFI_ACPI_TABLE_PROTOCOL_GUID\0" \
+  "EFI_EBC_PROTOCOL_GUID\0" \
+  "EFI_SIMPLE_NETWORK_PROTOCOL_GUID\0" \
+  "EFI_NETWORK_INTERFACE_IDENTIFIER_PROTOCOL_GUID_31\0" \
+  "EFI_NETWORK_INTERFACE_IDENTIFIER_PROTOCOL_GUID\0" \
+  "EFI_PXE_BASE_CODE_CALLBACK_PROTOCOL_GUID\0" \
+  "EFI_PXE_BASE_CODE_PROTOCOL_GUID\0" \
+  "EFI_BIS_PROTOCOL_GUID\0" \
+  "EFI_MANAGED_NETWORK_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_MANAGED_NETWORK_PROTOCOL_GUID\0" \
+  "EFI_ARP_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_ARP_PROTOCOL_GUID\0" \
+  "EFI_DHCP4_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_DHCP4_PROTOCOL_GUID\0" \
+  "EFI_TCP4_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_TCP4_PROTOCOL_GUID\0" \
+  "EFI_IP4_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_IP4_PROTOCOL_GUID\0" \
+  "EFI_IP4_CONFIG_PROTOCOL_GUID\0" \
+  "EFI_UDP4_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_UDP4_PROTOCOL_GUID\0" \
+  "EFI_MTFTP4_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_MTFTP4_PROTOCOL_GUID\0" \
+  "EFI_AUTHENTICATION_INFO_PROTOCOL_GUID\0" \
+  "EFI_HASH_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_HASH_PROTOCOL_GUID\0" \
+  "EFI_TCG_PROTOCOL_GUID\0" \
+  "EFI_TR_E_E_PROTOCOL_GUID\0" \
+  "EFI_TCG2_FINAL_EVENTS_TABLE_GUID\0" \
+  "EFI_FORM_BROWSER2_PROTOCOL_GUID\0" \
+  "EFI_HII_STRING_PROTOCOL_GUID\0" \
+  "EFI_HII_IMAGE_PROTOCOL_GUID\0" \
+  "EFI_HII_CONFIG_ROUTING_PROTOCOL_GUID\0" \
+  "EFI_HII_DATABASE_PROTOCOL_GUID\0" \
+  "EFI_HII_FONT_PROTOCOL_GUID\0" \
+  "EFI_HII_CONFIG_ACCESS_PROTOCOL_GUID\0" \
+  "EFI_HII_PACKAGE_LIST_PROTOCOL_GUID\0" \
+  "EFI_IP6_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_IP6_PROTOCOL_GUID\0" \
+  "EFI_IP6_CONFIG_PROTOCOL_GUID\0" \
+  "EFI_MTFTP6_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_MTFTP6_PROTOCOL_GUID\0" \
+  "EFI_DHCP6_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_DHCP6_PROTOCOL_GUID\0" \
+  "EFI_UDP6_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_UDP6_PROTOCOL_GUID\0" \
+  "EFI_TCP6_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_TCP6_PROTOCOL_GUID\0" \
+  "EFI_VLAN_CONFIG_PROTOCOL_GUID\0" \
+  "EFI_EAP_PROTOCOL_GUID\0" \
+  "EFI_EAP_MANAGEMENT_PROTOCOL_GUID\0" \
+  "EFI_FTP4_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_FTP4_PROTOCOL_GUID\0" \
+  "EFI_IP_SEC_CONFIG_PROTOCOL_GUID\0" \
+  "EFI_DRIVER_HEALTH_PROTOCOL_GUID\0" \
+  "EFI_DEFERRED_IMAGE_LOAD_PROTOCOL_GUID\0" \
+  "EFI_USER_CREDENTIAL_PROTOCOL_GUID\0" \
+  "EFI_USER_MANAGER_PROTOCOL_GUID\0" \
+  "EFI_ATA_PASS_THRU_PROTOCOL_GUID\0" \
+  "EFI_FIRMWARE_MANAGEMENT_PROTOCOL_GUID\0" \
+  "EFI_IP_SEC_PROTOCOL_GUID\0" \
+  "EFI_IP_SEC2_PROTOCOL_GUID\0" \
+  "EFI_KMS_PROTOCOL_GUID\0" \
+  "EFI_BLOCK_IO2_PROTOCOL_GUID\0" \
+  "EFI_STORAGE_SECURITY_COMMAND_PROTOCOL_GUID\0" \
+  "EFI_USER_CREDENTIAL2_PROTOCOL_GUID\0" \
+  "EFI_DISK_IO2_PROTOCOL_GUID\0" \
+  "EFI_TIMESTAMP_PROTOCOL_GUID\0" \
+  "EFI_RNG_PROTOCOL_GUID\0" \
+  "EFI_ADAPTER_INFORMATION_PROTOCOL_GUID\0" \
+  "EFI_NVM_EXPRESS_PASS_THRU_PROTOCOL_GUID\0" \
+  "EFI_HASH2_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_HASH2_PROTOCOL_GUID\0" \
+  "EFI_BLOCK_IO_CRYPTO_PROTOCOL_GUID\0" \
+  "EFI_SMART_CARD_READER_PROTOCOL_GUID\0" \
+  "EFI_SMART_CARD_EDGE_PROTOCOL_GUID\0" \
+  "EFI_USB_FUNCTION_IO_PROTOCOL_GUID\0" \
+  "EFI_BLUETOOTH_HC_PROTOCOL_GUID\0" \
+  "EFI_BLUETOOTH_IO_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_BLUETOOTH_IO_PROTOCOL_GUID\0" \
+  "EFI_BLUETOOTH_CONFIG_PROTOCOL_GUID\0" \
+  "EFI_REGULAR_EXPRESSION_PROTOCOL_GUID\0" \
+  "EFI_BOOT_MANAGER_POLICY_PROTOCOL_GUID\0" \
+  "EFI_CONFIG_KEYWORD_HANDLER_PROTOCOL_GUID\0" \
+  "EFI_WI_FI_PROTOCOL_GUID\0" \
+  "EFI_EAP_MANAGEMENT2_PROTOCOL_GUID\0" \
+  "EFI_EAP_CONFIGURATION_PROTOCOL_GUID\0" \
+  "EFI_PKCS7_VERIFY_PROTOCOL_GUID\0" \
+  "EFI_IP4_CONFIG2_PROTOCOL_GUID\0" \
+  "EFI_DNS4_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_DNS4_PROTOCOL_GUID\0" \
+  "EFI_DNS6_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_DNS6_PROTOCOL_GUID\0" \
+  "EFI_HTTP_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_HTTP_PROTOCOL_GUID\0" \
+  "EFI_HTTP_UTILITIES_PROTOCOL_GUID\0" \
+  "EFI_TLS_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_TLS_PROTOCOL_GUID\0" \
+  "EFI_TLS_CONFIGURATION_PROTOCOL_GUID\0" \
+  "EFI_REST_PROTOCOL_GUID\0" \
+  "EFI_SUPPLICANT_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_SUPPLICANT_PROTOCOL_GUID\0" \
+  "EFI_WI_FI2_PROTOCOL_GUID\0" \
+  "EFI_RAM_DISK_PROTOCOL_GUID\0" \
+  "EFI_HII_IMAGE_DECODER_PROTOCOL_GUID\0" \
+  "EFI_HII_IMAGE_EX_PROTOCOL_GUID\0" \
+  "EFI_SD_MMC_PASS_THRU_PROTOCOL_GUID\0" \
+  "EFI_ERASE_BLOCK_PROTOCOL_GUID\0" \
+  "EFI_BLUETOOTH_ATTRIBUTE_PROTOCOL_GUID\0" \
+  "EFI_BLUETOOTH_ATTRIBUTE_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "EFI_BLUETOOTH_LE_CONFIG_PROTOCOL_GUID\0" \
+  "EFI_UFS_DEVICE_CONFIG_PROTOCOL_GUID\0" \
+  "EFI_HTTP_BOOT_CALLBACK_PROTOCOL_GUID\0" \
+  "EFI_RESET_NOTIFICATION_PROTOCOL_GUID\0" \
+  "EFI_PARTITION_INFO_PROTOCOL_GUID\0" \
+  "EFI_HII_POPUP_PROTOCOL_GUID\0" \
+  "EFI_NVDIMM_LABEL_PROTOCOL_GUID\0" \
+  "EFI_SHELL_PROTOCOL_GUID\0" \
+  "EFI_SHELL_PARAMETERS_PROTOCOL_GUID\0" \
+  "EFI_SHELL_DYNAMIC_COMMAND_PROTOCOL_GUID\0" \
+  "IP6_CONFIG_NV_DATA_GUID\0" \
+  "I_SCSI_CONFIG_GUID\0" \
+  "HTTP_BOOT_CONFIG_GUID\0" \
+  "TLS_AUTH_CONFIG_GUID\0" \
+  "EFI_TLS_CA_CERTIFICATE_GUID\0" \
+  "EFI_WIN_NT_PASS_THROUGH_GUID\0" \
+  "EFI_WIN_NT_CONSOLE_GUID\0" \
+  "EFI_WIN_NT_UGA_GUID\0" \
+  "EFI_WIN_NT_GOP_GUID\0" \
+  "EFI_WIN_NT_SERIAL_PORT_GUID\0" \
+  "EFI_WIN_NT_FILE_SYSTEM_GUID\0" \
+  "EFI_WIN_NT_PHYSICAL_DISKS_GUID\0" \
+  "EFI_WIN_NT_VIRTUAL_DISKS_GUID\0" \
+  "EFI_WIN_NT_SYSTEM_CONFIG_GUID\0" \
+  "WIN_NT_BUS_DRIVER_GUID\0" \
+  "EFI_WIN_NT_THUNK_PROTOCOL_GUID\0" \
+  "EFI_WIN_NT_IO_PROTOCOL_GUID\0" \
+  "EFI_XEN_INFO_GUID\0" \
+  "OVMF_PLATFORM_CONFIG_GUID\0" \
+  "VIRTIO_MMIO_TRANSPORT_GUID\0" \
+  "XEN_BUS_ROOT_DEVICE_GUID\0" \
+  "ROOT_BRIDGES_CONNECTED_EVENT_GROUP_GUID\0" \
+  "VIRTIO_DEVICE_PROTOCOL_GUID\0" \
+  "BLOCK_MMIO_PROTOCOL_GUID\0" \
+  "XEN_BUS_PROTOCOL_GUID\0" \
+  "XEN_IO_PROTOCOL_GUID\0" \
+  "IO_MMU_ABSENT_PROTOCOL_GUID\0" \
+  "EFI_MEMORY_CONFIG_DATA_GUID\0" \
+  "POWER_MANAGEMENT_ACPI_TABLE_STORAGE_GUID\0" \
+  "EFI_QUARK_CAPSULE_GUID\0" \
+  "QUARK_VARIABLE_LOCK_GUID\0" \
+  "EFI_GLOBAL_NVS_AREA_PROTOCOL_GUID\0" \
+  "EFI_SMM_SPI_READY_PROTOCOL_GUID\0" \
+  "EFI_IIO_UDS_PROTOCOL_GUID\0" \
+  "QNC_S3_CODE_IN_LOCK_BOX_GUID\0" \
+  "QNC_S3_CONTEXT_IN_LOCK_BOX_GUID\0" \
+  "EFI_PLATFORM_POLICY_PROTOCOL_GUID\0" \
+  "EFI_SMM_ICHN_DISPATCH2_PROTOCOL_GUID\0" \
+  "EFI_SPI_PROTOCOL_GUID\0" \
+  "EFI_SMM_SPI_PROTOCOL_GUID\0" \
+  "EFI_QNC_S3_SUPPORT_PROTOCOL_GUID\0" \
+  "EFI_S_D_HOST_IO_PROTOCOL_GUID\0" \
+  "EFI_SECURE_BOOT_ENABLE_DISABLE_GUID\0" \
+  "EFI_CUSTOM_MODE_ENABLE_GUID\0" \
+  "EFI_VENDOR_KEYS_NV_GUID\0" \
+  "EFI_CERT_DB_GUID\0" \
+  "TCG_EVENT_ENTRY_HOB_GUID\0" \
+  "TCG_EVENT2_ENTRY_HOB_GUID\0" \
+  "TPM_ERROR_HOB_GUID\0" \
+  "TPM2_STARTUP_LOCALITY_HOB_GUID\0" \
+  "MEASURED_FV_HOB_GUID\0" \
+  "EFI_PHYSICAL_PRESENCE_GUID\0" \
+  "EFI_TCG2_PHYSICAL_PRESENCE_GUID\0" \
+  "PWD_CREDENTIAL_PROVIDER_GUID\0" \
+  "USB_CREDENTIAL_PROVIDER_GUID\0" \
+  "USER_IDENTIFY_MANAGER_GUID\0" \
+  "USER_PROFILE_MANAGER_GUID\0" \
+  "TCG_CONFIG_FORM_SET_GUID\0" \
+  "TCG2_CONFIG_FORM_SET_GUID\0" \
+  "SECURE_BOOT_CONFIG_FORM_SET_GUID\0" \
+  "EFI_TPM_DEVICE_INSTANCE_TPM12_GUID\0" \
+  "EFI_TPM_DEVICE_INSTANCE_TPM20_DTPM_GUID\0" \
+  "EFI_TPM_DEVICE_SELECTED_GUID\0" \
+  "OPAL_EXTRA_INFO_VARIABLE_GUID\0" \
+  "EFI_SHELL_ENVIRONMENT2_EXT_GUID\0" \
+  "SHELL_VARIABLE_GUID\0" \
+  "SHELL_MAP_GUID\0" \
+  "SHELL_ALIAS_GUID\0" \
+  "HANDLE_PARSING_HII_GUID\0" \
+  "SHELL_DEBUG1_HII_GUID\0" \
+  "SHELL_DRIVER1_HII_GUID\0" \
+  "SHELL_INSTALL1_HII_GUID\0" \
+  "SHELL_LEVEL1_HII_GUID\0" \
+  "SHELL_LEVEL2_HII_GUID\0" \
+  "SHELL_LEVEL3_HII_GUID\0" \
+  "SHELL_NETWORK1_HII_GUID\0" \
+  "SHELL_NETWORK2_HII_GUID\0" \
+  "SHELL_TFTP_HII_GUID\0" \
+  "SHELL_BCFG_HII_GUID\0" \
+  "UEFI_SHELL_FILE_GUID\0" \
+  "EFI_SHELL_ENVIRONMENT2_GUID\0" \
+  "EFI_SHELL_INTERFACE_GUID\0" \
+  "EDKII_SYSTEM_FIRMWARE_IMAGE_DESCRIPTOR_FILE_GUID\0" \
+  "EDKII_SYSTEM_FMP_CAPSULE_CONFIG_FILE_GUID\0" \
+  "EDKII_SYSTEM_FMP_CAPSULE_DRIVER_FV_FILE_GUID\0" \
+  "EFI_DEBUG_AGENT_GUID\0" \
+  "EFI_SOCKET_PROTOCOL_GUID\0" \
+  "EFI_SOCKET_SERVICE_BINDING_PROTOCOL_GUID\0" \
+  "MSEG_SMRAM_GUID\0" \
+  "EDKII_CPU_FEATURES_SET_DONE_GUID\0" \
+  "EDKII_CPU_FEATURES_INIT_DONE_GUID\0" \
+  "EFI_SMM_CPU_SERVICE_PROTOCOL_GUID\0" \
+  "EFI_SM_MONITOR_INIT_PROTOCOL_GUID\0" \
+  "PPM_PLATFORM_POLICY_PROTOCOL_GUID\0" \
+  "MEM_INFO_PROTOCOL_GUID\0" \
+  "EFI_SMM_ICHN_DISPATCH_EX_PROTOCOL_GUID\0" \
+  "PCH_RESET_PROTOCOL_GUID\0" \
+  "PCH_RESET_CALLBACK_PROTOCOL_GUID\0" \
+  "DXE_PCH_PLATFORM_POLICY_PROTOCOL_GUID\0" \
+  "EFI_PCH_INFO_PROTOCOL_GUID\0" \
+  "EFI_PCH_EXTENDED_RESET_PROTOCOL_GUID\0" \
+  "EFI_ACTIVE_BIOS_PROTOCOL_GUID\0" \
+  "DXE_ICH_PLATFORM_POLICY_PROTOCOL_GUID\0" \
+  "EFI_SMM_SMBUS_PROTOCOL_GUID\0" \
+  "DXE_VLV_PLATFORM_POLICY_GUID\0" \
+  "IGD_OP_REGION_PROTOCOL_GUID\0" \
+  "EFI_HECI_PROTOCOL_GUID\0" \
+  "PLATFORM_SE_C_HOOK_PROTOCOL_GUID\0" \
+  "EFI_SE_C_RC_INFO_PROTOCOL_GUID\0" \
+  "EFI_TDT_PROTOCOL_GUID\0" \
+  "DXE_PLATFORM_SE_C_POLICY_GUID\0" \
+  "LPSS_DUMMY_PROTOCOL_GUID\0" \
+  "EFI_EMMC_CARD_INFO_PROTOCOL_GUID\0" \
+  "EFI_TDT_OPERATION_PROTOCOL_GUID\0" \
+  "EFI_D_F_U_RESULT_GUID\0" \
+  "PTT_PASS_THRU_PROTOCOL_GUID\0" \
+  "EFI_SMBUS_ARP_MAP_GUID\0" \
+  "SATA_CONTROLLER_DRIVER_GUID\0" \
+  "DXE_PCH_POLICY_UPDATE_PROTOCOL_GUID\0" \
+  "EFI_SETUP_VARIABLE_GUID\0" \
+  "PCH_INIT_VARIABLE_GUID\0" \
+  "SE_C_PLATFORM_READY_TO_BOOT_GUID\0" \
+  "AMT_READY_TO_BOOT_GUID\0" \
+  "EFI_VLV2_VARIABLE_GUID\0" \
+  "EFI_PLATFORM_BOOT_MODE_GUID\0" \
+  "EFI_PLATFORM_INFO_GUID\0" \
+  "EFI_SIO_VARIABLE_GUID\0" \
+  "PROCESSOR_PRODUCER_GUID\0" \
+  "EFI_POWER_ON_HOB_GUID\0" \
+  "EFI_PLATFORM_CPU_INFO_GUID\0" \
+  "EFI_BIOS_ID_GUID\0" \
+  "EFI_BOARD_FEATURES_GUID\0" \
+  "ITK_DATA_VAR_GUID\0" \
+  "DMI_DATA_GUID\0" \
+  "IDCC_DATA_HUB_GUID\0" \
+  "MFG_MODE_VARIABLE_GUID\0" \
+  "EFI_ACPI_TABLE_STORAGE_GUID\0" \
+  "A_C_P_I_O_S_F_R_MFG_STRING_VARIABLE_GUID\0" \
+  "A_C_P_I_O_S_F_R_MODEL_STRING_VARIABLE_GUID\0" \
+  "EFI_PCI_LAN_INFO_GUID\0" \
+  "FIRMWARE_ID_GUID\0" \
+  "OS_SELECTION_VARIABLE_GUID\0" \
+  "EFI_PLATFORM_CPU_PROTOCOL_GUID\0" \
+  "EFI_TPM_MP_DRIVER_PROTOCOL_GUID\0" \
+  "EFI_LPC_WPCE791_POLICY_PROTOCOL_GUID\0" \
+  "USB_POLICY_GUID\0" \
+  "EFI_SPEAKER_INTERFACE_PROTOCOL_GUID\0" \
+  "EFI_SMBIOS_SLOT_POPULATION_GUID\0" \
+  "OBSERVABLE_PROTOCOL_GUID\0" \
+  "EFI_CK505_CLOCK_PLATFORM_INFO_GUID\0" \
+  "EFI_LPC_WPC83627_POLICY_PROTOCOL_GUID\0" \
+  "EFI_TCO_RESET_PROTOCOL_GUID\0" \
+  "EFI_WATCHDOG_TIMER_DRIVER_PROTOCOL_GUID\0" \
+  "EFI_PLATFORM_IDE_INIT_PROTOCOL_GUID\0" \
+  "ENHANCED_SPEEDSTEP_PROTOCOL_GUID\0" \
+  "EFI_GOP_DISPLAY_BRIGHTNESS_PROTOCOL_GUID\0" \
+  "EFI_USB_KEYBOARD_CONNECT_GUID\0" \
+  "EFI_MMIO_DEVICE_PROTOCOL_GUID\0" \
+  "EFI_I2C_ACPI_PROTOCOL_GUID\0" \
+  "EFI_I2C_BUS_PROTOCOL_GUID\0" \
+  "EFI_I2C_SLAVE_PROTOCOL_GUID\0" \
+  "EFI_SPI_ACPI_PROTOCOL_GUID\0" \
+  "EFI_SPI_HOST_PROTOCOL_GUID\0" \
+  "EFI_SPI_BUS_PROTOCOL_GUID\0" \
+  "EFI_GPIO_OPERATION_PROTOCOL_GUID\0" \
+  "EFI_ESRT_OPERATION_PROTOCOL_GUID\0" \
+  "EFI_FIRMWARE_CLASS_GUID\0" \
+  "EFI_D_F_U_VER_GUID\0" \
+  "EFI_CAPSULE_CRASH_LOG_VAR_GUID\0" \
+  "EFI_CAPSULE_CRASH_GUID\0" \
+  "ACOUSTIC_SETUP_PROTOCOL_GUID\0" \
+  "ADD_BOOT_OPTION_GUID\0" \
+  "ADVANCED_FORM_SET_GUID\0" \
+  "AHCI_BUS_INIT_PROTOCOL_GUID\0" \
+  "AHCI_SMM_PROTOCOL_GUID\0" \
+  "AMICSM_PCIBUSNUM_XLAT_PROTOCOL_GUID\0" \
+  "AMITSESETUP_GUID\0" \
+  "AMITSE_ADMIN_PASSWORD_VALID_GUID\0" \
+  "AMITSE_AFTER_FIRST_BOOT_OPTION_GUID\0" \
+  "AMITSE_BOOT_ORDER_CHANGE_GUID\0" \
+  "AMITSE_DRIVER_HEALTH_CTRL_GUID\0" \
+  "AMITSE_DRIVER_HEALTH_ENB_GUID\0" \
+  "AMITSE_DRIVER_HEALTH_GUID\0" \
+  "AMITSE_EVENT_BEFORE_BOOT_GUID\0" \
+  "AMITSE_INVALID_PASSWORD_GUID\0" \
+  "AMITSE_NVRAM_UPDATE_GUID\0" \
+  "AMITSE_PASSWORD_PROMPT_ENTER_GUID\0" \
+  "AMITSE_PASSWORD_PROMPT_EXIT_GUID\0" \
+  "AMITSE_SETUP_ENTER_GUID\0" \
+  "AMITSE_USER_PASSWORD_VALID_GUID\0" \
+  "AMI_APTIO_SIG_OWNER_GUID\0" \
+  "AMI_BBS_DEVICE_PATH_GUID\0" \
+  "AMI_BEFORE_CPU_RC_PROTOCOL_GUID\0" \
+  "AMI_BIOSPPI_FLAGS_MANAGEMENT_GUID\0" \
+  "AMI_BOARD_INFO_PROTOCOL_GUID\0" \
+  "AMI_BOARD_INFO_SECTION_GUID\0" \
+  "AMI_CALLBACK_GUID\0" \
+  "AMI_CAPSULE_HOB_GUID\0" \
+  "AMI_CCID_IO_PROTOCOL_GUID\0" \
+  "AMI_CCID_PRESENCE_GUID\0" \
+  "AMI_CMOS_BAD_FLAG_HOB_GUID\0" \
+  "AMI_CPUID_CKSUM_HOB_GUID\0" \
+  "AMI_CPU_INFO_2_PROTOCOL_GUID\0" \
+  "AMI_CSM_DRIVER_STARTED_GUID\0" \
+  "AMI_CSM_THUNK_PROTOCOL_GUID\0" \
+  "AMI_DDDT_PRESENT_FLAG_HOB_GUID\0" \
+  "AMI_DEBUGGER_CPU_PROTOCOL_GUID\0" \
+  "AMI_DEBUGPORT_HOB_GUID\0" \
+  "AMI_DEVICE_NAME_DEVICE_PATH_GUID\0" \
+  "AMI_DIGITAL_SIGNATURE_PROTOCOL_GUID\0" \
+  "AMI_DIMM_SPD_DATA_HOB_GUID\0" \
+  "AMI_EFIKEYCODE_PROTOCOL_GUID\0" \
+  "AMI_FAST_BOOT_PROTOCOL_GUID\0" \
+  "AMI_FW_RECOVERY_CAPSULE_GUID\0" \
+  "AMI_HECI_SMM_GUID\0" \
+  "AMI_INTERNAL_FACTORY_TDC_TDP_HOB_GUID\0" \
+  "AMI_INTERNAL_UCODE_HOB_GUID\0" \
+  "AMI_INT_SMM_COMM_PROTOCOL_GUID\0" \
+  "AMI_IRQ_DMA_MASK_VARIABLE_GUID\0" \
+  "AMI_ISO9660_MEDIA_GUID\0" \
+  "AMI_LOAD_CSM_GUID\0" \
+  "AMI_MASKED_DEVICE_PATH_GUID\0" \
+  "AMI_MEASURE_PCIOPROM_GUID\0" \
+  "AMI_MEDIA_DEVICE_PATH_GUID\0" \
+  "AMI_MRC_INFO_HOB_GUID\0" \
+  "AMI_NB_MRC_INFO_GUID\0" \
+  "AMI_NVRAM_SPD_MAP_GUID\0" \
+  "AMI_OPROM_POLICY_PROTOCOL_GUID\0" \
+  "AMI_PB_KEY_RSA2048_GUID\0" \
+  "AMI_PCI_BUS_EXT_PROTOCOL_GUID\0" \
+  "AMI_PERF_TUNE_DATA_HOB_GUID\0" \
+  "AMI_PLL_OVER_VOTAGE_FLAG_HOB_GUID\0" \
+  "AMI_POST_MANAGER_PROTOCOL_GUID\0" \
+  "AMI_RECOVERY_IMAGE_HOB_GUID\0" \
+  "AMI_RESET_TYPE_HOB_GUID\0" \
+  "AMI_RESET_TYPE_VARIABLE_GUID\0" \
+  "AMI_ROM_LAYOUT_HOB_GUID\0" \
+  "AMI_SB_SMI_PROTOCOL_GUID\0" \
+  "AMI_SMBIOS_CPU_INFO_PROTOCOL_GUID\0" \
+  "AMI_SMBIOS_MEMORY_INFO_HOB_GUID\0" \
+  "AMI_SMBUS_HOB_GUID\0" \
+  "AMI_SMM_DIGITAL_SIGNATURE_PROTOCOL_GUID\0" \
+  "AMI_SMM_INFO_PROTOCOL_GUID\0" \
+  "AMI_STANDARD_DEFAULTS_VARIABLE_GUID\0" \
+  "AMI_STATUS_CODE_CPU_BIST_DATA_GUID\0" \
+  "AMI_TCG_CONFIRMATION_FLAGS_GUID\0" \
+  "AMI_TCG_EFI_OS_VARIABLE_GUID\0" \
+  "AMI_TCG_PERM_FLAGS_GUID\0" \
+  "AMI_TCG_PLATFORM_PROTOCOL_GUID\0" \
+  "AMI_USB_SMM_PROTOCOL_GUID\0" \
+  "AMT_FORCE_PUSH_PET_HOB_GUID\0" \
+  "AMT_FORCE_PUSH_PET_POLICY_GUID\0" \
+  "AMT_FORCE_PUSH_PET_VARIABLE_GUID\0" \
+  "AMT_INT16_CSM_GUID\0" \
+  "AOAC_FFS_TABLE_STORAGE_GUID\0" \
+  "APTIO_FW_CAPSULE_GUID\0" \
+  "APTIO_HII_PROTOCOL_GUID\0" \
+  "AUTHVAR_MAILBOX_VARIABLE_GUID\0" \
+  "BDS_ALL_DRIVERS_CONNECTED_PROTOCOL_GUID\0" \
+  "BDS_CONNECT_DRIVERS_PROTOCOL_GUID\0" \
+  "BLOCK_DEVICE_RECOVERY_CAPSULE_GUID\0" \
+  "BOOT_FLOW_VARIABLE_GUID\0" \
+  "BOOT_FORM_SET_GUID\0" \
+  "BOOT_MANAGER_GUID\0" \
+  "BOOT_NOW_COUNT_GUID\0" \
+  "CHIPSET_FORM_SET_GUID\0" \
+  "CMOS_MANAGER_HOB_GUID\0" \
+  "CONSOLE_IN_DEVICES_STARTED_PROTOCOL_GUID\0" \
+  "CONSOLE_OUT_DEVICES_STARTED_PROTOCOL_GUID\0" \
+  "CPU_MICROCODE_FILE_GUID\0" \
+  "CPU_WAKE_UP_BUFFER_VARIABLE_GUID\0" \
+  "CSM_VIDEO_POLICY_PROTOCOL_GUID\0" \
+  "DCA_HOB_GUID\0" \
+  "DEBUGGER_TERMINAL_VAR_GUID\0" \
+  "DEFINE_GUID_CRBDXEBin_GUID\0" \
+  "DEFINE_GUID_CRBSMIBin_GUID\0" \
+  "DEFINE_GUID_AcpiPlatformPeiBin_GUID\0" \
+  "DEFINE_GUID_OEMPEIBin_GUID\0" \
+  "DEFINE_GUID_SBDXEBin_GUID\0" \
+  "DEFINE_GUID_OEMDXEBin_GUID\0" \
+  "DEFINE_GUID_SBPEIBin_GUID\0" \
+  "DEFINE_GUID_CRBPEIBin_GUID\0" \
+  "DEFINE_GUID_AcpiPlatformSmiBin_GUID\0" \
+  "DEFINE_GUID_NBPEIBin_GUID\0" \
+  "DEFINE_GUID_NBDXEBin_GUID\0" \
+  "DEFINE_GUID_SBRunBin_GUID\0" \
+  "DEL_BOOT_OPTION_GUID\0" \
+  "DIMM_TS_INFO_GUID\0" \
+  "DXE_CPU_CACHE_PROTOCOL_GUID\0" \
+  "DXE_CPU_INFO_PROTOCOL_GUID\0" \
+  "DXE_ENHANCED_SPEEDSTEP_PROTOCOL_GUID\0" \
+  "DXE_PLATFORM_AMT_POLICY_GUID\0" \
+  "DXE_PLATFORM_SA_POLICY_GUID\0" \
+  "DXE_PLATFORM_SG_POLICY_GUID\0" \
+  "DXE_PLATFORM_TDT_POLICY_GUID\0" \
+  "DXE_TXT_POLICY_PROTOCOL_GUID\0" \
+  "DYNAMIC_PAGE_COUNT_GUID\0" \
+  "EFI_ACTIVE_MANAGEMENT_PROTOCOL_GUID\0" \
+  "EFI_AHCI_INT13_INIT_PROTOCOL_GUID\0" \
+  "EFI_ALERT_STANDARD_FORMAT_PROTOCOL_GUID\0" \
+  "EFI_ALTERNATE_FV_BLOCK_GUID\0" \
+  "EFI_AMI_LEGACYBOOT_PROTOCOL_GUID\0" \
+  "EFI_AUTHORIZATION_PROTOCOL_GUID\0" \
+  "EFI_BDAT_ACCESS_GUID\0" \
+  "EFI_CAPSULE_AMI_GUID\0" \
+  "EFI_CAPSULE_INFO_GUID\0" \
+  "EFI_CLP_PROTOCOL_GUID\0" \
+  "EFI_CMOS_DATA_HOB_INSTALLED_GUID\0" \
+  "EFI_COMPATIBLE_MEMORY_TESTED_PROTOCOL_GUID\0" \
+  "EFI_CONSOLE_LOCK_GUID\0" \
+  "EFI_CPU_TYPE_FRU_GUID\0" \
+  "EFI_CUSTOMIZED_DECOMPRESS_PROTOCOL_GUID\0" \
+  "EFI_DEBUG_ASSERT_PROTOCOL_GUID\0" \
+  "EFI_DMI_FORMAT_FRU_GUID\0" \
+  "EFI_DXE_CMOS_ACCESS_GUID\0" \
+  "EFI_EMUL6064KBDINPUT_PROTOCOL_GUID\0" \
+  "EFI_EMUL6064MSINPUT_PROTOCOL_GUID\0" \
+  "EFI_EMUL6064TRAP_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_ELOG_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_LOCK_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_SENSOR_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_SM_COM_LAYER_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_EXTENDED_SAL_SST_GUID\0" \
+  "EFI_EXTENDED_SAL_VIRTUAL_SERVICES_PROTOCOL_GUID\0" \
+  "EFI_FIRMWARE_VOLUME_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_FRAMEWORK_DEVICE_PATH_GUID\0" \
+  "EFI_FTW_LITE_PROTOCOL_GUID\0" \
+  "EFI_FVB_EXTENSION_PROTOCOL_GUID\0" \
+  "EFI_GPIO_PROTOCOL_GUID\0" \
+  "EFI_GUID\0" \
+  "EFI_HII_EXT_PROTOCOL_GUID\0" \
+  "EFI_HII_FRONT_PAGE_CLASS_GUID\0" \
+  "EFI_HII_OLD_PROTOCOL_GUID\0" \
+  "EFI_HOT_KEYS_PROTOCOL_GUID\0" \
+  "EFI_HT_BIST_HOB_GUID\0" \
+  "EFI_IDER_CONTROLLER_DRIVER_PROTOCOL_GUID\0" \
+  "EFI_INTEL_MFG_FORMAT_FRU_GUID\0" \
+  "EFI_IOBASE_HOB_GUID\0" \
+  "EFI_IP_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_BIOS_EXT_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_BIOS_THUNK_PROTOCOL_GUID\0" \
+  "EFI_LEGACY_SREDIR_PROTOCOL_GUID\0" \
+  "EFI_LIGHT_ISA_IO_PROTOCOL_GUID\0" \
+  "EFI_MEMORY_PRODUCER_GUID\0" \
+  "EFI_MEMORY_SUBCLASS_DRIVER_GUID\0" \
+  "EFI_MEMORY_TYPE_FRU_GUID\0" \
+  "EFI_ME_BIOS_EXTENSION_SETUP_GUID\0" \
+  "EFI_ME_FW_SKU_VARIABLE_GUID\0" \
+  "EFI_MINI_SHELL_FILE_GUID\0" \
+  "EFI_MISC_PRODUCER_GUID\0" \
+  "EFI_MISC_SUBCLASS_DRIVER_GUID\0" \
+  "EFI_NB_ERROR_LOG_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_NB_MRC_INFO_GUID\0" \
+  "EFI_NIC_IP4_CONFIG_PROTOCOL_GUID\0" \
+  "EFI_NIC_IP4_CONFIG_VARIABLE_GUID\0" \
+  "EFI_NONSMMEMUL6064TRAP_PROTOCOL_GUID\0" \
+  "EFI_PATH_FILE_NAME_GUID\0" \
+  "EFI_PCCARD_CS_PROTOCOL_GUID\0" \
+  "EFI_PCCARD_SS_PROTOCOL_GUID\0" \
+  "EFI_PCH_S3_IMAGE_GUID\0" \
+  "EFI_PCI_HOTPLUG_DEVICE_GUID\0" \
+  "EFI_PCMCIA_REQUEST_PROTOCOL_GUID\0" \
+  "EFI_PERFORMANCE_PROTOCOL_GUID\0" \
+  "EFI_PLATFORM_INFO_PROTOCOL_GUID\0" \
+  "EFI_PLATFORM_MEMTEST_PROTOCOL_GUID\0" \
+  "EFI_PPM_GLOBAL_NVS_AREA_PROTOCOL_GUID\0" \
+  "EFI_PPM_INFO_PROTOCOL_GUID\0" \
+  "EFI_PRIMARY_CONSOLE_IN_DEVICE_GUID\0" \
+  "EFI_PRIMARY_CONSOLE_OUT_DEVICE_GUID\0" \
+  "EFI_PRIMARY_STANDARD_ERROR_DEVICE_GUID\0" \
+  "EFI_PXE_DHCP4_CALLBACK_PROTOCOL_GUID\0" \
+  "EFI_PXE_DHCP4_PROTOCOL_GUID\0" \
+  "EFI_SA_INFO_PROTOCOL_GUID\0" \
+  "EFI_SB_PCIE_ERROR_LOG_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SERIAL_GPIO_PROTOCOL_GUID\0" \
+  "EFI_SHELL_FILE_GUID\0" \
+  "EFI_SIMPLE_AUDIO_OUT_PROTOCOL_GUID\0" \
+  "EFI_SMBIOS_BOARD_PROTOCOL_GUID\0" \
+  "EFI_SMBIOS_DYNAMIC_DATA_GUID\0" \
+  "EFI_SMBIOS_NVRAM_DATA_GUID\0" \
+  "EFI_SMBIOS_STATIC_DATA_GUID\0" \
+  "EFI_SMM_BIOS_WRITE_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_CMOS_ACCESS_GUID\0" \
+  "EFI_SMM_IO_TRAP_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_RC_TO_APTIO_BRIDGE_GUID\0" \
+  "EFI_SMM_RUNTIME_PROTOCOL_GUID\0" \
+  "EFI_SMM_RUNTIME_SERVICES_TABLE_GUID\0" \
+  "EFI_SMM_TCO_DISPATCH_PROTOCOL_GUID\0" \
+  "EFI_SMM_THUNK_PROTOCOL_GUID\0" \
+  "EFI_SMRAM_NVS_HEADER_GUID\0" \
+  "EFI_SMTP_PROTOCOL_GUID\0" \
+  "EFI_STANDARD_CALLER_ID_GUID\0" \
+  "EFI_STATUS_CODE_ARCH_PROTOCOL_GUID\0" \
+  "EFI_STATUS_CODE_DATA_TYPE_ASSERT_GUID\0" \
+  "EFI_STATUS_CODE_DATA_TYPE_ERROR_GUID\0" \
+  "EFI_STATUS_CODE_DATA_TYPE_EXCEPTION_HANDLER_GUID\0" \
+  "EFI_STATUS_CODE_DATA_TYPE_PROGRESS_CODE_GUID\0" \
+  "EFI_SYSTEM_NV_DATA_HOB_GUID\0" \
+  "EFI_SYSTEM_TYPE_FRU_GUID\0" \
+  "EFI_TCG_LOG_HOB_GUID\0" \
+  "EFI_TCG_PLATFORM_PROTOCOL_GUID\0" \
+  "EFI_TCG_WAKE_EVENT_DATA_HOB_GUID\0" \
+  "EFI_TCP_PROTOCOL_GUID\0" \
+  "EFI_TCP_SOCK_PROTOCOL_GUID\0" \
+  "EFI_TELNET_SERVER_PROTOCOL_GUID\0" \
+  "EFI_TIANO_DECOMPRESS_PROTOCOL_GUID\0" \
+  "EFI_TIME_VARIABLE_GUID\0" \
+  "EFI_TPM_STATE_INIT_HUB_GUID\0" \
+  "EFI_TXT_INFO_PROTOCOL_GUID\0" \
+  "EFI_UDP_PROTOCOL_GUID\0" \
+  "EFI_UGA_SPLASH_PROTOCOL_GUID\0" \
+  "EFI_USB_ATAPI_PROTOCOL_GUID\0" \
+  "EFI_USB_POLICY_PROTOCOL_GUID\0" \
+  "EFI_USB_PROTOCOL_GUID\0" \
+  "EFI_VARIABLE_STORE_PROTOCOL_GUID\0" \
+  "EFI_VIRTUAL_MEMORY_ACCESS_PROTOCOL_GUID\0" \
+  "ERROR_MANAGER_GUID\0" \
+  "EXIT_FORM_SET_GUID\0" \
+  "FAST_BOOT_TSE_PROTOCOL_GUID\0" \
+  "FAST_BOOT_VARIABLE_GUID\0" \
+  "FID_FFS_SECTION_GUID\0" \
+  "FID_TABLE_GUID\0" \
+  "FIRMWARE_PERFORMANCE_PROTOCOL_GUID\0" \
+  "FLASH_PROTOCOL_GUID\0" \
+  "FLASH_SMM_PROTOCOL_GUID\0" \
+  "FLASH_UPDATE_GUID\0" \
+  "FONT_FFS_FILE_GUID\0" \
+  "FPDT_PERFORMANCE_PROTOCOL_GUID\0" \
+  "FW_VERSION_GUID\0" \
+  "HDD_SECURITY_END_PROTOCOL_GUID\0" \
+  "HDD_SECURITY_INIT_PROTOCOL_GUID\0" \
+  "HDD_SMART_INIT_PROTOCOL_GUID\0" \
+  "HDD_UNLOCKED_GUID\0" \
+  "HII_RESOURCES_FFS_SECTION_GUID\0" \
+  "HOT_PLUG_DEVICE_GUID\0" \
+  "ICC_OVERCLOCKING_PROTOCOL_GUID\0" \
+  "ICC_PERSISTENT_DATA_GUID\0" \
+  "ICC_VOLATILE_SETUP_DATA_GUID\0" \
+  "IDE_BUS_DRIVER_BINDING_PROTOCOL_GUID\0" \
+  "IDE_BUS_INIT_PROTOCOL_GUID\0" \
+  "IDE_CONTROLLER_PROTOCOL_GUID\0" \
+  "IDE_HPA_INTERFACE_GUID\0" \
+  "IDE_POWER_MGMT_INTERFACE_GUID\0" \
+  "IDE_SECURITY_INTERFACE_GUID\0" \
+  "IDE_SECURITY_PWNV_GUID\0" \
+  "IDE_SETUP_PROTOCOL_GUID\0" \
+  "IDE_SMART_INTERFACE_GUID\0" \
+  "IFFS_ACPI_TABLE_STORAGE_GUID\0" \
+  "IFFS_GLOBAL_NVS_AREA_PROTOCOL_GUID\0" \
+  "IFFS_GPT_GUID\0" \
+  "IFFS_INFO_PROTOCOL_GUID\0" \
+  "IFFS_PARTITION_STATUS_PROTOCOL_GUID\0" \
+  "IFFS_PERSISTENT_DATA_GUID\0" \
+  "IFFS_PLATFORM_POLICY_PROTOCOL_GUID\0" \
+  "INTEL_MEBX_PROTOCOL_GUID\0" \
+  "MAIN_FORM_SET_GUID\0" \
+  "MDES_STATUS_CODE_PROTOCOL_GUID\0" \
+  "MEBX_FILE_GUID\0" \
+  "MEUD_ERROR_GUID\0" \
+  "MEUD_FILE_GUID\0" \
+  "ME_ALERT_AT_HANDLER_GUID\0" \
+  "ME_BIOS_PAYLOAD_DATA_PROTOCOL_GUID\0" \
+  "ME_INFO_SETUP_GUID\0" \
+  "ME_PLATFORM_GET_RESET_TYPE_GUID\0" \
+  "MXM3_EFI_GUID\0" \
+  "MXMOEM1_GUID\0" \
+  "NBCI_EFI_GUID\0" \
+  "NETWORK_STACK_GUID\0" \
+  "NVRAM_HOB_GUID\0" \
+  "NVRAM_MAILBOX_ADDRESS_VARIABLE_GUID\0" \
+  "OEM_RECOVERY_CAPSULE_GUID\0" \
+  "OEM_ROM_HOLE_0_GUID\0" \
+  "OEM_ROM_HOLE_1_GUID\0" \
+  "OEM_TSE_VAR_GUID\0" \
+  "ONBOARD_RAID_GUID\0" \
+  "OPAL_SEC_INIT_PROTOCOL_GUID\0" \
+  "OPROM_START_END_PROTOCOL_GUID\0" \
+  "PARTITION_VARIABLE_GUID\0" \
+  "PASSWORD_HOB_GUID\0" \
+  "PCH_EFI_RAID_DRIVER_EXECUTION_GUID\0" \
+  "PERF_TUNE_PROTOCOL_GUID\0" \
+  "PERF_TUNE_WDT_PROTOCOL_GUID\0" \
+  "PKPUB_KEY_GUID\0" \
+  "PK_PUB_FFS_FILE_EFI_AUTH_VAR_GUID\0" \
+  "PLATFORM_IDE_PROTOCOL_GUID\0" \
+  "PPM_PROCESSOR_SUPPORT_PROTOCOL_3_GUID\0" \
+  "PR_KEY_FFS_FILE_RAW_GUID\0" \
+  "PR_KEY_GUID\0" \
+  "PTID_FFS_TABLE_STORAGE_GUID\0" \
+  "RECOVERY_FORM_SET_GUID\0" \
+  "ROM_IMAGE_ADDRESS_GUID\0" \
+  "ROM_IMAGE_MEMORY_HOB_GUID\0" \
+  "ROM_LAYOUT_FFS_GUID\0" \
+  "ROM_LAYOUT_SECTION_GUID\0" \
+  "RSDP_PLUS_PROTOCOL_GUID\0" \
+  "SATA_CONTROLLER_PROTOCOL_GUID\0" \
+  "SA_PEG_DATA_HOB_GUID\0" \
+  "SA_PEG_DATA_VARIABLE_GUID\0" \
+  "SECURITY_FORM_SET_GUID\0" \
+  "SERIAL_RECOVERY_CAPSULE_GUID\0" \
+  "SETUP_DEFAULTS_FFS_GUID\0" \
+  "SGOEM_ACPI_SSDT_GUID\0" \
+  "SGTPV_ACPI_SSDT_GUID\0" \
+  "SG_ACPI_TABLE_STORAGE_GUID\0" \
+  "SG_INFO_HOB_GUID\0" \
+  "SIO_DEV_STATUS_VAR_GUID\0" \
+  "SIO_IO_PROTOCOL_GUID\0" \
+  "SMM_CHILD_DISPATCHER2_GUID\0" \
+  "SMRAM_CPU_DATA_HEADER_GUID\0" \
+  "SMRAM_CPU_DATA_VARIABLE_GUID\0" \
+  "SM_BUS_CONTROLLER_IDENTIFIER_GUID\0" \
+  "SYSTEM_ACCESS_GUID\0" \
+  "TCG_LOCK_DOWN_VAR_GUID\0" \
+  "TCG_PLATFORM_SETUP_POLICY_GUID\0" \
+  "TDTHI_PROTOCOL_FIXED_GUID\0" \
+  "TDTHI_PROTOCOL_GUID\0" \
+  "TDT_VOLATILE_SETUP_DATA_GUID\0" \
+  "TPM_BOOT_FLOW_VARIABLE_GUID\0" \
+  "TXT_INFO_HOB_GUID\0" \
+  "TXT_ONE_TOUCH_GUID\0" \
+  "TXT_ONE_TOUCH_OP_PROTOCOL_GUID\0" \
+  "USB_TIMING_POLICY_PROTOCOL_GUID\0" \
+  "USER_DEFAULTS_GUID\0" \
+  "WDT_APP_PROTOCOL_GUID\0" \
+  "WDT_HOB_GUID\0" \
+  "WDT_PERSISTENT_DATA_GUID\0" \
+  "WDT_PROTOCOL_GUID\0" \
+  "ASROCK_ACPIS4_DXE_GUID\0" \
+  "ASROCK_USBRT_GUID\0" \
+  "ASROCK_RAID_SETUP_GUID\0" \
+  "ASROCK_RAID_LOADER_GUID\0" \
+  "ASROCK_SIOSLPSMI_GUID\0" \
+  "ASROCK_PLEDDXE_GUID\0" \
+  "ASROCK_A_DEFAULT_DXE_GUID\0" \
+  "ASROCK_USER_DEF_SETUP_DXE_GUID\0" \
+  "ASROCK_WAKEUP_CTRL_SMM_GUID\0" \
+  "ASROCK_AMI_AGESA_DXE_GUID\0" \
+  "ASROCK_HDD_READY_SMI_GUID\0" \
+  "ASROCK_MOUSE_DRIVER_GUID\0" \
+  "ASROCK_IDESMM_GUID\0" \
+  "ASROCK_BFGSMI_GUID\0" \
+  "ASROCK_ASRLOGODXE_GUID\0" \
+  "ASROCK_ASM104_X_DXE_GUID\0" \
+  "ASROCK_HDAUDIO_SMI_GUID\0" \
+  "ASROCK_SM_BUS_DXE_GUID\0" \
+  "ASROCK_USBINT13_GUID\0" \
+  "ASROCK_SLP_SUPPORT_GUID\0" \
+  "ASROCK_PATA_CONTROLLER_GUID\0" \
+  "ASROCK_SATA_CONTROLLER_GUID\0" \
+  "ASROCK_ACPIS4_SMM_GUID\0" \
+  "ASROCK_POST_REPORT_GUID\0" \
+  "ASROCK_CLOCK_GEN_DXE_GUID\0" \
+  "ASROCK_UHCD_GUID\0" \
+  "ASROCK_LEGACY_REGION_GUID\0" \
+  "ASROCK_SLEEP_SMI_GUID\0" \
+  "ASROCK_CMOS_MANAGER_SMM_GUID\0" \
+  "ASROCK_AMD_AGESA_DXE_DRIVER_GUID\0" \
+  "ASROCK_RE_FLASH_GUID\0" \
+  "ASROCK_LEGACY_INTERRUPT_GUID\0" \
+  "ASROCK_SMM_CHILD_DISPATCHER_GUID\0" \
+  "ASROCK_BFGDXE_GUID\0" \
+  "ASROCK_IFLASHSETUP_GUID\0" \
+  "ASROCK_S4_SLEEPDELAY_GUID\0" \
+  "ASROCK_HDD_READY_DXE_GUID\0" \
+  "ASROCK_RTLANDXE_GUID\0" \
+  "ASROCK_AMD_SB900_DXE_GUID\0" \
+  "ASROCK_SB900_SMBUS_LIGHT_GUID\0" \
+  "ASROCK_AAFTBL_SMI_GUID\0" \
+  "ASROCK_NVRAMID_GUID\0" \
+  "ASROCK_IDE_SECURITY_GUID\0" \
+  "ASROCK_ASM1061_DXE_GUID\0" \
+  "ASROCK_ASM104_X_SMI_GUID\0" \
+  "ASROCK_RTLANSMI_GUID\0" \
+  "ASROCK_GEC_UPDATE_SMI_GUID\0" \
+  "ASROCK_APMOFF_GUID\0" \
+  "ASROCK_SMIFLASH_GUID\0" \
+  "ASROCK_RAID_X64_GUID\0" \
+  "ASROCK_AMD_SB900_SMM_GUID\0" \
+  "ASROCK_FIREWIRE_GUID\0" \
+  "ASROCK_IDE_SMART_GUID\0" \
+  "ASROCK_SB_INTERFACE_DXE_GUID\0" \
+  "ASROCK_AMD_SB900_SMM_DISPATCHER_GUID\0" \
+  "ASROCK_AMDCPU_DXE_GUID\0" \
+  "ASROCK_SMBIOS_DMIEDIT_GUID\0" \
+  "ASROCK_SECURITY_SELECT_DXE_GUID\0" \
+  "ASROCK_FILE_EXPLORER_LITE_GUID\0" \
+  "ASROCK_PLEDSMM_GUID\0" \
+  "ASROCK_CPU_SMBIOS_DRIVER_GUID\0" \
+  "ASROCK_AAFTBL_DXE_GUID\0" \
+  "DELL_COMPUTRACE_BINARY_GUID\0" \
+  "DELL_MEBX_SETUP_BINARY_GUID\0" \
+  "DELL_ERROR_LOG_CONFIG_GUID\0" \
+  "DELL_FP_THUNK_GUID\0" \
+  "DELL_INTEL_LOM_SMM_GUID\0" \
+  "DELL_LEGACY_VIDEO_ROM_GUID\0" \
+  "DELL_PCH_S3_SUPPORT_GUID\0" \
+  "DELL_SPI_PART_MICRON_GUID\0" \
+  "DELL_DCP_REGISTER_GUID\0" \
+  "DELL_AHCI_DXE_GUID\0" \
+  "DELL_SIMPLE_BOOT_FLAG_SRC_GUID\0" \
+  "DELL_EDIAGS_DXE_GUID\0" \
+  "DELL_ACPI_OEM_CONFIG_GUID\0" \
+  "DELL_SPI_PART_MXIC_GUID\0" \
+  "DELL_DTWLAN_SMM_GUID\0" \
+  "DELL_LEGACY16_ROM_GUID\0" \
+  "DELL_DEVICE_NAME_CONFIG_GUID\0" \
+  "DELL_AI13_ROM_GUID\0" \
+  "DELL_JPEG_DECODER_GUID\0" \
+  "DELL_DA_HDD_PROTECTION_GUID\0" \
+  "DELL_DCCS_SMM_DRIVER_GUID\0" \
+  "DELL_INTRUSION_DETECT_SMM_GUID\0" \
+  "DELL_VIRT_RTC_SMM_GUID\0" \
+  "DELL_SMM_HWM_DRIVER_GUID\0" \
+  "DELL_SM_BIOS_STRUC_DB_GUID\0" \
+  "DELL_CENTURY_ROLLOVER_SMM_GUID\0" \
+  "DELL_SMM_SECURITY_VAULT_GUID\0" \
+  "DELL_DXE_SW_SMI_GUID\0" \
+  "DELL_SMM_SB_ACPI_GUID\0" \
+  "DELL_SMM_ACCESS_GUID\0" \
+  "DELL_MFG_MODE_SMM_DRIVER_GUID\0" \
+  "DELL_SPI_PART_ATMEL_GUID\0" \
+  "DELL_EDIAGS_CONFIG_GUID\0" \
+  "DELL_VARIABLE_SMM_GUID\0" \
+  "DELL_SMM_GPIO_POLICY_GUID\0" \
+  "DELL_ACPI_GUID\0" \
+  "DELL_RUNTIME_ACPI_DXE_GUID\0" \
+  "DELL_SERVICE_MENU_GUID\0" \
+  "DELL_MONOTONIC_COUNTER_GUID\0" \
+  "DELL_CSM_OEM_ROM_GUID\0" \
+  "DELL_DIAGS_SB_CONTROL_SMM_GUID\0" \
+  "DELL_AMT_PLATFORM_POLICY_GUID\0" \
+  "DELL_MFG_AUTHENTICATION_GUID\0" \
+  "DELL_SM_BIOS_STRUC_DA_GUID\0" \
+  "DELL_DXE_COMPUTRACE_GUID\0" \
+  "DELL_SMM_STATUS_CODE_GUID\0" \
+  "DELL_POWER_BUTTON_CONFIG_GUID\0" \
+  "DELL_REBOOT_DXE_GUID\0" \
+  "DELL_FLASH_IO_DXE_GUID\0" \
+  "DELL_SM_BIOS_STRUC_B1_GUID\0" \
+  "DELL_IO_TRAP_GUID\0" \
+  "DELL_SM_BIOS_DXE_DRIVER_GUID\0" \
+  "DELL_UPDATE_MEMORY_RECORD_GUID\0" \
+  "DELL_BIOS_BLK_IO_SRC_GUID\0" \
+  "DELL_ACPIS3_SAVE_GUID\0" \
+  "DELL_SB_SERVICES_SMM_GUID\0" \
+  "DELL_SYSTEM_ID_CONFIG_DXE_GUID\0" \
+  "DELL_OROM_KB_ACCESS_GUID\0" \
+  "DELL_SMSC5544_DXE_GUID\0" \
+  "DELL_AMT_PET_ALERT_GUID\0" \
+  "DELL_CSM_VIDEO_GUID\0" \
+  "DELL_BINDINGS_SMM_GUID\0" \
+  "DELL_EDIAGS_SMM_GUID\0" \
+  "DELL_PBA_UPEK_DPBA_GUID\0" \
+  "DELL_PPM_POLICY_INIT_DXE_GUID\0" \
+  "DELL_GENERIC_SIO_DXE_GUID\0" \
+  "DELL_SM_BIOS_SMM_DA_CI_GUID\0" \
+  "DELL_USB_MOUSE_GUID\0" \
+  "DELL_DXE_GPIO_POLICY_GUID\0" \
+  "DELL_GSET_GUID\0" \
+  "DELL_UHCI_GUID\0" \
+  "DELL_SPI_PART_PROM_JET_GUID\0" \
+  "DELL_PCI_HOT_PLUG_GUID\0" \
+  "DELL_SMB_PROTOCOL_ACCESS_GUID\0" \
+  "DELL_ALERT_STANDARD_FORMAT_DXE_GUID\0" \
+  "DELL_LEG_USB_MEM_SMM_GUID\0" \
+  "DELL_ERROR_HANDLER_SMM_GUID\0" \
+  "DELL_DEFAULT_BOOT_LIST_SMM_GUID\0" \
+  "DELL_TPMDXE_GUID\0" \
+  "DELL_OEM_SX_SMM_GUID\0" \
+  "DELL_AC_LOSS_SMM_GUID\0" \
+  "DELL_DIAGS_SB_CONTROL_DXE_GUID\0" \
+  "DELL_SMM_LEGACY_REGION_GUID\0" \
+  "DELL_PS2_EMUL_GUID\0" \
+  "DELL_MEMORY_S4_GUID\0" \
+  "DELL_SB_SERVICES_DXE_GUID\0" \
+  "DELL_STOP_SHIP_CONFIG_GUID\0" \
+  "DELL_BLOCK_IO_GUID\0" \
+  "DELL_PCI_BUS_GUID\0" \
+  "DELL_TX_TDXE_GUID\0" \
+  "DELL_SM_BIOS_STRUC_D3_GUID\0" \
+  "DELL_SMB_BOOT_PRIORITY_GUID\0" \
+  "DELL_SPI_CONTROLLER_SMM_GUID\0" \
+  "DELL_ME_PCI_PLATFORM_CONFIG_DXE_GUID\0" \
+  "DELL_PBA_UPEK_DXE_GUID\0" \
+  "DELL_GPE_CONFIG_GUID\0" \
+  "DELL_POWER_OFF_SMM_GUID\0" \
+  "DELL_GPE_GUID\0" \
+  "DELL_PASSWORD_MGR_SMM_GUID\0" \
+  "DELL_SMM_SB_GPIO_CONTROL_GUID\0" \
+  "DELL_RAID_ROM_GUID\0" \
+  "DELL_SMM_DISPATCHER_GUID\0" \
+  "DELL_DXE_SIO_GPIO_CONTROL_GUID\0" \
+  "DELL_VARIABLE_DXE_GUID\0" \
+  "DELL_CPU_SMM_GUID\0" \
+  "DELL_CHASSIS_CONFIG_SMM_GUID\0" \
+  "DELL_SMM_DELAY_GUID\0" \
+  "DELL_SPI_PART_EON_GUID\0" \
+  "DELL_CHASSIS_CONFIG_DXE_GUID\0" \
+  "DELL_HIIPARSER_DXE_DRIVER_GUID\0" \
+  "DELL_BINDINGS_DXE_GUID\0" \
+  "DELL_HECI_DXE_GUID\0" \
+  "DELL_SMM_BBSMANAGER_LEGACY_GUID\0" \
+  "DELL_GRASSLAKE_CONFIG_GUID\0" \
+  "DELL_IDE_SMM_GUID\0" \
+  "DELL_PASSWORD_MGR_DXE_GUID\0" \
+  "DELL_ME_FW_DOWNGRADE_GUID\0" \
+  "DELL_CSM_CONFIG_GUID\0" \
+  "DELL_GPE_OROM_GUID\0" \
+  "DELL_SM_BIOS_SMM_DRIVER_GUID\0" \
+  "DELL_PCH_SMBUS_SMM_GUID\0" \
+  "DELL_DASH_BIOS_MANAGER_GUID\0" \
+  "DELL_WDT_DXE_GUID\0" \
+  "DELL_CORE_DXE_GUID\0" \
+  "DELL_PASSWORD_UI_GUID\0" \
+  "DELL_HOT_SOS_SMM_DRIVER_GUID\0" \
+  "DELL_SIO_CONFIG_DXE_GUID\0" \
+  "DELL_TCG_DXE_GUID\0" \
+  "DELL_ACPI_CONFIG_GUID\0" \
+  "DELL_FLASH_SCREEN_DXE_GUID\0" \
+  "DELL_TXT_DXE_GUID\0" \
+  "DELL_DIAGS_DXE_DRIVER_GUID\0" \
+  "DELL_FLASH_UPDATE_DXE_GUID\0" \
+  "DELL_SMM_GPE_GUID\0" \
+  "DELL_RTC_AUTO_ON_SMM_GUID\0" \
+  "DELL_SMM_FLASH_WRITE_PROTECT_GUID\0" \
+  "DELL_DIAGS_CONFIG_GUID\0" \
+  "DELL_AUDIO_CONFIG_DXE_GUID\0" \
+  "DELL_SPECIAL_BOOT_STUB_GUID\0" \
+  "DELL_DA_SERVICE_TAG_GUID\0" \
+  "DELL_DXE_SB_ACPI_GUID\0" \
+  "DELL_MONOTONIC_COUNTER_SMM_GUID\0" \
+  "DELL_SMM_SB_GENERIC_GUID\0" \
+  "DELL_ACPI_MODE_ENABLE_GUID\0" \
+  "DELL_SMM_SIO_EMI_GUID\0" \
+  "DELL_PSTATE_CONTROL_GUID\0" \
+  "DELL_DA_EPPID_GUID\0" \
+  "DELL_PROGRESS_BAR_GUID\0" \
+  "DELL_PBA_MGR_SMM_GUID\0" \
+  "DELL_AMT_SETUP_GUID\0" \
+  "DELL_STORAGE_AGENTS_DXE_GUID\0" \
+  "DELL_VARIABLE_RUNTIME_DXE_GUID\0" \
+  "DELL_PBA_SCARD_DXE_GUID\0" \
+  "DELL_SOL_POST_MESSAGE_GUID\0" \
+  "DELL_TERMINAL_GUID\0" \
+  "DELL_SM_BIOS_STRUC_D0_GUID\0" \
+  "DELL_SMM_RUNTIME_GUID\0" \
+  "DELL_FLASH_IO_SMM_GUID\0" \
+  "DELL_SYSTEM_PW_SMM_GUID\0" \
+  "DELL_PCI_ROOT_BRIDGE_GUID\0" \
+  "DELL_POWER_OFF_CONFIG_GUID\0" \
+  "DELL_DXE_HWM_DRIVER_GUID\0" \
+  "DELL_PXE_UNDI_ROM_GUID\0" \
+  "DELL_PW_BY_PASS_SMM_GUID\0" \
+  "DELL_HOT_KEY_HANDLER_SMM_GUID\0" \
+  "DELL_POWER_MANAGEMENT_DXE_GUID\0" \
+  "DELL_AC_RECOVERY_SMM_GUID\0" \
+  "DELL_SMM_SIO_DASH_GUID\0" \
+  "DELL_SMM_EVENT_DXE_GUID\0" \
+  "DELL_SETUP_PREP_GUID\0" \
+  "DELL_DXE_PREREQ_GUID\0" \
+  "DELL_SPI_PART_ST_MICRO_GUID\0" \
+  "DELL_DIAGS_LEGACY_GUID\0" \
+  "DELL_ACPI_PLATFORM_GUID\0" \
+  "DELL_POWER_MANAGEMENT_GUID\0" \
+  "DELL_AHCI_SMM_GUID\0" \
+  "DELL_ME_PLATFORM_CONFIG_DXE_GUID\0" \
+  "DELL_PCI_HOST_BRIDGE_GUID\0" \
+  "DELL_SMM_SERVICES_GUID\0" \
+  "DELL_MOD_BAY_CONFIG_GUID\0" \
+  "DELL_SERVICE_RESET_SMM_GUID\0" \
+  "DELL_EC_CONFIG_DXE_GUID\0" \
+  "DELL_ERROR_HANDLER_DXE_GUID\0" \
+  "DELL_DEFAULT_BOOT_LIST_DXE_GUID\0" \
+  "DELL_AHCISRC_GUID\0" \
+  "DELL_SB_ACCESS_SMM_GUID\0" \
+  "DELL_IMG_SRV_BASE_ROM_GUID\0" \
+  "DELL_SMART_TIMER_GUID\0" \
+  "DELL_PBA_FP_DXE_GUID\0" \
+  "DELL_HECI_SMM_GUID\0" \
+  "DELL_SMM_COMPUTRACE_GUID\0" \
+  "DELL_FILE_SYSTEM_GUID\0" \
+  "DELL_DIRTY_SHUTDOWN_DXE_GUID\0" \
+  "DELL_SB_ACPI_CONFIG_GUID\0" \
+  "DELL_TCG_SETUP_GUID\0" \
+  "DELL_SERVICE_RESET_DXE_GUID\0" \
+  "DELL_BIOS_EXTENSION_LOADER_GUID\0" \
+  "DELL_HOT_SOS_DXE_DRIVER_GUID\0" \
+  "DELL_SM_BIOS_STRUC_DE_GUID\0" \
+  "DELL_SB_SMM_HOOKS_GUID\0" \
+  "DELL_BBSMANAGER_DXE_GUID\0" \
+  "DELL_GSET_CONFIG_GUID\0" \
+  "DELL_MULTI_DISPLAY_DXE_GUID\0" \
+  "DELL_AMI_BOARD_INFO_GUID\0" \
+  "DELL_DA_NON_VOLITILE_STORAGE_GUID\0" \
+  "DELL_DXE_MAIN_GUID\0" \
+  "DELL_SIO_POLICY_CONFIG_DXE_GUID\0" \
+  "DELL_CSMCORE_GUID\0" \
+  "DELL_HDD_PW_SMM_GUID\0" \
+  "DELL_SMM_CONTROL_GUID\0" \
+  "DELL_PCI_EXPRESS_DXE_GUID\0" \
+  "DELL_SPI_PART_SST_GUID\0" \
+  "DELL_SPI_CONTROLLER_DXE_GUID\0" \
+  "DELL_SMB_FACT_DEFAULT_GUID\0" \
+  "DELL_SMM_SIO_GPIO_CONTROL_GUID\0" \
+  "DELL_IMAGE_SERVER_SMM_GUID\0" \
+  "DELL_PBA_MGR_DXE_GUID\0" \
+  "DELL_IMAGE_SERVER_DXE_GUID\0" \
+  "DELL_LOM_CONFIG_GUID\0" \
+  "DELL_LEGACY_USB_SMM_GUID\0" \
+  "DELL_AMT_SMBIOS_GUID\0" \
+  "DELL_TCG_MOR_GUID\0" \
+  "DELL_DO_SIODIAG_LED_DXE_GUID\0" \
+  "DELL_AUDIO_DXE_GUID\0" \
+  "DELL_FV_MAINNESTED_GUID\0" \
+  "DELL_SMM_CRYPTO_ALGORITHM_GUID\0" \
+  "DELL_PCH_SMI_DISPATCHER_GUID\0" \
+  "DELL_SMBIOS64_GUID\0" \
+  "DELL_AMITSE_GUID\0" \
+  "DELL_DXE_DELAY_GUID\0" \
+  "DELL_LEG_USB_MEM_INFO_DXE_GUID\0" \
+  "DELL_SECURITY_CONFIG_GUID\0" \
+  "DELL_SMB_VERSION_MANIFEST_GUID\0" \
+  "DELL_SMBIOSUPDATE_DATA_GUID\0" \
+  "DELL_PCH_RESET_GUID\0" \
+  "DELL_SATA_CONTROLLER_GUID\0" \
+  "DELL_ALERT_STANDARD_FORMAT_SMM_GUID\0" \
+  "DELL_DA_TAA_MAC_GUID\0" \
+  "DELL_HOT_KEY_HANDLER_DXE_GUID\0" \
+  "DELL_CMOS_MANAGER_DXE_SRC_GUID\0" \
+  "DELL_DXE_GPIO_CONTROL_GUID\0" \
+  "DELL_DT_LEG_USB_POLICY_GUID\0" \
+  "DELL_PXE_BASE_ROM_GUID\0" \
+  "DELL_SMI_VARIABLE_GUID\0" \
+  "DELL_POWER_BUTTON_DXE_GUID\0" \
+  "DELL_ACTIVE_BIOS_GUID\0" \
+  "DELL_D010_ALEGACY_VIDEO_ROM_GUID\0" \
+  "DELL_SMM_DIAG_LEDS_GUID\0" \
+  "DELL_FLASH_WRITE_PROTECT_GUID\0" \
+  "DELL_LEGACY_INTERRUPT_GUID\0" \
+  "DELL_SAVE_MEMORY_CONFIG_DXE_GUID\0" \
+  "DELL_SPI_PART_WINBOND_GUID\0" \
+  "DELL_DA_ASSET_TAG_GUID\0" \
+  "DELL_IDE_RCONTROLLER_GUID\0" \
+  "DELL_PBA_USH_GUID\0" \
+  "DELL_LEGACY_TCG_SUPPORT_GUID\0" \
+  "DELL_SMB_STRUC_B2_CONFIG_GUID\0" \
+  "DELL_TDT_AM_GUID\0" \
+  "DELL_HOT_KEYS_CONFIG_GUID\0" \
+  "DELL_SMM_EVENT_SMM_GUID\0" \
+  "DELL_DASH_CONFIG_GUID\0" \
+  "DELL_SMM_MULTI_PLATFORM_GUID\0" \
+  "DELL_RUNTIME_GUID\0" \
+  "DELL_SM_BIOS_STRUC_D2_GUID\0" \
+  "DELL_CSP_LIB_DXE_GUID\0" \
+  "DELL_TCG_SMM_GUID\0" \
+  "DELL_SMBIOS_BOARD_GUID\0" \
+  "DELL_SMM_BASE_GUID\0" \
+  "DELL_SLP_MARKER_CTRL_GUID\0" \
+  "DELL_THROTTLING_DRIVER_GUID\0" \
+  "DELL_TERMINAL_PLATFORM_POLICY_GUID\0" \
+  "DELL_DIAGS_SMM_GUID\0" \
+  "DELL_HDD_SMART_SMM_GUID\0" \
+  "DELL_PCH_POLICY_INIT_DXE_GUID\0" \
+  "DELL_NB_CONFIG_DXE_GUID\0" \
+  "DELL_I_AMTDXE_GUID\0" \
+  "DELL_AMT_WRAPPER_DXE_GUID\0" \
+  "DELL_PHYSICAL_PRESENCE_GUID\0" \
+  "DELL_SMM_GPIO_CONTROL_GUID\0" \
+  "DELL_SM_BIOS_STRUC_D9_GUID\0" \
+  "DELL_STORAGE_AGENTS_SMM_GUID\0" \
+  "DELL_SMB_BBS_INFO_GUID\0" \
+  "DELL_SM_BIOS_STRUC_B2_GUID\0" \
+  "DELL_TDT_DXE_GUID\0" \
+  "DELL_SA_INIT_DXE_GUID\0" \
+  "DELL_PCH_INIT_DXE_GUID\0" \
+  "DELL_SMBIOS_GET_FLASH_DATA64_GUID\0" \
+  "DELL_IDE_DXE_GUID\0" \
+  "DELL_MFG_MODE_DXE_DRIVER_GUID\0" \
+  "DELL_DA_OWNER_TAG_GUID\0" \
+  "DELL_DA_BFA_GUID\0" \
+  "DELL_CPU_DXE_GUID\0" \
+  "DELL_PCH_SMBUS_DXE_GUID\0" \
+  "DELL_DA_PASSWORDS_GUID\0" \
+  "DELL_SLP_CONFIG_GUID\0" \
+  "DELL_DXE_SB_GPIO_CONTROL_GUID\0" \
+  "DELL_SMB_DA_TOKENS_CONFIG_GUID\0" \
+  "DELL_OEM_BADGING_SUPPORT_GUID\0" \
+  "DELL_SMM_CIRC_BUFF_GUID\0" \
+  "DELL_POWER_BUTTON_GUID\0" \
+  "DELL_ASF_TABLE_GUID\0" \
+  "DELL_RUNTIME_ACPI_SMM_GUID\0" \
+  "DELL_TAGS_CONFIG_GUID\0" \
+  "DELL_SM_BIOS_STRUC_FAN_GUID\0" \
+  "DELL_SMM_ASF_INIT_GUID\0" \
+  "DELL_SM_BIOS_STRUC_D8_GUID\0" \
+  "DELL_SM_BIOS_MEMORY_GUID\0" \
+  "DELL_S3_RESUME_GUID\0" \
+  "DELL_DXE_DIAG_LEDS_GUID\0" \
+  "DELL_WARM_BOOT_SMM_GUID\0" \
+  "DELL_BOOT_SCRIPT_SMI_HANDLER_GUID\0" \
+  "DELL_TPM_SMM_GUID\0" \
+  "DELL_DXE_SIO_EMI_GUID\0" \
+  "DELL_GT2_LEGACY_VIDEO_ROM_GUID\0" \
+  "DELL_SM_BIOS_STRUC_THERM_GUID\0" \
+  "DELL_VIDEO_CONFIG_DXE_GUID\0" \
+  "DELL_SMB_RUN_ROM_GUID\0" \
+  "DELL_BBSMANAGER_SMM_GUID\0" \
+  "DELL_PHYSICAL_PRESENCE_SMM_GUID\0" \
+  "DELL_ME_LOCAL_FW_UPDATE_DXE_GUID\0" \
+  "DELL_PCI_SERIAL_GUID\0" \
+  "DELL_PCH_SERIAL_GPIO_GUID\0" \
+  "DELL_SMI_CPU_DECODE_GUID\0" \
+  "DELL_SMM_S3_GUID\0" \
+  "DELL_MEMORY_INIT_GUID\0" \
+  "DELL_OP_PRESENCE_GUID\0" \
+  "DELL_START_WATCH_DOG_GUID\0" \
+  "DELL_PCH_SMBUS_ARP_DISABLED_GUID\0" \
+  "DELL_PCH_USB_GUID\0" \
+  "DELL_TCG_PEI2_GUID\0" \
+  "DELL_PCH_ME_UMA_GUID\0" \
+  "LENOVO_SYSTEM_USB_SWITCH_DXE_GUID\0" \
+  "LENOVO_SYSTEM_SCSI_BUS_DXE_GUID\0" \
+  "LENOVO_SYSTEM_AHCI_BUS_DXE_GUID\0" \
+  "LENOVO_MNP_DXE_BIN_GUID\0" \
+  "LENOVO_ISSC_SMM_GUID\0" \
+  "LENOVO_EC_IO_SMM_GUID\0" \
+  "LENOVO_EN25_QH32_FLASH_PART_DXE_GUID\0" \
+  "LENOVO_MTM_FORMAT_SMM_GUID\0" \
+  "LENOVO_DXE_RICOH_INIT_GUID\0" \
+  "LENOVO_SECURITY_VARIABLE_DXE_GUID\0" \
+  "LENOVO_IBEX_PEAK_FLASH_CONTROLLER_DXE_GUID\0" \
+  "LENOVO_BOARD_INFO_SMM_GUID\0" \
+  "LENOVO_SYSTEM_METRONOME_DXE_GUID\0" \
+  "LENOVO_SLP2_DXE_GUID\0" \
+  "LENOVO_CRYPT_SERVICE_SMM_GUID\0" \
+  "LENOVO_SYSTEM_SCSI_DISK_DXE_GUID\0" \
+  "LENOVO_SYSTEM_USB_SWITCH_SMM_GUID\0" \
+  "LENOVO_EC_FW_UPDATE_DXE_GUID\0" \
+  "LENOVO_SETUP_UNDER_OS_DXE_GUID\0" \
+  "LENOVO_BDS_CTRL_GUID\0" \
+  "LENOVO_SYSTEM_FIRMWARE_DEVICE_DXE_GUID\0" \
+  "LENOVO_EC_IO_DXE_GUID\0" \
+  "LENOVO_SYSTEM_SMM_AHCI_ASPI_LEGACY_RT_GUID\0" \
+  "LENOVO_BOOT_MENU_DXE_GUID\0" \
+  "LENOVO_FP_PBA_GUID\0" \
+  "LENOVO_SYSTEM_EBC_DXE_GUID\0" \
+  "LENOVO_SYSTEM_SMM_SERVICES_SMM_GUID\0" \
+  "LENOVO_EC_SERVICE_GUID\0" \
+  "LENOVO_SECURE_FLASH_VERIFY_SMM_GUID\0" \
+  "LENOVO_EN25_QH128_FLASH_PART_SMM_GUID\0" \
+  "LENOVO_COMPUTRACE_SMI_SERVICES_GUID\0" \
+  "LENOVO_SMM_VIDEO_INT10_GUID\0" \
+  "LENOVO_TCP_DXE_BIN_GUID\0" \
+  "LENOVO_SYSTEM_BOOT_SCRIPT_SAVE_DXE_GUID\0" \
+  "LENOVO_EAIA_DXE_GUID\0" \
+  "LENOVO_SYSTEM_PS2_MOUSE_DXE_GUID\0" \
+  "LENOVO_SMART_CARD_DETECT_DXE_GUID\0" \
+  "LENOVO_PLATFORM_FLASH_DXE_GUID\0" \
+  "LENOVO_MX25_L3206_EFLASH_PART_SMM_GUID\0" \
+  "LENOVO_TPM_ENABLER_DXE_GUID\0" \
+  "LENOVO_SYSTEM_USB_SUPPORT_POLICY_SMM_GUID\0" \
+  "LENOVO_SYSTEM_USB_BUS_DXE_GUID\0" \
+  "LENOVO_SYSTEM_USB_SUPPORT_POLICY_DXE_GUID\0" \
+  "LENOVO_SMM_OEMINT15_GUID\0" \
+  "LENOVO_SYSTEM_STATUS_CODE_GENERIC_RT_GUID\0" \
+  "LENOVO_CRYPT_SERVICE_GUID\0" \
+  "LENOVO_TCG_SERVICES_DXE_GUID\0" \
+  "LENOVO_FDISK_OEM_GUID\0" \
+  "LENOVO_PCH_SPI_SMM_GUID\0" \
+  "LENOVO_IVB_GOP_DRIVER_GUID\0" \
+  "LENOVO_SYSTEM_STATUS_CODE_PORT80_RT_GUID\0" \
+  "LENOVO_W25_Q64_FLASH_PART_DXE_GUID\0" \
+  "LENOVO_SYSTEM_USB_MEMORY_MANAGER_SMM_GUID\0" \
+  "LENOVO_SYSTEM_ACPI_S3_SAVE_DXE_GUID\0" \
+  "LENOVO_SA_LATE_INIT_SMM_GUID\0" \
+  "LENOVO_SYSTEM_USB_MOUSE_DXE_GUID\0" \
+  "LENOVO_SYSTEM_USB_KB_DXE_GUID\0" \
+  "LENOVO_PLATFORM_DXE_GUID\0" \
+  "LENOVO_PCH_BIOS_WRITE_PROTECT_GUID\0" \
+  "LENOVO_TP_ACPI_NVS_INIT_DXE_GUID\0" \
+  "LENOVO_SNB_GOP_DRIVER_GUID\0" \
+  "LENOVO_SYSTEM_USB_DATABASE_SMM_GUID\0" \
+  "LENOVO_SYSTEM_FORM_BROWSER_CORE_DXE_GUID\0" \
+  "LENOVO_BIOS_EXTENSION_LOADER_GUID\0" \
+  "LENOVO_SYSTEM_HII_DATABASE_DXE_GUID\0" \
+  "LENOVO_ATP_DXE_GUID\0" \
+  "LENOVO_DXE_MAIN_GUID\0" \
+  "LENOVO_SYSTEM_SPLASH_DXE_GUID\0" \
+  "LENOVO_SYSTEM_IMAGE_DISPLAY_DXE_GUID\0" \
+  "LENOVO_SYSTEM_RTC_RT_GUID\0" \
+  "LENOVO_SYSTEM_IDE_ATA_ATAPI_PASS_THRU_DXE_GUID\0" \
+  "LENOVO_SETUP_MAIN_DXE_GUID\0" \
+  "LENOVO_ME_PCI_UPDATE_GUID\0" \
+  "LENOVO_PHX_GOP_DXE_GUID\0" \
+  "LENOVO_MX25_L64_XFLASH_PART_DXE_GUID\0" \
+  "LENOVO_AOAC_SMM_GUID\0" \
+  "LENOVO_SYSTEM_HII_IMAGE_DISPLAY_DXE_GUID\0" \
+  "LENOVO_SYSTEM_PS2_KEYBOARD_DXE_GUID\0" \
+  "LENOVO_REBOOT_CP_GUID\0" \
+  "LENOVO_SYSTEM_CRYPT_SVC_RT_GUID\0" \
+  "LENOVO_PLATFORM_PCI_DXE_GUID\0" \
+  "LENOVO_FIT_DIAGNOSTICS_LOADER_GUID\0" \
+  "LENOVO_IBEX_PEAK_GLOBAL_SMI_CONTROL_GUID\0" \
+  "LENOVO_VPRO_IDER_ASF_BOOT_GUID\0" \
+  "LENOVO_SYSTEM_CON_SPLITTER_DXE_GUID\0" \
+  "LENOVO_I_FFS_SMM_GUID\0" \
+  "LENOVO_SYSTEM_PARTITION_DXE_GUID\0" \
+  "LENOVO_MAIL_BOX_DXE_GUID\0" \
+  "LENOVO_VARIABLE_INIT_SMM_GUID\0" \
+  "LENOVO_SYSTEM_AHCI_ATA_ATAPI_PASS_THRU_DXE_GUID\0" \
+  "LENOVO_COMPUTRACE_LOADER_DXE_GUID\0" \
+  "LENOVO_SYSTEM_CMOS_SMM_GUID\0" \
+  "LENOVO_MISC_GA_IO_DXE_GUID\0" \
+  "LENOVO_AT24_RF08_EEPROM_SMM_GUID\0" \
+  "LENOVO_SECURITY_SMI_DISPATCH_GUID\0" \
+  "LENOVO_SYSTEM_PPIS_NEEDED_BY_DXE_CORE_GUID\0" \
+  "LENOVO_SYSTEM_ERROR_LOG_SMM_GUID\0" \
+  "LENOVO_VPRO_HII_DXE_GUID\0" \
+  "LENOVO_COMPUTRACE_ENABLER_DXE_GUID\0" \
+  "LENOVO_EN25_QH64_FLASH_PART_SMM_GUID\0" \
+  "LENOVO_PCH_EMULATE_KBC_GUID\0" \
+  "LENOVO_SYSTEM_SMBIOS_EVENT_LOG_DXE_GUID\0" \
+  "LENOVO_HPM_SMM_GUID\0" \
+  "LENOVO_SYSTEM_CRC32_SECTION_EXTRACT_DXE_GUID\0" \
+  "LENOVO_SYSTEM_CON_PLATFORM_DXE_GUID\0" \
+  "LENOVO_PLATFORM_S3_SAVE_DXE_GUID\0" \
+  "LENOVO_TDT_AM_GUID\0" \
+  "LENOVO_ARP_DXE_BIN_GUID\0" \
+  "LENOVO_HPM_DXE_GUID\0" \
+  "LENOVO_SYSTEM_DATA_HUB_DXE_GUID\0" \
+  "LENOVO_SYSTEM_FLASH_COMMUNICATION_DXE_GUID\0" \
+  "LENOVO_SYSTEM_FIRMWARE_DEVICE_SMM_GUID\0" \
+  "LENOVO_DRIVE_ERASE_DXE_GUID\0" \
+  "LENOVO_SMM_BASE_RUNTIME_GUID\0" \
+  "LENOVO_DRIVE_ERASE_SMM_GUID\0" \
+  "LENOVO_PRIOR_BOOT_GUID\0" \
+  "LENOVO_DISK_CONTROLLER_SMBIOS_GUID\0" \
+  "LENOVO_DXE_REALTEK_CRC_INIT_GUID\0" \
+  "LENOVO_PLATFORM_CSM_DXE_GUID\0" \
+  "LENOVO_SECURE_ERROR_MANAGER_DXE_GUID\0" \
+  "LENOVO_IP6_DXE_BIN_GUID\0" \
+  "LENOVO_SETUP_RESTART_DXE_GUID\0" \
+  "LENOVO_SYSTEM_IMAGE_DECODER_DXE_GUID\0" \
+  "LENOVO_SETUP_CONFIG_DXE_GUID\0" \
+  "LENOVO_SMBIOS_COMPATI_INFO_GUID\0" \
+  "LENOVO_SYSTEM_KBC_INIT_DXE_GUID\0" \
+  "LENOVO_REMOTE_CONFIG_UPDATE_DXE_GUID\0" \
+  "LENOVO_CPU_INIT_DXE_GUID\0" \
+  "LENOVO_CPU_INIT_PHNX_DXE_GUID\0" \
+  "LENOVO_SYSTEM_VARIABLE_SMM_GUID\0" \
+  "LENOVO_SETUP_UNDER_OS_SMM_GUID\0" \
+  "LENOVO_RN_RCONFIG_GUID\0" \
+  "LENOVO_VARIABLE_DXE_GUID\0" \
+  "LENOVO_MISC_GA_IO_SMM_GUID\0" \
+  "LENOVO_W25_Q32_FLASH_PART_DXE_GUID\0" \
+  "LENOVO_SYSTEM_IDE_BUS_DXE_GUID\0" \
+  "LENOVO_OEM_MILESTONE_GUID\0" \
+  "LENOVO_SETUP_SECURITY_DXE_GUID\0" \
+  "LENOVO_SECURE_KEY_DXE_GUID\0" \
+  "LENOVO_UDP4_DXE_BIN_GUID\0" \
+  "LENOVO_N25_Q064_FLASH_PART_SMM_GUID\0" \
+  "LENOVO_SMBIOS_VPRO_GUID\0" \
+  "LENOVO_W25_Q64_FLASH_PART_SMM_GUID\0" \
+  "LENOVO_SYSTEM_ISA_KBC_DXE_GUID\0" \
+  "LENOVO_PLATFORM_FLASH_SMM_GUID\0" \
+  "LENOVO_PI_SAVE_STATE_ACCESS_GUID\0" \
+  "LENOVO_SYSTEM_ACPI_SUPPORT_DXE_GUID\0" \
+  "LENOVO_SYSTEM_SETUP2_DXE_GUID\0" \
+  "LENOVO_SYSTEM_IDE_ATA_ATAPI_PASS_THRU_SMM_GUID\0" \
+  "LENOVO_SYSTEM_BOOT_MANAGER_DXE_GUID\0" \
+  "LENOVO_BLOCK_POWER_BUTTON_DXE_GUID\0" \
+  "LENOVO_SYSTEM_ACPI_NUMA_DXE_GUID\0" \
+  "LENOVO_SYSTEM_ACPI_TABLE_LOADER_DXE_GUID\0" \
+  "LENOVO_DIGITAL_THERMAL_SENSOR_SMM_GUID\0" \
+  "LENOVO_SYSTEM_FIXED_BUS_NUMBERS_DXE_GUID\0" \
+  "LENOVO_SYSTEM_VARIABLE_DXE_GUID\0" \
+  "LENOVO_SYSTEM_SW_SMI_ALLOCATOR_RT_GUID\0" \
+  "LENOVO_SYSTEM8259_INTERRUPT_CONTROLLER_DXE_GUID\0" \
+  "LENOVO_WMA_POLICY_DXE_GUID\0" \
+  "LENOVO_LAN_UEFI_GUID\0" \
+  "LENOVO_POP_MANAGER_DXE_GUID\0" \
+  "LENOVO_SYSTEM_USB_MEMORY_MANAGER_DXE_GUID\0" \
+  "LENOVO_ATP_SMI_SERVICES_GUID\0" \
+  "LENOVO_MODULES_SMM_THUNK_SMM_GUID\0" \
+  "LENOVO_VPRO_PET_ALERT_GUID\0" \
+  "LENOVO_SMM_RELOC_DXE_GUID\0" \
+  "LENOVO_IGD_CUSTOMIZE_GUID\0" \
+  "LENOVO_SETUP_DATE_TIME_DXE_GUID\0" \
+  "LENOVO_TRANSLATE_SERVICE_GUID\0" \
+  "LENOVO_ME_CONFIG_GUID\0" \
+  "LENOVO_SYSTEM_OEM_ACTIVATION_DXE_GUID\0" \
+  "LENOVO_SYSTEM_PCI_ISA_BUS_DXE_GUID\0" \
+  "LENOVO_LEGACY_BIOS_MISC_SMM_GUID\0" \
+  "LENOVO_INIT_ME_POLICY_GUID\0" \
+  "LENOVO_SETUP_AUTOMATION_SMM_GUID\0" \
+  "LENOVO_N25_Q064_FLASH_PART_DXE_GUID\0" \
+  "LENOVO_HDP_MANAGER_SMM_GUID\0" \
+  "LENOVO_SYSTEM_XHCI_RESET_SYSTEM_GUID\0" \
+  "LENOVO_NATIONAL_LPC_PC87393_GUID\0" \
+  "LENOVO_SYSTEM_ENGLISH_DXE_GUID\0" \
+  "LENOVO_ABSOLUTE_COMPUTRACE_INSTALLER_WIN8_GUID\0" \
+  "LENOVO_WMA_PCI_DXE_GUID\0" \
+  "LENOVO_DPTF_GUID\0" \
+  "LENOVO_SYSTEM_ISA_SERIAL_DXE_GUID\0" \
+  "LENOVO_SYSTEM_PCI_BUS_DXE_GUID\0" \
+  "LENOVO_DHCP4_DXE_BIN_GUID\0" \
+  "LENOVO_SYSTEM_XHCI_DXE_GUID\0" \
+  "LENOVO_DXE_CMOS_INIT_GUID\0" \
+  "LENOVO_TCG_SERVICES_SMM_GUID\0" \
+  "LENOVO_DHCP6_DXE_BIN_GUID\0" \
+  "LENOVO_SYSTEM_ENHANCED_FAT_DXE_GUID\0" \
+  "LENOVO_SYSTEM_NULL_MEMORY_TEST_DXE_GUID\0" \
+  "LENOVO_SMM_CF9_TRAP_GUID\0" \
+  "LENOVO_MTFTP6_DXE_BIN_GUID\0" \
+  "LENOVO_PLATFORM_RESET_RUNTIME_DXE_GUID\0" \
+  "LENOVO_SYSTEM_DEVICE_PATH_DXE_GUID\0" \
+  "LENOVO_SMM_CORE_DISPATCHER_GUID\0" \
+  "LENOVO_MEBX_GUID\0" \
+  "LENOVO_EN25_QH128_FLASH_PART_DXE_GUID\0" \
+  "LENOVO_ISSC_DXE_GUID\0" \
+  "LENOVO_SYSTEM_TERMINAL_DXE_GUID\0" \
+  "LENOVO_SYSTEM_CAPSULE_RT_GUID\0" \
+  "LENOVO_PCH_CONFIG_GUID\0" \
+  "LENOVO_IP4_DXE_BIN_GUID\0" \
+  "LENOVO_SYSTEM_USB_MASS_STORAGE_DXE_GUID\0" \
+  "LENOVO_SYSTEM_ERROR_LOG_DXE_GUID\0" \
+  "LENOVO_DPC_DXE_BIN_GUID\0" \
+  "LENOVO_SNP_DXE_BIN_GUID\0" \
+  "LENOVO_SECURE_UPDATE_DXE_GUID\0" \
+  "LENOVO_OEM_HOOK_SMM_GUID\0" \
+  "LENOVO_PLATFORM_SETUP_DXE_GUID\0" \
+  "LENOVO_MX25_L3206_EFLASH_PART_DXE_GUID\0" \
+  "LENOVO_SYSTEM_ACPI_TABLES_DXE_GUID\0" \
+  "LENOVO_SM_BIOS_HOLE_GUID\0" \
+  "LENOVO_SYSTEM_DIAGNOSTIC_SPLASH_SCREEN_APP_GUID\0" \
+  "LENOVO_PCI_EXPRESS_GUID\0" \
+  "LENOVO_SYSTEM_SECURE_BOOT_DXE_GUID\0" \
+  "LENOVO_PROMPT_SERVICE_GUID\0" \
+  "LENOVO_SYSTEM_FORM_BROWSER_SIMPLE_TEXT_VIEW_LAYOUT_DXE_GUID\0" \
+  "LENOVO_SYSTEM_FRAMEWORK_HII_DATABASE_DXE_GUID\0" \
+  "LENOVO_INIT_VPRO_POLICY_GUID\0" \
+  "LENOVO_VARIABLE_INIT_DXE_GUID\0" \
+  "LENOVO_VPRO_MEBX_HOTKEY_GUID\0" \
+  "LENOVO_EN25_QH64_FLASH_PART_DXE_GUID\0" \
+  "LENOVO_PCH_PCIE_SMM_GUID\0" \
+  "LENOVO_SYSTEM_MONOTONIC_COUNTER_RT_GUID\0" \
+  "LENOVO_INCOMPATIBLE_PCI_DEVICE_GUID\0" \
+  "LENOVO_PCH_RESET_GUID\0" \
+  "LENOVO_AOAC_DXE_GUID\0" \
+  "LENOVO_SYSTEM_AHCI_BUS_SMM_GUID\0" \
+  "LENOVO_SYSTEM_RUNTIME_DXE_GUID\0" \
+  "LENOVO_MEBX_SETUP_BROWSER_GUID\0" \
+  "LENOVO_OS_OPT_DEFAULT_DXE_GUID\0" \
+  "LENOVO_SOUND_SERVICE_GUID\0" \
+  "LENOVO_I_FFS_DXE_GUID\0" \
+  "LENOVO_SYSTEM_SMM_COMMUNICATION_SMM_GUID\0" \
+  "LENOVO_USER_MANAGER_DXE_GUID\0" \
+  "LENOVO_UEFI_PXE_BC_DXE_BIN_GUID\0" \
+  "LENOVO_BOARD_INFO_DXE_GUID\0" \
+  "LENOVO_SYSTEM_FLASH_COMMUNICATION_SMM_GUID\0" \
+  "LENOVO_SMBIOS_TCG_DXE_GUID\0" \
+  "LENOVO_CPU_IO_GUID\0" \
+  "LENOVO_OS_OPT_DEFAULT_SMM_GUID\0" \
+  "LENOVO_SYSTEM_AHCI_ATA_ATAPI_PASS_THRU_SMM_GUID\0" \
+  "LENOVO_SYSTEM_ERROR_MENU_DXE_GUID\0" \
+  "LENOVO_SYSTEM_EHCI_DXE_GUID\0" \
+  "LENOVO_STATUS_CODE_ME_DEBUG_DXE_GUID\0" \
+  "LENOVO_SYSTEM_TEXT_CONSOLE_VGA_DXE_GUID\0" \
+  "LENOVO_MAIL_BOX_SMM_GUID\0" \
+  "LENOVO_SMM_FDISK_OEM_GUID\0" \
+  "LENOVO_SYSTEM_STATUS_CODE_PORT80_SMM_GUID\0" \
+  "LENOVO_PCH_SPI_RUNTIME_GUID\0" \
+  "LENOVO_SMM_ASL_SMI_GUID\0" \
+  "LENOVO_VARIABLE_DEFAULT_GUID\0" \
+  "LENOVO_PCH_S3_SUPPORT_GUID\0" \
+  "LENOVO_SVP_MANAGER_DXE_GUID\0" \
+  "LENOVO_SYSTEM_DIAGNOSTIC_SUMMARY_SCREEN_DXE_GUID\0" \
+  "LENOVO_SYSTEM_ACCELERATOR_KEY_DXE_GUID\0" \
+  "LENOVO_SYSTEM_FLASH_UPDATE_DRIVER_DXE_GUID\0" \
+  "LENOVO_SMAPI_SMM_GUID\0" \
+  "LENOVO_SYSTEM_DISK_IO_DXE_GUID\0" \
+  "LENOVO_SYSTEM_DATA_HUB_STD_ERR_DXE_GUID\0" \
+  "LENOVO_SYSTEM_KEY_DESC_DXE_GUID\0" \
+  "LENOVO_HDP_MANAGER_DXE_GUID\0" \
+  "LENOVO_PLATFORM_SMM_GUID\0" \
+  "LENOVO_EN25_QH32_FLASH_PART_SMM_GUID\0" \
+  "LENOVO_VIDEO_INIT_DXE_GUID\0" \
+  "LENOVO_SYSTEM_FONT_DXE_GUID\0" \
+  "LENOVO_SYSTEM_SETUP_ADVANCED_DXE_GUID\0" \
+  "LENOVO_SYSTEM_GRAPHICS_CONSOLE_DXE_GUID\0" \
+  "LENOVO_SYSTEM_SM_BIOS_SMM_GUID\0" \
+  "LENOVO_SYSTEM_BUS_ISA_RTC_SMM_GUID\0" \
+  "LENOVO_SYSTEM_ACPI_SMI_SERVICES_DXE2_GUID\0" \
+  "LENOVO_PLATFORM_HII_ADVANCED_DXE_GUID\0" \
+  "LENOVO_VARIABLE_SMM_GUID\0" \
+  "LENOVO_SYSTEM_FORM_BROWSER_SIMPLE_TEXT_VIEW_DXE_GUID\0" \
+  "LENOVO_N25_Q032_FLASH_PART_SMM_GUID\0" \
+  "LENOVO_MFG_BENCH_EVENT_DXE_GUID\0" \
+  "LENOVO_UDP6_DXE_BIN_GUID\0" \
+  "LENOVO_SYSTEM_STATUS_CODE_GENERIC_SMM_GUID\0" \
+  "LENOVO_MX25_L64_XFLASH_PART_SMM_GUID\0" \
+  "LENOVO_MTFTP4_DXE_BIN_GUID\0" \
+  "LENOVO_I_FFS_DXE_POLICY_INIT_GUID\0" \
+  "LENOVO_WMA_USB_DXE_GUID\0" \
+  "LENOVO_SYSTEM_SCSI_OPROM_PASS_THRU_DXE_GUID\0" \
+  "LENOVO_PASSWORD_CP_GUID\0" \
+  "LENOVO_SYSTEM_DIAGNOSTIC_SPLASH_SCREEN_DXE_GUID\0" \
+  "LENOVO_IBEX_PEAK_FLASH_CONTROLLER_SMM_GUID\0" \
+  "LENOVO_SMM_SLEEP_EVENT_GUID\0" \
+  "LENOVO_AT24_RF08_EEPROM_DXE_GUID\0" \
+  "LENOVO_KBD_CONFIG_GUID\0" \
+  "LENOVO_SYSTEM_LEGACY_BIOS_DXE_GUID\0" \
+  "LENOVO_VPRO_CIRA_HOT_KEY_GUID\0" \
+  "LENOVO_OEM_HOOK_GUID\0" \
+  "LENOVO_SYSTEM_SMBIOS_DXE_GUID\0" \
+  "LENOVO_SECURE_KEY_SMM_GUID\0" \
+  "LENOVO_ME_CON_OUT_READY_GUID\0" \
+  "LENOVO_FINGERPRINT_CP_GUID\0" \
+  "LENOVO_SYSTEM_SMM_USB_LEGACY_SMM_GUID\0" \
+  "LENOVO_SYSTEM_WATCHDOG_TIMER_DXE_GUID\0" \
+  "LENOVO_N25_Q032_FLASH_PART_DXE_GUID\0" \
+  "LENOVO_SYSTEM_SECURITY_STUB_DXE_GUID\0" \
+  "LENOVO_SVP_MANAGER_SMM_GUID\0" \
+  "LENOVO_STARTUP_MENU_DXE_GUID\0" \
+  "LENOVO_PLATFORM_S3_SAVE_SMM_GUID\0" \
+  "LENOVO_SYSTEM_CMOS_DXE_GUID\0" \
+  "LENOVO_FINGERPRINT_SMM_GUID\0" \
+  "LENOVO_POWER_MANAGEMENT2_GUID\0" \
+  "LENOVO_W25_Q32_FLASH_PART_SMM_GUID\0" \
+  "LENOVO_SYSTEM_USB_DATABASE_DXE_GUID\0" \
+  "LENOVO_TCG_SMM_GUID\0" \
+  "LENOVO_SLP2_SMM_GUID\0" \
+  "LENOVO_FIT_DIAGNOSTICS_GUID\0" \
+  "LENOVO_SYSTEM_SECURE_FLASH_SLEEP_TRAP_SMM_GUID\0" \
+  "LENOVO_TXT_DXE_GUID\0" \
+  "LENOVO_SYSTEM_FV_FILE_LOADER_GUID\0" \
+  "LENOVO_PROTECT_PBPEI_GUID\0"
+
+#define GUID_DB_HASH_DISPLACEMENTS \
+  0x0001, 0x0001, 0x0012, 0x000B, 0x0011, 0x0025, 0x0001, 0x0002, 0x0005, 0x0016, 0x000C, 0x0014, 0x000F, 0x0002, 0x000B, 0x0001, \
+  0x0004, 0x0004, 0x003B, 0x0001, 0x0037, 0x0003, 0x000B, 0x000B, 0x000A, 0x0007, 0x004F, 0x000C, 0x0001, 0x000A, 0x0029, 0x0003, \
+  0x000E, 0x0002, 0x0017, 0x0001, 0x0001, 0x0002, 0x000C, 0x0016, 0x0001, 0x0007, 0x000D, 0x0010, 0x001A, 0x0004, 0x0026, 0x0001, \
+  0x0001, 0x0001, 0x0013, 0x0001, 0x0016, 0x0009, 0x0031, 0x000A, 0x001A, 0x0029, 0x0002, 0x0001, 0x0003, 0x000A, 0x0007, 0x0001, \
+  0x0035, 0x001A, 0x0014, 0x000B, 0x0003, 0x0006, 0x0001, 0x0002, 0x0017, 0x005D, 0x0001, 0x0006, 0x0002, 0x0055, 0x001A, 0x0044, \
+  0x0001, 0x0003, 0x0002, 0x0011, 0x0003, 0x000B, 0x0018, 0x0002, 0x002A, 0x0003, 0x0013, 0x0028, 0x0004, 0x0056, 0x0002, 0x0006, \
+  0x0001, 0x0005, 0x001A, 0x0033, 0x0004, 0x0007, 0x0013, 0x000D, 0x0017, 0x0004, 0x0018, 0x0007, 0x001C, 0x0004, 0x0006, 0x0003, \
+  0x0036, 0x0005, 0x0028, 0x0008, 0x002D, 0x0002, 0x0002, 0x000B, 0x001D, 0x0037, 0x0008, 0x0051, 0x0044, 0x0047, 0x0005, 0x0021, \
+  0x0004, 0x0003, 0x0001, 0x001B, 0x000C, 0x0002, 0x0007, 0x0026, 0x0005, 0x0002, 0x0008, 0x0005, 0x000D, 0x001F, 0x0003, 0x0007, \
+  0x0023, 0x000D, 0x0001, 0x0003, 0x002F, 0x0001, 0x0001, 0x0005, 0x0002, 0x0014, 0x000E, 0x0006, 0x0024, 0x0002, 0x000C, 0x0001, \
+  0x0001, 0x002E, 0x0002, 0x001B, 0x0003, 0x0004, 0x001F, 0x0002, 0x000A, 0x002C, 0x0013, 0x000C, 0x0007, 0x0001, 0x0034, 0x0031, \
+  0x003B, 0x0008, 0x0002, 0x0006, 0x000D, 0x0008, 0x0001, 0x0001, 0x0019, 0x0008, 0x0011, 0x0027, 0x0045, 0x0054, 0x0030, 0x0001, \
+  0x0017, 0x0001, 0x0024, 0x0032, 0x0028, 0x0004, 0x0039, 0x0005, 0x005A, 0x0002, 0x008B, 0x0001, 0x0003, 0x0005, 0x0016, 0x0020, \
+  0x0001, 0x0017, 0x0022, 0x0005, 0x0004, 0x0013, 0x0034, 0x000A, 0x0004, 0x0005, 0x0006, 0x0002, 0x0039, 0x004E, 0x0004, 0x0001, \
+  0x008F, 0x0001, 0x012B, 0x005C, 0x002F, 0x0036, 0x0003, 0x000A, 0x0015, 0x0018, 0x0001, 0x002E, 0x002F, 0x0006, 0x000B, 0x0001, \
+  0x0002, 0x0009, 0x0001, 0x0038, 0x0001, 0x004A, 0x00CF, 0x0029, 0x00DE, 0x0025, 0x000B, 0x0010, 0x0002, 0x006F, 0x002F, 0x0011, \
+  0x000D, 0x0031, 0x0004, 0x0003, 0x0004, 0x0003, 0x0006, 0x0005, 0x0001, 0x0003, 0x0040, 0x000D, 0x00A7, 0x0005, 0x0006, 0x001C, \
+  0x0011, 0x0001, 0x0013, 0x0005, 0x0057, 0x0001, 0x0001, 0x0008, 0x00B6, 0x0018, 0x0077, 0x001E, 0x0009, 0x000C, 0x0002, 0x0018, \
+  0x0003, 0x000E, 0x000E, 0x0010, 0x0014, 0x0068, 0x0044, 0x0041, 0x0010, 0x0005, 0x0001, 0x0037, 0x0007, 0x001D, 0x00AB, 0x0003, \
+  0x0003, 0x0108, 0x0018, 0x0001, 0x0074, 0x0001, 0x0001, 0x0010, 0x0057, 0x0039, 0x0097, 0x007D, 0x0008, 0x015D, 0x0008, 0x0001, \
+  0x001E, 0x0017, 0x0001, 0x0001, 0x0022, 0x000E, 0x0003, 0x0026, 0x00D9, 0x0002, 0x00B6, 0x0167, 0x0008, 0x0009, 0x0007, 0x0001, \
+  0x004C, 0x0059, 0x0001, 0x0052, 0x001D, 0x0059, 0x0002, 0x0044, 0x00A9, 0x0001, 0x0019, 0x007E, 0x0013, 0x0001, 0x0019, 0x000C, \
+  0x0026, 0x002F, 0x0001, 0x001C, 0x002C, 0x007E, 0x0003, 0x0059, 0x0002, 0x0046, 0x0141, 0x0007, 0x001D, 0x0018, 0x0004, 0x0001, \
+  0x0083, 0x000A, 0x005A, 0x0023, 0x002A, 0x0010, 0x005A, 0x001B, 0x00D4, 0x001C, 0x0007, 0x000A, 0x001A, 0x004F, 0x0004, 0x0001, \
+  0x000F, 0x0073, 0x000D, 0x0015, 0x0035, 0x005E, 0x0022, 0x0001, 0x000F, 0x0017, 0x0006, 0x0014, 0x0011, 0x0010, 0x0002, 0x0024, \
+  0x000F, 0x0004, 0x0002, 0x0007, 0x023D, 0x0004, 0x0056, 0x0001, 0x0022, 0x0001, 0x0025, 0x008E, 0x000A, 0x0053, 0x0007, 0x0002, \
+  0x0095, 0x002D, 0x0031, 0x00B3, 0x005D, 0x005A, 0x0001, 0x0010, 0x00B9, 0x0042, 0x0002, 0x01ED, 0x005C, 0x0001, 0x000B, 0x0007, \
+  0x0006, 0x0020, 0x0021, 0x0221, 0x0001, 0x0023, 0x0039, 0x0023, 0x000D, 0x000D, 0x0003, 0x0028, 0x0001, 0x00F1, 0x0002, 0x003A, \
+  0x012F, 0x0008, 0x0015, 0x0006, 0x0002, 0x0001, 0x000A, 0x0006, 0x0133, 0x0038, 0x009D, 0x0040, 0x0001, 0x0012, 0x000D, 0x0044, \
+  0x0082, 0x00BF, 0x000A, 0x0001, 0x0033, 0x00D9, 0x0148, 0x007B, 0x00E5, 0x0011, 0x00CE, 0x0193, 0x0001, 0x0003, 0x00E3, 0x0006, \
+  0x0004, 0x0002, 0x0002, 0x012C, 0x000B, 0x0023, 0x00AC, 0x001D, 0x0070, 0x0001, 0x0001, 0x006B, 0x0007, 0x0004, 0x0089, 0x0033, \
+  0x0056, 0x0048, 0x01BD, 0x001A, 0x004B, 0x00FF, 0x0184, 0x0001, 0x0025, 0x0003, 0x0038, 0x00D5, 0x001B, 0x0002, 0x008C, 0x0062
+
+#define GUID_DB_HASH_SLOTS \
+  0x0148, 0x02D6, 0x00A7, 0x01A9, 0x00D9, 0x004F, 0x0286, 0x00E5, 0x005C, 0x02F8, 0x05E3, 0x0287, 0x0345, 0x0159, 0x04DE, 0x04BC, \
+  0x0419, 0x022D, 0x0493, 0x0594, 0x053E, 0x02F9, 0x0037, 0x063B, 0x0499, 0x0278, 0x04C1, 0x027A, 0x0187, 0x0614, 0x0369, 0x0394, \
+  0x03EC, 0x0236, 0x06FD, 0x04C3, 0x0289, 0x0334, 0xFFFF, 0x03C7, 0x0549, 0x05FE, 0xFFFF, 0x0781, 0x036C, 0x010D, 0x0412, 0x050D, \
+  0x0681, 0x017A, 0x03E3, 0x003D, 0x04A0, 0x031B, 0x049E, 0x0541, 0x0295, 0x00E1, 0x011D, 0x005B, 0x0312, 0xFFFF, 0x0146, 0x0224, \
+  0x0723, 0x0736, 0x06BD, 0x03E0, 0x0443, 0x0157, 0x048F, 0xFFFF, 0xFFFF, 0x06CB, 0x0015, 0x03A9, 0x0050, 0x0580, 0x05E1, 0x03E5, \
+  0x0655, 0x0354, 0x01B0, 0x051A, 0x00DD, 0x070C, 0x02D3, 0x0588, 0x018C, 0x0766, 0x0438, 0x0322, 0x0617, 0x0395, 0x034F, 0x0106, \
+  0x0682, 0x03F3, 0x059F, 0x029A, 0x06ED, 0x0191, 0x0177, 0x02CE, 0x04ED, 0x0227, 0x0042, 0x0291, 0x0219, 0x065B, 0x0382, 0x0282, \
+  0x0484, 0x046C, 0x0432, 0x0100, 0x052E, 0x036B, 0x062A, 0x05E4, 0x06D2, 0x00D5, 0x031A, 0x0139, 0x0125, 0x000B, 0x061E, 0x04BE, \
+  0x03B5, 0x03C4, 0x01EE, 0x021D, 0x046B, 0x02B3, 0x058A, 0x0589, 0x038C, 0x0313, 0x0740, 0x06E6, 0x0763, 0x01A5, 0x00B1, 0x05D5, \
+  0x0005, 0x02AA, 0x0606, 0x0786, 0x00D1, 0x009F, 0x043C, 0x0684, 0x048B, 0x0397, 0x04B5, 0x01A3, 0x015B, 0x0731, 0x056F, 0x01AB, \
+  0x06F7, 0xFFFF, 0x0627, 0x0145, 0x0131, 0x058C, 0x04E8, 0x00E4, 0x01BF, 0x066E, 0x01CA, 0x052B, 0x0601, 0x0363, 0x057A, 0x007E, \
+  0x0364, 0x03BB, 0x05AC, 0x0771, 0x04E3, 0xFFFF, 0x05F1, 0x040B, 0x05E5, 0x059B, 0x026A, 0xFFFF, 0x01EB, 0x0383, 0x000E, 0x01B6, \
+  0x0711, 0xFFFF, 0x01E1, 0x0361, 0x006F, 0x0304, 0x0625, 0x04E1, 0x05BA, 0x04B4, 0x0494, 0x0170, 0x0201, 0x075D, 0x05A8, 0x02FF, \
+  0x068F, 0x030E, 0x057B, 0x069E, 0x00C0, 0x0734, 0x0296, 0x0454, 0x00C8, 0x069F, 0x03D0, 0x044B, 0x00B0, 0x0442, 0xFFFF, 0x05AD, \
+  0x04F8, 0x0175, 0x00D6, 0x0214, 0x035D, 0x06DD, 0x028C, 0x02E9, 0x0524, 0x0505, 0x0117, 0x04AD, 0xFFFF, 0x037A, 0x0379, 0x03E8, \
+  0x05C2, 0x0301, 0x04A4, 0x05D3, 0x075C, 0x0326, 0x06C4, 0x033C, 0x0130, 0x0426, 0x05F4, 0xFFFF, 0x0784, 0x065F, 0x01E0, 0x04D0, \
+  0x0049, 0x0122, 0x026D, 0x00C7, 0x014D, 0x04EB, 0x0789, 0x0553, 0x0248, 0x0080, 0x01F7, 0x0390, 0x0619, 0x02E7, 0x0709, 0x02FD, \
+  0x035E, 0x069A, 0x05DF, 0x0650, 0x0265, 0x00E7, 0xFFFF, 0x00A2, 0x0491, 0x008E, 0x04C5, 0x0569, 0x02E2, 0x0091, 0x036F, 0x0425, \
+  0x06D0, 0x000C, 0x04D8, 0xFFFF, 0xFFFF, 0x061C, 0x0536, 0x0415, 0x03E1, 0x074A, 0x017D, 0x0773, 0x051D, 0x04DB, 0x06C7, 0x0547, \
+  0x0381, 0x0052, 0x0208, 0x010E, 0x0566, 0x05C8, 0x0579, 0x0599, 0x0436, 0x0158, 0x02EE, 0x075A, 0x0602, 0x059A, 0x06D4, 0x0769, \
+  0x0741, 0x0116, 0x058E, 0x0645, 0x04E9, 0x0478, 0xFFFF, 0x00AD, 0x0186, 0x0431, 0x0745, 0x034D, 0x0373, 0x00B8, 0x0687, 0x034C, \
+  0x0489, 0x045B, 0x019D, 0xFFFF, 0x0342, 0x0564, 0x03BE, 0x0061, 0x06A5, 0x020C, 0x0595, 0x057F, 0x01FD, 0x0035, 0x0746, 0x0770, \
+  0xFFFF, 0x0359, 0xFFFF, 0x0107, 0x00C3, 0x0245, 0x0193, 0x06B4, 0x032A, 0x0014, 0x0077, 0x055E, 0x0522, 0xFFFF, 0x0441, 0x01DA, \
+  0x0140, 0x0413, 0x06BB, 0xFFFF, 0x0672, 0x032B, 0x02CF, 0x052C, 0x0429, 0x05F5, 0x03D5, 0x01B8, 0x0473, 0x077C, 0x02C2, 0x003B, \
+  0x0707, 0xFFFF, 0x0230, 0x03F6, 0x056A, 0x056C, 0x04DF, 0x0764, 0x00CD, 0x0063, 0x0315, 0x001A, 0x06DA, 0x0362, 0xFFFF, 0xFFFF, \
+  0x0624, 0x0683, 0x04CB, 0xFFFF, 0x0525, 0x0486, 0x0083, 0x0639, 0x01C0, 0x0073, 0x05E7, 0xFFFF, 0x0346, 0x0272, 0x0330, 0x0750, \
+  0x066D, 0x0368, 0x0160, 0x00CF, 0x04BA, 0x064B, 0x023C, 0x0440, 0x00FA, 0x02CD, 0x03FD, 0x029E, 0x0512, 0x060E, 0x0173, 0x014A, \
+  0x067F, 0x04D2, 0x021E, 0x05DE, 0x002E, 0x051E, 0x06DE, 0x03D6, 0x0074, 0x054E, 0x02F0, 0x03B8, 0x02E1, 0x0737, 0x02F4, 0xFFFF, \
+  0x0665, 0xFFFF, 0x03D7, 0x01A4, 0x0314, 0xFFFF, 0x0058, 0x0644, 0x0628, 0x073E, 0x046A, 0x005F, 0x02BE, 0xFFFF, 0x076D, 0xFFFF, \
+  0x03AF, 0x0765, 0x0071, 0x0561, 0xFFFF, 0x0269, 0x0022, 0x01EA, 0x044F, 0x0586, 0x0030, 0x05E6, 0x049F, 0xFFFF, 0xFFFF, 0x0555, \
+  0x0385, 0x05CD, 0x03E7, 0x0377, 0x0533, 0x0407, 0x0349, 0x0444, 0x0260, 0x04FA, 0x073D, 0x019B, 0x01C6, 0x0082, 0x0337, 0xFFFF, \
+  0x00CA, 0x077F, 0x043F, 0x00C6, 0x02E6, 0x0028, 0x00B5, 0x0583, 0x005E, 0x061A, 0x04AB, 0x012E, 0x043A, 0x0393, 0x01E3, 0x04A6, \
+  0xFFFF, 0x0141, 0x00E6, 0x0185, 0x0596, 0x0007, 0x03EA, 0x02FB, 0x0670, 0x03AC, 0x046F, 0x0240, 0x06F3, 0x03A7, 0x02EF, 0x040E, \
+  0x004D, 0x0591, 0x0221, 0x0328, 0x02B0, 0x039F, 0x075F, 0x0153, 0x03A6, 0x018A, 0x054F, 0x0353, 0xFFFF, 0x073C, 0x060A, 0x004B, \
+  0x040D, 0x0115, 0x059E, 0x03A3, 0x065E, 0x027E, 0x0360, 0x016B, 0x02B1, 0x002B, 0x06BC, 0x0081, 0x017B, 0x02C0, 0x06E9, 0x03FA, \
+  0x054C, 0x0461, 0x016C, 0x04C0, 0xFFFF, 0x0481, 0x0620, 0x0705, 0x00A8, 0x024D, 0x0634, 0x0470, 0x067D, 0x0649, 0x0229, 0x02E5, \
+  0x01CD, 0x06D1, 0x0772, 0x03BA, 0x0496, 0x0012, 0xFFFF, 0x01E2, 0x039E, 0x0190, 0x027F, 0x0410, 0x0220, 0x0244, 0x0551, 0x054D, \
+  0x077D, 0x01D0, 0x018E, 0x042F, 0x05BD, 0x007F, 0x05F6, 0x0258, 0x068E, 0x03DF, 0x06A4, 0x055F, 0x0279, 0x018F, 0x05EF, 0x013C, \
+  0x0673, 0x0340, 0x0565, 0x0414, 0x0255, 0x0041, 0x00B9, 0x057D, 0x03E4, 0x01B7, 0x00D0, 0x06F4, 0x055D, 0x04FD, 0x00BD, 0x0196, \
+  0x0544, 0x0179, 0x06A2, 0x0263, 0xFFFF, 0x0509, 0x025E, 0x0064, 0xFFFF, 0x04FF, 0x04B6, 0x05D7, 0x017E, 0x04F0, 0x031D, 0x0378, \
+  0x04BD, 0x0276, 0x007C, 0x05A1, 0x01D8, 0x031E, 0x02FE, 0x017C, 0x0403, 0x049C, 0x050E, 0x0710, 0x0543, 0x05B9, 0x064E, 0x0703, \
+  0x0124, 0x002A, 0x04CC, 0x007A, 0x0653, 0x00FF, 0xFFFF, 0x01B1, 0x052D, 0x0034, 0x024F, 0x007D, 0x04FE, 0x0152, 0x06D8, 0x0573, \
+  0x028E, 0x0043, 0x05FB, 0x0752, 0x05D1, 0x01CF, 0x0033, 0x049D, 0x00A1, 0x04EE, 0x0338, 0x029F, 0x0147, 0x0504, 0x0554, 0x0497, \
+  0xFFFF, 0x05E0, 0x048C, 0x0423, 0x033B, 0x001E, 0x06FC, 0x063D, 0xFFFF, 0x000F, 0x05E9, 0x0306, 0x0598, 0x03AD, 0x025F, 0x05B1, \
+  0x072E, 0x04EF, 0x00B2, 0x068C, 0x04D5, 0x0575, 0x01E8, 0x0011, 0x005A, 0x028F, 0x02ED, 0x05EE, 0x00DF, 0xFFFF, 0x0702, 0x0165, \
+  0x016E, 0x027B, 0x06DB, 0x03A5, 0x0039, 0x00EC, 0x019F, 0xFFFF, 0x00ED, 0x0760, 0x010C, 0xFFFF, 0x06AB, 0x0613, 0xFFFF, 0x071D, \
+  0x027C, 0x0434, 0x0119, 0x0609, 0x021C, 0x02F5, 0x032E, 0x05A6, 0x05B5, 0x0204, 0x0336, 0x04C4, 0x048A, 0x00A0, 0xFFFF, 0x0507, \
+  0x02AD, 0x0053, 0x0197, 0x00AF, 0x0430, 0x06EA, 0x01E4, 0x029B, 0x0172, 0x0358, 0x0774, 0x0084, 0x00F9, 0x032D, 0x05DC, 0x0299, \
+  0x020E, 0x0298, 0x0195, 0x02C7, 0x0114, 0x0384, 0x04E6, 0x0662, 0x0370, 0x066C, 0x074E, 0x0788, 0x0611, 0x0556, 0x016D, 0x064D, \
+  0x0466, 0x0603, 0x05FD, 0x00DC, 0x02BC, 0x047A, 0xFFFF, 0x037C, 0x0646, 0x061D, 0x0587, 0x0398, 0x0169, 0x01F2, 0x0758, 0x02B6, \
+  0x05C1, 0x05B8, 0x0618, 0x0460, 0x04F4, 0x011F, 0x0097, 0x0095, 0x04B0, 0x0023, 0x0411, 0xFFFF, 0x01F3, 0x0166, 0x056B, 0x00E3, \
+  0x052A, 0x0350, 0xFFFF, 0x035F, 0x0044, 0x06AD, 0x0070, 0x0777, 0x02F7, 0x0038, 0x036A, 0x026E, 0x04F3, 0x02A8, 0x034B, 0x014E, \
+  0x0040, 0x066B, 0x043E, 0x02DF, 0x03C8, 0x04FB, 0x013F, 0x0347, 0x0223, 0x0262, 0x02A1, 0x0277, 0x002C, 0x0163, 0x06C5, 0x0480, \
+  0x03AE, 0x070B, 0x01C1, 0x0209, 0x0570, 0xFFFF, 0x0001, 0x0308, 0x02A7, 0x002D, 0x0690, 0x0352, 0x01CE, 0x029D, 0x0456, 0xFFFF, \
+  0x010B, 0x0568, 0x02E4, 0x02F3, 0x02C3, 0xFFFF, 0xFFFF, 0x06E5, 0x0428, 0xFFFF, 0x03EE, 0x013D, 0xFFFF, 0xFFFF, 0x075B, 0x06B1, \
+  0x0479, 0x0514, 0x04FC, 0x00EF, 0x03EF, 0x031F, 0x02D4, 0x02E0, 0x0445, 0x03CE, 0x0242, 0x02DC, 0x00EE, 0x05B6, 0x0675, 0x019A, \
+  0x014B, 0x0257, 0x04AC, 0x06A0, 0x0778, 0x0108, 0x06FA, 0x047E, 0x0629, 0x067A, 0x0647, 0x0010, 0x051C, 0x0184, 0x042B, 0x055C, \
+  0x0283, 0x0232, 0x00B6, 0x040C, 0x0109, 0x05C3, 0x045E, 0x023D, 0x064C, 0xFFFF, 0x05A9, 0x06D5, 0x0142, 0x0726, 0x04B9, 0x068D, \
+  0x0332, 0x0455, 0x047F, 0x0150, 0x074F, 0x0742, 0x00CE, 0x0474, 0x0467, 0x0031, 0x053B, 0x050A, 0x05A2, 0x02EC, 0x05D2, 0x021F, \
+  0x0079, 0x0188, 0x06BA, 0x0067, 0x022A, 0x070D, 0x041A, 0xFFFF, 0x00D4, 0x0057, 0x06B8, 0x0294, 0x06FE, 0x0143, 0x0305, 0x0697, \
+  0xFFFF, 0x0542, 0x0427, 0x0309, 0x03B4, 0x04F7, 0x02DB, 0x02EB, 0x06B6, 0x04D9, 0x06B3, 0x0311, 0x01CC, 0x00BF, 0x025A, 0x011B, \
+  0x0669, 0x023B, 0xFFFF, 0x00B4, 0x0307, 0x01D1, 0x0327, 0x02E3, 0x0699, 0x0228, 0x04C8, 0x0435, 0x025B, 0xFFFF, 0x038B, 0x01A6, \
+  0x0548, 0x0450, 0xFFFF, 0x030B, 0x0351, 0x02BB, 0x0335, 0x0132, 0x0732, 0x04E7, 0x02A2, 0x022C, 0x00F7, 0x02B7, 0xFFFF, 0x052F, \
+  0x01FC, 0x03A1, 0x01BA, 0xFFFF, 0x0488, 0x01E7, 0x0329, 0x0154, 0x02F2, 0x0396, 0x033F, 0x024A, 0x0045, 0x06AA, 0x0490, 0x004E, \
+  0x01ED, 0x0391, 0x0638, 0x073A, 0xFFFF, 0x0402, 0x0661, 0x061F, 0x078A, 0x03A0, 0x030C, 0x04CF, 0x05CE, 0x05DD, 0x01BB, 0x03B2, \
+  0x06EB, 0x0293, 0x02E8, 0x033A, 0x06D6, 0x012F, 0x0502, 0x0120, 0x03D3, 0x0103, 0x029C, 0x03F7, 0x0062, 0x01C8, 0x03C0, 0x0633, \
+  0x018D, 0x042C, 0x0465, 0x01CB, 0x0762, 0x070A, 0x039B, 0x038E, 0x00AE, 0x0537, 0x00EA, 0x01C9, 0x0392, 0x0348, 0x0571, 0x024B, \
+  0x0237, 0x046E, 0x05C9, 0x06F6, 0x02D1, 0x043D, 0x05CC, 0x01FF, 0x0654, 0x016A, 0xFFFF, 0x0453, 0xFFFF, 0xFFFF, 0x0087, 0x06A8, \
+  0x03E6, 0x018B, 0x071E, 0x015C, 0x05B3, 0x0692, 0x00FE, 0x0365, 0xFFFF, 0x01D6, 0x0409, 0x0344, 0x0284, 0x01A7, 0x013A, 0x0520, \
+  0x03B1, 0x0105, 0x0135, 0x0471, 0x0557, 0x06EE, 0x00E8, 0x04C9, 0x058D, 0xFFFF, 0x069B, 0x00F5, 0x0085, 0x0733, 0x0651, 0x0623, \
+  0x05D8, 0x06EF, 0x03A4, 0x022E, 0x03E9, 0x05BE, 0x03B7, 0x011E, 0x00A5, 0x0207, 0x0009, 0x04B2, 0x026C, 0x0776, 0x0538, 0x0593, \
+  0x02B9, 0xFFFF, 0x03F2, 0x0075, 0x0515, 0x076B, 0x0118, 0x0133, 0x00BA, 0x0180, 0xFFFF, 0x00FC, 0x05AB, 0x015A, 0x0718, 0x0578, \
+  0x03FC, 0x00FD, 0x05BC, 0x0622, 0x0234, 0x006D, 0x0482, 0x0485, 0x0753, 0x02BF, 0xFFFF, 0xFFFF, 0x0492, 0x0261, 0x073B, 0x04BF, \
+  0x00DA, 0x01DF, 0x0167, 0x01E5, 0xFFFF, 0x06CC, 0x035B, 0x011C, 0x0250, 0x00C1, 0x0123, 0x05BB, 0x027D, 0x0367, 0x0144, 0x0303, \
+  0xFFFF, 0x03CA, 0x0660, 0x036D, 0x00E9, 0x01C4, 0x0552, 0x04DC, 0xFFFF, 0x072B, 0x0526, 0x003E, 0x0728, 0x05EC, 0x060F, 0x0218, \
+  0x0027, 0x0174, 0x0560, 0x019C, 0x01AC, 0x02A5, 0x069C, 0x015D, 0x02C1, 0x06F0, 0x01B9, 0x038F, 0x0462, 0x059D, 0x0203, 0x03C3, \
+  0x02AE, 0x04A9, 0x02DE, 0x0518, 0x0215, 0x0451, 0x06CA, 0x062D, 0x03D4, 0x02CA, 0x00D3, 0x072D, 0x0727, 0x042E, 0x024E, 0x05B2, \
+  0x0275, 0x02C4, 0xFFFF, 0x0652, 0x0483, 0x06C1, 0xFFFF, 0x063F, 0x05CB, 0x0266, 0x009B, 0x00AA, 0x06A1, 0x06DC, 0x04D6, 0x0111, \
+  0x009A, 0x02A3, 0x020A, 0x0249, 0x05A3, 0x0689, 0x0401, 0x06D3, 0x0780, 0xFFFF, 0x0529, 0x001F, 0x00C2, 0xFFFF, 0x0271, 0x0202, \
+  0x0452, 0x0400, 0x049A, 0x0531, 0x0162, 0x0268, 0x0029, 0x0406, 0x077B, 0x050B, 0x04F1, 0x06F2, 0x0024, 0x0199, 0x05F9, 0x0138, \
+  0x02A0, 0x072F, 0x06A7, 0x0072, 0x01A1, 0x065C, 0xFFFF, 0x00A9, 0x0055, 0x05CA, 0x03F1, 0x072C, 0xFFFF, 0x044C, 0x008F, 0x04CD, \
+  0x053C, 0x00E0, 0x03C2, 0x0498, 0x04D4, 0x03A8, 0x06FF, 0x0534, 0x065D, 0x061B, 0x02C5, 0x0630, 0x0749, 0x062F, 0x062B, 0x0761, \
+  0x0047, 0x0563, 0x026B, 0x024C, 0x01FA, 0x0550, 0x0721, 0xFFFF, 0x0567, 0x06C8, 0x02FC, 0x06E3, 0x012B, 0x04B8, 0x0290, 0xFFFF, \
+  0x0530, 0x076A, 0x0743, 0x06A9, 0xFFFF, 0x051F, 0x003F, 0x04B3, 0x03BC, 0x02A9, 0x04A8, 0x044A, 0x041E, 0x0612, 0x04BB, 0x0539, \
+  0x04C6, 0x05EA, 0xFFFF, 0x01EF, 0x03FF, 0x0149, 0x048D, 0x0464, 0x0676, 0x0468, 0x05B7, 0x0698, 0x048E, 0x01E6, 0x0205, 0x0270, \
+  0xFFFF, 0x01F4, 0x04F9, 0x0694, 0x0155, 0x06F1, 0x03C9, 0x02BD, 0x0136, 0x020D, 0x074B, 0x0065, 0x03CF, 0x030F, 0x038A, 0x03BD, \
+  0x023F, 0x005D, 0x009E, 0x06BF, 0x071A, 0x03CB, 0x0546, 0x019E, 0x010F, 0xFFFF, 0x040F, 0x065A, 0x0161, 0x0006, 0x032C, 0xFFFF, \
+  0x0019, 0x06B0, 0x0099, 0x06AE, 0xFFFF, 0xFFFF, 0x03B0, 0x0241, 0x0259, 0x0333, 0x0113, 0x0476, 0x01DD, 0x0663, 0x017F, 0x02D2, \
+  0x077E, 0x02A6, 0x0076, 0x05DA, 0x0017, 0x0366, 0x069D, 0x001D, 0x0459, 0x02D5, 0x001C, 0x0018, 0x0054, 0x00F2, 0x0371, 0x021A, \
+  0xFFFF, 0x0003, 0x0608, 0x0321, 0x0310, 0x00CC, 0x0422, 0x02B5, 0x0405, 0x03B3, 0x0375, 0x0020, 0x0216, 0x0000, 0x01FE, 0x05F7, \
+  0x0691, 0x05C4, 0x04F6, 0x0439, 0x0688, 0x0495, 0x04A2, 0x0339, 0x0189, 0x0500, 0x062C, 0x06C2, 0x03CC, 0x00C4, 0x044E, 0x0182, \
+  0x0469, 0x0449, 0x060C, 0x04CA, 0x0585, 0x071C, 0x0516, 0xFFFF, 0x000A, 0x0129, 0x021B, 0x06CD, 0xFFFF, 0x0210, 0x0735, 0x033D, \
+  0x067C, 0x011A, 0x06A3, 0x0246, 0x0021, 0x06B5, 0x002F, 0x028B, 0x05C7, 0x023E, 0x0036, 0x023A, 0x0128, 0x02FA, 0x0463, 0x0408, \
+  0x05A4, 0x04E5, 0x03CD, 0x0657, 0x01D7, 0x04A3, 0x05F2, 0x015F, 0x0677, 0x01C2, 0x05F0, 0x06C0, 0x00EB, 0x0112, 0x006E, 0x06F8, \
+  0x0501, 0x0715, 0x0389, 0x0181, 0x0685, 0x04D3, 0x063E, 0x06E1, 0x0717, 0x0235, 0x0253, 0x0104, 0x037F, 0x02B4, 0x00D8, 0x06E4, \
+  0x0102, 0x0701, 0x05C6, 0x03DE, 0x0605, 0x03D8, 0x0254, 0x0604, 0x071F, 0x076C, 0x01F1, 0x013B, 0xFFFF, 0x041F, 0x00CB, 0x003A, \
+  0x06AC, 0x0416, 0x056E, 0x0343, 0x076F, 0xFFFF, 0x0418, 0x0317, 0x00BC, 0x05FA, 0x0002, 0x0323, 0x0355, 0x045F, 0x0696, 0xFFFF, \
+  0x0048, 0x0744, 0x0320, 0x0738, 0x0078, 0xFFFF, 0x0089, 0x028A, 0x0751, 0x0331, 0x0695, 0x0664, 0x01F8, 0x0704, 0x0288, 0x0156, \
+  0x0785, 0x06E2, 0x073F, 0x04AE, 0x053F, 0x06CE, 0x01F9, 0x0222, 0x032F, 0x015E, 0x039C, 0x06C9, 0x0069, 0x0679, 0x00E2, 0x02D7, \
+  0x02DA, 0x05D9, 0x0517, 0x00F1, 0x06BE, 0x0088, 0x0056, 0x04A7, 0x0247, 0x0168, 0x06F5, 0x04DD, 0xFFFF, 0x068B, 0x0433, 0x003C, \
+  0x070E, 0x05D4, 0x0417, 0x031C, 0x0399, 0x039D, 0x016F, 0x0607, 0x0404, 0x01F0, 0x0527, 0x045D, 0x05A7, 0x035A, 0x01D5, 0x03BF, \
+  0x0281, 0x0178, 0x06B2, 0x06AF, 0x0302, 0xFFFF, 0x05DB, 0x04A1, 0x00D7, 0x0437, 0x0755, 0x0239, 0x04B7, 0x05A0, 0x05F3, 0x0668, \
+  0x006B, 0x05C5, 0x0693, 0x01DC, 0x02B8, 0x03D2, 0x0680, 0x037B, 0x067B, 0x0635, 0x0068, 0x02C9, 0x06F9, 0x070F, 0x0616, 0x055B, \
+  0x02A4, 0x02C6, 0x0217, 0x0183, 0x0127, 0x0626, 0x06E7, 0x04C7, 0x06C6, 0x00AB, 0xFFFF, 0x0101, 0x0212, 0x045A, 0x01EC, 0x0243, \
+  0x033E, 0x01A8, 0x04A5, 0x00FB, 0x0211, 0x06B9, 0x02CB, 0x04F5, 0x06C3, 0x008D, 0x04E2, 0x037E, 0x0372, 0x0008, 0x035C, 0x04F2, \
+  0x00B7, 0x0090, 0x0176, 0x057C, 0x0318, 0x02C8, 0x0134, 0x025D, 0x012C, 0x01A2, 0x01BC, 0x013E, 0x030A, 0x00F6, 0x0503, 0x060B, \
+  0x020F, 0x00BB, 0x0280, 0x01AF, 0x01D2, 0x0060, 0x0700, 0x0016, 0x0592, 0x0194, 0x02F6, 0x03C5, 0x057E, 0x047D, 0x03ED, 0x0572, \
+  0x0051, 0x075E, 0x04AF, 0x0487, 0x006C, 0x0026, 0x058B, 0x05A5, 0x03DD, 0x0387, 0x0610, 0x06A6, 0x03EB, 0x056D, 0x01E9, 0x0725, \
+  0x06D9, 0x042D, 0x0779, 0x01BD, 0x067E, 0x014C, 0x0621, 0x03DB, 0x01B4, 0x0066, 0x01DE, 0x0200, 0x066F, 0x01C3, 0x039A, 0x0324, \
+  0x05F8, 0x0521, 0x036E, 0x03DC, 0x050C, 0x0558, 0x012A, 0x02F1, 0x058F, 0x0631, 0x00BE, 0x00F3, 0x0506, 0x0632, 0x04DA, 0x038D, \
+  0x00C5, 0x05AF, 0x0581, 0x041D, 0x01D9, 0x0164, 0x0273, 0x0374, 0x0472, 0x007B, 0x050F, 0x066A, 0x04EA, 0x0458, 0x06EC, 0x0768, \
+  0x0096, 0xFFFF, 0x0356, 0x074D, 0x0678, 0xFFFF, 0x0171, 0x00AC, 0x008A, 0x03F4, 0x0420, 0x0729, 0x03D1, 0x053D, 0x04EC, 0x0316, \
+  0x053A, 0x0376, 0x0674, 0x047B, 0x0511, 0x0671, 0x054A, 0x01F5, 0x037D, 0x0666, 0x0093, 0x0783, 0x0640, 0xFFFF, 0x0787, 0x010A, \
+  0x014F, 0x0759, 0x01D3, 0x0238, 0x0730, 0x04CE, 0x02BA, 0x064A, 0x0747, 0x0421, 0x0574, 0x072A, 0x071B, 0x03D9, 0xFFFF, 0x034A, \
+  0x045C, 0xFFFF, 0x009C, 0x0121, 0x046D, 0x0767, 0x05AE, 0xFFFF, 0x060D, 0x026F, 0x04D7, 0x055A, 0x0508, 0x05E2, 0x025C, 0x02D8, \
+  0x01B5, 0x05AA, 0x0757, 0x04E0, 0x074C, 0x076E, 0x041B, 0xFFFF, 0x0739, 0x06DF, 0x00DB, 0x0357, 0x063C, 0x0748, 0x044D, 0x01C7, \
+  0x0545, 0x00F0, 0x0713, 0x01AA, 0x0046, 0x01AE, 0x0341, 0x03FE, 0x000D, 0x03C6, 0x0256, 0x004C, 0x0446, 0x0094, 0x0642, 0x01B2, \
+  0x02B2, 0x03B6, 0x01AD, 0x0648, 0x05FF, 0x04B1, 0x0712, 0x00F8, 0x0325, 0x04C2, 0x02DD, 0x0380, 0x008C, 0x03AB, 0x0535, 0x001B, \
+  0x0562, 0x012D, 0x03C1, 0x06E0, 0x00DE, 0x0137, 0x0708, 0x03F5, 0x0513, 0x00A4, 0x0233, 0x04AA, 0x0424, 0x05FC, 0x0226, 0x0225, \
+  0x05B4, 0x068A, 0x0659, 0x01B3, 0x0457, 0x0251, 0x0641, 0x05D6, 0x0643, 0x05BF, 0x0264, 0x0719, 0x0388, 0x01BE, 0x01A0, 0x0126, \
+  0x01C5, 0x041C, 0x0590, 0x062E, 0x01FB, 0x0667, 0x0754, 0x049B, 0x06E8, 0x077A, 0x030D, 0x0756, 0x0098, 0x0686, 0x0013, 0x02EA, \
+  0x02CC, 0x0447, 0x051B, 0x0559, 0x0716, 0x0519, 0x0636, 0x02AB, 0x0086, 0x0523, 0x03AA, 0x008B, 0x0448, 0x04E4, 0x05C0, 0x00F4, \
+  0x00A6, 0x0597, 0x006A, 0x028D, 0x0252, 0x009D, 0x0720, 0x05EB, 0x054B, 0x0274, 0x0300, 0x0192, 0x0292, 0x0540, 0x03FB, 0x047C, \
+  0x0706, 0x01D4, 0x064F, 0x0151, 0x034E, 0x03DA, 0x06FB, 0x02AF, 0x0722, 0x0576, 0x00B3, 0x02AC, 0x0532, 0x05E8, 0xFFFF, 0x04D1, \
+  0xFFFF, 0x00A3, 0x03E2, 0x02D0, 0x0285, 0x063A, 0x03F0, 0x020B, 0x042A, 0x0510, 0x0637, 0x0032, 0x0775, 0x0658, 0x02D9, 0x0092, \
+  0x0213, 0x0025, 0x0782, 0x0477, 0x0724, 0x0267, 0x0615, 0x0528, 0x043B, 0x06D7, 0x01F6, 0x06CF, 0x0656, 0x00C9, 0x03B9, 0x03F9, \
+  0x022F, 0x05D0, 0x040A, 0x03A2, 0x0297, 0x0319, 0xFFFF, 0x05ED, 0x0231, 0x059C, 0x03F8, 0x05CF, 0x05B0, 0x0577, 0x0714, 0xFFFF, \
+  0x0600, 0x0584, 0x0110, 0x0386, 0x022B, 0x0206, 0x0475, 0x06B7, 0x0059, 0xFFFF, 0x00D2, 0x004A, 0x01DB, 0x0004, 0x0198, 0x0582
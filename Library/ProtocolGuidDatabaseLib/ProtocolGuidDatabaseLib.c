@@ -1,20 +1,277 @@
 #include <Library/CommonMacrosLib.h>
 #include <Library/ProtocolGuidDatabaseLib.h>
+#include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/VectorLib.h>
+#include <Library/HashMapLib.h>
 #include "GeneratedProtocolGuidDatabase.h"
 
-typedef struct
-{
-  EFI_GUID *Guid;
-  CHAR16   *Name;
-} KNOWN_PROTOCOL_DB_ENTRY;
+// БД лежит в образе тремя непрерывными массивами: GUID'ы подряд,
+// смещения имён и единый ASCII-пул имён, индекс у всех трёх общий.
+STATIC EFI_GUID gProtocolDatabaseGuids[GUID_DB_COUNT] = {
+  GUID_DB_GUIDS
+};
+
+STATIC CONST UINT32 gProtocolDatabaseNameOffsets[GUID_DB_COUNT] = {
+  GUID_DB_NAME_OFFSETS
+};
+
+STATIC CONST CHAR8 gProtocolDatabaseNamePool[] = {
+  GUID_DB_NAME_POOL
+};
+
+// Совершенная хэш-таблица по GUID'ам БД, генерится скриптом вместе с самой БД.
+STATIC CONST UINT16 gProtocolDatabaseDisplacements[GUID_DB_HASH_BUCKET_COUNT] = {
+  GUID_DB_HASH_DISPLACEMENTS
+};
+
+STATIC CONST UINT16 gProtocolDatabaseSlots[GUID_DB_HASH_SLOT_COUNT] = {
+  GUID_DB_HASH_SLOTS
+};
+
+#define KNOWN_GUID_COUNT GUID_DB_COUNT
+STATIC_ASSERT (KNOWN_GUID_COUNT > 0, "Protocol database is empty");
+STATIC_ASSERT (sizeof (gProtocolDatabaseNamePool) >= GUID_DB_NAME_POOL_SIZE, "Protocol name pool is truncated");
+STATIC_ASSERT (KNOWN_GUID_COUNT < GUID_DB_HASH_EMPTY_SLOT, "Protocol database is too large for UINT16 slots");
+STATIC_ASSERT ((GUID_DB_HASH_BUCKET_COUNT & (GUID_DB_HASH_BUCKET_COUNT - 1)) == 0, "Bucket count must be a power of 2");
+STATIC_ASSERT ((GUID_DB_HASH_SLOT_COUNT   & (GUID_DB_HASH_SLOT_COUNT   - 1)) == 0, "Slot count must be a power of 2");
+
+// -----------------------------------------------------------------------------
+/**
+ * Представление БД, по которому идёт поиск.
+ * Одинаково описывает как встроенную БД, так и загруженную из файла:
+ * все указатели смотрят в неизменяемые массивы, поиск идёт прямо по ним.
+*/
+typedef struct {
+  UINTN          Count;
+  UINTN          BucketCount;
+  UINTN          SlotCount;
+  UINTN          NamePoolSize;
+  CONST EFI_GUID *Guids;
+  CONST UINT32   *NameOffsets;
+  CONST CHAR8    *NamePool;
+  CONST UINT16   *Displacements;
+  CONST UINT16   *Slots;
+} GUID_DATABASE;
 
-STATIC KNOWN_PROTOCOL_DB_ENTRY gProtocolDatabase[] = {
-  GUID_DB
+STATIC CONST GUID_DATABASE gBuiltInDatabase = {
+  GUID_DB_COUNT,
+  GUID_DB_HASH_BUCKET_COUNT,
+  GUID_DB_HASH_SLOT_COUNT,
+  sizeof (gProtocolDatabaseNamePool),
+  gProtocolDatabaseGuids,
+  gProtocolDatabaseNameOffsets,
+  gProtocolDatabaseNamePool,
+  gProtocolDatabaseDisplacements,
+  gProtocolDatabaseSlots
 };
 
-#define KNOWN_GUID_COUNT (sizeof(gProtocolDatabase) / sizeof(gProtocolDatabase[0]))
-_Static_assert (KNOWN_GUID_COUNT > 0, "Protocol database is empty");
+// БД из guiddb.bin; пока файл не загружен, Count == 0.
+STATIC GUID_DATABASE gExternalDatabase;
+
+// -----------------------------------------------------------------------------
+// Формат guiddb.bin, должен совпадать с make_guid_db_from_edk2_guids.py.
+// Все числа little-endian, за заголовком подряд идут массивы:
+//   EFI_GUID Guids[Count];
+//   UINT32   NameOffsets[Count];
+//   UINT16   Displacements[BucketCount];
+//   UINT16   Slots[SlotCount];
+//   CHAR8    NamePool[NamePoolSize];
+#define GUID_DB_FILE_NAME       L"guiddb.bin"
+#define GUID_DB_FILE_SIGNATURE  SIGNATURE_32 ('G', 'D', 'B', 'F')
+#define GUID_DB_FILE_VERSION    1
+#define GUID_DB_FILE_MAX_SIZE   (16 * 1024 * 1024)
+
+#pragma pack(1)
+typedef struct {
+  UINT32 Signature;
+  UINT32 Version;
+  UINT32 Count;
+  UINT32 BucketCount;
+  UINT32 SlotCount;
+  UINT32 NamePoolSize;
+  UINT32 Reserved[2];
+} GUID_DB_FILE_HEADER;
+#pragma pack()
+
+STATIC_ASSERT (sizeof (GUID_DB_FILE_HEADER) == 32, "guiddb.bin header size mismatch");
+
+// -----------------------------------------------------------------------------
+/**
+ * Элемент таблицы интернированных GUID'ов, индекс в таблице и есть PROTOCOL_GUID_ID.
+*/
+typedef struct {
+  EFI_GUID    Guid;
+  CONST CHAR8 *Name;            // NULL, если имя неизвестно.
+  BOOLEAN     NameResolved;     // Name уже искалось в БД.
+} INTERNED_GUID;
+
+DECLARE_TYPED_VECTOR (INTERNED_GUID)
+
+STATIC VECTOR  gInternedGuids;                    // тип элемента = INTERNED_GUID
+STATIC BOOLEAN gInternedGuidsConstructed;
+
+// Идентификаторы GUID'ов встроенной БД по их индексу в ней, хранится ID + 1, 0 - ещё не встречался.
+// Позволяет интернировать известный GUID одной пробой хэш-таблицы, без перебора.
+STATIC UINT16  gKnownGuidIds[GUID_DB_COUNT];
+
+// Идентификаторы GUID'ов, которых нет во встроенной БД: GUID -> PROTOCOL_GUID_ID.
+STATIC HASH_MAP gUnknownGuidIds;
+
+#define INTERNED_GUIDS_INITIAL_COUNT 128
+
+// Сколько новых GUID'ов InternProtocolGuid() может интернировать на TPL_HIGH_LEVEL,
+// где нельзя выделять память, до следующего ReserveProtocolGuidIds().
+#define INTERNED_GUIDS_RESERVE_COUNT 32
+
+STATIC CONST EFI_GUID gInvalidGuidIdGuid = { 0 };
+
+// -----------------------------------------------------------------------------
+// Параметры хэш-функции, должны совпадать с make_guid_db_from_edk2_guids.py.
+#define GUID_HASH_SEED_MUL   0x9E3779B97F4A7C15ull
+#define GUID_HASH_FMIX_MUL1  0xFF51AFD7ED558CCDull
+#define GUID_HASH_FMIX_MUL2  0xC4CEB9FE1A85EC53ull
+
+// -----------------------------------------------------------------------------
+/**
+ * Финализатор MurmurHash3, перемешивает все биты значения.
+*/
+STATIC
+UINT64
+Fmix64 (
+  IN UINT64 Value
+  )
+{
+  Value ^= Value >> 33;
+  Value *= GUID_HASH_FMIX_MUL1;
+  Value ^= Value >> 33;
+  Value *= GUID_HASH_FMIX_MUL2;
+  Value ^= Value >> 33;
+  return Value;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Хэш GUID'а с затравкой Seed.
+ * GUID рассматривается как два 64-битных числа в порядке little-endian.
+*/
+STATIC
+UINT64
+GuidHash (
+  IN CONST EFI_GUID *Guid,
+  IN UINT64         Seed
+  )
+{
+  UINT64 Low  = ReadUnaligned64 ((CONST UINT64 *)Guid);
+  UINT64 High = ReadUnaligned64 ((CONST UINT64 *)Guid + 1);
+
+  return Fmix64 (Fmix64 ((Seed * GUID_HASH_SEED_MUL) ^ Low) ^ High);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет GUID в БД Database за одну пробу совершенной хэш-таблицы.
+ *
+ * @retval Индекс GUID'а в БД, либо GUID_DB_HASH_EMPTY_SLOT, если его там нет.
+*/
+STATIC
+UINTN
+FindProtocolIndex (
+  IN CONST GUID_DATABASE *Database,
+  IN CONST EFI_GUID      *Guid
+  )
+{
+  if (Database->Count == 0) {
+    return GUID_DB_HASH_EMPTY_SLOT;
+  }
+
+  UINTN Bucket = (UINTN)GuidHash (Guid, 0) & (Database->BucketCount - 1);
+  UINTN Slot   = (UINTN)GuidHash (Guid, Database->Displacements[Bucket]) & (Database->SlotCount - 1);
+  UINTN Index  = Database->Slots[Slot];
+
+  // Неизвестный GUID тоже попадает в какой-то слот, поэтому сравнение обязательно.
+  if (Index == GUID_DB_HASH_EMPTY_SLOT || !CompareGuid (Guid, &Database->Guids[Index])) {
+    return GUID_DB_HASH_EMPTY_SLOT;
+  }
+
+  return Index;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Проверяет, что содержимое guiddb.bin целиком корректно, и заполняет по нему Database.
+ * После успешной проверки поиск по БД не может выйти за пределы Buffer.
+ *
+ * @retval EFI_SUCCESS            Database заполнена и указывает внутрь Buffer.
+ * @retval EFI_VOLUME_CORRUPTED   Файл повреждён либо имеет неизвестный формат.
+*/
+STATIC
+EFI_STATUS
+ParseDatabaseFile (
+  IN  CONST UINT8   *Buffer,
+  IN  UINTN         BufferSize,
+  OUT GUID_DATABASE *Database
+  )
+{
+  CONST GUID_DB_FILE_HEADER *Header = (CONST GUID_DB_FILE_HEADER *)Buffer;
+
+  if (BufferSize < sizeof (GUID_DB_FILE_HEADER)
+    || Header->Signature != GUID_DB_FILE_SIGNATURE
+    || Header->Version   != GUID_DB_FILE_VERSION) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  if (Header->Count == 0
+    || Header->Count >= GUID_DB_HASH_EMPTY_SLOT
+    || Header->BucketCount == 0 || (Header->BucketCount & (Header->BucketCount - 1)) != 0
+    || Header->SlotCount   == 0 || (Header->SlotCount   & (Header->SlotCount   - 1)) != 0
+    || Header->SlotCount < Header->Count
+    || Header->NamePoolSize == 0) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  // Все величины 32-битные, поэтому в UINT64 переполнения быть не может.
+  UINT64 GuidsOffset         = sizeof (GUID_DB_FILE_HEADER);
+  UINT64 NameOffsetsOffset   = GuidsOffset         + (UINT64)Header->Count       * sizeof (EFI_GUID);
+  UINT64 DisplacementsOffset = NameOffsetsOffset   + (UINT64)Header->Count       * sizeof (UINT32);
+  UINT64 SlotsOffset         = DisplacementsOffset + (UINT64)Header->BucketCount * sizeof (UINT16);
+  UINT64 NamePoolOffset      = SlotsOffset         + (UINT64)Header->SlotCount   * sizeof (UINT16);
+  UINT64 ExpectedSize        = NamePoolOffset      + Header->NamePoolSize;
+
+  if (ExpectedSize != BufferSize) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  Database->Count         = Header->Count;
+  Database->BucketCount   = Header->BucketCount;
+  Database->SlotCount     = Header->SlotCount;
+  Database->NamePoolSize  = Header->NamePoolSize;
+  Database->Guids         = (CONST EFI_GUID *)(Buffer + GuidsOffset);
+  Database->NameOffsets   = (CONST UINT32   *)(Buffer + NameOffsetsOffset);
+  Database->Displacements = (CONST UINT16   *)(Buffer + DisplacementsOffset);
+  Database->Slots         = (CONST UINT16   *)(Buffer + SlotsOffset);
+  Database->NamePool      = (CONST CHAR8    *)(Buffer + NamePoolOffset);
+
+  // Пул должен заканчиваться '\0', тогда любое имя внутри него терминировано.
+  if (Database->NamePool[Database->NamePoolSize - 1] != '\0') {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  for (UINTN Index = 0; Index < Database->Count; ++Index) {
+    if (Database->NameOffsets[Index] >= Database->NamePoolSize) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+  }
+
+  for (UINTN Slot = 0; Slot < Database->SlotCount; ++Slot) {
+    if (Database->Slots[Slot] != GUID_DB_HASH_EMPTY_SLOT && Database->Slots[Slot] >= Database->Count) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
 
 // -----------------------------------------------------------------------------
 /**
@@ -23,11 +280,11 @@ _Static_assert (KNOWN_GUID_COUNT > 0, "Protocol database is empty");
  * @param Guid                      Указатель на GUID протокола.
  *
  * @retval NULL                     Протокол не найден в БД.
- * @return Указатель на строку, содержащую имя протокола.
+ * @return Указатель на ASCII-строку, содержащую имя протокола.
  *         Данная строка существует на протяжении всей жизни программы,
- *         перезаписывать её не следует.
+ *         перезаписывать её не следует. Печатать через "%a".
  */
-CHAR16 *
+CONST CHAR8 *
 GetProtocolName (
   IN EFI_GUID *Guid
   )
@@ -39,22 +296,372 @@ DBG_ENTER ();
     return NULL;
   }
 
-  // По-хорошему, следовало бы сделать это в виде поиска по дереву, например.
-  // Но потери в скорости из-за линейного поиска не критичны.
-  for (UINTN Index = 0; Index < KNOWN_GUID_COUNT; ++Index) {
-    if (CompareGuid (Guid, gProtocolDatabase[Index].Guid)) {
-      DBG_EXIT_STATUS (EFI_SUCCESS);
-      return gProtocolDatabase[Index].Name;
+  // Вызывается на каждое форматируемое событие, поэтому поиск за O(1)
+  // как для известных, так и для неизвестных GUID'ов.
+  // Сначала смотрим в загруженный guiddb.bin, встроенная БД - запасной вариант.
+  UINTN Index = FindProtocolIndex (&gExternalDatabase, Guid);
+  if (Index != GUID_DB_HASH_EMPTY_SLOT) {
+    DBG_EXIT_STATUS (EFI_SUCCESS);
+    return &gExternalDatabase.NamePool[gExternalDatabase.NameOffsets[Index]];
+  }
+
+  Index = FindProtocolIndex (&gBuiltInDatabase, Guid);
+  if (Index == GUID_DB_HASH_EMPTY_SLOT) {
+    DBG_EXIT_STATUS (EFI_NOT_FOUND);
+    return NULL;
+  }
+
+  DBG_EXIT_STATUS (EFI_SUCCESS);
+  return &gBuiltInDatabase.NamePool[gBuiltInDatabase.NameOffsets[Index]];
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Готовит таблицы интернированных GUID'ов к тому, чтобы InternProtocolGuid() мог
+ * добавить в них ещё несколько десятков GUID'ов без выделения памяти, т.е. и на TPL_HIGH_LEVEL.
+ * При первом вызове создаёт таблицы.
+ * Вызывается заранее потребителем библиотеки и самим InternProtocolGuid(), когда запас кончился.
+ * Вызывать на TPL не выше TPL_NOTIFY.
+ *
+ * @retval EFI_SUCCESS              Запас есть.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ */
+EFI_STATUS
+ReserveProtocolGuidIds (
+  )
+{
+  EFI_STATUS Status = EFI_SUCCESS;
+
+  // InternProtocolGuid() сам вызывается не выше TPL_NOTIFY, поэтому TPL_NOTIFY
+  // достаточно, чтобы он не застал таблицы наполовину пополненными.
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+
+  if (!gInternedGuidsConstructed) {
+    Status = Vector_Construct (&gInternedGuids, sizeof (INTERNED_GUID), INTERNED_GUIDS_INITIAL_COUNT);
+    if (!EFI_ERROR (Status)) {
+      Status = HashMap_Construct (&gUnknownGuidIds, HashMapKeyGuid, sizeof (PROTOCOL_GUID_ID), INTERNED_GUIDS_INITIAL_COUNT);
+      if (EFI_ERROR (Status)) {
+        Vector_Destruct (&gInternedGuids);
+      }
+    }
+    if (!EFI_ERROR (Status)) {
+      gUnknownGuidIds.NoGrow    = TRUE;
+      gInternedGuidsConstructed = TRUE;
     }
   }
 
-  DBG_EXIT_STATUS (EFI_NOT_FOUND);
-  return NULL;
+  // Vector_Reserve() выделяет ровно столько, сколько попросили, поэтому растём вдвое, как Vector_PushBack().
+  UINTN Required = Vector_Size (&gInternedGuids) + INTERNED_GUIDS_RESERVE_COUNT;
+  if (!EFI_ERROR (Status) && gInternedGuids.CountAllocated < Required) {
+    Status = Vector_Reserve (&gInternedGuids, MAX (Required, gInternedGuids.CountAllocated * 2));
+  }
+  if (!EFI_ERROR (Status)) {
+    Status = HashMap_Reserve (&gUnknownGuidIds, HashMap_Size (&gUnknownGuidIds) + INTERNED_GUIDS_RESERVE_COUNT);
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Status;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет идентификатор GUID'а и при необходимости выдаёт новый.
+ * Вызывается на TPL_HIGH_LEVEL, память не выделяет.
+ *
+ * @retval EFI_SUCCESS              В Id идентификатор, либо PROTOCOL_GUID_ID_INVALID, если они кончились.
+ * @retval EFI_OUT_OF_RESOURCES     Запас таблиц кончился, нужен ReserveProtocolGuidIds().
+*/
+STATIC
+EFI_STATUS
+InternProtocolGuidLocked (
+  IN  CONST EFI_GUID   *Guid,
+  OUT PROTOCOL_GUID_ID *Id
+  )
+{
+  EFI_STATUS Status;
+
+  *Id = PROTOCOL_GUID_ID_INVALID;
+
+  if (!gInternedGuidsConstructed) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  // Известные GUID'ы находим через совершенную хэш-таблицу встроенной БД,
+  // остальные - через отдельную хэш-таблицу неизвестных GUID'ов.
+  UINTN KnownIndex = FindProtocolIndex (&gBuiltInDatabase, Guid);
+  if (KnownIndex != GUID_DB_HASH_EMPTY_SLOT) {
+    if (gKnownGuidIds[KnownIndex] != 0) {
+      *Id = gKnownGuidIds[KnownIndex] - 1;
+      return EFI_SUCCESS;
+    }
+  } else {
+    PROTOCOL_GUID_ID *UnknownId = HashMap_Find (&gUnknownGuidIds, Guid);
+    if (UnknownId != NULL) {
+      *Id = *UnknownId;
+      return EFI_SUCCESS;
+    }
+  }
+
+  if (Vector_Size (&gInternedGuids) >= PROTOCOL_GUID_ID_INVALID) {
+    return EFI_SUCCESS;
+  }
+
+  // Vector_PushBack_INTERNED_GUID() выделил бы память сам, поэтому место проверяем заранее.
+  if (gInternedGuids.CountUsed == gInternedGuids.CountAllocated) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  INTERNED_GUID NewEntry;
+  CopyGuid (&NewEntry.Guid, Guid);
+  NewEntry.Name         = NULL;
+  NewEntry.NameResolved = FALSE;
+
+  PROTOCOL_GUID_ID NewId = (PROTOCOL_GUID_ID)Vector_Size (&gInternedGuids);
+  if (KnownIndex == GUID_DB_HASH_EMPTY_SLOT) {
+    Status = HashMap_Insert (&gUnknownGuidIds, Guid, &NewId);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  } else {
+    gKnownGuidIds[KnownIndex] = NewId + 1;
+  }
+
+  Vector_PushBack_INTERNED_GUID (&gInternedGuids, &NewEntry);
+  *Id = NewId;
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает компактный идентификатор GUID'а протокола.
+ * Одинаковые GUID'ы всегда получают один и тот же идентификатор,
+ * поэтому в событиях достаточно хранить его вместо самого GUID'а.
+ * Можно вызывать на любом TPL. Выше TPL_NOTIFY новые GUID'ы интернируются
+ * только из запаса, см. ReserveProtocolGuidIds().
+ *
+ * @param Guid                      Указатель на GUID протокола.
+ *
+ * @retval PROTOCOL_GUID_ID_INVALID Guid == NULL, либо не хватило памяти или идентификаторов.
+ * @return Идентификатор GUID'а.
+ */
+PROTOCOL_GUID_ID
+InternProtocolGuid (
+  IN CONST EFI_GUID *Guid
+  )
+{
+  DBG_ENTER ();
+
+  if (Guid == NULL) {
+    DBG_EXIT_STATUS (EFI_INVALID_PARAMETER);
+    return PROTOCOL_GUID_ID_INVALID;
+  }
+
+  EFI_STATUS       Status;
+  PROTOCOL_GUID_ID Id;
+  EFI_TPL          OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  Status = InternProtocolGuidLocked (Guid, &Id);
+  gBS->RestoreTPL (OldTpl);
+
+  // Запас кончился (или таблиц ещё нет): пополняем его, если вызвавший код сам не выше TPL_NOTIFY.
+  // Пока TPL был опущен, GUID мог интернировать кто-то другой, поэтому ищем его заново.
+  if (EFI_ERROR (Status) && OldTpl <= TPL_NOTIFY && !EFI_ERROR (ReserveProtocolGuidIds ())) {
+    OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+    Status = InternProtocolGuidLocked (Guid, &Id);
+    gBS->RestoreTPL (OldTpl);
+  }
+
+  DBG_EXIT_STATUS (Status);
+  return Id;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Копирует в Guid GUID протокола с идентификатором Id.
+ *
+ * @param Id                        Идентификатор, полученный от InternProtocolGuid().
+ * @param Guid                      Сюда записывается GUID. Для неизвестного Id - нулевой GUID.
+ *
+ * @retval EFI_SUCCESS              GUID записан.
+ * @retval EFI_NOT_FOUND            Такой Id не выдавался, записан нулевой GUID.
+ */
+EFI_STATUS
+GetInternedProtocolGuid (
+  IN  PROTOCOL_GUID_ID Id,
+  OUT EFI_GUID         *Guid
+  )
+{
+  EFI_STATUS Status = EFI_NOT_FOUND;
+  EFI_TPL    OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  CopyGuid (Guid, &gInvalidGuidIdGuid);
+  if (gInternedGuidsConstructed && Id < Vector_Size (&gInternedGuids)) {
+    INTERNED_GUID *Entry = Vector_Get_INTERNED_GUID (&gInternedGuids, Id);
+    CopyGuid (Guid, &Entry->Guid);
+    Status = EFI_SUCCESS;
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Status;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает имя протокола с идентификатором Id.
+ * Поиск в БД выполняется только при первом запросе для каждого Id, дальше имя берётся из таблицы.
+ *
+ * @param Id                        Идентификатор, полученный от InternProtocolGuid().
+ *
+ * @retval NULL                     Протокол не найден в БД, либо такой Id не выдавался.
+ * @return Указатель на ASCII-строку, содержащую имя протокола.
+ *         Данная строка существует на протяжении всей жизни программы,
+ *         перезаписывать её не следует. Печатать через "%a".
+ */
+CONST CHAR8 *
+GetInternedProtocolName (
+  IN PROTOCOL_GUID_ID Id
+  )
+{
+  CONST CHAR8 *Name  = NULL;
+  EFI_TPL     OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  if (gInternedGuidsConstructed && Id < Vector_Size (&gInternedGuids)) {
+    INTERNED_GUID *Entry = Vector_Get_INTERNED_GUID (&gInternedGuids, Id);
+    if (!Entry->NameResolved) {
+      Entry->Name         = GetProtocolName (&Entry->Guid);
+      Entry->NameResolved = TRUE;
+    }
+    Name = Entry->Name;
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Name;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Сбрасывает закэшированные имена интернированных GUID'ов.
+ * Нужно после загрузки guiddb.bin: в нём могут найтись имена, которых нет во встроенной БД.
+*/
+STATIC
+VOID
+ForgetInternedProtocolNames (
+  )
+{
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  if (gInternedGuidsConstructed) {
+    FOR_EACH_TYPED_VCT (INTERNED_GUID, Entry, gInternedGuids) {
+      Entry->Name         = NULL;
+      Entry->NameResolved = FALSE;
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Загружает дополнительную БД имён протоколов из файла guiddb.bin в корне тома Root.
+ * Файл читается один раз, целиком, в единый буфер, поиск затем идёт прямо по нему.
+ * Загруженная БД имеет приоритет над встроенной в GetProtocolName().
+ * На GetProtocolGuidCount() и GetProtocolGuid() не влияет.
+ *
+ * @param Root                    Корень файловой системы.
+ *
+ * @retval EFI_SUCCESS            БД загружена.
+ * @retval EFI_ALREADY_STARTED    БД уже была загружена ранее, повторно не загружается.
+ * @retval EFI_NOT_FOUND          Файла нет.
+ * @retval EFI_VOLUME_CORRUPTED   Файл повреждён, используется только встроенная БД.
+ * @retval Что-то другое.         Ошибка чтения или выделения памяти.
+ */
+EFI_STATUS
+LoadProtocolGuidDatabaseFromFile (
+  IN EFI_FILE_PROTOCOL *Root
+  )
+{
+  DBG_ENTER ();
+
+  EFI_STATUS        Status;
+  EFI_FILE_PROTOCOL *File   = NULL;
+  UINT8             *Buffer = NULL;
+  UINT64            FileSize;
+  UINTN             ReadSize;
+
+  if (Root == NULL) {
+    DBG_EXIT_STATUS (EFI_INVALID_PARAMETER);
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (gExternalDatabase.Count != 0) {
+    DBG_EXIT_STATUS (EFI_ALREADY_STARTED);
+    return EFI_ALREADY_STARTED;
+  }
+
+  Status = Root->Open (Root, &File, GUID_DB_FILE_NAME, EFI_FILE_MODE_READ, 0);
+  RETURN_ON_ERR (Status)
+
+  // Размер узнаём позиционированием в конец файла, без выделения EFI_FILE_INFO.
+  Status = File->SetPosition (File, MAX_UINT64);
+  if (!EFI_ERROR (Status)) {
+    Status = File->GetPosition (File, &FileSize);
+  }
+  if (!EFI_ERROR (Status)) {
+    Status = File->SetPosition (File, 0);
+  }
+  if (EFI_ERROR (Status)) {
+    File->Close (File);
+    DBG_EXIT_STATUS (Status);
+    return Status;
+  }
+
+  if (FileSize < sizeof (GUID_DB_FILE_HEADER) || FileSize > GUID_DB_FILE_MAX_SIZE) {
+    File->Close (File);
+    DBG_EXIT_STATUS (EFI_VOLUME_CORRUPTED);
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  Status = gBS->AllocatePool (
+                  EfiBootServicesData,
+                  (UINTN)FileSize,
+                  (VOID **)&Buffer
+                  );
+  if (EFI_ERROR (Status)) {
+    File->Close (File);
+    DBG_EXIT_STATUS (Status);
+    return Status;
+  }
+
+  ReadSize = (UINTN)FileSize;
+  Status   = File->Read (File, &ReadSize, Buffer);
+  File->Close (File);
+  if (!EFI_ERROR (Status) && ReadSize != FileSize) {
+    Status = EFI_VOLUME_CORRUPTED;
+  }
+
+  if (!EFI_ERROR (Status)) {
+    Status = ParseDatabaseFile (Buffer, ReadSize, &gExternalDatabase);
+  }
+
+  if (EFI_ERROR (Status)) {
+    // Частично заполненное представление не должно использоваться для поиска.
+    ZeroMem (&gExternalDatabase, sizeof (gExternalDatabase));
+    gBS->FreePool (Buffer);
+    DBG_EXIT_STATUS (Status);
+    return Status;
+  }
+
+  ForgetInternedProtocolNames ();
+
+  // Буфер живёт до конца работы драйвера: на него ссылаются выданные имена.
+  DBG_INFO ("-- guiddb.bin is loaded: %u GUIDs\n", (unsigned)gExternalDatabase.Count);
+  DBG_EXIT_STATUS (EFI_SUCCESS);
+  return EFI_SUCCESS;
 }
 
 // -----------------------------------------------------------------------------
 /**
- * Возвращает количество известных GUID.
+ * Возвращает количество известных GUID во встроенной БД.
  *
  * @retval Количество известных GUID.
  */
@@ -86,7 +693,7 @@ GetProtocolGuid (
   }
 
   DBG_INFO ("-- Protocol GUID index: %u/%u\n", (unsigned)Index + 1, KNOWN_GUID_COUNT);
-  return gProtocolDatabase[Index].Guid;
+  return &gProtocolDatabaseGuids[Index];
 
   DBG_EXIT ();
 }
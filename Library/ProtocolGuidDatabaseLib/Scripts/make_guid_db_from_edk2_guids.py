@@ -1,4 +1,7 @@
+import argparse
+import io
 import os
+import struct
 
 import guids.ami_guids
 import guids.asrock_guids
@@ -50,6 +53,138 @@ def guid_from_global_var(var):
     return guid_name.lstrip('_')
 
 
+# Параметры хэш-функции должны совпадать с GuidHash() в ProtocolGuidDatabaseLib.c.
+UINT64_MASK         = 0xFFFFFFFFFFFFFFFF
+GUID_HASH_SEED_MUL  = 0x9E3779B97F4A7C15
+GUID_HASH_FMIX_MUL1 = 0xFF51AFD7ED558CCD
+GUID_HASH_FMIX_MUL2 = 0xC4CEB9FE1A85EC53
+EMPTY_SLOT          = 0xFFFF
+MAX_DISPLACEMENT    = 0xFFFF
+
+# Максимальная длина строкового литерала в MSVC (после склейки).
+MSVC_MAX_STRING_LITERAL = 65535
+
+# Источники GUID'ов в порядке приоритета: при совпадении имени или значения остаётся первый.
+VENDOR_GUID_LISTS = {
+    'EDK2':   guids.edk2_guids.edk2_guids,
+    'AMI':    guids.ami_guids.ami_guids,
+    'ASROCK': guids.asrock_guids.asrock_guids,
+    'DELL':   guids.dell_guids.dell_guids,
+    'LENOVO': guids.lenovo_guids.lenovo_guids,
+}
+
+# Токены имён, по которым GUID считается не относящимся к DXE-стадии.
+NON_DXE_NAME_TOKENS = {'PPI', 'PEI', 'PEIM', 'SEC'}
+
+# Формат guiddb.bin, должен совпадать с GUID_DB_FILE_HEADER в ProtocolGuidDatabaseLib.c.
+GUID_DB_FILE_SIGNATURE = b'GDBF'
+GUID_DB_FILE_VERSION   = 1
+GUID_DB_FILE_HEADER    = struct.Struct('<4s7I')
+
+DEFAULT_OUTPUT_PATH = os.path.join(
+    os.path.dirname(os.path.dirname(os.path.abspath(__file__))),
+    'GeneratedProtocolGuidDatabase.h'
+)
+
+
+def fmix64(h):
+    h ^= h >> 33
+    h = (h * GUID_HASH_FMIX_MUL1) & UINT64_MASK
+    h ^= h >> 33
+    h = (h * GUID_HASH_FMIX_MUL2) & UINT64_MASK
+    h ^= h >> 33
+    return h
+
+
+def guid_to_bytes(guid_value):
+    return struct.pack('<IHH8B', *guid_value)
+
+
+def guid_hash(guid_bytes, seed):
+    low, high = struct.unpack('<QQ', guid_bytes)
+    h = fmix64(((seed * GUID_HASH_SEED_MUL) & UINT64_MASK) ^ low)
+    return fmix64(h ^ high)
+
+
+def next_power_of_two(value):
+    result = 1
+    while result < value:
+        result <<= 1
+    return result
+
+
+def build_perfect_hash(guid_values):
+    # Двухуровневая схема "hash and displace":
+    #   Bucket = GuidHash(Guid, 0) % BucketCount
+    #   Slot   = GuidHash(Guid, Displacements[Bucket]) % SlotCount
+    # Для каждой корзины подбирается такое смещение, чтобы все её GUID'ы
+    # попали в свободные и различные слоты. В итоге любой поиск - одна проба.
+    #
+    # Начинаем с минимальных таблиц; если заполнение слишком плотное и подобрать
+    # смещения не удалось, увеличиваем сначала число корзин, затем число слотов.
+    keys       = [guid_to_bytes(value) for value in guid_values]
+    slot_count = next_power_of_two(len(keys))
+    while True:
+        for bucket_divisor in (8, 4, 2):
+            bucket_count = max(1, slot_count // bucket_divisor)
+            result = try_build_perfect_hash(keys, bucket_count, slot_count)
+            if result is not None:
+                return result
+        slot_count <<= 1
+
+
+def try_build_perfect_hash(keys, bucket_count, slot_count):
+
+    buckets = [[] for _ in range(bucket_count)]
+    for index, key in enumerate(keys):
+        buckets[guid_hash(key, 0) & (bucket_count - 1)].append(index)
+
+    displacements = [0] * bucket_count
+    slots         = [EMPTY_SLOT] * slot_count
+
+    for bucket_index in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        bucket = buckets[bucket_index]
+        if not bucket:
+            displacements[bucket_index] = 1
+            continue
+
+        for displacement in range(1, MAX_DISPLACEMENT + 1):
+            candidate = [guid_hash(keys[index], displacement) & (slot_count - 1) for index in bucket]
+            if len(set(candidate)) != len(candidate):
+                continue
+            if any(slots[slot] != EMPTY_SLOT for slot in candidate):
+                continue
+            for index, slot in zip(bucket, candidate):
+                slots[slot] = index
+            displacements[bucket_index] = displacement
+            break
+        else:
+            return None
+
+    # Самопроверка: каждый GUID находится ровно за одну пробу.
+    for index, key in enumerate(keys):
+        bucket = guid_hash(key, 0) & (bucket_count - 1)
+        slot   = guid_hash(key, displacements[bucket]) & (slot_count - 1)
+        assert slots[slot] == index
+
+    return bucket_count, slot_count, displacements, slots
+
+
+def format_uint_list(values, digits, per_line):
+    lines = []
+    for start in range(0, len(values), per_line):
+        lines.append('  ' + ', '.join('0x{:0{}X}'.format(value, digits) for value in values[start:start + per_line]))
+    return ', \\\n'.join(lines) + '\n'
+
+
+def format_uint16_list(values):
+    return format_uint_list(values, 4, 16)
+
+
+def format_uint32_list(values):
+    return format_uint_list(values, 8, 8)
+
+
 def add_guids(add_to, guids):
     for key in guids:
         guid_key   = guid_from_global_var(key)
@@ -60,45 +195,191 @@ def add_guids(add_to, guids):
     return add_to
 
 
-def generate_guid_db_file():
+def format_guid(guid_value):
+    return '{{ 0x{:08X}, 0x{:04X}, 0x{:04X}, {{ {} }} }}'.format(
+        guid_value[0],
+        guid_value[1],
+        guid_value[2],
+        ', '.join('0x{:02X}'.format(byte) for byte in guid_value[3:])
+    )
+
+
+def build_name_pool(names):
+    # Все имена лежат подряд в одном ASCII-пуле, каждое заканчивается '\0'.
+    # До UTF-16 имя расширяется только в момент печати.
+    offsets = []
+    pool    = ''
+    for name in names:
+        offsets.append(len(pool))
+        pool += name + '\0'
+    return offsets, pool
+
+
+def write_name_pool(guid_header, names):
+    guid_header.write('#define GUID_DB_NAME_POOL \\\n')
+    pool_size = sum(len(name) + 1 for name in names)
+    if pool_size < MSVC_MAX_STRING_LITERAL:
+        lines = ['  "{}\\0"'.format(name) for name in names]
+    else:
+        # MSVC не принимает строковые литералы длиннее 64 КБ даже после склейки,
+        # поэтому большой пул выписываем посимвольно.
+        lines = ['  ' + ''.join("'{}', ".format(char) for char in name) + "'\\0'," for name in names]
+        lines[-1] = lines[-1].rstrip(',')
+    guid_header.write(' \\\n'.join(lines) + '\n')
+
+
+def is_dxe_relevant(guid_name):
+    # Отбрасываем то, что не может появиться в базе хэндлов на DXE-стадии:
+    # PPI и GUID'ы модулей PEI/SEC, а также пространства имён PCD.
+    # Протоколы оставляем всегда (например, EFI_IP_SEC_PROTOCOL_GUID).
+    tokens = guid_name.upper().split('_')
+    if 'PROTOCOL' in tokens:
+        return True
+    if any(token in NON_DXE_NAME_TOKENS for token in tokens):
+        return False
+    if 'TOKEN_SPACE' in guid_name.upper() or 'TOKENSPACE' in guid_name.upper():
+        return False
+    return True
+
+
+def parse_vendors(vendors_string):
+    vendors = [vendor.strip().upper() for vendor in vendors_string.split(',') if vendor.strip()]
+    unknown = [vendor for vendor in vendors if vendor not in VENDOR_GUID_LISTS]
+    if unknown:
+        raise SystemExit('Unknown vendor(s): {}. Known vendors: {}'.format(
+            ', '.join(unknown), ','.join(VENDOR_GUID_LISTS)))
+    if not vendors:
+        raise SystemExit('Vendor list is empty')
+    return vendors
+
+
+def parse_bool(value):
+    if value.upper() in ('TRUE', '1', 'YES'):
+        return True
+    if value.upper() in ('FALSE', '0', 'NO'):
+        return False
+    raise SystemExit('Expected TRUE or FALSE, got: {}'.format(value))
+
+
+def write_if_changed(path, content):
+    # Не трогаем файл без нужды, чтобы PREBUILD не вызывал пересборку библиотеки каждый раз.
+    if os.path.isfile(path):
+        with open(path, 'r') as old_file:
+            if old_file.read() == content:
+                return False
+    with open(path, 'w') as new_file:
+        new_file.write(content)
+    return True
+
+
+def build_binary_db(guid_values, name_offsets, name_pool, bucket_count, slot_count, displacements, slots):
+    # Заголовок, затем массивы в том же виде, что и во встроенной БД:
+    # драйвер читает файл одним вызовом Read() и ищет прямо по буферу.
+    name_pool_bytes = name_pool.encode('ascii')
+    header = GUID_DB_FILE_HEADER.pack(
+        GUID_DB_FILE_SIGNATURE,
+        GUID_DB_FILE_VERSION,
+        len(guid_values),
+        bucket_count,
+        slot_count,
+        len(name_pool_bytes),
+        0,
+        0
+    )
+    return b''.join([
+        header,
+        b''.join(guid_to_bytes(value) for value in guid_values),
+        struct.pack('<{}I'.format(len(name_offsets)), *name_offsets),
+        struct.pack('<{}H'.format(len(displacements)), *displacements),
+        struct.pack('<{}H'.format(len(slots)), *slots),
+        name_pool_bytes
+    ])
+
+
+def generate_guid_db_file(vendors, dxe_only, output_path, binary_path=None):
     guids_all = {}
-    add_guids(guids_all, guids.edk2_guids.edk2_guids)
-    add_guids(guids_all, guids.ami_guids.ami_guids)
-    add_guids(guids_all, guids.asrock_guids.asrock_guids)
-    add_guids(guids_all, guids.dell_guids.dell_guids)
-    add_guids(guids_all, guids.lenovo_guids.lenovo_guids)
-
-    with open('GeneratedProtocolGuidDatabase.h', 'w') as guid_header:
-        guid_header.write('#include <Uefi.h>\n\n')
-
-        for guid_name in guids_all:
-            guid_value = guids_all[guid_name]
-            guid_header.write('STATIC EFI_GUID my_{} = {{\n'.format(global_var_from_guid(guid_name)))
-            guid_header.write('  {}, {}, {}, {{ {}, {}, {}, {}, {}, {}, {}, {} }}\n'.format(
-                hex(guid_value[0]),
-                hex(guid_value[1]),
-                hex(guid_value[2]),
-                hex(guid_value[3]),
-                hex(guid_value[4]),
-                hex(guid_value[5]),
-                hex(guid_value[6]),
-                hex(guid_value[7]),
-                hex(guid_value[8]),
-                hex(guid_value[9]),
-                hex(guid_value[10])
-            ))
-            guid_header.write('};\n\n')
-
-        guid_header.write('#define GUID_DB \\\n')
-        guid_db_def = ''
-        for guid_name in guids_all:
-            guid_db_def += '  {{ &my_{}, L"{}" }}, \\\n'.format(
-                global_var_from_guid(guid_name),
-                guid_from_global_var(guid_name)
-            )
-        guid_db_def = guid_db_def.rstrip(', \\\n')
-        guid_db_def += '\n'
-        guid_header.write(guid_db_def)
-
-
-generate_guid_db_file()
+    for vendor in vendors:
+        add_guids(guids_all, VENDOR_GUID_LISTS[vendor])
+
+    if dxe_only:
+        guids_all = {name: value for name, value in guids_all.items() if is_dxe_relevant(name)}
+
+    names       = [guid_from_global_var(guid_name) for guid_name in guids_all]
+    guid_values = list(guids_all.values())
+
+    name_offsets, name_pool = build_name_pool(names)
+    bucket_count, slot_count, displacements, slots = build_perfect_hash(guid_values)
+
+    guid_header = io.StringIO()
+    guid_header.write('// Vendors: {}, DXE only: {}\n'.format(','.join(vendors), 'TRUE' if dxe_only else 'FALSE'))
+    guid_header.write('#include <Uefi.h>\n\n')
+
+    guid_header.write('#define GUID_DB_COUNT             {}\n'.format(len(guid_values)))
+    guid_header.write('#define GUID_DB_NAME_POOL_SIZE    {}\n'.format(len(name_pool)))
+    guid_header.write('#define GUID_DB_HASH_BUCKET_COUNT {}\n'.format(bucket_count))
+    guid_header.write('#define GUID_DB_HASH_SLOT_COUNT   {}\n'.format(slot_count))
+    guid_header.write('#define GUID_DB_HASH_EMPTY_SLOT   0x{:04X}\n'.format(EMPTY_SLOT))
+    guid_header.write('\n')
+
+    guid_header.write('#define GUID_DB_GUIDS \\\n')
+    guid_header.write(' \\\n'.join('  {},'.format(format_guid(value)) for value in guid_values).rstrip(',') + '\n')
+    guid_header.write('\n')
+
+    guid_header.write('#define GUID_DB_NAME_OFFSETS \\\n')
+    guid_header.write(format_uint32_list(name_offsets))
+    guid_header.write('\n')
+
+    write_name_pool(guid_header, names)
+    guid_header.write('\n')
+
+    guid_header.write('#define GUID_DB_HASH_DISPLACEMENTS \\\n')
+    guid_header.write(format_uint16_list(displacements))
+    guid_header.write('\n')
+    guid_header.write('#define GUID_DB_HASH_SLOTS \\\n')
+    guid_header.write(format_uint16_list(slots))
+
+    guid_bytes  = 16 * len(guid_values)
+    offset_bytes = 4 * len(name_offsets)
+    hash_bytes  = 2 * (len(displacements) + len(slots))
+    if write_if_changed(output_path, guid_header.getvalue()):
+        print('{} updated'.format(output_path))
+    else:
+        print('{} is up to date'.format(output_path))
+
+    if binary_path:
+        binary_db = build_binary_db(guid_values, name_offsets, name_pool, bucket_count, slot_count, displacements, slots)
+        with open(binary_path, 'wb') as binary_file:
+            binary_file.write(binary_db)
+        print('{} written: {} B'.format(binary_path, len(binary_db)))
+
+    print('GUIDs: {}, guid array: {} B, name offsets: {} B, name pool: {} B, hash tables: {} B, total: {} B'.format(
+        len(guid_values),
+        guid_bytes,
+        offset_bytes,
+        len(name_pool),
+        hash_bytes,
+        guid_bytes + offset_bytes + len(name_pool) + hash_bytes
+    ))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generates GeneratedProtocolGuidDatabase.h from the known GUID lists.',
+        allow_abbrev=False)
+    parser.add_argument('--vendors', default=','.join(VENDOR_GUID_LISTS),
+                        help='Comma-separated list of GUID sources: {}'.format(','.join(VENDOR_GUID_LISTS)))
+    parser.add_argument('--dxe-only', default='TRUE',
+                        help='TRUE to drop PPI, PEI/SEC module and PCD token space GUIDs')
+    parser.add_argument('--output', default=DEFAULT_OUTPUT_PATH,
+                        help='Path of the generated header')
+    parser.add_argument('--binary', default=None,
+                        help='Also write a runtime-loadable database (guiddb.bin) to this path')
+
+    # При запуске через PREBUILD утилита build дописывает свои параметры (-p, -a, -t, -b), пропускаем их.
+    args, _ = parser.parse_known_args()
+
+    generate_guid_db_file(parse_vendors(args.vendors), parse_bool(args.dxe_only), args.output, args.binary)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,132 @@
+#include <Library/TimestampLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+// -----------------------------------------------------------------------------
+// Длительность измерения частоты счётчика.
+// Точность gBS->Stall() порядка микросекунды, так что погрешность частоты - доли процента.
+#define TIMESTAMP_CALIBRATION_US  1000
+
+// Тиков счётчика в секунду, 0 - частота не измерена.
+STATIC UINT64 gTimestampFrequency;
+
+STATIC OVERHEAD_STAGE_STATS gOverheadStats[OVERHEAD_STAGE_COUNT];
+
+// -----------------------------------------------------------------------------
+/**
+ * Измеряет частоту счётчика, занимает TIMESTAMP_CALIBRATION_US микросекунд.
+ * Вызывается один раз при старте драйвера, до перевода меток во время.
+ *
+ * @retval EFI_SUCCESS              Частота измерена.
+ * @retval EFI_UNSUPPORTED          Счётчик не идёт, метки во время не переводятся.
+ * @retval Любое другое значение    Ошибка gBS->Stall().
+ */
+EFI_STATUS
+Timestamp_Calibrate (
+  VOID
+  )
+{
+  UINT64     Start  = AsmReadTsc ();
+  EFI_STATUS Status = gBS->Stall (TIMESTAMP_CALIBRATION_US);
+  UINT64     End    = AsmReadTsc ();
+
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if (End <= Start) {
+    return EFI_UNSUPPORTED;
+  }
+
+  gTimestampFrequency = MultU64x32 (End - Start, 1000000 / TIMESTAMP_CALIBRATION_US);
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает текущую метку времени. Не вызывает EFI_BOOT_SERVICES, можно вызывать на любом TPL.
+ */
+UINT64
+Timestamp_Read (
+  VOID
+  )
+{
+  return AsmReadTsc ();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает частоту счётчика в тиках в секунду, 0 - если частота не измерена.
+ */
+UINT64
+Timestamp_GetFrequency (
+  VOID
+  )
+{
+  return gTimestampFrequency;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Переводит разность меток времени в микросекунды.
+ *
+ * @return Количество микросекунд, 0 - если частота не измерена.
+ */
+UINT64
+Timestamp_ToMicroseconds (
+  IN UINT64 Ticks
+  )
+{
+  if (gTimestampFrequency == 0) {
+    return 0;
+  }
+
+  // Целые секунды и остаток отдельно: Ticks * 1000000 переполнится уже через пару часов работы.
+  UINT64 Remainder;
+  UINT64 Seconds = DivU64x64Remainder (Ticks, gTimestampFrequency, &Remainder);
+
+  return MultU64x32 (Seconds, 1000000) + DivU64x64Remainder (MultU64x32 (Remainder, 1000000), gTimestampFrequency, NULL);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Добавляет к стадии Stage время от метки Start до текущего момента.
+ * Не вызывает EFI_BOOT_SERVICES, можно вызывать на любом TPL.
+ *
+ * @param Stage                     Стадия работы драйвера.
+ * @param Start                     Метка начала, полученная от Timestamp_Read().
+ */
+VOID
+Timestamp_AccountOverhead (
+  IN OVERHEAD_STAGE Stage,
+  IN UINT64         Start
+  )
+{
+  if (Stage >= OVERHEAD_STAGE_COUNT) {
+    return;
+  }
+
+  gOverheadStats[Stage].Calls++;
+  gOverheadStats[Stage].Ticks += AsmReadTsc () - Start;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает накопленное время стадии Stage.
+ */
+VOID
+Timestamp_GetOverheadStats (
+  IN  OVERHEAD_STAGE        Stage,
+  OUT OVERHEAD_STAGE_STATS  *Stats
+  )
+{
+  if (Stage >= OVERHEAD_STAGE_COUNT) {
+    Stats->Calls = 0;
+    Stats->Ticks = 0;
+    return;
+  }
+
+  *Stats = gOverheadStats[Stage];
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,261 @@
+#include <Library/VectorLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+// -----------------------------------------------------------------------------
+#define BLOCK_ELEMENT(Block, Index) \
+  (VOID*)(((UINT8*) ((Block) + 1)) + This->ObjectSize * (Index))
+
+// -----------------------------------------------------------------------------
+/**
+ * Выделяет новый пустой блок.
+ *
+ * @retval NULL                     Не удалось выделить память.
+ * @return Указатель на блок.
+ */
+STATIC
+SEGMENTED_VECTOR_BLOCK *
+AllocateBlock (
+  IN      SEGMENTED_VECTOR  *This
+  )
+{
+  EFI_STATUS             Status;
+  SEGMENTED_VECTOR_BLOCK *Block = NULL;
+
+  Status = gBS->AllocatePool (
+                  EfiBootServicesData,
+                  sizeof (SEGMENTED_VECTOR_BLOCK) + This->CountPerBlock * This->ObjectSize,
+                  (VOID **)&Block
+                  );
+  if (EFI_ERROR(Status)) {
+    return NULL;
+  }
+
+  Block->Next = NULL;
+  return Block;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Инициализирует структуру SEGMENTED_VECTOR, выделяет память под первый блок.
+ * Функция должна быть обязательно однократно вызвана перед использованием объекта.
+ *
+ * @param This                      Указатель на инициализируемую структуру.
+ * @param SizeOfElement             Размер одного элемента в байтах.
+ * @param CountPerBlock             Количество элементов в одном блоке.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно, массивом можно пользоваться.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен нулю.
+ */
+EFI_STATUS
+SegmentedVector_Construct (
+  IN OUT  SEGMENTED_VECTOR  *This,
+  IN      UINTN             SizeOfElement,
+  IN      UINTN             CountPerBlock
+  )
+{
+  if (This == NULL || SizeOfElement == 0 || CountPerBlock == 0) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  This->ObjectSize       = SizeOfElement;
+  This->CountPerBlock    = CountPerBlock;
+  This->CountUsed        = 0;
+  This->FirstBlock       = AllocateBlock (This);
+  This->LastBlock        = This->FirstBlock;
+  This->LastBlockUsed    = 0;
+  This->CursorBlock      = This->FirstBlock;
+  This->CursorBlockIndex = 0;
+  This->NoGrow           = FALSE;
+
+  if (This->FirstBlock == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает память из-под всех блоков.
+ * Функция должна быть обязательно однократно вызвана после завершения использования объекта.
+ *
+ * @param This                      Указатель на структуру.
+ */
+VOID
+SegmentedVector_Destruct (
+  IN OUT  SEGMENTED_VECTOR  *This
+  )
+{
+  SEGMENTED_VECTOR_BLOCK *Block = This->FirstBlock;
+
+  while (Block != NULL) {
+    SEGMENTED_VECTOR_BLOCK *Next = Block->Next;
+    gBS->FreePool (Block);
+    Block = Next;
+  }
+
+  This->FirstBlock    = NULL;
+  This->LastBlock     = NULL;
+  This->CursorBlock   = NULL;
+  This->CountUsed     = 0;
+  This->LastBlockUsed = 0;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Добавляет копию объекта в конец массива.
+ * Уже хранимые элементы не перемещаются.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Object                    Указатель на элемент, который требуется добавить.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память под новый блок,
+ *                                  либо NoGrow == TRUE и запасные блоки кончились.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL.
+ */
+EFI_STATUS
+SegmentedVector_PushBack (
+  IN OUT  SEGMENTED_VECTOR  *This,
+  IN      VOID              *Object
+  )
+{
+  if (This == NULL || Object == NULL || This->LastBlock == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (This->LastBlockUsed == This->CountPerBlock) {
+    // Последний блок заполнен, переходим на запасной или подвешиваем новый.
+    // Старые элементы остаются на месте.
+    SEGMENTED_VECTOR_BLOCK *NewBlock = This->LastBlock->Next;
+    if (NewBlock == NULL) {
+      if (This->NoGrow) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+
+      NewBlock = AllocateBlock (This);
+      if (NewBlock == NULL) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+      This->LastBlock->Next = NewBlock;
+    }
+
+    This->LastBlock     = NewBlock;
+    This->LastBlockUsed = 0;
+  }
+
+  gBS->CopyMem (
+    BLOCK_ELEMENT(This->LastBlock, This->LastBlockUsed),
+    Object,
+    This->ObjectSize
+    );
+
+  This->LastBlockUsed++;
+  This->CountUsed++;
+
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Подвешивает за последним блоком столько запасных, чтобы ещё Count элементов
+ * добавились без выделения памяти. Работает и при NoGrow == TRUE.
+ *
+ * @param This                      Указатель на структуру.
+ * @param Count                     Сколько элементов должно поместиться без роста.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+ * @retval EFI_INVALID_PARAMETER    This == NULL, либо массив не инициализирован.
+ */
+EFI_STATUS
+SegmentedVector_Reserve (
+  IN OUT  SEGMENTED_VECTOR  *This,
+  IN      UINTN             Count
+  )
+{
+  if (This == NULL || This->LastBlock == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  SEGMENTED_VECTOR_BLOCK *Tail     = This->LastBlock;
+  UINTN                  Available = This->CountPerBlock - This->LastBlockUsed;
+
+  while (Tail->Next != NULL && Available < Count) {
+    Tail       = Tail->Next;
+    Available += This->CountPerBlock;
+  }
+
+  while (Available < Count) {
+    SEGMENTED_VECTOR_BLOCK *NewBlock = AllocateBlock (This);
+    if (NewBlock == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Tail->Next = NewBlock;
+    Tail       = NewBlock;
+    Available += This->CountPerBlock;
+  }
+
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает указатель на элемент с индексом Index, нумерация с 0.
+ * Указатель остаётся действительным до SegmentedVector_Destruct().
+ *
+ * @param This                      Указатель на структуру.
+ * @param Index                     Индекс элемента.
+ *
+ * @retval NULL                     Выход за границы массива, либо This == NULL.
+ * @return Указатель на элемент с индексом Index.
+ */
+VOID *
+SegmentedVector_Get (
+  IN      SEGMENTED_VECTOR  *This,
+  IN      UINTN             Index
+  )
+{
+  if (This == NULL || Index >= This->CountUsed) {
+    return NULL;
+  }
+
+  UINTN BlockIndex = Index / This->CountPerBlock;
+
+  // Идём по цепочке от курсора, если искомый блок не раньше него, иначе с начала.
+  if (BlockIndex < This->CursorBlockIndex) {
+    This->CursorBlock      = This->FirstBlock;
+    This->CursorBlockIndex = 0;
+  }
+
+  while (This->CursorBlockIndex < BlockIndex) {
+    This->CursorBlock = This->CursorBlock->Next;
+    This->CursorBlockIndex++;
+  }
+
+  return BLOCK_ELEMENT(This->CursorBlock, Index % This->CountPerBlock);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает количество хранимых элементов.
+ *
+ * @param This                      Указатель на структуру.
+ *
+ * @return Количество хранимых элементов.
+ */
+UINTN
+SegmentedVector_Size (
+  IN      SEGMENTED_VECTOR  *This
+  )
+{
+  if (This == NULL) {
+    return 0;
+  }
+
+  return This->CountUsed;
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,230 @@
+#include <Library/VectorLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+// -----------------------------------------------------------------------------
+#define ELEMENT(Vector, Index) \
+  ((UINT8*) (Vector)->AllocatedMemory + (Vector)->ObjectSize * (Index))
+
+// -----------------------------------------------------------------------------
+/**
+ * Обменивает местами два элемента размером Size байт.
+*/
+STATIC
+VOID
+SwapElements (
+  IN OUT UINT8 *Left,
+  IN OUT UINT8 *Right,
+  IN     UINTN Size
+  )
+{
+  while (Size--) {
+    UINT8 Temp = *Left;
+    *Left++    = *Right;
+    *Right++   = Temp;
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Просеивает элемент Root вниз по двоичной куче из Count элементов.
+*/
+STATIC
+VOID
+SiftDown (
+  IN OUT VECTOR         *This,
+  IN     UINTN          Root,
+  IN     UINTN          Count,
+  IN     VECTOR_COMPARE Compare
+  )
+{
+  for (;;) {
+    UINTN Largest = Root;
+    UINTN Left    = 2 * Root + 1;
+    UINTN Right   = Left + 1;
+
+    if (Left < Count && Compare (ELEMENT (This, Left), ELEMENT (This, Largest)) > 0) {
+      Largest = Left;
+    }
+    if (Right < Count && Compare (ELEMENT (This, Right), ELEMENT (This, Largest)) > 0) {
+      Largest = Right;
+    }
+    if (Largest == Root) {
+      return;
+    }
+
+    SwapElements (ELEMENT (This, Root), ELEMENT (This, Largest), This->ObjectSize);
+    Root = Largest;
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Сортирует элементы вектора по возрастанию.
+ * Используется пирамидальная сортировка: O(n log n) в худшем случае,
+ * без дополнительной памяти. Сортировка неустойчивая.
+ *
+ * @param This                      Указатель на структуру вектора.
+ * @param Compare                   Функция сравнения элементов.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL.
+ */
+EFI_STATUS
+Vector_Sort (
+  IN OUT  VECTOR          *This,
+  IN      VECTOR_COMPARE  Compare
+  )
+{
+  if (This == NULL || Compare == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  UINTN Count = This->CountUsed;
+  if (Count < 2) {
+    return EFI_SUCCESS;
+  }
+
+  for (UINTN Root = Count / 2; Root > 0; --Root) {
+    SiftDown (This, Root - 1, Count, Compare);
+  }
+
+  for (UINTN End = Count - 1; End > 0; --End) {
+    SwapElements (ELEMENT (This, 0), ELEMENT (This, End), This->ObjectSize);
+    SiftDown (This, 0, End, Compare);
+  }
+
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет в отсортированном векторе первый элемент, не меньший Key. Двоичный поиск.
+ *
+ * @param This                      Указатель на структуру отсортированного вектора.
+ * @param Key                       Искомое значение.
+ * @param Compare                   Функция сравнения, та же, что и при сортировке.
+ *
+ * @return Индекс найденного элемента, либо Vector_Size(), если все элементы меньше Key.
+ */
+UINTN
+Vector_LowerBound (
+  IN      VECTOR          *This,
+  IN      CONST VOID      *Key,
+  IN      VECTOR_COMPARE  Compare
+  )
+{
+  if (This == NULL || Key == NULL || Compare == NULL) {
+    return 0;
+  }
+
+  UINTN Low  = 0;
+  UINTN High = This->CountUsed;
+
+  while (Low < High) {
+    UINTN Middle = Low + (High - Low) / 2;
+    if (Compare (ELEMENT (This, Middle), Key) < 0) {
+      Low = Middle + 1;
+    } else {
+      High = Middle;
+    }
+  }
+
+  return Low;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Удаляет из отсортированного вектора повторяющиеся элементы, оставляя по одному.
+ * Память не освобождается, меняется только количество элементов.
+ *
+ * @param This                      Указатель на структуру отсортированного вектора.
+ * @param Compare                   Функция сравнения, та же, что и при сортировке.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL.
+ */
+EFI_STATUS
+Vector_Unique (
+  IN OUT  VECTOR          *This,
+  IN      VECTOR_COMPARE  Compare
+  )
+{
+  if (This == NULL || Compare == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (This->CountUsed < 2) {
+    return EFI_SUCCESS;
+  }
+
+  UINTN Last = 0;
+  for (UINTN Index = 1; Index < This->CountUsed; ++Index) {
+    if (Compare (ELEMENT (This, Last), ELEMENT (This, Index)) != 0) {
+      ++Last;
+      if (Last != Index) {
+        gBS->CopyMem (ELEMENT (This, Last), ELEMENT (This, Index), This->ObjectSize);
+      }
+    }
+  }
+
+  This->CountUsed = Last + 1;
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в Result элементы отсортированного вектора Left,
+ * отсутствующие в отсортированном векторе Right. Один проход по обоим: O(n + m).
+ *
+ * @param Left                      Отсортированный вектор, из которого берутся элементы.
+ * @param Right                     Отсортированный вектор вычитаемых элементов.
+ * @param Compare                   Функция сравнения, та же, что и при сортировке.
+ * @param Result                    Уже инициализированный вектор того же типа, результат дописывается в конец.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память, в Result могла попасть часть результата.
+ * @retval EFI_INVALID_PARAMETER    Один из параметров равен NULL, либо размеры элементов не совпадают.
+ */
+EFI_STATUS
+Vector_SetDifference (
+  IN      VECTOR          *Left,
+  IN      VECTOR          *Right,
+  IN      VECTOR_COMPARE  Compare,
+  IN OUT  VECTOR          *Result
+  )
+{
+  EFI_STATUS Status;
+
+  if (Left == NULL || Right == NULL || Compare == NULL || Result == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (Left->ObjectSize != Right->ObjectSize || Left->ObjectSize != Result->ObjectSize) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  UINTN LeftIndex  = 0;
+  UINTN RightIndex = 0;
+
+  while (LeftIndex < Left->CountUsed) {
+    INTN Order = (RightIndex < Right->CountUsed)
+                   ? Compare (ELEMENT (Left, LeftIndex), ELEMENT (Right, RightIndex))
+                   : -1;
+
+    if (Order < 0) {
+      Status = Vector_PushBack (Result, ELEMENT (Left, LeftIndex));
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+      ++LeftIndex;
+    } else if (Order > 0) {
+      ++RightIndex;
+    } else {
+      ++LeftIndex;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
@@ -91,30 +91,10 @@ Vector_PushBack (
 
   if (This->CountUsed == This->CountAllocated) {
     // Увеличиваем количество выделенной памяти вдвое.
-    VOID *NewAllocatedMemory = NULL;
-    UINTN NewCountAllocated  = This->CountAllocated * 2;
-    UINTN OldSizeInBytes     = This->CountAllocated * This->ObjectSize;
-    UINTN NewSizeInBytes     = NewCountAllocated    * This->ObjectSize;
-
-    Status = gBS->AllocatePool (
-                    EfiBootServicesData,
-                    NewSizeInBytes,
-                    &NewAllocatedMemory
-                    );
+    Status = Vector_Reserve (This, This->CountAllocated * 2);
     if (EFI_ERROR(Status)) {
-      return EFI_OUT_OF_RESOURCES;
+      return Status;
     }
-
-    gBS->CopyMem (
-          NewAllocatedMemory,
-          This->AllocatedMemory,
-          OldSizeInBytes
-          );
-
-    gBS->FreePool (This->AllocatedMemory);
-
-    This->CountAllocated  = NewCountAllocated;
-    This->AllocatedMemory = NewAllocatedMemory;
   }
 
   gBS->CopyMem (
@@ -128,6 +108,61 @@ Vector_PushBack (
   return EFI_SUCCESS;
 }
 
+// -----------------------------------------------------------------------------
+/**
+ * Гарантирует, что вектор вмещает не менее Count элементов без перевыделения памяти.
+ * Если памяти уже достаточно, ничего не делает.
+ *
+ * @param This                      Указатель на структуру вектора.
+ * @param Count                     Требуемая вместимость в элементах.
+ *
+ * @retval EFI_SUCCESS              Операция завершена успешно.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память, вектор не изменился.
+ * @retval EFI_INVALID_PARAMETER    This == NULL.
+ */
+EFI_STATUS
+Vector_Reserve (
+  IN OUT  VECTOR          *This,
+  IN      UINTN           Count
+  )
+{
+  EFI_STATUS Status;
+
+  if (This == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (Count <= This->CountAllocated) {
+    return EFI_SUCCESS;
+  }
+
+  VOID *NewAllocatedMemory = NULL;
+  UINTN OldSizeInBytes     = This->CountUsed * This->ObjectSize;
+  UINTN NewSizeInBytes     = Count           * This->ObjectSize;
+
+  Status = gBS->AllocatePool (
+                  EfiBootServicesData,
+                  NewSizeInBytes,
+                  &NewAllocatedMemory
+                  );
+  if (EFI_ERROR(Status)) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  gBS->CopyMem (
+        NewAllocatedMemory,
+        This->AllocatedMemory,
+        OldSizeInBytes
+        );
+
+  gBS->FreePool (This->AllocatedMemory);
+
+  This->CountAllocated  = Count;
+  This->AllocatedMemory = NewAllocatedMemory;
+
+  return EFI_SUCCESS;
+}
+
 // -----------------------------------------------------------------------------
 /**
  * Удаляет объект с конца вектора и возвращает значение удалённого элемента,
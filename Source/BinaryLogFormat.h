@@ -0,0 +1,110 @@
+/** @file
+ * Формат двоичного лога (PcdBinaryLogFormat), должен совпадать с Tools/LogDecoder/LogDecoder.c.
+ * -----------------------------------------------------------------------------
+ * Все числа little-endian, структуры без выравнивания. Файл начинается с BINARY_LOG_FILE_HEADER,
+ * за ним подряд идут записи: BINARY_LOG_RECORD_HEADER, затем данные записи, всего Length байт.
+ *
+ * Тип записи совпадает с LOG_ENTRY_TYPE события. Данные событий о протоколах - BINARY_LOG_PROTOCOL_RECORD,
+ * для остальных событий данных нет. За данными идут строки события, каждая - UINT16 число символов
+ * и сами символы CHAR16 без '\0'; BINARY_LOG_NULL_STRING вместо числа символов - строки нет.
+ *   PROTOCOL-INSTALLED, -REINSTALLED, -REMOVED, -EXISTS-ON-STARTUP: имя хэндла.
+ *   IMAGE-LOADED, IMAGE-EXISTS-ON-STARTUP:                         имя образа, имя родительского образа.
+ *   ERROR:                                                         сообщение.
+ * В Flags событий о протоколах - BINARY_LOG_FLAG_SUCCESSFUL и BINARY_LOG_FLAG_MULTIPLE_CALL,
+ * у BDS-STAGE-ENTERED - BDS_STAGE_SUB_EVENT_INFO.
+ *
+ * Последняя запись - BINARY_LOG_RECORD_STATISTICS с данными BINARY_LOG_STATISTICS. Как и текстовый блок
+ * статистики, она затирается следующими событиями и дописывается заново, поэтому размер у неё постоянный.
+ * Всё, что лежит в файле после неё, к логу не относится.
+ * -----------------------------------------------------------------------------
+ */
+#include <Uefi.h>
+
+#ifndef BINARY_LOG_FORMAT_H_
+#define BINARY_LOG_FORMAT_H_
+
+// -----------------------------------------------------------------------------
+#define BINARY_LOG_SIGNATURE              SIGNATURE_32 ('D', 'L', 'L', 'B')
+#define BINARY_LOG_VERSION                4         // 2: VolumeProbes, VolumeProbesSaved. 3: Deferred*. 4: MultiCalls.
+
+#define BINARY_LOG_RECORD_STATISTICS      0x80
+
+#define BINARY_LOG_FLAG_SUCCESSFUL        BIT0
+#define BINARY_LOG_FLAG_MULTIPLE_CALL     BIT1      // Событие из Install/UninstallMultipleProtocolInterfaces().
+
+#define BINARY_LOG_NULL_STRING            0xFFFF
+#define BINARY_LOG_MAX_STRING_LENGTH      4096      // Более длинные строки обрезаются, как и в текстовом логе.
+
+#define BINARY_LOG_CALL_STATS_COUNT       10        // Строк в каждой таблице самых долгих протоколов.
+#define BINARY_LOG_OVERHEAD_STATS_COUNT   6         // Стадии OVERHEAD_STAGE и затем весь писатель лога.
+
+#pragma pack(1)
+
+// -----------------------------------------------------------------------------
+typedef struct {
+  UINT32 Signature;
+  UINT16 Version;
+  UINT16 HeaderSize;                // sizeof (BINARY_LOG_FILE_HEADER), записи начинаются сразу за ним.
+  UINT64 TimestampFrequency;        // Частота меток времени в Гц, 0 - время не измерялось.
+  UINT32 Reserved[4];
+} BINARY_LOG_FILE_HEADER;
+
+// -----------------------------------------------------------------------------
+typedef struct {
+  UINT16 Length;                    // Длина записи вместе с заголовком.
+  UINT8  Type;                      // LOG_ENTRY_TYPE, либо BINARY_LOG_RECORD_STATISTICS.
+  UINT8  Flags;
+  UINT64 Timestamp;                 // Метка события, см. Timestamp_Read().
+} BINARY_LOG_RECORD_HEADER;
+
+// -----------------------------------------------------------------------------
+typedef struct {
+  EFI_GUID Guid;
+  UINT64   Handle;                  // 0 - хэндл неизвестен.
+  UINT64   Duration;                // Длительность вызова сервиса в тиках, 0 - не измерялась.
+} BINARY_LOG_PROTOCOL_RECORD;
+
+// -----------------------------------------------------------------------------
+typedef struct {
+  EFI_GUID Guid;
+  UINT64   Count;                   // 0 - строка не используется.
+  UINT64   Total;                   // В тиках.
+  UINT64   Max;                     // В тиках.
+} BINARY_LOG_CALL_STATS;
+
+// -----------------------------------------------------------------------------
+typedef struct {
+  UINT64 Calls;
+  UINT64 Ticks;
+} BINARY_LOG_OVERHEAD_STATS;
+
+// -----------------------------------------------------------------------------
+typedef struct {
+  UINT64                    NamesUnique;
+  UINT64                    NamesReferences;
+  UINT64                    NamesBytesStored;
+  UINT64                    NamesBytesSaved;
+  UINT64                    CacheHits;
+  UINT64                    CacheMisses;
+  UINT64                    CacheInvalidations;
+  UINT64                    ArenaAllocations;
+  UINT64                    ArenaBytes;
+  UINT64                    ArenaChunks;
+  UINT64                    ArenaPages;
+  UINT64                    EventsStored;
+  UINT64                    EventsBytes;
+  UINT64                    EventsBlocks;
+  UINT64                    VolumeProbes;
+  UINT64                    VolumeProbesSaved;
+  UINT64                    DeferredEvents;       // 0 - не LOG_FLUSH_POLICY_DEFERRED_EXPORT, либо выгрузки ещё не было.
+  UINT64                    DeferredFlushTicks;   // Длительность Flush() после первого события первой выгрузки, в тиках.
+  BINARY_LOG_CALL_STATS     Calls[BINARY_LOG_CALL_STATS_COUNT];       // Вызовы для одного протокола.
+  BINARY_LOG_OVERHEAD_STATS Overhead[BINARY_LOG_OVERHEAD_STATS_COUNT];
+  BINARY_LOG_CALL_STATS     MultiCalls[BINARY_LOG_CALL_STATS_COUNT];  // Install/UninstallMultipleProtocolInterfaces() по первому GUID'у.
+} BINARY_LOG_STATISTICS;
+
+#pragma pack()
+
+// -----------------------------------------------------------------------------
+
+#endif  // BINARY_LOG_FORMAT_H_
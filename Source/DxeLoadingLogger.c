@@ -1,22 +1,92 @@
 #include <Uefi.h>
+#include <Library/BaseLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/PrintLib.h>
+#include <Library/PcdLib.h>
 #include <Library/EventLoggerLib.h>
+#include <Library/EventProviderUtilityLib.h>
 #include <Library/CommonMacrosLib.h>
 #include <Library/VectorLib.h>
 #include <Library/ProtocolGuidDatabaseLib.h>
 #include <Library/TextAnimationLib.h>
+#include <Library/TimestampLib.h>
 
 #include <Protocol/SimpleFileSystem.h>
+#include <Guid/EventGroup.h>
+#include <Guid/FileInfo.h>
+#include <Guid/FileSystemInfo.h>
+
+#include "BinaryLogFormat.h"
 
 
 // -----------------------------------------------------------------------------
 #define PRINT_TO_FILE_BUFFER_LENGTH 4096
+#define OUTPUT_BUFFER_SIZE          SIZE_64KB
+#define EVENT_PREFIX_LENGTH         64
+#define PROTOCOL_CALL_STATS_TOP     10
+
+// Значения PcdLogFlushPolicy, см. описание LOG_FLUSH_POLICY в DxeLoadingLoggerPkg.dsc.
+#define LOG_FLUSH_POLICY_EVERY_EVENT        0
+#define LOG_FLUSH_POLICY_EVERY_N_EVENTS     1
+#define LOG_FLUSH_POLICY_PERIODIC           2
+#define LOG_FLUSH_POLICY_PHASE_BOUNDARIES   3
+#define LOG_FLUSH_POLICY_EXIT_BOOT_SERVICES 4
+#define LOG_FLUSH_POLICY_DEFERRED_EXPORT    5
 
 
 // -----------------------------------------------------------------------------
 STATIC LOGGER             gLogger;
 STATIC EFI_FILE_PROTOCOL  *gLogFileProtocol;
+STATIC UINTN              gLoggedEventCount;        // Сколько событий уже записано в лог.
+STATIC BOOLEAN            gLogWriteRequested;       // Записать лог при следующем ProcessNewEvents(), см. RequestLogWrite().
+STATIC EFI_EVENT          gLogWriteTimerEvent;      // События из RegisterLogWriteTriggers(), закрываются в Unload().
+STATIC EFI_EVENT          gEndOfDxeEvent;
+STATIC EFI_EVENT          gReadyToBootEvent;
+STATIC EFI_EVENT          gBeforeExitBootServicesEvent;
+STATIC UINT64             gPreviousEventTimestamp;  // Метка предыдущего записанного события.
+STATIC VECTOR             gProtocolCallStats;       // PROTOCOL_CALL_STATS, индекс - идентификатор GUID'а.
+STATIC VECTOR             gMultiProtocolCallStats;  // То же для Install/UninstallMultipleProtocolInterfaces(), по первому GUID'у.
+STATIC VECTOR             gSortedProtocolCallStats; // Копия для сортировки при записи статистики.
+STATIC UINT64             gWriterTicks;             // Время в ProcessNewEvents(), кроме текущего прохода.
+STATIC UINTN              gWriterPasses;
+STATIC UINT32             gLogFileClusterSize;      // При PcdPreallocateLogFile: размер кластера тома с логом, 0 если неизвестен.
+STATIC UINT64             gLogFileEnd;              // При PcdPreallocateLogFile: конец лога, по нему файл обрезается в конце.
+STATIC UINT64             gLogFooterEnd;            // Конец блока статистики, который затирается следующей порцией, 0 - его нет.
+
+// Тома проверяются на наличие log.txt по одному разу, по мере появления, см. RegisterVolumeArrivalNotify().
+STATIC EFI_EVENT          gVolumeArrivalEvent;      // Уведомление о новых томах, закрывается в Unload().
+STATIC VOID               *gVolumeRegistration;     // NULL - уведомления нет, на каждой порции перебираются все тома.
+STATIC VECTOR             gPendingVolumes;          // EFI_HANDLE томов, которые ещё не проверялись.
+STATIC EFI_HANDLE         gLogVolume;               // Том, на котором открыт лог.
+STATIC UINTN              gKnownVolumeCount;        // Сколько томов появлялось с момента старта драйвера.
+STATIC UINTN              gVolumeProbes;            // Статистика: сколько раз том проверялся на наличие log.txt.
+STATIC UINTN              gVolumeProbesSaved;       // Статистика: сколько проверок сделал бы перебор всех томов на каждой порции.
+
+// При LOG_FLUSH_POLICY_DEFERRED_EXPORT: замер первой выгрузки лога, по нему оценивается выигрыш от отложенной записи.
+STATIC UINTN              gDeferredExportEvents;    // Сколько событий ушло в файл за первую выгрузку, 0 - её ещё не было.
+STATIC UINT64             gDeferredExportFlushTicks;// Длительность Flush() после записи только первого из них.
+
+// Буфер вывода: PrintToFile() копит в нём текст, а в файл он пишется одним Write() на порцию событий.
+// Если выделить его не удалось, работает запасной буфер на одну строку, т.е. запись идёт как раньше.
+STATIC CHAR16             gFallbackOutputBuffer[PRINT_TO_FILE_BUFFER_LENGTH];
+STATIC UINT8              *gOutputBuffer    = (UINT8 *)gFallbackOutputBuffer;
+STATIC UINTN              gOutputBufferSize = sizeof (gFallbackOutputBuffer);
+STATIC UINTN              gOutputBufferUsed;
+
+// При PcdLogUtf8Encoding строка сначала форматируется сюда, а в буфер вывода попадает уже в UTF-8.
+STATIC CHAR16             gLineBuffer[PRINT_TO_FILE_BUFFER_LENGTH];
+
+
+// -----------------------------------------------------------------------------
+/**
+ * Длительность вызовов сервисов gBS для одного протокола.
+ */
+typedef struct {
+  PROTOCOL_GUID_ID  GuidId;
+  UINTN             Count;        // Вызовов с измеренной длительностью.
+  UINT64            Total;        // Суммарная длительность, в тиках Timestamp_Read().
+  UINT64            Max;          // Самый долгий вызов, в тиках Timestamp_Read().
+} PROTOCOL_CALL_STATS;
 
 
 // -----------------------------------------------------------------------------
@@ -27,6 +97,48 @@ STATIC
 VOID
 ProcessNewEvents ();
 
+// -----------------------------------------------------------------------------
+/**
+ * Решает по PcdLogFlushPolicy, пора ли записывать накопившиеся события в лог.
+*/
+STATIC
+BOOLEAN
+IsLogWriteDue (
+  VOID
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Записывает в лог все накопившиеся события, независимо от политики записи.
+*/
+STATIC
+VOID
+EFIAPI
+RequestLogWrite (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Регистрирует события, по которым лог записывается вне зависимости от поступления новых событий.
+*/
+STATIC
+VOID
+RegisterLogWriteTriggers (
+  VOID
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Закрывает события, зарегистрированные в RegisterLogWriteTriggers().
+*/
+STATIC
+VOID
+CloseLogWriteTriggers (
+  VOID
+  );
+
 // -----------------------------------------------------------------------------
 /**
  * Дописывает информацию о событии Event в gLogFileProtocol.
@@ -56,6 +168,45 @@ FindFileSystem (
   OUT  EFI_FILE_PROTOCOL  **LogFileProtocol
   );
 
+// -----------------------------------------------------------------------------
+/**
+ * Пытается открыть либо создать log.txt в корне тома Volume.
+ *
+ * @param Volume           Хэндл с EFI_SIMPLE_FILE_SYSTEM_PROTOCOL.
+ * @param LogFileProtocol  Протокол, с помощью которого можно вести запись лог-файла.
+ *
+ * @retval EFI_SUCCESS     Лог-файл открыт, результат записан в LogFileProtocol.
+ * @retval Что-то другое.  На томе нет log.txt, либо какая-то ошибка, LogFileProtocol остался без изменений.
+*/
+STATIC
+EFI_STATUS
+ProbeVolume (
+  IN   EFI_HANDLE         Volume,
+  OUT  EFI_FILE_PROTOCOL  **LogFileProtocol
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Подписывается на появление EFI_SIMPLE_FILE_SYSTEM_PROTOCOL и ставит в очередь на проверку уже имеющиеся тома.
+*/
+STATIC
+VOID
+RegisterVolumeArrivalNotify (
+  VOID
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Ставит в очередь на проверку новые тома. Функция уведомления RegisterProtocolNotify().
+*/
+STATIC
+VOID
+EFIAPI
+OnVolumeArrival (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
+
 // -----------------------------------------------------------------------------
 /**
  * Печатает в файл.
@@ -70,6 +221,87 @@ PrintToFile (
   ...
   );
 
+// -----------------------------------------------------------------------------
+/**
+ * Записывает накопленное в буфере вывода в файл одним вызовом Write().
+ * Если не удалось, то закрывает файл и устанавливает FileProtocol в NULL, содержимое буфера теряется.
+*/
+STATIC
+VOID
+FlushOutputBuffer (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Записывает в файл первые Length байт буфера вывода, остаток переносится в начало буфера.
+ * Если не удалось, то закрывает файл и устанавливает FileProtocol в NULL, содержимое буфера теряется.
+*/
+STATIC
+VOID
+WriteOutputBuffer (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol,
+  IN     UINTN             Length
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Освобождает в буфере вывода место хотя бы под Needed байт.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+STATIC
+VOID
+MakeRoomInOutputBuffer (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol,
+  IN     UINTN             Needed
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в буфер вывода строку в кодировке UTF-8.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+STATIC
+VOID
+AppendUtf8ToOutputBuffer (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol,
+  IN     CONST CHAR16      *Line,
+  IN     UINTN             Length
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Читает информацию InformationType о файле File в буфер, выделенный из пула.
+*/
+STATIC
+EFI_STATUS
+GetFileInfo (
+  IN  EFI_FILE_PROTOCOL  *File,
+  IN  EFI_GUID           *InformationType,
+  OUT VOID               **Info
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Растягивает лог-файл до PcdLogFilePreallocationSize байт и запоминает размер кластера тома.
+*/
+STATIC
+VOID
+PreallocateLogFile (
+  IN EFI_FILE_PROTOCOL *FileSystemRoot,
+  IN EFI_FILE_PROTOCOL *File
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Обрезает заранее растянутый лог-файл по концу лога.
+*/
+STATIC
+VOID
+TruncateLogFile (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  );
+
 // -----------------------------------------------------------------------------
 /**
  * Корректно закрывает FileProtocol, если это ещё не было сделано.
@@ -80,6 +312,141 @@ FlushAndCloseFileProtocol (
   IN OUT EFI_FILE_PROTOCOL **FileProtocol
   );
 
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает длительность вызова сервиса, если она измерялась.
+*/
+STATIC
+VOID
+PrintCallDuration (
+  IN OUT EFI_FILE_PROTOCOL            **FileProtocol,
+  IN     LOG_ENTRY_PROTOCOL_INSTALLED *Call
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Учитывает длительность вызова сервиса из события Event в gProtocolCallStats,
+ * либо в gMultiProtocolCallStats для Install/UninstallMultipleProtocolInterfaces().
+*/
+STATIC
+VOID
+AccountProtocolCallDuration (
+  IN LOADING_EVENT *Event
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в конец лога блок статистики и возвращает позицию записи на его начало,
+ * так что следующие события затрут его, а за ними будет записан обновлённый блок.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+STATIC
+VOID
+WriteLogFooter (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает порцию событий без блока статистики. Если события не дотянулись до конца
+ * затёртого ими блока, файл обрезается, чтобы за концом лога не остался хвост блока.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+STATIC
+VOID
+DropLogFooter (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в лог текстовый блок статистики.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+STATIC
+VOID
+WriteTextLogStatistics (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Собирает в gSortedProtocolCallStats протоколы из CallStats с измеренными вызовами, по убыванию суммарной длительности.
+*/
+STATIC
+EFI_STATUS
+SortProtocolCallStats (
+  IN VECTOR *CallStats
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в буфер вывода Size байт из Data.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+STATIC
+VOID
+AppendToOutputBuffer (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol,
+  IN     CONST VOID        *Data,
+  IN     UINTN             Size
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает, сколько символов строки Str попадёт в двоичный лог.
+*/
+STATIC
+UINT16
+GetBinaryLogStringLength (
+  IN CONST CHAR16 *Str  OPTIONAL
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в двоичный лог заголовок файла.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+STATIC
+VOID
+WriteBinaryLogHeader (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает событие Event в двоичный лог.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+STATIC
+VOID
+AddNewEventToBinaryLog (
+  IN     LOADING_EVENT      *Event,
+  IN OUT EFI_FILE_PROTOCOL  **FileProtocol
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Заполняет таблицу двоичного лога самыми долгими протоколами из CallStats.
+*/
+STATIC
+VOID
+FillBinaryLogCallStats (
+  IN  VECTOR                *CallStats,
+  OUT BINARY_LOG_CALL_STATS *Rows
+  );
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в двоичный лог запись со статистикой.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+STATIC
+VOID
+WriteBinaryLogStatistics (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  );
+
 
 // -----------------------------------------------------------------------------
 /**
@@ -94,9 +461,24 @@ Initialize (
 {
   DBG_ENTER ();
 
+  VOID *OutputBuffer;
+  if (!EFI_ERROR (gBS->AllocatePool (EfiBootServicesData, OUTPUT_BUFFER_SIZE, &OutputBuffer))) {
+    gOutputBuffer     = OutputBuffer;
+    gOutputBufferSize = OUTPUT_BUFFER_SIZE;
+  }
+
+  Vector_Construct (&gProtocolCallStats,       sizeof (PROTOCOL_CALL_STATS), 256);
+  Vector_Construct (&gMultiProtocolCallStats,  sizeof (PROTOCOL_CALL_STATS), 256);
+  Vector_Construct (&gSortedProtocolCallStats, sizeof (PROTOCOL_CALL_STATS), 256);
+  Vector_Construct (&gPendingVolumes,          sizeof (EFI_HANDLE),          16);
+
+  RegisterVolumeArrivalNotify ();
+
   Logger_Construct (&gLogger, &ProcessNewEvents);
   Logger_Start     (&gLogger);
 
+  RegisterLogWriteTriggers ();
+
   DBG_EXIT_STATUS (EFI_SUCCESS);
   return EFI_SUCCESS;
 }
@@ -113,9 +495,36 @@ Unload (
 {
   DBG_ENTER ();
 
+  // Сначала закрываем события: их функции уведомления находятся в выгружаемом образе.
+  CloseLogWriteTriggers ();
+
+  // Дописываем то, что ещё копится в памяти, пока события доступны.
+  // Лог пишется на TPL_CALLBACK, как и из функций уведомления, чтобы они не вклинились в запись.
+  EFI_TPL OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
+  RequestLogWrite (NULL, NULL);
+  gBS->RestoreTPL (OldTpl);
+
   Logger_Destruct (&gLogger);
   FlushAndCloseFileProtocol(&gLogFileProtocol);
 
+  Vector_Destruct (&gProtocolCallStats);
+  Vector_Destruct (&gMultiProtocolCallStats);
+  Vector_Destruct (&gSortedProtocolCallStats);
+
+  // Пока уведомление зарегистрировано, OnVolumeArrival() может дописать в очередь.
+  if (gVolumeArrivalEvent != NULL) {
+    gBS->CloseEvent (gVolumeArrivalEvent);
+    gVolumeArrivalEvent = NULL;
+    gVolumeRegistration = NULL;
+  }
+  Vector_Destruct (&gPendingVolumes);
+
+  if (gOutputBuffer != (UINT8 *)gFallbackOutputBuffer) {
+    gBS->FreePool (gOutputBuffer);
+    gOutputBuffer     = (UINT8 *)gFallbackOutputBuffer;
+    gOutputBufferSize = sizeof (gFallbackOutputBuffer);
+  }
+
   DBG_EXIT_STATUS (EFI_SUCCESS);
   return EFI_SUCCESS;
 }
@@ -129,20 +538,52 @@ ProcessNewEvents ()
 {
   DBG_ENTER ()
 
-  STATIC UINTN gLoggedEventCount;
+  // Блок статистики пишется только по явному запросу: по таймеру, на границах фаз,
+  // перед ExitBootServices() и при выгрузке, - а не на каждую порцию событий.
+  BOOLEAN WriteFooter = gLogWriteRequested;
+
+  // События копятся в памяти, пока политика записи не скажет, что пора; в том числе не ищем и флешку.
+  if (!IsLogWriteDue ()) {
+    DBG_EXIT ();
+    return;
+  }
+
   EFI_STATUS Status;
+  UINT64     Start = Timestamp_Read ();
 
   if (gLogFileProtocol == NULL) {
     // В случае если у нас отняли флешку начинаем писать лог с начала.
-    gLoggedEventCount = 0;
-
+    gLoggedEventCount       = 0;
+    gPreviousEventTimestamp = 0;
+    gLogFooterEnd           = 0;
+    Vector_Clear (&gProtocolCallStats);
+    Vector_Clear (&gMultiProtocolCallStats);
+
+    // Поиск тома с log.txt повторяется на каждую порцию событий, пока том не найдётся, и тоже стоит времени,
+    // хотя проверяются только тома, появившиеся с прошлого раза.
     Status = FindFileSystem (&gLogFileProtocol);
     if (EFI_ERROR (Status)) {
+      gWriterTicks += Timestamp_Read () - Start;
+      gWriterPasses++;
       DBG_EXIT_STATUS (Status);
       return;
     }
+
+    // Заголовок двоичного лога, либо метка порядка байтов, по которой просмотрщики узнают UTF-8.
+    if (FeaturePcdGet (PcdBinaryLogFormat)) {
+      WriteBinaryLogHeader (&gLogFileProtocol);
+    } else if (FeaturePcdGet (PcdLogUtf8Encoding)) {
+      gOutputBuffer[gOutputBufferUsed++] = 0xEF;
+      gOutputBuffer[gOutputBufferUsed++] = 0xBB;
+      gOutputBuffer[gOutputBufferUsed++] = 0xBF;
+    }
   }
 
+  // При отложенной записи первая выгрузка сбрасывает на диск первое событие отдельно: такой Flush()
+  // дописывает одну порцию в маленький файл, как и потоковый режим, и по нему оценивается выигрыш.
+  BOOLEAN MeasureFlush  = FixedPcdGet8 (PcdLogFlushPolicy) == LOG_FLUSH_POLICY_DEFERRED_EXPORT && gDeferredExportEvents == 0;
+  BOOLEAN FlushMeasured = FALSE;
+
   StartPlayingAnimation ();
 
   for (UINTN EventCount = Logger_GetEventCount (&gLogger); gLoggedEventCount < EventCount; ++gLoggedEventCount) {
@@ -155,9 +596,29 @@ ProcessNewEvents ()
       return;
     }
 
-    AddNewEventToLog(&Event, gLoggedEventCount + 1, &gLogFileProtocol);
+    // Имена хэндлов, которые не вычислялись в перехваченных сервисах, получаем здесь.
+    ResolveEventHandleName (&Event);
+
+    if (FeaturePcdGet (PcdBinaryLogFormat)) {
+      AddNewEventToBinaryLog (&Event, &gLogFileProtocol);
+    } else {
+      AddNewEventToLog(&Event, gLoggedEventCount + 1, &gLogFileProtocol);
+    }
+    AccountProtocolCallDuration (&Event);
     UpdatePlayingAnimation ();
 
+    if (MeasureFlush) {
+      MeasureFlush = FALSE;
+      FlushOutputBuffer (&gLogFileProtocol);
+      if (gLogFileProtocol != NULL) {
+        UINT64 FlushStart = Timestamp_Read ();
+        gLogFileProtocol->Flush(gLogFileProtocol);
+        gDeferredExportFlushTicks = Timestamp_Read () - FlushStart;
+        FlushMeasured             = TRUE;
+        Timestamp_AccountOverhead (OVERHEAD_STAGE_FLUSH, FlushStart);
+      }
+    }
+
     if (gLogFileProtocol == NULL) {
       // Флешку вынули во время записи.
       // Ничего страшного, запишем лог заново когда её снова подключат.
@@ -165,38 +626,245 @@ ProcessNewEvents ()
     }
   }
 
-  // Если у нас не вынули флешку, то flush'им лог.
+  // Первая выгрузка дошла до конца: весь лог, что был в памяти, ушёл в файл.
+  if (gLogFileProtocol != NULL && FlushMeasured) {
+    gDeferredExportEvents = gLoggedEventCount;
+  }
+
+  // Если у нас не вынули флешку, то обновляем статистику, если пора, и flush'им лог.
   if (gLogFileProtocol) {
+    if (WriteFooter) {
+      WriteLogFooter (&gLogFileProtocol);
+    } else {
+      DropLogFooter (&gLogFileProtocol);
+    }
+  }
+  if (gLogFileProtocol) {
+    UINT64 FlushStart = Timestamp_Read ();
     gLogFileProtocol->Flush(gLogFileProtocol);
+    Timestamp_AccountOverhead (OVERHEAD_STAGE_FLUSH, FlushStart);
   }
 
   StopPlayingAnimation ();
 
+  gWriterTicks += Timestamp_Read () - Start;
+  gWriterPasses++;
+
   DBG_EXIT ();
 }
 
 // -----------------------------------------------------------------------------
 /**
- * Дописывает информацию о событии Event в gLogFileProtocol.
- * В случае неудачи устанавливает gLogFileProtocol в NULL.
+ * Решает по PcdLogFlushPolicy, пора ли записывать накопившиеся события в лог.
+ * Запрос от RequestLogWrite() выполняется при любой политике и при этом сбрасывается.
 */
-VOID
-AddNewEventToLog (
-  IN     LOADING_EVENT      *Event,
-  IN     UINTN              EventNumber,
-  IN OUT EFI_FILE_PROTOCOL  **gLogFileProtocol
+BOOLEAN
+IsLogWriteDue (
+  VOID
   )
 {
-  STATIC CHAR16 *StrUnknown = L"<UNKNOWN>";
-  unsigned Number = EventNumber;
+  if (gLogWriteRequested) {
+    gLogWriteRequested = FALSE;
+    return TRUE;
+  }
 
-  switch (Event->Type)
-  {
-  case LOG_ENTRY_TYPE_PROTOCOL_INSTALLED:
+  switch (FixedPcdGet8 (PcdLogFlushPolicy)) {
+  case LOG_FLUSH_POLICY_EVERY_EVENT:
+    return TRUE;
+
+  case LOG_FLUSH_POLICY_EVERY_N_EVENTS:
+    return Logger_GetEventCount (&gLogger) - gLoggedEventCount >= FixedPcdGet32 (PcdLogFlushEventInterval);
+
+  case LOG_FLUSH_POLICY_PHASE_BOUNDARIES:
+    {
+      // ProcessNewEvents() вызывается отложенно, по таймеру или после возврата вызывающего кода, и может получить
+      // сразу несколько событий, поэтому просматриваем все, что пришли с прошлого раза.
+      STATIC UINTN  CheckedEventCount;
+      LOADING_EVENT Event;
+      UINTN         EventCount = Logger_GetEventCount (&gLogger);
+      BOOLEAN       BdsEntered = FALSE;
+
+      for (; CheckedEventCount < EventCount; ++CheckedEventCount) {
+        if (!EFI_ERROR (Logger_GetEvent (&gLogger, CheckedEventCount, &Event))
+          && Event.Type == LOG_ENTRY_TYPE_BDS_STAGE_ENTERED) {
+          BdsEntered = TRUE;
+        }
+      }
+
+      return BdsEntered;
+    }
+
+  default:
+    // Остальные политики пишут лог только по RequestLogWrite().
+    return FALSE;
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Записывает в лог все накопившиеся события, независимо от политики записи.
+ * Функция уведомления для событий, зарегистрированных в RegisterLogWriteTriggers(), вызывается и из Unload().
+*/
+VOID
+EFIAPI
+RequestLogWrite (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  gLogWriteRequested = TRUE;
+  ProcessNewEvents ();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Последняя запись лога перед ExitBootServices(): дописывает все накопившиеся события
+ * и обрезает заранее растянутый лог-файл по концу лога.
+*/
+STATIC
+VOID
+EFIAPI
+FinalizeLog (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  RequestLogWrite (Event, Context);
+
+  if (gLogFileProtocol != NULL && FeaturePcdGet (PcdPreallocateLogFile)) {
+    TruncateLogFile (&gLogFileProtocol);
+    gLogFileProtocol->Flush(gLogFileProtocol);
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Регистрирует события, по которым лог записывается вне зависимости от поступления новых событий:
+ * таймер для LOG_FLUSH_POLICY_PERIODIC, EndOfDxe и ReadyToBoot для LOG_FLUSH_POLICY_PHASE_BOUNDARIES,
+ * ReadyToBoot для LOG_FLUSH_POLICY_DEFERRED_EXPORT,
+ * и для всех политик - последнюю запись перед ExitBootServices(): в ней пишется итоговый блок статистики,
+ * а при PcdPreallocateLogFile ещё и обрезается файл.
+*/
+VOID
+RegisterLogWriteTriggers (
+  VOID
+  )
+{
+  DBG_ENTER ();
+
+  EFI_STATUS Status;
+  UINT8      Policy = FixedPcdGet8 (PcdLogFlushPolicy);
+
+  if (Policy == LOG_FLUSH_POLICY_PERIODIC) {
+    Status = gBS->CreateEvent (EVT_TIMER | EVT_NOTIFY_SIGNAL, TPL_CALLBACK, RequestLogWrite, NULL, &gLogWriteTimerEvent);
+    if (!EFI_ERROR (Status)) {
+      Status = gBS->SetTimer (gLogWriteTimerEvent, TimerPeriodic, EFI_TIMER_PERIOD_MILLISECONDS (FixedPcdGet32 (PcdLogFlushPeriodMs)));
+    }
+    if (EFI_ERROR (Status)) {
+      DBG_ERROR ("Periodic log write timer failed: %r\n", Status);
+    }
+  }
+
+  if (Policy == LOG_FLUSH_POLICY_PHASE_BOUNDARIES) {
+    Status = gBS->CreateEventEx (EVT_NOTIFY_SIGNAL, TPL_CALLBACK, RequestLogWrite, NULL, &gEfiEndOfDxeEventGroupGuid, &gEndOfDxeEvent);
+    if (EFI_ERROR (Status)) {
+      DBG_ERROR ("EndOfDxe notification failed: %r\n", Status);
+    }
+  }
+
+  if (Policy == LOG_FLUSH_POLICY_PHASE_BOUNDARIES || Policy == LOG_FLUSH_POLICY_DEFERRED_EXPORT) {
+    Status = gBS->CreateEventEx (EVT_NOTIFY_SIGNAL, TPL_CALLBACK, RequestLogWrite, NULL, &gEfiEventReadyToBootGuid, &gReadyToBootEvent);
+    if (EFI_ERROR (Status)) {
+      DBG_ERROR ("ReadyToBoot notification failed: %r\n", Status);
+    }
+  }
+
+  // До того, как карта памяти зафиксирована: драйверу файловой системы ещё можно выделять память.
+  Status = gBS->CreateEventEx (EVT_NOTIFY_SIGNAL, TPL_CALLBACK, FinalizeLog, NULL, &gEfiEventBeforeExitBootServicesGuid, &gBeforeExitBootServicesEvent);
+  if (EFI_ERROR (Status)) {
+    DBG_ERROR ("BeforeExitBootServices notification failed: %r\n", Status);
+  }
+
+  DBG_EXIT ();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Закрывает события, зарегистрированные в RegisterLogWriteTriggers(). Таймер перед этим останавливается.
+*/
+VOID
+CloseLogWriteTriggers (
+  VOID
+  )
+{
+  DBG_ENTER ();
+
+  if (gLogWriteTimerEvent != NULL) {
+    gBS->SetTimer (gLogWriteTimerEvent, TimerCancel, 0);
+    gBS->CloseEvent (gLogWriteTimerEvent);
+    gLogWriteTimerEvent = NULL;
+  }
+
+  if (gEndOfDxeEvent != NULL) {
+    gBS->CloseEvent (gEndOfDxeEvent);
+    gEndOfDxeEvent = NULL;
+  }
+
+  if (gReadyToBootEvent != NULL) {
+    gBS->CloseEvent (gReadyToBootEvent);
+    gReadyToBootEvent = NULL;
+  }
+
+  if (gBeforeExitBootServicesEvent != NULL) {
+    gBS->CloseEvent (gBeforeExitBootServicesEvent);
+    gBeforeExitBootServicesEvent = NULL;
+  }
+
+  DBG_EXIT ();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает информацию о событии Event в gLogFileProtocol.
+ * В случае неудачи устанавливает gLogFileProtocol в NULL.
+*/
+VOID
+AddNewEventToLog (
+  IN     LOADING_EVENT      *Event,
+  IN     UINTN              EventNumber,
+  IN OUT EFI_FILE_PROTOCOL  **gLogFileProtocol
+  )
+{
+  STATIC CHAR16 *StrUnknown = L"<UNKNOWN>";
+  CHAR16 Prefix[EVENT_PREFIX_LENGTH];
+
+  // Номер события, время от сброса процессора и от предыдущего события.
+  if (Timestamp_GetFrequency () != 0) {
+    if (gPreviousEventTimestamp == 0 || Event->Timestamp < gPreviousEventTimestamp) {
+      gPreviousEventTimestamp = Event->Timestamp;
+    }
+
+    UINT64 Absolute = Timestamp_ToMicroseconds (Event->Timestamp);
+    UINT64 Delta    = Timestamp_ToMicroseconds (Event->Timestamp - gPreviousEventTimestamp);
+
+    UnicodeSPrint (Prefix, sizeof (Prefix), L"-%5u- [%5u.%06u s, +%6u.%03u ms]",
+      (unsigned)EventNumber,
+      (unsigned)(Absolute / 1000000), (unsigned)(Absolute % 1000000),
+      (unsigned)(Delta / 1000),       (unsigned)(Delta % 1000)
+      );
+  } else {
+    UnicodeSPrint (Prefix, sizeof (Prefix), L"-%5u-", (unsigned)EventNumber);
+  }
+  gPreviousEventTimestamp = Event->Timestamp;
+
+  switch (Event->Type)
+  {
+  case LOG_ENTRY_TYPE_PROTOCOL_INSTALLED:
     {
       CHAR16 *HandleDescription = Event->ProtocolInstalled.HandleDescription;
-      CHAR16 *GuidName          = GetProtocolName (&Event->ProtocolInstalled.Guid);
+      CONST CHAR8 *GuidName     = GetInternedProtocolName (Event->ProtocolInstalled.GuidId);
       CHAR16 *Success           = NULL;
+      EFI_GUID Guid;
 
       if (Event->ProtocolInstalled.Successful) {
         Success = L"SUCCESS";
@@ -205,12 +873,13 @@ AddNewEventToLog (
       }
 
       if (GuidName != NULL) {
-        PrintToFile (gLogFileProtocol, L"-%5u- PROTOCOL-INSTALLED (%s): %-60s", Number, Success,
+        PrintToFile (gLogFileProtocol, L"%s PROTOCOL-INSTALLED (%s): %-60a", Prefix, Success,
           GuidName
           );
       } else {
-        PrintToFile (gLogFileProtocol, L"-%5u- PROTOCOL-INSTALLED (%s): %-60g", Number, Success,
-          &Event->ProtocolInstalled.Guid
+        GetInternedProtocolGuid (Event->ProtocolInstalled.GuidId, &Guid);
+        PrintToFile (gLogFileProtocol, L"%s PROTOCOL-INSTALLED (%s): %-60g", Prefix, Success,
+          &Guid
           );
       }
 
@@ -218,6 +887,7 @@ AddNewEventToLog (
         PrintToFile (gLogFileProtocol, L" at: %s", HandleDescription);
       }
 
+      PrintCallDuration (gLogFileProtocol, &Event->ProtocolInstalled);
       PrintToFile (gLogFileProtocol, L"\r\n");
     }
     break;
@@ -225,8 +895,9 @@ AddNewEventToLog (
   case LOG_ENTRY_TYPE_PROTOCOL_REINSTALLED:
     {
       CHAR16 *HandleDescription = Event->ProtocolReinstalled.HandleDescription;
-      CHAR16 *GuidName          = GetProtocolName (&Event->ProtocolReinstalled.Guid);
+      CONST CHAR8 *GuidName     = GetInternedProtocolName (Event->ProtocolReinstalled.GuidId);
       CHAR16 *Success           = NULL;
+      EFI_GUID Guid;
 
       if (Event->ProtocolReinstalled.Successful) {
         Success = L"SUCCESS";
@@ -235,12 +906,13 @@ AddNewEventToLog (
       }
 
       if (GuidName != NULL) {
-        PrintToFile (gLogFileProtocol, L"-%5u- PROTOCOL-REINSTALLED (%s): %-60s", Number, Success,
+        PrintToFile (gLogFileProtocol, L"%s PROTOCOL-REINSTALLED (%s): %-60a", Prefix, Success,
           GuidName
           );
       } else {
-        PrintToFile (gLogFileProtocol, L"-%5u- PROTOCOL-REINSTALLED (%s): %-60g", Number, Success,
-          &Event->ProtocolReinstalled.Guid
+        GetInternedProtocolGuid (Event->ProtocolReinstalled.GuidId, &Guid);
+        PrintToFile (gLogFileProtocol, L"%s PROTOCOL-REINSTALLED (%s): %-60g", Prefix, Success,
+          &Guid
           );
       }
 
@@ -248,34 +920,38 @@ AddNewEventToLog (
         PrintToFile (gLogFileProtocol, L" at: %s", HandleDescription);
       }
 
+      PrintCallDuration (gLogFileProtocol, &Event->ProtocolReinstalled);
       PrintToFile (gLogFileProtocol, L"\r\n");
     }
     break;
 
   case LOG_ENTRY_TYPE_PROTOCOL_EXISTS_ON_STARTUP:
     {
-      CHAR16 *GuidName = GetProtocolName(&Event->ProtocolExistsOnStartup.Guid);
+      CONST CHAR8 *GuidName = GetInternedProtocolName (Event->ProtocolExistsOnStartup.GuidId);
+      EFI_GUID    Guid;
 
       if (Event->ProtocolExistsOnStartup.HandleDescription != NULL) {
         if (GuidName != NULL) {
-          PrintToFile (gLogFileProtocol, L"-%5u- PROTOCOL-EXISTS-ON-STARTUP: %-60s at: %s\r\n", Number,
+          PrintToFile (gLogFileProtocol, L"%s PROTOCOL-EXISTS-ON-STARTUP: %-60a at: %s\r\n", Prefix,
             GuidName,
             Event->ProtocolExistsOnStartup.HandleDescription
             );
         } else {
-          PrintToFile (gLogFileProtocol, L"-%5u- PROTOCOL-EXISTS-ON-STARTUP: %-60g at: %s\r\n", Number,
-            &Event->ProtocolExistsOnStartup.Guid,
+          GetInternedProtocolGuid (Event->ProtocolExistsOnStartup.GuidId, &Guid);
+          PrintToFile (gLogFileProtocol, L"%s PROTOCOL-EXISTS-ON-STARTUP: %-60g at: %s\r\n", Prefix,
+            &Guid,
             Event->ProtocolExistsOnStartup.HandleDescription
             );
         }
       } else {
         if (GuidName != NULL) {
-          PrintToFile (gLogFileProtocol, L"-%5u- PROTOCOL-EXISTS-ON-STARTUP: %s\r\n", Number,
+          PrintToFile (gLogFileProtocol, L"%s PROTOCOL-EXISTS-ON-STARTUP: %a\r\n", Prefix,
             GuidName
             );
         } else {
-          PrintToFile (gLogFileProtocol, L"-%5u- PROTOCOL-EXISTS-ON-STARTUP: %g\r\n", Number,
-            &Event->ProtocolExistsOnStartup.Guid
+          GetInternedProtocolGuid (Event->ProtocolExistsOnStartup.GuidId, &Guid);
+          PrintToFile (gLogFileProtocol, L"%s PROTOCOL-EXISTS-ON-STARTUP: %g\r\n", Prefix,
+            &Guid
             );
         }
       }
@@ -285,8 +961,9 @@ AddNewEventToLog (
   case LOG_ENTRY_TYPE_PROTOCOL_REMOVED:
     {
       CHAR16 *HandleDescription = Event->ProtocolRemoved.HandleDescription;
-      CHAR16 *GuidName          = GetProtocolName (&Event->ProtocolRemoved.Guid);
+      CONST CHAR8 *GuidName     = GetInternedProtocolName (Event->ProtocolRemoved.GuidId);
       CHAR16 *Success           = NULL;
+      EFI_GUID Guid;
 
       if (Event->ProtocolRemoved.Successful) {
         Success = L"SUCCESS";
@@ -295,12 +972,13 @@ AddNewEventToLog (
       }
 
       if (GuidName != NULL) {
-        PrintToFile (gLogFileProtocol, L"-%5u- PROTOCOL-REMOVED (%s): %-60s", Number, Success,
+        PrintToFile (gLogFileProtocol, L"%s PROTOCOL-REMOVED (%s): %-60a", Prefix, Success,
           GuidName
           );
       } else {
-        PrintToFile (gLogFileProtocol, L"-%5u- PROTOCOL-REMOVED (%s): %-60g", Number, Success,
-          &Event->ProtocolRemoved.Guid
+        GetInternedProtocolGuid (Event->ProtocolRemoved.GuidId, &Guid);
+        PrintToFile (gLogFileProtocol, L"%s PROTOCOL-REMOVED (%s): %-60g", Prefix, Success,
+          &Guid
           );
       }
 
@@ -308,6 +986,7 @@ AddNewEventToLog (
         PrintToFile (gLogFileProtocol, L" at: %s", HandleDescription);
       }
 
+      PrintCallDuration (gLogFileProtocol, &Event->ProtocolRemoved);
       PrintToFile (gLogFileProtocol, L"\r\n");
     }
     break;
@@ -317,8 +996,8 @@ AddNewEventToLog (
       CHAR16 *ImageName  = Event->ImageLoaded.ImageName       ? Event->ImageLoaded.ImageName       : StrUnknown;
       CHAR16 *ParentName = Event->ImageLoaded.ParentImageName ? Event->ImageLoaded.ParentImageName : StrUnknown;
 
-      PrintToFile (gLogFileProtocol, L"\r\n-%5u- IMAGE-LOADED: %-60s loaded by: %s\r\n",
-        Number, ImageName, ParentName
+      PrintToFile (gLogFileProtocol, L"\r\n%s IMAGE-LOADED: %-60s loaded by: %s\r\n",
+        Prefix, ImageName, ParentName
         );
     }
     break;
@@ -329,8 +1008,8 @@ AddNewEventToLog (
       CHAR16 *ImageName  = ImgExists->ImageName       ? ImgExists->ImageName       : StrUnknown;
       CHAR16 *ParentName = ImgExists->ParentImageName ? ImgExists->ParentImageName : StrUnknown;
 
-      PrintToFile (gLogFileProtocol, L"-%5u- IMAGE-EXISTS-ON-STARTUP: %-60s loaded by: %s\r\n",
-        Number, ImageName, ParentName
+      PrintToFile (gLogFileProtocol, L"%s IMAGE-EXISTS-ON-STARTUP: %-60s loaded by: %s\r\n",
+        Prefix, ImageName, ParentName
         );
     }
     break;
@@ -353,7 +1032,7 @@ AddNewEventToLog (
 
       STATIC CHAR16 Line[] = L"- --------------------------------------------------------------------------------\r\n";
       PrintToFile (gLogFileProtocol, Line);
-      PrintToFile (gLogFileProtocol, L"-%5u- BDS-STAGE-ENTERED: %s\r\n", Number, SubType);
+      PrintToFile (gLogFileProtocol, L"%s BDS-STAGE-ENTERED: %s\r\n", Prefix, SubType);
       PrintToFile (gLogFileProtocol, Line);
     }
     break;
@@ -362,12 +1041,12 @@ AddNewEventToLog (
     {
       CHAR16 *Message = Event->Error.Message ? Event->Error.Message : StrUnknown;
 
-      PrintToFile (gLogFileProtocol, L"\r\n\r\n-%5u- ERROR: %s\r\n\r\n", Number, Message);
+      PrintToFile (gLogFileProtocol, L"\r\n\r\n%s ERROR: %s\r\n\r\n", Prefix, Message);
     }
     break;
 
   default:
-    PrintToFile (gLogFileProtocol, L"\r\n\r\n-%5u- ERROR: Unknown event type\r\n\r\n\r\n", Number);
+    PrintToFile (gLogFileProtocol, L"\r\n\r\n%s ERROR: Unknown event type\r\n\r\n\r\n", Prefix);
     break;
   }
 }
@@ -396,62 +1075,136 @@ FindFileSystem (
   UINTN       HandleCount;
   EFI_HANDLE  *Handles = NULL;
 
-  Status = gBS->LocateHandleBuffer (
-                  ByProtocol,
-                  &gEfiSimpleFileSystemProtocolGuid,
-                  NULL,
-                  &HandleCount,
-                  &Handles
-                  );
-  RETURN_ON_ERR (Status)
-
-  for (UINTN Index = 0; Index < HandleCount; Index++) {
-    EFI_SIMPLE_FILE_SYSTEM_PROTOCOL *FileSystemProtocol = NULL;
-
-    // Получаем EFI_SIMPLE_FILE_SYSTEM_PROTOCOL.
-    Status = gBS->OpenProtocol (
-                    Handles[Index],
+  if (gVolumeRegistration == NULL) {
+    // Уведомления о новых томах нет: перебираем все тома, как раньше.
+    Status = gBS->LocateHandleBuffer (
+                    ByProtocol,
                     &gEfiSimpleFileSystemProtocolGuid,
-                    (VOID **)&FileSystemProtocol,
-                    gImageHandle,
                     NULL,
-                    EFI_OPEN_PROTOCOL_GET_PROTOCOL
+                    &HandleCount,
+                    &Handles
                     );
-    if (EFI_ERROR (Status)) {
-      continue;
+    RETURN_ON_ERR (Status)
+
+    for (UINTN Index = 0; Index < HandleCount; Index++) {
+      gVolumeProbes++;
+      if (!EFI_ERROR (ProbeVolume (Handles[Index], LogFileProtocol))) {
+        gLogVolume = Handles[Index];
+        SHELL_FREE_NON_NULL (Handles);
+        DBG_EXIT_STATUS (EFI_SUCCESS)
+        return EFI_SUCCESS;
+      }
     }
 
-    DBG_INFO1 ("Simple FS is found...\n");
+    DBG_INFO1 ("Simple FS is not found =(\n");
 
-    // Получаем корень файловой системы.
-    EFI_FILE_PROTOCOL *FileSystemRoot = NULL;
-    Status = FileSystemProtocol->OpenVolume(
-        FileSystemProtocol,
-        &FileSystemRoot
-        );
-    if (EFI_ERROR (Status)) {
-      continue;
-    }
+    SHELL_FREE_NON_NULL (Handles);
+    DBG_EXIT_STATUS (EFI_NOT_FOUND)
+    return EFI_NOT_FOUND;
+  }
 
-    EFI_FILE_PROTOCOL *File = NULL;
+  // Очередь разделена с OnVolumeArrival(), но оба работают на TPL_CALLBACK и друг друга не прерывают.
+  // Блокировку выше TPL_NOTIFY здесь брать нельзя: при росте очереди выделяется память.
 
-    // Ищем log.txt.
-    Status = FileSystemRoot->Open(
-                      FileSystemRoot,
-                      &File,
-                      L"log.txt",
-                      EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE,
-                      0
-                      );
-    if (EFI_ERROR (Status)) {
-      // Не нашли.
-      DBG_INFO1 ("log.txt is not found, skipping...\n");
-      FileSystemRoot->Close(FileSystemRoot);
-      continue;
+  // Том, на котором лог пропал, проверяем ещё раз: ошибка записи могла быть временной.
+  // Если флешку вынули и вставили снова, она придёт новым хэндлом через OnVolumeArrival().
+  if (gLogVolume != NULL) {
+    Vector_PushBack (&gPendingVolumes, &gLogVolume);
+    gLogVolume = NULL;
+  }
+
+  // Каждый том проверяется один раз; перебор всех томов сделал бы gKnownVolumeCount проверок.
+  UINTN Probes = 0;
+  for (;;) {
+    EFI_HANDLE *Last = Vector_PopBack (&gPendingVolumes);
+    if (Last == NULL) {
+      break;
+    }
+    EFI_HANDLE Volume = *Last;
+
+    gVolumeProbes++;
+    Probes++;
+    if (!EFI_ERROR (ProbeVolume (Volume, LogFileProtocol))) {
+      gLogVolume          = Volume;
+      gVolumeProbesSaved += gKnownVolumeCount > Probes ? gKnownVolumeCount - Probes : 0;
+      DBG_EXIT_STATUS (EFI_SUCCESS)
+      return EFI_SUCCESS;
     }
+  }
+
+  gVolumeProbesSaved += gKnownVolumeCount > Probes ? gKnownVolumeCount - Probes : 0;
+
+  DBG_INFO1 ("Simple FS is not found =(\n");
+
+  DBG_EXIT_STATUS (EFI_NOT_FOUND)
+  return EFI_NOT_FOUND;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Пытается открыть либо создать log.txt в корне тома Volume.
+*/
+EFI_STATUS
+ProbeVolume (
+  IN   EFI_HANDLE         Volume,
+  OUT  EFI_FILE_PROTOCOL  **LogFileProtocol
+  )
+{
+  DBG_ENTER ()
+
+  EFI_STATUS                      Status;
+  EFI_SIMPLE_FILE_SYSTEM_PROTOCOL *FileSystemProtocol = NULL;
+
+  // Получаем EFI_SIMPLE_FILE_SYSTEM_PROTOCOL.
+  Status = gBS->OpenProtocol (
+                  Volume,
+                  &gEfiSimpleFileSystemProtocolGuid,
+                  (VOID **)&FileSystemProtocol,
+                  gImageHandle,
+                  NULL,
+                  EFI_OPEN_PROTOCOL_GET_PROTOCOL
+                  );
+  RETURN_ON_ERR (Status)
+
+  DBG_INFO1 ("Simple FS is found...\n");
+
+  // Получаем корень файловой системы.
+  EFI_FILE_PROTOCOL *FileSystemRoot = NULL;
+  Status = FileSystemProtocol->OpenVolume(
+      FileSystemProtocol,
+      &FileSystemRoot
+      );
+  RETURN_ON_ERR (Status)
+
+  EFI_FILE_PROTOCOL *File = NULL;
+
+  // Ищем log.txt.
+  Status = FileSystemRoot->Open(
+                    FileSystemRoot,
+                    &File,
+                    L"log.txt",
+                    EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE,
+                    0
+                    );
+  if (EFI_ERROR (Status)) {
+    // Не нашли.
+    DBG_INFO1 ("log.txt is not found, skipping...\n");
+    FileSystemRoot->Close(FileSystemRoot);
+    DBG_EXIT_STATUS (Status)
+    return Status;
+  }
 
-    // Нашли, удаляем его и создаём новый.
-    DBG_INFO1 ("log.txt is found...\n");
+  // Нашли. Заодно подхватываем с этого же тома дополнительную БД имён протоколов, если она там есть.
+  DBG_INFO1 ("log.txt is found...\n");
+  LoadProtocolGuidDatabaseFromFile (FileSystemRoot);
+
+  if (FeaturePcdGet (PcdPreallocateLogFile)) {
+    // Файл не пересоздаём, а растягиваем заранее и перезаписываем с начала:
+    // тогда драйверу файловой системы не нужно выделять кластеры на каждую запись.
+    PreallocateLogFile (FileSystemRoot, File);
+    FileSystemRoot->Close(FileSystemRoot);
+  } else {
+    // Удаляем лог и создаём новый.
     Status = File->Delete(File);
 
     Status = FileSystemRoot->Open(
@@ -464,28 +1217,99 @@ FindFileSystem (
     FileSystemRoot->Close(FileSystemRoot);
     if (EFI_ERROR (Status)) {
       DBG_INFO1 ("Can\t create log.txt.\n");
-      continue;
+      DBG_EXIT_STATUS (Status)
+      return Status;
     }
+  }
 
-    // Готово, можно начинать писать в файл.
-    DBG_INFO1 ("log.txt is opened.\n");
-    *LogFileProtocol = File;
+  // Готово, можно начинать писать в файл.
+  DBG_INFO1 ("log.txt is opened.\n");
+  *LogFileProtocol = File;
 
-    SHELL_FREE_NON_NULL (Handles);
-    DBG_EXIT_STATUS (EFI_SUCCESS)
-    return EFI_SUCCESS;
+  DBG_EXIT_STATUS (EFI_SUCCESS)
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Подписывается на появление EFI_SIMPLE_FILE_SYSTEM_PROTOCOL и ставит в очередь на проверку уже имеющиеся тома.
+ * Если подписаться не удалось, FindFileSystem() перебирает все тома на каждой порции событий.
+*/
+VOID
+RegisterVolumeArrivalNotify (
+  VOID
+  )
+{
+  DBG_ENTER ();
+
+  EFI_STATUS  Status;
+  UINTN       HandleCount;
+  EFI_HANDLE  *Handles = NULL;
+
+  Status = gBS->CreateEvent (EVT_NOTIFY_SIGNAL, TPL_CALLBACK, OnVolumeArrival, NULL, &gVolumeArrivalEvent);
+  if (EFI_ERROR (Status)) {
+    DBG_ERROR ("Volume arrival event failed: %r\n", Status);
+    DBG_EXIT ();
+    return;
   }
 
-  DBG_INFO1 ("Simple FS is not found =(\n");
+  Status = gBS->RegisterProtocolNotify (&gEfiSimpleFileSystemProtocolGuid, gVolumeArrivalEvent, &gVolumeRegistration);
+  if (EFI_ERROR (Status)) {
+    DBG_ERROR ("Volume arrival notification failed: %r\n", Status);
+    gBS->CloseEvent (gVolumeArrivalEvent);
+    gVolumeArrivalEvent = NULL;
+    gVolumeRegistration = NULL;
+    DBG_EXIT ();
+    return;
+  }
+
+  // Уведомление приходит только о новых томах, уже имеющиеся ставим в очередь сами.
+  // Том, появившийся между этими двумя вызовами, попадёт в очередь дважды - это безвредно.
+  Status = gBS->LocateHandleBuffer (ByProtocol, &gEfiSimpleFileSystemProtocolGuid, NULL, &HandleCount, &Handles);
+  if (!EFI_ERROR (Status)) {
+    EFI_TPL OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
+    for (UINTN Index = 0; Index < HandleCount; Index++) {
+      if (!EFI_ERROR (Vector_PushBack (&gPendingVolumes, &Handles[Index]))) {
+        gKnownVolumeCount++;
+      }
+    }
+    gBS->RestoreTPL (OldTpl);
+  }
 
   SHELL_FREE_NON_NULL (Handles);
-  DBG_EXIT_STATUS (EFI_NOT_FOUND)
-  return EFI_NOT_FOUND;
+  DBG_EXIT ();
 }
 
 // -----------------------------------------------------------------------------
 /**
- * Печатает в файл.
+ * Ставит в очередь на проверку новые тома. Функция уведомления RegisterProtocolNotify().
+ * Сам том здесь не проверяется: это сделает FindFileSystem(), когда придёт время записывать лог.
+*/
+VOID
+EFIAPI
+OnVolumeArrival (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  EFI_HANDLE Volume;
+  UINTN      Size;
+
+  for (;;) {
+    Size = sizeof (Volume);
+    if (EFI_ERROR (gBS->LocateHandle (ByRegisterNotify, NULL, gVolumeRegistration, &Size, &Volume))) {
+      break;
+    }
+
+    if (!EFI_ERROR (Vector_PushBack (&gPendingVolumes, &Volume))) {
+      gKnownVolumeCount++;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Печатает в файл через буфер вывода: в файл текст попадёт при заполнении буфера, либо в FlushOutputBuffer().
  * Если не удалось, то устанавливает FileProtocol в NULL.
 */
 VOID
@@ -498,24 +1322,103 @@ PrintToFile (
 {
   DBG_ENTER ();
 
-  STATIC CHAR16 Buffer[PRINT_TO_FILE_BUFFER_LENGTH];
-
   if (FileProtocol == NULL || *FileProtocol == NULL) {
     DBG_EXIT_STATUS (EFI_ABORTED);
     return;
   }
 
+  if (FeaturePcdGet (PcdLogUtf8Encoding)) {
+    // Форматирование общее для обеих кодировок, строка перекодируется уже после него.
+    UINT64 Start = Timestamp_Read ();
+
+    VA_LIST Marker;
+    VA_START (Marker, Format);
+    UINTN Length = UnicodeVSPrint (gLineBuffer, sizeof (gLineBuffer), Format, Marker);
+    VA_END (Marker);
+
+    AppendUtf8ToOutputBuffer (FileProtocol, gLineBuffer, Length);
+
+    Timestamp_AccountOverhead (OVERHEAD_STAGE_FORMAT, Start);
+    DBG_EXIT ();
+    return;
+  }
+
+  // Одна строка занимает не больше PRINT_TO_FILE_BUFFER_LENGTH символов; если столько не влезет - сбрасываем буфер.
+  if (gOutputBufferSize - gOutputBufferUsed < PRINT_TO_FILE_BUFFER_LENGTH * sizeof (CHAR16)) {
+    MakeRoomInOutputBuffer (FileProtocol, PRINT_TO_FILE_BUFFER_LENGTH * sizeof (CHAR16));
+    if (*FileProtocol == NULL) {
+      DBG_EXIT_STATUS (EFI_ACCESS_DENIED);
+      return;
+    }
+  }
+
+  UINT64 Start = Timestamp_Read ();
+
   VA_LIST Marker;
   VA_START (Marker, Format);
-  UINTN Length = UnicodeVSPrint (Buffer, PRINT_TO_FILE_BUFFER_LENGTH * sizeof(CHAR16), Format, Marker) * sizeof(CHAR16);
+  gOutputBufferUsed += UnicodeVSPrint (
+                         (CHAR16 *)(gOutputBuffer + gOutputBufferUsed),
+                         PRINT_TO_FILE_BUFFER_LENGTH * sizeof (CHAR16),
+                         Format,
+                         Marker
+                         ) * sizeof (CHAR16);
   VA_END (Marker);
 
+  Timestamp_AccountOverhead (OVERHEAD_STAGE_FORMAT, Start);
+
+  DBG_EXIT ();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Записывает накопленное в буфере вывода в файл одним вызовом Write().
+ * Если не удалось, то закрывает файл и устанавливает FileProtocol в NULL, содержимое буфера теряется.
+*/
+VOID
+FlushOutputBuffer (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  )
+{
+  WriteOutputBuffer (FileProtocol, gOutputBufferUsed);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Записывает в файл первые Length байт буфера вывода одним вызовом Write(), остаток переносится в начало буфера.
+ * Если не удалось, то закрывает файл и устанавливает FileProtocol в NULL, содержимое буфера теряется.
+*/
+VOID
+WriteOutputBuffer (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol,
+  IN     UINTN             Length
+  )
+{
+  DBG_ENTER ();
+
+  UINTN Remainder   = gOutputBufferUsed - Length;
+  gOutputBufferUsed = 0;
+
+  if (FileProtocol == NULL || *FileProtocol == NULL) {
+    DBG_EXIT_STATUS (EFI_ABORTED);
+    return;
+  }
+
+  if (Length == 0) {
+    gOutputBufferUsed = Remainder;
+    DBG_EXIT ();
+    return;
+  }
+
+  UINT64 Start = Timestamp_Read ();
+
   EFI_STATUS Status;
+  UINTN      Written = Length;
   Status = (*FileProtocol)->Write(
                             (*FileProtocol),
-                            &Length,
-                            Buffer
+                            &Written,
+                            gOutputBuffer
                             );
+  Timestamp_AccountOverhead (OVERHEAD_STAGE_WRITE, Start);
   if (EFI_ERROR (Status)) {
     (*FileProtocol)->Close(*FileProtocol);
     *FileProtocol = NULL;
@@ -524,18 +1427,242 @@ PrintToFile (
     return;
   }
 
+  if (Remainder != 0) {
+    gBS->CopyMem (gOutputBuffer, gOutputBuffer + Length, Remainder);
+    gOutputBufferUsed = Remainder;
+  }
+
   DBG_EXIT ();
 }
 
 // -----------------------------------------------------------------------------
 /**
- * Корректно закрывает FileProtocol, если это ещё не было сделано.
+ * Освобождает в буфере вывода место хотя бы под Needed байт.
+ * При PcdPreallocateLogFile в файл уходит только часть буфера до последней границы кластера, чтобы запись
+ * шла целыми кластерами; остаток ждёт следующей записи. Если так места не хватит, буфер пишется целиком.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+VOID
+MakeRoomInOutputBuffer (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol,
+  IN     UINTN             Needed
+  )
+{
+  UINT64 Position;
+
+  if (FeaturePcdGet (PcdPreallocateLogFile)
+    && gLogFileClusterSize != 0
+    && FileProtocol != NULL && *FileProtocol != NULL
+    && !EFI_ERROR ((*FileProtocol)->GetPosition (*FileProtocol, &Position))) {
+    UINT64 End     = Position + gOutputBufferUsed;
+    UINT64 Aligned = End - End % gLogFileClusterSize;
+
+    if (Aligned > Position && End - Aligned + Needed <= gOutputBufferSize) {
+      WriteOutputBuffer (FileProtocol, (UINTN)(Aligned - Position));
+      return;
+    }
+  }
+
+  FlushOutputBuffer (FileProtocol);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в буфер вывода Length символов строки Line в кодировке UTF-8.
+ * Если буфер заполнился, сбрасывает его в файл и продолжает; если не удалось, то устанавливает FileProtocol в NULL.
+*/
+VOID
+AppendUtf8ToOutputBuffer (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol,
+  IN     CONST CHAR16      *Line,
+  IN     UINTN             Length
+  )
+{
+  for (UINTN Index = 0; Index < Length; ++Index) {
+    // Один символ занимает не больше 4 байт.
+    if (gOutputBufferSize - gOutputBufferUsed < 4) {
+      MakeRoomInOutputBuffer (FileProtocol, 4);
+      if (*FileProtocol == NULL) {
+        return;
+      }
+    }
+
+    UINT32 CodePoint = Line[Index];
+    UINT8  *Out      = gOutputBuffer + gOutputBufferUsed;
+
+    if (CodePoint >= 0xD800 && CodePoint <= 0xDFFF) {
+      // Суррогатная пара собирается в один символ, одинокий суррогат в UTF-8 не представим.
+      if (CodePoint <= 0xDBFF && Index + 1 < Length && Line[Index + 1] >= 0xDC00 && Line[Index + 1] <= 0xDFFF) {
+        CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Line[++Index] - 0xDC00);
+      } else {
+        CodePoint = L'?';
+      }
+    }
+
+    if (CodePoint < 0x80) {
+      Out[0] = (UINT8)CodePoint;
+      gOutputBufferUsed += 1;
+    } else if (CodePoint < 0x800) {
+      Out[0] = (UINT8)(0xC0 | (CodePoint >> 6));
+      Out[1] = (UINT8)(0x80 | (CodePoint & 0x3F));
+      gOutputBufferUsed += 2;
+    } else if (CodePoint < 0x10000) {
+      Out[0] = (UINT8)(0xE0 | (CodePoint >> 12));
+      Out[1] = (UINT8)(0x80 | ((CodePoint >> 6) & 0x3F));
+      Out[2] = (UINT8)(0x80 | (CodePoint & 0x3F));
+      gOutputBufferUsed += 3;
+    } else {
+      Out[0] = (UINT8)(0xF0 | (CodePoint >> 18));
+      Out[1] = (UINT8)(0x80 | ((CodePoint >> 12) & 0x3F));
+      Out[2] = (UINT8)(0x80 | ((CodePoint >> 6) & 0x3F));
+      Out[3] = (UINT8)(0x80 | (CodePoint & 0x3F));
+      gOutputBufferUsed += 4;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Читает информацию InformationType о файле File в буфер, выделенный из пула.
+ *
+ * @param File             Файл или том.
+ * @param InformationType  gEfiFileInfoGuid, gEfiFileSystemInfoGuid и т.п.
+ * @param Info             Сюда записывается указатель на информацию, освобождать через gBS->FreePool().
+ *
+ * @retval EFI_SUCCESS     Информация прочитана.
+ * @retval Что-то другое.  Какая-то ошибка, Info не выделен.
+*/
+EFI_STATUS
+GetFileInfo (
+  IN  EFI_FILE_PROTOCOL  *File,
+  IN  EFI_GUID           *InformationType,
+  OUT VOID               **Info
+  )
+{
+  EFI_STATUS Status;
+  UINTN      InfoSize = 0;
+
+  Status = File->GetInfo (File, InformationType, &InfoSize, NULL);
+  if (Status != EFI_BUFFER_TOO_SMALL) {
+    return EFI_ERROR (Status) ? Status : EFI_DEVICE_ERROR;
+  }
+
+  Status = gBS->AllocatePool (EfiBootServicesData, InfoSize, Info);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = File->GetInfo (File, InformationType, &InfoSize, *Info);
+  if (EFI_ERROR (Status)) {
+    gBS->FreePool (*Info);
+    *Info = NULL;
+  }
+
+  return Status;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Растягивает лог-файл до PcdLogFilePreallocationSize байт и запоминает размер кластера тома.
+ * Файл только растёт: если он уже больше, за концом нового лога до TruncateLogFile() лежит хвост прежнего.
+*/
+VOID
+PreallocateLogFile (
+  IN EFI_FILE_PROTOCOL *FileSystemRoot,
+  IN EFI_FILE_PROTOCOL *File
+  )
+{
+  DBG_ENTER ();
+
+  EFI_STATUS           Status;
+  EFI_FILE_SYSTEM_INFO *FileSystemInfo;
+  EFI_FILE_INFO        *FileInfo;
+
+  gLogFileEnd         = 0;
+  gLogFileClusterSize = 0;
+
+  // Драйвер FAT отдаёт в BlockSize размер кластера.
+  if (!EFI_ERROR (GetFileInfo (FileSystemRoot, &gEfiFileSystemInfoGuid, (VOID **)&FileSystemInfo))) {
+    gLogFileClusterSize = FileSystemInfo->BlockSize;
+    gBS->FreePool (FileSystemInfo);
+  }
+
+  Status = GetFileInfo (File, &gEfiFileInfoGuid, (VOID **)&FileInfo);
+  if (EFI_ERROR (Status)) {
+    DBG_ERROR ("log.txt info is not available: %r\n", Status);
+    DBG_EXIT_STATUS (Status);
+    return;
+  }
+
+  if (FileInfo->FileSize < FixedPcdGet32 (PcdLogFilePreallocationSize)) {
+    FileInfo->FileSize = FixedPcdGet32 (PcdLogFilePreallocationSize);
+    Status = File->SetInfo (File, &gEfiFileInfoGuid, (UINTN)FileInfo->Size, FileInfo);
+    if (EFI_ERROR (Status)) {
+      DBG_ERROR ("log.txt preallocation failed: %r\n", Status);
+    }
+  }
+
+  gBS->FreePool (FileInfo);
+
+  DBG_EXIT ();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Обрезает заранее растянутый лог-файл по концу лога. Без PcdPreallocateLogFile ничего не делает.
+ * Буфер вывода к этому моменту должен быть уже записан.
+*/
+VOID
+TruncateLogFile (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  )
+{
+  DBG_ENTER ();
+
+  EFI_STATUS    Status;
+  UINT64        Position;
+  EFI_FILE_INFO *FileInfo;
+
+  if (!FeaturePcdGet (PcdPreallocateLogFile) || FileProtocol == NULL || *FileProtocol == NULL) {
+    DBG_EXIT ();
+    return;
+  }
+
+  Status = (*FileProtocol)->GetPosition (*FileProtocol, &Position);
+  if (!EFI_ERROR (Status)) {
+    Status = GetFileInfo (*FileProtocol, &gEfiFileInfoGuid, (VOID **)&FileInfo);
+  }
+  if (EFI_ERROR (Status)) {
+    DBG_EXIT_STATUS (Status);
+    return;
+  }
+
+  // Обычно позиция стоит на начале блока статистики, а конец лога - за ним.
+  FileInfo->FileSize = MAX (Position, gLogFileEnd);
+  Status = (*FileProtocol)->SetInfo (*FileProtocol, &gEfiFileInfoGuid, (UINTN)FileInfo->Size, FileInfo);
+  if (EFI_ERROR (Status)) {
+    DBG_ERROR ("log.txt truncation failed: %r\n", Status);
+  }
+
+  gBS->FreePool (FileInfo);
+
+  DBG_EXIT_STATUS (Status);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Корректно закрывает FileProtocol, если это ещё не было сделано.
 */
 VOID
 FlushAndCloseFileProtocol (
   IN OUT EFI_FILE_PROTOCOL **FileProtocol
   )
 {
+  if (FileProtocol && *FileProtocol) {
+    FlushOutputBuffer (FileProtocol);
+    TruncateLogFile (FileProtocol);
+  }
+
   if (FileProtocol && *FileProtocol) {
     (*FileProtocol)->Flush(*FileProtocol);
     (*FileProtocol)->Close(*FileProtocol);
@@ -544,3 +1671,622 @@ FlushAndCloseFileProtocol (
 }
 
 // -----------------------------------------------------------------------------
+/**
+ * Дописывает длительность вызова сервиса, если она измерялась.
+*/
+VOID
+PrintCallDuration (
+  IN OUT EFI_FILE_PROTOCOL            **FileProtocol,
+  IN     LOG_ENTRY_PROTOCOL_INSTALLED *Call
+  )
+{
+  if (Call->Duration != 0 && Timestamp_GetFrequency () != 0) {
+    PrintToFile (FileProtocol, Call->MultipleCall ? L" in: %u us (whole multi-protocol call)" : L" in: %u us",
+      (unsigned)Timestamp_ToMicroseconds (Call->Duration)
+      );
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Учитывает длительность вызова сервиса из события Event в gProtocolCallStats,
+ * либо в gMultiProtocolCallStats для Install/UninstallMultipleProtocolInterfaces().
+*/
+VOID
+AccountProtocolCallDuration (
+  IN LOADING_EVENT *Event
+  )
+{
+  LOG_ENTRY_PROTOCOL_INSTALLED *Call;
+
+  // У всех трёх событий одна и та же структура.
+  switch (Event->Type) {
+  case LOG_ENTRY_TYPE_PROTOCOL_INSTALLED:   Call = &Event->ProtocolInstalled;   break;
+  case LOG_ENTRY_TYPE_PROTOCOL_REINSTALLED: Call = &Event->ProtocolReinstalled; break;
+  case LOG_ENTRY_TYPE_PROTOCOL_REMOVED:     Call = &Event->ProtocolRemoved;     break;
+  default:
+    return;
+  }
+
+  if (Call->Duration == 0 || Call->GuidId == PROTOCOL_GUID_ID_INVALID) {
+    return;
+  }
+
+  // Вызов для нескольких протоколов нельзя приписать одному из них: в нём и уведомления на все его протоколы.
+  // Длительность такого вызова есть только у первого события, по его GUID'у вызов и учитывается.
+  VECTOR *CallStats = Call->MultipleCall ? &gMultiProtocolCallStats : &gProtocolCallStats;
+
+  // Идентификаторы GUID'ов плотные, поэтому статистика хранится прямо по индексу.
+  while (Vector_Size (CallStats) <= Call->GuidId) {
+    PROTOCOL_CALL_STATS Empty = { (PROTOCOL_GUID_ID)Vector_Size (CallStats), 0, 0, 0 };
+    if (EFI_ERROR (Vector_PushBack (CallStats, &Empty))) {
+      return;
+    }
+  }
+
+  PROTOCOL_CALL_STATS *Stats = Vector_Get (CallStats, Call->GuidId);
+  Stats->Count++;
+  Stats->Total += Call->Duration;
+  Stats->Max    = MAX (Stats->Max, Call->Duration);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Упорядочивает PROTOCOL_CALL_STATS по убыванию суммарной длительности.
+*/
+STATIC
+INTN
+EFIAPI
+CompareProtocolCallStatsByTotal (
+  IN CONST VOID *Left,
+  IN CONST VOID *Right
+  )
+{
+  UINT64 LeftTotal  = ((CONST PROTOCOL_CALL_STATS *)Left)->Total;
+  UINT64 RightTotal = ((CONST PROTOCOL_CALL_STATS *)Right)->Total;
+
+  if (LeftTotal == RightTotal) {
+    return 0;
+  }
+
+  return (LeftTotal > RightTotal) ? -1 : 1;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Собирает в gSortedProtocolCallStats протоколы из CallStats с измеренными вызовами, по убыванию суммарной длительности.
+ *
+ * @param CallStats                 gProtocolCallStats или gMultiProtocolCallStats.
+ *
+ * @retval EFI_SUCCESS              gSortedProtocolCallStats заполнен.
+ * @retval EFI_OUT_OF_RESOURCES     Не удалось выделить память.
+*/
+EFI_STATUS
+SortProtocolCallStats (
+  IN VECTOR *CallStats
+  )
+{
+  Vector_Clear (&gSortedProtocolCallStats);
+  for (UINTN Index = 0; Index < Vector_Size (CallStats); ++Index) {
+    PROTOCOL_CALL_STATS *Stats = Vector_Get (CallStats, Index);
+    if (Stats->Count != 0 && EFI_ERROR (Vector_PushBack (&gSortedProtocolCallStats, Stats))) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  Vector_Sort (&gSortedProtocolCallStats, &CompareProtocolCallStatsByTotal);
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в лог PROTOCOL_CALL_STATS_TOP протоколов из CallStats, на сервисы для которых ушло больше всего времени.
+ * Протоколы из статистики не пропадают, так что строк со временем становится только больше.
+ *
+ * @param CallStats                 gProtocolCallStats или gMultiProtocolCallStats.
+ * @param Title                     Заголовок таблицы, %u - число строк в ней.
+*/
+STATIC
+VOID
+WriteProtocolCallStats (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol,
+  IN     VECTOR            *CallStats,
+  IN     CHAR16            *Title
+  )
+{
+  if (Timestamp_GetFrequency () == 0 || EFI_ERROR (SortProtocolCallStats (CallStats))) {
+    return;
+  }
+
+  PrintToFile (FileProtocol, Title, (unsigned)PROTOCOL_CALL_STATS_TOP);
+
+  UINTN Printed = 0;
+  FOR_EACH_VCT (PROTOCOL_CALL_STATS, Top, gSortedProtocolCallStats) {
+    if (Printed++ == PROTOCOL_CALL_STATS_TOP) {
+      break;
+    }
+
+    // Имя обрезается по ширине колонки, чтобы строка не меняла длину.
+    CHAR16      Name[61];
+    CONST CHAR8 *GuidName = GetInternedProtocolName (Top->GuidId);
+    if (GuidName != NULL) {
+      UnicodeSPrint (Name, sizeof (Name), L"%a", GuidName);
+    } else {
+      EFI_GUID Guid;
+      GetInternedProtocolGuid (Top->GuidId, &Guid);
+      UnicodeSPrint (Name, sizeof (Name), L"%g", &Guid);
+    }
+
+    PrintToFile (FileProtocol, L"-   %-60s %10u calls, %10u us total, %10u us max\r\n",
+      Name,
+      (unsigned)Top->Count,
+      (unsigned)Timestamp_ToMicroseconds (Top->Total),
+      (unsigned)Timestamp_ToMicroseconds (Top->Max)
+      );
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в лог время, которое драйвер потратил сам на себя, по стадиям.
+ * Записываемые сейчас строки в статистику попадут только при следующем обновлении блока.
+*/
+STATIC
+VOID
+WriteOverheadStats (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  )
+{
+  STATIC CONST CHAR16 *StageNames[OVERHEAD_STAGE_COUNT] = {
+    L"capture",
+    L"symbolize",
+    L"format",
+    L"write",
+    L"flush"
+  };
+
+  if (Timestamp_GetFrequency () == 0) {
+    return;
+  }
+
+  // Снимок берём до печати: она сама меняет счётчики форматирования и записи.
+  OVERHEAD_STAGE_STATS Stats[OVERHEAD_STAGE_COUNT];
+  for (UINTN Stage = 0; Stage < OVERHEAD_STAGE_COUNT; ++Stage) {
+    Timestamp_GetOverheadStats ((OVERHEAD_STAGE)Stage, &Stats[Stage]);
+  }
+
+  PrintToFile (FileProtocol, L"- Overhead: time spent by the logger itself\r\n");
+  for (UINTN Stage = 0; Stage < OVERHEAD_STAGE_COUNT; ++Stage) {
+    PrintToFile (FileProtocol, L"-   %-10s %10u calls, %10u us\r\n",
+      StageNames[Stage],
+      (unsigned)Stats[Stage].Calls,
+      (unsigned)Timestamp_ToMicroseconds (Stats[Stage].Ticks)
+      );
+  }
+  PrintToFile (FileProtocol, L"-   %-10s %10u calls, %10u us (symbolize on the writer side, format, write, flush)\r\n",
+    L"writer",
+    (unsigned)gWriterPasses,
+    (unsigned)Timestamp_ToMicroseconds (gWriterTicks)
+    );
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в конец лога блок статистики и возвращает позицию записи на его начало,
+ * так что следующие события затрут его, а за ними будет записан обновлённый блок.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+VOID
+WriteLogFooter (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  )
+{
+  DBG_ENTER ();
+
+  EFI_STATUS Status;
+  UINT64     FooterPosition;
+
+  // Позиция блока - это позиция в файле плюс ещё не записанный хвост буфера вывода.
+  Status = (*FileProtocol)->GetPosition (*FileProtocol, &FooterPosition);
+  if (EFI_ERROR (Status)) {
+    FlushOutputBuffer (FileProtocol);
+    DBG_EXIT_STATUS (Status);
+    return;
+  }
+  FooterPosition += gOutputBufferUsed;
+
+  if (FeaturePcdGet (PcdBinaryLogFormat)) {
+    WriteBinaryLogStatistics (FileProtocol);
+  } else {
+    WriteTextLogStatistics (FileProtocol);
+  }
+
+  // События порции и блок статистики уходят в файл одним Write(), если поместились в буфер.
+  FlushOutputBuffer (FileProtocol);
+
+  if (*FileProtocol != NULL) {
+    (*FileProtocol)->GetPosition (*FileProtocol, &gLogFooterEnd);
+    if (FeaturePcdGet (PcdPreallocateLogFile)) {
+      gLogFileEnd = gLogFooterEnd;
+    }
+    (*FileProtocol)->SetPosition (*FileProtocol, FooterPosition);
+  }
+
+  DBG_EXIT ();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает порцию событий без блока статистики, обрезая файл по её концу, если нужно.
+*/
+VOID
+DropLogFooter (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  )
+{
+  DBG_ENTER ();
+
+  EFI_STATUS    Status;
+  UINT64        Position;
+  EFI_FILE_INFO *FileInfo;
+
+  FlushOutputBuffer (FileProtocol);
+
+  // Обрезаем один раз на каждый записанный блок, а не на каждую порцию.
+  // Заранее растянутый файл не обрезаем: за концом лога в нём и так остаются старые данные.
+  if (*FileProtocol == NULL || gLogFooterEnd == 0 || FeaturePcdGet (PcdPreallocateLogFile)) {
+    gLogFooterEnd = 0;
+    DBG_EXIT ();
+    return;
+  }
+
+  Status = (*FileProtocol)->GetPosition (*FileProtocol, &Position);
+  if (!EFI_ERROR (Status) && Position < gLogFooterEnd) {
+    Status = GetFileInfo (*FileProtocol, &gEfiFileInfoGuid, (VOID **)&FileInfo);
+    if (!EFI_ERROR (Status)) {
+      FileInfo->FileSize = Position;
+      Status = (*FileProtocol)->SetInfo (*FileProtocol, &gEfiFileInfoGuid, (UINTN)FileInfo->Size, FileInfo);
+      gBS->FreePool (FileInfo);
+    }
+    if (EFI_ERROR (Status)) {
+      DBG_ERROR ("log.txt footer removal failed: %r\n", Status);
+    }
+  }
+
+  gLogFooterEnd = 0;
+  DBG_EXIT ();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в лог текстовый блок статистики.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+VOID
+WriteTextLogStatistics (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  )
+{
+  LOADING_EVENT_STRING_POOL_STATS       StringPoolStats;
+  LOADING_EVENT_HANDLE_NAME_CACHE_STATS HandleNameCacheStats;
+
+  LoadingEvent_GetStringPoolStats (&StringPoolStats);
+  LoadingEvent_GetHandleNameCacheStats (&HandleNameCacheStats);
+
+  // Хранилище событий растёт блоками, первый блок выделяется сразу.
+  UINTN EventBlocks = MAX (1, (gLogger.LogData.CountUsed + gLogger.LogData.CountPerBlock - 1) / gLogger.LogData.CountPerBlock);
+
+  // Все числа фиксированной ширины: блок не должен становиться короче,
+  // иначе за обновлённым блоком останется хвост предыдущего.
+  STATIC CHAR16 Line[] = L"- --------------------------------------------------------------------------------\r\n";
+  PrintToFile (FileProtocol, L"\r\n");
+  PrintToFile (FileProtocol, Line);
+  PrintToFile (FileProtocol, L"- STATISTICS\r\n");
+  PrintToFile (FileProtocol, L"- Names:  %10u unique, %10u references, %10u bytes stored, %10u bytes saved\r\n",
+    (unsigned)StringPoolStats.UniqueCount,
+    (unsigned)StringPoolStats.ReferenceCount,
+    (unsigned)StringPoolStats.BytesStored,
+    (unsigned)StringPoolStats.BytesSaved
+    );
+  PrintToFile (FileProtocol, L"- Cache:  %10u hits, %10u misses, %10u invalidations (handle names)\r\n",
+    (unsigned)HandleNameCacheStats.Hits,
+    (unsigned)HandleNameCacheStats.Misses,
+    (unsigned)HandleNameCacheStats.Invalidations
+    );
+  PrintToFile (FileProtocol, L"- Memory: %10u allocations from arena, %10u bytes, %10u chunks, %10u pages\r\n",
+    (unsigned)gLogger.Arena.AllocationCount,
+    (unsigned)gLogger.Arena.BytesAllocated,
+    (unsigned)gLogger.Arena.ChunkCount,
+    (unsigned)gLogger.Arena.PagesAllocated
+    );
+  PrintToFile (FileProtocol, L"- Events: %10u stored, %10u bytes in %10u blocks\r\n",
+    (unsigned)gLogger.LogData.CountUsed,
+    (unsigned)(EventBlocks * (sizeof (SEGMENTED_VECTOR_BLOCK) + gLogger.LogData.CountPerBlock * gLogger.LogData.ObjectSize)),
+    (unsigned)EventBlocks
+    );
+  PrintToFile (FileProtocol, L"- Disks:  %10u probed for log.txt, %10u probes saved by waiting for new volumes\r\n",
+    (unsigned)gVolumeProbes,
+    (unsigned)gVolumeProbesSaved
+    );
+  if (gDeferredExportEvents != 0) {
+    // Потоковый режим сделал бы Flush() на каждое событие, отложенная запись - один.
+    // Цена Flush() замерена на одном событии, поэтому выигрыш лишь приблизительный.
+    PrintToFile (FileProtocol, L"- Deferred: %10u events written at once, %10u us per one-event flush, ~%10u us saved (estimate: a flush per event)\r\n",
+      (unsigned)gDeferredExportEvents,
+      (unsigned)Timestamp_ToMicroseconds (gDeferredExportFlushTicks),
+      (unsigned)Timestamp_ToMicroseconds (gDeferredExportFlushTicks * (gDeferredExportEvents - 1))
+      );
+  }
+  WriteProtocolCallStats (FileProtocol, &gProtocolCallStats,
+    L"- Calls:  top %u protocols by time spent in single-protocol gBS services, notifications included\r\n"
+    );
+  WriteProtocolCallStats (FileProtocol, &gMultiProtocolCallStats,
+    L"- Multi:  top %u Install/UninstallMultipleProtocolInterfaces() calls by time, keyed by the first protocol listed\r\n"
+    );
+  WriteOverheadStats (FileProtocol);
+  PrintToFile (FileProtocol, Line);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в буфер вывода Size байт из Data, Size не больше размера буфера.
+ * Если места не хватает, сбрасывает буфер в файл; если не удалось, то устанавливает FileProtocol в NULL.
+*/
+VOID
+AppendToOutputBuffer (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol,
+  IN     CONST VOID        *Data,
+  IN     UINTN             Size
+  )
+{
+  if (*FileProtocol == NULL) {
+    return;
+  }
+
+  if (gOutputBufferSize - gOutputBufferUsed < Size) {
+    MakeRoomInOutputBuffer (FileProtocol, Size);
+    if (*FileProtocol == NULL) {
+      return;
+    }
+  }
+
+  gBS->CopyMem (gOutputBuffer + gOutputBufferUsed, (VOID *)Data, Size);
+  gOutputBufferUsed += Size;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает, сколько символов строки Str попадёт в двоичный лог, либо BINARY_LOG_NULL_STRING для NULL.
+*/
+UINT16
+GetBinaryLogStringLength (
+  IN CONST CHAR16 *Str  OPTIONAL
+  )
+{
+  if (Str == NULL) {
+    return BINARY_LOG_NULL_STRING;
+  }
+
+  // Строка обрезается там же, где и строка текстового лога, и даже запись с двумя
+  // строками предельной длины умещается в UINT16 Length заголовка записи.
+  STATIC_ASSERT (BINARY_LOG_MAX_STRING_LENGTH == PRINT_TO_FILE_BUFFER_LENGTH, "binary log string limit differs from text log");
+  STATIC_ASSERT (
+    sizeof (BINARY_LOG_RECORD_HEADER) + sizeof (BINARY_LOG_PROTOCOL_RECORD)
+      + 2 * (sizeof (UINT16) + BINARY_LOG_MAX_STRING_LENGTH * sizeof (CHAR16)) <= MAX_UINT16,
+    "binary log record does not fit UINT16 Length"
+    );
+
+  return (UINT16)StrnLenS (Str, BINARY_LOG_MAX_STRING_LENGTH);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в двоичный лог заголовок файла.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+VOID
+WriteBinaryLogHeader (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  )
+{
+  BINARY_LOG_FILE_HEADER Header;
+
+  gBS->SetMem (&Header, sizeof (Header), 0);
+  Header.Signature          = BINARY_LOG_SIGNATURE;
+  Header.Version            = BINARY_LOG_VERSION;
+  Header.HeaderSize         = sizeof (Header);
+  Header.TimestampFrequency = Timestamp_GetFrequency ();
+
+  AppendToOutputBuffer (FileProtocol, &Header, sizeof (Header));
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает событие Event в двоичный лог: вместо форматирования строк GUID, хэндл и метка времени
+ * пишутся как есть, а текст из них получает Tools/LogDecoder уже на машине разработчика.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+VOID
+AddNewEventToBinaryLog (
+  IN     LOADING_EVENT      *Event,
+  IN OUT EFI_FILE_PROTOCOL  **FileProtocol
+  )
+{
+  UINT64                     Start = Timestamp_Read ();
+  BINARY_LOG_RECORD_HEADER   Header;
+  BINARY_LOG_PROTOCOL_RECORD Protocol;
+  UINTN                      PayloadSize = 0;
+  CONST CHAR16               *Strings[2];
+  UINTN                      StringCount = 0;
+
+  Header.Type      = (UINT8)Event->Type;
+  Header.Flags     = 0;
+  Header.Timestamp = Event->Timestamp;
+
+  switch (Event->Type) {
+  case LOG_ENTRY_TYPE_PROTOCOL_INSTALLED:
+  case LOG_ENTRY_TYPE_PROTOCOL_REINSTALLED:
+  case LOG_ENTRY_TYPE_PROTOCOL_REMOVED:
+    {
+      // У всех трёх событий одна и та же структура.
+      LOG_ENTRY_PROTOCOL_INSTALLED *Call = &Event->ProtocolInstalled;
+
+      GetInternedProtocolGuid (Call->GuidId, &Protocol.Guid);
+      Protocol.Handle   = (UINT64)(UINTN)Call->Handle;
+      Protocol.Duration = Call->Duration;
+      PayloadSize       = sizeof (Protocol);
+
+      Header.Flags            = (Call->Successful   ? BINARY_LOG_FLAG_SUCCESSFUL    : 0)
+                              | (Call->MultipleCall ? BINARY_LOG_FLAG_MULTIPLE_CALL : 0);
+      Strings[StringCount++]  = Call->HandleDescription;
+    }
+    break;
+
+  case LOG_ENTRY_TYPE_PROTOCOL_EXISTS_ON_STARTUP:
+    GetInternedProtocolGuid (Event->ProtocolExistsOnStartup.GuidId, &Protocol.Guid);
+    Protocol.Handle   = 0;
+    Protocol.Duration = 0;
+    PayloadSize       = sizeof (Protocol);
+
+    Strings[StringCount++] = Event->ProtocolExistsOnStartup.HandleDescription;
+    break;
+
+  case LOG_ENTRY_TYPE_IMAGE_LOADED:
+  case LOG_ENTRY_TYPE_IMAGE_EXISTS_ON_STARTUP:
+    // У обоих событий одна и та же структура.
+    Strings[StringCount++] = Event->ImageLoaded.ImageName;
+    Strings[StringCount++] = Event->ImageLoaded.ParentImageName;
+    break;
+
+  case LOG_ENTRY_TYPE_BDS_STAGE_ENTERED:
+    Header.Flags = (UINT8)Event->BdsStageEntered.SubEvent;
+    break;
+
+  case LOG_ENTRY_TYPE_ERROR:
+    Strings[StringCount++] = Event->Error.Message;
+    break;
+
+  default:
+    // Неизвестный тип пишется как есть, LogDecoder сообщит о нём так же, как текстовый лог.
+    break;
+  }
+
+  UINT16 StringLengths[2];
+  UINTN  Length = sizeof (Header) + PayloadSize;
+  for (UINTN Index = 0; Index < StringCount; ++Index) {
+    StringLengths[Index] = GetBinaryLogStringLength (Strings[Index]);
+    Length += sizeof (UINT16);
+    if (StringLengths[Index] != BINARY_LOG_NULL_STRING) {
+      Length += StringLengths[Index] * sizeof (CHAR16);
+    }
+  }
+  Header.Length = (UINT16)Length;
+
+  Timestamp_AccountOverhead (OVERHEAD_STAGE_FORMAT, Start);
+
+  AppendToOutputBuffer (FileProtocol, &Header, sizeof (Header));
+  if (PayloadSize != 0) {
+    AppendToOutputBuffer (FileProtocol, &Protocol, PayloadSize);
+  }
+  for (UINTN Index = 0; Index < StringCount; ++Index) {
+    AppendToOutputBuffer (FileProtocol, &StringLengths[Index], sizeof (UINT16));
+    if (StringLengths[Index] != BINARY_LOG_NULL_STRING) {
+      AppendToOutputBuffer (FileProtocol, Strings[Index], StringLengths[Index] * sizeof (CHAR16));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Заполняет таблицу двоичного лога самыми долгими протоколами из CallStats.
+ * Неиспользованные строки Rows остаются как были, т.е. нулевыми.
+*/
+VOID
+FillBinaryLogCallStats (
+  IN  VECTOR                *CallStats,
+  OUT BINARY_LOG_CALL_STATS *Rows
+  )
+{
+  if (EFI_ERROR (SortProtocolCallStats (CallStats))) {
+    return;
+  }
+
+  UINTN Row = 0;
+  FOR_EACH_VCT (PROTOCOL_CALL_STATS, Top, gSortedProtocolCallStats) {
+    if (Row == BINARY_LOG_CALL_STATS_COUNT) {
+      break;
+    }
+
+    GetInternedProtocolGuid (Top->GuidId, &Rows[Row].Guid);
+    Rows[Row].Count = Top->Count;
+    Rows[Row].Total = Top->Total;
+    Rows[Row].Max   = Top->Max;
+    Row++;
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Дописывает в двоичный лог запись со статистикой, её размер постоянный.
+ * Если не удалось, то устанавливает FileProtocol в NULL.
+*/
+VOID
+WriteBinaryLogStatistics (
+  IN OUT EFI_FILE_PROTOCOL **FileProtocol
+  )
+{
+  BINARY_LOG_RECORD_HEADER              Header;
+  BINARY_LOG_STATISTICS                 Statistics;
+  LOADING_EVENT_STRING_POOL_STATS       StringPoolStats;
+  LOADING_EVENT_HANDLE_NAME_CACHE_STATS HandleNameCacheStats;
+  OVERHEAD_STAGE_STATS                  OverheadStats;
+
+  STATIC_ASSERT (OVERHEAD_STAGE_COUNT + 1 == BINARY_LOG_OVERHEAD_STATS_COUNT, "binary log overhead stats mismatch");
+
+  LoadingEvent_GetStringPoolStats (&StringPoolStats);
+  LoadingEvent_GetHandleNameCacheStats (&HandleNameCacheStats);
+
+  // Хранилище событий растёт блоками, первый блок выделяется сразу.
+  UINTN EventBlocks = MAX (1, (gLogger.LogData.CountUsed + gLogger.LogData.CountPerBlock - 1) / gLogger.LogData.CountPerBlock);
+
+  gBS->SetMem (&Statistics, sizeof (Statistics), 0);
+  Statistics.NamesUnique        = StringPoolStats.UniqueCount;
+  Statistics.NamesReferences    = StringPoolStats.ReferenceCount;
+  Statistics.NamesBytesStored   = StringPoolStats.BytesStored;
+  Statistics.NamesBytesSaved    = StringPoolStats.BytesSaved;
+  Statistics.CacheHits          = HandleNameCacheStats.Hits;
+  Statistics.CacheMisses        = HandleNameCacheStats.Misses;
+  Statistics.CacheInvalidations = HandleNameCacheStats.Invalidations;
+  Statistics.ArenaAllocations   = gLogger.Arena.AllocationCount;
+  Statistics.ArenaBytes         = gLogger.Arena.BytesAllocated;
+  Statistics.ArenaChunks        = gLogger.Arena.ChunkCount;
+  Statistics.ArenaPages         = gLogger.Arena.PagesAllocated;
+  Statistics.EventsStored       = gLogger.LogData.CountUsed;
+  Statistics.EventsBytes        = EventBlocks * (sizeof (SEGMENTED_VECTOR_BLOCK) + gLogger.LogData.CountPerBlock * gLogger.LogData.ObjectSize);
+  Statistics.EventsBlocks       = EventBlocks;
+  Statistics.VolumeProbes       = gVolumeProbes;
+  Statistics.VolumeProbesSaved  = gVolumeProbesSaved;
+  Statistics.DeferredEvents     = gDeferredExportEvents;
+  Statistics.DeferredFlushTicks = gDeferredExportFlushTicks;
+
+  FillBinaryLogCallStats (&gProtocolCallStats,      Statistics.Calls);
+  FillBinaryLogCallStats (&gMultiProtocolCallStats, Statistics.MultiCalls);
+
+  for (UINTN Stage = 0; Stage < OVERHEAD_STAGE_COUNT; ++Stage) {
+    Timestamp_GetOverheadStats ((OVERHEAD_STAGE)Stage, &OverheadStats);
+    Statistics.Overhead[Stage].Calls = OverheadStats.Calls;
+    Statistics.Overhead[Stage].Ticks = OverheadStats.Ticks;
+  }
+  Statistics.Overhead[OVERHEAD_STAGE_COUNT].Calls = gWriterPasses;
+  Statistics.Overhead[OVERHEAD_STAGE_COUNT].Ticks = gWriterTicks;
+
+  Header.Length    = sizeof (Header) + sizeof (Statistics);
+  Header.Type      = BINARY_LOG_RECORD_STATISTICS;
+  Header.Flags     = 0;
+  Header.Timestamp = Timestamp_Read ();
+
+  AppendToOutputBuffer (FileProtocol, &Header, sizeof (Header));
+  AppendToOutputBuffer (FileProtocol, &Statistics, sizeof (Statistics));
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,159 @@
+/** @file
+ * Сравнивает поиск имени протокола через совершенную хэш-таблицу встроенной БД
+ * (FindProtocolIndex) с прежним перебором всех записей через CompareGuid.
+ *
+ * Использование: GuidLookupBench
+ *
+ * Библиотека включается исходником целиком, чтобы замерять её STATIC-функции
+ * на той же встроенной БД, что попадает в драйвер.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../Library/ProtocolGuidDatabaseLib/ProtocolGuidDatabaseLib.c"
+#include "HostShim.h"
+
+// -----------------------------------------------------------------------------
+/**
+ * Запись БД в прежнем виде: указатель на GUID и указатель на имя.
+*/
+typedef struct {
+  CONST EFI_GUID *Guid;
+  CONST CHAR8    *Name;
+} LEGACY_PROTOCOL_ENTRY;
+
+STATIC LEGACY_PROTOCOL_ENTRY mLegacyDatabase[GUID_DB_COUNT];
+
+// -----------------------------------------------------------------------------
+/**
+ * Поиск имени перебором, как в GetProtocolName() до совершенной хэш-таблицы.
+*/
+STATIC
+CONST CHAR8 *
+LegacyGetProtocolName (
+  IN CONST EFI_GUID *Guid
+  )
+{
+  for (UINTN Index = 0; Index < KNOWN_GUID_COUNT; ++Index) {
+    if (CompareGuid (Guid, mLegacyDatabase[Index].Guid)) {
+      return mLegacyDatabase[Index].Name;
+    }
+  }
+  return NULL;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Поиск имени через совершенную хэш-таблицу встроенной БД.
+*/
+STATIC
+CONST CHAR8 *
+HashGetProtocolName (
+  IN CONST EFI_GUID *Guid
+  )
+{
+  UINTN Index = FindProtocolIndex (&gBuiltInDatabase, Guid);
+  if (Index == GUID_DB_HASH_EMPTY_SLOT) {
+    return NULL;
+  }
+  return &gBuiltInDatabase.NamePool[gBuiltInDatabase.NameOffsets[Index]];
+}
+
+// -----------------------------------------------------------------------------
+STATIC UINT64 mRandomState = 0x9E3779B97F4A7C15ull;
+
+STATIC
+UINT64
+Random64 (
+  )
+{
+  mRandomState ^= mRandomState >> 12;
+  mRandomState ^= mRandomState << 25;
+  mRandomState ^= mRandomState >> 27;
+  return mRandomState * 0x2545F4914F6CDD1Dull;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Возвращает среднее время одного поиска в наносекундах.
+*/
+STATIC
+double
+MeasureNs (
+  IN CONST CHAR8 *(*Lookup)(CONST EFI_GUID *),
+  IN CONST EFI_GUID *Probes,
+  IN UINTN          ProbeCount,
+  IN UINTN          Lookups
+  )
+{
+  volatile UINTN Sink = 0;
+
+  UINT64 Start = HostShim_NowNs ();
+  for (UINTN Index = 0; Index < Lookups; ++Index) {
+    Sink += (UINTN)Lookup (&Probes[Index % ProbeCount]);
+  }
+  return (double)(HostShim_NowNs () - Start) / (double)Lookups;
+}
+
+// -----------------------------------------------------------------------------
+int
+main (
+  )
+{
+  STATIC EFI_GUID Known[GUID_DB_COUNT];
+  STATIC EFI_GUID Unknown[GUID_DB_COUNT];
+
+  for (UINTN Index = 0; Index < GUID_DB_COUNT; ++Index) {
+    mLegacyDatabase[Index].Guid = &gProtocolDatabaseGuids[Index];
+    mLegacyDatabase[Index].Name = &gProtocolDatabaseNamePool[gProtocolDatabaseNameOffsets[Index]];
+  }
+
+  // Известные GUID'ы в случайном порядке, чтобы перебор в среднем проходил половину БД.
+  for (UINTN Index = 0; Index < GUID_DB_COUNT; ++Index) {
+    Known[Index] = gProtocolDatabaseGuids[Index];
+  }
+  for (UINTN Index = GUID_DB_COUNT - 1; Index > 0; --Index) {
+    UINTN    Other = (UINTN)(Random64 () % (Index + 1));
+    EFI_GUID Swap  = Known[Index];
+    Known[Index]   = Known[Other];
+    Known[Other]   = Swap;
+  }
+  for (UINTN Index = 0; Index < GUID_DB_COUNT; ++Index) {
+    UINT64 Halves[2] = { Random64 (), Random64 () };
+    memcpy (&Unknown[Index], Halves, sizeof (EFI_GUID));
+  }
+
+  // Обе реализации должны давать одинаковые ответы.
+  UINTN Mismatches = 0;
+  for (UINTN Index = 0; Index < GUID_DB_COUNT; ++Index) {
+    CONST CHAR8 *Legacy = LegacyGetProtocolName (&Known[Index]);
+    CONST CHAR8 *Hash   = HashGetProtocolName (&Known[Index]);
+    if (Legacy == NULL || Hash == NULL || strcmp (Legacy, Hash) != 0) {
+      Mismatches++;
+    }
+    if (LegacyGetProtocolName (&Unknown[Index]) != NULL || HashGetProtocolName (&Unknown[Index]) != NULL) {
+      Mismatches++;
+    }
+  }
+  if (Mismatches != 0) {
+    printf ("%u lookups disagree between the linear scan and the perfect hash\n", (unsigned)Mismatches);
+    return 1;
+  }
+
+  CONST UINTN LinearLookups = 100000;
+  CONST UINTN HashLookups   = 10000000;
+
+  double KnownLinear   = MeasureNs (LegacyGetProtocolName, Known,   GUID_DB_COUNT, LinearLookups);
+  double KnownHash     = MeasureNs (HashGetProtocolName,   Known,   GUID_DB_COUNT, HashLookups);
+  double UnknownLinear = MeasureNs (LegacyGetProtocolName, Unknown, GUID_DB_COUNT, LinearLookups);
+  double UnknownHash   = MeasureNs (HashGetProtocolName,   Unknown, GUID_DB_COUNT, HashLookups);
+
+  printf ("Built-in database: %u GUIDs, %u buckets, %u slots\n",
+    (unsigned)GUID_DB_COUNT, (unsigned)GUID_DB_HASH_BUCKET_COUNT, (unsigned)GUID_DB_HASH_SLOT_COUNT);
+  printf ("%10s %14s %14s %10s\n", "GUIDs", "linear ns/op", "hash ns/op", "speedup");
+  printf ("%10s %14.1f %14.1f %9.0fx\n", "known",   KnownLinear,   KnownHash,   KnownLinear   / KnownHash);
+  printf ("%10s %14.1f %14.1f %9.0fx\n", "unknown", UnknownLinear, UnknownHash, UnknownLinear / UnknownHash);
+
+  return 0;
+}
@@ -0,0 +1,512 @@
+/** @file
+ * Тесты HashMapLib на хосте и сравнение скорости поиска с линейным перебором,
+ * которым раньше искались неизвестные GUID'ы в ProtocolGuidDatabaseLib.
+ *
+ * Использование: HashMapTest [-b]
+ *   без ключей - только тесты, код возврата 0 при успехе;
+ *   -b         - после тестов замерить скорость поиска.
+ *
+ * Библиотека включается исходником целиком, чтобы тесты видели HomeIndex()
+ * и могли подбирать ключи с нужной домашней ячейкой.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../Library/HashMapLib/HashMapLib.c"
+#include "HostShim.h"
+
+STATIC UINTN mChecks;
+STATIC UINTN mFailures;
+
+#define CHECK(Expression)                                                   \
+  do {                                                                      \
+    mChecks++;                                                              \
+    if (!(Expression)) {                                                    \
+      mFailures++;                                                          \
+      printf ("%s:%d: CHECK (%s) failed\n", __FILE__, __LINE__, #Expression); \
+    }                                                                       \
+  } while (0)
+
+// -----------------------------------------------------------------------------
+/**
+ * xorshift64*, детерминированный, чтобы прогоны были воспроизводимы.
+*/
+STATIC UINT64 mRandomState = 0x2545F4914F6CDD1Dull;
+
+STATIC
+UINT64
+Random64 (
+  )
+{
+  mRandomState ^= mRandomState >> 12;
+  mRandomState ^= mRandomState << 25;
+  mRandomState ^= mRandomState >> 27;
+  return mRandomState * 0x2545F4914F6CDD1Dull;
+}
+
+STATIC
+VOID
+RandomGuid (
+  OUT EFI_GUID *Guid
+  )
+{
+  UINT64 Halves[2] = { Random64 (), Random64 () };
+  memcpy (Guid, Halves, sizeof (*Guid));
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Подбирает ключ-указатель, у которого в таблице This домашняя ячейка Home.
+ * Ключи перебираются по возрастанию начиная с *Next, чтобы не повторяться.
+*/
+STATIC
+UINTN
+KeyWithHome (
+  IN     HASH_MAP *This,
+  IN     UINTN    Home,
+  IN OUT UINTN    *Next
+  )
+{
+  for (;;) {
+    UINTN Key = (*Next)++;
+    if (HomeIndex (This, &Key) == Home) {
+      return Key;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Проверяет инвариант линейного пробирования: между домашней ячейкой каждого элемента
+ * и ячейкой, где он лежит, нет свободных ячеек. После неправильного сдвига при удалении
+ * он нарушается, и поиск начинает терять элементы.
+*/
+STATIC
+BOOLEAN
+ProbeChainsIntact (
+  IN HASH_MAP *This
+  )
+{
+  UINTN Mask  = This->Capacity - 1;
+  UINTN Count = 0;
+
+  for (UINTN Slot = 0; Slot < This->Capacity; ++Slot) {
+    if (!This->Used[Slot]) {
+      continue;
+    }
+    Count++;
+    for (UINTN Index = HomeIndex (This, ENTRY (This, Slot)); Index != Slot; Index = (Index + 1) & Mask) {
+      if (!This->Used[Index]) {
+        return FALSE;
+      }
+    }
+  }
+
+  return Count == This->CountUsed;
+}
+
+// -----------------------------------------------------------------------------
+STATIC
+VOID
+TestInsertFind (
+  )
+{
+  HASH_MAP Map;
+  UINTN    Keys[1000];
+
+  CHECK (HashMap_Construct (&Map, HashMapKeyPointer, sizeof (UINT32), 0) == EFI_SUCCESS);
+
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Keys); ++Index) {
+    Keys[Index]  = (UINTN)Random64 () | 1;    // Чётные значения оставлены под отсутствующие ключи.
+    UINT32 Value = (UINT32)Index;
+    CHECK (HashMap_Insert (&Map, &Keys[Index], &Value) == EFI_SUCCESS);
+  }
+  CHECK (HashMap_Size (&Map) == ARRAY_SIZE (Keys));
+  CHECK (ProbeChainsIntact (&Map));
+
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Keys); ++Index) {
+    UINT32 *Value = HashMap_Find (&Map, &Keys[Index]);
+    CHECK (Value != NULL && *Value == Index);
+
+    UINTN Missing = Keys[Index] & ~(UINTN)1;
+    CHECK (HashMap_Find (&Map, &Missing) == NULL);
+  }
+
+  // Повторная вставка не меняет значение.
+  UINT32 Other = 12345;
+  CHECK (HashMap_Insert (&Map, &Keys[7], &Other) == EFI_ALREADY_STARTED);
+  CHECK (*(UINT32 *)HashMap_Find (&Map, &Keys[7]) == 7);
+  CHECK (HashMap_Size (&Map) == ARRAY_SIZE (Keys));
+
+  // Перебор выдаёт каждый элемент ровно один раз.
+  UINTN Position = 0;
+  UINTN Visited  = 0;
+  UINTN KeySum   = 0;
+  UINTN ExpectedKeySum = 0;
+  VOID  *Key;
+  VOID  *Value;
+  while (HashMap_GetNext (&Map, &Position, &Key, &Value)) {
+    Visited++;
+    KeySum += *(UINTN *)Key;
+    CHECK (Value == HashMap_Find (&Map, Key));
+  }
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Keys); ++Index) {
+    ExpectedKeySum += Keys[Index];
+  }
+  CHECK (Visited == ARRAY_SIZE (Keys));
+  CHECK (KeySum == ExpectedKeySum);
+
+  HashMap_Destruct (&Map);
+
+  // GUID-ключи и режим множества.
+  EFI_GUID Guids[300];
+  CHECK (HashMap_Construct (&Map, HashMapKeyGuid, 0, 16) == EFI_SUCCESS);
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Guids); ++Index) {
+    RandomGuid (&Guids[Index]);
+    CHECK (HashMap_Insert (&Map, &Guids[Index], NULL) == EFI_SUCCESS);
+  }
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Guids); ++Index) {
+    EFI_GUID *Stored = HashMap_Find (&Map, &Guids[Index]);
+    CHECK (Stored != NULL && CompareGuid (Stored, &Guids[Index]));
+
+    EFI_GUID Missing = Guids[Index];
+    Missing.Data4[7] ^= 0x80;
+    CHECK (HashMap_Find (&Map, &Missing) == NULL);
+  }
+  CHECK (ProbeChainsIntact (&Map));
+  HashMap_Destruct (&Map);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Удаление из цепочки, которая переходит через конец таблицы в начало.
+*/
+STATIC
+VOID
+TestRemoveAcrossWraparound (
+  )
+{
+  HASH_MAP Map;
+  UINTN    Next = 1;
+
+  // 8 ячеек, в таблицу помещается 6 элементов.
+  CHECK (HashMap_Construct (&Map, HashMapKeyPointer, sizeof (UINTN), 6) == EFI_SUCCESS);
+  CHECK (Map.Capacity == MIN_CAPACITY);
+  UINTN Last = Map.Capacity - 1;
+
+  // A, B, C с домом в последней ячейке займут ячейки 7, 0, 1; D с домом в 0 уедет в 2,
+  // E с домом в 1 - в 3. Удаление A должно сдвинуть назад всех четверых, через границу.
+  UINTN A = KeyWithHome (&Map, Last, &Next);
+  UINTN B = KeyWithHome (&Map, Last, &Next);
+  UINTN C = KeyWithHome (&Map, Last, &Next);
+  UINTN D = KeyWithHome (&Map, 0, &Next);
+  UINTN E = KeyWithHome (&Map, 1, &Next);
+  UINTN Chain[] = { A, B, C, D, E };
+
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Chain); ++Index) {
+    CHECK (HashMap_Insert (&Map, &Chain[Index], &Chain[Index]) == EFI_SUCCESS);
+  }
+  CHECK (*(UINTN *)ENTRY (&Map, Last) == A);
+  CHECK (*(UINTN *)ENTRY (&Map, 0) == B);
+  CHECK (*(UINTN *)ENTRY (&Map, 1) == C);
+  CHECK (*(UINTN *)ENTRY (&Map, 2) == D);
+  CHECK (*(UINTN *)ENTRY (&Map, 3) == E);
+
+  CHECK (HashMap_Remove (&Map, &A) == EFI_SUCCESS);
+  CHECK (HashMap_Remove (&Map, &A) == EFI_NOT_FOUND);
+  CHECK (ProbeChainsIntact (&Map));
+  CHECK (*(UINTN *)ENTRY (&Map, Last) == B);
+  CHECK (*(UINTN *)ENTRY (&Map, 0) == C);
+  CHECK (*(UINTN *)ENTRY (&Map, 1) == D);
+  CHECK (*(UINTN *)ENTRY (&Map, 2) == E);
+  CHECK (!Map.Used[3]);
+
+  for (UINTN Index = 1; Index < ARRAY_SIZE (Chain); ++Index) {
+    UINTN *Value = HashMap_Find (&Map, &Chain[Index]);
+    CHECK (Value != NULL && *Value == Chain[Index]);
+  }
+
+  // После удаления C из ячейки 0 D и E возвращаются в свои домашние ячейки 0 и 1.
+  CHECK (HashMap_Remove (&Map, &C) == EFI_SUCCESS);
+  CHECK (ProbeChainsIntact (&Map));
+  CHECK (*(UINTN *)ENTRY (&Map, 0) == D);
+  CHECK (*(UINTN *)ENTRY (&Map, 1) == E);
+
+  // Элементы в своих домашних ячейках через дырку не переносятся.
+  CHECK (HashMap_Remove (&Map, &B) == EFI_SUCCESS);
+  CHECK (ProbeChainsIntact (&Map));
+  CHECK (!Map.Used[Last]);
+  CHECK (*(UINTN *)ENTRY (&Map, 0) == D);
+  CHECK (*(UINTN *)ENTRY (&Map, 1) == E);
+  CHECK (HashMap_Find (&Map, &D) != NULL && HashMap_Find (&Map, &E) != NULL);
+
+  HashMap_Destruct (&Map);
+
+  // Все порядки удаления из полностью заполненной таблицы с цепочками через границу,
+  // инвариант проверяется после каждого шага.
+  for (UINTN Round = 0; Round < 2000; ++Round) {
+    UINTN Keys[6];
+    UINTN Alive = ARRAY_SIZE (Keys);
+
+    CHECK (HashMap_Construct (&Map, HashMapKeyPointer, sizeof (UINTN), 6) == EFI_SUCCESS);
+    for (UINTN Index = 0; Index < ARRAY_SIZE (Keys); ++Index) {
+      // Дома в последних двух и первой ячейке, чтобы цепочки почти всегда оборачивались.
+      UINTN Home = (Random64 () % 3 + Map.Capacity - 2) & (Map.Capacity - 1);
+      Keys[Index] = KeyWithHome (&Map, Home, &Next);
+      CHECK (HashMap_Insert (&Map, &Keys[Index], &Keys[Index]) == EFI_SUCCESS);
+    }
+    CHECK (Map.Capacity == MIN_CAPACITY);
+
+    while (Alive > 0) {
+      UINTN Victim = (UINTN)(Random64 () % Alive);
+      CHECK (HashMap_Remove (&Map, &Keys[Victim]) == EFI_SUCCESS);
+      CHECK (HashMap_Find (&Map, &Keys[Victim]) == NULL);
+      Keys[Victim] = Keys[--Alive];
+      CHECK (ProbeChainsIntact (&Map));
+      for (UINTN Index = 0; Index < Alive; ++Index) {
+        UINTN *Value = HashMap_Find (&Map, &Keys[Index]);
+        CHECK (Value != NULL && *Value == Keys[Index]);
+      }
+    }
+    CHECK (HashMap_Size (&Map) == 0);
+    HashMap_Destruct (&Map);
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Удаления до и после роста таблицы: при переносе элементы получают новые дома,
+ * и сдвиг назад должен работать уже по ним.
+*/
+STATIC
+VOID
+TestRemoveAcrossRehash (
+  )
+{
+  HASH_MAP  Map;
+  EFI_GUID  Guids[2000];
+  BOOLEAN   Present[ARRAY_SIZE (Guids)];
+  UINTN     Count = 0;
+
+  CHECK (HashMap_Construct (&Map, HashMapKeyGuid, sizeof (UINT16), 0) == EFI_SUCCESS);
+
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Guids); ++Index) {
+    RandomGuid (&Guids[Index]);
+    Present[Index] = FALSE;
+  }
+
+  // Вставляем порциями, между ними удаляем каждый третий из вставленных,
+  // так что рост таблицы происходит при наличии уже сдвинутых элементов.
+  UINTN PreviousCapacity = Map.Capacity;
+  UINTN Rehashes         = 0;
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Guids); ++Index) {
+    UINT16 Value = (UINT16)Index;
+    CHECK (HashMap_Insert (&Map, &Guids[Index], &Value) == EFI_SUCCESS);
+    Present[Index] = TRUE;
+    Count++;
+
+    if (Map.Capacity != PreviousCapacity) {
+      Rehashes++;
+      PreviousCapacity = Map.Capacity;
+      CHECK (ProbeChainsIntact (&Map));
+    }
+
+    if (Index % 3 == 2) {
+      UINTN Victim = (UINTN)(Random64 () % (Index + 1));
+      if (Present[Victim]) {
+        CHECK (HashMap_Remove (&Map, &Guids[Victim]) == EFI_SUCCESS);
+        Present[Victim] = FALSE;
+        Count--;
+      } else {
+        CHECK (HashMap_Remove (&Map, &Guids[Victim]) == EFI_NOT_FOUND);
+      }
+    }
+  }
+
+  CHECK (Rehashes >= 5);
+  CHECK (HashMap_Size (&Map) == Count);
+  CHECK (ProbeChainsIntact (&Map));
+
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Guids); ++Index) {
+    UINT16 *Value = HashMap_Find (&Map, &Guids[Index]);
+    if (Present[Index]) {
+      CHECK (Value != NULL && *Value == (UINT16)Index);
+    } else {
+      CHECK (Value == NULL);
+    }
+  }
+
+  // Явный рост через Reserve, затем удаление всего оставшегося.
+  CHECK (HashMap_Reserve (&Map, Map.Capacity * 2) == EFI_SUCCESS);
+  CHECK (ProbeChainsIntact (&Map));
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Guids); ++Index) {
+    if (Present[Index]) {
+      CHECK (HashMap_Remove (&Map, &Guids[Index]) == EFI_SUCCESS);
+      Count--;
+    }
+  }
+  CHECK (Count == 0 && HashMap_Size (&Map) == 0);
+  CHECK (ProbeChainsIntact (&Map));
+
+  HashMap_Destruct (&Map);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * После HashMap_Reserve() вставки и удаления не обращаются к аллокатору.
+*/
+STATIC
+VOID
+TestNoAllocationAfterReserve (
+  )
+{
+  HASH_MAP Map;
+  UINTN    Keys[500];
+
+  CHECK (HashMap_Construct (&Map, HashMapKeyPointer, 0, ARRAY_SIZE (Keys)) == EFI_SUCCESS);
+
+  UINTN Allocations = gHostShimAllocations;
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Keys); ++Index) {
+    Keys[Index] = (UINTN)Random64 ();
+    CHECK (HashMap_Insert (&Map, &Keys[Index], NULL) == EFI_SUCCESS);
+  }
+  for (UINTN Index = 0; Index < ARRAY_SIZE (Keys); Index += 2) {
+    CHECK (HashMap_Remove (&Map, &Keys[Index]) == EFI_SUCCESS);
+  }
+  CHECK (gHostShimAllocations == Allocations);
+
+  HashMap_Destruct (&Map);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * С NoGrow заполненная таблица отказывает во вставке, а не растёт,
+ * и принимает элементы снова после HashMap_Reserve().
+*/
+STATIC
+VOID
+TestNoGrow (
+  )
+{
+  HASH_MAP Map;
+  UINTN    Key;
+
+  CHECK (HashMap_Construct (&Map, HashMapKeyPointer, 0, 0) == EFI_SUCCESS);
+  Map.NoGrow = TRUE;
+
+  UINTN Allocations = gHostShimAllocations;
+  for (Key = 1; HashMap_Insert (&Map, &Key, NULL) == EFI_SUCCESS; ++Key) {
+  }
+  CHECK (gHostShimAllocations == Allocations);
+  CHECK (HashMap_Size (&Map) == Key - 1);
+  CHECK (HashMap_Find (&Map, &Key) == NULL);
+
+  CHECK (HashMap_Reserve (&Map, HashMap_Size (&Map) + 1) == EFI_SUCCESS);
+  CHECK (HashMap_Insert (&Map, &Key, NULL) == EFI_SUCCESS);
+  for (UINTN Index = 1; Index <= Key; ++Index) {
+    CHECK (HashMap_Find (&Map, &Index) != NULL);
+  }
+
+  HashMap_Destruct (&Map);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Поиск GUID'а перебором, как в ProtocolGuidDatabaseLib до HashMapLib.
+*/
+STATIC
+UINTN
+LinearFind (
+  IN CONST EFI_GUID *Guids,
+  IN UINTN          Count,
+  IN CONST EFI_GUID *Guid
+  )
+{
+  for (UINTN Index = 0; Index < Count; ++Index) {
+    if (CompareGuid (&Guids[Index], Guid)) {
+      return Index;
+    }
+  }
+  return Count;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Сравнивает время поиска в HASH_MAP и перебором по массиву для разного числа GUID'ов.
+ * Половина запросов - присутствующие GUID'ы, половина - отсутствующие,
+ * как у InternProtocolGuid(), который сначала ищет, а потом вставляет.
+*/
+STATIC
+VOID
+Benchmark (
+  )
+{
+  STATIC CONST UINTN Sizes[] = { 16, 64, 256, 1024, 4096 };
+  CONST UINTN        Lookups = 1u << 20;
+
+  printf ("\n%8s %14s %14s %10s\n", "GUIDs", "linear ns/op", "hash ns/op", "speedup");
+
+  for (UINTN SizeIndex = 0; SizeIndex < ARRAY_SIZE (Sizes); ++SizeIndex) {
+    UINTN    Count   = Sizes[SizeIndex];
+    EFI_GUID *Guids  = malloc (Count * sizeof (EFI_GUID));
+    EFI_GUID *Probes = malloc (Count * 2 * sizeof (EFI_GUID));
+    HASH_MAP Map;
+
+    HashMap_Construct (&Map, HashMapKeyGuid, sizeof (UINT16), Count);
+    for (UINTN Index = 0; Index < Count; ++Index) {
+      UINT16 Value = (UINT16)Index;
+      RandomGuid (&Guids[Index]);
+      HashMap_Insert (&Map, &Guids[Index], &Value);
+      Probes[2 * Index] = Guids[Index];
+      RandomGuid (&Probes[2 * Index + 1]);
+    }
+
+    // Перебор квадратичен по смыслу, поэтому для больших таблиц запросов меньше.
+    UINTN LinearLookups = MAX (Lookups / Count, 4096);
+    volatile UINTN Sink = 0;
+
+    UINT64 Start = HostShim_NowNs ();
+    for (UINTN Index = 0; Index < LinearLookups; ++Index) {
+      Sink += LinearFind (Guids, Count, &Probes[Index % (Count * 2)]);
+    }
+    double LinearNs = (double)(HostShim_NowNs () - Start) / (double)LinearLookups;
+
+    Start = HostShim_NowNs ();
+    for (UINTN Index = 0; Index < Lookups; ++Index) {
+      Sink += (UINTN)HashMap_Find (&Map, &Probes[Index % (Count * 2)]);
+    }
+    double HashNs = (double)(HostShim_NowNs () - Start) / (double)Lookups;
+
+    printf ("%8u %14.1f %14.1f %9.1fx\n", (unsigned)Count, LinearNs, HashNs, LinearNs / HashNs);
+
+    HashMap_Destruct (&Map);
+    free (Probes);
+    free (Guids);
+  }
+}
+
+// -----------------------------------------------------------------------------
+int
+main (
+  int  argc,
+  char **argv
+  )
+{
+  TestInsertFind ();
+  TestRemoveAcrossWraparound ();
+  TestRemoveAcrossRehash ();
+  TestNoAllocationAfterReserve ();
+  TestNoGrow ();
+
+  printf ("%u checks, %u failed\n", (unsigned)mChecks, (unsigned)mFailures);
+  if (mFailures != 0) {
+    return 1;
+  }
+
+  if (argc > 1 && strcmp (argv[1], "-b") == 0) {
+    Benchmark ();
+  }
+
+  return 0;
+}
@@ -0,0 +1,176 @@
+/** @file
+ * Реализация на libc того минимума сервисов EDK2, который используют библиотеки пакета.
+ * TPL на хосте не существует, RaiseTPL() лишь запоминает уровень,
+ * чтобы тесты могли проверить, что память не выделяется выше TPL_NOTIFY.
+ */
+#define _POSIX_C_SOURCE 199309L     // clock_gettime() при -std=c11.
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include "HostShim.h"
+
+EFI_TPL gHostShimTpl = TPL_APPLICATION;
+UINTN   gHostShimAllocations;
+UINTN   gHostShimAllocationsAboveNotify;
+
+// -----------------------------------------------------------------------------
+STATIC
+EFI_TPL
+EFIAPI
+HostRaiseTpl (
+  IN EFI_TPL NewTpl
+  )
+{
+  EFI_TPL OldTpl = gHostShimTpl;
+  gHostShimTpl = NewTpl;
+  return OldTpl;
+}
+
+// -----------------------------------------------------------------------------
+STATIC
+VOID
+EFIAPI
+HostRestoreTpl (
+  IN EFI_TPL OldTpl
+  )
+{
+  gHostShimTpl = OldTpl;
+}
+
+// -----------------------------------------------------------------------------
+STATIC
+EFI_STATUS
+EFIAPI
+HostAllocatePool (
+  IN  EFI_MEMORY_TYPE PoolType,
+  IN  UINTN           Size,
+  OUT VOID            **Buffer
+  )
+{
+  (VOID)PoolType;
+
+  gHostShimAllocations++;
+  if (gHostShimTpl > TPL_NOTIFY) {
+    gHostShimAllocationsAboveNotify++;
+  }
+
+  *Buffer = malloc (Size != 0 ? Size : 1);
+  return (*Buffer != NULL) ? EFI_SUCCESS : EFI_OUT_OF_RESOURCES;
+}
+
+// -----------------------------------------------------------------------------
+STATIC
+EFI_STATUS
+EFIAPI
+HostFreePool (
+  IN VOID *Buffer
+  )
+{
+  free (Buffer);
+  return EFI_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+STATIC
+VOID
+EFIAPI
+HostCopyMem (
+  IN VOID  *Destination,
+  IN VOID  *Source,
+  IN UINTN Length
+  )
+{
+  memmove (Destination, Source, Length);
+}
+
+// -----------------------------------------------------------------------------
+STATIC
+VOID
+EFIAPI
+HostSetMem (
+  IN VOID  *Buffer,
+  IN UINTN Size,
+  IN UINT8 Value
+  )
+{
+  memset (Buffer, Value, Size);
+}
+
+STATIC EFI_BOOT_SERVICES mHostBootServices = {
+  HostRaiseTpl,
+  HostRestoreTpl,
+  HostAllocatePool,
+  HostFreePool,
+  HostCopyMem,
+  HostSetMem
+};
+
+EFI_BOOT_SERVICES *gBS = &mHostBootServices;
+
+// -----------------------------------------------------------------------------
+UINT64
+ReadUnaligned64 (
+  IN CONST UINT64 *Buffer
+  )
+{
+  UINT64 Value;
+  memcpy (&Value, Buffer, sizeof (Value));
+  return Value;
+}
+
+// -----------------------------------------------------------------------------
+BOOLEAN
+CompareGuid (
+  IN CONST GUID *Guid1,
+  IN CONST GUID *Guid2
+  )
+{
+  // Как и в BaseMemoryLib из EDK2: два 64-битных сравнения вместо побайтового.
+  return ReadUnaligned64 ((CONST UINT64 *)Guid1)     == ReadUnaligned64 ((CONST UINT64 *)Guid2)
+      && ReadUnaligned64 ((CONST UINT64 *)Guid1 + 1) == ReadUnaligned64 ((CONST UINT64 *)Guid2 + 1);
+}
+
+// -----------------------------------------------------------------------------
+GUID *
+CopyGuid (
+  OUT GUID       *DestinationGuid,
+  IN  CONST GUID *SourceGuid
+  )
+{
+  memcpy (DestinationGuid, SourceGuid, sizeof (GUID));
+  return DestinationGuid;
+}
+
+// -----------------------------------------------------------------------------
+VOID *
+ZeroMem (
+  OUT VOID  *Buffer,
+  IN  UINTN Length
+  )
+{
+  return memset (Buffer, 0, Length);
+}
+
+// -----------------------------------------------------------------------------
+BOOLEAN
+CommonMacrosEnabled (
+  )
+{
+  return FALSE;
+}
+
+// -----------------------------------------------------------------------------
+UINT64
+HostShim_NowNs (
+  )
+{
+  struct timespec Now;
+  clock_gettime (CLOCK_MONOTONIC, &Now);
+  return (UINT64)Now.tv_sec * 1000000000ull + (UINT64)Now.tv_nsec;
+}
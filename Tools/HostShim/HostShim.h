@@ -0,0 +1,23 @@
+/** @file
+ * Вспомогательные функции хостовой обвязки для тестов и бенчмарков из Tools/.
+ */
+#include <Uefi.h>
+
+#ifndef HOST_SHIM_H_
+#define HOST_SHIM_H_
+
+// Текущий "TPL", который выставили RaiseTPL()/RestoreTPL().
+extern EFI_TPL  gHostShimTpl;
+
+// Сколько раз вызывался AllocatePool(), всего и при TPL выше TPL_NOTIFY.
+extern UINTN    gHostShimAllocations;
+extern UINTN    gHostShimAllocationsAboveNotify;
+
+/**
+ * Монотонное время в наносекундах.
+ */
+UINT64
+HostShim_NowNs (
+  );
+
+#endif  // HOST_SHIM_H_
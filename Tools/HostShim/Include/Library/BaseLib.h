@@ -0,0 +1,11 @@
+#include <Uefi.h>
+
+#ifndef HOST_SHIM_BASE_LIB_H_
+#define HOST_SHIM_BASE_LIB_H_
+
+UINT64
+ReadUnaligned64 (
+  IN CONST UINT64 *Buffer
+  );
+
+#endif  // HOST_SHIM_BASE_LIB_H_
@@ -0,0 +1,24 @@
+#include <Uefi.h>
+
+#ifndef HOST_SHIM_BASE_MEMORY_LIB_H_
+#define HOST_SHIM_BASE_MEMORY_LIB_H_
+
+BOOLEAN
+CompareGuid (
+  IN CONST GUID *Guid1,
+  IN CONST GUID *Guid2
+  );
+
+GUID *
+CopyGuid (
+  OUT GUID       *DestinationGuid,
+  IN  CONST GUID *SourceGuid
+  );
+
+VOID *
+ZeroMem (
+  OUT VOID *Buffer,
+  IN  UINTN Length
+  );
+
+#endif  // HOST_SHIM_BASE_MEMORY_LIB_H_
@@ -0,0 +1,13 @@
+#include <Uefi.h>
+
+#ifndef HOST_SHIM_DEBUG_LIB_H_
+#define HOST_SHIM_DEBUG_LIB_H_
+
+// На хосте отладочный вывод библиотек не нужен, DBG_* макросы и так выключены CommonMacrosEnabled().
+#define EFI_D_INFO          0x00000040
+#define EFI_D_ERROR         0x80000000
+
+#define DEBUG(Expression)   do { } while (0)
+#define ASSERT(Expression)  do { } while (0)
+
+#endif  // HOST_SHIM_DEBUG_LIB_H_
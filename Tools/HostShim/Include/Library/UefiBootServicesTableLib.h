@@ -0,0 +1,8 @@
+#include <Uefi.h>
+
+#ifndef HOST_SHIM_UEFI_BOOT_SERVICES_TABLE_LIB_H_
+#define HOST_SHIM_UEFI_BOOT_SERVICES_TABLE_LIB_H_
+
+extern EFI_BOOT_SERVICES *gBS;
+
+#endif  // HOST_SHIM_UEFI_BOOT_SERVICES_TABLE_LIB_H_
@@ -0,0 +1,22 @@
+#include <Uefi.h>
+
+#ifndef HOST_SHIM_SIMPLE_FILE_SYSTEM_H_
+#define HOST_SHIM_SIMPLE_FILE_SYSTEM_H_
+
+#define EFI_FILE_MODE_READ  0x0000000000000001ull
+
+typedef struct _EFI_FILE_PROTOCOL EFI_FILE_PROTOCOL;
+
+// Порядок полей совпадает с EDK2, хотя на хосте файлы через протокол не читаются.
+struct _EFI_FILE_PROTOCOL {
+  UINT64      Revision;
+  EFI_STATUS  (EFIAPI *Open)        (EFI_FILE_PROTOCOL *This, EFI_FILE_PROTOCOL **NewHandle, CHAR16 *FileName, UINT64 OpenMode, UINT64 Attributes);
+  EFI_STATUS  (EFIAPI *Close)       (EFI_FILE_PROTOCOL *This);
+  EFI_STATUS  (EFIAPI *Delete)      (EFI_FILE_PROTOCOL *This);
+  EFI_STATUS  (EFIAPI *Read)        (EFI_FILE_PROTOCOL *This, UINTN *BufferSize, VOID *Buffer);
+  EFI_STATUS  (EFIAPI *Write)       (EFI_FILE_PROTOCOL *This, UINTN *BufferSize, VOID *Buffer);
+  EFI_STATUS  (EFIAPI *GetPosition) (EFI_FILE_PROTOCOL *This, UINT64 *Position);
+  EFI_STATUS  (EFIAPI *SetPosition) (EFI_FILE_PROTOCOL *This, UINT64 Position);
+};
+
+#endif  // HOST_SHIM_SIMPLE_FILE_SYSTEM_H_
@@ -0,0 +1,97 @@
+/** @file
+ * Минимальная замена заголовков EDK2 для сборки библиотек пакета на хосте.
+ * Описано только то, что нужно тестам и бенчмаркам из Tools/, сервисы gBS реализованы в HostShim.c.
+ * Вызовы идут в родном ABI хоста, поэтому EFIAPI пустой.
+ */
+#ifndef HOST_SHIM_UEFI_H_
+#define HOST_SHIM_UEFI_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint64_t  UINT64;
+typedef int64_t   INT64;
+typedef uint32_t  UINT32;
+typedef int32_t   INT32;
+typedef uint16_t  UINT16;
+typedef int16_t   INT16;
+typedef uint8_t   UINT8;
+typedef int8_t    INT8;
+typedef uintptr_t UINTN;
+typedef intptr_t  INTN;
+typedef uint8_t   BOOLEAN;
+typedef char      CHAR8;
+typedef uint16_t  CHAR16;
+
+#define VOID      void
+#define IN
+#define OUT
+#define OPTIONAL
+#define CONST     const
+#define STATIC    static
+#define EFIAPI
+
+#define TRUE      ((BOOLEAN)1)
+#define FALSE     ((BOOLEAN)0)
+
+#define MAX_UINT16  ((UINT16)0xFFFF)
+#define MAX_UINT32  ((UINT32)0xFFFFFFFF)
+#define MAX_UINT64  ((UINT64)0xFFFFFFFFFFFFFFFFull)
+#define MAX_UINTN   ((UINTN)UINTPTR_MAX)
+
+#define STATIC_ASSERT                 _Static_assert
+#define ALIGN_VALUE(Value, Alignment) ((Value) + (((Alignment) - (Value)) & ((Alignment) - 1)))
+#define ARRAY_SIZE(Array)             (sizeof (Array) / sizeof ((Array)[0]))
+#define MIN(a, b)                     (((a) < (b)) ? (a) : (b))
+#define MAX(a, b)                     (((a) > (b)) ? (a) : (b))
+#define SIGNATURE_16(A, B)            ((A) | ((B) << 8))
+#define SIGNATURE_32(A, B, C, D)      (SIGNATURE_16 (A, B) | ((UINT32)SIGNATURE_16 (C, D) << 16))
+
+typedef struct {
+  UINT32  Data1;
+  UINT16  Data2;
+  UINT16  Data3;
+  UINT8   Data4[8];
+} GUID;
+
+typedef GUID    EFI_GUID;
+typedef UINTN   EFI_STATUS;
+typedef UINTN   EFI_TPL;
+typedef VOID    *EFI_HANDLE;
+typedef VOID    *EFI_EVENT;
+
+#define ENCODE_ERROR(Code)      ((EFI_STATUS)((MAX_UINTN ^ (MAX_UINTN >> 1)) | (Code)))
+#define EFI_ERROR(Status)       (((INTN)(EFI_STATUS)(Status)) < 0)
+
+#define EFI_SUCCESS             0
+#define EFI_INVALID_PARAMETER   ENCODE_ERROR (2)
+#define EFI_UNSUPPORTED         ENCODE_ERROR (3)
+#define EFI_BUFFER_TOO_SMALL    ENCODE_ERROR (5)
+#define EFI_OUT_OF_RESOURCES    ENCODE_ERROR (9)
+#define EFI_VOLUME_CORRUPTED    ENCODE_ERROR (10)
+#define EFI_NOT_FOUND           ENCODE_ERROR (14)
+#define EFI_ALREADY_STARTED     ENCODE_ERROR (20)
+
+#define TPL_APPLICATION         4
+#define TPL_CALLBACK            8
+#define TPL_NOTIFY              16
+#define TPL_HIGH_LEVEL          31
+
+typedef enum {
+  EfiReservedMemoryType,
+  EfiLoaderCode,
+  EfiLoaderData,
+  EfiBootServicesCode,
+  EfiBootServicesData
+} EFI_MEMORY_TYPE;
+
+typedef struct {
+  EFI_TPL     (EFIAPI *RaiseTPL)     (EFI_TPL NewTpl);
+  VOID        (EFIAPI *RestoreTPL)   (EFI_TPL OldTpl);
+  EFI_STATUS  (EFIAPI *AllocatePool) (EFI_MEMORY_TYPE PoolType, UINTN Size, VOID **Buffer);
+  EFI_STATUS  (EFIAPI *FreePool)     (VOID *Buffer);
+  VOID        (EFIAPI *CopyMem)      (VOID *Destination, VOID *Source, UINTN Length);
+  VOID        (EFIAPI *SetMem)       (VOID *Buffer, UINTN Size, UINT8 Value);
+} EFI_BOOT_SERVICES;
+
+#endif  // HOST_SHIM_UEFI_H_
@@ -0,0 +1,761 @@
+/** @file
+ * Переводит двоичный лог DxeLoadingLogger (BINARY_LOG_FORMAT = TRUE) в тот же текст,
+ * что драйвер пишет в текстовом режиме, в UTF-8.
+ *
+ * Использование: LogDecoder [-g guiddb.bin] log.txt [out.txt]
+ *
+ * Имена протоколов берутся из guiddb.bin, который генерирует
+ * Library/ProtocolGuidDatabaseLib/Scripts/make_guid_db_from_edk2_guids.py --binary;
+ * без него вместо имён печатаются GUID'ы.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Формат двоичного лога, должен совпадать с Source/BinaryLogFormat.h.
+// Структуры там упакованы, здесь поля читаются по смещениям, little-endian.
+#define BINARY_LOG_SIGNATURE              0x424C4C44u   // 'DLLB'
+#define BINARY_LOG_VERSION                4       // Читаются и старые версии: в 1 нет VolumeProbes*, в 2 нет Deferred*,
+                                                  // в 3 нет MultiCalls, а Calls включает и Multiple-вызовы.
+#define BINARY_LOG_FILE_HEADER_SIZE       32
+#define BINARY_LOG_RECORD_HEADER_SIZE     12
+#define BINARY_LOG_PROTOCOL_RECORD_SIZE   32
+#define BINARY_LOG_RECORD_STATISTICS      0x80
+#define BINARY_LOG_FLAG_SUCCESSFUL        0x01
+#define BINARY_LOG_FLAG_MULTIPLE_CALL     0x02
+#define BINARY_LOG_NULL_STRING            0xFFFF
+#define BINARY_LOG_CALL_STATS_COUNT       10
+#define BINARY_LOG_OVERHEAD_STATS_COUNT   6
+#define BINARY_LOG_STATISTICS_COUNTERS(Version)  ((Version) >= 3 ? 18 : (Version) >= 2 ? 16 : 14)
+#define BINARY_LOG_CALL_TABLES(Version)          ((Version) >= 4 ? 2 : 1)
+#define BINARY_LOG_STATISTICS_SIZE(Version)      (BINARY_LOG_STATISTICS_COUNTERS (Version) * 8 \
+                                                  + BINARY_LOG_CALL_TABLES (Version) * BINARY_LOG_CALL_STATS_COUNT * 40 \
+                                                  + BINARY_LOG_OVERHEAD_STATS_COUNT * 16)
+
+// Типы событий, должны совпадать с LOG_ENTRY_TYPE в Include/Library/LoadingEventLib.h.
+enum {
+  LOG_ENTRY_TYPE_PROTOCOL_INSTALLED,
+  LOG_ENTRY_TYPE_PROTOCOL_REINSTALLED,
+  LOG_ENTRY_TYPE_PROTOCOL_REMOVED,
+  LOG_ENTRY_TYPE_PROTOCOL_EXISTS_ON_STARTUP,
+  LOG_ENTRY_TYPE_IMAGE_LOADED,
+  LOG_ENTRY_TYPE_IMAGE_EXISTS_ON_STARTUP,
+  LOG_ENTRY_TYPE_BDS_STAGE_ENTERED,
+  LOG_ENTRY_TYPE_ERROR
+};
+
+// -----------------------------------------------------------------------------
+// Формат guiddb.bin, должен совпадать с ProtocolGuidDatabaseLib.c.
+#define GUID_DB_FILE_SIGNATURE    0x46424447u   // 'GDBF'
+#define GUID_DB_FILE_VERSION      1
+#define GUID_DB_FILE_HEADER_SIZE  32
+#define GUID_DB_HASH_EMPTY_SLOT   0xFFFF
+
+// Параметры хэш-функции, должны совпадать с ProtocolGuidDatabaseLib.c.
+#define GUID_HASH_SEED_MUL        0x9E3779B97F4A7C15ull
+#define GUID_HASH_FMIX_MUL1       0xFF51AFD7ED558CCDull
+#define GUID_HASH_FMIX_MUL2       0xC4CEB9FE1A85EC53ull
+
+static const char *LINE = "- --------------------------------------------------------------------------------\r\n";
+
+// -----------------------------------------------------------------------------
+typedef struct {
+  const uint8_t *Buffer;
+  size_t        Size;
+} BLOB;
+
+typedef struct {
+  uint32_t       Count;
+  uint32_t       BucketCount;
+  uint32_t       SlotCount;
+  uint32_t       NamePoolSize;
+  const uint8_t  *Guids;
+  const uint8_t  *NameOffsets;
+  const uint8_t  *Displacements;
+  const uint8_t  *Slots;
+  const char     *NamePool;
+} GUID_DATABASE;
+
+static GUID_DATABASE gDatabase;
+static uint64_t      gFrequency;
+static uint16_t      gVersion;
+static FILE          *gOut;
+
+// -----------------------------------------------------------------------------
+static uint16_t ReadU16 (const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint32_t ReadU32 (const uint8_t *p) { return (uint32_t)ReadU16 (p) | ((uint32_t)ReadU16 (p + 2) << 16); }
+static uint64_t ReadU64 (const uint8_t *p) { return (uint64_t)ReadU32 (p) | ((uint64_t)ReadU32 (p + 4) << 32); }
+
+// -----------------------------------------------------------------------------
+/**
+ * Читает файл целиком. При ошибке печатает сообщение и возвращает 0.
+ */
+static int
+ReadFile (
+  const char *Path,
+  BLOB       *Blob
+  )
+{
+  FILE *File = fopen (Path, "rb");
+  if (File == NULL) {
+    perror (Path);
+    return 0;
+  }
+
+  fseek (File, 0, SEEK_END);
+  long Size = ftell (File);
+  fseek (File, 0, SEEK_SET);
+
+  uint8_t *Buffer = malloc (Size > 0 ? (size_t)Size : 1);
+  if (Buffer == NULL || fread (Buffer, 1, (size_t)Size, File) != (size_t)Size) {
+    fprintf (stderr, "%s: read error\n", Path);
+    fclose (File);
+    free (Buffer);
+    return 0;
+  }
+
+  fclose (File);
+  Blob->Buffer = Buffer;
+  Blob->Size   = (size_t)Size;
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Разбирает guiddb.bin с теми же проверками, что и драйвер.
+ */
+static int
+ParseDatabase (
+  const BLOB *Blob
+  )
+{
+  const uint8_t *Buffer = Blob->Buffer;
+
+  if (Blob->Size < GUID_DB_FILE_HEADER_SIZE
+    || ReadU32 (Buffer) != GUID_DB_FILE_SIGNATURE
+    || ReadU32 (Buffer + 4) != GUID_DB_FILE_VERSION) {
+    return 0;
+  }
+
+  gDatabase.Count        = ReadU32 (Buffer + 8);
+  gDatabase.BucketCount  = ReadU32 (Buffer + 12);
+  gDatabase.SlotCount    = ReadU32 (Buffer + 16);
+  gDatabase.NamePoolSize = ReadU32 (Buffer + 20);
+
+  if (gDatabase.Count == 0 || gDatabase.Count >= GUID_DB_HASH_EMPTY_SLOT
+    || gDatabase.BucketCount == 0 || (gDatabase.BucketCount & (gDatabase.BucketCount - 1)) != 0
+    || gDatabase.SlotCount   == 0 || (gDatabase.SlotCount   & (gDatabase.SlotCount   - 1)) != 0
+    || gDatabase.NamePoolSize == 0) {
+    return 0;
+  }
+
+  uint64_t GuidsOffset         = GUID_DB_FILE_HEADER_SIZE;
+  uint64_t NameOffsetsOffset   = GuidsOffset         + (uint64_t)gDatabase.Count       * 16;
+  uint64_t DisplacementsOffset = NameOffsetsOffset   + (uint64_t)gDatabase.Count       * 4;
+  uint64_t SlotsOffset         = DisplacementsOffset + (uint64_t)gDatabase.BucketCount * 2;
+  uint64_t NamePoolOffset      = SlotsOffset         + (uint64_t)gDatabase.SlotCount   * 2;
+
+  if (NamePoolOffset + gDatabase.NamePoolSize != Blob->Size) {
+    return 0;
+  }
+
+  gDatabase.Guids         = Buffer + GuidsOffset;
+  gDatabase.NameOffsets   = Buffer + NameOffsetsOffset;
+  gDatabase.Displacements = Buffer + DisplacementsOffset;
+  gDatabase.Slots         = Buffer + SlotsOffset;
+  gDatabase.NamePool      = (const char *)(Buffer + NamePoolOffset);
+
+  if (gDatabase.NamePool[gDatabase.NamePoolSize - 1] != '\0') {
+    return 0;
+  }
+
+  for (uint32_t Index = 0; Index < gDatabase.Count; ++Index) {
+    if (ReadU32 (gDatabase.NameOffsets + Index * 4) >= gDatabase.NamePoolSize) {
+      return 0;
+    }
+  }
+
+  for (uint32_t Slot = 0; Slot < gDatabase.SlotCount; ++Slot) {
+    uint16_t Index = ReadU16 (gDatabase.Slots + Slot * 2);
+    if (Index != GUID_DB_HASH_EMPTY_SLOT && Index >= gDatabase.Count) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+static uint64_t
+Fmix64 (
+  uint64_t Value
+  )
+{
+  Value ^= Value >> 33;
+  Value *= GUID_HASH_FMIX_MUL1;
+  Value ^= Value >> 33;
+  Value *= GUID_HASH_FMIX_MUL2;
+  Value ^= Value >> 33;
+  return Value;
+}
+
+// -----------------------------------------------------------------------------
+static uint64_t
+GuidHash (
+  const uint8_t *Guid,
+  uint64_t      Seed
+  )
+{
+  return Fmix64 (Fmix64 ((Seed * GUID_HASH_SEED_MUL) ^ ReadU64 (Guid)) ^ ReadU64 (Guid + 8));
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Ищет имя протокола в guiddb.bin за одну пробу, как GetProtocolName() в драйвере.
+ *
+ * @return Имя протокола, либо NULL.
+ */
+static const char *
+GetProtocolName (
+  const uint8_t *Guid
+  )
+{
+  if (gDatabase.Count == 0) {
+    return NULL;
+  }
+
+  uint32_t Bucket = (uint32_t)GuidHash (Guid, 0) & (gDatabase.BucketCount - 1);
+  uint16_t Seed   = ReadU16 (gDatabase.Displacements + Bucket * 2);
+  uint32_t Slot   = (uint32_t)GuidHash (Guid, Seed) & (gDatabase.SlotCount - 1);
+  uint16_t Index  = ReadU16 (gDatabase.Slots + Slot * 2);
+
+  if (Index == GUID_DB_HASH_EMPTY_SLOT || memcmp (Guid, gDatabase.Guids + Index * 16, 16) != 0) {
+    return NULL;
+  }
+
+  return gDatabase.NamePool + ReadU32 (gDatabase.NameOffsets + Index * 4);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Печатает GUID так же, как "%g" в PrintLib.
+ */
+static void
+FormatGuid (
+  char          *Buffer,
+  size_t        Size,
+  const uint8_t *Guid
+  )
+{
+  snprintf (Buffer, Size, "%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x",
+    ReadU32 (Guid), ReadU16 (Guid + 4), ReadU16 (Guid + 6),
+    Guid[8], Guid[9], Guid[10], Guid[11], Guid[12], Guid[13], Guid[14], Guid[15]
+    );
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Имя протокола, либо его GUID, если имени в БД нет.
+ */
+static const char *
+GetProtocolText (
+  const uint8_t *Guid,
+  char          *Buffer,
+  size_t        Size
+  )
+{
+  const char *Name = GetProtocolName (Guid);
+  if (Name != NULL) {
+    return Name;
+  }
+
+  FormatGuid (Buffer, Size, Guid);
+  return Buffer;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Как Timestamp_ToMicroseconds() в драйвере.
+ */
+static uint64_t
+ToMicroseconds (
+  uint64_t Ticks
+  )
+{
+  if (gFrequency == 0) {
+    return 0;
+  }
+
+  return (Ticks / gFrequency) * 1000000 + (Ticks % gFrequency) * 1000000 / gFrequency;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Строка события: UINT16 число символов, затем CHAR16 без '\0'.
+ */
+typedef struct {
+  int           IsNull;
+  uint16_t      Length;
+  const uint8_t *Chars;
+} LOG_STRING;
+
+// -----------------------------------------------------------------------------
+/**
+ * Читает строку из записи, сдвигая Cursor. При выходе за End возвращает 0.
+ */
+static int
+ReadString (
+  const uint8_t **Cursor,
+  const uint8_t *End,
+  LOG_STRING    *Str
+  )
+{
+  if (End - *Cursor < 2) {
+    return 0;
+  }
+
+  uint16_t Length = ReadU16 (*Cursor);
+  *Cursor += 2;
+
+  Str->IsNull = (Length == BINARY_LOG_NULL_STRING);
+  Str->Length = Str->IsNull ? 0 : Length;
+  Str->Chars  = *Cursor;
+
+  if ((size_t)(End - *Cursor) < (size_t)Str->Length * 2) {
+    return 0;
+  }
+
+  *Cursor += (size_t)Str->Length * 2;
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Печатает строку в UTF-8 так же, как это делает драйвер при LOG_UTF8_ENCODING,
+ * дополняя пробелами справа до Width символов (как "%-60s").
+ */
+static void
+PrintString (
+  const LOG_STRING *Str,
+  const char       *IfNull,
+  int              Width
+  )
+{
+  if (Str->IsNull) {
+    fprintf (gOut, "%-*s", Width, IfNull);
+    return;
+  }
+
+  for (uint16_t Index = 0; Index < Str->Length; ++Index) {
+    uint32_t CodePoint = ReadU16 (Str->Chars + Index * 2);
+
+    if (CodePoint >= 0xD800 && CodePoint <= 0xDFFF) {
+      uint32_t Next = (Index + 1 < Str->Length) ? ReadU16 (Str->Chars + (Index + 1) * 2) : 0;
+      if (CodePoint <= 0xDBFF && Next >= 0xDC00 && Next <= 0xDFFF) {
+        CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Next - 0xDC00);
+        ++Index;
+      } else {
+        CodePoint = '?';
+      }
+    }
+
+    if (CodePoint < 0x80) {
+      fputc ((int)CodePoint, gOut);
+    } else if (CodePoint < 0x800) {
+      fputc (0xC0 | (CodePoint >> 6), gOut);
+      fputc (0x80 | (CodePoint & 0x3F), gOut);
+    } else if (CodePoint < 0x10000) {
+      fputc (0xE0 | (CodePoint >> 12), gOut);
+      fputc (0x80 | ((CodePoint >> 6) & 0x3F), gOut);
+      fputc (0x80 | (CodePoint & 0x3F), gOut);
+    } else {
+      fputc (0xF0 | (CodePoint >> 18), gOut);
+      fputc (0x80 | ((CodePoint >> 12) & 0x3F), gOut);
+      fputc (0x80 | ((CodePoint >> 6) & 0x3F), gOut);
+      fputc (0x80 | (CodePoint & 0x3F), gOut);
+    }
+  }
+
+  for (int Pad = Str->Length; Pad < Width; ++Pad) {
+    fputc (' ', gOut);
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Печатает событие о протоколе: установку, переустановку или удаление.
+ */
+static void
+PrintProtocolCall (
+  const char       *Prefix,
+  const char       *Kind,
+  uint8_t          Flags,
+  const uint8_t    *Payload,
+  const LOG_STRING *HandleName
+  )
+{
+  char     GuidText[40];
+  uint64_t Duration = ReadU64 (Payload + 24);
+
+  fprintf (gOut, "%s %s (%s): %-60s", Prefix, Kind,
+    (Flags & BINARY_LOG_FLAG_SUCCESSFUL) ? "SUCCESS" : "FAIL",
+    GetProtocolText (Payload, GuidText, sizeof (GuidText))
+    );
+
+  if (!HandleName->IsNull) {
+    fputs (" at: ", gOut);
+    PrintString (HandleName, "", 0);
+  }
+
+  if (Duration != 0 && gFrequency != 0) {
+    fprintf (gOut, (Flags & BINARY_LOG_FLAG_MULTIPLE_CALL) ? " in: %u us (whole multi-protocol call)" : " in: %u us",
+      (unsigned)ToMicroseconds (Duration));
+  }
+
+  fputs ("\r\n", gOut);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Печатает событие так же, как AddNewEventToLog() в драйвере.
+ *
+ * @return 0, если запись повреждена.
+ */
+static int
+PrintEvent (
+  uint8_t       Type,
+  uint8_t       Flags,
+  uint64_t      Timestamp,
+  const uint8_t *Payload,
+  const uint8_t *End,
+  unsigned      EventNumber
+  )
+{
+  static uint64_t PreviousTimestamp;
+  char            Prefix[64];
+  char            GuidText[40];
+  LOG_STRING      Strings[2];
+  const uint8_t   *Cursor = Payload;
+
+  // Номер события, время от сброса процессора и от предыдущего события.
+  if (gFrequency != 0) {
+    if (PreviousTimestamp == 0 || Timestamp < PreviousTimestamp) {
+      PreviousTimestamp = Timestamp;
+    }
+
+    uint64_t Absolute = ToMicroseconds (Timestamp);
+    uint64_t Delta    = ToMicroseconds (Timestamp - PreviousTimestamp);
+
+    snprintf (Prefix, sizeof (Prefix), "-%5u- [%5u.%06u s, +%6u.%03u ms]",
+      EventNumber,
+      (unsigned)(Absolute / 1000000), (unsigned)(Absolute % 1000000),
+      (unsigned)(Delta / 1000),       (unsigned)(Delta % 1000)
+      );
+  } else {
+    snprintf (Prefix, sizeof (Prefix), "-%5u-", EventNumber);
+  }
+  PreviousTimestamp = Timestamp;
+
+  switch (Type) {
+  case LOG_ENTRY_TYPE_PROTOCOL_INSTALLED:
+  case LOG_ENTRY_TYPE_PROTOCOL_REINSTALLED:
+  case LOG_ENTRY_TYPE_PROTOCOL_REMOVED:
+    {
+      static const char *Kinds[] = { "PROTOCOL-INSTALLED", "PROTOCOL-REINSTALLED", "PROTOCOL-REMOVED" };
+
+      Cursor += BINARY_LOG_PROTOCOL_RECORD_SIZE;
+      if (Cursor > End || !ReadString (&Cursor, End, &Strings[0])) {
+        return 0;
+      }
+
+      PrintProtocolCall (Prefix, Kinds[Type], Flags, Payload, &Strings[0]);
+    }
+    break;
+
+  case LOG_ENTRY_TYPE_PROTOCOL_EXISTS_ON_STARTUP:
+    {
+      Cursor += BINARY_LOG_PROTOCOL_RECORD_SIZE;
+      if (Cursor > End || !ReadString (&Cursor, End, &Strings[0])) {
+        return 0;
+      }
+
+      const char *Protocol = GetProtocolText (Payload, GuidText, sizeof (GuidText));
+      if (!Strings[0].IsNull) {
+        fprintf (gOut, "%s PROTOCOL-EXISTS-ON-STARTUP: %-60s at: ", Prefix, Protocol);
+        PrintString (&Strings[0], "", 0);
+        fputs ("\r\n", gOut);
+      } else {
+        fprintf (gOut, "%s PROTOCOL-EXISTS-ON-STARTUP: %s\r\n", Prefix, Protocol);
+      }
+    }
+    break;
+
+  case LOG_ENTRY_TYPE_IMAGE_LOADED:
+  case LOG_ENTRY_TYPE_IMAGE_EXISTS_ON_STARTUP:
+    if (!ReadString (&Cursor, End, &Strings[0]) || !ReadString (&Cursor, End, &Strings[1])) {
+      return 0;
+    }
+
+    if (Type == LOG_ENTRY_TYPE_IMAGE_LOADED) {
+      fprintf (gOut, "\r\n%s IMAGE-LOADED: ", Prefix);
+    } else {
+      fprintf (gOut, "%s IMAGE-EXISTS-ON-STARTUP: ", Prefix);
+    }
+    PrintString (&Strings[0], "<UNKNOWN>", 60);
+    fputs (" loaded by: ", gOut);
+    PrintString (&Strings[1], "<UNKNOWN>", 0);
+    fputs ("\r\n", gOut);
+    break;
+
+  case LOG_ENTRY_TYPE_BDS_STAGE_ENTERED:
+    fputs (LINE, gOut);
+    fprintf (gOut, "%s BDS-STAGE-ENTERED: %s\r\n", Prefix,
+      Flags == 0 ? "BEFORE" : Flags == 1 ? "AFTER" : "<ERROR: Unknown SubEvent type>"
+      );
+    fputs (LINE, gOut);
+    break;
+
+  case LOG_ENTRY_TYPE_ERROR:
+    if (!ReadString (&Cursor, End, &Strings[0])) {
+      return 0;
+    }
+
+    fprintf (gOut, "\r\n\r\n%s ERROR: ", Prefix);
+    PrintString (&Strings[0], "<UNKNOWN>", 0);
+    fputs ("\r\n\r\n", gOut);
+    break;
+
+  default:
+    fprintf (gOut, "\r\n\r\n%s ERROR: Unknown event type\r\n\r\n\r\n", Prefix);
+    break;
+  }
+
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Печатает таблицу самых долгих протоколов так же, как WriteProtocolCallStats() в драйвере.
+ */
+static void
+PrintCallStats (
+  const uint8_t *Calls,
+  const char    *Title
+  )
+{
+  fprintf (gOut, Title, (unsigned)BINARY_LOG_CALL_STATS_COUNT);
+  for (unsigned Row = 0; Row < BINARY_LOG_CALL_STATS_COUNT; ++Row) {
+    const uint8_t *Call = Calls + Row * 40;
+    char          GuidText[40];
+    char          Name[61];
+
+    if (ReadU64 (Call + 16) == 0) {
+      break;
+    }
+
+    // Имя обрезается по ширине колонки, как и в драйвере.
+    snprintf (Name, sizeof (Name), "%s", GetProtocolText (Call, GuidText, sizeof (GuidText)));
+    fprintf (gOut, "-   %-60s %10u calls, %10u us total, %10u us max\r\n",
+      Name,
+      (unsigned)ReadU64 (Call + 16),
+      (unsigned)ToMicroseconds (ReadU64 (Call + 24)),
+      (unsigned)ToMicroseconds (ReadU64 (Call + 32))
+      );
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Печатает блок статистики так же, как WriteTextLogStatistics() в драйвере.
+ */
+static void
+PrintStatistics (
+  const uint8_t *Stats
+  )
+{
+  static const char *StageNames[BINARY_LOG_OVERHEAD_STATS_COUNT] = {
+    "capture", "symbolize", "format", "write", "flush", "writer"
+  };
+
+  #define STAT(Index)  ((unsigned)ReadU64 (Stats + (Index) * 8))
+
+  fputs ("\r\n", gOut);
+  fputs (LINE, gOut);
+  fputs ("- STATISTICS\r\n", gOut);
+  fprintf (gOut, "- Names:  %10u unique, %10u references, %10u bytes stored, %10u bytes saved\r\n",
+    STAT (0), STAT (1), STAT (2), STAT (3));
+  fprintf (gOut, "- Cache:  %10u hits, %10u misses, %10u invalidations (handle names)\r\n",
+    STAT (4), STAT (5), STAT (6));
+  fprintf (gOut, "- Memory: %10u allocations from arena, %10u bytes, %10u chunks, %10u pages\r\n",
+    STAT (7), STAT (8), STAT (9), STAT (10));
+  fprintf (gOut, "- Events: %10u stored, %10u bytes in %10u blocks\r\n",
+    STAT (11), STAT (12), STAT (13));
+  if (gVersion >= 2) {
+    fprintf (gOut, "- Disks:  %10u probed for log.txt, %10u probes saved by waiting for new volumes\r\n",
+      STAT (14), STAT (15));
+  }
+  if (gVersion >= 3 && ReadU64 (Stats + 16 * 8) != 0) {
+    uint64_t Events     = ReadU64 (Stats + 16 * 8);
+    uint64_t FlushTicks = ReadU64 (Stats + 17 * 8);
+
+    fprintf (gOut, "- Deferred: %10u events written at once, %10u us per one-event flush, ~%10u us saved (estimate: a flush per event)\r\n",
+      (unsigned)Events,
+      (unsigned)ToMicroseconds (FlushTicks),
+      (unsigned)ToMicroseconds (FlushTicks * (Events - 1)));
+  }
+
+  #undef STAT
+
+  if (gFrequency != 0) {
+    const uint8_t *Calls    = Stats + BINARY_LOG_STATISTICS_COUNTERS (gVersion) * 8;
+    const uint8_t *Overhead = Calls + BINARY_LOG_CALL_STATS_COUNT * 40;
+
+    if (gVersion >= 4) {
+      PrintCallStats (Calls,
+        "- Calls:  top %u protocols by time spent in single-protocol gBS services, notifications included\r\n");
+      PrintCallStats (Overhead + BINARY_LOG_OVERHEAD_STATS_COUNT * 16,
+        "- Multi:  top %u Install/UninstallMultipleProtocolInterfaces() calls by time, keyed by the first protocol listed\r\n");
+    } else {
+      PrintCallStats (Calls,
+        "- Calls:  top %u protocols by time spent in gBS protocol services, notifications included\r\n");
+    }
+
+    fputs ("- Overhead: time spent by the logger itself\r\n", gOut);
+    for (unsigned Stage = 0; Stage < BINARY_LOG_OVERHEAD_STATS_COUNT; ++Stage) {
+      fprintf (gOut, "-   %-10s %10u calls, %10u us%s\r\n",
+        StageNames[Stage],
+        (unsigned)ReadU64 (Overhead + Stage * 16),
+        (unsigned)ToMicroseconds (ReadU64 (Overhead + Stage * 16 + 8)),
+        Stage + 1 == BINARY_LOG_OVERHEAD_STATS_COUNT ? " (symbolize on the writer side, format, write, flush)" : ""
+        );
+    }
+  }
+
+  fputs (LINE, gOut);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Разбирает двоичный лог и печатает его текстом.
+ *
+ * @return 0, если лог повреждён; то, что удалось разобрать, уже напечатано.
+ */
+static int
+DecodeLog (
+  const BLOB *Log
+  )
+{
+  const uint8_t *Buffer = Log->Buffer;
+
+  if (Log->Size < BINARY_LOG_FILE_HEADER_SIZE
+    || ReadU32 (Buffer) != BINARY_LOG_SIGNATURE
+    || ReadU16 (Buffer + 4) == 0
+    || ReadU16 (Buffer + 4) > BINARY_LOG_VERSION
+    || ReadU16 (Buffer + 6) < BINARY_LOG_FILE_HEADER_SIZE
+    || ReadU16 (Buffer + 6) > Log->Size) {
+    fprintf (stderr, "Not a DxeLoadingLogger binary log, or an unsupported version\n");
+    return 0;
+  }
+
+  gVersion   = ReadU16 (Buffer + 4);
+  gFrequency = ReadU64 (Buffer + 8);
+
+  size_t   Offset      = ReadU16 (Buffer + 6);
+  unsigned EventNumber = 0;
+
+  while (Offset + BINARY_LOG_RECORD_HEADER_SIZE <= Log->Size) {
+    const uint8_t *Record   = Buffer + Offset;
+    uint16_t      Length    = ReadU16 (Record);
+    uint8_t       Type      = Record[2];
+    uint8_t       Flags     = Record[3];
+    uint64_t      Timestamp = ReadU64 (Record + 4);
+
+    if (Length < BINARY_LOG_RECORD_HEADER_SIZE || Offset + Length > Log->Size) {
+      break;
+    }
+
+    // Запись статистики последняя, дальше в заранее растянутом файле может лежать что угодно.
+    if (Type == BINARY_LOG_RECORD_STATISTICS) {
+      if (Length != BINARY_LOG_RECORD_HEADER_SIZE + BINARY_LOG_STATISTICS_SIZE (gVersion)) {
+        break;
+      }
+      PrintStatistics (Record + BINARY_LOG_RECORD_HEADER_SIZE);
+      return 1;
+    }
+
+    if (!PrintEvent (Type, Flags, Timestamp, Record + BINARY_LOG_RECORD_HEADER_SIZE, Record + Length, ++EventNumber)) {
+      break;
+    }
+
+    Offset += Length;
+  }
+
+  // Машина перезагрузилась посреди записи порции: всё, что до этого места, напечатано.
+  fprintf (stderr, "The log is truncated or corrupted at offset %zu\n", Offset);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+int
+main (
+  int  argc,
+  char **argv
+  )
+{
+  const char *DatabasePath = NULL;
+  const char *LogPath      = NULL;
+  const char *OutPath      = NULL;
+
+  for (int Index = 1; Index < argc; ++Index) {
+    if (strcmp (argv[Index], "-g") == 0 && Index + 1 < argc) {
+      DatabasePath = argv[++Index];
+    } else if (LogPath == NULL) {
+      LogPath = argv[Index];
+    } else if (OutPath == NULL) {
+      OutPath = argv[Index];
+    } else {
+      LogPath = NULL;
+      break;
+    }
+  }
+
+  if (LogPath == NULL) {
+    fprintf (stderr, "Usage: %s [-g guiddb.bin] log.txt [out.txt]\n", argv[0]);
+    return 2;
+  }
+
+  BLOB Database;
+  if (DatabasePath != NULL) {
+    if (!ReadFile (DatabasePath, &Database)) {
+      return 1;
+    }
+    if (!ParseDatabase (&Database)) {
+      fprintf (stderr, "%s: corrupted GUID database\n", DatabasePath);
+      return 1;
+    }
+  }
+
+  BLOB Log;
+  if (!ReadFile (LogPath, &Log)) {
+    return 1;
+  }
+
+  gOut = stdout;
+  if (OutPath != NULL) {
+    gOut = fopen (OutPath, "wb");
+    if (gOut == NULL) {
+      perror (OutPath);
+      return 1;
+    }
+  }
+
+  int Decoded = DecodeLog (&Log);
+
+  if (gOut != stdout) {
+    fclose (gOut);
+  }
+
+  return Decoded ? 0 : 1;
+}